@@ -88,6 +88,13 @@ const config = function() {
     function posePointColor() { return "red"; }
     function averageSpeedMs() { return 2000; }
 
+    /**
+     * @returns {number} - milliseconds between repeats of an unchanged
+     *                     command, so the rover's deadman timer (1000ms)
+     *                     knows we are still here.
+     */
+    function commandHeartbeatMs() { return 250; }
+
     const self = {
         "telemetryPlotMs": telemetryPlotMs,
         "telemetryBufferSize": telemetryBufferSize,
@@ -103,6 +110,7 @@ const config = function() {
         "poseLineColor": poseLineColor,
         "posePointColor": posePointColor,
         "averageSpeedMs": averageSpeedMs,
+        "commandHeartbeatMs": commandHeartbeatMs,
     }
 
     return self;
@@ -3902,6 +3910,7 @@ function RollbackState(defaultState = {}) {
 function RoverCommand(host, commandSocket) {
     let running = false;
     let lastCommand = "";
+    let lastCommandMs = 0;  // time lastCommand was sent
     let commandCount = 0;
     let _useSpeedControl = false;
     let _minSpeed = 0;
@@ -4211,12 +4220,14 @@ function RoverCommand(host, commandSocket) {
                         lastCommand = "";   // clear last command sent before error so can send it again.
                     }
                     if(!commandSocket.isSending()) {
-                        if(commandString == lastCommand) {
-                            return true;    // no need to execute it again
+                        const now = performance.now();
+                        if((commandString == lastCommand) && ((now - lastCommandMs) < config.commandHeartbeatMs())) {
+                            return true;    // no need to execute it again until heartbeat is due
                         }
                         const commandWrapper = `cmd(${commandCount}, ${commandString})`
                         if(commandSocket.sendCommand(commandWrapper)) {
                             lastCommand = commandString;
+                            lastCommandMs = now;
                             commandCount += 1;
                             return true;
                         }
@@ -4381,6 +4392,10 @@ function RoverCommand(host, commandSocket) {
                 // put command back in queue
                 _commandQueue.unshift(command)
             }
+        } else if(isReady() && !isSending()) {
+            // keep the rover's deadman timer fed while idle;
+            // sendCommand() only repeats this at the heartbeat rate.
+            return sendCommand("noop()");
         }
         return false;
     }
@@ -6955,8 +6970,11 @@ document.addEventListener('DOMContentLoaded', function (event) {
     //
     const messageBus = MessageBus();
 
-    const streamingSocket = StreamingSocket(location.hostname, 81, view);
-    const commandSocket = CommandSocket(location.hostname, 82, messageBus);
+    // sockets are on the two ports after the page's;
+    // 81 and 82 on the rover, offset in the simulator
+    const httpPort = parseInt(location.port || "80");
+    const streamingSocket = StreamingSocket(location.hostname, httpPort + 1, view);
+    const commandSocket = CommandSocket(location.hostname, httpPort + 2, messageBus);
     const roverCommand = RoverCommand(baseHost, commandSocket);
 
     const joystickContainer = document.getElementById("joystick-control");
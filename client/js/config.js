@@ -37,6 +37,13 @@ const config = function() {
     function posePointColor() { return "red"; }
     function averageSpeedMs() { return 2000; }
 
+    /**
+     * @returns {number} - milliseconds between repeats of an unchanged
+     *                     command, so the rover's deadman timer (1000ms)
+     *                     knows we are still here.
+     */
+    function commandHeartbeatMs() { return 250; }
+
     const self = {
         "telemetryPlotMs": telemetryPlotMs,
         "telemetryBufferSize": telemetryBufferSize,
@@ -52,6 +59,7 @@ const config = function() {
         "poseLineColor": poseLineColor,
         "posePointColor": posePointColor,
         "averageSpeedMs": averageSpeedMs,
+        "commandHeartbeatMs": commandHeartbeatMs,
     }
 
     return self;
@@ -132,8 +132,11 @@ document.addEventListener('DOMContentLoaded', function (event) {
     //
     const messageBus = MessageBus();
 
-    const streamingSocket = StreamingSocket(location.hostname, 81, view);
-    const commandSocket = CommandSocket(location.hostname, 82, messageBus);
+    // sockets are on the two ports after the page's;
+    // 81 and 82 on the rover, offset in the simulator
+    const httpPort = parseInt(location.port || "80");
+    const streamingSocket = StreamingSocket(location.hostname, httpPort + 1, view);
+    const commandSocket = CommandSocket(location.hostname, httpPort + 2, messageBus);
     const roverCommand = RoverCommand(baseHost, commandSocket);
 
     const joystickContainer = document.getElementById("joystick-control");
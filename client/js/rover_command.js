@@ -8,6 +8,7 @@
 function RoverCommand(host, commandSocket) {
     let running = false;
     let lastCommand = "";
+    let lastCommandMs = 0;  // time lastCommand was sent
     let commandCount = 0;
     let _useSpeedControl = false;
     let _minSpeed = 0;
@@ -317,12 +318,14 @@ function RoverCommand(host, commandSocket) {
                         lastCommand = "";   // clear last command sent before error so can send it again.
                     }
                     if(!commandSocket.isSending()) {
-                        if(commandString == lastCommand) {
-                            return true;    // no need to execute it again
+                        const now = performance.now();
+                        if((commandString == lastCommand) && ((now - lastCommandMs) < config.commandHeartbeatMs())) {
+                            return true;    // no need to execute it again until heartbeat is due
                         }
                         const commandWrapper = `cmd(${commandCount}, ${commandString})`
                         if(commandSocket.sendCommand(commandWrapper)) {
                             lastCommand = commandString;
+                            lastCommandMs = now;
                             commandCount += 1;
                             return true;
                         }
@@ -487,6 +490,10 @@ function RoverCommand(host, commandSocket) {
                 // put command back in queue
                 _commandQueue.unshift(command)
             }
+        } else if(isReady() && !isSending()) {
+            // keep the rover's deadman timer fed while idle;
+            // sendCommand() only repeats this at the heartbeat rate.
+            return sendCommand("noop()");
         }
         return false;
     }
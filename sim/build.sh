@@ -0,0 +1,57 @@
+#!/bin/bash
+#
+# Build the host simulator and the load test client;
+# run from the sim directory.
+#
+# The firmware is first built into librover.a, a native
+# library of the whole control stack on the Linux backend
+# of the hardware abstraction (src/hal), with wheel encoders
+# on interrupts as on the rover, and websockets from the
+# mock in sim/mock.  The simulator links against it.
+# Extra arguments are passed to the compiler, like -pg or
+# -g for profiling.
+#
+# The firmware is built a second time with USE_MULTIPLEX_SOCKET
+# into librover_mux.a and rover_sim_mux, which carries commands,
+# telemetry and video on the one socket of mux_socket.cpp.
+#
+# ./build.sh && ./rover_sim -g 100,50
+#
+FIRMWARE=$(find ../src -name '*.cpp' \
+    ! -name main.cpp \
+    ! -name camera_wrap.cpp \
+    ! -name udp_socket.cpp \
+    ! -name esp32_wifi_radio.cpp \
+    ! -name preferences_storage.cpp \
+    ! -name esp32_hal.cpp)
+
+FLAGS="-DTESTING -DUSE_WHEEL_ENCODERS=1 -DUSE_ENCODER_INTERRUPTS=1 -std=c++11 -O2 $* -I../src -Imock"
+MUX_FLAGS="$FLAGS -DUSE_MULTIPLEX_SOCKET=1"
+
+#
+# build the firmware into a library
+#
+firmware() {
+    local directory=$1
+    local library=$2
+    local flags=$3
+    local objects=""
+    mkdir "$directory"
+    for source in $FIRMWARE; do
+        object="$directory/$(echo "${source#../src/}" | tr / _ | sed 's/\.cpp$/.o/')"
+        objects="$objects $object"
+        g++ $flags -c "$source" -o "$object" &
+    done
+    wait
+    rm -f "$library"
+    ar rcs "$library" $objects
+}
+
+rm -rf build build_mux
+firmware build librover.a "$FLAGS" \
+&& firmware build_mux librover_mux.a "$MUX_FLAGS" \
+&& g++ $FLAGS -o rover_sim simulator.cpp plant.cpp camera_replay.cpp http_server.cpp \
+    mock/websockets_server.cpp librover.a \
+&& g++ $MUX_FLAGS -o rover_sim_mux simulator.cpp plant.cpp camera_replay.cpp http_server.cpp \
+    mock/websockets_server.cpp librover_mux.a \
+&& g++ -std=c++11 -O2 "$@" -o load_client load_client.cpp
@@ -0,0 +1,156 @@
+#include <stdio.h>
+#include <string.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "hal/clock.h"
+#include "camera/camera_wrap.h"
+#include "camera_replay.h"
+#include "error.h"
+
+static std::vector<std::string> frames;     // jpeg bytes
+static size_t nextFrame = 0;
+static unsigned long frameIntervalUs = 1000000 / 20;
+static unsigned long lastFrameUs = 0;
+static bool captured = false;
+
+//
+// camera properties the web client reads and sets;
+// kept, but they do not change the replayed frames
+//
+static std::map<std::string, int> properties = {
+    {"framesize", 5}, {"quality", 10}, {"brightness", 0}, {"contrast", 0},
+    {"saturation", 0}, {"sharpness", 0}, {"special_effect", 0}, {"wb_mode", 0},
+    {"awb", 1}, {"awb_gain", 1}, {"aec", 1}, {"aec2", 0}, {"ae_level", 0},
+    {"aec_value", 168}, {"agc", 1}, {"agc_gain", 0}, {"gainceiling", 0},
+    {"bpc", 0}, {"wpc", 1}, {"raw_gma", 1}, {"lenc", 1}, {"vflip", 0},
+    {"hmirror", 0}, {"dcw", 1}, {"colorbar", 0},
+};
+
+static bool loadFile(const std::string &path) {
+    FILE *file = fopen(path.c_str(), "rb");
+    if(nullptr == file) {
+        return false;
+    }
+    std::string bytes;
+    char buffer[8192];
+    size_t count;
+    while((count = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+        bytes.append(buffer, count);
+    }
+    fclose(file);
+
+    // must at least start like a jpeg
+    if((bytes.size() < 4) || ((uint8_t)bytes[0] != 0xFF) || ((uint8_t)bytes[1] != 0xD8)) {
+        return false;
+    }
+    frames.push_back(bytes);
+    return true;
+}
+
+/**
+ * Load the frames to replay
+ */
+bool simCameraLoad(const char *path) // IN : a jpeg file, or a directory of .jpg files
+                                     // RET: true if at least one frame was loaded
+{
+    frames.clear();
+    nextFrame = 0;
+
+    struct stat info;
+    if((nullptr == path) || (0 != stat(path, &info))) {
+        return false;
+    }
+    if(!S_ISDIR(info.st_mode)) {
+        return loadFile(path);
+    }
+
+    std::vector<std::string> names;
+    DIR *directory = opendir(path);
+    if(nullptr == directory) {
+        return false;
+    }
+    struct dirent *entry;
+    while(nullptr != (entry = readdir(directory))) {
+        const size_t length = strlen(entry->d_name);
+        if((length > 4) && ((0 == strcasecmp(entry->d_name + length - 4, ".jpg")) || ((length > 5) && (0 == strcasecmp(entry->d_name + length - 5, ".jpeg"))))) {
+            names.push_back(entry->d_name);
+        }
+    }
+    closedir(directory);
+
+    std::sort(names.begin(), names.end());
+    for(size_t i = 0; i < names.size(); i += 1) {
+        loadFile(std::string(path) + "/" + names[i]);
+    }
+    return !frames.empty();
+}
+
+void simCameraFrameRate(unsigned int fps) {
+    frameIntervalUs = 1000000 / ((fps > 0) ? fps : 1);
+}
+
+unsigned int simCameraFrameCount() {
+    return (unsigned int)frames.size();
+}
+
+int initCamera() {
+    return frames.empty() ? FAILURE : SUCCESS;
+}
+
+/**
+ * The stream asks for a frame every loop; the real camera
+ * blocks until the next frame is ready.  Simulated time
+ * cannot pass while blocked, so instead there is nothing
+ * to process until the next frame is due.
+ */
+int processImage(int (*processor)(uint8_t *, size_t)) {
+    if(frames.empty()) {
+        return FAILURE;
+    }
+    if(captured && (halMicros() - lastFrameUs < frameIntervalUs)) {
+        return SUCCESS;
+    }
+    captured = true;
+    lastFrameUs = halMicros();
+
+    std::string &frame = frames[nextFrame];
+    nextFrame = (nextFrame + 1) % frames.size();
+    return (nullptr != processor) ? processor((uint8_t *)&frame[0], frame.size()) : SUCCESS;
+}
+
+esp_err_t grabImage(size_t& jpg_buf_len, uint8_t *jpg_buf) {
+    if(frames.empty()) {
+        return ESP_FAIL;
+    }
+    // caller's buffer size is not passed; main.cpp allocates 68123 bytes
+    const std::string &frame = frames[nextFrame];
+    if(frame.size() > 68123) {
+        return ESP_FAIL;
+    }
+    memcpy(jpg_buf, frame.data(), frame.size());
+    jpg_buf_len = frame.size();
+    return ESP_OK;
+}
+
+String getCameraPropertiesJson() {
+    std::string json = "{\"enabled\":true";
+    for(std::map<std::string, int>::const_iterator i = properties.begin(); i != properties.end(); ++i) {
+        json += ",\"" + i->first + "\":" + std::to_string(i->second);
+    }
+    json += "}";
+    return json;
+}
+
+int setCameraProperty(String varParam, String valParam) {
+    std::map<std::string, int>::iterator property = properties.find(varParam);
+    if(properties.end() == property) {
+        return FAILURE;
+    }
+    property->second = atoi(valParam.c_str());
+    return SUCCESS;
+}
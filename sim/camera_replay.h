@@ -0,0 +1,25 @@
+#ifndef SIM_CAMERA_REPLAY_H
+#define SIM_CAMERA_REPLAY_H
+
+//
+// Replayed camera feed; implements camera/camera_wrap.h
+// for the simulator.  Frames are jpeg files replayed in
+// order, looping, at a fixed rate in simulated time, so
+// the stream socket sends them as it would camera frames.
+//
+
+/**
+ * Load the frames to replay
+ */
+bool simCameraLoad(const char *path);   // IN : a jpeg file, or a directory of .jpg files
+                                        //      replayed in name order, like sim/frames
+                                        // RET: true if at least one frame was loaded
+
+/**
+ * Set the frame rate in simulated time
+ */
+void simCameraFrameRate(unsigned int fps);  // IN : frames per second; the rover manages 10 to 25
+
+unsigned int simCameraFrameCount();
+
+#endif // SIM_CAMERA_REPLAY_H
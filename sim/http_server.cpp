@@ -0,0 +1,230 @@
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <string>
+#include <vector>
+
+#include "camera/camera_wrap.h"
+#include "http_server.h"
+#include "error.h"
+
+static const unsigned int HTTP_MAX_REQUEST = 8 * 1024;  // larger requests are refused
+static const unsigned int HTTP_MAX_CONNECTIONS = 32;
+
+typedef struct HttpConnection {
+    int fd;
+    std::string input;      // request received so far
+    std::string output;     // response not yet written
+    bool answered;          // close once output is written
+} HttpConnection;
+
+static int listenFd = -1;
+static std::string directory;
+static std::vector<HttpConnection> connections;
+static unsigned long requests = 0;
+
+static const char *contentType(const std::string &path) {
+    const size_t dot = path.rfind('.');
+    const std::string extension = (std::string::npos == dot) ? "" : path.substr(dot);
+    if(".html" == extension) return "text/html";
+    if(".js" == extension) return "text/javascript";
+    if(".css" == extension) return "text/css";
+    if(".json" == extension) return "application/json";
+    if((".jpg" == extension) || (".jpeg" == extension)) return "image/jpeg";
+    if(".png" == extension) return "image/png";
+    if(".ico" == extension) return "image/x-icon";
+    return "application/octet-stream";
+}
+
+static std::string response(int status, const char *type, const std::string &body) {
+    const char *reason = (200 == status) ? "OK"
+        : (400 == status) ? "Bad Request"
+        : (404 == status) ? "Not Found"
+        : (405 == status) ? "Method Not Allowed"
+        : "Internal Server Error";
+
+    char header[256];
+    snprintf(header, sizeof(header),
+        "HTTP/1.1 %d %s\r\n"
+        "Content-Type: %s\r\n"
+        "Content-Length: %u\r\n"
+        "Cache-Control: no-cache\r\n"
+        "Access-Control-Allow-Origin: *\r\n"
+        "Connection: close\r\n"
+        "\r\n",
+        status, reason, type, (unsigned int)body.size());
+    return std::string(header) + body;
+}
+
+/**
+ * Get a query parameter, like 'var' in /control?var=quality&val=10
+ */
+static std::string queryParam(const std::string &query, const char *name) {
+    const std::string key = std::string(name) + "=";
+    size_t start = 0;
+    while(start < query.size()) {
+        size_t end = query.find('&', start);
+        if(std::string::npos == end) end = query.size();
+        if(0 == query.compare(start, key.size(), key)) {
+            return query.substr(start + key.size(), end - start - key.size());
+        }
+        start = end + 1;
+    }
+    return "";
+}
+
+static std::string readFile(const std::string &path, bool &found) {
+    std::string bytes;
+    FILE *file = fopen(path.c_str(), "rb");
+    found = (nullptr != file);
+    if(found) {
+        char buffer[8192];
+        size_t count;
+        while((count = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+            bytes.append(buffer, count);
+        }
+        fclose(file);
+    }
+    return bytes;
+}
+
+static std::string answer(const std::string &method, const std::string &target) {
+    if("GET" != method) {
+        return response(405, "text/plain", "only GET is supported\n");
+    }
+
+    const size_t mark = target.find('?');
+    const std::string path = target.substr(0, mark);
+    const std::string query = (std::string::npos == mark) ? "" : target.substr(mark + 1);
+
+    if("/status" == path) {
+        return response(200, "application/json", getCameraPropertiesJson());
+    }
+    if("/control" == path) {
+        const std::string var = queryParam(query, "var");
+        const std::string val = queryParam(query, "val");
+        if(var.empty() || val.empty()) {
+            return response(400, "text/plain", "bad request; both the var and val params must be present.");
+        }
+        return response((SUCCESS == setCameraProperty(var, val)) ? 200 : 500, "text/plain", "");
+    }
+    if("/capture" == path) {
+        std::string frame(68123, '\0');     // as the rover allocates
+        size_t length = 0;
+        if(ESP_OK != grabImage(length, (uint8_t *)&frame[0])) {
+            return response(500, "text/plain", "Error capturing image from camera");
+        }
+        frame.resize(length);
+        return response(200, "image/jpeg", frame);
+    }
+
+    // anything else is a file in the client directory
+    if(path.empty() || ('/' != path[0]) || (std::string::npos != path.find(".."))) {
+        return response(400, "text/plain", "bad path\n");
+    }
+    const std::string file = directory + (("/" == path) ? std::string("/index.html") : path);
+    bool found;
+    const std::string body = readFile(file, found);
+    if(!found) {
+        return response(404, "text/plain", "Not found: " + path + "\n");
+    }
+    return response(200, contentType(file), body);
+}
+
+bool httpServerInit(unsigned int port, const char *clientDir) {
+    directory = (nullptr != clientDir) ? clientDir : "../client";
+
+    const int fd = socket(AF_INET, SOCK_STREAM, 0);
+    if(fd < 0) {
+        return false;
+    }
+    const int on = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+
+    struct sockaddr_in address;
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_ANY);
+    address.sin_port = htons((uint16_t)port);
+    if((0 != bind(fd, (struct sockaddr *)&address, sizeof(address))) || (0 != listen(fd, 64))) {
+        close(fd);
+        return false;
+    }
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+    listenFd = fd;
+    return true;
+}
+
+void httpServerPoll() {
+    if(listenFd < 0) {
+        return;
+    }
+
+    int fd;
+    while((fd = accept(listenFd, nullptr, nullptr)) >= 0) {
+        if(connections.size() >= HTTP_MAX_CONNECTIONS) {
+            close(fd);
+            continue;
+        }
+        fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+        connections.push_back({fd, std::string(), std::string(), false});
+    }
+
+    for(size_t i = 0; i < connections.size(); ) {
+        HttpConnection &connection = connections[i];
+        bool closed = false;
+
+        if(!connection.answered) {
+            char buffer[4096];
+            const ssize_t count = recv(connection.fd, buffer, sizeof(buffer), 0);
+            if(count > 0) {
+                connection.input.append(buffer, count);
+            } else if((0 == count) || ((EAGAIN != errno) && (EWOULDBLOCK != errno))) {
+                closed = true;
+            }
+
+            const size_t end = connection.input.find("\r\n\r\n");
+            if(std::string::npos != end) {
+                // request line is like "GET /status HTTP/1.1"
+                const size_t lineEnd = connection.input.find("\r\n");
+                const std::string line = connection.input.substr(0, lineEnd);
+                const size_t first = line.find(' ');
+                const size_t second = line.find(' ', first + 1);
+                if((std::string::npos == first) || (std::string::npos == second)) {
+                    connection.output = response(400, "text/plain", "bad request\n");
+                } else {
+                    connection.output = answer(line.substr(0, first), line.substr(first + 1, second - first - 1));
+                }
+                connection.answered = true;
+                requests += 1;
+            } else if(connection.input.size() > HTTP_MAX_REQUEST) {
+                connection.output = response(400, "text/plain", "request too large\n");
+                connection.answered = true;
+            }
+        }
+
+        if(!closed && !connection.output.empty()) {
+            const ssize_t count = send(connection.fd, connection.output.data(), connection.output.size(), MSG_NOSIGNAL);
+            if(count > 0) {
+                connection.output.erase(0, count);
+            } else if((count < 0) && (EAGAIN != errno) && (EWOULDBLOCK != errno)) {
+                closed = true;
+            }
+        }
+
+        if(closed || (connection.answered && connection.output.empty())) {
+            close(connection.fd);
+            connections.erase(connections.begin() + i);
+        } else {
+            i += 1;
+        }
+    }
+}
+
+unsigned long httpServerRequests() {
+    return requests;
+}
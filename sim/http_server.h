@@ -0,0 +1,30 @@
+#ifndef SIM_HTTP_SERVER_H
+#define SIM_HTTP_SERVER_H
+
+//
+// The rover's web server, for the simulator: serves the web
+// client from the client directory and answers the camera
+// endpoints the client uses (/status, /control and /capture)
+// from the replayed camera.
+//
+// Requests are GETs answered in full, then the connection
+// is closed; sockets are non-blocking and polled from the
+// loop, so a slow browser never stalls simulated time.
+//
+
+/**
+ * Listen for http requests
+ */
+bool httpServerInit(
+    unsigned int port,          // IN : port; 80 on the rover
+    const char *clientDir);     // IN : directory with index.html and the bundles
+                                // RET: true if listening
+
+/**
+ * Accept, read and answer requests
+ */
+void httpServerPoll();
+
+unsigned long httpServerRequests();     // requests answered
+
+#endif // SIM_HTTP_SERVER_H
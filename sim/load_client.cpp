@@ -0,0 +1,391 @@
+//
+// Load test for the rover's sockets, as served by
+// rover_sim --serve (or a real rover, with -P 0).
+//
+// Opens many websocket clients on the command socket, each
+// sending twist commands at a fixed rate and timing the ack
+// that echoes each one, and optionally clients on the stream
+// socket that count camera frames.  Clients answer the rover's
+// ping with a pong, as the web client does.
+//
+// With --mux it opens one client on the multiplexed socket
+// (rover_sim_mux, or a rover built with USE_MULTIPLEX_SOCKET),
+// sending the same commands on the command channel and counting
+// the telemetry and video that come back on the same socket.
+//
+// see sim/README.md for usage
+//
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <getopt.h>
+#include <netdb.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <string>
+#include <vector>
+
+typedef std::chrono::steady_clock Clock;
+
+typedef struct LoadOptions {
+    const char *host = "localhost";
+    unsigned int portOffset = 8000;
+    unsigned int commandClients = 4;
+    unsigned int streamClients = 0;
+    float rateHz = 10;          // commands per second per client
+    float seconds = 10;
+    float linear = 20;          // cm/sec
+    float angular = 0.1;        // rad/sec
+    bool verbose = false;
+    bool mux = false;           // one client on the multiplexed socket
+} LoadOptions;
+
+typedef struct LoadClient {
+    int fd = -1;
+    bool stream = false;        // counts frames rather than sending commands
+    bool upgraded = false;
+    bool ponged = false;
+    bool closed = false;
+    std::string input;
+    std::string output;
+    unsigned int nextId = 1;
+    Clock::time_point nextSend;
+    std::deque<Clock::time_point> waiting;  // send times of commands not yet answered
+} LoadClient;
+
+typedef struct LoadStats {
+    unsigned long sent = 0;
+    unsigned long acks = 0;
+    unsigned long nacks = 0;
+    unsigned long other = 0;    // telemetry and state
+    unsigned long frames = 0;
+    unsigned long long frameBytes = 0;
+    unsigned long refused = 0;  // handshake failed or closed by rover
+    std::vector<double> latencyMs;
+} LoadStats;
+
+static void usage(const char *program) {
+    fprintf(stderr,
+        "usage: %s [options]\n"
+        "  -H, --host HOST         rover or simulator host (default localhost)\n"
+        "  -P, --port-offset N     sockets on ports 81 and 82 plus N (default 8000)\n"
+        "  -n, --clients N         command clients (default 4)\n"
+        "  -s, --stream N          stream clients (default 0)\n"
+        "  -r, --rate HZ           commands per second per client (default 10)\n"
+        "  -t, --time SECONDS      time to run (default 10)\n"
+        "  -m, --mux               one client on the multiplexed socket on port 82;\n"
+        "                          -n and -s are ignored\n"
+        "  -v, --verbose           print every message received\n",
+        program);
+}
+
+static bool parseOptions(int argc, char *argv[], LoadOptions &options) {
+    static const struct option longOptions[] = {
+        {"host", required_argument, nullptr, 'H'},
+        {"port-offset", required_argument, nullptr, 'P'},
+        {"clients", required_argument, nullptr, 'n'},
+        {"stream", required_argument, nullptr, 's'},
+        {"rate", required_argument, nullptr, 'r'},
+        {"time", required_argument, nullptr, 't'},
+        {"mux", no_argument, nullptr, 'm'},
+        {"verbose", no_argument, nullptr, 'v'},
+        {"help", no_argument, nullptr, 'h'},
+        {nullptr, 0, nullptr, 0},
+    };
+    int c;
+    while(-1 != (c = getopt_long(argc, argv, "H:P:n:s:r:t:mvh", longOptions, nullptr))) {
+        switch(c) {
+            case 'H': options.host = optarg; break;
+            case 'P': options.portOffset = (unsigned int)atoi(optarg); break;
+            case 'n': options.commandClients = (unsigned int)atoi(optarg); break;
+            case 's': options.streamClients = (unsigned int)atoi(optarg); break;
+            case 'r': options.rateHz = atof(optarg); break;
+            case 't': options.seconds = atof(optarg); break;
+            case 'm': options.mux = true; break;
+            case 'v': options.verbose = true; break;
+            default: return false;
+        }
+    }
+    if(options.mux) {
+        // the rover sends replies and video to the last client to answer its ping
+        options.commandClients = 1;
+        options.streamClients = 0;
+    }
+    return (options.rateHz > 0) && (options.seconds > 0) && (options.commandClients + options.streamClients > 0);
+}
+
+static int connectTo(const char *host, unsigned int port) {
+    struct addrinfo hints;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_STREAM;
+    struct addrinfo *addresses = nullptr;
+    char service[8];
+    snprintf(service, sizeof(service), "%u", port);
+    if((0 != getaddrinfo(host, service, &hints, &addresses)) || (nullptr == addresses)) {
+        return -1;
+    }
+    const int fd = socket(addresses->ai_family, addresses->ai_socktype, addresses->ai_protocol);
+    if((fd >= 0) && (0 != connect(fd, addresses->ai_addr, addresses->ai_addrlen))) {
+        close(fd);
+        freeaddrinfo(addresses);
+        return -1;
+    }
+    freeaddrinfo(addresses);
+    const int on = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+    return fd;
+}
+
+/**
+ * Append a masked frame; clients must mask what they send
+ */
+static void writeFrame(std::string &output, uint8_t opcode, const std::string &payload) {
+    output += (char)(0x80 | opcode);
+    if(payload.size() < 126) {
+        output += (char)(0x80 | payload.size());
+    } else {
+        output += (char)(0x80 | 126);
+        output += (char)(payload.size() >> 8);
+        output += (char)(payload.size() & 0xFF);
+    }
+    const uint8_t mask[4] = {(uint8_t)rand(), (uint8_t)rand(), (uint8_t)rand(), (uint8_t)rand()};
+    output.append((const char *)mask, 4);
+    for(size_t i = 0; i < payload.size(); i += 1) {
+        output += (char)(payload[i] ^ mask[i % 4]);
+    }
+}
+
+static void onText(LoadClient &client, const std::string &text, LoadStats &stats, const LoadOptions &options) {
+    if(options.verbose) {
+        printf("%s\n", text.c_str());
+    }
+
+    // replies come in order; an ack echoes the command, a nack has its status
+    const bool ack = (0 == text.compare(0, 4, "cmd("));
+    const bool nack = (0 == text.compare(0, 5, "nack("));
+    if((ack || nack) && !client.waiting.empty()) {
+        const double ms = std::chrono::duration<double, std::milli>(Clock::now() - client.waiting.front()).count();
+        client.waiting.pop_front();
+        stats.latencyMs.push_back(ms);
+        if(ack) stats.acks += 1; else stats.nacks += 1;
+    } else {
+        stats.other += 1;
+    }
+}
+
+/**
+ * A binary frame on the multiplexed socket;
+ * the first byte is its channel, see src/websockets/mux.h
+ */
+static void onMux(LoadClient &client, const std::string &frame, LoadStats &stats, const LoadOptions &options) {
+    const uint8_t channel = frame.empty() ? 0 : (uint8_t)frame[0];
+    switch(channel) {
+        case 1:     // command reply
+        case 3: {   // telemetry
+            onText(client, frame.substr(1), stats, options);
+            break;
+        }
+        case 4: {   // video chunk, after its flags
+            if((frame.size() >= 2) && (0x02 & (uint8_t)frame[1])) {
+                stats.frames += 1;
+            }
+            stats.frameBytes += (frame.size() >= 2) ? frame.size() - 2 : 0;
+            break;
+        }
+        default: {
+            stats.other += 1;
+            break;
+        }
+    }
+}
+
+/**
+ * Parse whole frames from the input; rover frames are not masked
+ */
+static void readFrames(LoadClient &client, LoadStats &stats, const LoadOptions &options) {
+    for(;;) {
+        const std::string &in = client.input;
+        if(in.size() < 2) return;
+        const uint8_t opcode = in[0] & 0x0F;
+        uint64_t length = in[1] & 0x7F;
+        size_t offset = 2;
+        if(126 == length) {
+            if(in.size() < 4) return;
+            length = ((uint8_t)in[2] << 8) | (uint8_t)in[3];
+            offset = 4;
+        } else if(127 == length) {
+            if(in.size() < 10) return;
+            length = 0;
+            for(int i = 0; i < 8; i += 1) length = (length << 8) | (uint8_t)in[2 + i];
+            offset = 10;
+        }
+        if(in.size() < offset + length) return;
+        const std::string payload = in.substr(offset, (size_t)length);
+        client.input.erase(0, offset + (size_t)length);
+
+        switch(opcode) {
+            case 0x1: onText(client, payload, stats, options); break;
+            case 0x2: {
+                if(options.mux) {
+                    onMux(client, payload, stats, options);
+                } else if(client.stream) {
+                    stats.frames += 1;
+                    stats.frameBytes += payload.size();
+                } else {
+                    stats.other += 1;
+                }
+                break;
+            }
+            case 0x8: client.closed = true; return;
+            case 0x9: writeFrame(client.output, 0xA, payload); client.ponged = true; break;
+            default: break;
+        }
+    }
+}
+
+static bool readHandshake(LoadClient &client) {
+    const size_t end = client.input.find("\r\n\r\n");
+    if(std::string::npos == end) {
+        return true;    // not yet
+    }
+    const bool switched = (0 == client.input.compare(0, 12, "HTTP/1.1 101"));
+    client.input.erase(0, end + 4);
+    client.upgraded = switched;
+    return switched;
+}
+
+static double percentile(std::vector<double> &sorted, double fraction) {
+    if(sorted.empty()) return 0;
+    const size_t i = std::min(sorted.size() - 1, (size_t)(fraction * sorted.size()));
+    return sorted[i];
+}
+
+int main(int argc, char *argv[]) {
+    LoadOptions options;
+    if(!parseOptions(argc, argv, options)) {
+        usage(argv[0]);
+        return 2;
+    }
+    srand(1);
+
+    LoadStats stats;
+    std::vector<LoadClient> clients(options.commandClients + options.streamClients);
+    const Clock::time_point start = Clock::now();
+    const Clock::duration interval = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / options.rateHz));
+
+    for(size_t i = 0; i < clients.size(); i += 1) {
+        LoadClient &client = clients[i];
+        client.stream = (i >= options.commandClients);
+        const unsigned int port = (client.stream ? 81 : 82) + options.portOffset;
+        if((client.fd = connectTo(options.host, port)) < 0) {
+            fprintf(stderr, "cannot connect to %s:%u: %s\n", options.host, port, strerror(errno));
+            return 2;
+        }
+        // spread commands over the interval so clients do not all send at once
+        client.nextSend = start + interval * i / std::max(1u, options.commandClients);
+
+        char request[256];
+        snprintf(request, sizeof(request),
+            "GET /%s HTTP/1.1\r\n"
+            "Host: %s:%u\r\n"
+            "Upgrade: websocket\r\n"
+            "Connection: Upgrade\r\n"
+            "Sec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\n"
+            "Sec-WebSocket-Protocol: arduino\r\n"
+            "Sec-WebSocket-Version: 13\r\n"
+            "\r\n",
+            client.stream ? "stream" : "command", options.host, port);
+        client.output = request;
+    }
+
+    const Clock::time_point end = start + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(options.seconds));
+    std::vector<struct pollfd> fds(clients.size());
+    while(Clock::now() < end) {
+        const Clock::time_point now = Clock::now();
+        for(size_t i = 0; i < clients.size(); i += 1) {
+            LoadClient &client = clients[i];
+            //
+            // replies on the multiplexed socket go to the last client
+            // to answer the ping, so wait for ours to be answered
+            //
+            if(!client.closed && client.upgraded && !client.stream && (now >= client.nextSend) && (client.ponged || !options.mux)) {
+                char command[64];
+                snprintf(command, sizeof(command), "cmd(%u, twist(%g, %g))", client.nextId++, options.linear, options.angular);
+                if(options.mux) {
+                    writeFrame(client.output, 0x2, std::string(1, (char)1) + command);
+                } else {
+                    writeFrame(client.output, 0x1, command);
+                }
+                client.waiting.push_back(now);
+                client.nextSend += interval;
+                stats.sent += 1;
+            }
+            fds[i].fd = client.closed ? -1 : client.fd;
+            fds[i].events = POLLIN | (client.output.empty() ? 0 : POLLOUT);
+            fds[i].revents = 0;
+        }
+
+        if(poll(&fds[0], fds.size(), 1) < 0) {
+            break;
+        }
+
+        for(size_t i = 0; i < clients.size(); i += 1) {
+            LoadClient &client = clients[i];
+            if(client.closed) continue;
+            if(fds[i].revents & POLLOUT) {
+                const ssize_t count = send(client.fd, client.output.data(), client.output.size(), MSG_NOSIGNAL);
+                if(count > 0) client.output.erase(0, count);
+            }
+            if(fds[i].revents & (POLLIN | POLLHUP | POLLERR)) {
+                char buffer[16384];
+                const ssize_t count = recv(client.fd, buffer, sizeof(buffer), 0);
+                if(count <= 0) {
+                    client.closed = true;
+                } else {
+                    client.input.append(buffer, count);
+                    if(!client.upgraded && !readHandshake(client)) {
+                        client.closed = true;
+                    }
+                    if(client.upgraded) {
+                        readFrames(client, stats, options);
+                    }
+                }
+                if(client.closed) {
+                    stats.refused += 1;
+                }
+            }
+        }
+    }
+
+    unsigned long unanswered = 0;
+    unsigned int ponged = 0;
+    for(size_t i = 0; i < clients.size(); i += 1) {
+        unanswered += clients[i].waiting.size();
+        if(clients[i].ponged) ponged += 1;
+        if(clients[i].fd >= 0) close(clients[i].fd);
+    }
+
+    std::sort(stats.latencyMs.begin(), stats.latencyMs.end());
+    printf("clients        %u command, %u stream; %u answered ping, %lu closed by rover\n",
+        options.commandClients, options.streamClients, ponged, stats.refused);
+    printf("commands       sent %lu, acked %lu, nacked %lu, unanswered %lu\n", stats.sent, stats.acks, stats.nacks, unanswered);
+    printf("ack latency    p50 %.2f ms, p99 %.2f ms, max %.2f ms\n",
+        percentile(stats.latencyMs, 0.5), percentile(stats.latencyMs, 0.99), stats.latencyMs.empty() ? 0 : stats.latencyMs.back());
+    printf("other messages %lu\n", stats.other);
+    if((options.streamClients > 0) || options.mux) {
+        // the rover streams to the last client to answer its ping, not to all
+        printf("stream frames  %lu, %.1f per second, %.1f KB\n",
+            stats.frames, stats.frames / options.seconds, stats.frameBytes / 1024.0);
+    }
+
+    // commands the rover never answered, or clients it closed, are failures
+    return ((0 == stats.refused) && (0 == unanswered || unanswered <= options.commandClients)) ? 0 : 1;
+}
@@ -0,0 +1,156 @@
+#ifndef SIM_MOCK_WEBSOCKETS_SERVER_H
+#define SIM_MOCK_WEBSOCKETS_SERVER_H
+
+//
+// Mock of the arduinoWebSockets server.
+//
+// In process, the simulator plays the client: it connects
+// and sends messages with simConnect() and simReceive(),
+// and sees what the firmware sends with simOnSend().
+//
+// After simListen(), the server also accepts real websocket
+// clients (like the web client in a browser) on its port,
+// using non-blocking POSIX sockets polled from loop().
+//
+// Either way events are delivered from loop(), as on the rover.
+//
+
+#include <stdint.h>
+#include <stddef.h>
+#include <functional>
+#include <vector>
+#include <string>
+
+typedef enum {
+    WStype_ERROR,
+    WStype_DISCONNECTED,
+    WStype_CONNECTED,
+    WStype_TEXT,
+    WStype_BIN,
+    WStype_FRAGMENT_TEXT_START,
+    WStype_FRAGMENT_BIN_START,
+    WStype_FRAGMENT,
+    WStype_FRAGMENT_FIN,
+    WStype_PING,
+    WStype_PONG,
+} WStype_t;
+
+typedef std::function<void(uint8_t num, WStype_t type, uint8_t *payload, size_t length)> WebSocketServerEvent;
+
+//
+// called with each message the firmware sends
+//
+typedef std::function<void(uint16_t port, uint8_t num, WStype_t type, const uint8_t *payload, size_t length)> SimSendHandler;
+
+/**
+ * Traffic counted across all clients of a server
+ */
+typedef struct SimSocketStats {
+    unsigned long accepted;     // socket connections accepted
+    unsigned long refused;      // socket connections refused; no free client slot
+    unsigned long received;     // messages received
+    unsigned long sent;         // messages sent
+    unsigned long dropped;      // messages not sent; client gone or too far behind
+    unsigned long long bytesSent;
+} SimSocketStats;
+
+class WebSocketsServer {
+    private:
+    typedef struct SimEvent {
+        uint8_t num;
+        WStype_t type;
+        std::string payload;
+    } SimEvent;
+
+    typedef struct SimClient {
+        bool connected = false;
+        bool simulated = false;     // played by the simulator rather than a socket
+        int fd = -1;
+        bool upgraded = false;      // websocket handshake done
+        std::string input;          // bytes received, not yet parsed
+        std::string output;         // bytes waiting to be written
+        std::string message;        // fragments of a message so far
+        uint8_t messageOpcode = 0;
+    } SimClient;
+
+    uint16_t _port;
+    bool _started = false;
+    int _listenFd = -1;
+    WebSocketServerEvent _onEvent;
+    std::vector<SimEvent> _events;  // waiting for loop()
+    std::vector<SimClient> _clients;
+    SimSendHandler _onSend;
+    SimSocketStats _stats = {0, 0, 0, 0, 0, 0};
+
+    bool _send(uint8_t num, WStype_t type, const uint8_t *payload, size_t length);
+    bool _listen();
+    void _accept();
+    void _read(uint8_t num);
+    bool _upgrade(uint8_t num);
+    bool _parseFrames(uint8_t num);
+    void _write(uint8_t num);
+    void _writeFrame(uint8_t num, uint8_t opcode, const uint8_t *payload, size_t length);
+    void _close(uint8_t num);
+
+    public:
+
+    WebSocketsServer(uint16_t port, const char *origin = "", const char *protocol = "arduino");
+    ~WebSocketsServer();
+
+    void begin();
+    void loop();
+    void onEvent(WebSocketServerEvent event);
+
+    bool sendTXT(uint8_t num, const char *payload, size_t length = 0);
+    bool sendTXT(uint8_t num, const uint8_t *payload, size_t length = 0) { return sendTXT(num, (const char *)payload, length); }
+    bool broadcastTXT(const char *payload, size_t length = 0);
+    bool sendBIN(uint8_t num, const uint8_t *payload, size_t length);
+    bool broadcastBIN(const uint8_t *payload, size_t length);
+    bool sendPing(uint8_t num, uint8_t *payload = NULL, size_t length = 0);
+    void disconnect(uint8_t num) { _close(num); }
+
+    uint8_t connectedClients();
+    uint16_t port() const { return _port; }
+
+    //
+    // simulator side
+    //
+
+    /**
+     * Accept socket clients on all started servers.
+     * Ports are offset so the simulator can run
+     * without permission to use ports below 1024.
+     */
+    static bool simListen(
+        unsigned int portOffset,    // IN : added to each server's port
+        unsigned int maxClients);   // IN : clients per server; the rover allows 5
+                                    // RET: true if all servers are listening
+
+    /**
+     * Find a started server by port
+     */
+    static WebSocketsServer *simServer(uint16_t port);  // IN : port passed to constructor
+                                                        // RET: server or nullptr if not started
+
+    /**
+     * Client connects; the firmware's ping
+     * is answered with a pong, as a browser would
+     */
+    void simConnect(uint8_t num);       // IN : client number
+    void simDisconnect(uint8_t num);    // IN : client number
+
+    /**
+     * Client sends a message
+     */
+    void simReceive(
+        uint8_t num,                // IN : client number
+        WStype_t type,              // IN : WStype_TEXT or WStype_BIN
+        const uint8_t *payload,     // IN : message
+        size_t length);             // IN : bytes in message
+
+    void simOnSend(SimSendHandler handler) { _onSend = handler; }
+
+    const SimSocketStats& simStats() const { return _stats; }
+};
+
+#endif // SIM_MOCK_WEBSOCKETS_SERVER_H
@@ -0,0 +1,23 @@
+#ifndef SIM_MOCK_ESP_CAMERA_H
+#define SIM_MOCK_ESP_CAMERA_H
+
+//
+// Just the types camera_wrap.h needs; the simulator
+// implements camera_wrap.h itself by replaying jpeg
+// files, so there is no camera driver to mock.
+//
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string>
+
+typedef int esp_err_t;
+#define ESP_OK    (0)
+#define ESP_FAIL  (-1)
+
+// as in parse/scan.h on the host
+#ifndef String
+    #define String std::string
+#endif
+
+#endif // SIM_MOCK_ESP_CAMERA_H
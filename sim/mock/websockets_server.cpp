@@ -0,0 +1,539 @@
+#include <string.h>
+#include <strings.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include "WebSocketsServer.h"
+
+static std::vector<WebSocketsServer *> simServers;
+static bool simListening = false;
+static unsigned int simPortOffset = 0;
+static unsigned int simMaxClients = 5;
+
+static const unsigned int SIM_MAX_MESSAGE = 64 * 1024;      // larger messages close the client
+static const unsigned int SIM_OUTPUT_LIMIT = 512 * 1024;    // client this far behind gets no more messages
+static const uint8_t SIM_NO_CLIENT = 0xFF;
+
+//
+// websocket opcodes
+//
+static const uint8_t OPCODE_CONTINUATION = 0x0;
+static const uint8_t OPCODE_TEXT = 0x1;
+static const uint8_t OPCODE_BINARY = 0x2;
+static const uint8_t OPCODE_CLOSE = 0x8;
+static const uint8_t OPCODE_PING = 0x9;
+static const uint8_t OPCODE_PONG = 0xA;
+
+/**
+ * SHA-1 of a short string; only used
+ * to answer the websocket handshake
+ */
+static void sha1(const std::string &message, uint8_t digest[20]) {
+    uint32_t h[5] = {0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0};
+
+    std::string padded = message;
+    padded += (char)0x80;
+    while(56 != (padded.size() % 64)) padded += (char)0;
+    const uint64_t bits = (uint64_t)message.size() * 8;
+    for(int i = 7; i >= 0; i -= 1) padded += (char)(bits >> (i * 8));
+
+    #define ROTATE(_x, _n) (((_x) << (_n)) | ((_x) >> (32 - (_n))))
+    for(size_t chunk = 0; chunk < padded.size(); chunk += 64) {
+        uint32_t w[80];
+        for(int i = 0; i < 16; i += 1) {
+            const uint8_t *p = (const uint8_t *)&padded[chunk + i * 4];
+            w[i] = ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+        }
+        for(int i = 16; i < 80; i += 1) {
+            w[i] = ROTATE(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+        }
+        uint32_t a = h[0], b = h[1], c = h[2], d = h[3], e = h[4];
+        for(int i = 0; i < 80; i += 1) {
+            uint32_t f, k;
+            if(i < 20)      { f = (b & c) | (~b & d);           k = 0x5A827999; }
+            else if(i < 40) { f = b ^ c ^ d;                    k = 0x6ED9EBA1; }
+            else if(i < 60) { f = (b & c) | (b & d) | (c & d);  k = 0x8F1BBCDC; }
+            else            { f = b ^ c ^ d;                    k = 0xCA62C1D6; }
+            const uint32_t t = ROTATE(a, 5) + f + e + k + w[i];
+            e = d; d = c; c = ROTATE(b, 30); b = a; a = t;
+        }
+        h[0] += a; h[1] += b; h[2] += c; h[3] += d; h[4] += e;
+    }
+    #undef ROTATE
+
+    for(int i = 0; i < 20; i += 1) {
+        digest[i] = (uint8_t)(h[i / 4] >> (24 - (i % 4) * 8));
+    }
+}
+
+static std::string base64(const uint8_t *data, size_t length) {
+    static const char *ALPHABET = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    std::string encoded;
+    for(size_t i = 0; i < length; i += 3) {
+        const uint32_t n = ((uint32_t)data[i] << 16)
+            | ((i + 1 < length) ? ((uint32_t)data[i + 1] << 8) : 0)
+            | ((i + 2 < length) ? data[i + 2] : 0);
+        encoded += ALPHABET[(n >> 18) & 0x3F];
+        encoded += ALPHABET[(n >> 12) & 0x3F];
+        encoded += (i + 1 < length) ? ALPHABET[(n >> 6) & 0x3F] : '=';
+        encoded += (i + 2 < length) ? ALPHABET[n & 0x3F] : '=';
+    }
+    return encoded;
+}
+
+/**
+ * Value of a header in an http request, or empty
+ */
+static std::string headerValue(const std::string &request, const char *name) {
+    size_t line = request.find("\r\n");
+    const size_t nameLength = strlen(name);
+    while((std::string::npos != line) && (line + 2 < request.size())) {
+        line += 2;
+        const size_t end = request.find("\r\n", line);
+        if(std::string::npos == end) break;
+        if((end - line > nameLength) && (':' == request[line + nameLength]) && (0 == strncasecmp(&request[line], name, nameLength))) {
+            size_t start = line + nameLength + 1;
+            while((start < end) && (' ' == request[start])) start += 1;
+            return request.substr(start, end - start);
+        }
+        line = end;
+    }
+    return std::string();
+}
+
+WebSocketsServer::WebSocketsServer(uint16_t port, const char *origin, const char *protocol)
+    : _port(port)
+{
+}
+
+WebSocketsServer::~WebSocketsServer() {
+    for(size_t i = 0; i < _clients.size(); i += 1) {
+        if(_clients[i].fd >= 0) {
+            close(_clients[i].fd);
+        }
+    }
+    if(_listenFd >= 0) {
+        close(_listenFd);
+    }
+    for(size_t i = 0; i < simServers.size(); i += 1) {
+        if(this == simServers[i]) {
+            simServers.erase(simServers.begin() + i);
+            break;
+        }
+    }
+}
+
+void WebSocketsServer::begin() {
+    if(!_started) {
+        _started = true;
+        _clients.resize(simMaxClients);
+        simServers.push_back(this);
+        if(simListening) {
+            _listen();
+        }
+    }
+}
+
+/**
+ * Accept, read and write sockets, then
+ * deliver waiting events to the firmware
+ */
+void WebSocketsServer::loop() {
+    if(_listenFd >= 0) {
+        _accept();
+        for(size_t num = 0; num < _clients.size(); num += 1) {
+            if(_clients[num].fd >= 0) {
+                _read((uint8_t)num);
+            }
+        }
+    }
+
+    // handlers may send, which may queue more events; deliver those next loop
+    std::vector<SimEvent> events;
+    events.swap(_events);
+    for(size_t i = 0; i < events.size(); i += 1) {
+        if(_onEvent) {
+            SimEvent &event = events[i];
+            _onEvent(event.num, event.type, (uint8_t *)&event.payload[0], event.payload.size());
+        }
+    }
+
+    if(_listenFd >= 0) {
+        for(size_t num = 0; num < _clients.size(); num += 1) {
+            if(_clients[num].fd >= 0) {
+                _write((uint8_t)num);
+            }
+        }
+    }
+}
+
+void WebSocketsServer::onEvent(WebSocketServerEvent event) {
+    _onEvent = event;
+}
+
+uint8_t WebSocketsServer::connectedClients() {
+    uint8_t count = 0;
+    for(size_t num = 0; num < _clients.size(); num += 1) {
+        if(_clients[num].connected) count += 1;
+    }
+    return count;
+}
+
+bool WebSocketsServer::_send(uint8_t num, WStype_t type, const uint8_t *payload, size_t length) {
+    if((num >= _clients.size()) || !_clients[num].connected) {
+        _stats.dropped += 1;
+        return false;
+    }
+
+    SimClient &client = _clients[num];
+    if(!client.simulated) {
+        // a slow client gets nothing more until it catches up, like a full tcp window
+        if(client.output.size() > SIM_OUTPUT_LIMIT) {
+            _stats.dropped += 1;
+            return false;
+        }
+        _writeFrame(num, (WStype_TEXT == type) ? OPCODE_TEXT : OPCODE_BINARY, payload, length);
+    }
+
+    _stats.sent += 1;
+    _stats.bytesSent += length;
+    if(_onSend) {
+        _onSend(_port, num, type, payload, length);
+    }
+    return true;
+}
+
+bool WebSocketsServer::sendTXT(uint8_t num, const char *payload, size_t length) {
+    if(0 == length) length = strlen(payload);
+    return _send(num, WStype_TEXT, (const uint8_t *)payload, length);
+}
+
+bool WebSocketsServer::broadcastTXT(const char *payload, size_t length) {
+    bool sent = true;
+    for(size_t num = 0; num < _clients.size(); num += 1) {
+        if(_clients[num].connected) sent = sendTXT((uint8_t)num, payload, length) && sent;
+    }
+    return sent;
+}
+
+bool WebSocketsServer::sendBIN(uint8_t num, const uint8_t *payload, size_t length) {
+    return _send(num, WStype_BIN, payload, length);
+}
+
+bool WebSocketsServer::broadcastBIN(const uint8_t *payload, size_t length) {
+    bool sent = true;
+    for(size_t num = 0; num < _clients.size(); num += 1) {
+        if(_clients[num].connected) sent = sendBIN((uint8_t)num, payload, length) && sent;
+    }
+    return sent;
+}
+
+bool WebSocketsServer::sendPing(uint8_t num, uint8_t *payload, size_t length) {
+    if((num >= _clients.size()) || !_clients[num].connected) {
+        return false;
+    }
+    if(_clients[num].simulated) {
+        _events.push_back({num, WStype_PONG, std::string((const char *)payload, payload ? length : 0)});
+    } else {
+        _writeFrame(num, OPCODE_PING, payload, payload ? length : 0);
+    }
+    return true;
+}
+
+bool WebSocketsServer::simListen(unsigned int portOffset, unsigned int maxClients) {
+    simListening = true;
+    simPortOffset = portOffset;
+    simMaxClients = (maxClients < SIM_NO_CLIENT) ? maxClients : SIM_NO_CLIENT - 1;
+
+    bool listening = true;
+    for(size_t i = 0; i < simServers.size(); i += 1) {
+        WebSocketsServer *server = simServers[i];
+        if(server->_clients.size() < simMaxClients) {
+            server->_clients.resize(simMaxClients);
+        }
+        listening = server->_listen() && listening;
+    }
+    return listening;
+}
+
+WebSocketsServer *WebSocketsServer::simServer(uint16_t port) {
+    for(size_t i = 0; i < simServers.size(); i += 1) {
+        if(port == simServers[i]->_port) {
+            return simServers[i];
+        }
+    }
+    return nullptr;
+}
+
+void WebSocketsServer::simConnect(uint8_t num) {
+    if(num >= _clients.size()) {
+        _clients.resize(num + 1);
+    }
+    if(!_clients[num].connected) {
+        _clients[num].connected = true;
+        _clients[num].simulated = true;
+        _events.push_back({num, WStype_CONNECTED, std::string()});
+    }
+}
+
+void WebSocketsServer::simDisconnect(uint8_t num) {
+    if((num < _clients.size()) && _clients[num].simulated) {
+        _clients[num] = SimClient();
+        _events.push_back({num, WStype_DISCONNECTED, std::string()});
+    }
+}
+
+void WebSocketsServer::simReceive(uint8_t num, WStype_t type, const uint8_t *payload, size_t length) {
+    _stats.received += 1;
+    _events.push_back({num, type, std::string((const char *)payload, length)});
+}
+
+//
+// sockets
+//
+
+bool WebSocketsServer::_listen() {
+    if(_listenFd >= 0) {
+        return true;
+    }
+
+    const int fd = socket(AF_INET, SOCK_STREAM, 0);
+    if(fd < 0) {
+        return false;
+    }
+    const int on = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+
+    struct sockaddr_in address;
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_ANY);
+    address.sin_port = htons((uint16_t)(_port + simPortOffset));
+    if((0 != bind(fd, (struct sockaddr *)&address, sizeof(address))) || (0 != listen(fd, 64))) {
+        close(fd);
+        return false;
+    }
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+    _listenFd = fd;
+    return true;
+}
+
+void WebSocketsServer::_accept() {
+    int fd;
+    while((fd = accept(_listenFd, nullptr, nullptr)) >= 0) {
+        size_t num = 0;
+        while((num < _clients.size()) && _clients[num].connected) num += 1;
+        if(num == _clients.size()) {
+            // all client slots in use, as the rover would refuse
+            _stats.refused += 1;
+            close(fd);
+            continue;
+        }
+        fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+        const int on = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+
+        _clients[num] = SimClient();
+        _clients[num].connected = true;
+        _clients[num].fd = fd;
+        _stats.accepted += 1;
+    }
+}
+
+void WebSocketsServer::_read(uint8_t num) {
+    SimClient &client = _clients[num];
+    char buffer[4096];
+    for(;;) {
+        const ssize_t count = recv(client.fd, buffer, sizeof(buffer), 0);
+        if(count > 0) {
+            client.input.append(buffer, count);
+            if(client.input.size() > SIM_MAX_MESSAGE * 2) {
+                _close(num);
+                return;
+            }
+            continue;
+        }
+        if((0 == count) || ((EAGAIN != errno) && (EWOULDBLOCK != errno))) {
+            _close(num);    // closed by peer or failed
+            return;
+        }
+        break;
+    }
+
+    if(!client.upgraded && !_upgrade(num)) {
+        return;
+    }
+    if(client.upgraded && !_parseFrames(num)) {
+        _close(num);
+    }
+}
+
+/**
+ * Answer the http upgrade request
+ */
+bool WebSocketsServer::_upgrade(uint8_t num) {
+    SimClient &client = _clients[num];
+    const size_t end = client.input.find("\r\n\r\n");
+    if(std::string::npos == end) {
+        return false;   // wait for rest of request
+    }
+    const std::string request = client.input.substr(0, end + 2);
+    client.input.erase(0, end + 4);
+
+    const std::string key = headerValue(request, "Sec-WebSocket-Key");
+    if(key.empty()) {
+        const char *response = "HTTP/1.1 400 Bad Request\r\nConnection: close\r\n\r\n";
+        client.output += response;
+        _write(num);
+        _close(num);
+        return false;
+    }
+
+    uint8_t digest[20];
+    sha1(key + "258EAFA5-E914-47DA-95CA-C5AB0DC85B11", digest);
+    std::string response =
+        "HTTP/1.1 101 Switching Protocols\r\n"
+        "Upgrade: websocket\r\n"
+        "Connection: Upgrade\r\n"
+        "Sec-WebSocket-Accept: " + base64(digest, sizeof(digest)) + "\r\n";
+
+    // a browser that asks for a protocol insists on getting one back
+    std::string protocol = headerValue(request, "Sec-WebSocket-Protocol");
+    if(!protocol.empty()) {
+        const size_t comma = protocol.find(',');
+        if(std::string::npos != comma) protocol.erase(comma);
+        response += "Sec-WebSocket-Protocol: " + protocol + "\r\n";
+    }
+    response += "\r\n";
+    client.output += response;
+    client.upgraded = true;
+
+    _events.push_back({num, WStype_CONNECTED, std::string()});
+    return true;
+}
+
+/**
+ * Turn complete frames into events
+ */
+bool WebSocketsServer::_parseFrames(uint8_t num) // RET: false if the client must be closed
+{
+    SimClient &client = _clients[num];
+    for(;;) {
+        const std::string &in = client.input;
+        if(in.size() < 2) return true;
+
+        const uint8_t *bytes = (const uint8_t *)in.data();
+        const bool fin = 0 != (bytes[0] & 0x80);
+        const uint8_t opcode = bytes[0] & 0x0F;
+        const bool masked = 0 != (bytes[1] & 0x80);
+        uint64_t length = bytes[1] & 0x7F;
+        size_t offset = 2;
+        if(126 == length) {
+            if(in.size() < 4) return true;
+            length = ((uint64_t)bytes[2] << 8) | bytes[3];
+            offset = 4;
+        } else if(127 == length) {
+            if(in.size() < 10) return true;
+            length = 0;
+            for(int i = 0; i < 8; i += 1) length = (length << 8) | bytes[2 + i];
+            offset = 10;
+        }
+        if(!masked || (length > SIM_MAX_MESSAGE)) {
+            return false;   // clients must mask; refuse huge messages
+        }
+        if(in.size() < offset + 4 + length) return true;
+
+        const uint8_t *mask = bytes + offset;
+        offset += 4;
+        std::string payload(in, offset, (size_t)length);
+        for(size_t i = 0; i < payload.size(); i += 1) {
+            payload[i] ^= mask[i % 4];
+        }
+        client.input.erase(0, offset + (size_t)length);
+
+        switch(opcode) {
+            case OPCODE_TEXT:
+            case OPCODE_BINARY:
+            case OPCODE_CONTINUATION: {
+                if(OPCODE_CONTINUATION != opcode) {
+                    client.message.clear();
+                    client.messageOpcode = opcode;
+                }
+                client.message += payload;
+                if(client.message.size() > SIM_MAX_MESSAGE) {
+                    return false;
+                }
+                if(fin) {
+                    _stats.received += 1;
+                    _events.push_back({num, (OPCODE_TEXT == client.messageOpcode) ? WStype_TEXT : WStype_BIN, client.message});
+                    client.message.clear();
+                }
+                break;
+            }
+            case OPCODE_PING: {
+                _writeFrame(num, OPCODE_PONG, (const uint8_t *)payload.data(), payload.size());
+                break;
+            }
+            case OPCODE_PONG: {
+                _events.push_back({num, WStype_PONG, payload});
+                break;
+            }
+            case OPCODE_CLOSE: {
+                _writeFrame(num, OPCODE_CLOSE, (const uint8_t *)payload.data(), payload.size() >= 2 ? 2 : 0);
+                _write(num);
+                return false;
+            }
+            default: {
+                return false;
+            }
+        }
+    }
+}
+
+void WebSocketsServer::_writeFrame(uint8_t num, uint8_t opcode, const uint8_t *payload, size_t length) {
+    std::string &out = _clients[num].output;
+    out += (char)(0x80 | opcode);
+    if(length < 126) {
+        out += (char)length;
+    } else if(length <= 0xFFFF) {
+        out += (char)126;
+        out += (char)(length >> 8);
+        out += (char)length;
+    } else {
+        out += (char)127;
+        for(int i = 7; i >= 0; i -= 1) out += (char)((uint64_t)length >> (i * 8));
+    }
+    out.append((const char *)payload, length);
+}
+
+void WebSocketsServer::_write(uint8_t num) {
+    SimClient &client = _clients[num];
+    while(!client.output.empty()) {
+        const ssize_t count = send(client.fd, client.output.data(), client.output.size(), MSG_NOSIGNAL);
+        if(count > 0) {
+            client.output.erase(0, count);
+            continue;
+        }
+        if((count < 0) && (EAGAIN != errno) && (EWOULDBLOCK != errno)) {
+            _close(num);
+        }
+        break;
+    }
+}
+
+void WebSocketsServer::_close(uint8_t num) {
+    if((num >= _clients.size()) || !_clients[num].connected) {
+        return;
+    }
+    const bool upgraded = _clients[num].upgraded || _clients[num].simulated;
+    if(_clients[num].fd >= 0) {
+        close(_clients[num].fd);
+    }
+    _clients[num] = SimClient();
+    if(upgraded) {
+        _events.push_back({num, WStype_DISCONNECTED, std::string()});
+    }
+}
@@ -0,0 +1,77 @@
+#include <math.h>
+#include "hal/linux_hal.h"
+#include "plant.h"
+
+/**
+ * Signed duty the firmware is driving
+ */
+float WheelPlant::duty() const // RET: -1.0 to 1.0; positive is forward
+{
+    return halGetDuty(_forwardPin) - halGetDuty(_reversePin);
+}
+
+/**
+ * Advance the wheel; toggles the encoder
+ * pin once for each edge passed
+ */
+WheelPlant& WheelPlant::step(float seconds) // IN : time step
+                                            // RET: this wheel
+{
+    //
+    // steady state speed is linear in duty from minSpeed
+    // just above the deadband to maxSpeed at full duty;
+    // below the deadband the motor cannot overcome friction.
+    //
+    const float drive = duty();
+    const float magnitude = fabsf(drive);
+    float target = 0;
+    if((magnitude > _config.deadband) && (_config.deadband < 1)) {
+        target = _config.minSpeed + (_config.maxSpeed - _config.minSpeed) * (magnitude - _config.deadband) / (1 - _config.deadband);
+        if(drive < 0) target = -target;
+    }
+
+    // motor speed follows with first order lag
+    if(_config.timeConstantMs > 0) {
+        _speed += (target - _speed) * (1 - expf(-seconds * 1000 / _config.timeConstantMs));
+    } else {
+        _speed = target;
+    }
+
+    _groundDistance += groundSpeed() * seconds;
+
+    //
+    // an optical encoder sees slots go by
+    // whichever way the wheel turns
+    //
+    _travel += fabsf(_speed) * seconds;
+    const long edges = (long)(_travel / _edgeDistance);
+    while(_edges < edges) {
+        _edges += 1;
+        halSetPin(_encoderPin, (GPIO_HIGH == halGetPin(_encoderPin)) ? GPIO_LOW : GPIO_HIGH);
+    }
+
+    return *this;
+}
+
+/**
+ * Advance both wheels and the pose
+ */
+DifferentialDrivePlant& DifferentialDrivePlant::step(float seconds) // IN : time step
+                                                                    // RET: this plant
+{
+    _left.step(seconds);
+    _right.step(seconds);
+
+    // unicycle model from wheel ground speeds
+    const double linear = (_left.groundSpeed() + _right.groundSpeed()) / 2;
+    const double angular = (_right.groundSpeed() - _left.groundSpeed()) / _wheelbase;
+    _x += linear * cos(_angle) * seconds;
+    _y += linear * sin(_angle) * seconds;
+    _angle += angular * seconds;
+
+    // keep angle in -pi to pi like the rover's pose
+    if(_angle > M_PI) _angle -= 2 * M_PI;
+    if(_angle < -M_PI) _angle += 2 * M_PI;
+
+    return *this;
+}
@@ -0,0 +1,125 @@
+#ifndef SIM_PLANT_H
+#define SIM_PLANT_H
+
+#include <stdint.h>
+
+//
+// Physics of the rover's drive train, stepped by the
+// simulator.  The plant reads the pwm duty cycles the
+// firmware writes to the motor pins and toggles the
+// encoder pins as the wheels turn, so the firmware sees
+// the same signals it does on the real rover.
+//
+
+/**
+ * Motor and wheel characteristics
+ */
+typedef struct WheelPlantConfig {
+    float minSpeed;         // wheel surface speed just above the deadband (cm/sec)
+    float maxSpeed;         // wheel surface speed at full duty (cm/sec)
+    float deadband;         // duty below which the motor stalls (0 to 1.0)
+    float timeConstantMs;   // first order lag of motor speed (milliseconds)
+    float slip;             // fraction of wheel travel lost to slip (0 to 1.0)
+} WheelPlantConfig;
+
+/**
+ * One motor, wheel and optical encoder.
+ * The L9110S drives forward with duty on one pin
+ * and reverse with duty on the other.
+ */
+class WheelPlant {
+    private:
+    WheelPlantConfig _config;
+    uint8_t _forwardPin;
+    uint8_t _reversePin;
+    uint8_t _encoderPin;
+    float _edgeDistance;    // wheel travel between encoder edges (cm)
+
+    float _speed = 0;       // wheel surface speed (cm/sec)
+    double _travel = 0;     // total wheel travel, either direction (cm)
+    long _edges = 0;        // encoder edges so far
+    double _groundDistance = 0; // signed distance over the ground (cm)
+
+    public:
+
+    WheelPlant(
+        const WheelPlantConfig &config, // IN : motor and wheel characteristics
+        uint8_t forwardPin,             // IN : pin with forward duty
+        uint8_t reversePin,             // IN : pin with reverse duty
+        uint8_t encoderPin,             // IN : encoder input pin to toggle
+        float circumference,            // IN : wheel circumference (cm)
+        int pulsesPerRevolution)        // IN : encoder edges per revolution
+        : _config(config), 
+          _forwardPin(forwardPin), _reversePin(reversePin), _encoderPin(encoderPin),
+          _edgeDistance(circumference / pulsesPerRevolution)
+    {
+    }
+
+    const WheelPlantConfig& config() const { return _config; }
+    WheelPlant& setConfig(const WheelPlantConfig &config) { _config = config; return *this; }
+
+    /**
+     * Signed duty the firmware is driving
+     */
+    float duty() const; // RET: -1.0 to 1.0; positive is forward
+
+    /**
+     * Wheel surface speed; what the encoder sees
+     */
+    float speed() const { return _speed; }
+
+    /**
+     * Speed over the ground, after slip
+     */
+    float groundSpeed() const { return _speed * (1 - _config.slip); }
+
+    long edges() const { return _edges; }
+    double groundDistance() const { return _groundDistance; }
+
+    /**
+     * Advance the wheel; toggles the encoder
+     * pin once for each edge passed
+     */
+    WheelPlant& step(float seconds);   // IN : time step
+                                       // RET: this wheel
+};
+
+/**
+ * Differential drive rover; integrates the
+ * true pose from the ground speed of each wheel.
+ */
+class DifferentialDrivePlant {
+    private:
+    WheelPlant &_left;
+    WheelPlant &_right;
+    float _wheelbase;
+
+    double _x = 0;
+    double _y = 0;
+    double _angle = 0;  // radians counter-clockwise from x-axis
+
+    public:
+
+    DifferentialDrivePlant(
+        WheelPlant &left,   // IN : left wheel
+        WheelPlant &right,  // IN : right wheel
+        float wheelbase)    // IN : distance between wheels (cm)
+        : _left(left), _right(right), _wheelbase(wheelbase)
+    {
+    }
+
+    WheelPlant& left() { return _left; }
+    WheelPlant& right() { return _right; }
+
+    double x() const { return _x; }
+    double y() const { return _y; }
+    double angle() const { return _angle; }
+
+    /**
+     * Advance both wheels and the pose
+     */
+    DifferentialDrivePlant& step(float seconds); // IN : time step
+                                                 // RET: this plant
+};
+
+#endif // SIM_PLANT_H
@@ -0,0 +1,37 @@
+#!/bin/bash
+#
+# Drive the simulated rover through a set of goals on
+# plants with different lag, slip and motor mismatch;
+# exits non-zero if any goal is missed.  Run from the
+# sim directory after ./build.sh.  Takes a second or so.
+#
+failed=0
+
+scenario() {
+    echo "# $*${SIM:+ ($SIM)}"
+    output=$(${SIM:-./rover_sim} "$@")
+    status=$?
+    echo "$output" | tail -1
+    if [ $status -ne 0 ]; then
+        echo "FAILED: $*"
+        failed=1
+    fi
+}
+
+# goals in each quadrant on the default plant
+scenario -g 100,50
+scenario -g -60,80
+scenario -g -100,-20
+scenario -g 0,-100
+scenario -g 30,5
+
+# slower control loop, sluggish motors, more slip and mismatch
+scenario -g 100,50 -r 200
+scenario -g -60,80 -l 200
+scenario -g 100,-50 -s 0.05 -m 0.15
+scenario -g 150,150 -t 30 -d 0.2 -m 0.1
+
+# commands, telemetry and video on the multiplexed socket
+SIM=./rover_sim_mux scenario -g 100,50
+
+exit $failed
@@ -0,0 +1,565 @@
+//
+// Host simulator for the rover firmware.
+//
+// The real firmware modules (wheels, rover, behaviors,
+// command processor, message bus and telemetry) run
+// on the Linux backend of the hardware abstraction,
+// driving a physics model of the drive train.
+// Simulated time only moves when the plant is stepped,
+// so a run is deterministic and as fast as the host.
+//
+// With --serve the simulator paces itself to real time
+// and serves the web client, the camera stream and the
+// command socket, so a browser can drive the simulated
+// rover or a load test can drive many clients at once.
+//
+// Built with USE_MULTIPLEX_SOCKET (rover_sim_mux), the
+// firmware serves the one multiplexed socket instead and
+// the simulator sends on its command channel.
+//
+// see sim/README.md for usage
+//
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <getopt.h>
+#include <math.h>
+#include <signal.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "hal/linux_hal.h"
+#include "mock/WebSocketsServer.h"
+#include "plant.h"
+#include "camera_replay.h"
+#include "http_server.h"
+
+#include "config.h"
+#include "gpio/pwm.h"
+#include "motor/motor_l9110s.h"
+#include "encoder/encoder.h"
+#include "wheel/drive_wheel.h"
+#include "telemetry.h"
+#include "rover/rover.h"
+#include "rover/goto_goal.h"
+#include "rover/rover_command.h"
+#include "rover/path_follow.h"
+#include "planner/occupancy_grid.h"
+#include "planner/path_planner.h"
+#include "behavior/arbiter.h"
+#include "behavior/geofence_behavior.h"
+#include "settings/settings.h"
+#include "settings/settings_storage.h"
+#include "websockets/command_socket.h"
+#include "websockets/stream_socket.h"
+#ifdef USE_MULTIPLEX_SOCKET
+    #include "websockets/mux.h"
+#endif
+#include "log/binary_log.h"
+
+//
+// The rover, put together as in main.cpp;
+// firmware modules refer to these by name.
+//
+MessageBus messageBus;
+TelemetrySender telemetry;
+Settings settings;
+
+PwmChannel leftForwardPwm(A1_A_PIN, LEFT_FORWARD_CHANNEL, MotorL9110s::pwmBits());
+PwmChannel leftReversePwm(A1_B_PIN, LEFT_REVERSE_CHANNEL, MotorL9110s::pwmBits());
+MotorL9110s leftMotor;
+Encoder leftWheelEncoder(LEFT_ENCODER_PIN, 0);
+DriveWheel leftWheel(LEFT_WHEEL_SPEC, WHEEL_CIRCUMFERENCE);
+
+PwmChannel rightForwardPwm(B1_B_PIN, RIGHT_FORWARD_CHANNEL, MotorL9110s::pwmBits());
+PwmChannel rightReversePwm(B1_A_PIN, RIGHT_REVERSE_CHANNEL, MotorL9110s::pwmBits());
+MotorL9110s rightMotor;
+Encoder rightWheelEncoder(RIGHT_ENCODER_PIN, 1);
+DriveWheel rightWheel(RIGHT_WHEEL_SPEC, WHEEL_CIRCUMFERENCE);
+
+TwoWheelRover rover(WHEELBASE);
+RoverCommandProcessor roverCommandProcessor;
+
+GotoGoalBehavior gotoGoalBehavior;
+PathFollowBehavior pathFollowBehavior;
+GeofenceBehavior geofenceBehavior;
+BehaviorArbiter behaviorArbiter;
+
+grid_word_type mapBits[(MAP_MAX_CELLS + GRID_WORD_BITS - 1) / GRID_WORD_BITS];
+OccupancyGrid occupancyGrid(mapBits, sizeof(mapBits) / sizeof(mapBits[0]));
+plan_cost_type planCost[MAP_MAX_CELLS];
+uint8_t planFrom[MAP_MAX_CELLS];
+PlannerHeapEntry planHeap[PLAN_HEAP_ENTRIES];
+PathPlanner pathPlanner(planCost, planFrom, MAP_MAX_CELLS, planHeap, PLAN_HEAP_ENTRIES);
+
+//
+// the drive train; right motor a little weaker
+// than the left so speed control has work to do
+//
+const WheelPlantConfig DEFAULT_WHEEL = {
+    12,     // minSpeed cm/sec just above the deadband
+    60,     // maxSpeed cm/sec at full duty
+    0.28,   // deadband; calibrated stall is just above it
+    80,     // timeConstantMs
+    0.02,   // slip
+};
+WheelPlant leftPlant(DEFAULT_WHEEL, A1_A_PIN, A1_B_PIN, LEFT_ENCODER_PIN, WHEEL_CIRCUMFERENCE, PULSES_PER_REVOLUTION);
+WheelPlant rightPlant(DEFAULT_WHEEL, B1_B_PIN, B1_A_PIN, RIGHT_ENCODER_PIN, WHEEL_CIRCUMFERENCE, PULSES_PER_REVOLUTION);
+DifferentialDrivePlant plant(leftPlant, rightPlant, WHEELBASE);
+
+//
+// calibration matching the default plant,
+// as the web client would send it
+//
+const char *CALIBRATION_COMMANDS[] = {
+    "cmd(1, stall(0.3, 0.3))",
+    "cmd(2, pid(3, 12, 60, 0.4, 0.05, 0.001))",
+};
+
+const uint16_t HTTP_PORT = 80;      // see main.cpp
+const uint16_t STREAM_PORT = 81;    // see stream_socket.cpp
+const uint16_t COMMAND_PORT = 82;   // see command_socket.cpp
+const uint8_t CLIENT_ID = 0;
+
+typedef struct SimCommand {
+    unsigned long ms;   // simulated time to send
+    std::string text;
+} SimCommand;
+
+typedef struct SimOptions {
+    unsigned int rateHz = 1000;     // loop and plant steps per simulated second
+    float seconds = 20;             // simulated time to run
+    bool hasGoal = false;
+    float goalX = 0;
+    float goalY = 0;
+    float goalTolerance = 5;        // cm
+    float pointForward = 0.75;      // fraction of wheelbase
+    bool calibrate = true;          // send CALIBRATION_COMMANDS at start
+    bool verbose = false;           // print everything the firmware sends
+    bool serve = false;             // run in real time, serving the web client
+    unsigned int portOffset = 8000; // added to the rover's ports 80, 81 and 82
+    unsigned int maxClients = 5;    // websocket clients per socket
+    const char *cameraPath = "frames";
+    unsigned int fps = 20;
+    const char *clientDir = "../client";
+    const char *tracePath = nullptr;
+    const char *settingsPath = nullptr;
+    std::vector<SimCommand> commands;
+} SimOptions;
+
+/**
+ * Note when go to goal reaches its goal;
+ * it is only ACHIEVED for an instant
+ */
+class GoalWatcher : public Subscriber {
+    public:
+    unsigned long achievedMs = 0;
+
+    virtual void onMessage(Publisher &publisher, Message message, Specifier specifier, const char *data) {
+        if((GOTO_GOAL == message) && (0 == achievedMs) && (0 == strcmp(data, GotoGoalStateStr[ACHIEVED]))) {
+            achievedMs = halMillis();
+        }
+    }
+};
+GoalWatcher goalWatcher;
+
+static unsigned long messagesSent = 0;   // by firmware to client
+static unsigned long commandNacks = 0;
+static volatile sig_atomic_t interrupted = 0;
+
+static void usage(const char *program) {
+    fprintf(stderr,
+        "usage: %s [options] [ms:command ...]\n"
+        "  -r, --rate HZ           loop and plant steps per simulated second (default 1000)\n"
+        "  -t, --time SECONDS      simulated time to run (default 20)\n"
+        "  -g, --goal X,Y          go to goal; fail unless achieved within tolerance\n"
+        "  -e, --tolerance CM      goal tolerance (default 5)\n"
+        "  -s, --slip FRACTION     wheel slip (default 0.02)\n"
+        "  -l, --lag MS            motor time constant (default 80)\n"
+        "  -d, --deadband FRACTION duty below which motors stall (default 0.28)\n"
+        "  -m, --mismatch FRACTION right motor slower than left by fraction (default 0.05)\n"
+        "  -n, --no-calibrate      do not send stall and pid calibration at start\n"
+        "  -o, --trace FILE        write csv of true and estimated pose each control period\n"
+        "  -p, --settings DIR      keep settings in files in DIR, like flash on the rover\n"
+        "  -v, --verbose           print every message the rover sends\n"
+        "  -S, --serve             run in real time and serve the web client; until\n"
+        "                          interrupted unless --time is given\n"
+        "  -P, --port-offset N     serve on ports 80, 81 and 82 plus N (default 8000)\n"
+        "  -c, --clients N         websocket clients allowed per socket (default 5)\n"
+        "  -C, --camera PATH       jpeg file or directory of frames to stream (default frames)\n"
+        "  -f, --fps N             camera frames per second (default 20)\n"
+        "  -w, --client-dir DIR    web client to serve (default ../client)\n"
+        "commands are sent on the command socket at simulated time ms, like\n"
+        "  %s -g 100,50 500:'cmd(3, goto(100, 50, 5, 0.75))'\n",
+        program, program);
+}
+
+static bool parseOptions(int argc, char *argv[], SimOptions &options) {
+    static const struct option longOptions[] = {
+        {"rate", required_argument, nullptr, 'r'},
+        {"time", required_argument, nullptr, 't'},
+        {"goal", required_argument, nullptr, 'g'},
+        {"tolerance", required_argument, nullptr, 'e'},
+        {"slip", required_argument, nullptr, 's'},
+        {"lag", required_argument, nullptr, 'l'},
+        {"deadband", required_argument, nullptr, 'd'},
+        {"mismatch", required_argument, nullptr, 'm'},
+        {"no-calibrate", no_argument, nullptr, 'n'},
+        {"trace", required_argument, nullptr, 'o'},
+        {"settings", required_argument, nullptr, 'p'},
+        {"verbose", no_argument, nullptr, 'v'},
+        {"serve", no_argument, nullptr, 'S'},
+        {"port-offset", required_argument, nullptr, 'P'},
+        {"clients", required_argument, nullptr, 'c'},
+        {"camera", required_argument, nullptr, 'C'},
+        {"fps", required_argument, nullptr, 'f'},
+        {"client-dir", required_argument, nullptr, 'w'},
+        {"help", no_argument, nullptr, 'h'},
+        {nullptr, 0, nullptr, 0},
+    };
+
+    WheelPlantConfig left = DEFAULT_WHEEL;
+    float mismatch = 0.05;
+    bool hasTime = false;
+    int c;
+    while(-1 != (c = getopt_long(argc, argv, "r:t:g:e:s:l:d:m:no:p:vSP:c:C:f:w:h", longOptions, nullptr))) {
+        switch(c) {
+            case 'r': options.rateHz = (unsigned int)atoi(optarg); break;
+            case 't': options.seconds = atof(optarg); hasTime = true; break;
+            case 'g': {
+                if(2 != sscanf(optarg, "%f,%f", &options.goalX, &options.goalY)) return false;
+                options.hasGoal = true;
+                break;
+            }
+            case 'e': options.goalTolerance = atof(optarg); break;
+            case 's': left.slip = atof(optarg); break;
+            case 'l': left.timeConstantMs = atof(optarg); break;
+            case 'd': left.deadband = atof(optarg); break;
+            case 'm': mismatch = atof(optarg); break;
+            case 'n': options.calibrate = false; break;
+            case 'o': options.tracePath = optarg; break;
+            case 'p': options.settingsPath = optarg; break;
+            case 'v': options.verbose = true; break;
+            case 'S': options.serve = true; break;
+            case 'P': options.portOffset = (unsigned int)atoi(optarg); break;
+            case 'c': options.maxClients = (unsigned int)atoi(optarg); break;
+            case 'C': options.cameraPath = optarg; break;
+            case 'f': options.fps = (unsigned int)atoi(optarg); break;
+            case 'w': options.clientDir = optarg; break;
+            default: return false;
+        }
+    }
+    if(options.serve && !hasTime) {
+        options.seconds = INFINITY;
+    }
+    if((options.maxClients < 1) || (options.portOffset + COMMAND_PORT > 65535)) {
+        return false;
+    }
+    if((options.rateHz < 100) || (options.seconds <= 0)) {
+        return false;
+    }
+
+    WheelPlantConfig right = left;
+    right.minSpeed *= (1 - mismatch);
+    right.maxSpeed *= (1 - mismatch);
+    leftPlant.setConfig(left);
+    rightPlant.setConfig(right);
+
+    for(int i = optind; i < argc; i += 1) {
+        const char *colon = strchr(argv[i], ':');
+        if(nullptr == colon) return false;
+        options.commands.push_back({strtoul(argv[i], nullptr, 10), std::string(colon + 1)});
+    }
+
+    return true;
+}
+
+/**
+ * Put the rover together, as setup() does
+ * after wifi and camera start
+ */
+static void setupRover(SettingsStorage *storage) {
+    telemetry.attach(&messageBus);
+    rover.attach(
+        leftWheel.attach(
+            leftMotor.attach(leftForwardPwm, leftReversePwm),
+            &leftWheelEncoder,
+            PULSES_PER_REVOLUTION,
+            &messageBus),
+        rightWheel.attach(
+            rightMotor.attach(rightForwardPwm, rightReversePwm),
+            &rightWheelEncoder,
+            PULSES_PER_REVOLUTION,
+            &messageBus),
+        &messageBus);
+    gotoGoalBehavior.attach(rover, messageBus).startListening();
+    pathFollowBehavior.attach(rover, gotoGoalBehavior, occupancyGrid, pathPlanner, messageBus);
+    geofenceBehavior.attach(rover, messageBus);
+    roverCommandProcessor.attach(rover, gotoGoalBehavior, pathFollowBehavior, geofenceBehavior, settings, messageBus);
+    behaviorArbiter.attach(rover);
+
+    PwmChannel::setWriteHook([](gpio_type pin, pwm_type pwm) {
+        roverCommandProcessor.latency().pwmWritten(halMicros());
+    });
+    behaviorArbiter.addBehavior(geofenceBehavior);
+    behaviorArbiter.addBehavior(roverCommandProcessor.teleopBehavior());
+    behaviorArbiter.addBehavior(gotoGoalBehavior);
+
+    if(nullptr != storage) {
+        settings.attach(*storage).load();
+        const unsigned int loaded = settings.loaded();
+        const RoverSettings &values = settings.values();
+        if(loaded & settingsBit(SETTINGS_LEFT_PID)) {
+            const PidSettings &pid = values.leftPid;
+            rover.setSpeedControl(LEFT_WHEEL, pid.minSpeed, pid.maxSpeed, pid.Kp, pid.Ki, pid.Kd);
+        }
+        if(loaded & settingsBit(SETTINGS_RIGHT_PID)) {
+            const PidSettings &pid = values.rightPid;
+            rover.setSpeedControl(RIGHT_WHEEL, pid.minSpeed, pid.maxSpeed, pid.Kp, pid.Ki, pid.Kd);
+        }
+        if(loaded & settingsBit(SETTINGS_STALL)) {
+            rover.setMotorStall(values.stall.left, values.stall.right);
+        }
+        if(loaded & settingsBit(SETTINGS_COMMAND)) {
+            roverCommandProcessor.deadman().setTimeout(values.command.deadmanTimeoutMs);
+        }
+    }
+
+    wsCommandInit();
+    wsStreamInit();
+}
+
+/**
+ * Send a command as the simulated web client;
+ * on the multiplexed socket it is a binary
+ * frame on the command channel
+ */
+static void sendCommand(WebSocketsServer *server, const std::string &text) {
+    #ifdef USE_MULTIPLEX_SOCKET
+        const std::string frame = std::string(1, (char)MUX_COMMAND) + text;
+        server->simReceive(CLIENT_ID, WStype_BIN, (const uint8_t *)frame.data(), frame.length());
+    #else
+        server->simReceive(CLIENT_ID, WStype_TEXT, (const uint8_t *)text.c_str(), text.length());
+    #endif
+}
+
+/**
+ * Print a record drained from the firmware's log ring
+ */
+static void printLogRecord(const LogRecord &record) {
+    char text[LOG_TEXT_BYTES];
+    logFormat(record, text, sizeof(text));
+    printf("log: %s\n", text);
+}
+
+/**
+ * One pass of the rover's main loop
+ */
+static void loopRover() {
+    rover.poll(halMillis());
+    roverCommandProcessor.pollRoverCommand(halMillis());
+    pathFollowBehavior.poll(halMillis());
+    behaviorArbiter.poll(halMillis());
+    settings.poll(halMillis());
+    telemetry.poll();
+    logDrain(printLogRecord, LOG_DRAIN_PER_POLL);
+    wsStreamCameraImage();
+    wsStreamPoll();
+    wsCommandPoll();
+    httpServerPoll();
+}
+
+/**
+ * Start serving the web client and sockets on the offset ports
+ */
+static bool serve(const SimOptions &options) {
+    if(!WebSocketsServer::simListen(options.portOffset, options.maxClients)) {
+        perror("websocket listen");
+        return false;
+    }
+    if(!httpServerInit(HTTP_PORT + options.portOffset, options.clientDir)) {
+        perror("http listen");
+        return false;
+    }
+    printf("serving %s on http://localhost:%u/ with %u frames at %u fps; ctrl-c to stop\n",
+        options.clientDir, HTTP_PORT + options.portOffset, simCameraFrameCount(), options.fps);
+    fflush(stdout);
+    return true;
+}
+
+static void printSocketStats(const char *name, uint16_t port) {
+    const WebSocketsServer *server = WebSocketsServer::simServer(port);
+    if(nullptr != server) {
+        const SimSocketStats &stats = server->simStats();
+        printf("%-14s accepted %lu, refused %lu, received %lu, sent %lu (%.1f KB), dropped %lu\n",
+            name, stats.accepted, stats.refused, stats.received, stats.sent, stats.bytesSent / 1024.0, stats.dropped);
+    }
+}
+
+int main(int argc, char *argv[]) {
+    SimOptions options;
+    if(!parseOptions(argc, argv, options)) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    // the rover streams when a client asks; a missing camera only matters then
+    if(!simCameraLoad(options.cameraPath) && options.serve) {
+        fprintf(stderr, "no jpeg frames in %s\n", options.cameraPath);
+        return 2;
+    }
+    simCameraFrameRate(options.fps);
+
+    FileSettingsStorage *storage = (nullptr != options.settingsPath) ? new FileSettingsStorage(options.settingsPath) : nullptr;
+    setupRover(storage);
+    if(options.serve && !serve(options)) {
+        return 2;
+    }
+    signal(SIGINT, [](int) { interrupted = 1; });
+    signal(SIGTERM, [](int) { interrupted = 1; });
+
+    // the simulator is the web client
+    WebSocketsServer *commandServer = WebSocketsServer::simServer(COMMAND_PORT);
+    if(nullptr == commandServer) {
+        fprintf(stderr, "command socket did not start\n");
+        return 2;
+    }
+    const bool verbose = options.verbose;
+    commandServer->simOnSend([verbose](uint16_t port, uint8_t num, WStype_t type, const uint8_t *payload, size_t length) {
+        // socket clients keep their own counts
+        if(CLIENT_ID != num) return;
+
+        messagesSent += 1;
+        #ifdef USE_MULTIPLEX_SOCKET
+            // command replies and telemetry are text behind their channel
+            const MuxDecodeResult decoded = muxDecode(payload, length);
+            if(!decoded.matched || ((MUX_COMMAND != decoded.channel) && (MUX_TELEMETRY != decoded.channel))) return;
+            type = WStype_TEXT;
+            payload = decoded.payload;
+            length = decoded.length;
+        #endif
+        if((WStype_TEXT == type) && (length >= 5) && (0 == strncmp((const char *)payload, "nack(", 5))) {
+            commandNacks += 1;
+            fprintf(stderr, "%.*s\n", (int)length, (const char *)payload);
+        } else if(verbose && (WStype_TEXT == type)) {
+            printf("%lu: %.*s\n", halMillis(), (int)length, (const char *)payload);
+        }
+    });
+    commandServer->simConnect(CLIENT_ID);
+
+    std::vector<SimCommand> commands;
+    if(options.calibrate) {
+        for(unsigned int i = 0; i < sizeof(CALIBRATION_COMMANDS) / sizeof(CALIBRATION_COMMANDS[0]); i += 1) {
+            commands.push_back({0, CALIBRATION_COMMANDS[i]});
+        }
+    }
+    commands.insert(commands.end(), options.commands.begin(), options.commands.end());
+    if(options.hasGoal) {
+        char text[128];
+        snprintf(text, sizeof(text), "cmd(%u, goto(%g, %g, %g, %g))", (unsigned int)commands.size() + 1,
+            options.goalX, options.goalY, options.goalTolerance, options.pointForward);
+        commands.push_back({CONTROL_POLL_MS, text});
+    }
+
+    // send in time order; commands due at the same time keep their order
+    std::stable_sort(commands.begin(), commands.end(), [](const SimCommand &a, const SimCommand &b) { return a.ms < b.ms; });
+
+    FILE *trace = nullptr;
+    if(nullptr != options.tracePath) {
+        if(nullptr == (trace = fopen(options.tracePath, "w"))) {
+            perror(options.tracePath);
+            return 2;
+        }
+        fprintf(trace, "ms,x,y,angle,estimatedX,estimatedY,estimatedAngle,leftDuty,rightDuty,leftSpeed,rightSpeed,leftEstimate,rightEstimate\n");
+    }
+
+    const unsigned long long stepUs = 1000000ULL / options.rateHz;
+    const unsigned long long endUs = isinf(options.seconds) ? ~0ULL : (unsigned long long)(options.seconds * 1000000);
+    const float stepSeconds = stepUs / 1000000.0f;
+    size_t nextCommand = 0;
+    unsigned long lastTraceMs = 0;
+    goalWatcher.subscribe(messageBus, GOTO_GOAL);
+    const std::chrono::steady_clock::time_point wallStart = std::chrono::steady_clock::now();
+
+    unsigned long long us;
+    for(us = 0; (us <= endUs) && !interrupted; us += stepUs) {
+        if(options.serve) {
+            // keep simulated time with wall time; sleep when ahead
+            const long long aheadUs = (long long)us - std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - wallStart).count();
+            if(aheadUs > 0) {
+                usleep((useconds_t)aheadUs);
+            }
+        }
+        halSetMicros(us);
+        plant.step(stepSeconds);
+
+        while((nextCommand < commands.size()) && (commands[nextCommand].ms <= halMillis())) {
+            sendCommand(commandServer, commands[nextCommand].text);
+            nextCommand += 1;
+        }
+
+        loopRover();
+
+        if((nullptr != trace) && (halMillis() - lastTraceMs >= CONTROL_POLL_MS)) {
+            lastTraceMs = halMillis();
+            const Pose2D pose = rover.pose();
+            fprintf(trace, "%lu,%.3f,%.3f,%.4f,%.3f,%.3f,%.4f,%.3f,%.3f,%.2f,%.2f,%.2f,%.2f\n",
+                halMillis(), plant.x(), plant.y(), plant.angle(), pose.x, pose.y, pose.angle,
+                leftPlant.duty(), rightPlant.duty(), leftPlant.speed(), rightPlant.speed(),
+                leftWheel.speed(), rightWheel.speed());
+        }
+    }
+
+    const double wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+    if(nullptr != trace) {
+        fclose(trace);
+    }
+
+    const Pose2D pose = rover.pose();
+    const double simulatedSeconds = (us > 0) ? (us - stepUs) / 1000000.0 : 0;
+    printf("simulated %.1f s at %u Hz in %.3f s; %.0fx real time\n",
+        simulatedSeconds, options.rateHz, wallSeconds, (wallSeconds > 0) ? simulatedSeconds / wallSeconds : 0);
+    printf("true pose      (%.1f, %.1f) %.3f rad\n", plant.x(), plant.y(), plant.angle());
+    printf("estimated pose (%.1f, %.1f) %.3f rad\n", pose.x, pose.y, pose.angle);
+    printf("encoder edges  left %ld, right %ld\n", leftPlant.edges(), rightPlant.edges());
+    printf("messages sent  %lu, nacks %lu, telemetry dropped %lu\n", messagesSent, commandNacks, telemetry.dropped());
+    if(options.serve) {
+        #ifdef USE_MULTIPLEX_SOCKET
+            printSocketStats("mux socket", MUX_SOCKET_PORT);
+        #else
+            printSocketStats("command socket", COMMAND_PORT);
+            printSocketStats("stream socket", STREAM_PORT);
+        #endif
+        printf("stream frames  captured %u, sent %u, dropped %u\n", streamFrames.captured, streamFrames.sent, streamFrames.dropped);
+        printf("http requests  %lu\n", httpServerRequests());
+    }
+
+    int status = (0 == commandNacks) ? 0 : 1;
+    if(options.hasGoal) {
+        const double dx = plant.x() - options.goalX;
+        const double dy = plant.y() - options.goalY;
+        const double miss = sqrt(dx * dx + dy * dy);
+        printf("goal           (%.1f, %.1f) ", options.goalX, options.goalY);
+        if(goalWatcher.achievedMs > 0) {
+            printf("achieved at %lu ms", goalWatcher.achievedMs);
+        } else {
+            printf("%s", GotoGoalStateStr[gotoGoalBehavior.state()]);
+        }
+        printf(", true position misses by %.1f cm\n", miss);
+
+        //
+        // the rover can only know where it is from its encoders;
+        // allow for slip on top of the goal tolerance
+        //
+        if((0 == goalWatcher.achievedMs) || (miss > options.goalTolerance * 2)) {
+            status = 1;
+        }
+    }
+
+    delete storage;
+    return status;
+}
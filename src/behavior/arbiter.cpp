@@ -0,0 +1,134 @@
+#include "arbiter.h"
+#include "../error.h"
+
+/**
+ * Determine if dependencies are attached
+ */
+bool BehaviorArbiter::attached() // RET: true if attached, false if not
+{
+    return nullptr != _sink;
+}
+
+/**
+ * Attach dependencies
+ */
+BehaviorArbiter& BehaviorArbiter::attach(
+    WheelCommandSink &sink)     // IN : executes the winning command
+                                // RET: this arbiter in attached state
+{
+    if(!attached()) {
+        _sink = &sink;
+        _active = nullptr;
+    }
+    return *this;
+}
+
+/**
+ * Detach dependencies
+ */
+BehaviorArbiter& BehaviorArbiter::detach() // RET: this arbiter in detached state
+{
+    if(attached()) {
+        _sink = nullptr;
+        _active = nullptr;
+    }
+    return *this;
+}
+
+/**
+ * Add a behavior to arbitrate
+ */
+int BehaviorArbiter::addBehavior(
+    Behavior &behavior)     // IN : behavior to add
+                            // RET: SUCCESS or FAILURE if there is no room
+{
+    if(_behaviorCount >= MAX_BEHAVIORS) {
+        return FAILURE;
+    }
+
+    // keep behaviors sorted from highest to lowest priority
+    unsigned int i = _behaviorCount++;
+    while((i > 0) && (_behaviors[i - 1]->priority() < behavior.priority())) {
+        _behaviors[i] = _behaviors[i - 1];
+        i -= 1;
+    }
+    _behaviors[i] = &behavior;
+    return SUCCESS;
+}
+
+/**
+ * Remove a behavior
+ */
+int BehaviorArbiter::removeBehavior(
+    Behavior &behavior)     // IN : behavior to remove
+                            // RET: SUCCESS or FAILURE if not found
+{
+    for(unsigned int i = 0; i < _behaviorCount; i += 1) {
+        if(&behavior == _behaviors[i]) {
+            // shift down to keep priority order
+            _behaviorCount -= 1;
+            for(unsigned int j = i; j < _behaviorCount; j += 1) {
+                _behaviors[j] = _behaviors[j + 1];
+            }
+            if(&behavior == _active) {
+                _active = nullptr;
+            }
+            return SUCCESS;
+        }
+    }
+    return FAILURE;
+}
+
+/**
+ * Choose the winning behavior and drive the wheels
+ */
+BehaviorArbiter& BehaviorArbiter::poll(
+    unsigned long currentMillis)    // IN : current time in milliseconds
+                                    // RET: this arbiter
+{
+    if(!attached()) return *this;
+
+    //
+    // behaviors are in priority order, so the
+    // first active behavior is the winner.
+    //
+    Behavior *winner = nullptr;
+    WheelCommand winningCommand;
+    unsigned int i = 0;
+    for(; (i < _behaviorCount) && (nullptr == winner); i += 1) {
+        if(_behaviors[i]->proposeCommand(currentMillis, winningCommand)) {
+            winner = _behaviors[i];
+        }
+    }
+
+    //
+    // the winner may give way to the command it is
+    // overriding, like a driver steering away from a fence
+    //
+    if(nullptr != winner) {
+        WheelCommand proposed;
+        for(; i < _behaviorCount; i += 1) {
+            if(_behaviors[i]->proposeCommand(currentMillis, proposed)) {
+                if(winner->yieldTo(currentMillis, proposed)) {
+                    winner = _behaviors[i];
+                    winningCommand = proposed;
+                }
+                break;
+            }
+        }
+    }
+
+    if(nullptr != winner) {
+        if((winner != _active) || (winningCommand != _lastCommand)) {
+            _sink->driveWheels(winningCommand);
+            _lastCommand = winningCommand;
+        }
+    } else if(nullptr != _active) {
+        // last active behavior has finished
+        _sink->stopWheels();
+        _lastCommand = WheelCommand();
+    }
+    _active = winner;
+
+    return *this;
+}
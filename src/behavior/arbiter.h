@@ -0,0 +1,76 @@
+#ifndef BEHAVIOR_ARBITER_H
+#define BEHAVIOR_ARBITER_H
+
+#include "behavior.h"
+
+/**
+ * Subsumption style arbiter; each control tick
+ * behaviors are asked for a command in priority
+ * order and the first active behavior wins, so a
+ * tick costs at most one call per behavior.  The
+ * winner is shown the next active behavior's
+ * command and may yield the wheels to it.
+ *
+ * The winning command is only sent to the wheels
+ * when it changes.  When the last active behavior
+ * goes inactive, the wheels are stopped.
+ */
+class BehaviorArbiter {
+    public:
+    static const unsigned int MAX_BEHAVIORS = 8;
+
+    private:
+    Behavior *_behaviors[MAX_BEHAVIORS];  // sorted highest priority first
+    unsigned int _behaviorCount = 0;
+    WheelCommandSink *_sink = nullptr;
+
+    Behavior *_active = nullptr;    // behavior that won last tick
+    WheelCommand _lastCommand;      // command sent to wheels last tick
+
+    public:
+
+    /**
+     * Determine if dependencies are attached
+     */
+    bool attached(); // RET: true if attached, false if not
+
+    /**
+     * Attach dependencies
+     */
+    BehaviorArbiter& attach(
+        WheelCommandSink &sink);    // IN : executes the winning command
+                                    // RET: this arbiter in attached state
+
+    /**
+     * Detach dependencies
+     */
+    BehaviorArbiter& detach(); // RET: this arbiter in detached state
+
+    /**
+     * Add a behavior to arbitrate
+     */
+    int addBehavior(
+        Behavior &behavior);    // IN : behavior to add
+                                // RET: SUCCESS or FAILURE if there is no room
+
+    /**
+     * Remove a behavior
+     */
+    int removeBehavior(
+        Behavior &behavior);    // IN : behavior to remove
+                                // RET: SUCCESS or FAILURE if not found
+
+    /**
+     * Get the behavior that is currently driving
+     */
+    Behavior *activeBehavior() { return _active; } // RET: active behavior or nullptr
+
+    /**
+     * Choose the winning behavior and drive the wheels
+     */
+    BehaviorArbiter& poll(
+        unsigned long currentMillis);   // IN : current time in milliseconds
+                                        // RET: this arbiter
+};
+
+#endif // BEHAVIOR_ARBITER_H
@@ -0,0 +1,95 @@
+#ifndef BEHAVIOR_BEHAVIOR_H
+#define BEHAVIOR_BEHAVIOR_H
+
+#include <stdint.h>
+#include "../config.h"
+
+typedef uint8_t behavior_priority_type;
+
+//
+// behavior priorities; when more than one behavior
+// is active, the one with the highest priority drives.
+//
+const behavior_priority_type GEOFENCE_PRIORITY = 40;   // keep rover inside the allowed area
+const behavior_priority_type OBSTACLE_PRIORITY = 30;   // stop for obstacles (reserved)
+const behavior_priority_type TELEOP_PRIORITY = 20;     // driver commands from the client
+const behavior_priority_type GOTO_PRIORITY = 10;       // goto goal and path following
+
+//
+// wheel command proposed by a behavior;
+// signed values, positive is forward.
+//
+typedef struct WheelCommand {
+    WheelCommand(): useSpeedControl(false), left(0), right(0) {};
+    WheelCommand(bool u, speed_type l, speed_type r): useSpeedControl(u), left(l), right(r) {};
+
+    bool useSpeedControl;   // true if left/right are speeds
+                            // false if left/right are pwm values
+    speed_type left;        // left wheel speed or pwm
+    speed_type right;       // right wheel speed or pwm
+
+    bool isStopped() const { return (0 == left) && (0 == right); }
+    bool operator==(const WheelCommand &other) const {
+        return (useSpeedControl == other.useSpeedControl) && (left == other.left) && (right == other.right);
+    }
+    bool operator!=(const WheelCommand &other) const { return !(*this == other); }
+} WheelCommand;
+
+/**
+ * Something that can execute the winning wheel command,
+ * like the rover.
+ */
+class WheelCommandSink {
+    public:
+    virtual ~WheelCommandSink() {}
+
+    /**
+     * Drive wheels with the given command
+     */
+    virtual void driveWheels(const WheelCommand &command) = 0;
+
+    /**
+     * Stop the wheels because no behavior is active
+     */
+    virtual void stopWheels() = 0;
+};
+
+/**
+ * A behavior proposes a wheel command each control
+ * tick; the BehaviorArbiter chooses which behavior's
+ * command is sent to the wheels.
+ */
+class Behavior {
+    private:
+    const behavior_priority_type _priority;
+
+    public:
+    Behavior(behavior_priority_type priority): _priority(priority) {}
+    virtual ~Behavior() {}
+
+    behavior_priority_type priority() const { return _priority; }
+
+    /**
+     * Propose a wheel command for this control tick
+     */
+    virtual bool proposeCommand(
+        unsigned long currentMillis,    // IN : current time in milliseconds
+        WheelCommand &command) = 0;     // OUT: if active, the proposed command
+                                        // RET: true if behavior is active and
+                                        //      wants to drive, false if not
+
+    /**
+     * While this behavior is winning, decide whether to
+     * hand the wheels to the command proposed by the
+     * highest priority active behavior below it.
+     */
+    virtual bool yieldTo(
+        unsigned long currentMillis,    // IN : current time in milliseconds
+        const WheelCommand &proposed)   // IN : command the lower behavior proposes
+                                        // RET: true to let the lower behavior drive
+    {
+        return false;
+    }
+};
+
+#endif // BEHAVIOR_BEHAVIOR_H
@@ -0,0 +1,175 @@
+#include "geofence.h"
+#include "../error.h"
+
+/**
+ * Set the boundary polygon
+ */
+int Geofence::setBoundary(
+    const Point2D *vertices,    // IN : polygon vertices in order; either winding
+    unsigned int count)         // IN : number of vertices; 0 to remove the boundary
+                                // RET: SUCCESS or FAILURE if polygon is not
+                                //      convex or has too many vertices
+                                //      (boundary is unchanged on failure)
+{
+    if(0 == count) {
+        _edgeCount = 0;
+        return SUCCESS;
+    }
+    if((nullptr == vertices) || (count < 3) || (count > GEOFENCE_MAX_VERTICES)) {
+        return FAILURE;
+    }
+
+    //
+    // the polygon is convex if every turn goes the same way;
+    // that direction also tells us which side is inside.
+    //
+    int winding = 0;
+    for(unsigned int i = 0; i < count; i += 1) {
+        const Point2D &a = vertices[i];
+        const Point2D &b = vertices[(i + 1) % count];
+        const Point2D &c = vertices[(i + 2) % count];
+        const distance_type cross = (b.x - a.x) * (c.y - b.y) - (b.y - a.y) * (c.x - b.x);
+        const int turn = (cross > 0) ? 1 : ((cross < 0) ? -1 : 0);
+        if(0 == turn) continue;     // collinear
+        if((0 != winding) && (turn != winding)) {
+            return FAILURE;         // not convex
+        }
+        winding = turn;
+    }
+    if(0 == winding) {
+        return FAILURE;             // degenerate
+    }
+
+    //
+    // inward normal is the edge direction rotated
+    // towards the inside; left for counter-clockwise.
+    //
+    GeofenceEdge edges[GEOFENCE_MAX_VERTICES];
+    for(unsigned int i = 0; i < count; i += 1) {
+        const Point2D &a = vertices[i];
+        const Point2D &b = vertices[(i + 1) % count];
+        const distance_type dx = b.x - a.x;
+        const distance_type dy = b.y - a.y;
+        const distance_type length = SQRT(dx * dx + dy * dy);
+        if(0 == length) {
+            return FAILURE;         // duplicate vertex
+        }
+        edges[i].normal.x = -dy * winding / length;
+        edges[i].normal.y = dx * winding / length;
+        edges[i].offset = edges[i].normal.x * a.x + edges[i].normal.y * a.y;
+    }
+
+    for(unsigned int i = 0; i < count; i += 1) {
+        _edges[i] = edges[i];
+    }
+    _edgeCount = count;
+    return SUCCESS;
+}
+
+/**
+ * Add a keep-out circle
+ */
+int Geofence::addKeepOut(
+    Point2D center,             // IN : center of circle
+    distance_type radius)       // IN : radius of circle
+                                // RET: SUCCESS or FAILURE if there is no room
+{
+    if((_keepOutCount >= GEOFENCE_MAX_KEEPOUTS) || (radius <= 0)) {
+        return FAILURE;
+    }
+    _keepOuts[_keepOutCount++] = {center, radius};
+    return SUCCESS;
+}
+
+/**
+ * Remove all fences
+ */
+Geofence& Geofence::clear() // RET: this fence
+{
+    _edgeCount = 0;
+    _keepOutCount = 0;
+    return *this;
+}
+
+/**
+ * Find the fence closest to a point
+ */
+distance_type Geofence::_nearest(
+    Point2D point,              // IN : point to check
+    Point2D &inward) const      // OUT: unit direction away from nearest fence
+                                // RET: signed distance to nearest fence;
+                                //      negative if point violates the fence
+{
+    distance_type nearest = 3.0e38f;
+    inward = {0, 0};
+
+    for(unsigned int i = 0; i < _edgeCount; i += 1) {
+        const GeofenceEdge &edge = _edges[i];
+        const distance_type distance = edge.normal.x * point.x + edge.normal.y * point.y - edge.offset;
+        if(distance < nearest) {
+            nearest = distance;
+            inward = edge.normal;
+        }
+    }
+
+    for(unsigned int i = 0; i < _keepOutCount; i += 1) {
+        const KeepOutCircle &circle = _keepOuts[i];
+        const distance_type dx = point.x - circle.center.x;
+        const distance_type dy = point.y - circle.center.y;
+        const distance_type fromCenter = SQRT(dx * dx + dy * dy);
+        const distance_type distance = fromCenter - circle.radius;
+        if(distance < nearest) {
+            nearest = distance;
+            if(fromCenter > 0) {
+                inward = {dx / fromCenter, dy / fromCenter};
+            } else {
+                inward = {1, 0};    // at the center; any direction is out
+            }
+        }
+    }
+
+    return nearest;
+}
+
+/**
+ * Check a pose and its velocity against the fence.
+ * The rover's position is projected forward by the
+ * distance it needs to stop at the given deceleration.
+ */
+GeofenceCheck Geofence::check(
+    const Pose2D &pose,             // IN : current position
+    const Pose2D &velocity,         // IN : current world velocity (x, y)
+    speed_type deceleration,        // IN : braking deceleration, distance/sec^2 (> 0)
+    distance_type margin) const     // IN : extra distance to keep from fences
+                                    // RET: check result
+{
+    if(!enabled()) {
+        return {false, false, 3.0e38f, {0, 0}};
+    }
+
+    //
+    // stopping distance is v^2 / 2a along the direction
+    // of travel, so project by velocity * |v| / 2a
+    //
+    const speed_type speed = SQRT(velocity.x * velocity.x + velocity.y * velocity.y);
+    const distance_type scale = (deceleration > 0) ? (speed / (2 * deceleration)) : 0;
+    const Point2D projected = {pose.x + velocity.x * scale, pose.y + velocity.y * scale};
+
+    Point2D inward;
+    const distance_type clearance = _nearest({pose.x, pose.y}, inward);
+
+    Point2D projectedInward;
+    const distance_type projectedClearance = _nearest(projected, projectedInward);
+
+    //
+    // report the fence we would hit when stopping
+    // if that is closer than the one we are nearest now.
+    //
+    if(projectedClearance < clearance) {
+        inward = projectedInward;
+    }
+    const bool violated = (projectedClearance < margin) || (clearance < margin);
+    const bool approaching = (velocity.x * inward.x + velocity.y * inward.y) < 0;
+
+    return {violated, approaching, clearance, inward};
+}
@@ -0,0 +1,109 @@
+#ifndef BEHAVIOR_GEOFENCE_H
+#define BEHAVIOR_GEOFENCE_H
+
+#include "../config.h"
+#include "../rover/pose.h"
+
+const unsigned int GEOFENCE_MAX_VERTICES = 8;   // most vertices in the boundary polygon
+const unsigned int GEOFENCE_MAX_KEEPOUTS = 4;   // most keep-out circles
+
+//
+// edge of the boundary polygon as a half-plane;
+// a point p is inside when (normal . p) >= offset
+//
+typedef struct GeofenceEdge {
+    Point2D normal;         // unit normal pointing into the allowed area
+    distance_type offset;   // normal . (any point on the edge)
+} GeofenceEdge;
+
+//
+// circular area the rover must stay out of
+//
+typedef struct KeepOutCircle {
+    Point2D center;         // center in world coordinates
+    distance_type radius;   // radius in world units
+} KeepOutCircle;
+
+//
+// result of checking a pose against the fence
+//
+typedef struct GeofenceCheck {
+    bool violated;          // true if the projected stopping point is within margin of a fence
+    bool approaching;       // true if the rover is moving towards the nearest fence
+    distance_type clearance;// distance from current position to the nearest fence;
+                            // negative if outside the fence
+    Point2D inward;         // unit direction away from the nearest fence
+} GeofenceCheck;
+
+/**
+ * A geofence made of a convex boundary polygon that
+ * the rover must stay inside of and a set of keep-out
+ * circles that it must stay out of; all in world coordinates.
+ *
+ * Edge normals are calculated once when the boundary
+ * is set, so each check is a dot product per edge and
+ * a distance per circle.
+ */
+class Geofence {
+    private:
+    GeofenceEdge _edges[GEOFENCE_MAX_VERTICES];
+    unsigned int _edgeCount = 0;
+    KeepOutCircle _keepOuts[GEOFENCE_MAX_KEEPOUTS];
+    unsigned int _keepOutCount = 0;
+
+    /**
+     * Find the fence closest to a point
+     */
+    distance_type _nearest(
+        Point2D point,              // IN : point to check
+        Point2D &inward) const;     // OUT: unit direction away from nearest fence
+                                    // RET: signed distance to nearest fence;
+                                    //      negative if point violates the fence
+
+    public:
+
+    /**
+     * Determine if there is any fence to check
+     */
+    bool enabled() const { return (_edgeCount > 0) || (_keepOutCount > 0); }
+
+    unsigned int edgeCount() const { return _edgeCount; }
+    unsigned int keepOutCount() const { return _keepOutCount; }
+
+    /**
+     * Set the boundary polygon
+     */
+    int setBoundary(
+        const Point2D *vertices,    // IN : polygon vertices in order; either winding
+        unsigned int count);        // IN : number of vertices; 0 to remove the boundary
+                                    // RET: SUCCESS or FAILURE if polygon is not
+                                    //      convex or has too many vertices
+                                    //      (boundary is unchanged on failure)
+
+    /**
+     * Add a keep-out circle
+     */
+    int addKeepOut(
+        Point2D center,             // IN : center of circle
+        distance_type radius);      // IN : radius of circle
+                                    // RET: SUCCESS or FAILURE if there is no room
+
+    /**
+     * Remove all fences
+     */
+    Geofence& clear(); // RET: this fence
+
+    /**
+     * Check a pose and its velocity against the fence.
+     * The rover's position is projected forward by the
+     * distance it needs to stop at the given deceleration.
+     */
+    GeofenceCheck check(
+        const Pose2D &pose,             // IN : current position
+        const Pose2D &velocity,         // IN : current world velocity (x, y)
+        speed_type deceleration,        // IN : braking deceleration, distance/sec^2 (> 0)
+        distance_type margin) const;    // IN : extra distance to keep from fences
+                                        // RET: check result
+};
+
+#endif // BEHAVIOR_GEOFENCE_H
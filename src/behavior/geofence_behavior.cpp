@@ -0,0 +1,221 @@
+#include "geofence_behavior.h"
+#include "../error.h"
+
+const char *GeofenceStateStr[NUMBER_OF_GEOFENCE_STATES] = {
+    "CLEAR",
+    "HALTING",
+    "TURNING",
+    "RETURNING",
+};
+
+/**
+ * Deteremine if dependencies are attached
+ */
+bool GeofenceBehavior::attached() // RET: true if attached, false if not
+{
+    return (nullptr != _rover) && (nullptr != _messageBus);
+}
+
+/**
+ * Attach dependencies
+ */
+GeofenceBehavior& GeofenceBehavior::attach(
+    TwoWheelRover &rover,       // IN : rover to watch
+    MessageBus &messageBus)     // IN : message bus to publish on
+                                // RET: this behavior in attached state
+{
+    if(!attached()) {
+        _rover = &rover;
+        _messageBus = &messageBus;
+    }
+    return *this;
+}
+
+/**
+ * Detach dependencies
+ */
+GeofenceBehavior& GeofenceBehavior::detach() // RET: this behavior in detached state
+{
+    if(attached()) {
+        _rover = nullptr;
+        _messageBus = nullptr;
+        _state = GEOFENCE_CLEAR;
+    }
+    return *this;
+}
+
+/**
+ * Set state and publish it
+ */
+void GeofenceBehavior::_setState(GeofenceState state) {
+    if(state != _state) {
+        _state = state;
+        if(nullptr != _messageBus) {
+            _messageBus->publish(*this, GEOFENCE, BEHAVIOR_SPEC, GeofenceStateStr[state]);
+        }
+    }
+}
+
+/**
+ * Build a fence from its parts
+ */
+static int buildFence(
+    Geofence &fence,                // OUT: the fence; cleared on failure
+    GeofenceMode mode,              // IN : what to do at the fence
+    distance_type margin,           // IN : distance to keep from fences (>= 0)
+    const Point2D *vertices,        // IN : convex boundary polygon
+    unsigned int vertexCount,       // IN : number of vertices; 0 for no boundary
+    const KeepOutCircle *keepOuts,  // IN : keep-out circles
+    unsigned int keepOutCount)      // IN : number of keep-out circles
+                                    // RET: SUCCESS or FAILURE if fence is invalid
+{
+    fence.clear();
+    if((mode < 0) || (mode >= NUMBER_OF_GEOFENCE_MODES) || (margin < 0)) {
+        return FAILURE;
+    }
+    if(SUCCESS != fence.setBoundary(vertices, vertexCount)) {
+        return FAILURE;
+    }
+    for(unsigned int i = 0; i < keepOutCount; i += 1) {
+        if(SUCCESS != fence.addKeepOut(keepOuts[i].center, keepOuts[i].radius)) {
+            fence.clear();
+            return FAILURE;
+        }
+    }
+    return SUCCESS;
+}
+
+/**
+ * Check a fence without installing it
+ */
+int GeofenceBehavior::validate(
+    GeofenceMode mode,              // IN : what to do at the fence
+    distance_type margin,           // IN : distance to keep from fences (>= 0)
+    const Point2D *vertices,        // IN : convex boundary polygon, may be null if vertexCount is 0
+    unsigned int vertexCount,       // IN : number of vertices; 0 for no boundary
+    const KeepOutCircle *keepOuts,  // IN : keep-out circles, may be null if keepOutCount is 0
+    unsigned int keepOutCount)      // IN : number of keep-out circles
+                                    // RET: SUCCESS or FAILURE if fence is invalid
+{
+    Geofence fence;
+    return buildFence(fence, mode, margin, vertices, vertexCount, keepOuts, keepOutCount);
+}
+
+/**
+ * Replace the fence
+ */
+int GeofenceBehavior::configure(
+    GeofenceMode mode,              // IN : what to do at the fence
+    distance_type margin,           // IN : distance to keep from fences (>= 0)
+    const Point2D *vertices,        // IN : convex boundary polygon, may be null if vertexCount is 0
+    unsigned int vertexCount,       // IN : number of vertices; 0 for no boundary
+    const KeepOutCircle *keepOuts,  // IN : keep-out circles, may be null if keepOutCount is 0
+    unsigned int keepOutCount)      // IN : number of keep-out circles
+                                    // RET: SUCCESS or FAILURE if fence is invalid
+                                    //      (on failure the fence is removed)
+{
+    _setState(GEOFENCE_CLEAR);
+    if(SUCCESS != buildFence(_fence, mode, margin, vertices, vertexCount, keepOuts, keepOutCount)) {
+        return FAILURE;
+    }
+
+    _mode = mode;
+    _margin = margin;
+    return SUCCESS;
+}
+
+/**
+ * Propose a halt or turn-back if the rover
+ * is about to cross a fence.
+ */
+bool GeofenceBehavior::proposeCommand(
+    unsigned long currentMillis,    // IN : current time in milliseconds
+    WheelCommand &command)          // OUT: if active, the override command
+                                    // RET: true if overriding the wheels
+{
+    if(!attached() || !_fence.enabled()) {
+        _setState(GEOFENCE_CLEAR);
+        return false;
+    }
+
+    const Pose2D pose = _rover->pose();
+    const GeofenceCheck check = _fence.check(pose, _rover->poseVelocity(), GEOFENCE_DECELERATION, _margin);
+    const bool triggered = check.violated && check.approaching;
+    _inward = check.inward;
+
+    switch(_state) {
+        case GEOFENCE_CLEAR: {
+            if(!triggered) return false;
+            _setState((GEOFENCE_TURN_BACK == _mode) ? GEOFENCE_TURNING : GEOFENCE_HALTING);
+            break;
+        }
+        case GEOFENCE_HALTING: {
+            // hold the halt while too close; yieldTo() releases it to drive away
+            if(!check.violated) {
+                _setState(GEOFENCE_CLEAR);
+                return false;
+            }
+            break;
+        }
+        case GEOFENCE_TURNING:
+        case GEOFENCE_RETURNING: {
+            if(!check.violated) {
+                _setState(GEOFENCE_CLEAR);
+                return false;
+            }
+            break;
+        }
+        default: {
+            break;
+        }
+    }
+
+    if(GEOFENCE_HALTING == _state) {
+        command = WheelCommand(false, 0, 0);
+        return true;
+    }
+
+    //
+    // turn in place to face away from the fence,
+    // then creep back inside at minimum speed.
+    //
+    const speed_type speed = _rover->minimumSpeed();
+    const distance_type error = limitAngle(ATAN2(check.inward.y, check.inward.x) - pose.angle);
+    if((error > GEOFENCE_TURN_TOLERANCE) || (error < -GEOFENCE_TURN_TOLERANCE)) {
+        _setState(GEOFENCE_TURNING);
+        command = (error > 0)
+            ? WheelCommand(true, -speed, speed)    // counter-clockwise
+            : WheelCommand(true, speed, -speed);   // clockwise
+    } else {
+        _setState(GEOFENCE_RETURNING);
+        command = WheelCommand(true, speed, speed);
+    }
+    return true;
+}
+
+/**
+ * Release a halt if the overridden command
+ * drives away from the fence
+ */
+bool GeofenceBehavior::yieldTo(
+    unsigned long currentMillis,    // IN : current time in milliseconds
+    const WheelCommand &proposed)   // IN : command the lower behavior proposes
+                                    // RET: true to let the lower behavior drive
+{
+    if((GEOFENCE_HALTING != _state) || !attached()) {
+        return false;
+    }
+
+    //
+    // the rover moves along its heading, forward or back
+    // with the sum of the wheels; turning in place or
+    // driving along the fence does not release the halt.
+    //
+    const distance_type angle = _rover->pose().angle;
+    const distance_type along = (proposed.left + proposed.right) * (COS(angle) * _inward.x + SIN(angle) * _inward.y);
+    if(along > 0) {
+        _setState(GEOFENCE_CLEAR);
+        return true;
+    }
+    return false;
+}
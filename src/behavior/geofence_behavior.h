@@ -0,0 +1,136 @@
+#ifndef BEHAVIOR_GEOFENCE_BEHAVIOR_H
+#define BEHAVIOR_GEOFENCE_BEHAVIOR_H
+
+#include "../config.h"
+#include "../rover/rover.h"
+#include "../message_bus/message_bus.h"
+#include "behavior.h"
+#include "geofence.h"
+
+typedef enum {
+    GEOFENCE_HALT = 0,      // stop at the fence
+    GEOFENCE_TURN_BACK,     // turn around and drive back inside
+    NUMBER_OF_GEOFENCE_MODES, // SHOULD ALWAYS BE LAST
+} GeofenceMode;
+
+typedef enum {
+    GEOFENCE_CLEAR,         // not near a fence
+    GEOFENCE_HALTING,       // stopping before the fence
+    GEOFENCE_TURNING,       // turning in place towards the inside
+    GEOFENCE_RETURNING,     // driving back inside
+    NUMBER_OF_GEOFENCE_STATES, // SHOULD ALWAYS BE LAST
+} GeofenceState;
+
+extern const char *GeofenceStateStr[NUMBER_OF_GEOFENCE_STATES];
+
+/**
+ * Safety layer that keeps the rover inside the geofence.
+ * Each control tick it checks where the rover would
+ * stop if it braked now; if that is within the margin
+ * of a fence and the rover is moving towards it, this
+ * behavior overrides all lower priority behaviors with
+ * a halt or a turn-back until the rover is clear.
+ *
+ * Moving away from a fence never triggers.  A halt
+ * holds until the rover is clear of the fence or a
+ * lower priority behavior proposes driving away
+ * from it, so a driver holding a command towards
+ * the fence cannot creep across it.
+ */
+class GeofenceBehavior : public Publisher, public Behavior {
+    private:
+    // attached dependencies
+    TwoWheelRover *_rover = nullptr;
+    MessageBus *_messageBus = nullptr;
+
+    Geofence _fence;
+    GeofenceMode _mode = GEOFENCE_HALT;
+    distance_type _margin = GEOFENCE_MARGIN;
+    GeofenceState _state = GEOFENCE_CLEAR;
+    Point2D _inward = {0, 0};       // away from the nearest fence at the last check
+
+    /**
+     * Set state and publish it
+     */
+    void _setState(GeofenceState state);
+
+    public:
+
+    GeofenceBehavior()
+        :  Publisher(BEHAVIOR_SPEC), Behavior(GEOFENCE_PRIORITY)
+    {
+    }
+
+    ~GeofenceBehavior() {
+        detach();
+    }
+
+    GeofenceState state() { return _state; }
+    GeofenceMode mode() { return _mode; }
+    distance_type margin() { return _margin; }
+    const Geofence& fence() { return _fence; }
+
+    /**
+     * Deteremine if dependencies are attached
+     */
+    bool attached(); // RET: true if attached, false if not
+
+    /**
+     * Attach dependencies
+     */
+    GeofenceBehavior& attach(
+        TwoWheelRover &rover,       // IN : rover to watch
+        MessageBus &messageBus);    // IN : message bus to publish on
+                                    // RET: this behavior in attached state
+
+    /**
+     * Detach dependencies
+     */
+    GeofenceBehavior& detach(); // RET: this behavior in detached state
+
+    /**
+     * Check a fence without installing it,
+     * so an upload can be refused when it arrives
+     */
+    static int validate(
+        GeofenceMode mode,              // IN : what to do at the fence
+        distance_type margin,           // IN : distance to keep from fences (>= 0)
+        const Point2D *vertices,        // IN : convex boundary polygon, may be null if vertexCount is 0
+        unsigned int vertexCount,       // IN : number of vertices; 0 for no boundary
+        const KeepOutCircle *keepOuts,  // IN : keep-out circles, may be null if keepOutCount is 0
+        unsigned int keepOutCount);     // IN : number of keep-out circles
+                                        // RET: SUCCESS or FAILURE if fence is invalid
+
+    /**
+     * Replace the fence
+     */
+    int configure(
+        GeofenceMode mode,              // IN : what to do at the fence
+        distance_type margin,           // IN : distance to keep from fences (>= 0)
+        const Point2D *vertices,        // IN : convex boundary polygon, may be null if vertexCount is 0
+        unsigned int vertexCount,       // IN : number of vertices; 0 for no boundary
+        const KeepOutCircle *keepOuts,  // IN : keep-out circles, may be null if keepOutCount is 0
+        unsigned int keepOutCount);     // IN : number of keep-out circles
+                                        // RET: SUCCESS or FAILURE if fence is invalid
+                                        //      (on failure the fence is removed)
+
+    /**
+     * Propose a halt or turn-back if the rover
+     * is about to cross a fence.
+     */
+    virtual bool proposeCommand(
+        unsigned long currentMillis,    // IN : current time in milliseconds
+        WheelCommand &command);         // OUT: if active, the override command
+                                        // RET: true if overriding the wheels
+
+    /**
+     * Release a halt if the overridden command
+     * drives away from the fence
+     */
+    virtual bool yieldTo(
+        unsigned long currentMillis,    // IN : current time in milliseconds
+        const WheelCommand &proposed);  // IN : command the lower behavior proposes
+                                        // RET: true to let the lower behavior drive
+};
+
+#endif // BEHAVIOR_GEOFENCE_BEHAVIOR_H
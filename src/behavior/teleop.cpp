@@ -0,0 +1,72 @@
+#include "teleop.h"
+
+/**
+ * Set the driver's command
+ */
+TeleopBehavior& TeleopBehavior::setCommand(
+    const WheelCommand &command)    // IN : wheel command; a stopped command
+                                    //      deactivates this behavior
+                                    // RET: this behavior
+{
+    _command = command;
+    _active = !command.isStopped();
+    _ramping = false;
+    return *this;
+}
+
+/**
+ * Deactivate this behavior
+ */
+TeleopBehavior& TeleopBehavior::cancel() // RET: this behavior
+{
+    _command = WheelCommand();
+    _active = false;
+    _ramping = false;
+    return *this;
+}
+
+/**
+ * Ramp the driver's command down to a halt,
+ * then deactivate this behavior.  A new command
+ * from the driver stops the ramp.
+ */
+TeleopBehavior& TeleopBehavior::rampToHalt(
+    unsigned long currentMillis,    // IN : current time in milliseconds
+    unsigned long rampMs)           // IN : time to ramp down to zero
+                                    // RET: this behavior
+{
+    if(_active && !_ramping) {
+        _ramping = true;
+        _rampStartMs = currentMillis;
+        _rampMs = rampMs;
+    }
+    return *this;
+}
+
+/**
+ * Propose the driver's command if it is moving
+ */
+bool TeleopBehavior::proposeCommand(
+    unsigned long currentMillis,    // IN : current time in milliseconds
+    WheelCommand &command)          // OUT: if active, the driver's command
+                                    // RET: true if driver is moving the rover
+{
+    if(_active && _ramping) {
+        //
+        // scale command linearly down to zero over the ramp
+        //
+        const unsigned long elapsed = currentMillis - _rampStartMs;
+        if(elapsed >= _rampMs) {
+            cancel();
+        } else {
+            const float scale = (float)(_rampMs - elapsed) / (float)_rampMs;
+            command = WheelCommand(_command.useSpeedControl, _command.left * scale, _command.right * scale);
+        }
+        return _active;
+    }
+
+    if(_active) {
+        command = _command;
+    }
+    return _active;
+}
@@ -0,0 +1,59 @@
+#ifndef BEHAVIOR_TELEOP_H
+#define BEHAVIOR_TELEOP_H
+
+#include "behavior.h"
+
+/**
+ * Drive with the most recent movement command
+ * sent by the client.  A moving command stays
+ * active until the client sends a stop, then
+ * lower priority behaviors can drive again.
+ */
+class TeleopBehavior : public Behavior {
+    private:
+    WheelCommand _command;
+    bool _active = false;
+    bool _ramping = false;          // true if ramping down to a halt
+    unsigned long _rampStartMs = 0;
+    unsigned long _rampMs = 0;
+
+    public:
+
+    TeleopBehavior(): Behavior(TELEOP_PRIORITY) {}
+
+    bool active() const { return _active; }
+    bool ramping() const { return _ramping; }
+
+    /**
+     * Set the driver's command
+     */
+    TeleopBehavior& setCommand(
+        const WheelCommand &command);   // IN : wheel command; a stopped command
+                                        //      deactivates this behavior
+                                        // RET: this behavior
+
+    /**
+     * Ramp the driver's command down to a halt,
+     * then deactivate this behavior.  A new command
+     * from the driver stops the ramp.
+     */
+    TeleopBehavior& rampToHalt(
+        unsigned long currentMillis,    // IN : current time in milliseconds
+        unsigned long rampMs);          // IN : time to ramp down to zero
+                                        // RET: this behavior
+
+    /**
+     * Deactivate this behavior
+     */
+    TeleopBehavior& cancel(); // RET: this behavior
+
+    /**
+     * Propose the driver's command if it is moving
+     */
+    virtual bool proposeCommand(
+        unsigned long currentMillis,    // IN : current time in milliseconds
+        WheelCommand &command);         // OUT: if active, the driver's command
+                                        // RET: true if driver is moving the rover
+};
+
+#endif // BEHAVIOR_TELEOP_H
@@ -1,4 +1,5 @@
 #define bundle_css_len sizeof(bundle_css_gz)
+#define bundle_css_etag "\"1c9f89fec67552ad\""
 const uint8_t bundle_css_gz[] = {
     "\x1F\x8B\x08\x08\xA6\x43\x1F\x60\x00\x03\x62\x75\x6E\x64\x6C\x65"
     "\x2E\x63\x73\x73\x00\xCD\x59\x5B\x6F\xE3\xB8\x15\x7E\xF7\xAF\x20"
@@ -1,2545 +1,2563 @@
 #define bundle_js_len sizeof(bundle_js_gz)
+#define bundle_js_etag "\"854c8ab8d8bd42e6\""
 const uint8_t bundle_js_gz[] = {
-    "\x1F\x8B\x08\x08\xA6\x43\x1F\x60\x00\x03\x62\x75\x6E\x64\x6C\x65"
-    "\x2E\x6A\x73\x00\xEC\xBD\x6B\x77\x1B\xC7\xB1\x28\xFA\x5D\xBF\x62"
-    "\x84\xED\x15\x82\x32\x08\x51\xCE\xCE\x39\x39\xA4\xE9\x7D\x64\x49"
-    "\x76\xB4\x65\x59\xBE\x92\x6C\x27\x47\x4B\x8B\x1E\x02\x43\x72\x22"
-    "\x10\x83\x8D\x19\x88\x44\x64\xFE\xF7\x5B\x8F\x7E\x54\xBF\x66\x06"
-    "\x7C\xC8\x4E\x22\xC4\x11\x81\x99\xEA\xEA\xEA\xEA\xEA\xEA\xEA\xEA"
-    "\xEA\xEA\xFB\xF7\xED\x27\x3B\x5A\xCD\xA7\xB3\x62\xFC\xF7\x3A\xBB"
-    "\xEF\x7C\xEE\xDC\x81\x97\x27\xB3\xEA\x28\x9F\x65\x93\x6A\x5E\x37"
-    "\xF9\xBC\xA9\xEF\xD0\xB7\xEC\xBB\x27\xDF\xBC\x3E\xFC\xF9\x2F\x4F"
-    "\x9E\x7C\x97\x1D\x64\x83\x59\x71\xDC\x0C\xF6\xD5\xAB\x97\x4F\xBF"
-    "\xFD\x8B\x78\xB7\x2C\x4F\x4E\xED\x4B\x5B\xEE\xF0\xE9\xF7\x8F\x9F"
-    "\xFC\x15\x20\x76\x23\x05\xCD\xCB\x07\xB1\x82\x8F\xE1\xC5\x70\xF7"
-    "\x62\xF7\x41\xF6\xE5\x97\x01\xC6\xED\x28\x3A\xA7\x48\x50\x11\x94"
-    "\xB9\x73\xFF\xDE\xBD\x3B\xD9\xBD\xEC\x55\x39\x3F\x99\x15\x4D\x35"
-    "\xCF\x9A\x2A\x9B\x55\xD5\xBB\xD5\x22\x9B\xE7\x67\x45\x56\x1D\x67"
-    "\xE7\xA7\x45\x31\xAB\xC7\x00\x76\x5F\xD5\xF1\x33\x3D\x41\xDC\xC7"
-    "\xAB\xF9\xA4\x29\xAB\xF9\x70\x3B\xFB\x70\x27\x83\x8F\x02\x70\x5A"
-    "\xC3\x6F\xF0\xC3\x2C\xDB\xCB\x76\x47\xF6\x11\x73\x6A\x2F\x7B\x40"
-    "\x8F\x2E\xF7\x03\x34\xDF\x3F\x7C\xFE\x04\xB0\xBC\xF1\xB0\x04\x28"
-    "\xE8\xF7\xDB\xB0\x3C\x71\xC1\x96\x46\x76\x8C\xE4\xAF\x2F\xB8\xE0"
-    "\x1D\xFA\xA3\x1B\x04\x18\x56\xF3\xC6\x34\x0B\x3F\xCB\xA2\x59\x2D"
-    "\xE7\x82\xA8\xF1\xAC\x98\x9F\x34\xA7\x5C\xE3\xA5\x57\x1E\xB9\x37"
-    "\x24\xD6\x3D\x9D\x4F\x8B\x8B\x56\x44\x6F\x2C\xDC\xDB\x38\xB6\x12"
-    "\xDF\x31\xBA\xEF\x01\x71\x12\x1B\xB1\xFC\x8D\x81\x4B\x61\x9B\xF6"
-    "\x41\xF5\x38\x85\xA7\x2E\x66\xC7\x6E\xB7\x62\x63\xA1\x0B\xF1\x8F"
-    "\xE8\x16\x22\x1A\x1E\xD3\x5F\xF9\x7C\x8A\x0F\xA7\xE2\x09\x31\x1B"
-    "\x1E\xD2\xDF\x91\x16\x84\x3B\x82\x26\xAC\x73\xFF\xCE\xE5\xF6\x70"
-    "\x7B\x3F\xE8\x5B\x26\x44\xCB\x96\xEA\x5C\x23\x57\x5F\x8C\xEE\x00"
-    "\x2E\xD3\x76\x6E\xD3\xEA\xEC\xA8\x58\x86\x4C\x68\x63\x00\x34\x5E"
-    "\x8F\x96\xDA\x8E\x96\xD3\xBC\xC9\x4E\xAB\xD9\xB4\x86\xB2\xF9\xB4"
-    "\x9A\xCF\xD6\x28\x7B\xC7\xE5\xC9\x6A\x99\x53\x7D\xEF\xF3\xD9\xAA"
-    "\x70\x46\x0F\xBF\x07\xBA\x9D\xC1\x43\xF5\x13\x7E\xFC\xDC\xCB\xFE"
-    "\x2F\xD3\x52\x67\x1F\xE6\x44\xEC\x65\xB6\x93\xF1\x37\x1C\x93\x67"
-    "\xE5\x6C\x56\xD6\xC5\x64\x5E\x41\xCD\x30\x64\xEB\xD3\xEA\x5C\x97"
-    "\x8C\x7D\x88\xD4\x22\x6B\x4A\x18\xD2\xF9\x45\x59\x23\x0E\x7C\xB0"
-    "\x38\x3F\xBB\x5F\x2F\x8A\x62\xDA\x56\xB8\x29\x66\xC5\x59\xD1\x2C"
-    "\xD7\xD9\x62\x56\x35\x63\x05\x7A\xDF\x95\x29\x03\xF4\x03\xC0\x3C"
-    "\xAF\xB1\x4D\x9A\x9D\x0F\x76\xE1\xB3\xAF\xA5\xA7\x77\x1B\xEB\xFC"
-    "\x6C\x31\x2B\x6A\x10\x1F\x41\xC1\xD1\xEA\xF8\xB8\x58\x76\xD1\xF0"
-    "\x35\x41\xBD\x2A\xFF\x51\x48\x3A\xBE\x60\x2A\x9C\x22\x8B\xAA\x2E"
-    "\x5E\xEB\x62\x89\x02\x9E\x62\x38\xCD\x97\xCD\xD7\xF9\xE4\xDD\xC9"
-    "\x12\xA4\x75\xFA\xA8\x9A\x55\x4B\x59\x68\xF0\x1F\x0F\xFE\x8C\xFF"
-    "\x1B\x40\x4B\x07\xFF\xF1\xC7\xFF\x85\xFF\x1B\xDC\xBB\xBF\xAF\x55"
-    "\x9B\x8B\xE8\x21\x74\x46\x04\xC5\x93\x6F\xF0\x7F\x83\x80\x5C\x94"
-    "\xF1\x57\xD8\x5F\x61\x99\x19\xCA\xFB\x11\x08\x5B\x58\x8A\x86\x42"
-    "\xA2\x58\xBC\x04\xD6\xF3\x3A\x5F\x9E\x14\x4D\xA2\xA2\x93\x65\x51"
-    "\xCC\x13\x35\xA5\x0A\x26\xCA\x60\x5D\x3F\x9C\x9F\x25\x2A\x5A\x17"
-    "\xB3\x59\x75\x9E\xA8\x29\x5A\x2C\x55\x02\xBB\xFA\xBB\x72\x5E\x84"
-    "\x25\x16\xE5\xFC\x5D\x1C\xFE\x87\xAA\x9C\x47\x5A\xB2\x2C\xA6\x21"
-    "\x7C\xFE\xBE\x58\xE6\x27\x05\xF1\xD9\x1D\x00\x5F\x48\xF9\x67\x25"
-    "\x10\xEA\x50\x6F\x00\x81\xE6\xF2\x9E\x8C\x22\xB0\x56\xD0\x25\xBC"
-    "\x7D\x2A\xCA\x04\x92\x0E\x25\x82\x67\x52\x27\x47\xE4\x1C\x55\x74"
-    "\xE4\xB1\x5F\xCA\x08\xB5\x86\x37\x0F\x04\xA4\x2B\xCA\x00\xE9\x3E"
-    "\xF0\xA7\x77\x07\xD4\x7B\xE2\x61\x15\xF2\xA7\xD0\x8A\x27\x3E\x5E"
-    "\x17\xD8\x7F\xE4\x61\xD6\xF2\xA6\xD0\xEA\x9F\x3E\x4E\x01\xE6\xFC"
-    "\xF6\x7A\xC3\x08\xA3\xEA\x09\xF3\xDB\x83\xB3\x42\xA8\x00\xED\x03"
-    "\x01\xE9\x8A\x1F\x40\xBA\x0F\x46\x72\x06\x77\x27\x55\x98\x53\xC1"
-    "\xE4\x2D\xCF\x16\xD5\x12\xEC\xC7\x6A\x36\x3B\x82\xEE\x7D\xD5\xE4"
-    "\x4D\x91\x1D\x2F\xAB\xB3\x6C\x30\xBE\xBF\x54\x4F\x0F\x6B\x7C\x0C"
-    "\x46\xF3\xC0\x4C\x86\x8F\x50\x9E\x97\xAB\x09\x4D\x6C\x0D\x02\x82"
-    "\xFA\x3E\xAE\x96\x50\x49\x5D\xFE\x23\x3F\x9A\x15\xA3\x6C\x91\x03"
-    "\xC1\xF8\x35\x9B\xE4\xF3\xF7\x39\x4D\x87\x19\xFE\x1F\x2C\xC9\xB9"
-    "\x7A\x96\x95\x35\x17\x29\xA6\xA3\xAC\x6C\xB6\x6A\xC0\x57\x2D\xA7"
-    "\xE5\x1C\xE9\xA8\xD7\x75\x53\x9C\x61\x09\x86\x2A\x1A\x9C\xF5\x68"
-    "\x06\x2B\x2F\x8A\x99\x00\xAD\xB3\x7C\x3E\xA5\x37\x8C\xF6\x07\xAC"
-    "\xBA\x58\xAA\xA2\x93\x1C\xC8\x9B\x62\xD9\x65\x41\x44\x09\x48\x43"
-    "\xD4\xFF\x5D\xE4\xCB\xFC\x2C\xFB\x00\xCD\x82\x89\xFE\x32\x9B\xD4"
-    "\x20\xBC\x40\x3F\x74\xCF\x32\x09\xC0\x6D\x90\x6F\xEF\x5D\xBA\x24"
-    "\x64\x64\x03\x18\x75\xC1\x25\x7E\x2A\x8B\xF3\x47\x86\x6F\x43\x59"
-    "\xD5\xC8\xE2\x1D\xB9\x98\x46\xD9\x59\x51\xD7\xD0\xB7\x5F\xAF\xE0"
-    "\xD5\x6A\x31\x85\x76\x3F\xE7\x27\xDA\x92\x01\xF3\x24\x3B\x9C\x18"
-    "\xAA\x0F\x32\x18\xAB\xC5\x31\x7C\x9F\xEE\x8B\xF7\x4C\x74\xFC\xE5"
-    "\xB4\x5C\x36\xEB\x47\x1A\x02\x7A\xB8\xF0\x5F\xA2\xC2\x30\xAF\x5C"
-    "\x5D\x78\x08\x3D\xC4\x65\xF5\x9C\x6A\x04\x15\x44\xED\x2C\x7F\xA7"
-    "\x99\xEE\xF4\xDC\x59\xDE\x4C\x4E\x33\xD2\x47\xD0\x33\x28\x0A\xA6"
-    "\x94\xA2\x75\x7C\x5E\x4E\x9B\x53\xA8\x54\xFF\x9E\xCC\x4A\x80\xFD"
-    "\x19\x9F\xEE\x07\xC0\xA7\x05\x8E\xBE\x00\xFA\x2F\xF4\x38\x61\x1A"
-    "\x53\x8F\x3C\x6C\x9A\x7C\x72\x5A\x4C\x81\x70\x20\xF7\xE5\x93\xD7"
-    "\x7B\xD4\xCA\xAC\x3C\xCE\xDE\xC3\x6B\x94\x24\xB0\x4A\x72\x05\x95"
-    "\xD1\xA0\x20\x3C\x81\x2D\x7D\xF7\xAE\xED\x85\x78\x8D\x8C\x05\x6B"
-    "\x75\xD8\x04\x55\x0D\x7D\x62\xE4\x7B\xFC\xE0\x54\x52\xC1\x1A\x76"
-    "\x56\x9D\x0C\x07\x00\x56\x9C\x2D\x68\x5C\x30\x4A\xCD\x61\xA2\xB8"
-    "\x39\x2F\x27\x05\xD1\x7D\x32\xAF\x60\xFA\x1A\x0F\xB6\xF7\x1D\x5C"
-    "\x8E\x4A\xD0\x0F\x15\xAD\xCC\x53\x21\x4C\xD3\x6A\xB2\xC2\x3E\x1A"
-    "\xFF\xCF\xAA\x80\x89\x03\x7A\x6C\xD2\x54\xAE\xF4\x6E\x07\xDD\x41"
-    "\xFD\xA0\x5F\x47\x4A\x12\x90\x2C\xE6\xC9\xD0\xBE\x25\xC6\x19\x0D"
-    "\x63\x6E\x2E\x83\x0E\x55\x65\x12\x3A\x68\x9A\xDF\x05\xD3\xA2\xA5"
-    "\x0B\xBE\x2B\x41\xF5\xCC\x61\x9C\xF7\xE7\xBF\xC5\x07\xCB\x8D\x12"
-    "\xB4\x5E\xDD\x80\xBD\x9E\xCD\x34\xA6\x1B\xEB\x07\x6F\xDC\xBA\xCC"
-    "\x16\x2F\x13\x8C\x63\x3A\x15\xE3\xFA\x70\x8C\xC6\xBE\x6D\x06\x79"
-    "\x31\x1C\x4E\x3A\xEC\x0A\x47\x83\x28\xFB\x95\x2E\xEB\x77\x06\x0C"
-    "\xA6\x65\x13\xC7\x82\x1D\x72\xF7\xAA\x83\x82\xF0\x8A\x3E\x30\xFD"
-    "\x04\x03\xD8\x0C\xEA\xAB\x76\x8A\x45\xFB\x39\x79\x6F\x24\xC5\x0F"
-    "\xB2\x83\x83\x03\x01\xE2\x13\x2C\x06\x45\x3E\x9D\x3E\x79\x0F\xE3"
-    "\x8A\x9B\x0F\xF3\xC1\x80\x67\xC4\xC1\x28\x3B\xAC\xE6\x2F\xE9\xBB"
-    "\xEC\x27\xFC\x80\x82\xF2\x7F\x97\xB4\xB8\x5B\xD2\x78\xCF\xE7\x6A"
-    "\x82\xD0\x73\xC6\xC8\x87\x6E\x70\x0E\xF6\xB9\x83\x13\x78\xA9\xD7"
-    "\x7A\x06\xD6\xF9\x59\x1E\x0F\x87\x77\xEF\xDA\x99\x68\x3B\xFB\xC3"
-    "\x1F\xB2\x61\xB3\x5E\x14\xB0\x78\x73\x26\x25\x62\xC0\x80\x67\xCB"
-    "\x41\xD0\x61\xF8\xB1\x58\xC6\xF5\xEA\xA8\x9E\x2C\xCB\xA3\x62\xE8"
-    "\xE0\x18\x11\xF7\xBD\x7E\xB9\x8C\x75\x06\xD0\xD5\x3A\x6A\xC3\xC9"
-    "\x8B\xD8\x70\x54\x36\xB8\xEA\xCC\xB3\x53\xB0\x73\x46\xB0\xD0\x04"
-    "\x83\x66\x59\x36\x25\x98\x0C\x59\x40\xAF\xFF\x81\xF2\xC8\x31\x35"
-    "\xF6\x40\xB4\x16\xE5\x04\x7D\x68\xE5\x1C\x30\xE4\xB3\x3E\xE5\xB1"
-    "\x6F\x95\xBA\x20\xEB\x07\xEC\xA5\xCC\x48\x46\x1F\x04\x25\xAA\xFA"
-    "\xBA\x04\x2B\x6B\x3F\x3B\x2A\x80\x9C\xC2\xE0\x60\xEB\xA2\x17\x12"
-    "\x26\x18\x68\x01\xCB\x02\xA8\x81\x69\xE4\x2C\x5F\x67\xA7\xE5\xB4"
-    "\x08\xE4\xE1\x90\x3B\xE8\xBB\xAA\x5A\x0C\x17\xC5\x12\x6A\x3C\xCB"
-    "\xE7\x93\x62\x3C\xAF\x40\x8F\x6E\x47\x07\x4A\xA7\x2A\xAE\x9B\x6A"
-    "\x71\x2B\x83\xBF\x5A\xDC\xFE\xD8\xDF\x09\xC6\xFE\x6E\xFF\xB1\xBF"
-    "\x2C\xCE\xAA\xF7\xC5\x4D\x0C\x7F\xAF\xB1\x28\x98\xED\x2A\xE0\x63"
-    "\x0C\xEB\xD5\x7C\xB3\x81\xED\xFC\x3C\x2F\xE7\xD3\xEA\x7C\x3C\x41"
-    "\xF1\x9A\x3D\x9C\x97\x67\xE4\x5B\xFB\x66\x89\x3E\x56\x21\x85\x8E"
-    "\xCC\x25\xFB\x4F\xFB\xA1\xEE\xAB\x3F\x2C\x01\x34\x74\xCA\x59\xD9"
-    "\xAC\xE5\x5B\x9A\xF0\xD0\xB9\x66\xA6\xBB\x98\xB9\xF8\x8A\x01\xA2"
-    "\x33\x9E\x2E\x9C\x9E\xEF\x00\x20\x30\x3D\x4C\xB1\xE4\x74\xA2\x00"
-    "\xBA\x95\x9B\xF3\x1A\x4B\x0D\xAD\xD0\x6D\xC4\x30\x43\x31\x2A\x83"
-    "\x34\xC5\xC9\x41\x90\xA0\x18\xB1\x5D\x9B\x24\x96\x01\x22\x0A\xC4"
-    "\x7D\x82\x8D\x3F\xCE\x67\x75\xE1\x2A\x10\xF5\xEE\xD7\x5F\x9D\xD5"
-    "\x4D\xA0\x43\x1C\x1B\x89\x56\x89\x43\x4F\x3C\xBD\xC5\x11\x55\x75"
-    "\x25\xBA\x95\xF0\x92\x81\xBB\x01\xE1\x08\x1F\xF4\x7C\x60\x2E\xB7"
-    "\x50\xAC\xA6\x3D\x3D\x71\x01\xEE\x1C\x88\x9D\x2E\xF3\xF3\xB4\x34"
-    "\x79\xAD\x14\xED\x73\xE5\x2C\x68\xBE\x28\x18\xB4\x5F\xAB\xB5\x61"
-    "\x81\x8A\xCF\x11\x28\xC1\x1A\xAC\x60\x3B\x8E\xA1\x9A\x2B\x3D\x32"
-    "\xD4\xCA\x2D\x83\x62\xB9\xC7\xBF\x33\xA1\xB1\xA2\xEB\x65\xFD\xA1"
-    "\xD5\xE9\xF2\x9D\x9E\xC9\xE1\x3F\x62\x41\x27\x2F\xBD\xD6\x27\xFA"
-    "\x99\xA6\x4A\x74\xC2\xBF\x6A\xF2\xB3\x45\xAA\xB5\xDB\x6C\x90\xB0"
-    "\xEE\xD7\x53\x39\xF7\x0E\x8C\x1F\x53\x44\xC8\xBC\x9C\x14\x3A\x57"
-    "\x2D\x4A\x99\x2E\x0B\x58\x82\xD5\xCD\x06\xDA\xB4\xC3\x81\xE9\xCE"
-    "\xCD\xB8\xC5\xE3\x3C\x90\xAE\x2A\xB3\xE4\x45\x37\x95\xF9\x21\x20"
-    "\xEC\x0A\x0A\x20\xEC\x8F\x91\x5F\x9B\xD2\xBC\xA6\x32\xF5\x5B\xC0"
-    "\x69\xF5\x0A\x20\xFA\xAB\x78\xAB\x55\x19\xBC\xD5\x5F\xC5\x5B\xCB"
-    "\x61\x78\x6F\x7F\x38\x54\x18\x46\x13\x0D\xE6\x97\xA4\xC0\x59\xD0"
-    "\x20\x1D\xCE\x03\x07\x52\x18\x3F\x04\x28\x7E\x0B\x38\x23\xF3\x00"
-    "\x63\xBE\xB7\x6D\x9B\xE1\xD6\x95\xFF\xC9\x7E\x2E\x8E\xB2\x57\xD5"
-    "\xE4\x1D\x4C\x71\x68\x22\xBC\x04\xEB\x63\x99\x3D\xAA\xCE\xC0\x88"
-    "\x9B\xFA\x9B\xE2\xB8\x2F\x6E\x3D\x57\x0C\xC3\x65\x87\xA7\x55\xDD"
-    "\xD0\xC6\x5F\x86\xFE\xC3\x83\x3F\x7F\x21\xBD\x53\x72\x19\xAA\xE5"
-    "\xD0\x4E\xBC\x60\x3A\x14\xF9\x59\x06\x02\x78\x52\xA0\xF1\x9A\x67"
-    "\xE7\xC5\x51\xCD\x24\x91\x33\xF2\xCF\x0F\x64\x89\xF7\xF9\x32\x53"
-    "\x6F\x0F\xB2\xF9\x6A\x36\x0B\x67\xE3\x57\xC8\x5A\xF2\xDB\x44\x3C"
-    "\x31\x5C\x36\xE5\xF7\x79\x59\xE4\xD3\x75\xAC\xA0\xAA\x12\xAD\x20"
-    "\x60\x19\xB7\x7A\xFC\xE2\x87\x27\xDF\x93\x36\xE1\xB7\x63\xDC\xFD"
-    "\x5B\x93\xCF\xD4\xD5\x53\xB6\xB1\x6C\xDA\xE7\x30\x7C\x88\x7B\x68"
-    "\x72\xD6\xA0\xF2\x78\xA5\x31\xAF\x9A\x0C\x96\x1D\x60\x39\xCF\x8A"
-    "\xE9\x49\xA1\xCB\x40\x83\x8A\xF9\x94\x4D\x0B\x80\x27\x1F\x14\x96"
-    "\x3D\x29\x1A\xF7\x05\x3A\x31\x19\x6F\x68\xBD\x14\xE8\x2B\xE6\x3A"
-    "\xC1\x5C\x1B\x04\x2B\x76\x8B\x29\x68\xFA\x60\x90\xDD\xA5\xA9\xDB"
-    "\xE2\xD0\xAD\x73\x90\x38\xF4\x44\x6C\xA0\xB0\xB8\xC7\x9C\xA7\xC7"
-    "\x2E\x67\x3C\x7E\x4C\x47\xB4\x4A\xB5\x6C\x79\xB2\x5C\xD2\x96\x8C"
-    "\xC7\x14\xF9\x18\x58\x52\xE0\x4F\x5D\x48\x4F\x01\x4C\x14\x18\xFE"
-    "\x47\x6B\x02\xAA\x8B\x25\x0A\x7E\xC9\x8E\xE3\xAD\x27\x2F\x5F\xBE"
-    "\x78\x39\xDC\xDE\xCA\x8E\x51\x1F\x8E\x03\x76\x12\x4E\x63\x00\x87"
-    "\xFC\x3C\xCD\x0D\x71\x49\x76\x4A\x1C\x29\x7E\x26\x91\x44\x4B\xFB"
-    "\xFC\x9C\xCC\x0A\x18\x2C\xDC\x3C\xEA\x17\x6A\x1C\x95\x14\xDE\x4A"
-    "\x1C\x82\x15\x8C\x39\x9C\xED\x08\x10\xA0\x2A\xF4\x1C\x68\x66\xE9"
-    "\xE6\x67\x2E\x79\x84\x3D\x24\x30\x21\x6A\xF4\x2A\xC1\xB6\x40\x10"
-    "\x94\x6F\x1F\x09\xE7\x61\x07\xB3\xCD\xBC\xA0\x6A\x25\xA4\xDD\x06"
-    "\x44\x78\x87\x0A\x54\x9A\xD2\xFA\x21\x6D\x2B\x1F\x48\xEA\x13\x26"
-    "\x79\x81\x1B\x5B\xD4\x8E\x61\x53\x5C\xE8\x36\x8D\xB2\xC0\x44\x93"
-    "\x36\xC6\x5D\x7A\x1B\x35\x28\xDE\x41\x73\x56\x30\x89\x03\xAB\x4F"
-    "\xF3\xF7\x34\x56\x17\x20\x4D\x20\x84\xB3\x9C\xE6\x52\x35\x6E\x25"
-    "\x36\xA3\x91\xB6\x23\x76\x94\x00\x14\x03\xB8\x03\xD2\x8A\x66\x0A"
-    "\xD0\xF5\xA2\xDC\x15\x6D\x0F\xAC\x4D\xBF\x43\x79\xDC\xE0\x7A\x7B"
-    "\xBD\x3D\x88\x19\x89\xE9\xAA\x70\x5F\xBF\x65\x19\xEF\x4C\x37\x63"
-    "\xE4\xD5\x5E\x36\xC8\x3E\xCF\x24\x75\xDE\x2A\xC7\x82\x0E\x3D\xA1"
-    "\x4C\x17\x8A\xDB\xB2\x76\x71\x3D\xC1\xCD\x89\x21\x35\xBB\xD5\xEB"
-    "\xE0\x90\xCB\x43\x8E\xE9\xE5\xA2\xFB\xAD\x6C\xFC\x85\xD9\xF8\xD9"
-    "\x07\x7A\x7E\xB9\xFD\x4B\x94\xC6\xE8\x7A\x23\xEA\x47\x75\x47\x86"
-    "\x99\x3B\x61\xBD\x6B\xA6\xB2\xE1\x2F\xE7\xF5\xDE\xFD\xFB\x9F\x7D"
-    "\xD0\x13\xF9\xE5\xDE\x67\x1F\x70\xF6\xBD\xBC\xAF\x14\xF2\x2F\xA3"
-    "\xEC\xCD\x56\xBE\x9C\xAE\xCA\x79\xB5\xF5\x56\x0E\x2D\xE6\xF3\x51"
-    "\x39\xCF\x97\xEB\xD7\xEB\x05\xB6\x00\x00\x97\xF9\x9A\xC3\x34\xB6"
-    "\xF6\xDB\x3A\x59\x95\xAE\xE6\xD5\xA2\x98\x8B\x70\x98\x6C\x18\x73"
-    "\x25\xB4\xF0\x18\xCB\x83\xC1\xD9\xEE\x42\x30\xB5\x99\xA5\x80\xA8"
-    "\xF0\xAC\x0E\x96\xA5\xF8\x81\x31\xA0\xDD\x1B\x34\xD7\x2B\x27\x08"
-    "\x40\x8F\xFD\x35\x86\x57\x4C\x83\x8C\xA9\x17\xEA\x9F\xCB\xE6\x74"
-    "\x38\x20\xD2\xA3\x7E\x12\xFD\x01\x65\xF1\xF7\x15\x28\x84\x65\x71"
-    "\x8C\x1B\x23\x19\x94\xA8\xF5\x46\xA7\x62\x00\xD9\x6A\xF3\xEA\x3C"
-    "\x89\x43\x32\xEA\x17\x87\x51\x7B\xD9\x67\x1F\x34\x61\x97\xBF\x78"
-    "\xEC\x32\x6C\xCB\x0A\x10\xAE\x64\x1B\x9A\x62\xD6\xDD\x06\x4D\xBE"
-    "\x0D\xDB\x81\x36\x28\xBA\x6E\x82\xEE\xB6\xBA\x17\xF9\x12\xC8\xAF"
-    "\x56\x3C\x89\x88\xD0\xA5\x9C\x64\x05\xB5\xC0\x62\x75\x34\x2B\xEB"
-    "\xD3\xAC\x6C\x92\x88\xEC\x92\x91\x3C\x60\xE9\xD6\x6A\xCA\x65\x63"
-    "\x0F\xB2\xFF\x7E\xF5\xE2\xFB\x31\x51\x22\xB8\x38\x2B\x27\xC5\xF0"
-    "\x3F\x47\x46\x7C\xC6\xA8\xFB\x29\xE8\xEF\x05\xC8\xD9\x36\x70\x75"
-    "\x5B\x2F\xC9\xEB\x77\xE5\x22\xDB\x42\x5E\x6F\xB5\xD6\x2C\xFC\x6B"
-    "\xAA\x51\x43\x1B\x1B\x32\x18\x59\x9A\x12\x9D\x8D\x9F\xCB\xAB\x88"
-    "\x01\x46\x21\xF4\x97\x03\x84\xFE\x4D\x44\x80\x2A\x9E\x9C\xE6\xF3"
-    "\x93\xE2\x16\x7B\x9E\x6A\x69\xEB\xF4\x3F\x6D\xD0\xE9\xC4\xD9\xCD"
-    "\x7B\x1D\x8B\x0D\x46\x44\xCA\x4D\xF7\xF5\x49\xD5\x54\x9F\xFA\x1A"
-    "\x2B\x9B\x95\xEF\x8A\xBD\x6C\xEB\x03\xB1\x64\xB0\xF7\x61\x70\x31"
-    "\xD8\xDB\xF9\xE3\xEE\xEE\x78\x97\x3E\xA3\xC1\x7A\xB0\x67\x7F\xE4"
-    "\x83\xBD\x3F\x8E\x1F\xFC\xE7\x83\x3F\xFD\x9F\x3F\x8E\x06\x64\x74"
-    "\x0F\xF6\x06\x0F\x1F\xFD\xE5\xE9\x93\x9F\x9E\x3C\x1E\xC0\xFB\x66"
-    "\xB0\xF7\xBF\x77\xFF\xF7\x9F\xFF\xD7\xFF\xB9\xBC\x6C\xEF\x70\x16"
-    "\x33\xAC\xF4\xDB\x2A\x9F\xDD\x98\xA8\x51\xC7\x6E\x2E\x6A\xD4\xF8"
-    "\x91\x21\xE7\xA6\xC5\x0D\xED\xF9\xDE\xD2\x06\xC0\x0D\x4C\xCF\xF5"
-    "\x6F\x22\x71\xAA\xF2\xDB\x57\x30\xBA\xA2\x9B\x9A\x58\x90\xC5\x9B"
-    "\xF7\x3B\x94\x1A\x8C\x34\x2D\x37\xDD\xEB\x93\xB3\x29\x90\x8A\x4E"
-    "\x16\x67\x3D\xD3\x2A\x04\xCD\x29\xFA\x50\x4E\xAB\xD5\x0C\x16\xF3"
-    "\x05\xCD\xF7\xC2\x67\x40\x31\x44\x2A\xCC\x19\xD7\x00\x8E\x83\x24"
-    "\xF6\x01\xD2\xDC\xC5\x02\x58\x7C\x5D\xA6\x9E\xFE\xB4\xCB\x96\x44"
-    "\x7B\x99\x3D\x14\x7E\x8D\x94\x15\xA6\x3F\xE1\x92\x9A\x9B\xFE\xEA"
-    "\xC7\x47\x8F\x9E\xBC\x7A\x35\xC2\x15\x25\x0C\x44\x10\xC7\xA5\x71"
-    "\x9F\x00\x0F\xB6\xD2\xAD\x54\xFD\x70\x73\xCD\xF9\x1E\xAA\x97\x4D"
-    "\xEA\x65\x65\x9A\xF6\xA5\xD6\x3F\x80\x21\x58\xFD\x38\xCD\x68\x13"
-    "\xB2\x74\xE3\xD2\x0D\x03\x95\x32\x29\xCA\xF7\xB0\x24\x5F\xCD\x8B"
-    "\x8B\x05\x28\x17\x8C\x13\x84\xD5\xA2\x1E\x0B\xFD\xAC\xE7\xE0\x69"
-    "\x2B\x49\x9A\x9C\xF3\x7C\x39\xF7\x57\x35\x31\x7A\x78\xA5\x65\xBC"
-    "\x33\xFE\x92\x27\xA4\xE0\x72\x3F\xB1\x0A\x9A\xCC\xD8\x68\xB9\xF2"
-    "\xA2\x8B\x10\x04\x8B\x2E\x5B\x87\x71\xD1\xC6\x89\xBB\xE4\xF5\x74"
-    "\x36\x2C\x2E\x26\xC5\x02\x29\xD8\x64\x51\xAD\xCB\xA8\x85\xB5\x41"
-    "\xD1\xBD\x26\x46\xDF\x90\x17\x54\xC0\xF4\xFA\xD5\xE3\x9B\x61\xE0"
-    "\xDC\x25\xFF\x9D\xF5\x02\x3F\xFA\xEE\xC5\xAB\x27\x8F\x79\x87\xBC"
-    "\x0F\xEC\xD3\xEF\xBF\x8D\x2A\x35\x55\x96\x78\xEA\xEF\xDC\x5D\x46"
-    "\x3A\x30\x60\x6E\x64\x83\x06\x84\x06\x16\xF1\xB5\xBB\x47\x43\x2A"
-    "\x57\x6F\x41\x78\x3B\x0F\x6A\xC3\xC1\xD9\xDD\x50\xFE\x74\xDA\xDB"
-    "\x50\xDF\x65\xB0\x33\x3A\xDF\x30\xC8\x19\xFF\x3A\xE5\xC8\x75\x45"
-    "\xA5\xE8\x9B\xAC\xC9\xFA\xD6\xB0\x42\xFB\xCB\xAD\x97\xA7\x00\xAE"
-    "\x97\xBF\x8B\xF7\xD6\xDD\x0C\x00\xF6\x87\xDC\xD7\x51\xAE\x2E\xDC"
-    "\xD7\x51\x5F\xDD\xF2\xFA\xAD\xFE\x2A\x43\xD8\x8D\x7F\x10\xC3\xD7"
-    "\xCD\x0F\x1D\x40\x8D\xFF\x2A\x3F\x8C\x62\x31\x6E\xB0\xDC\xBF\x1F"
-    "\xD9\x61\x99\x56\x67\xD9\xAA\xC1\xA0\x82\xB2\x08\x8E\x19\xAA\x93"
-    "\x86\x7F\xC1\xC8\x1A\x72\x56\x73\xD8\xAB\x3A\x24\x44\x01\x37\x07"
-    "\xF0\x30\x3B\xF8\x4A\x75\x60\x31\x03\x01\xC9\x6B\xDA\x63\xC2\x48"
-    "\xB1\xE1\x16\x00\x4D\x8B\xF9\xD6\x36\x6E\xF0\xE0\xE4\x7E\x5A\x9D"
-    "\x47\x50\xD1\xE3\x16\x54\x1C\x78\x12\x60\x9B\x96\x35\x45\x6C\x87"
-    "\x08\xF5\x9B\x2E\xF2\x14\xDC\x14\x50\x2A\x00\xFD\x44\xED\x9A\xAA"
-    "\x9A\x8A\x79\xA2\x22\xF5\xA2\x07\xED\xAD\x55\x91\xBB\x8C\xFA\x28"
-    "\xEC\xA2\x54\xF7\x38\x1B\x5E\x50\x5B\xB1\x6C\x86\xFC\x47\xA8\x2A"
-    "\xD4\x11\xB4\xFD\x70\xF7\x20\x0B\x5E\xE2\xA7\x39\x5D\x02\xEF\xD1"
-    "\xDD\xC6\x8E\xD7\x81\x81\x02\xA2\xCA\x99\xD5\x9F\x97\xC4\x8A\x7B"
-    "\x77\xEE\xDD\xCB\xF2\x23\x50\x7B\x2B\x50\x1F\x74\x72\x8C\x43\xD2"
-    "\xF8\x50\xD4\x1D\x19\x3E\x0E\x60\xC3\x0B\x4B\xC8\x70\xC0\x30\xBC"
-    "\xC3\xA0\x1C\x55\xF0\xDE\x52\x80\xFE\x39\xC7\xEB\xAD\x84\x78\x78"
-    "\x91\x7D\x75\x90\xED\x6E\x67\xFF\x95\x5D\x64\x7B\xD9\xCE\xC5\xBE"
-    "\xA5\x65\x52\x15\xE8\xF0\x56\x67\xB2\x30\xB2\x18\x8F\x22\x36\xC5"
-    "\x89\x47\x0C\x86\x48\xDC\x08\x31\x17\xD9\xAF\x18\x27\x73\x69\x4E"
-    "\x17\x7C\x0B\xCA\xEE\x2C\xBF\x28\xCF\x56\x67\x64\xCC\x9D\x57\x48"
-    "\x4D\xB1\x2C\x27\xE2\x64\x9D\x13\x76\xAF\x8F\x92\x5D\x44\x9F\xAE"
-    "\xEF\x24\xCE\x9D\xE9\x38\x6F\x51\xD9\x05\x99\xF4\x6B\x2F\x6E\x1F"
-    "\x00\x86\x17\xA3\x6C\x7D\xAD\xE6\x26\x0A\xAD\xFB\x77\xD8\x5A\x77"
-    "\xD8\x3A\x60\x57\x39\x2F\x3F\x1A\xB7\xA0\xAE\x76\x6E\x95\xF3\xDF"
-    "\x9C\x5B\x5F\x26\x98\xF5\x53\x3E\x2B\x29\x2C\x2E\x57\x63\x0D\xF7"
-    "\x00\xB5\xB0\x63\x63\x2A\xB2\x2A\xF2\xD9\x8C\xF8\x00\x6A\x64\x56"
-    "\x67\xE7\xB0\x5C\xC1\xD8\xFF\x79\xB6\xC4\x55\x5F\x92\xA1\x8C\x51"
-    "\x7F\x70\x8B\xF3\x7B\xA8\xDF\xE9\x0D\x1C\x50\xEF\x15\x0D\x21\x8A"
-    "\x5F\xCD\xC6\xF9\x25\x72\xD1\xA0\x28\xAD\x42\xE0\x5D\x51\x5E\x07"
-    "\xC1\x7F\xBA\x33\x08\xA7\x6E\x12\x58\x7A\xAB\x1A\xEC\xC8\x3B\x89"
-    "\xC3\x9D\x99\xA4\x31\x53\x5A\xCD\x54\xCD\x15\xCC\x2B\x83\x7B\x72"
-    "\x5A\x4C\xDE\x51\x65\xF9\xB4\x8B\xE8\xFC\xA2\x0F\xD1\x6A\xBC\xDD"
-    "\x0A\xD1\x0A\x77\x92\xE8\xA3\x0A\x2C\xCC\x7C\x7E\x89\x26\x24\xD7"
-    "\x28\x3B\x4B\x1F\xF9\xA0\x8E\xC6\xE2\x06\x6A\xC4\x73\x0A\xBE\x34"
-    "\xB4\x8E\xFB\x13\x0B\x74\xE6\xAB\x59\x83\x28\x19\xCF\xD0\x60\xD9"
-    "\x76\x87\x4F\x59\x93\x90\xAA\xF3\xCA\xC4\x9D\x11\x49\x83\x88\xAB"
-    "\x18\x11\xA7\x9D\x07\xB6\x39\x5E\x38\x19\x8C\x24\x35\x78\x98\xD3"
-    "\x14\xC1\xA9\x86\xD6\x36\xEF\x75\x39\x71\x53\x1A\x9A\xAA\x44\x58"
-    "\x53\x09\x80\xFF\xFA\xAB\x13\x7A\x1A\x02\x1B\xC4\x60\x1F\x5B\x92"
-    "\xFE\x2B\xE3\x86\x64\x5F\x21\xE4\x36\x30\x5A\xFF\x3E\xA0\x07\xDB"
-    "\xDB\x16\xAD\x6F\x93\xDB\x3A\xB0\xC9\x1D\x04\xB9\x44\x51\x81\x4E"
-    "\x9A\xBE\x44\x40\x41\xD3\x97\x07\xF4\x40\xD2\x14\xD2\x85\x9F\xE8"
-    "\xF6\x21\x7E\x64\x8C\xBA\xFD\xD7\xDD\xC9\x13\x13\x2E\x1E\xA6\xCB"
-    "\x51\xC1\x58\x1D\x91\x6B\x55\x03\x00\x1C\xDA\x6F\xF5\xD5\x97\xC8"
-    "\x32\x35\xA4\xCA\x26\x3B\x2A\x26\x15\xAC\x0E\x09\x06\x5E\x84\x45"
-    "\xBE\xC2\xE6\x24\xE0\xF3\x0B\x82\xA7\x08\x80\xF3\x12\xC5\x9B\x44"
-    "\x14\x64\x91\x1C\x5C\xD3\xB1\x33\xE7\x1B\x52\x85\x58\x8E\x98\x7B"
-    "\xC2\x3A\x92\xC2\x76\xD7\xE1\x7F\xAB\xBE\xCF\xA4\x2C\x5D\xA9\x1C"
-    "\x74\xF7\x46\xE5\xB0\xA2\xAF\x98\x7C\xDF\x6A\xD3\x0E\x41\x04\x33"
-    "\x52\x82\x92\xAB\x3A\x11\xBE\xEF\x7B\x00\x0A\x93\x06\xC8\x2F\x9C"
-    "\x39\x89\x60\x44\xAF\x9F\xE5\x0B\x3B\x07\x61\x48\x63\xA1\x74\x0E"
-    "\x59\x5C\x1C\x91\x41\x0F\xEE\xB8\x86\xC8\x42\xB3\x1E\x8F\x69\x3E"
-    "\x47\xF6\xD3\x17\xEA\xE0\x8A\x7E\xC3\x9F\x1B\xEE\x10\x55\xD5\xD5"
-    "\xCB\x6E\xDA\x31\xAA\x2C\x35\xE8\xAA\x25\xFB\xD6\x29\x96\xCF\x48"
-    "\xEB\x4B\xEA\x84\x03\x43\xF7\x8E\x6E\xFD\xBE\x00\x6C\x2A\x0D\xC6"
-    "\x15\xED\x30\xA9\xAE\x11\xC2\xFC\x36\xE5\xB7\x61\xAA\xD0\xE5\xEE"
-    "\x8B\xAA\x3E\xE7\xB2\x42\x1F\x2C\x0B\x36\x50\x90\x54\x0C\xE9\xC7"
-    "\xA8\xA5\x77\x45\xB1\xA0\x90\x9E\xD9\x4C\x2F\x98\x38\x4B\x02\x0C"
-    "\xE2\x6A\x59\x9E\x94\x60\xB2\x10\x30\x62\xA0\x0C\x15\x42\x39\x61"
-    "\x02\x8C\x79\xB6\xC0\x85\xC8\x54\x6F\x2D\x9F\x80\x0A\x04\x5D\x54"
-    "\xCE\x9A\x62\xF9\x8D\x12\x2F\x5A\x8A\x80\x0D\x04\xEB\xA8\x49\xBE"
-    "\x9C\xEA\xFA\x58\x18\x75\xAD\xA8\x2F\x10\xF0\xFB\x17\xAF\x9F\xEC"
-    "\x65\xAF\xD5\x94\x5E\xE7\xC7\x24\xBA\x2B\xF4\x93\x53\x88\x0E\x4E"
-    "\x76\xD0\x13\xF1\x63\x83\x0F\x67\xB3\xE1\xF6\x08\xD1\xF0\x87\x4F"
-    "\x9D\x4C\xAB\x82\xC3\xC0\x28\x60\x26\x57\xD4\x0D\xB7\xB3\xB3\xA2"
-    "\x39\xAD\x3C\x5D\xC4\x2F\x71\x45\x38\xC4\x76\x8F\xBC\xB6\xE8\x01"
-    "\x80\x01\x84\x86\x61\x07\xD9\x9B\xB7\xFB\x3A\xFC\x28\xC3\x80\x57"
-    "\x92\x8A\xD5\xC9\x69\x56\xE4\xF6\x18\xEA\x28\xCB\x17\x8B\xD9\x5A"
-    "\x61\x54\x4E\xFE\xFA\x54\xB3\x8E\xA2\x1D\x8C\xC4\xC5\xAB\xC5\x0F"
-    "\xEE\xDA\x0F\x31\x80\xAC\xA4\x63\x04\xF0\xE7\x4B\xEA\x22\x9D\x43"
-    "\x06\x1E\x60\xA8\x7F\xCC\x09\xD6\x98\x13\xB1\x07\x54\xE4\x4D\xF9"
-    "\xD6\x0F\xED\xF1\x6B\x1E\xAA\x12\x51\x67\x93\xE9\x3C\x6C\x87\x81"
-    "\xDC\x60\xD2\xD2\x08\x84\x06\xE3\x75\x38\x71\xE4\xB8\x5C\xD6\x0D"
-    "\x1F\xE5\x45\xA1\xD1\xB4\xD3\x49\x72\x7C\xCF\x82\x29\x3A\x8F\xCB"
-    "\x7E\x83\xC5\xBE\x01\x20\xD1\x8B\x9A\x36\xA1\xBF\xF0\x85\x6C\x14"
-    "\x33\x88\x32\xCC\x28\xF6\x8C\x4B\xB5\xF3\x11\xB6\x8C\x42\xA3\x09"
-    "\x94\x57\xBC\x2E\x6F\xA8\x70\xBD\xA0\xDD\x14\x4E\x59\x03\xFD\x11"
-    "\xBA\xD8\xFC\x36\xE3\xA8\xF0\x5B\x5B\x77\x36\x17\x84\x7E\xF3\xC6"
-    "\x92\xFC\xF4\x6B\x2A\x47\x9B\x5E\xBD\xB5\x44\x42\x4B\x55\x23\x7E"
-    "\x1B\xE5\x8F\xE7\x62\x39\x2E\xD0\xD1\x9B\x74\xB4\x98\xE5\x18\xC3"
-    "\x9D\x2F\x61\xBC\x81\x6A\xC2\x75\x16\x1D\x4A\xA8\x17\xD0\xC5\x9C"
-    "\xBA\xA6\x5A\x35\xAE\x79\x4C\x45\x70\x03\xE9\x35\xBF\x1D\xAE\x96"
-    "\xB3\x91\x06\x7D\x8E\x63\x1C\x53\x6F\xC8\x33\xF1\xD3\x72\x8A\xB0"
-    "\x2F\x56\x8D\x3D\xD1\x20\x65\x1B\xF5\xEC\x0F\xD0\x31\x60\xFE\x0C"
-    "\xAD\x6F\x1C\xA8\xA8\x66\x68\xF6\x2F\x8B\xBF\x83\xCE\x0A\x05\x50"
-    "\x55\x09\x38\xEB\xA2\xD1\xC4\xA4\x7D\xEB\x0E\x15\xA1\xC9\xC8\xB5"
-    "\x0C\xAD\x05\xB2\xF5\x92\x83\xF5\xA9\x9E\x29\x6E\x3E\x6E\x39\x07"
-    "\xEC\x44\x9B\xE5\xEE\x25\xB1\x07\x79\xB2\xED\xA0\x1F\xA3\xF5\xE7"
-    "\xB6\x8E\x78\x1C\x53\x16\xD0\x7F\x8F\x4C\x2C\xA9\x6E\x25\x1E\xDB"
-    "\xC7\x75\xD3\x6A\x11\xEE\x18\x20\xB0\x66\x80\x82\x8F\xEC\x11\xD0"
-    "\x61\x3E\xCB\x85\xD4\xF6\x9A\xDC\x03\xD8\x62\xF9\x38\xA9\xAA\xE9"
-    "\xDD\x6C\x6B\x64\x24\x23\xB1\x13\xA3\xBA\x6C\xD8\x02\xE6\x6D\x95"
-    "\x78\x4C\xE2\x78\x3F\xCB\xA5\x62\x19\xC4\xFD\x25\x48\x64\xD7\x1E"
-    "\x11\x89\x85\x22\xDB\xC9\xE8\x3E\xA1\x3E\x26\x4F\xDE\x8C\xF6\x0C"
-    "\x60\xA2\x5B\x50\x20\x1B\x8B\xBE\x95\xA3\x28\xF3\x24\xEF\x58\x74"
-    "\xC3\xF6\x99\x5A\x18\xA3\x8D\x86\x76\xF9\x44\xB2\xC6\x84\xBA\xFC"
-    "\x50\xAE\xC9\xED\x98\xEB\x34\xFB\x36\x3F\x2B\x16\xF9\x34\xFB\x31"
-    "\xE9\x40\xB5\xC3\x54\xC1\x46\xF3\x5C\xA9\x79\x95\x6C\x1B\x30\x11"
-    "\x4E\x18\x94\x83\xB1\xB9\x61\x1A\x52\x27\xD7\x9A\xF3\x5E\x98\x86"
-    "\x4C\xE4\x82\x32\x80\x58\xF9\x0F\x00\x37\xD4\x05\xC2\xD1\x6B\x91"
-    "\xA2\x51\xE0\x4C\x17\x86\x1E\x58\x2E\x9A\x1A\x79\xCE\xF6\xA5\x21"
-    "\x36\xC5\x7B\x45\x52\xD3\xBC\x25\x45\x15\x00\x0C\xBA\x68\x30\xDD"
-    "\x7B\xA4\x09\xCA\xC6\xA6\x21\x2D\x03\x8A\x01\x78\xF2\x57\xE5\xBA"
-    "\xC7\xC6\x9D\xF0\x9B\x52\x98\x06\xA3\x76\x64\x07\x3D\xFC\x9C\x56"
-    "\x37\x47\xAB\xA6\xD1\xE9\xD0\xB0\xA3\x77\xC7\xBB\x68\x43\x3D\xE0"
-    "\x3F\x6C\x81\x6A\x8F\x1A\x97\xD3\x7F\x7D\xCF\x1A\x63\xFA\x89\x57"
-    "\x3E\x47\x45\x73\x5E\x40\x51\x44\x87\x22\x03\xF8\x52\xE5\x78\xCF"
-    "\x4B\xAD\xAC\xF8\xBC\xBB\x71\xBB\x64\x43\x7E\x80\x67\x9D\x8F\xC8"
-    "\x13\x51\xCC\xA7\xDB\x29\x4C\x05\xC6\x82\x33\x1E\x0C\x9A\x27\x2C"
-    "\x53\x18\x01\x43\xFC\xA5\x50\x7C\x79\xC0\x75\x58\x24\x81\x1B\xB5"
-    "\x54\x2D\xA6\x64\x67\x54\x3D\x70\xC2\x20\x64\xFF\x17\x95\xF5\x44"
-    "\x1B\x16\x7E\x5F\x13\x0F\x68\xD1\x30\x74\xF8\xA1\x1A\x59\xB8\x11"
-    "\xDB\x62\x35\x24\xA0\xFB\xAF\xA6\x3C\x1C\x4C\xEC\x55\x4B\x63\x0B"
-    "\xFB\xAF\xC6\x48\x98\xEE\x8B\xAF\xB4\x5A\xE6\x56\x6C\xD5\x31\x79"
-    "\x92\xB0\x98\xE8\x47\xF4\x37\xF3\x37\x86\x57\x49\xB3\xE4\xCE\x3D"
-    "\xEE\xCF\x1D\xD5\x8F\xB0\x38\xA3\x2F\xED\x72\x3E\xE7\xF4\x7A\x86"
-    "\xAC\x9D\x07\x57\x96\x73\x44\xE4\x49\x39\x61\xFB\x37\x12\x73\xCC"
-    "\x1B\xC6\x42\x2E\x98\xD1\x29\xE2\x06\xF6\x9F\x58\xC0\xB1\x0D\x5B"
-    "\x51\x31\xBA\x8E\x78\x0F\x2D\x1F\x41\x9C\x61\x1A\xBA\x9F\x7D\xB1"
-    "\xBD\xB1\xA0\xE3\x26\x13\x6F\x27\x65\x46\xA1\xF0\x84\x9D\x5F\xF0"
-    "\x33\x3A\x3A\x8D\xF6\x2A\xCE\x89\x68\x39\xAA\xC3\xA6\x76\xDA\x36"
-    "\xD2\xFF\x9A\x9C\x16\x53\x4E\xF9\x68\xCE\x66\x29\xF4\xEA\x1C\x57"
-    "\x8D\x99\x68\xF3\x5A\x39\x38\x14\x2C\xFE\x80\x35\x08\xAC\x5F\x6A"
-    "\x8D\x4B\xF9\x40\x68\x4D\x0E\xFF\x9E\xAC\x78\x99\x8A\x87\x9C\x38"
-    "\xCD\x17\xE5\x26\xC3\xC3\x4E\xC6\xAF\x02\xBC\x26\x5F\xCA\xD1\x5A"
-    "\x23\x99\x16\x93\x92\xDC\x1D\xEC\x87\x50\x94\xD0\xB9\x34\xCC\x1E"
-    "\x9A\x37\x8A\x04\xC0\xB8\x16\xD1\x67\x9A\xF4\xD4\xB0\x56\xDB\x4A"
-    "\x27\x6C\x8D\x50\x74\x9E\xEE\x1C\x95\x21\x55\x9B\x3F\xF0\x9A\xB2"
-    "\x4B\x51\x2B\xEC\xB3\xDA\x39\xB9\x36\xCF\xDF\x97\x27\x79\x53\x2D"
-    "\xC7\x27\x45\xA3\xEC\xAB\x7A\xE8\x0F\xE5\x37\x5C\xEB\x5B\xEA\x98"
-    "\x17\xC7\x4F\x75\xB7\x50\xA5\xDA\xE4\x52\x4C\xD4\x3C\x25\xFD\x45"
-    "\x09\xD2\x80\x8E\xA1\xA9\xB3\x54\x5B\x36\xD4\xF8\x64\x3D\x4A\x18"
-    "\x44\x55\xC9\x7A\xB4\xDC\xF4\xAE\x4A\xC9\xF0\x07\x6C\xCB\x9E\xA9"
-    "\x72\xA4\x11\xD9\x47\x7A\xF3\x8D\xA4\x11\x3B\x4E\x57\x65\xA5\x10"
-    "\xAA\xA8\x17\xD0\xD1\xC7\x25\xFC\xD0\x35\x6C\xF2\xC1\x0E\x72\x79"
-    "\x2A\x2A\xB2\x4F\xF7\xAF\x82\xDB\x38\xF7\x85\x8D\x84\x03\x49\x61"
-    "\x1F\x5D\x0B\xA7\x9C\x90\x10\x29\x31\x29\xA9\x80\x95\xF1\x4C\x1A"
-    "\xC3\x5A\xD0\x23\x47\x8C\x47\x1E\x27\x46\x21\x1B\x7C\x27\x06\x45"
-    "\x43\x3B\x91\x49\xF8\x51\x1D\xFB\xD6\x4D\x4F\x62\xBB\xD7\x5A\xE6"
-    "\x97\xDE\x79\x77\x69\xA5\x0F\x3D\x9B\x1B\x33\x6F\x44\xF3\xC4\x44"
-    "\x8D\x6D\xD9\xB0\x88\x9B\x4D\x1B\xCC\x11\xF3\x3A\x66\xFE\xBB\x8C"
-    "\xE9\xB1\x08\xB0\xB4\x61\xD1\xA7\xCA\x01\xE3\xA2\x89\x2E\x08\xF0"
-    "\xC3\xB9\x19\x11\xD8\xB1\xEE\xE9\xC9\x1B\x83\xEF\x6D\xA7\xB5\x9F"
-    "\x6A\x4D\xD0\xAD\x1B\x35\x88\x4B\xEB\x26\x05\xB8\x3A\x5A\xA5\xE0"
-    "\xDD\x86\xA9\x87\x6F\x04\xEA\xEE\xD6\x45\x73\x46\xE9\xA3\xDE\x58"
-    "\x97\x99\xF7\x2C\xED\xD1\x58\x3A\x7F\x78\x0C\xF6\x82\x11\x33\x72"
-    "\xA0\x8D\x35\xC3\x90\xE6\xA7\x0B\x25\x4C\x7B\x86\x13\x0F\x9C\x94"
-    "\xD9\xDE\xFA\x96\xD2\x67\x7B\xCF\x62\x49\x3F\x9D\xA0\x35\x9D\xF5"
-    "\xF3\xB9\x3D\xB1\x4F\x9E\xCB\xAD\xF1\x7D\x15\x64\x7A\x78\xB4\xAA"
-    "\xC7\x7F\xAF\xB7\x04\xB0\xC2\x6E\x20\x75\x77\xB8\x50\x91\x44\xA2"
-    "\x5B\x91\x44\xA2\xB2\x08\x65\x70\xC0\xE7\xAF\xAB\x6A\x66\x29\xC1"
-    "\xFC\x3C\x0C\x7F\xD8\xE0\x8B\x48\xA9\x9F\xCB\x29\xCC\x83\x91\x62"
-    "\xE7\xF4\x42\x94\x8B\x46\x81\x69\x67\x06\xA5\xEC\xB3\xE9\x38\xC3"
-    "\x98\x30\x0A\xDC\xF3\xF3\x9E\xE6\x9A\x23\x6E\x32\x4F\x3F\x34\x84"
-    "\x4F\x12\xDA\x9C\x5E\x98\x16\x75\x89\xAE\x71\x1D\xF4\x16\x82\xD6"
-    "\x35\x6F\x92\x28\xFC\x94\x11\x14\x73\x3A\xD0\xBE\x09\x8D\x51\xAD"
-    "\xC2\xF8\x61\x06\x78\x56\x3D\xF0\xA1\xE8\xBD\x98\x17\x11\x7C\x68"
-    "\xA9\x36\xCD\x4C\x99\x01\x9B\x63\x7D\x7D\x5E\x45\xB0\xC2\x9C\x5B"
-    "\x10\xEC\x46\x58\x15\x95\xCA\xEC\xEF\x20\x55\xED\x96\x63\xC0\x76"
-    "\x17\x4E\xA0\x31\x85\xD3\x25\x54\xE3\xAC\xBB\x71\x02\x9D\xFF\xAF"
-    "\x58\xC6\xDA\x4E\x98\xFE\x01\xEF\x14\x3A\xB5\xA0\xEA\xA6\xF1\x46"
-    "\xF1\x29\xFA\x52\xED\xF6\x91\xF6\xE5\xE3\x8D\xE3\x04\x3A\xBF\x99"
-    "\x95\x8B\x14\xBA\x63\x78\x87\xBB\x1A\xEF\x0B\x5C\xA8\x50\x5C\xCF"
-    "\x51\x75\xD1\x87\xD2\x1B\xC1\xFA\xA1\x3A\x42\x6F\xE9\xA5\xCC\x70"
-    "\xC2\x1F\x0C\xED\x79\xFA\xFD\x9E\x50\xA4\xEE\x4E\x45\x54\x43\x0C"
-    "\xF5\x14\xA3\x14\x02\xFF\xF4\x07\xBD\xFB\x54\x0F\xDD\xF0\x29\x0E"
-    "\x3D\xFD\xD4\x19\x3A\xF2\xA1\x91\x7D\x0F\x92\x84\xCD\x03\x0C\x9E"
-    "\xE9\xCE\xF1\xE0\xEC\x33\x79\xB0\xE9\x8E\xDD\x74\x39\x0C\x26\x26"
-    "\x77\xF7\x55\xFD\x31\xCA\xCC\xEC\x15\xC9\xF7\xBE\xC9\x66\x9C\xCA"
-    "\x01\x1A\xCA\xE7\x26\xB3\x5C\x88\xF2\x87\xCA\xC0\x7B\xA5\x2C\x50"
-    "\x67\x96\x1A\xDA\xD9\x5D\xA6\xD5\x13\x94\x91\xCE\xB2\xA8\x05\x7A"
-    "\xFC\x28\xDC\x78\x61\x04\x1B\xB2\x5C\xF8\x0D\x0B\xE3\xDB\x3D\xBB"
-    "\xA6\xB3\x1E\x67\x91\x34\x1B\x0F\xDF\xD7\xED\xB9\x26\x75\x04\x19"
-    "\x7D\x40\x7C\x29\xDF\x82\x42\x0B\xF6\xE9\xBC\x92\xF8\x30\xDF\xB5"
-    "\xAE\xC7\xA7\xF1\x29\x2F\xC6\x98\x4A\xA4\x51\x85\xF5\x4A\x22\xD5"
-    "\x23\x8C\x18\x58\x16\xBC\x29\xAE\x1F\x71\x62\x51\x5E\xB6\xC2\xB3"
-    "\x2A\x5C\x8F\xFE\x20\xD6\xA3\x7D\x1A\x13\x6F\x8D\xE6\xBB\x6C\xCA"
-    "\xD8\x6F\xCB\xC3\x0B\xCB\xEE\x68\x5B\x4C\x43\x68\x4F\xF1\x82\x90"
-    "\xAD\xE6\xEC\x9D\xA0\x66\xA9\x6A\x0C\x62\x56\x11\x78\x96\x69\xE7"
-    "\xC1\xC8\x52\xAB\xF0\x88\xF5\xBA\x06\xB4\x84\x22\x33\xA4\x1C\x8C"
-    "\x3C\x8E\x73\xAA\x1A\x4B\x78\xD2\x09\xD4\x2A\x69\x39\x25\xD4\x87"
-    "\x36\xE0\x5D\x3A\x11\x02\xED\x2D\x1A\xEC\x92\x99\x07\x94\x3A\xA8"
-    "\x60\x60\x0B\x44\x89\xB6\xB2\xAA\xC4\x2C\xA7\x4A\xC4\x28\x93\xA6"
-    "\x9A\x84\x7D\x74\xA4\x64\xF6\x70\x05\x3B\xE2\x24\x73\xB3\x2A\x07"
-    "\x62\x55\x1C\x8C\xB7\x06\x75\x66\x72\x1F\x13\x6A\x97\x3D\xDE\xAA"
-    "\x25\x49\x55\x31\x9B\x2A\x3C\x13\xB0\xB0\xDE\x16\x33\xB6\x8E\xCE"
-    "\x54\x21\x28\xF3\x1C\xEC\xDE\x7C\x26\x00\xFC\x2A\x50\xD1\x21\xAD"
-    "\x0F\xFE\xA4\x46\xAC\x43\xAD\xB7\x0A\xA7\x19\x0D\x0C\xB7\x5C\xF3"
-    "\x24\x86\xED\xBB\xF2\x7D\x71\x75\x8C\xD9\x0C\x7D\xB5\x9C\x70\xCC"
-    "\xC1\x0E\xCA\xF6\x8A\xFD\xA4\x0D\x1B\x1F\xDD\x46\xFD\xE4\x58\x47"
-    "\x3E\xA6\xDB\xEE\x27\x35\x21\xDD\x50\x3F\x29\x6C\x37\xD2\x4F\xD3"
-    "\x45\xAE\x35\x2C\x6E\x9A\xCA\x85\xE3\xA1\x90\x09\x9C\x6D\xD0\x56"
-    "\xE3\xB5\x8A\x6F\x05\xE0\xC7\x99\x9C\x46\xD9\x40\x14\x1E\xB8\x3F"
-    "\x91\x6E\x78\x64\x4A\x3E\xC0\xFE\xDB\x55\xFF\x80\xCA\xFA\x42\xBC"
-    "\x73\x27\x79\x37\xCA\xED\x50\xF0\xE2\x6A\xF4\xA9\xC2\x03\xF7\xE7"
-    "\x15\xE8\x53\x25\xB7\xFD\xA4\x6E\x76\x3E\xA1\x05\xFE\x30\xDC\xBE"
-    "\x35\xAA\xED\xC0\xA5\x10\xA7\x22\x92\x6F\x3C\xBB\xCC\x20\xF2\xBC"
-    "\xA2\xF6\x89\x9B\xE2\xEA\x18\x8C\x33\x67\xA5\x10\xBA\x4A\x7D\xB0"
-    "\xFD\x46\x63\x79\x9B\xED\x39\x08\x76\x1E\x38\xFE\x04\xD9\x2C\xD5"
-    "\x2B\xD1\x24\x5F\x89\x6A\x95\x08\xD8\x63\x43\x29\xA4\x0C\xBF\x39"
-    "\x66\xFA\xD5\x8D\x1E\x07\xFB\x15\xB0\x63\xB1\x6E\xE4\x28\x06\x57"
-    "\x40\x4E\x62\xD8\x8E\x1C\x64\x6C\x53\xC4\x50\xA4\x1B\xE9\x95\xB8"
-    "\xAD\xCB\x75\xA3\xBF\x0A\xB7\x55\xB1\x6E\xE4\x57\xE1\xB6\x1E\xF4"
-    "\x2E\x72\x34\xF5\x75\x21\x5E\xE2\x47\x6F\x16\x51\xDD\xD5\x05\x02"
-    "\x75\xF4\xC0\xF2\x1A\x17\x95\x6D\x38\xDA\x01\x94\x4C\xB6\x62\x08"
-    "\x01\x5C\x56\xB6\x5C\xE0\xD1\x99\xAF\xDC\x67\x57\xCB\xFD\x18\xCE"
-    "\xA2\xD0\x0F\x2A\xF2\x79\xDA\x89\x47\x0D\x35\xCF\x5B\xEA\xF3\xBD"
-    "\x17\x1A\x28\x10\x41\x63\xFB\xA6\x05\x89\x54\x56\x71\x52\xFA\xE1"
-    "\xD0\x43\x29\xC1\x16\xD5\x83\xDD\x84\x20\x60\x9C\x8E\x7E\x28\x14"
-    "\xA0\x4F\x86\xB4\x02\xC6\x52\x5C\xF6\x43\x30\x35\xB4\x12\x60\x1B"
-    "\xA4\x96\x6E\xB9\xD4\x44\xA4\xA3\x0F\x4E\xA8\x6E\x70\x8D\xC9\xC0"
-    "\xDB\xFE\xDE\x54\xD8\x63\x17\x94\xC4\x84\x39\x72\xCB\x49\x4C\x58"
-    "\x5B\xC0\x92\x8A\x22\x2E\x6D\x1D\x84\xC5\x35\x46\x5C\x60\x52\xA8"
-    "\x1C\x91\x90\x5D\x95\x96\x08\x09\x75\x25\x89\x08\xEE\x36\x0A\x74"
-    "\xFE\xDD\xBB\x4E\x1F\x39\x68\xAC\x7F\x45\x5D\x2F\x34\x53\xB7\x14"
-    "\x98\xC5\x86\xCA\xD3\x99\x51\x2A\x6F\xC7\x77\x13\xBB\x37\xC6\xA5"
-    "\xAD\xE5\xD6\x97\x6B\x5D\xAE\x42\x59\x9B\xF0\x1D\x13\x49\x07\x99"
-    "\x68\xCF\xD9\x0F\x38\x74\x4A\xD1\x81\xA0\xD6\x24\x3D\x78\x74\xBC"
-    "\x36\x17\x2A\x64\x47\x2B\x42\x7A\x82\xC9\x29\xDE\x9B\x70\x77\x7B"
-    "\x4F\xA8\xE6\x55\x80\x27\x7A\xF1\xC9\x40\x11\x65\x5C\x1E\x83\xE8"
-    "\x25\x09\x9D\xE5\xF1\xEC\x46\x3B\x8A\x64\x76\x12\x97\x6F\x74\x34"
-    "\x9F\xDA\x55\xAD\x96\x80\xE6\x7D\x51\x07\x25\x54\x5A\xF1\xF0\x0A"
-    "\x9B\x48\x63\x0E\xAB\xB9\x72\xDF\x3D\xD2\x4F\xA9\x50\xA4\x81\x5D"
-    "\x68\xBD\x36\x5A\xCC\x8F\xC5\x8B\x18\x72\x2F\x3F\xA4\xDE\xDD\x35"
-    "\xC2\x1F\xEB\x75\x07\x20\x42\x13\xCB\x97\x25\x03\x60\x1F\xF1\xD9"
-    "\xB9\xD6\xA4\x1E\x58\xB7\xA3\xF4\x62\x75\x3B\x00\x1D\x75\xAB\xE9"
-    "\x6C\x93\xBA\x8D\x26\x4D\xD5\x6D\x00\x7A\xD4\x0D\xB0\xA9\xBA\x53"
-    "\x0D\xA7\x79\x33\xDD\x6C\x7C\xDD\xAF\xD1\x08\xB9\x61\xC3\xDB\xEA"
-    "\x56\xAF\xFB\x35\xBA\xAD\xEE\xB4\xFA\xF7\x75\x5F\x8B\x55\x90\x06"
-    "\xBD\x94\x8E\x44\x15\x0F\x46\x1E\x24\xE9\xF4\xC1\x14\x57\xE9\xBB"
-    "\x68\x50\xBA\x67\x1F\xE7\x32\x9F\x6B\x5D\x9A\xD3\xAD\x9D\xE3\xF7"
-    "\xCE\xE0\x41\xB3\x4D\x74\xA0\xB9\x28\x21\x72\x31\xCF\x8D\x28\xB5"
-    "\x36\xCC\xBF\xA1\x5E\x8B\x92\xF5\xF1\x54\x5B\x67\xF5\xB7\xAB\xDD"
-    "\x7A\x55\x7F\x4B\x0A\xAE\x6F\xD3\x6F\x49\xC7\xF5\x6D\xFA\x55\xD5"
-    "\x9C\xA3\x0D\x5A\xB5\x9C\x07\xE9\x9B\x74\x74\xC3\x55\xA0\xDD\xF0"
-    "\xD3\x7A\x53\x94\x56\x70\x57\x35\x9F\xAF\x7A\xB7\x21\x85\xBC\xA5"
-    "\x2F\x91\x8A\xDE\x00\xD5\x75\x01\x54\xE2\x36\x25\xBA\xE0\xE9\x36"
-    "\xEE\x77\xEA\xBA\xDE\xA9\xED\x76\xA7\x6B\xD2\xD3\x79\xC9\x56\xE7"
-    "\x1D\x5B\x7D\xAE\x87\x52\x37\xDF\xB8\x11\x8F\x82\xE0\xC3\x62\x4E"
-    "\x65\xC5\x4E\x3E\x23\x0B\x5D\xCA\x2D\x77\x8D\x69\x11\xE4\x28\x83"
-    "\x3A\xDC\x40\xC4\xED\x41\xA6\x44\x47\x41\x4B\x0C\xF6\x42\x21\x33"
-    "\x59\x47\xAF\x13\x6A\xB9\x1B\x28\x3D\xAF\xB6\x5F\x0C\x94\x1C\x3C"
-    "\x89\xBB\x8E\x3C\x46\x4A\x4E\xC7\xC2\x01\x82\x23\x4C\x66\x13\x39"
-    "\x11\xEA\x2C\xDB\xC5\xFB\x00\x2A\x54\xDB\xE2\x0A\x02\x58\x5D\x95"
-    "\x93\x08\x97\xD3\x9F\x60\xE3\x61\x94\xBD\x91\x5E\xFB\x91\xE3\x55"
-    "\x7E\x0B\x6F\xDF\x4A\x9A\x5C\xFF\x69\x1D\x77\xB4\x8F\x74\x5E\x26"
-    "\x8A\xDA\xD4\x01\xAB\x30\xC4\xB2\xFF\x92\x6F\xDE\xEC\xBE\xCD\xF6"
-    "\xB2\x5D\x29\x8D\x2D\xD8\x8D\x63\x39\x85\xFD\x0B\x0F\xFB\x03\x8D"
-    "\xDD\xA2\x97\xEA\xD8\x0A\x13\x47\x49\x48\x32\xA4\x82\x4F\xC0\x05"
-    "\xF2\x91\x1A\x48\xB1\x51\xE9\x6E\x8A\x83\xFC\xEA\x2B\x34\x72\xB4"
-    "\x71\x4F\xF4\x20\x11\xF7\xC3\x28\x50\x80\x9B\x17\x9C\xE2\x40\x5D"
-    "\x7E\x48\x99\x10\x56\xA5\x0D\xEB\x09\xAB\xF0\x48\x7B\x5E\xCC\x57"
-    "\xAE\xF1\xA4\xAE\x00\x49\xAB\x05\x06\xC3\x23\xF8\x89\x72\xE9\x96"
-    "\xE5\xEF\xF3\x72\x46\x09\xEF\x68\xCF\x9E\x2F\x0A\xE1\x59\x56\x25"
-    "\x6C\x59\x16\xEA\xDC\x02\x27\xA6\xAA\x29\x48\xA0\x8E\x61\xD4\xF9"
-    "\xF3\xA8\x56\xDA\x18\x53\xDF\x49\x7A\xB9\xB4\x6B\x97\xD9\xFD\xC5"
-    "\x41\xD8\x48\x37\x30\x73\xAC\x70\x71\x41\x62\x52\x62\xE7\x72\x30"
-    "\xCA\xBC\x4A\xFA\x61\x46\x3F\x5C\x0A\xA7\x16\x6D\xE1\xD7\xEB\x8B"
-    "\xF6\x11\xEA\xDC\x14\x5E\xDA\x2D\x19\x49\x73\x2C\xD2\xD9\x52\xDC"
-    "\x15\x52\x67\x22\x08\xC4\xC2\xE7\xB7\xB1\x33\xED\x7E\xE9\x60\x64"
-    "\x3B\xEA\xD7\x5F\x6F\x86\xF7\x8C\xD6\xAB\xF0\x9A\xBC\x17\x6A\x45"
-    "\xB8\x4B\xAF\xCF\x7B\xBD\x53\x35\x92\xB6\x68\x82\xF7\x5A\x25\xC5"
-    "\x78\xAF\x74\x4D\xAB\xB2\x21\x86\xF1\x9C\xFB\x44\x27\x32\xF8\x9D"
-    "\xE8\x1E\xCA\xE2\x61\xAE\x79\x74\xD4\x3B\xE5\x5E\x85\xFA\xCC\xB6"
-    "\x33\x45\x16\x71\x92\xF4\xC0\xDE\x77\x5A\x17\x77\x5D\x46\x1E\xA9"
-    "\x1B\xA3\x28\xEA\x88\xB5\x8B\x3A\x81\x7D\xB4\x2A\x67\x2A\xD4\xDB"
-    "\x8D\x46\x6A\x41\x77\x48\xC8\xB4\xD8\xBB\x04\x85\x8B\x61\xD6\x55"
-    "\x1C\xFC\xE6\xEF\xE0\x63\x4E\xEB\xD2\xDB\x73\x57\x8D\x4F\x21\xD2"
-    "\xC7\x8C\xFA\xA0\x32\xDB\xF7\x21\xB2\x43\x95\xF4\x93\xE8\xD2\x73"
-    "\x27\x1A\xBA\x0A\xBF\x3E\x04\x1E\x39\xDD\x8F\xBD\xE0\x14\xFB\x2A"
-    "\x4C\xBF\xA1\x3F\xB1\x73\x16\xB2\x6C\xD7\xD9\x0A\xDB\x6E\xD5\x6B"
-    "\x07\x36\xCB\x0E\x4F\x16\x8A\xF1\xC3\x01\x03\xC4\xDA\xAA\x3F\x0C"
-    "\x31\x6E\x78\x17\x84\xC8\x48\x1E\xCB\x10\xF0\x2A\x95\x9C\xE6\x4C"
-    "\x6B\x11\x47\x18\xC6\x94\xF1\x60\xFA\xE8\x14\x44\x6C\x58\xF9\x29"
-    "\x9C\xE5\x27\x9E\xEE\xDB\x45\x16\x64\x85\x1D\xE8\x1C\xB0\xD1\x3C"
-    "\xD9\x6D\x79\xB9\x53\x88\x31\xAD\xAD\x83\x35\x44\x1B\x3C\xE9\x95"
-    "\x18\xCE\x5F\x41\xB8\x57\xA6\xB6\xAA\x34\x6B\x71\xFC\x13\xEB\x35"
-    "\x1B\x9F\x13\x73\xF6\x75\xAA\xB4\x8E\x38\x20\x67\xE8\xC7\x42\x81"
-    "\xE2\xFD\xAE\xE5\x5A\x97\x88\x27\xF2\x50\x9C\xA0\x78\x30\x1B\x56"
-    "\x6A\x68\x69\xB9\x7E\xBD\xCD\x86\xA7\xE0\xCE\xC1\x28\x2A\x9D\xED"
-    "\x11\x4B\x71\xEC\x41\xE4\x12\xC6\x9E\xB6\x84\x2D\xE9\xCF\x6E\x84"
-    "\x4B\x37\x25\xD1\xE2\x48\xF1\x13\x16\x69\x75\x59\x83\x39\x1E\xB2"
-    "\x55\x9B\x7D\x3A\x6D\xF2\x72\x36\xC3\xB5\x63\x1E\x27\x8F\xD2\xDF"
-    "\xBB\xB4\x21\xF2\xD0\x29\x91\xD7\xFA\x30\x00\x9F\x89\x8E\x00\x30"
-    "\x5D\xE6\x85\x3E\xDD\xAE\xA2\x1B\xF7\x4D\x92\x50\x6D\xC2\x89\xD4"
-    "\xA0\xF3\x4A\x0D\x08\xFF\x60\x65\xCC\x38\xF4\x06\xAF\x43\x57\xEF"
-    "\xB1\x5C\x04\x6C\x04\x0E\xAA\x89\x81\x12\x51\x45\x8A\xF5\x1A\x9F"
-    "\x56\x24\xAF\x36\x40\x7B\xDA\x1C\xF5\x47\x36\x3A\x4C\xB3\xDA\x55"
-    "\x86\x68\x7D\x88\x49\xFB\x58\x19\xCF\x86\x53\xBD\x29\xF8\x1B\xCE"
-    "\xF3\xBF\x90\xEA\xFA\xEC\x43\x79\xD9\x72\xDF\x86\x3F\xD5\xFF\xDB"
-    "\xCC\xF0\xDD\x74\xC6\x27\x8D\xB4\x38\x39\x43\x3B\x66\x43\xF4\x4E"
-    "\x25\x2B\x80\x5B\x0D\x06\x9E\xA2\x1E\x05\x9E\xB5\xDB\x75\xCA\xB9"
-    "\xAA\xC9\x18\x0C\x85\x3D\xB3\x48\x67\x70\xE8\x50\xC6\xBC\x38\x8F"
-    "\x25\x77\x4A\xBB\x36\x4E\x2C\x91\x21\xE5\xFB\x1E\xB0\x5E\x5B\xE8"
-    "\x42\xE8\x18\x1C\x9E\xE0\x95\x02\x27\xE3\x52\x6E\x61\xF8\x2B\x88"
-    "\x68\x01\x2F\xEF\x9D\x3D\xAE\x9D\x28\x20\x9C\x6F\x7D\xFC\x83\xCE"
-    "\x2A\x67\xC4\xB4\xF7\x70\xFC\x79\x2B\x9A\x91\x6E\x45\xFF\xA2\x64"
-    "\x11\xF0\x61\xFE\x74\x37\xC2\x84\x3B\x9D\x61\x2A\x8D\xBA\x50\xE7"
-    "\x82\x74\x00\x0D\x46\xC6\x5B\x1F\x16\x25\x01\xF0\x6C\xC7\x69\x35"
-    "\xDF\x52\xF9\x3C\x31\xC5\xAD\x31\xAB\xF4\x8C\x6F\xB3\x47\xC2\xEB"
-    "\x71\x8C\x80\xF2\xB8\x73\x61\xE5\xCD\x0C\x74\x4D\x14\x92\x49\xB9"
-    "\xDD\x8D\x93\xDD\x21\x13\x26\xEA\x79\x91\x95\xD6\x19\xEF\x63\x30"
-    "\xF6\x1C\xEF\x46\xD0\xE5\x5F\x95\xCA\x0B\xAE\x5C\x73\xED\x4D\x88"
-    "\x10\x76\xAD\xD0\x75\x8B\xE0\x34\x57\xE6\x0D\xE1\xB0\x69\xF2\xC5"
-    "\x75\xA5\x1A\x81\xBA\xA6\xC6\xB5\x1D\xF1\x91\x5E\xD1\xEA\x14\x8F"
-    "\xB6\x00\xC1\xB8\xD5\xE2\xBD\xC0\xA2\xD2\xD8\x7C\x95\x92\x33\xD3"
-    "\x12\x73\x26\x0A\x1D\xDB\xC1\x80\xEA\x42\x23\xCC\xE3\x4C\x39\xC7"
-    "\x37\x2C\xCD\x9E\xC9\x98\x69\xDB\xD3\x69\xBF\x3B\xDE\xB4\x30\x3B"
-    "\xE4\xAE\x50\x2A\x5D\xA5\xBC\x4C\x29\x32\xD3\xF5\xE8\x85\x1D\x3F"
-    "\xE3\x67\x1F\x96\xFB\x64\x6C\xCE\xE8\x2B\x33\x79\x73\x06\x5F\x89"
-    "\xB9\x66\x5B\xCB\x5F\xA5\xFC\x8C\x23\x3D\x8F\x1E\x4A\x1C\xC5\x26"
-    "\x38\x78\x7B\x5C\x9E\x64\x3F\x3E\x6D\x59\x9F\x70\x58\x5D\x62\x9D"
-    "\x10\x46\x94\xC4\x32\x90\xD8\xD9\xD5\x9D\x51\xD3\x31\x8E\x69\x8B"
-    "\xA0\x7B\xB6\xF0\x46\x31\x9A\x07\xFE\x08\xEE\x23\x46\xBA\xAC\x3B"
-    "\x3B\x2A\xC6\x77\x71\x81\x42\x14\x86\xC4\x3A\xC7\x86\x89\xF0\x8B"
-    "\x80\xC6\x9A\x6B\xEE\xAE\xAC\xED\xD9\x47\x98\x1A\x6A\xCA\xB9\xB1"
-    "\x9D\x0E\x96\x61\x38\x66\x99\xF9\xA3\xED\x6A\xCD\xE2\x30\x2F\x65"
-    "\x66\xEE\x1A\x34\x29\xF8\xC3\xD3\xA2\x2A\xA7\x15\x4C\x3F\x47\x85"
-    "\x09\x65\xB8\xE7\xD4\x6A\xF6\x7E\x80\x8F\x02\x0B\x5A\xE3\xD7\x16"
-    "\x2B\x19\x4B\x14\x97\x2C\xCF\x53\x44\x69\xB4\x56\x4B\x4C\x5B\x01"
-    "\xF6\x5A\xAC\x3D\x0E\xE9\xB2\x74\xB4\x15\xDA\xD7\x14\x9D\xED\x37"
-    "\xD5\x60\x9B\x6A\xAF\xAE\x51\x90\x16\xC4\x20\x06\xAB\x4D\x16\x1D"
-    "\x26\xB7\x88\xA3\x5F\x8F\x8D\xB0\x0A\xB1\x47\x6D\x6B\x6F\xF4\xAB"
-    "\x5B\x06\x9C\x2E\xC8\x31\x17\xEC\x6C\x06\xF6\x1B\x46\x2F\x63\x7A"
-    "\xE5\xE9\x32\x3F\x8F\xA1\x75\x6E\x4A\x0C\x29\xFA\xEC\x03\xB7\xA4"
-    "\xC9\x97\x60\xAA\xF0\xAA\xE7\x72\xFB\x97\xCD\xF4\x07\x5D\x64\xFA"
-    "\x54\x73\xCF\xC1\xB5\x7D\xBD\x7E\x72\x43\xC4\x7E\x0B\xFE\x75\x4F"
-    "\x8B\x3D\x5A\x9F\x68\x99\x8D\x3E\xFB\xBD\xB5\x8C\x67\xE1\xAB\xB7"
-    "\xCC\x8D\x6D\xFB\xBD\xB5\xCE\xEE\x12\x3B\x0D\xA3\x50\x9E\xA2\x65"
-    "\x34\x87\x61\x73\xBF\xB7\x96\xD9\x3D\xD8\xEE\x96\xC9\x69\x93\x1C"
-    "\x78\x98\x01\xDF\x73\xDC\x6A\x7F\x5E\x72\x8A\x52\xEE\x12\xED\x80"
-    "\x4D\xCD\x54\x11\x9F\x9E\x64\x9A\x97\xFA\x69\x4C\xE0\xBC\x34\xF1"
-    "\x0A\x25\xFA\x46\x6D\xF2\x35\x5E\x8E\x3A\x3A\xBB\xE7\x3F\xC4\x4F"
-    "\xE4\x6A\x18\xFD\x2A\x1E\x0C\x55\xCD\x55\x46\x18\x1D\xB1\x3C\xCA"
-    "\xFC\xFB\x84\x6B\xE8\x5F\xBC\x09\x55\x01\x04\xA9\xEA\x70\xA9\x1D"
-    "\xC6\x1B\x87\xEE\xFA\xB8\xA3\x2B\x66\x13\x11\x05\x71\x37\x5C\x2A"
-    "\x97\xF8\x65\x9A\x26\x27\x52\x79\x73\xB2\x9C\xE9\xF1\xDA\x94\xA9"
-    "\xAB\xB5\xFA\x92\xE1\x5C\x32\xFB\xE3\x9C\xBD\x1B\x53\x73\xAC\xA7"
-    "\x4C\x24\xEE\x69\x77\x0C\x3A\x92\x60\x43\xFF\xE8\x22\xED\x89\xBA"
-    "\xBF\x24\x92\xDA\x06\xA3\x06\x23\xB7\xB5\x9A\xA0\x53\x7D\x6D\xAB"
-    "\x79\xE0\xDD\xDF\xEA\x02\x8A\xDF\xCE\xCD\xAA\x12\x4A\xFC\x12\x30"
-    "\xF6\xE4\x21\x80\xD8\x1F\x02\xC2\x9E\x44\x03\x08\xFB\xC3\xA9\x47"
-    "\x1E\x35\xA3\xAA\xE4\x03\x49\xB9\x0A\x7E\x45\xA2\xD5\x57\x79\x8F"
-    "\xAB\x0A\x45\xC5\x7B\x5C\xD5\xD7\xA0\x16\x15\x18\x6A\x2A\x51\xBF"
-    "\x05\x9C\x0D\x4C\x03\x20\xFB\xC3\xBD\x11\x56\xC6\xFA\xF1\xC5\xB0"
-    "\xF2\x89\x0B\xAB\xA6\x2A\x06\x53\x3F\xA2\x10\xBC\xC0\xDC\xF3\x0F"
-    "\xE6\x47\x61\x49\x01\xEF\x79\x87\xEC\xA3\x90\x74\xF6\x7A\xCF\x3B"
-    "\x31\x1F\x42\xE2\x64\xBC\x27\x82\x14\xA3\x10\x1E\x85\x6E\x7E\x28"
-    "\x0F\xD6\xA5\xD0\xC9\xFC\xE4\x41\xBA\x14\x3A\xB9\xA4\x08\xD2\xA8"
-    "\x45\x00\x32\xDF\x63\xD9\x0A\x39\x94\x16\xD7\xE2\x3C\x48\xBE\xAD"
-    "\x9A\xEA\xDB\x2A\x9F\x3D\xAF\xA6\x78\x29\x6C\x66\x2E\x68\x30\xCE"
-    "\x6C\x86\xFB\xFE\xC5\xEB\xC3\x97\x3F\x7E\xFF\xFD\xD3\xEF\xBF\xC5"
-    "\x7B\xD3\xC5\xCF\xC1\xBE\x00\x7B\xF5\xFA\xE1\xCB\xD7\x0A\x46\x7F"
-    "\x77\x00\x04\x8E\x58\xF9\x87\x8F\xFE\xF2\xF4\xC9\x4F\x4F\x1E\xE3"
-    "\x7B\xFD\x7D\xE0\x66\xD8\x50\x1A\x49\x13\x2C\x15\x3F\x4E\xC4\x7B"
-    "\x92\xD4\x11\x67\xFE\xC9\xEB\xD5\x52\xAF\x8C\x68\xDB\x48\x5D\xE9"
-    "\x59\x2F\x70\xF7\x1D\x6F\x37\x03\x2E\x2C\xED\x72\xFE\xC2\x49\x0A"
-    "\xC3\x9F\x04\xA2\x9C\x6F\x44\xF4\x30\xD9\x64\x1C\xEB\x38\x2A\x86"
-    "\x17\xB9\xA5\x16\xCB\x0A\x93\x2F\x96\xF9\x0C\x16\x7F\xA5\x8D\x12"
-    "\x58\x54\xE5\xBC\xF9\xA6\x5A\x9E\xE7\xCB\x29\x26\x56\xF9\xDF\x7F"
-    "\xA2\x36\xD1\x63\xA4\x00\x9F\x63\x2A\xE7\xE3\x65\xAE\x26\xC8\x63"
-    "\x5C\x75\x17\xB3\x23\x98\x52\x0C\x96\x06\x74\xF2\x12\x43\xF8\xDD"
-    "\xF4\x46\x01\x15\x94\xFC\x66\x29\x69\xD0\x99\x61\xE9\xC4\xE9\x99"
-    "\xE2\xF9\x87\xF1\x78\xEC\xF4\xC3\x65\x24\xC9\xC8\xF0\x5D\xB1\x76"
-    "\x6D\x80\xA1\x53\x66\x7C\x9A\xD7\x2F\xCE\xE7\x3F\x40\xC3\xC1\x64"
-    "\x58\x13\xB8\x3F\x57\xEB\xA3\x00\x54\xF1\x1B\x80\x78\xEB\xDB\x07"
-    "\x02\xCA\x3B\x3F\x7C\xE9\x52\x54\x33\x45\x2A\x84\xF7\xBA\x84\x09"
-    "\x8A\x80\x1F\x9E\x1D\x79\x19\xAB\x9F\x56\xEA\xEE\x0E\x51\x1B\x3B"
-    "\x19\x83\xD7\x04\x8E\x02\x8E\x1C\x95\x20\x4C\x63\xCE\xB6\x9A\x6A"
-    "\x3D\xC7\x10\x13\x4C\x48\xC5\x58\x67\x10\x16\x19\x5B\x45\x05\xE9"
-    "\xB3\x04\x17\x2D\xF4\x5C\xA4\x48\xF9\xAB\xBD\xDC\x58\x90\x80\x69"
-    "\x6C\x2F\x36\xA8\x7A\xDD\x52\xF5\x3A\x55\xF5\xDF\x86\xEB\x48\xD5"
-    "\x6B\xA8\x7A\xBD\x41\xD5\x66\x3C\xB5\x90\x60\x60\x52\xA4\xBC\x36"
-    "\x48\x0C\x68\x84\x34\xF3\x8E\x2E\xC4\x73\x50\xF6\x22\x55\x2A\x90"
-    "\x16\x6A\x25\x58\x8A\xE0\x1F\x24\x2A\x59\x20\x42\xB6\x7C\x0D\x94"
-    "\x87\xE8\xDB\x88\x97\x2B\xA2\x8A\xB3\x5C\x91\x4E\x53\xEB\xB7\xA6"
-    "\xCA\x38\x6F\x64\x7C\x91\xD3\x54\x2F\xE8\x6D\xAC\xB5\xEE\x28\x1E"
-    "\x10\x3E\xB6\x03\x71\x64\xB9\xE1\x41\x03\x34\x5B\x2E\x82\xA7\x6B"
-    "\x78\xBA\x0E\x9E\xCA\x06\x02\x80\xCB\x75\x0F\xD6\x74\x23\x00\x0A"
-    "\x49\xB2\x50\x76\xFC\xB7\x9A\xB3\xA0\x64\xD9\x26\x90\xE6\x1F\x3D"
-    "\xAB\x9D\x67\xA4\x7A\xE0\x29\xFD\x75\x8C\x5C\xD1\x7A\x17\xC7\x2B"
-    "\xFD\x4A\x7D\x15\x6F\x89\x2B\x2E\xF4\x5F\x19\xF2\xAF\xE2\x29\x71"
-    "\xC9\x85\xFA\x1B\x43\xFD\x4D\x3C\x6D\xE1\x9A\x5B\xF6\x07\x17\xD0"
-    "\x7B\x22\x60\xA3\xBC\x75\x71\xBD\x16\x20\xF2\xA7\x83\x85\x45\x88"
-    "\x90\xF0\xD7\x91\x18\x14\x8E\xDC\xDE\xB9\xDC\xC6\x65\xEB\x6F\x94"
-    "\xA8\xF9\x27\xBE\xEF\x1A\xE4\x3E\x52\xF4\xBD\x79\x79\x03\x89\x9E"
-    "\x45\x03\x63\x59\xCD\x6C\x43\xF1\xAD\x2E\x6E\x6D\x0B\x0F\x07\x8D"
-    "\x67\xBE\x86\xD9\x94\xE4\xED\x1D\x95\x55\x5A\x5D\x29\x8E\xC9\x52"
-    "\x84\x81\x82\x36\x17\x9A\xAC\x19\xDA\xAC\x19\xF9\x3E\x8A\xA6\x40"
-    "\xD3\xCD\xBD\x35\xFC\xDE\x65\xB6\xAC\x40\x71\x3C\xAA\xCE\xCE\x30"
-    "\x04\xEA\x4E\x10\xC4\xF6\x48\x9F\xA1\x8B\xBC\xFB\xEB\xD3\xF9\x62"
-    "\xD5\x44\x5E\xFC\x2D\xF5\xC2\x08\x51\x0A\x40\x49\x2A\x49\x2D\xDF"
-    "\x4D\x1A\xC2\xBC\x78\xC7\xA9\xC9\x63\xD4\xD2\xF9\x4B\xFB\x5A\x66"
-    "\xC2\x55\x16\x7C\x2C\x15\xAE\xE4\x81\xCA\x10\x27\x9B\x6E\x1F\x71"
-    "\x8B\xED\xEF\xBF\x79\xBF\xDD\xF6\xD9\xE7\x41\xB3\x46\xE6\xB6\xEF"
-    "\xB8\x94\xE8\x60\x9D\x5A\x63\xD0\x8D\x36\x49\x70\x65\x53\xFD\x2C"
-    "\xB8\x32\x01\xCC\xB6\xA9\x49\x24\x5B\x57\x89\x48\x54\x9A\x8D\x13"
-    "\x60\xCD\x8E\x72\xFD\x29\x24\xF5\x1D\xB9\xAA\x51\x46\x97\x4E\x5E"
-    "\x6B\x75\xEB\x85\x4E\xE1\xE8\x7D\xF0\xC4\x21\xF0\x7A\xAB\xCE\x2E"
-    "\x40\x5B\xD5\x25\xDD\xEC\x6A\x0A\xD1\x60\x34\x39\x1B\x65\x21\x8A"
-    "\x6A\xBC\xE0\xA0\x09\x1A\x95\x2A\xA3\xA8\xB3\x4E\x68\xAF\x70\x6D"
-    "\x2A\x14\xAB\x8B\xB0\x46\x5D\x59\x79\x0C\x25\xD2\xF5\xC9\x15\xC1"
-    "\xD8\xCD\x80\x49\xF7\xDA\x59\x80\xB0\x88\x57\xA9\xA8\xD1\x1A\x2B"
-    "\xE9\x9A\x63\x2B\x1A\x55\xB3\x5E\xCF\xF0\xEA\xA6\x73\x55\x23\x31"
-    "\xE9\xC4\x93\x6A\x7D\xD4\x0F\xD3\x88\x13\x4E\x4E\x97\xF9\x89\x97"
-    "\x20\xB3\x7A\xF7\x64\x4E\x21\x6B\x5E\x6F\xEA\xB6\x62\x00\xED\x3B"
-    "\x7D\x07\x1B\x5E\x80\x73\x54\x64\x93\x59\x89\xCE\x5D\x67\xD9\x84"
-    "\x8B\xAC\x02\x47\xB2\x71\x3E\x9B\x1C\xB9\x44\x85\x5C\xD8\x6A\x13"
-    "\xDC\x4D\xA1\x2C\x45\x54\x79\xC9\x68\x2D\x56\xAF\xE7\x13\xBD\x06"
-    "\xE6\x60\x35\x41\x1E\x0C\x83\x1A\xAF\x20\xA2\x6B\xC8\x09\x48\x9D"
-    "\xE5\x54\xB7\xEC\x92\x5E\x10\x0B\x3B\x73\xA0\x38\x9E\xB8\xED\xF0"
-    "\x82\xD5\x5A\xFC\xE5\xBA\xED\x65\xE3\x2A\xC6\x38\x50\xA5\x15\x5F"
-    "\xFC\xF5\x44\x2A\xBF\x30\x05\x94\xB3\x34\xF5\x5F\x02\x47\x38\xA1"
-    "\x3B\x4F\x48\xFE\x5C\xE2\xC8\x89\xEC\x0C\x29\x5B\xFA\x3E\xEA\xAE"
-    "\x6C\x9E\xB5\x3A\x84\xE5\x58\x35\xDE\xEF\x44\x22\xCF\x3F\x25\x12"
-    "\x79\x06\xFA\x55\x47\x92\x09\x13\xF9\xE9\xBC\x44\xBF\x41\xF9\x0F"
-    "\x15\xA7\x6C\xCD\x0E\xD3\xFD\x71\x43\xF9\xB0\x84\x92\x2C\x65\x04"
-    "\xE5\x98\xF1\xB5\xB7\xAB\x71\x01\x54\xAB\x75\x9A\x93\xBF\x24\x04"
-    "\x24\xF5\x00\xD0\xFA\xE6\x78\x5D\x88\x62\xA8\xCC\x1D\x5E\x2D\x18"
-    "\xD6\xA6\xAA\x75\x7B\x55\xEB\x68\x55\xEB\x0D\xAA\xB2\xE6\xA2\xAE"
-    "\x52\x18\xE4\xBD\x0A\x46\x49\x90\xEB\xC3\xBE\xA4\x78\x52\x13\x2E"
-    "\xA3\xDA\x09\x32\x1A\x6B\xA0\x22\xE6\x9D\xD8\xC8\x50\x5B\x44\x17"
-    "\x8B\x04\x97\x90\x08\xE5\x27\xC0\xD5\xBB\xAA\xFC\x44\x08\x87\xA4"
-    "\xCD\x40\xFE\x2D\x84\x5C\xC7\x21\xED\x5A\x38\x28\x61\xBB\x28\x5A"
-    "\xD2\x59\x94\x06\x85\x1D\xA6\x6E\x6F\xC0\x12\x31\xBE\x1E\xA3\x85"
-    "\x79\x56\xCE\x0B\x15\xB0\xA1\x83\x1F\xE5\xC8\xCA\x8E\x2A\xD0\x3C"
-    "\xA4\x52\x74\x1A\x8D\x70\xAB\xCE\xDC\xE4\xA7\x0E\x3B\x5C\xA2\x76"
-    "\x7A\xF9\xE4\xF5\x9E\x99\x3F\x59\x8B\x95\x35\xA3\xEB\x73\xF4\xA1"
-    "\xAC\xA9\x0D\x5F\x23\x7C\x3C\x03\x1D\xAB\xC6\x54\xE3\xBE\x2E\xE5"
-    "\x34\x31\xC2\xAB\xDD\xCE\x0B\x9A\xD1\x94\xDD\x54\xEA\x8A\x39\x98"
-    "\x07\x41\xE9\x3E\x00\x0A\xD6\xC2\x20\xEC\xA6\xE5\xBC\x88\xBE\xDE"
-    "\xE1\xC4\xF1\x32\x6B\xBB\xCD\xF5\x3D\xC3\xD4\x74\x54\xDA\x10\x1F"
-    "\xCB\x2D\x8D\x44\x7E\x0C\xE3\xF0\x5E\xB3\xB8\x05\x1C\xE7\x17\x56"
-    "\x41\xF5\x0D\x1D\x9A\x3C\x7F\xA0\xCB\x55\x9D\xD5\x51\x65\x74\x34"
-    "\x28\xF8\x02\x3C\xBC\xAD\x0E\xFA\xBD\x80\xA9\xC7\xBC\x71\x33\x39"
-    "\xEA\x7B\x0C\x5D\x2E\xD0\x8D\x86\xDC\x36\x73\xA3\xA1\xBD\xCD\x70"
-    "\x70\x56\xD6\x98\xEE\xCE\x65\x92\x73\x44\x8E\x93\x95\x0B\xCD\x7F"
-    "\xE8\xA9\xFE\x43\x21\xA1\x99\xF0\x37\x3A\x74\x08\x95\x62\xA7\x03"
-    "\x06\x95\x95\xF5\x70\xD5\x70\xFB\xBB\x26\x1D\xC1\xA5\xB8\x37\x34"
-    "\x92\x06\x32\x52\xB9\x14\x06\x7F\x44\x78\x59\x19\xFD\x41\xA6\xC5"
-    "\xB7\xD4\xA9\x66\x8B\xA9\x38\x15\x13\x1B\x41\xC6\x3C\x8A\x6B\xCD"
-    "\x96\x84\xB5\x5D\x29\x3C\x9D\xFD\x52\x91\x2A\x54\xA5\x84\x6C\xF2"
-    "\x23\x26\xB7\x39\x2F\xD9\xA8\x2E\x4F\xE6\x20\x6B\xD3\xB1\xBF\x63"
-    "\x1A\xB0\x48\x10\x4A\xEC\x95\x26\x9E\x39\xE9\x12\x24\x5D\x7D\x14"
-    "\xC9\x2C\x63\xAD\x3F\x8B\x24\x2C\xC9\x2B\x48\x59\x6C\xDD\xA7\xD8"
-    "\xDF\x82\x62\x81\xC5\xD8\x56\xDC\x5D\x97\x4A\x34\xC2\xA6\x6C\x43"
-    "\xA0\x97\x9F\xB2\xA8\x67\x6F\xB6\x15\x97\x8B\x55\x89\x22\x30\x1F"
-    "\xBD\xFC\xB3\x06\x52\x24\x96\x41\xF9\xDC\x56\x56\x3C\x4E\x4E\xDC"
-    "\xF3\x7C\x79\x39\x89\x67\xE7\x60\xEC\x93\xAB\xD6\xC9\xBA\xD4\x57"
-    "\x1C\xBB\x32\xD7\x5E\x47\x32\xFB\x0C\x93\xB6\x05\x4A\x28\xA6\x29"
-    "\x80\xD4\x42\x25\x2D\x7A\x29\xC0\xF4\x82\x25\x25\x44\x29\xB0\x50"
-    "\x50\x52\x69\x69\x3B\x7B\x3F\x96\x14\xD6\x91\x8A\xAB\x27\xDC\xEA"
-    "\x93\x56\xB6\x57\x7E\xEE\x94\x80\x71\x7E\x45\x4B\x80\x91\x39\xDC"
-    "\x6D\xD5\xFA\xFA\xAA\xAA\xEF\x3A\xF9\x6E\xC9\x18\x68\x6F\x13\xD5"
-    "\xC1\xC2\x17\xC9\x6A\x59\xE2\x73\xCE\xF6\x16\xA8\x48\x53\x7A\xDD"
-    "\xA3\x74\xA0\x29\x4D\x69\x57\x6C\xDB\xB1\x04\x0A\x33\x44\x17\x8A"
-    "\x64\x98\x25\x33\x2C\xA5\x87\x44\x2C\xB1\x27\x3A\x46\xB8\xFA\x88"
-    "\xBA\x35\x18\xE4\x88\x69\xC7\xE2\x68\xDD\x58\xBE\x88\x8E\x74\x96"
-    "\xF8\x49\x24\xFA\xB5\x1E\xC3\x74\x8E\xE0\x1E\xF7\x5F\x92\xD8\xB4"
-    "\x28\x5A\x15\x82\xFB\xDD\xC7\xC9\x0E\x7A\xCD\xA1\x59\x2D\x6E\x7F"
-    "\x64\xF6\xCB\x5A\x7A\x9D\xA1\x19\x4D\xC6\xB8\xC9\xE8\xEC\x42\xD0"
-    "\x7B\x80\x76\x21\xBA\xE2\x18\x6D\xCB\xF1\x48\x85\xCC\x10\x8D\xE7"
-    "\xA5\xBC\xC2\x28\xED\x42\x74\xC3\x03\x55\xE4\x9E\xBD\xE6\x50\xC5"
-    "\x4F\x6B\x6A\x4B\x3B\x3E\x37\xCA\xB1\xE8\x5D\x9A\xF7\xBE\xAC\xCB"
-    "\x23\xBC\x7B\x6F\x2D\xDF\xB2\xFF\x36\x9D\xBF\xB2\x33\x3F\xE3\x61"
-    "\x67\x82\xC6\x68\x0A\xCC\xC3\xAE\x1C\x98\x87\x6D\x49\x30\xAD\x0D"
-    "\x76\x83\x59\x30\x0F\xBB\xD2\x60\xA6\x48\xA2\x3C\x98\x57\x24\xC9"
-    "\x76\xD2\xB2\x00\xB3\x6C\x79\x5F\xB9\x3A\xB0\xCB\x1C\x00\xBB\xB6"
-    "\xFD\xD1\x42\x28\x07\x2B\x27\x56\xC0\xE2\x48\x6D\x57\xE2\x0C\xE3"
-    "\xF1\x51\xF9\x24\x94\x93\x9E\x7F\x71\xF5\x23\x53\x28\xF1\xB1\x97"
-    "\x7B\x31\x31\xD5\x7C\xB6\xC6\x9B\xE8\xB8\x6E\x53\xA3\xF6\x9B\x90"
-    "\x6B\xE4\x15\x46\x78\xF5\xF1\x8B\xF4\xC9\xE8\x89\x21\x70\xF9\x3B"
-    "\x30\xFE\x57\xCB\x82\x77\x4E\x98\x15\x30\x70\x40\xFD\xD6\xEA\x17"
-    "\x1E\xE4\x2D\x26\xD5\xD2\x9E\xFA\x8D\x68\x2B\x3F\xB5\x61\x2A\x0B"
-    "\xE0\x46\x59\x41\xE5\x11\x01\xD6\xE6\xB1\x63\x01\xEE\x59\x00\x60"
-    "\xA7\x1B\xE9\x8F\x1C\xC5\x40\xEC\x0C\x73\x73\x9A\x62\x5E\x0E\x36"
-    "\x46\xF1\x3D\x2C\xA2\x97\xA5\xF2\x97\x1A\xEF\x3F\x3A\xCA\xAD\x13"
-    "\x3C\x72\x62\x23\x1A\x5E\x63\xE6\x8F\xDF\x82\x64\x74\xB8\x5B\x67"
-    "\xFA\x06\x24\xBB\x33\xD5\x6F\x41\xBA\x74\xE0\x87\x4E\xF9\x96\xA6"
-    "\x04\x6D\xD1\x93\x5E\xD7\x51\x92\xD7\x2F\x1E\xBF\xC0\xAB\xC1\x17"
-    "\x6B\xDB\x28\xF6\x5D\xA1\x4A\xA0\x6D\xB7\x33\xED\xD0\xE4\x7D\xB6"
-    "\x08\x1E\xE1\x68\x37\xBE\x36\x23\xDE\x62\xD3\x7E\x8C\xF8\xB4\x0B"
-    "\x50\x3D\x1B\xEA\x78\x39\x4C\x99\xAA\x03\xD8\xC4\x77\x19\x52\x14"
-    "\x0B\xC7\x72\x0C\x4C\xC7\xEA\x13\x5C\x48\xDD\x73\xE5\x4D\xEA\x43"
-    "\xAF\xB7\x97\x05\x45\x6B\x61\x84\xD6\xB2\x3C\x29\xE7\xF9\xCC\xD9"
-    "\x7F\xB4\xED\x8F\xF8\x1A\x93\xED\xFF\x4B\x3E\x6B\x74\xDB\xB7\x13"
-    "\x9A\x5C\xE5\x51\x40\xE7\xE3\x96\x0E\x1C\xDE\xC2\x44\x03\x5B\x22"
-    "\x1C\x78\x4B\x1B\x13\xB2\x70\xEC\x68\x49\x7D\x12\x1E\x2B\x41\x63"
-    "\xA5\x3E\xE1\xED\x1C\x69\x7B\x04\x93\x25\x1D\x3F\x19\xCA\xB8\xCA"
-    "\xB8\x61\xCA\x87\x3E\x4C\x94\xF4\x5E\x9F\x23\x15\x3F\x17\x94\x16"
-    "\xE2\xA4\x52\xA6\x78\xB5\x5A\x52\x7C\x40\x60\x7A\x1B\x66\xF6\x3A"
-    "\xE5\x61\xC9\x91\x81\xDD\x29\x8A\x78\x7F\x1D\xE6\x08\xBB\x05\x8E"
-    "\xCE\xFB\x22\x2B\x78\x07\x2A\x5A\xC8\xD9\x6F\x09\x53\xB1\x58\xB0"
-    "\x96\x7D\x2D\xED\x21\x23\x41\xDB\xE1\xDA\xF4\x9E\x27\x48\x1D\xD3"
-    "\x72\x23\x6C\x30\xB1\xE7\x2D\x3C\x60\x45\x50\x57\x78\x00\x45\x75"
-    "\x07\x65\x7E\xA0\x23\x66\x2A\x03\xDC\x31\xC8\x79\x7D\x2A\xEF\xD8"
-    "\x75\xEA\x0A\xBA\x76\x09\xB3\xEA\x34\xCB\xF9\x48\x2F\x76\xEC\xDD"
-    "\xEB\x75\x6C\xEA\x10\x8D\xB5\x6C\x9E\xE3\x8C\x6E\x76\x75\x68\x2A"
-    "\xB7\xDB\xC8\x7D\xED\x99\xB8\x4D\x11\x4E\xE2\xBD\xB2\xE7\xE5\xF3"
-    "\xB5\x0E\x57\x60\xD3\x66\xA4\x76\x37\x8C\x00\x1D\x81\x7D\x81\x19"
-    "\x68\x50\x1E\xC6\x5E\x69\x01\x56\x32\x04\xE9\x65\x3C\x53\xA7\x90"
-    "\xE2\x00\xA2\xC8\x94\xF0\x38\xF5\x79\xC1\x16\x0E\x1D\x22\x37\xC2"
-    "\xAD\xC4\x3A\x7E\xA6\x5A\x8A\x75\xC4\xD0\x09\xED\x18\x4A\x0B\x66"
-    "\x4A\xED\xC7\x31\xC5\x73\xBE\xF2\x2C\xEB\x58\x1A\x6A\x75\xAB\xD3"
-    "\xBB\xA6\x90\xC7\xF1\xD1\x34\x29\xF0\xE9\x69\xD3\x43\xBA\x6F\x2C"
-    "\x3F\xCA\x70\x45\x2B\x55\x9C\xBF\x91\xDD\xE5\x9C\x58\x79\x8D\x56"
-    "\xA0\xF1\xA1\x96\xD8\x37\xD2\x0A\x63\xC7\x78\x48\x6F\xB7\x15\xD2"
-    "\x0E\xF1\xD6\xFB\x37\xD2\xAA\xC0\xB4\x49\x54\xB2\x59\x2B\x5B\x74"
-    "\x6D\xB8\xC7\xCF\x35\x53\x8A\x9B\x70\x5B\xBF\xED\xA5\x47\xBB\x34"
-    "\x3F\xF0\xEC\x85\xE5\xB5\x2D\xEC\xA4\x8B\xB3\x64\x05\xF3\x28\x0F"
-    "\xCD\xA1\x71\x6D\xC8\x75\x60\x2C\x89\x8B\xCA\x44\x26\x0A\x84\x0A"
-    "\xD2\xD7\x90\x6A\x97\x77\x01\xD6\x67\x85\xEA\x7D\x06\xCB\x2E\xD0"
-    "\xF5\xFA\xF5\x8E\xCC\x54\x62\x96\x90\xF4\x82\x76\x71\xCC\x41\xE3"
-    "\xDA\xB3\x08\xA3\x79\x26\xCC\xED\x03\x29\x9D\x2A\x1C\x87\x9B\xDE"
-    "\x54\xD0\xEA\x91\x6C\xBF\xAC\xA0\xC5\x1D\xD2\x15\xA5\x2E\xF7\xD2"
-    "\xE9\x4C\xA1\xFD\x29\x22\xAE\xED\xD6\xF9\x9E\xDD\xA3\x97\x47\x0E"
-    "\xE7\x12\x42\xFC\xBA\xD2\x21\xC9\x9B\x38\x92\xD9\x7D\x08\xB2\xCF"
-    "\xE1\xD0\xDB\x38\x92\xDA\xEF\x10\xE7\x75\x0E\x8A\xB6\x1E\x37\xC4"
-    "\x7F\xBD\xD3\x86\xF7\xDD\x8F\x73\xCD\xDF\xFD\xE0\x63\x63\x9B\x6D"
-    "\x64\xAF\x77\x1C\x51\xF9\x01\x55\x92\x4B\x90\xB7\xE0\x04\x9A\xF5"
-    "\x14\x9A\x83\xE2\xE6\xD1\x32\x70\x8E\xCB\x57\xF6\x4C\xBA\x08\xC7"
-    "\x78\xAE\xC2\x31\x2C\xA0\x7F\x5B\xE7\x40\x57\x3D\xA0\xD0\x0E\x9D"
-    "\x2C\xCC\xC0\xBF\x11\x5C\x7B\x9B\xA8\xE5\x29\x6B\xE8\xB6\x5A\xEA"
-    "\x06\x6F\x8C\xC7\x3A\x4C\xC8\x99\x3E\xE7\xDE\x8A\x52\x41\x39\x11"
-    "\x24\x74\x8F\x8E\xA9\x0A\xF9\xE8\xF0\xF5\x8D\x2A\xF3\x76\x3F\xC5"
-    "\xAC\xC0\x69\x1B\x2F\x8F\xE7\x4A\xDD\x7A\xDE\xBC\x8D\x7A\xEC\x04"
-    "\xD0\x78\xB1\xAA\x4F\x45\xA9\xC4\x7A\x54\xBA\x84\x3B\x3A\xDA\x91"
-    "\x9C\xDE\xED\x1D\xB6\xB4\x96\xDD\xDF\xDF\x60\x7E\xBA\x6F\x96\xD5"
-    "\x19\x8E\x46\x09\xEE\x10\x12\x51\x9B\xA9\x86\xD0\xBD\x6A\xD1\x26"
-    "\x1C\x63\xD4\x01\x35\x43\x9C\xA8\x77\xDA\x10\xD9\xBF\x74\xDE\xFB"
-    "\x87\x1B\xB5\xF0\xB4\x64\x81\xDE\x88\x61\xFD\x18\xE7\x32\x10\xDA"
-    "\xBB\x01\xFB\x42\xA9\x71\x7F\xC5\xD9\x4B\xC9\x02\x40\xA0\x9C\xAC"
-    "\x11\x98\x94\x7D\x35\xC3\xA8\xB7\x45\x31\x29\x8F\x4B\x37\xBC\x40"
-    "\xD6\xEF\x1E\x3C\xF8\x70\x85\x21\x49\xB6\x4C\x8F\x31\x49\xE9\x7F"
-    "\xA3\x9D\x8F\x1F\xD0\x9D\xD3\x72\xC9\x59\x41\xAC\x27\xC3\xA1\xE6"
-    "\xAA\x6A\x28\x46\xA0\xAB\x87\x62\x23\x1D\x5E\x8D\x13\x39\x39\x04"
-    "\x5B\xBB\xCC\x32\x68\xD6\xD1\xB2\xCA\xA7\xB4\xF8\x8E\xB5\x6C\x73"
-    "\x21\x74\xF9\x18\x95\x40\xA9\x6D\x60\x64\x3D\x81\x39\x7E\x28\xBB"
-    "\xFC\xAB\x0D\x1B\x99\xCE\x27\x28\x45\x52\x5D\x25\x73\x81\xC7\xA0"
-    "\x6A\xD7\x54\x52\x42\x8A\x27\xE1\xF8\x9B\x9C\xAE\x35\x29\x38\x5F"
-    "\xEB\xEF\x8E\x81\x24\x21\xC4\xAF\x38\x0C\x8C\x39\x17\x0C\x1E\xC4"
-    "\xF2\x05\x28\x3A\x79\x12\x6F\x39\xE1\x36\x88\x9C\x70\x1B\x88\x22"
-    "\xA5\xBE\xC3\x17\x00\x57\x0D\x6E\x89\x95\x45\xED\xC1\x0C\x0F\xC5"
-    "\x95\x29\x23\xE3\x3E\xE0\xB8\x77\x53\x3A\x72\x28\x6E\xE0\xD0\x26"
-    "\x8E\x7D\x59\xD2\xE0\xE1\xE1\x44\xF9\x14\xDD\x02\xB1\xB3\x77\x3D"
-    "\xAA\x49\x9F\x81\x1B\xB4\x9D\x81\x1B\xDC\x11\xD6\x0D\xE6\x0A\xB8"
-    "\xD6\xB1\x2D\xC2\x80\xB7\x01\x35\xB9\xEE\x3E\xFD\x14\xEF\xA9\xC1"
-    "\xA7\xDB\xEA\xC0\x93\x39\x34\xF2\x93\xBE\xD5\xAB\xF5\xD4\x48\xDD"
-    "\x08\x8F\x89\x73\x6A\xC4\x20\x9B\xE5\x75\xF3\x0A\xD7\x6E\x35\xE7"
-    "\xDF\x36\x43\xF9\xAC\x9C\xCD\x30\xAB\xEB\x71\x86\x20\xB4\xA4\x41"
-    "\xCF\x0A\x56\x6E\x2F\x61\xE3\x55\x96\xBB\x5D\x6A\xA3\x30\x9D\x44"
-    "\x2E\x89\x93\x31\x76\xE0\x9C\x49\x36\x98\x14\x07\xE8\xA6\x9C\x55"
-    "\x79\xB3\xE7\x1C\xFE\x39\x5E\x51\x76\xA5\x65\xD5\x34\x33\xCC\x12"
-    "\x38\xAB\x28\xA6\x6D\x72\x0A\x6B\xC9\x13\x0C\xF2\xA6\x96\xD7\x2E"
-    "\x6E\xCD\xCC\xDB\xC0\xAD\xE9\x56\x27\x98\x46\x02\x37\xED\xB1\xE9"
-    "\xDD\xBE\x63\x17\x3C\x4E\x60\x4F\x24\x1A\x9C\x07\xBC\x39\x53\xE2"
-    "\xF6\xC6\x14\x64\x99\xD7\x46\xE6\x2A\x0A\xB1\x81\x9D\x88\xC8\x93"
-    "\xDD\xE6\xD0\xBB\xE9\x21\x1A\xA7\xF0\xC0\x7F\x90\x38\x46\xB3\x9B"
-    "\x38\x46\xE3\x8C\x93\xED\x08\x95\x9A\x21\x57\xA2\x52\x17\x1E\xF8"
-    "\x0F\xAE\x42\xA5\x19\xB7\xFB\x7E\xDA\xF1\x3E\xD7\xCD\x5F\x3D\x52"
-    "\xB9\x4F\x7C\xD0\x86\x01\xC4\x4E\xF1\x88\x34\x78\x31\xB1\x21\xB4"
-    "\xD3\x2B\x09\xE8\x0D\x22\x10\x5A\xA2\x62\x45\x94\x91\x9F\x92\x6C"
-    "\x93\x38\x58\x7F\xB5\xB6\x09\x4F\xFD\x41\xD4\xC6\xB8\x78\x8C\x68"
-    "\x8A\x71\xA9\x88\xD2\x2E\xC6\x59\x7D\x40\x81\xFD\xA4\x14\x66\x2A"
-    "\xCC\xA7\xF6\xF5\xC1\x47\x8E\x3C\x95\x53\x64\xE2\x22\xEC\xCD\x83"
-    "\x3D\x63\xAC\x0E\x63\x1F\xBB\xD8\x9D\x2E\xF1\xF1\xEE\x14\xEF\xEA"
-    "\xDA\xDB\xBE\x52\x3C\xCE\xC9\xB6\xFB\x8A\xA3\x8C\xFC\x1D\x5D\x5B"
-    "\xDC\x3B\xB2\xEB\x3A\x81\x5D\x57\x8B\xEB\xFA\x74\xB5\x71\xDF\x88"
-    "\xAE\xCD\x2E\x30\x8E\xC8\x70\x67\xDC\x52\x44\x8C\x6F\x39\xD6\xA9"
-    "\xD7\x26\xAB\x6B\xF9\xC7\x5A\xD6\xB2\x51\xC9\xE5\xF6\x5B\x91\xB9"
-    "\x4D\xEE\x89\x2C\x68\x4B\xC9\x36\x10\x61\xE2\x0D\xB0\x20\x5B\x97"
-    "\x62\x88\x3E\x53\xA7\xAE\x87\x11\x47\x6C\xE9\x0A\x06\x7E\x6C\xAF"
-    "\x64\xE0\xDF\x5F\xE2\x85\x40\x89\xAA\x79\x17\x4A\x57\xEE\x19\x08"
-    "\x43\x41\x7A\xC4\xC3\x96\x9A\x8C\xF4\x87\x0E\xA1\x37\x18\x33\x77"
-    "\x56\x72\x70\x0C\xA6\x48\x58\x50\x3A\x0C\x10\xF8\x30\x60\x42\x5D"
-    "\xB3\x02\x76\xC8\x01\x59\x22\x8F\x73\xF7\x9A\x60\x51\x37\x00\xE1"
-    "\x56\xDB\x6B\x58\x64\x0D\xE9\x82\x89\xA1\x5C\x98\x7D\x9E\x3D\xD8"
-    "\xDD\xDD\x8D\x7A\xF7\x6C\x3D\x8E\x34\x60\x8F\xFA\x1B\x78\xAE\x2D"
-    "\x9E\x08\x48\x10\xB8\xB4\x30\x24\x71\x19\x8B\x39\x81\x0B\x39\x1E"
-    "\xCA\x82\x43\x06\x6F\x35\x26\x80\x8C\x11\xDD\x76\xFD\x93\x1B\x67"
-    "\xE4\x76\xBF\x53\xD5\xC8\x6D\x55\x2C\xB6\x5A\x7F\x62\x2B\xEC\x34"
-    "\xB0\xB3\x82\x76\x3A\x32\x5E\x28\x8C\x56\xD9\x34\xDA\xE3\x07\xB9"
-    "\x89\x29\x94\x24\xC7\xAE\xD1\xA1\x33\x77\xAB\xB2\x2D\x27\x7E\xE7"
-    "\x5E\xE5\x26\x77\xAA\x3B\x1C\x94\x03\xF1\x23\x5D\xB7\x9E\xDE\xBE"
-    "\xFC\x98\x9B\x8A\xFF\xBA\x5B\x86\xAD\xDB\xA5\xD1\x1C\xA5\xA0\x35"
-    "\xFF\xA3\x9C\x4F\x66\xAB\x69\x11\x7A\x0D\xEF\xC0\x8C\x6E\x62\xB0"
-    "\x94\xB7\x34\x6B\xE8\xDA\xCC\x66\xB9\x66\x47\x9C\xE3\x0A\xCC\xEB"
-    "\x0C\x74\x6F\x59\x63\x70\x72\x81\x51\x56\x63\x5B\x5E\xDD\x02\xFE"
-    "\xDA\x14\xA7\x34\xE0\x2C\x68\x35\x1D\xEA\x37\x98\x41\x17\x80\x79"
-    "\x82\x26\x4A\x9D\x1D\xAD\x8E\x8F\x69\x9F\x02\xF1\x2B\x1A\x60\xE8"
-    "\x70\xE3\xEA\x00\xFD\xA3\x7C\xFE\x3E\xAF\x5D\x7F\x1F\x05\x8F\x2A"
-    "\x84\x0A\x80\xB0\xA9\x70\xC6\x65\x51\x97\xFF\x80\x3E\xD8\x47\xDA"
-    "\x9B\xFC\x1D\x46\x2F\x29\xB0\x1F\xB0\x14\x66\xAF\xF2\xAB\xF1\x01"
-    "\xA8\x2D\x6C\x16\xD5\xAC\xC8\x6C\x6B\x36\x2B\x4C\x0A\x01\xB3\x10"
-    "\x15\xB6\x5C\x79\xB6\xE0\xCC\xE3\x18\xD2\x4B\xEF\xF9\x4A\x0A\xE5"
-    "\x6B\xD5\x08\x48\x44\xEB\xAC\x98\x4F\x2A\x8C\x98\x27\x86\x01\x1E"
-    "\xEE\xA7\x7F\xE0\x0D\xD4\xD8\xA1\x3A\xEB\xD7\x23\x1C\x8B\xCB\xD5"
-    "\x04\x90\xCE\xB3\x8B\xD1\x5A\xA7\x67\x71\x73\x7C\xF1\x84\x7F\x99"
-    "\x5D\x44\x9F\xAE\xBD\x34\x59\x94\x27\x62\x78\x31\xCA\x4C\xFE\x47"
-    "\x9D\x12\xF0\x02\xF3\xD9\x61\x02\xA6\xF5\x25\x65\xC6\x65\x4D\xF0"
-    "\xE8\x14\x28\xFE\x11\x64\xAE\x8E\x66\xC5\x75\xEF\x3A\x99\xAC\x66"
-    "\xC4\x3D\x60\x62\x86\xFA\xA7\xC4\x88\x9B\xA3\x75\x36\xCB\x8F\x8A"
-    "\x19\xF7\x68\x53\x4E\xDE\xD5\xBA\x08\x3E\xC0\x30\x68\x8A\xD1\x27"
-    "\xB7\x6B\x83\xB1\x6E\x4B\xC2\x90\x54\xB9\xBC\xCF\x74\x09\xAB\x8C"
-    "\x63\x98\x26\x00\x1D\xFA\xC9\xB3\x6C\xC7\x24\x54\x60\x00\xA0\x60"
-    "\x81\x9D\x30\xC7\x55\x11\xE6\xBD\x01\xEE\x23\xB7\x61\xC1\x82\xE1"
-    "\x92\x50\x90\xE9\x1A\x69\xFC\xBD\x3F\x2A\x17\x11\x91\x3C\xF8\xF3"
-    "\x9F\xFF\x3C\xFE\xF3\x20\x45\xE3\xB2\x3C\x39\x15\x44\xFE\x3E\x68"
-    "\x6C\x4D\x29\xC1\x34\x52\xA6\x80\xA3\x6A\x89\x52\x0A\x63\x0F\x07"
-    "\x1C\xC0\x23\xC7\x47\x80\x71\x31\xE2\x86\x8D\x00\xA4\x69\xAA\xB3"
-    "\x4B\x67\xE2\xFB\x2D\x64\x82\x87\xEB\x4B\x1A\xA1\xC0\x4A\xD4\x2C"
-    "\xC0\xEF\x2F\x1E\x5F\x92\x6F\x09\x59\xEF\x97\xD0\x03\x04\x2B\xFF"
-    "\x8E\xAF\x7D\xFB\x24\x68\xFF\x5C\x82\x66\x94\x1A\xD8\x71\x93\xAF"
-    "\x09\x47\x3D\x54\xFD\x3D\x12\x1D\x3B\xF2\x7A\xF0\x40\x13\x3A\xF2"
-    "\xD9\x66\xDE\x78\xF1\xFC\xB3\x02\xA3\x98\xEB\x45\x3E\xE1\xCC\x65"
-    "\x2C\xBC\x06\x82\x55\x25\x56\xF2\x1C\xA6\x93\x72\x82\xBA\x52\xD1"
-    "\x31\x56\xD9\xB2\x11\xFD\xD0\x21\xC3\x3B\x7D\xD0\x30\x2D\xED\x08"
-    "\x5C\x72\x03\x0C\x88\x9F\xF9\xF0\x73\x39\xC5\x7B\xE5\x71\xBF\x71"
-    "\x28\xE8\x1A\xE7\x93\x66\x95\x73\xD4\x19\x08\xC2\xD7\xD5\xC5\x77"
-    "\xF0\x12\x96\x47\xAD\x30\x2F\xB1\x56\x00\x12\x43\xE5\xF3\xEC\x8B"
-    "\x38\xFD\x61\xF5\xB2\x59\xC9\xFA\xDB\x81\x92\x04\x78\x14\xB0\x1C"
-    "\xFD\xA5\x20\x70\xAE\xDD\x31\x8D\xCF\xF2\x8B\x76\x6E\x3C\xAC\x27"
-    "\x38\x87\x77\xF0\xE3\x71\x41\x60\x62\xD7\x42\x7F\xDA\x9B\x61\xB0"
-    "\xB7\x83\x29\xF4\xDB\xAD\x0D\x8E\x27\xF2\x45\xB2\xC1\xAE\xF4\xE4"
-    "\x20\xC8\xBB\x8B\xD9\xF6\x25\xAF\x3C\x00\x22\x0F\x13\xE5\x7A\x1D"
-    "\xEA\x81\xF1\x90\x4C\xA2\x72\xB3\x77\xA7\xD6\x15\x62\xE8\x02\x26"
-    "\xF1\x4B\x59\xC4\xFB\x31\x93\x98\x32\xCD\x46\xAC\x24\xBA\xF7\xD8"
-    "\xB5\x77\xF0\x9E\x00\x63\xAD\x70\x8A\xBC\x72\x6E\x5D\xF3\xFC\x24"
-    "\xC7\x9C\xDB\x0F\xC4\x13\x3D\x69\x24\x12\xF1\xF1\x5B\x2D\xE4\xBB"
-    "\xE1\x2B\x23\x82\xF2\x1D\xF6\x8A\xF7\x68\xA9\xC0\x64\xDD\xE8\xCC"
-    "\x75\xA1\x98\xD1\x3E\x18\x6A\x01\x78\xF6\x85\xF7\x4C\x89\xCB\x41"
-    "\xF6\x47\x59\x35\xB4\xE0\x51\x35\xAB\x70\x83\x65\x70\x7E\x5A\x36"
-    "\xC5\x20\xB2\xAF\xA6\x66\xCD\xF6\xAD\x35\xDD\x44\xD7\xF1\x68\xA7"
-    "\x7C\xFD\x97\x33\x6A\x55\xD0\x29\x13\xB6\xE7\x55\xB9\x96\x85\xB4"
-    "\xE6\xBA\xFA\xD8\x39\x4C\x61\x30\xB3\x7A\x72\x32\x3F\xA7\x2E\x89"
-    "\x16\xE6\x57\xD0\xF7\x8B\xF2\xC2\xE8\xEE\x10\xC3\x29\xF7\x5C\x0C"
-    "\x83\x7A\x95\x44\xE1\x98\x0B\x9E\xA5\x80\x5B\x67\x33\x9D\xF7\x92"
-    "\x04\xE1\x2C\x5F\x9E\x00\x2A\xC9\x92\xB6\x0F\x20\xA2\x0F\x98\x46"
-    "\x53\x3E\x3F\xA8\x2D\x2B\x85\x08\x27\xCF\x76\xE3\xC0\xB5\x0B\x1C"
-    "\x8A\x58\x0E\x6F\x95\x24\x63\x0B\x7C\x57\xD2\x05\x6A\x4B\x6D\x0E"
-    "\x58\x33\x80\x4C\x3E\xF3\x1A\x18\x0D\xCB\x25\x93\x79\xD5\x9F\xF3"
-    "\xD9\xB3\xA0\x44\x42\xCF\xFA\xFE\xCD\xD3\x6A\x10\x3B\x22\x2B\xDF"
-    "\xE9\x21\xAC\x7F\x8F\xB9\xAB\xC7\x24\x2C\x21\xB8\x19\xD6\x3E\x3C"
-    "\x8B\xC6\x06\xEE\x6A\xF6\x7A\x68\xEA\x13\x64\x63\x50\xDE\x06\x38"
-    "\xC1\x52\xFE\x4E\x8F\xF3\xA1\x19\xF1\xDE\x5E\x96\xD5\x03\xE6\x7B"
-    "\x77\x15\x9F\x56\x79\xFF\xC2\xC6\x37\x75\xCB\x43\x9A\x38\xA9\xA4"
-    "\x3F\xCE\x56\x4D\xF5\xAA\x68\x68\x48\x3E\x84\x0E\x1B\x5E\xCB\x96"
-    "\x96\x76\x1A\xCE\x5E\xD6\xBD\x30\x96\x46\xFC\xA1\xB1\xE2\x9D\x91"
-    "\x3A\xF2\x46\xE2\x48\x4E\x79\xB1\xDD\x22\x41\xB6\xAA\x73\xCC\x4B"
-    "\x0B\xFD\x8B\x96\x18\xAE\x36\xD8\x31\x2F\xD5\xD2\xC3\x1B\xFD\xF6"
-    "\x3D\xCF\xCB\xC9\x5B\xEC\x80\x6B\x19\x1D\xEE\xA6\x91\x82\x6A\x16"
-    "\xA5\xBE\x49\x4A\xBC\x9E\x82\x68\x7A\xB0\x9D\x44\x82\x44\xCF\x38"
-    "\xB9\x66\x75\x9C\x2D\x66\x55\xC3\x58\xCB\xB9\x9D\x5E\x81\xAA\x72"
-    "\x4E\x2E\xB7\x04\x62\xB4\x2C\x7C\xC4\xF8\xEC\xBA\x78\x97\x7A\xCA"
-    "\x14\x78\xF9\xD9\x75\x31\x2B\xCB\xC7\xC1\xAC\x9E\x6D\x88\xFA\x7E"
-    "\xA0\x2B\x5D\x89\x8E\xAD\x36\x5D\xD5\xC9\xD6\x1B\xFE\x11\x13\x83"
-    "\x36\xE0\x96\xAE\xFE\x57\x46\x1C\xFC\x2B\x9E\x19\x33\x8E\xBF\x60"
-    "\xA4\xE0\x26\x69\x8D\x8A\xE6\x79\x39\xC7\x5B\x96\x86\x60\xC1\xBA"
-    "\x1B\xB4\x64\xD1\xC2\xBF\x1B\x4C\x16\x67\x0A\x57\xF4\x2A\x14\x8D"
-    "\x29\x46\x03\xDF\xF4\x34\x04\x9B\xD9\xA5\x81\x6C\x68\xF8\x77\x13"
-    "\x1A\x14\xAE\x28\x0D\xF9\x45\x8A\xF0\xC4\xFD\x2D\xC0\x84\xCF\xB3"
-    "\x21\x11\xB2\x43\x3F\xB7\xB3\xFB\xDA\x3A\x8E\x34\x84\x14\xD5\x90"
-    "\x05\xED\xC5\x31\xFD\x72\x1A\xA4\xED\x6B\x07\x62\x83\xC6\x51\xF9"
-    "\x28\xA5\x8D\xC5\x14\x2B\xC4\xDA\x2C\x59\x92\x5F\xB7\x36\x4B\x61"
-    "\x10\xAA\xD1\x6F\x98\x59\x24\xF8\x18\x53\x4D\xF3\xAC\x17\xD0\x6A"
-    "\xB8\x70\x77\x16\x57\x92\x50\x04\xC0\x97\x7F\x1B\xD2\xB8\x89\x27"
-    "\xCE\x40\x20\x5A\xD9\xF7\x41\x43\x03\x2C\xB1\x69\xAD\xC9\x79\x9D"
-    "\x64\x39\x42\xD0\x5B\x45\x50\x6C\xE2\x48\x51\xD7\x0F\xAB\x52\x1C"
-    "\x3B\x31\xBC\x21\xE2\xAF\x49\x03\x74\xB6\xFB\xAF\xC3\x43\x6F\x8E"
-    "\x09\x30\xBD\xAE\x16\x7D\xD0\x34\x66\xC7\x2F\x4D\x4E\x8F\x86\x1A"
-    "\x82\x7A\x32\x10\xA8\xEB\x87\x95\x94\x6F\x9C\x79\x89\xBE\x46\xBB"
-    "\x99\x4D\x84\x75\x12\xB9\x85\x61\xF5\xBD\x03\xFA\xC1\x71\xA9\x3C"
-    "\xD8\xA6\x13\xC4\xEC\x3D\xC6\x3B\xB1\x46\xD9\x16\xF5\xE4\x56\x0B"
-    "\xB7\x5E\xEA\xD5\xD4\x26\xF5\x2F\x95\x0B\xAB\x07\x01\x48\x6A\x5B"
-    "\xFD\xC8\x54\x8B\xF9\xA2\x4F\xED\xBA\x06\xBC\x71\x6C\xC4\xB3\x53"
-    "\x94\x17\x5B\xE8\x78\x2A\x96\x6D\xB5\x2B\x59\xB9\x1E\x01\x6A\x2A"
-    "\x8C\xB2\x43\xD3\x00\xDF\x80\xCE\x14\x29\x7E\x0D\xB8\x75\x35\xCA"
-    "\xF2\x59\x79\x82\x73\xA1\xC5\x81\xF7\x5B\xE0\x4A\x07\x1F\xC2\xD4"
-    "\x31\x9D\x15\x5B\x5E\x4C\xCB\xDD\x88\xE3\x23\x95\x14\xB0\xE0\x50"
-    "\xD8\xC7\x50\x37\x9A\xF2\x38\xB8\xF8\x80\xB9\x5A\x07\xE1\xEA\xC7"
-    "\x66\x53\x56\x76\xE3\xE6\x99\x60\x75\x54\x0F\xA1\xC6\xE3\x4B\x5B"
-    "\xBC\x90\xD8\xF2\xE9\xEA\x95\xEE\x18\xD7\xA9\xC7\xE5\x6C\xF6\xAA"
-    "\x59\xCF\x90\x0F\x87\x91\x95\x9F\x01\x24\x3E\x28\x2E\x12\x37\x13"
-    "\x30\x5F\x5B\xBE\x6A\x16\x47\x20\xB1\x5A\xAF\x93\xFA\x64\xD3\x76"
-    "\x7B\x99\x55\x98\x7F\x89\xE2\x35\xBA\x2D\x67\xB7\xE0\x8D\x76\x9A"
-    "\x69\x32\xF4\x54\xF5\xAE\xE8\xC5\xEB\xA3\xE2\xA4\x9C\xFF\x90\xE3"
-    "\x64\x1F\x79\x8B\x47\x02\x5F\x57\x7A\xBE\x5A\xC7\x40\x10\x39\x82"
-    "\xA8\xC9\x27\x0A\xC3\xF4\x0C\x37\x67\xBB\x52\xCD\x6B\xB9\x93\xF2"
-    "\x4F\xDF\x07\xDE\x42\xF4\x5C\xF9\x7F\x14\x0B\xD1\x70\x14\xF6\x0A"
-    "\xF1\x04\x7D\x29\xB0\x90\x2B\xF9\x70\x4F\x99\x7D\xA9\x0D\x38\xF8"
-    "\x8E\x91\xA6\xB1\xF6\x36\xD9\x05\xD5\xCB\x7B\x1B\xC3\xA1\x32\x26"
-    "\xBF\x42\xE8\xFF\xA2\x6D\x89\x12\x2F\x12\xA0\xCA\xEF\x67\xFA\xF5"
-    "\x0E\xBC\xDE\x86\x05\xCE\xAE\x1F\x13\xDC\x2A\x2F\x31\x99\xB9\x70"
-    "\x65\x21\x26\x33\x08\xE2\x6C\x30\xA4\xE0\xAD\xFC\x58\x8E\x6F\x26"
-    "\x48\x6C\xC1\x5D\xFC\x2E\x65\x67\x03\xD1\xE9\xD7\x1D\x91\xAE\x70"
-    "\x6D\xB8\x44\x67\x08\x0B\x2D\xC1\xFE\xAB\x0C\xDF\xBF\x21\xEA\x7F"
-    "\xDD\xE1\x7B\xAA\xFD\xB1\xDA\x2C\xC5\x01\xEC\x32\xF2\x8A\xE3\x17"
-    "\x6F\x42\xB5\x38\x53\x23\x58\xD5\x1F\x1B\xC2\x1F\x61\x04\x43\x6D"
-    "\x72\x8F\x3B\x09\x7F\x95\x11\xEC\x64\xC6\x5A\x64\x79\x76\x5A\x2D"
-    "\xCB\x7F\x60\x50\xFA\x4C\x5F\xFB\x8C\x21\x4B\xB8\xDF\x26\x9D\x2D"
-    "\xBC\x0D\xD0\xCF\x05\xE3\xD8\x84\xA1\x09\x89\x3C\x3E\xCB\x17\xC8"
-    "\x09\xE3\xAB\x18\x59\x97\x81\x32\xE9\xB5\x65\xBD\xBD\xDD\x4E\x3E"
-    "\xA6\xE3\xC3\x70\xCF\x1B\x27\xDE\xBB\x48\xD7\x23\x7E\x9D\x24\xDE"
-    "\x2E\xA3\x40\x5C\xBD\xC5\x4E\x3A\x06\xD3\x1B\xAE\x14\xA3\xE8\x3D"
-    "\x0B\x22\x31\xD5\x7B\x13\x8C\xA9\x7E\x07\xF1\x98\x16\xCE\xF9\xED"
-    "\x5E\x1A\x6A\x36\x18\xF8\xD2\x50\xF3\xD3\x85\x32\xAE\x35\x86\x32"
-    "\x3F\x25\x6D\x9E\x5B\x19\xC9\xF3\x1E\xB9\x38\x95\xF3\x8B\x31\xAA"
-    "\x1F\x02\xE2\xCC\xBC\x3E\x0B\xDE\x59\xB7\x95\x2A\xCD\x3F\x64\x69"
-    "\xF3\xFA\x2C\x7C\x57\x4E\x09\xAB\x77\x15\x2B\xE9\x57\x75\x75\x2A"
-    "\x7E\x95\xD7\xA6\xAA\x57\x8D\xF7\xDC\x71\xCF\xD8\xA2\x6A\x00\xBB"
-    "\xE5\x0D\x50\x13\x83\x90\x0E\x18\xEC\x30\xF1\xD3\x83\x32\x0E\x16"
-    "\x05\x66\x7E\x47\xB0\xE9\x26\x39\xBF\x63\xF8\x24\xA0\x7D\xE0\x41"
-    "\x2A\xCF\x84\x02\x53\xBF\x3C\x18\xEB\x07\x51\x60\xF6\x41\x88\x4D"
-    "\xD6\xAA\x7F\x46\xF1\x49\x40\xF1\x24\xD6\x62\x25\xF0\xE2\x67\xB4"
-    "\xBD\x16\xCC\xFC\x8E\xD0\x67\xA1\xD4\xAF\x38\x75\x16\xCC\x3E\x68"
-    "\x89\xFF\x8D\x06\x3A\xD0\xD2\x4B\x6F\x27\xC8\x78\x07\xB3\x7D\xEA"
-    "\x06\x3D\xB4\x07\x34\xDC\x6C\x64\x82\x13\x6C\x70\x04\xEA\x76\x20"
-    "\x5E\x52\x08\xAB\x79\xBB\x04\x1D\x26\x2B\x00\x12\xCD\xBB\x93\x65"
-    "\x51\xCC\x07\xE1\xD9\xB1\x1B\x89\x52\xB8\x66\x74\xC2\x8E\x13\x18"
-    "\xF0\xC5\xE3\x47\x1D\x41\x86\x6A\x4B\x67\xE7\xE6\x37\x73\x76\x6E"
-    "\x7C\x1B\x67\xE7\x16\x36\x70\x76\xAE\xB3\x75\x93\x8A\x1D\xD8\xF9"
-    "\xD8\x51\x03\xFD\x2D\xF0\x7F\xAE\xED\xFD\xE0\x72\x7B\xAE\xC3\x0E"
-    "\x55\xA7\x12\x67\x04\xDB\x1F\x9B\x55\xF3\x5A\x8F\xF4\xA1\x19\xF3"
-    "\xEE\x26\x85\xD0\x04\xE6\x7B\x77\x15\x9F\x02\x15\x3E\x05\x2A\x7C"
-    "\x0A\x54\xF8\xA8\x81\x0A\x6D\xF3\x53\xFB\x4C\xD3\x31\x67\xC4\x7B"
-    "\xF9\x9F\x6F\xE3\x9E\x15\xE6\xD3\xB9\x25\x7B\xD1\x44\x6C\x96\x21"
-    "\x3C\x1E\x5F\xE0\xC9\x55\x76\x41\xD2\x79\x5D\x7A\xF4\xA5\x5E\xE3"
-    "\x86\xF1\xC6\x0A\x66\x4D\xC5\x70\x25\x69\x9F\x7C\x69\xFC\x4E\xDE"
-    "\xEA\x32\x75\xA5\x6B\xAE\x6E\x09\xFF\x80\xBE\x87\x4B\x75\x33\x24"
-    "\x09\x02\x4F\xD8\x75\xDB\x19\xC8\x45\xD8\x9D\xF0\xF4\x82\x7C\x44"
-    "\x91\x17\x6B\xF9\xC2\xEB\x61\xC9\x2E\x68\xCA\x88\xB1\x8C\xB8\x4C"
-    "\x2B\xE3\x08\x70\x6C\x16\xDC\x92\x85\xE6\xA5\x5E\x82\x77\x30\x73"
-    "\x9D\x40\xB5\x46\x54\x6B\x0F\x55\x72\x60\x7D\x67\xAC\x74\xBE\xBF"
-    "\x90\x9A\x96\xE6\xA3\xD6\x7F\x98\x50\xED\x29\xF4\x4C\x8E\x87\xD4"
-    "\x7C\x20\xAC\x3B\xC5\x59\x7E\xB7\x76\xDF\xC5\x8C\x27\xD7\x66\x4A"
-    "\xF4\x03\x18\x67\x43\x49\x4A\xBA\x27\xAE\xE6\x4B\xFC\x01\x2A\xA0"
-    "\x89\x26\x17\xE6\xDB\x8D\x3A\x14\x29\x7B\x1F\x98\x00\x8F\x45\x2B"
-    "\x9C\x26\xB9\xA7\x6A\x9D\x57\x98\x21\xF2\x7B\xB2\xDE\xFC\x66\xE0"
-    "\x52\x65\xB1\x4B\x5A\x82\x7D\x40\x6E\xB9\x39\x15\xF2\x98\xE5\x9D"
-    "\x95\xA6\xAC\x39\x3D\xAB\xD3\x9C\x83\x4A\x1F\x5C\xAB\x52\xD5\xC8"
-    "\x88\x3E\xDA\x8D\x0D\x87\x90\x0A\xFC\x88\x9C\xEF\xEE\x63\x5E\x92"
-    "\xD6\xC5\x09\x9D\x82\x24\x07\x1B\x30\x09\xA6\xFB\xC5\x83\x4D\x10"
-    "\xC5\x09\x7C\xD0\x7A\x82\x9D\xEC\x5E\x68\xC5\x08\xEA\xDA\x8E\x42"
-    "\x5D\x86\x9C\x68\x6F\x0C\xAB\xC2\x1C\x3B\x7A\x93\x92\x4C\x3A\x32"
-    "\x74\x3F\x78\x1F\x9E\x5A\x27\x21\xF2\xD8\xE3\x51\x8A\x7C\xCD\xC9"
-    "\x08\x2B\x55\xEE\x31\xFD\x49\xF7\x64\xC8\xA8\x14\x59\xD1\x3B\xFB"
-    "\x7A\xD8\xD6\xA4\xD7\x68\xF1\x86\x6A\xAD\x5A\x35\xBF\x1F\xCD\x96"
-    "\x8A\x26\x4F\xEB\x38\x04\xF9\xA4\xE7\xFE\xC5\xF4\x5C\x64\x7C\x6E"
-    "\xA6\xA2\x22\x08\xAE\xAD\x3B\x6F\x4B\xB7\x75\x3F\x89\x6B\x1A\xFB"
-    "\x6D\x93\xC1\x8F\xE2\xAC\xC6\x3B\xDD\xBD\xF6\x4F\x39\xE8\xC9\xCD"
-    "\x51\xFF\x3B\x0D\xFB\x4D\x86\xA2\x1A\x86\xD7\x1B\xFB\xBF\xE5\x04"
-    "\xF5\x98\x56\xB3\x19\xA6\xAA\x9F\x15\x2C\xAC\xAD\xAB\x97\xDD\x1B"
-    "\x5B\xBD\xE0\x3A\xFA\x07\xD5\x98\x7F\x3A\x89\xE2\x7E\xA7\x05\xCB"
-    "\x0F\x8D\xEC\xFC\xA0\x2D\xFB\xB2\x29\x61\x37\x2B\x14\xE1\x7D\xBF"
-    "\xDC\xCF\xFA\x75\x94\x88\xBE\xDD\x2B\x76\xA4\x49\xAF\x93\x3E\xA7"
-    "\xC5\x3E\x26\xED\xA1\xE5\x7D\x75\xDC\xD3\x93\xB1\xBE\x7A\xFF\x07"
-    "\xB8\xA6\x79\x7D\xFA\x62\x0E\x3A\x69\x51\xD5\x65\x83\x59\x67\x31"
-    "\x87\xC8\x09\xA6\x45\x06\xFD\x87\x6F\xA1\x83\x90\xE2\x71\x66\x70"
-    "\x24\x3F\xAF\x51\x9F\x51\x90\xE1\x29\xB4\x8D\xA2\x24\x31\x2E\xF0"
-    "\xB4\x20\x44\x9C\x72\xA5\x3C\xEE\x44\x33\xAF\x98\xAC\xE3\x63\x44"
-    "\x56\xAF\x16\x8B\x59\x89\x99\xDD\x11\x91\x45\xDB\x89\x86\x6E\xE3"
-    "\xCA\x17\x63\xC7\x9D\x07\xA2\xA1\xD0\x8F\x5B\x59\x02\x75\xEF\x68"
-    "\x3F\x83\xCB\x98\x11\xDF\x3A\xD5\xE8\xB6\x9E\x16\x9D\x94\x78\xCC"
-    "\x08\x88\xC2\x5C\x2A\x3D\xBC\x94\x75\xA5\xBB\x0B\xEA\xA5\x73\x8C"
-    "\xD8\x47\x88\x2D\x3D\xBA\xFF\x62\xE4\x0E\xB7\xF7\xE5\xA8\x18\x69"
-    "\x64\x07\xC8\x14\xDD\x68\x4A\xBE\x76\x53\x71\x37\x37\x1C\x67\x1A"
-    "\xF3\x75\xA0\xAB\x23\xEA\xE6\x08\x13\xBE\xE9\x38\x55\xDD\xEC\x20"
-    "\xFF\x9C\x7A\xF1\x55\x16\x57\xFB\xAC\x6F\xAA\xF9\x0F\x74\x9E\x16"
-    "\x13\xEA\x12\x7C\xB8\x76\x42\x53\xB4\x3A\x3E\x76\xE1\x8E\x8F\x43"
-    "\x40\x9F\x28\xE4\x7F\x9C\x2A\x78\x93\x22\x0B\x3F\xBD\x6A\x0B\x0D"
-    "\x2D\x1B\x74\xC3\xBB\x35\x8F\xA1\xE8\xF0\x8D\x6E\xE1\xC8\xA2\x7D"
-    "\x9B\x9C\xE9\x2C\x63\xDC\x09\x58\x65\xEE\x71\x3B\x0B\xC3\x7E\x92"
-    "\xAA\x59\x60\x7A\x90\xC4\x64\x63\x52\x3A\x30\x39\x96\x68\x2A\xD4"
-    "\x48\xB6\xFA\xED\xB6\xCA\xAA\xCE\xA9\x90\x70\x43\xA5\xC2\xDB\x14"
-    "\x10\xCF\x9D\x98\x40\xF6\xD5\xFC\x26\x98\xC7\xEA\x7D\x74\xDB\xE2"
-    "\xE5\x8B\xEC\xA9\xED\xD4\xFB\xF7\x38\x5D\x52\xF8\xF0\x93\xCA\xF7"
-    "\x3E\x9F\x54\x3E\x48\xDC\x4F\x4A\xE0\x30\x18\xED\x9F\x5B\xE1\xC7"
-    "\xFC\xE4\xA8\x13\xE3\x2E\xF2\x4F\x0A\xDF\xFB\xFC\x16\x0A\x7F\x14"
-    "\x6C\x46\x5C\x55\xE1\x8F\x82\x29\xFD\x23\x2A\x7C\xDB\xEE\x8D\xF5"
-    "\x3D\xC5\x4B\xE4\x94\x05\x2F\x5F\x1E\x95\xCD\x32\x5F\xAE\xB3\x59"
-    "\x35\xC9\x39\x22\x68\x4E\xFA\x80\xB7\x59\x9C\x9D\xFA\x47\xB3\x72"
-    "\xB1\xC0\x41\x04\x23\x7D\x5A\xC1\x54\x91\x9F\x60\xC2\x42\xBE\x55"
-    "\x76\xB1\xAC\xDE\x97\x53\xBC\xD0\x90\x5C\xBD\xC0\x1D\x13\x40\x7B"
-    "\x0F\x75\x16\x65\xEC\xE3\x77\xC7\x78\x5B\x05\xB9\x3A\x83\xBA\x58"
-    "\x8D\xE9\x62\xF8\x8E\x88\x3D\xC7\x74\xF8\x47\x05\x29\x8F\x39\x08"
-    "\x01\xBC\x58\x9E\x97\x75\x81\xF9\x0B\xE9\xDD\xBC\x6A\xCC\xFB\xCE"
-    "\xC8\x82\xD6\xD0\xA2\x70\x1E\x4B\x2F\x6A\xB4\x47\x26\x3E\xCD\xE9"
-    "\xB7\xF1\xB9\x4E\x13\xC3\x47\xAC\x52\x6F\xCD\x71\xAB\xB4\x32\x0D"
-    "\x0E\x6D\xB9\x1A\xF5\x23\x1F\xE1\xE2\x45\xF4\x6D\x9C\xE1\xBA\xAE"
-    "\xAA\x4D\xEF\x43\xC6\x37\x21\xD3\xEE\xD4\x84\x56\x69\x1F\xFD\xF8"
-    "\xF1\x0F\xD9\x2D\x76\xC7\x17\xF4\xAF\x3E\x6A\x67\x3B\xE7\x86\x1C"
-    "\x37\x1C\xAD\xFD\x43\x65\xEE\x49\xDA\x28\x48\x3B\x10\x4B\x42\x44"
-    "\xBB\xD3\x26\xAE\x4D\x6F\x6F\xAB\x03\x0C\x2D\x31\x6C\xD2\x35\xA9"
-    "\x0A\x0B\x9F\x83\x08\x44\x89\x3A\x2C\x55\x09\x63\xAB\x3A\xF0\xC6"
-    "\x89\xA9\x08\xCC\x4C\x34\x9B\x25\xEF\x51\xCF\x50\x74\xEB\xA4\x69"
-    "\xD9\x2B\xB7\xA7\x92\x74\x68\x3A\xEE\x8B\x8F\x7C\xF9\x1C\xF9\x82"
-    "\xE9\x85\xD9\xF3\x01\x87\x7D\x0F\xED\xDA\x45\xBB\x0E\x66\xAC\x60"
-    "\xE2\x19\x89\xC3\x15\x0F\x6C\x10\xBC\x2F\x29\x42\x56\x7B\x0B\x4C"
-    "\x28\x1C\x14\xE7\x99\xE8\xEB\x7F\x4F\x81\x79\x78\x51\xF4\x15\x17"
-    "\x2B\x2A\x81\x20\x74\x4B\x4F\x54\x52\xAC\x94\x04\x32\xD0\x2D\x38"
-    "\x1B\x08\x89\x0D\xC0\x91\x76\x8C\x93\xD7\x51\x7C\xED\xB3\x37\x24"
-    "\xEF\x3B\xBF\xAD\xF3\x62\x56\xC5\xB6\x9C\x17\x5B\x3C\x20\xA0\x07"
-    "\x71\x20\xF7\xBC\x0F\xC9\x4A\x34\x24\xC9\x8B\x43\x4A\x35\x29\x16"
-    "\xE2\xB9\x61\x9B\x30\x04\x87\x3A\x99\x22\x68\x76\xB2\x07\x6D\x6D"
-    "\x43\xE0\xCF\xAF\x06\xFC\x79\x37\xF0\xCE\xD5\x80\x13\x64\x78\xAC"
-    "\xBE\x9D\x33\xEA\xF1\x43\xDC\x91\xA8\xD8\x8F\x7A\x88\x5B\x35\xD8"
-    "\x6B\x71\xF7\x96\x54\x72\x00\xD2\x6D\xED\x98\xE9\xD4\xDD\x30\x2C"
-    "\x31\xD7\x37\x5F\xC3\x59\xAA\x67\x31\x04\x68\x31\xDD\xF5\x77\xB7"
-    "\xE4\x0D\xAF\x03\xB5\xDB\x85\x97\xA7\xFF\xFA\x6B\x66\x17\x8D\xE1"
-    "\x86\x18\xDE\x60\x6A\xEF\x0F\x0D\x2C\x2B\xBE\x19\x4B\xDC\x2D\xEC"
-    "\xD0\x7B\xB6\xC2\x83\x89\x98\x2E\x36\xCF\x34\xBE\xB3\xA2\x39\xAD"
-    "\xA6\xD2\x86\xBC\xDC\x80\xF0\x79\x07\xD5\xF3\x9B\x24\x79\xDE\x46"
-    "\x6F\xE7\x1D\x01\xFF\x24\xE7\xD3\x6C\x90\x3B\x83\xD9\xDF\xDE\x69"
-    "\x2D\x3D\xC6\xD4\x61\x2D\xFD\xF3\x96\x4F\xBB\xC9\xED\x34\xBC\x04"
-    "\x55\xFC\x94\xA7\xC4\x94\xDD\x87\x67\xC4\xD4\x57\xE7\x2D\x4E\xF2"
-    "\xF4\x0E\xBF\x48\xEC\xB3\x8A\xB0\xC2\x1F\xEF\x29\x72\x4B\xBD\xC1"
-    "\xAF\xDE\x5B\xDE\x32\x57\xEF\xF9\x87\x77\xBE\x89\x1E\xAA\xA3\x4D"
-    "\xF4\xDD\x7B\x6F\x77\x4E\x14\x90\x7D\xE0\x41\x6A\x87\x9B\x82\xD3"
-    "\x3F\xFD\x33\x57\xE2\xC0\x95\x3D\x43\x95\xC5\x0F\x51\x85\xA7\xA8"
-    "\x94\xA5\xB8\x90\x39\xFE\xA7\xEC\x6F\xD0\x17\x20\xD8\x63\x56\x18"
-    "\xDB\xE4\xE6\xDD\xC7\x7D\xE3\xAA\x2E\xEC\x6D\x09\x7E\xA2\xFD\xBA"
-    "\x70\x2E\x11\x18\x3A\xD0\x7A\x84\x2A\x4B\x8B\x2C\xC0\x03\x95\xAD"
-    "\x76\x5F\xBC\x59\x27\xDF\xCC\xCC\x16\xF0\x81\x3C\xF5\xC5\x20\x7C"
-    "\xE8\x8B\x1B\x18\x9C\xF9\xE2\xF2\x3A\x30\xFA\x8B\x5D\xE7\xA9\x0E"
-    "\x8C\xF6\x1E\x73\x5C\xF4\x03\xF7\xA1\x09\x8C\xF6\x80\xF1\x72\xD2"
-    "\x93\x25\x06\x0D\xDB\xD3\x5C\xE8\x79\x39\xAA\x96\x55\xEC\x44\x17"
-    "\xD1\xD9\x75\xA0\x8B\x80\x52\xCB\x80\xAB\x9C\xE7\x62\xC0\x68\xAA"
-    "\xD8\xE6\x34\x76\xA8\x6B\x93\xD0\x93\x7E\xE7\x90\x78\xE1\xC6\xD5"
-    "\xBA\x53\xBE\xEE\x3A\xDD\xEC\xCE\x45\xB4\x7F\xF6\x88\x51\xC7\x91"
-    "\xF2\xC9\xA3\x4D\xD6\xE5\x76\xD4\xE8\x49\x58\x5F\x69\xC1\x2C\x51"
-    "\x37\x4A\xC0\x58\x5A\xB6\xC6\x89\x37\x62\xB4\xC4\xF8\x42\x6A\xC3"
-    "\x18\x0E\x8D\x3F\x5A\xB4\x68\x97\xF6\x1C\xA2\x53\xDC\x44\xB4\xC4"
-    "\xF3\xE4\xE0\xE9\x7F\x83\x73\x3C\x01\x01\x6D\xE2\xC7\xE2\x0D\xC2"
-    "\x79\x0C\x1B\x4C\xD9\x3D\xA2\xD8\xD4\x95\x5C\xA2\xC2\x93\xA2\x19"
-    "\x96\xB1\xEB\xAB\xBC\x2B\xEB\x3C\xAA\xE3\xFE\xEA\x8B\x3D\xAE\x01"
-    "\x57\x02\x19\x5F\x5E\x5C\x9E\x15\x51\xD0\xB5\x06\x5D\x8F\x82\xF7"
-    "\x97\x6D\x5E\x69\x36\x1B\xE8\x2E\x33\x65\x37\x38\xFD\x83\xB6\x19"
-    "\x06\x7F\x82\x41\x42\x37\x3D\x8F\x07\xDB\x82\x97\xBE\x78\xB9\xCD"
-    "\x30\xE6\xD8\x9E\xEE\x34\x2F\xBB\xF8\x9C\x5F\xCE\x9D\x37\xC6\x0C"
-    "\x71\xA5\x86\x54\xB8\x7F\x57\x59\xA8\x57\x62\x01\x8E\xF6\x38\x9E"
-    "\x1A\x1E\x63\x75\xD7\x2D\xF6\xEE\xE0\x8B\x69\x70\xE1\x3B\x30\x7A"
-    "\x32\x2B\xF2\x65\x86\xA7\xA4\xC0\x58\xE5\x52\x0E\x48\xCC\x5E\x87"
-    "\x67\xC7\xE5\xC9\x98\xE6\x92\xAF\x5D\xF5\xE8\xE7\x82\x90\xC5\x5F"
-    "\x16\x93\x66\x88\x17\xE5\x8E\x0C\x7D\xE7\xFA\x80\x91\x4C\x3D\x1C"
-    "\x52\xE9\x13\x4D\xDE\x6A\xBD\x31\xDA\x06\xDB\xF3\xE4\x93\x39\xF8"
-    "\xC4\x6B\x7E\x99\xB9\x30\xBA\x23\xA1\x66\x1B\x79\xBA\x29\x06\xA6"
-    "\xA7\x1F\xA7\xB5\xFE\x51\xA7\x58\x41\x9E\xA0\xC4\x71\xA9\x18\x90"
-    "\x99\xB0\x5C\xEE\x05\x47\xA5\xB8\x6C\x07\x47\x71\x8F\x23\x07\xDB"
-    "\x4A\x1D\x8F\x69\x83\x66\x1E\xC5\x0F\x9F\x8E\xFB\x1D\x69\x72\x9B"
-    "\xB3\xBE\x69\x84\xFA\xE3\x37\xD2\xFF\xCD\xE7\xC4\x2E\x8A\x1E\xCD"
-    "\x75\x0E\xAC\x4A\xF9\xC7\xB7\x4A\xF2\xB7\xC7\x4E\x12\xC3\xB1\x9F"
-    "\x1C\x51\x3C\x50\x89\x04\x63\x7C\xE8\x5F\x93\xC8\x37\x39\x76\xB3"
-    "\x58\x9A\x9F\xA6\x1E\x5F\xE7\xBB\x06\x9C\x9E\x3E\x92\x9B\x8A\x3E"
-    "\xF3\x24\x03\xC3\x41\x18\xE1\x22\x7E\x8C\x91\x77\xDD\xBE\xEE\x53"
-    "\x19\x50\x47\x47\x01\x61\x6D\xC8\x0A\x9D\xB6\xC6\x0B\xA8\x96\xFC"
-    "\xA7\xE3\x58\x81\x1F\x6B\x5C\x35\xD6\xFF\xB3\x02\xFD\x92\xE5\xF5"
-    "\x02\xF4\x15\x5E\xF2\x58\x56\x51\xE8\xC4\x54\x79\xA1\xF2\x79\xD0"
-    "\x81\x62\xC9\x63\xED\x08\x1C\x5C\xC4\xAE\x48\xD4\x85\xD9\x39\x18"
-    "\x16\x56\x4E\xC3\xD6\xC2\xFA\xA6\x73\x83\x65\xC7\x50\x93\x2A\xB3"
-    "\xEE\xA4\x76\x9D\xAE\x70\xDD\x49\x6D\x5B\x61\x4D\xED\xDA\x52\xBB"
-    "\x4E\x52\x9B\x40\xC2\x9A\x4F\x67\xBE\xD7\xDE\xDC\x50\x1F\xFB\x25"
-    "\x4C\xF2\x7B\xE3\xB5\x0D\x94\xAC\xE0\xEB\xE3\x92\xCD\xDF\x1F\x8A"
-    "\x25\xED\x7F\x23\x8B\x99\xFA\xFB\x92\x82\xFD\x34\x9D\xEB\x08\x8A"
-    "\xB5\x8B\x82\x49\xDA\x4F\xA2\x98\x86\x18\xF0\x0A\x98\x80\xB8\x51"
-    "\x58\x59\x7C\xC8\x90\xCE\xD7\x58\xC9\x67\x36\xCD\xD0\xE4\xF6\xEB"
-    "\xE1\x9B\xF6\xEC\x60\x48\x71\x49\xF7\x82\xEC\x93\x7B\x01\xBA\x90"
-    "\xC9\x46\xC1\xEA\x94\xD0\x5A\x66\x23\xA2\x63\x61\x95\x84\xF9\x7B"
-    "\x92\x9F\x2B\x3A\xD2\x62\x67\xBA\xDE\x91\x84\x3E\x84\xAE\x7D\x42"
-    "\xD7\x69\x42\xD7\x3E\xA1\x7E\x60\xE2\xE7\x9A\x92\x44\xE7\x90\x6A"
-    "\xC5\x30\xA0\x70\x82\xC2\x8F\xD5\xA5\xBD\xE6\x8B\x48\x50\x8A\x41"
-    "\xE0\xC5\x81\xEE\xFA\x9B\xD8\x7F\x84\xFF\x3A\x11\x98\xA8\xA2\xBE"
-    "\xC5\x99\x1F\x4E\x06\xDC\xC1\xEE\x60\x14\x24\x0C\xB4\xBD\x2E\xD3"
-    "\xC5\x1A\xD0\x18\xEB\xD4\xFA\x8D\x96\x09\x1B\x32\x0E\xD5\x98\x7D"
-    "\x08\xF3\xAC\x39\x54\xE5\x2A\x38\xBD\x70\x8C\x9C\x1B\x68\xAD\x50"
-    "\x64\xA4\x10\x35\x8A\xA7\x6A\x6A\x57\x51\xF7\x4E\x9D\x78\x76\xAE"
-    "\xDF\x71\x21\x0A\x10\x69\xEB\x30\x37\xA3\x47\x8B\x00\x4E\x56\xCB"
-    "\x25\xEE\x21\x71\xC8\x1B\xAE\xF5\x31\xD9\xC9\xB2\x84\x67\x1C\xB0"
-    "\x02\xFF\xB1\x0A\x4D\xA9\x5B\x46\x80\x0E\xA4\x60\x96\xE0\x06\xB5"
-    "\x75\xB7\xC8\xCF\x1B\x35\xF0\x7E\x19\x7E\xF6\x41\xD4\x30\xBE\x00"
-    "\x5B\xF9\x1B\x18\xBC\xD3\xE1\x17\xDB\x97\xA3\xCC\x7D\xB9\x6E\x7B"
-    "\x99\xCB\x97\xBF\x44\x6E\xC3\xB2\x84\x51\xD2\x76\x3F\x44\x20\x2B"
-    "\x66\xD0\xC2\xD0\x70\x0A\x94\xDB\xEE\xB6\xD4\x0A\x7E\x2C\x12\x7E"
-    "\x02\x35\xB3\xF3\xA0\xB5\x8C\xBB\xCC\x8D\xD8\xAE\x1E\x27\x7F\xF9"
-    "\xEC\x83\xA7\x35\x4D\xDB\x1F\x50\xDB\xFD\xA3\xE7\xFB\x9B\xE0\xD4"
-    "\x9B\x9B\x71\x9C\x91\xCD\x54\xDB\x64\x47\x19\x00\xC6\x75\x2B\x95"
-    "\x7E\x34\xC9\x06\x18\x13\x34\xB6\x6C\xCF\xE2\x47\x8D\x2B\x1A\x02"
-    "\xC1\x00\x53\x5C\xF1\x07\x56\x37\x88\xD3\x67\xDD\xB9\x0C\x5B\xB6"
-    "\x2B\x1C\x07\x01\xEF\x56\x38\x8F\xC2\xCD\x0A\xED\x72\x97\x3F\xC3"
-    "\xAD\x0A\x0D\x25\x7F\x4A\x77\x7A\xCE\x8E\x72\xFA\xDB\x96\xFA\x0B"
-    "\xF8\x57\x9E\x2D\xAA\x65\x93\xD1\x4D\xC4\x78\x87\xF8\xEB\xAA\x9A"
-    "\xD5\xBC\x41\xBD\x35\xBE\x8F\x97\x56\xF3\xDD\xE2\x87\x0D\xBE\x18"
-    "\xFF\xBD\xDE\xF2\x4A\xC1\xDC\x8E\xF7\x69\x87\xC5\xCE\xE9\x85\x28"
-    "\x17\xF3\x91\x57\xE6\x8A\x5E\x5C\x0B\xE4\xD9\xD9\x6A\xD6\x94\x3B"
-    "\x85\xBA\xEC\x96\x57\x09\x58\x64\x58\xCF\x4A\x58\x40\x6F\xEB\x12"
-    "\xEC\x44\x2D\xE7\x93\x25\x41\xDE\x9F\x16\xEA\x9B\x06\x40\x7E\xDC"
-    "\x53\x4E\x32\xB0\x23\x16\xB3\x7C\x4D\x62\x32\xC3\x28\x61\xBE\x3B"
-    "\x38\x70\xB9\xBF\x04\x4A\xD0\xB7\x4C\x8C\xB8\xCC\x96\xF2\xA7\x48"
-    "\x65\x83\xBF\xA8\x7A\xC6\xEE\x61\xD5\x93\xDC\xBD\xAC\xD7\x07\xD0"
-    "\xBE\xF8\xF1\xB5\x46\xCB\x28\xC8\xE8\x9B\x50\x54\x60\x53\x39\x17"
-    "\x78\xF7\x46\xAB\x3F\x40\xDC\x7D\x5C\x64\xCD\x81\xBD\x13\x81\xC4"
-    "\x0F\xAC\x7B\x57\xAC\xA3\xB4\x89\x26\x23\x08\x5D\xE6\x45\x9D\x62"
-    "\x5A\x19\xE4\x29\x02\x56\x3C\xF3\xB1\xC5\x31\x45\xB9\xE6\x87\x19"
-    "\xC2\xE0\x67\xAB\x3C\x86\x4F\xE9\x9A\x0C\x78\x55\x9D\x03\xDF\x04"
-    "\x6D\x19\x5D\x6A\x5D\x43\x15\x51\xAC\xE5\xBC\x05\xAB\x5A\xFD\x6C"
-    "\x8C\xD5\xC8\x63\x0C\x6B\x7E\x46\x79\xC9\xA0\x47\x01\x0C\x05\x56"
-    "\x61\x3C\x5A\x67\x2B\x3C\x49\x98\xB1\x88\xC3\x5C\x9E\x1D\xAD\x40"
-    "\x8D\xCF\xEB\x58\x15\x50\xAE\x3C\xCB\x67\x75\x94\x70\x13\xFD\xCE"
-    "\xD0\xE8\x8F\x33\xF0\xE5\xDC\x69\x87\xDA\x7A\x08\xFB\x6F\x52\xD3"
-    "\x96\x2A\xA8\x0E\x40\xE0\x57\x00\x2F\x51\x79\xC0\xC2\xA3\x5A\x0A"
-    "\x61\xE0\xA1\x4E\x43\x8F\xCB\xA9\x01\x9C\xC0\xFF\x74\xBE\x58\x35"
-    "\xD1\x06\x24\xF0\x97\x54\xA0\x1D\xE9\xEB\xE2\xC2\xC5\xD9\x85\x54"
-    "\xF0\xA1\x8B\xDC\x49\x62\x60\x04\x98\xAD\x00\x70\x17\x76\x60\x7E"
-    "\x5C\xF4\xC6\x6C\x15\x5C\x04\xB3\xD9\x39\x22\x99\x66\x8D\xFC\xC8"
-    "\xA8\xD6\x4B\x8D\x99\xF6\x91\xA2\x20\x62\x3B\x49\x6E\x32\x46\x61"
-    "\xD9\xEE\x73\x94\xE3\x08\x87\xF4\x48\x0F\x7D\x65\xAA\xE9\x81\x3B"
-    "\x32\x83\x6D\x64\xF9\x33\x32\x82\xA9\xA0\xA5\xD8\xD9\x47\x2C\x29"
-    "\x07\x30\x99\xE2\x97\x37\x18\x9E\x70\x40\xBD\xF7\x16\x16\x1B\xBA"
-    "\xD3\xE1\xF5\x98\x1E\xEE\x50\x97\xF2\x1B\xEC\x34\xFB\x02\x68\xE1"
-    "\xC7\xC8\x71\xF1\xB8\x9C\x0F\xB6\xB3\x3B\x3C\x69\x9B\x44\x96\x2C"
-    "\xC2\xF1\x54\x96\x54\x4E\x53\x95\x04\x50\x64\xB5\x20\x98\xB4\xBD"
-    "\x66\x22\xBD\xD7\xF4\x8F\xD8\x32\xB3\x9D\x7E\x04\x33\x6C\x91\xCF"
-    "\x2F\xED\x56\xE1\x72\x45\x29\x97\xC4\xEC\xCA\xE9\x96\x8E\xB4\x06"
-    "\x7A\xFC\xE2\xB9\xC6\x13\xF9\xE8\x9B\x17\x8F\x73\xB4\xA0\x03\x44"
-    "\x14\x5C\x1E\x62\xF2\xB6\xDA\xCA\x1A\x67\x1B\xBB\x3B\x42\x6F\xA3"
-    "\x3B\xAF\x9A\xE5\xED\x9B\xAF\x18\x17\x6F\xC9\x80\x9A\xF1\x49\x5E"
-    "\xD7\xD5\xA4\xA4\x29\x13\x08\xD1\x63\xC2\x6E\x11\x7E\xFF\xE2\xF5"
-    "\x13\x6D\x4C\xA1\x8A\x3D\xAB\x96\x98\x7F\x2F\xC7\x55\xD2\xA4\x20"
-    "\xAE\x9C\xCC\xE1\xD9\x34\xDC\x54\xEC\x1A\x53\xB4\x1F\xDB\x35\x98"
-    "\x62\x8C\x61\x6A\x78\x2A\x76\xB6\x94\xB2\xA1\xCF\xB3\x54\x90\xF9"
-    "\xAC\x3A\x19\x0E\x00\xAC\x38\x5B\xD0\x39\x08\x46\x99\x35\xF9\x51"
-    "\x86\xA6\x57\xD6\x9C\x97\x6E\xEB\xAE\x94\x2B\x5D\x8F\x83\x69\x35"
-    "\x59\x21\x5B\xC7\xFF\xB3\x2A\x96\xEB\x57\x4A\x2B\x0D\xE5\x88\x75"
-    "\x0F\x6C\x8B\x3E\xDD\x56\x9B\x7C\xBC\xBF\x07\xF6\xBE\x2C\x75\x49"
-    "\xA2\x74\x8C\xA2\xF4\x8B\x34\xED\xDD\x51\x66\x91\x85\x04\x10\x8C"
-    "\x8C\x9C\x93\xC3\xAF\xAD\x20\x82\xC4\xAA\x9C\x74\x56\x38\x09\xAA"
-    "\xE3\xE1\xDA\x56\x0A\x20\x44\xA9\xCE\x15\x85\x90\xFD\x1F\xE7\x47"
-    "\x11\xE9\xE7\x33\x89\xF0\x0C\x84\xDE\x93\xF5\xA3\xE2\x18\x65\x9C"
-    "\x57\x06\x20\xF2\x23\xBF\x2C\x45\x63\xD5\xB8\x9D\x35\x2B\xEB\xA6"
-    "\x98\x03\xCC\x47\x14\x7E\xA6\x2B\x21\xFC\xDF\x69\x82\xFA\x4B\xBE"
-    "\xC5\xC7\x19\x28\xA0\x65\x78\xFE\xC5\x34\xED\x3A\x83\xA0\xCF\x88"
-    "\x4C\x4D\x18\x2E\x50\xDB\xAC\x11\x15\xDD\x98\xEE\x8F\x89\x6A\x2B"
-    "\xAE\xE8\x34\x62\xDB\xD9\x25\x85\x2A\xD9\xB2\x66\x24\x45\x44\xF4"
-    "\x98\x84\xF4\xE4\x63\x4B\xD2\x2E\xCF\xFB\xC2\x06\x74\x45\x27\x1D"
-    "\x33\xD9\xA0\x4E\x88\x15\x4E\x1C\xA0\x74\xC4\x26\x72\x55\x94\x45"
-    "\xF5\x95\x8E\xE9\x88\xA4\xA8\x6C\x30\xA6\xA6\xAD\x56\x35\xBC\x62"
-    "\x83\xE9\xA8\x30\xE7\x79\x3C\xE8\x77\x45\xB1\xC0\x58\xA1\xD5\x9C"
-    "\x93\x45\xE8\x25\x5D\x8D\xD5\xDD\xAF\x69\x27\xCD\x65\x09\x2E\x26"
-    "\x8F\xF2\x19\x0E\xA0\x9A\x17\xC3\x8B\x59\xC1\x05\xF7\x5D\xC8\x1D"
-    "\xC6\x22\x1B\x8F\x41\x1A\xC8\xFD\x83\x03\x97\x2B\x37\x58\xB0\x5A"
-    "\xC8\x72\xD7\x2A\xC8\x1D\x9E\x2A\x79\xFB\xAA\x28\xE0\x82\xAB\x8E"
-    "\xEE\x5E\x75\x32\xAE\x3D\x59\x32\x5A\x0A\x8C\x14\x9A\x9D\xAF\x33"
-    "\x2F\x5B\xB4\x6E\x4C\x0F\x52\xFC\x80\x8E\xA6\x5A\x90\x48\x5C\x51"
-    "\x57\x9B\xA8\x0E\xAB\xAD\xC6\xF9\x74\xFA\x04\x87\x01\xB3\x09\x6C"
-    "\xFF\xC1\xE4\x14\xDF\x82\x31\x7D\x58\x61\xC8\x28\x7C\x9F\xC6\x4E"
-    "\x76\xB5\xE2\x20\x63\x9E\x51\x7C\x07\x4B\x86\x1F\xC9\x03\x10\xF3"
-    "\x79\x1B\x55\x17\x23\x64\x56\x4E\xDE\x31\x92\xA7\x7A\x55\x91\xA4"
-    "\x04\x54\x61\x3B\x8A\xC7\x45\x1C\xC5\x55\x0F\x9A\xBD\x72\x26\xD8"
-    "\x4F\xFA\xE4\xDF\x42\x9F\xB8\x34\xDD\x98\x3A\x71\x24\xE9\x96\xB4"
-    "\xC9\x4E\xA0\x4D\x76\x23\xDA\xE4\xBA\xEA\x04\x86\x58\xF5\xBE\xB8"
-    "\xB6\x46\x89\xA2\xB9\x82\x52\x89\x93\xB3\xA9\x5E\xE9\xC2\xD2\x47"
-    "\xB5\x24\x7B\x4C\x6B\x96\xFB\xEA\x0F\xF7\xF9\xFB\xB2\x2E\x8F\xCA"
-    "\x59\xD9\xAC\xE5\x5B\x32\xD8\xEA\xD3\xEA\x7C\x13\x73\xCD\xF7\x19"
-    "\x68\x99\xD2\x78\x5A\x2C\x36\xFD\x31\x96\x9B\x2E\x7B\x5A\x4E\xA7"
-    "\xC5\x3C\x65\xAE\xD1\x56\x03\x63\x8F\x1A\x6C\xBA\xE6\x36\x73\x0D"
-    "\x40\x48\x75\x62\x8D\xBF\x67\x8D\x0A\x74\xAA\xB5\x8E\xAB\xDA\x1C"
-    "\x1E\xDC\x4C\x29\x60\x7A\x71\xED\x52\x42\x87\x46\x8B\x7D\x04\x2D"
-    "\x6A\x1B\x2F\x42\xCB\xB5\x4C\x24\x8D\x1E\x05\xE0\x2B\x20\x7C\x3C"
-    "\x14\xDE\x88\x58\x30\x76\x8F\xD9\xFC\x2F\xC0\xA5\x4F\xF2\xF6\x2F"
-    "\x29\x6F\x82\xA0\x88\xBC\x25\xA7\xC5\x84\xBC\x21\xB6\x1B\x90\xB7"
-    "\x1F\xD5\x9E\x18\xEA\x53\xDE\x32\x43\x29\x58\x16\x73\xDC\x1F\x2A"
-    "\x29\xC8\x1A\xA7\xC9\xE4\x49\x08\xA3\xDD\x69\xD7\x8F\xFB\x06\x84"
-    "\x8C\x7F\xF1\x86\x9B\x2F\x66\xC1\x87\xBB\xC6\xEC\x3F\x52\x2E\x56"
-    "\xDA\x97\xA4\xBA\x6F\xBF\x63\xC4\xB6\x27\xD3\x7D\xC0\x24\xB9\x27"
-    "\x3C\xC5\xB1\x4E\xDA\x4D\x64\x6E\x9D\xE5\x0D\x8C\xBD\x5A\xFD\xC2"
-    "\xF3\x03\xC5\xA4\x5A\x4E\x4D\x39\x8B\x9B\xB6\x2F\xB8\x82\xED\xB1"
-    "\xDC\x25\xE5\x47\xFB\xD7\xEA\xB5\xBE\xFD\xA3\x37\x7D\xAE\xD4\x4F"
-    "\xAE\xB3\x3E\xD5\x5F\xE3\x8F\xD9\x61\x82\xA9\x37\xD9\x6B\x60\x70"
-    "\x32\xCE\x5F\x7F\x75\xB7\x9F\xC6\x65\x0D\x7F\x61\x40\x0C\xDF\x15"
-    "\xEB\xC0\x08\x75\x41\xEB\xA2\xF9\x09\x77\x89\x86\x66\xB3\xCA\x7D"
-    "\x7F\xA2\xDF\x13\xAA\x2B\x8E\xDF\xE7\xD8\x3C\x3D\x5F\x70\xBB\xE8"
-    "\xE7\x46\x52\x91\x25\xE4\x62\x59\xEC\xB0\x26\x68\xB1\xEA\x0C\xA3"
-    "\x1D\xDB\x8E\xF7\x3D\x99\xBD\xBC\xFB\x39\x0C\x1A\xAF\x58\x88\xC9"
-    "\xCB\x38\x16\xA1\xFF\x65\x3C\x2C\x81\x26\x19\x51\xC2\x5F\x17\x0C"
-    "\xB2\x98\x88\xE8\x38\x88\x03\x2F\x30\x45\x0F\x51\x5A\x07\x0C\x63"
-    "\x7B\x90\x62\x9D\x30\xCA\xFC\x41\x1C\x47\x46\xA1\x48\x1E\x2E\x23"
-    "\x1D\xD6\x2D\xAB\xD0\xA1\xF4\x29\xF2\x42\xF5\xA0\x5E\xEC\x73\x96"
-    "\x2A\x7A\xA4\x99\xCF\x22\x2F\x78\x7F\x9E\x1B\x1E\x6B\x31\x72\x39"
-    "\x65\xD7\x43\x43\xF2\x1D\x78\x63\x48\x8D\x73\x46\x49\x69\x6B\x56"
-    "\x14\x2C\x0F\x2B\x41\x8C\x13\x04\x04\x27\xF9\x19\x0C\xB0\xAA\x5A"
-    "\x98\x62\xEE\xD1\x31\x90\xBB\xBA\xF8\x66\x56\xE5\x0D\x57\x30\x06"
-    "\x23\x04\x44\x60\x4C\xEF\xED\x59\xAB\xC4\x00\x22\x76\x33\xE8\x7E"
-    "\x17\xAC\x61\xA7\x84\x0F\xF2\x19\xC8\x95\xDB\x8D\x35\xB9\x8B\xA2"
-    "\x76\x26\xA4\x49\x35\x8B\xC3\x1B\xA3\xD4\x8B\xA6\x1A\x57\xBC\x6B"
-    "\x6E\x2B\x6A\xDD\x73\x17\x5B\xEB\x76\xE7\x5D\x6F\xB2\x9B\x66\xF8"
-    "\xAD\x30\x8B\xD3\xDB\x6E\x85\xAD\xA8\x77\x2B\x4C\xD4\x40\xD0\x8A"
-    "\x3B\x56\x96\x63\x71\x77\xD2\x29\x41\x51\x77\xF2\x41\x10\x73\x87"
-    "\x2F\x4D\xC4\x1D\xFE\x08\xE2\xED\x14\x84\xFD\x31\x92\xB5\x19\x9F"
-    "\x0F\x55\x65\x7E\xC9\x43\xFC\x8E\x7F\x6C\xB0\xE7\x39\xCC\x1C\x48"
-    "\xE1\x43\x22\x40\xF1\x7B\xE4\xB7\x51\x99\xCB\xA6\x89\xEA\xB7\xC4"
-    "\xA7\x4C\x7B\x44\xA5\xBE\x8A\xB7\xDA\xF6\xC5\x43\x92\xEA\xAB\x78"
-    "\x6B\xE7\x73\x78\x6F\x7F\x44\x21\xA8\x2F\x1D\x30\xEE\x5D\x0B\x2B"
-    "\xD4\x3E\xC0\x89\x5F\xAD\x57\x93\xDE\xF9\xE8\x21\x8A\x36\xF6\xA5"
-    "\xA0\x94\x0C\x2A\x32\x1A\xD1\x84\x21\x30\xEF\x8B\xE5\xA3\xEA\xEC"
-    "\x0C\x8C\x73\x6E\x85\x39\x8B\xAB\x1D\x41\x6A\xC7\xCB\x09\x6E\xD1"
-    "\x4F\xBE\xA6\x38\x9E\xED\x4D\xA2\x4F\x54\xE8\x4F\xB8\xD3\xF8\x29"
-    "\x2E\xE4\x53\x5C\x48\x3A\x2E\xE4\x5F\x22\x26\xC4\xC8\x7E\x5B\xA0"
-    "\x85\x1A\x53\x9B\x25\x1F\xF8\x14\x63\xD1\x2E\x45\xBF\xD7\x18\x0B"
-    "\x07\x26\xA6\x1A\x6D\x7D\x5D\xD2\xF0\x29\xD6\xE1\xD3\xDE\x64\x50"
-    "\xF0\x5F\x6A\x6F\xF2\x53\xAC\x43\x74\x73\x92\xD5\x46\x7B\x6C\xC0"
-    "\x23\xFC\xFA\x29\x2E\xE0\xD3\xD8\xFB\x14\x17\x70\x93\x71\x01\x6A"
-    "\xE8\x75\x6D\x9F\x77\x8D\xBE\x64\xA3\x3E\x6D\x9D\x7F\xDA\x3A\xFF"
-    "\xB7\xDA\xCA\xFC\xB4\x75\xFE\x49\xDE\xFE\x3D\xB7\xCE\x9D\x2D\x13"
-    "\x9C\x2F\xA2\xDE\xEC\xBA\xA0\x4D\xF4\x9A\x4E\x2A\x92\xD7\x8E\xAE"
-    "\xF2\x43\x2F\x9E\xA0\x53\xE7\xC0\x95\xDE\x3D\xBE\xF3\xC5\xE6\xBF"
-    "\x0D\x76\x18\x2D\x68\x3C\xE1\x9F\xBD\xB4\x44\x7B\x08\x65\x8D\x0F"
-    "\x97\xCB\x7C\x3D\x2E\x6B\xFA\x3B\x0C\x9D\x88\x61\xBE\xDD\x00\x64"
-    "\x0C\x96\xE4\x13\x18\x35\x61\xE9\xEC\xE0\xAB\xC8\xEC\x1B\x80\x8D"
-    "\x89\x3E\xFF\x80\xFC\xA5\x6C\xCD\x27\xEF\xBB\xD3\xC6\x5B\xF3\xBE"
-    "\xA7\x7C\xE1\xF7\xDD\x4F\xE6\x1C\x57\xCF\xBC\xB7\xF7\xEF\xD0\x7F"
-    "\xD9\xB3\x62\x7D\x9F\x76\xBC\xB0\x35\xCB\x22\x3B\x3F\x2D\x96\x6A"
-    "\x07\xB2\xC6\x7C\x3B\xA8\x70\x6B\xDA\x3C\x47\xE8\x9C\xFD\x60\x73"
-    "\x1A\x20\x65\x43\x47\xD1\x97\xB4\x85\x56\xA0\x2A\x9D\xBC\x1B\x23"
-    "\x14\x6F\xB6\x7B\x48\xE8\xAE\xAB\x1C\xB3\x69\x6F\x4D\xCB\xE3\xE3"
-    "\xAD\x0C\x21\x8F\x8A\xE6\xBC\x00\x74\x98\xF8\x59\x86\xB2\xF0\x0D"
-    "\x39\x25\xE0\x56\x5B\xE2\x4C\x2C\x1B\x62\x0C\x76\xE0\xB6\x0F\x25"
-    "\x93\x20\x6A\x77\x1F\x6F\x70\x5C\x55\x60\x28\x0E\x8E\xF2\xE5\x40"
-    "\x83\x20\x12\xBD\xC7\x59\xBB\xBB\xFA\x04\x4E\x70\xC2\xD3\xEF\xD4"
-    "\xA3\xEE\xFC\x7A\xA5\x88\xF8\x70\xE9\xA6\xD2\xC5\xA4\x4C\xE6\x5D"
-    "\x36\x1E\x8F\x1D\xF8\x4B\xDA\xF9\x55\x8F\x04\x13\x89\x0A\x63\x69"
-    "\xDA\xE7\x69\x1C\xA9\xB2\xDC\x57\x44\x18\xC1\x01\x5F\x67\x6B\xFD"
-    "\x94\x41\x05\xB5\x87\x79\x5D\x17\xCB\x06\xCF\xE3\x1F\x58\x2D\x49"
-    "\x7B\xFC\xDE\x3A\x44\xAB\x3D\x3C\x9B\x7F\x17\xB5\x1D\x1F\x53\x1E"
-    "\x70\x5E\xF0\xC1\x80\x54\x60\x2C\xBC\xC2\xCF\xFD\xBD\xED\xA9\xBF"
-    "\xA8\x03\xEA\x44\xD9\x04\x7C\xA4\xFE\x18\xEF\x2D\x3A\xC5\xAC\xBA"
-    "\x1D\x71\x4D\xF7\x38\x51\x41\xE4\x31\x63\x72\xE6\x29\xAD\xA1\x1A"
-    "\x16\xD7\x9F\x94\x40\x38\x5C\xD0\x1B\xD2\x72\x02\x33\x2C\x23\x36"
-    "\x59\xFD\xC7\x3C\x7E\x03\x0F\xDF\x02\x1A\x2A\x17\xD1\x88\x27\xAD"
-    "\xF5\xF5\xAA\x48\x0F\x7C\x5B\x5F\x5B\x3D\x50\xBE\x76\xAA\x89\x2C"
-    "\x0C\x18\xD5\x18\x50\xD5\xDE\x65\x02\xF2\x2E\xAC\xA2\x29\x96\x67"
-    "\x98\x91\x9A\xAE\xD4\x43\x46\x9F\xD2\x78\xAE\xC5\x70\xEF\xD9\x35"
-    "\xB2\x07\x74\x70\xCE\xF5\x79\xE1\xA7\xAE\xB7\xA0\x1B\xB4\xC6\x0E"
-    "\xAC\xAB\x37\xE8\x91\x18\xC0\x57\x6E\x93\x21\xE4\xCA\xCD\xC2\x21"
-    "\x84\x34\xF2\x26\x9E\x09\x30\xD2\xB0\xD0\xDC\xA2\xC4\x68\x1C\xDB"
-    "\x87\xA0\x70\x6D\xB5\x9B\xB7\x1C\x08\xBD\xB6\x58\x3B\xB1\x5A\xA8"
-    "\x5C\x04\x3B\xAF\xD6\xA3\x52\x3E\x47\x98\x1E\x41\x97\xC0\xD7\xF3"
-    "\x4A\x4D\x34\x7E\xBF\xDB\xAB\x32\x9F\xCE\x55\xD0\x52\xB5\x9C\xE2"
-    "\x9D\x8B\x2E\x8B\xED\x2D\x39\x74\x55\x84\x9D\xC7\xAE\x2E\x3E\x3F"
-    "\xCE\x27\x37\x21\x40\xE9\x41\x91\xFD\xE1\x0F\x8E\x8E\xBE\xDB\x4F"
-    "\xD6\x5C\xF5\x62\x7A\xE5\xDA\x5D\x6E\x6A\x6F\x51\x66\xA6\xB6\x3E"
-    "\xFA\xCC\x36\x27\xA6\xD2\x8C\xC3\x87\xC1\xC0\xE0\x58\x3B\x32\x42"
-    "\x16\x88\x86\xD1\x51\x5A\xB4\x14\x75\x24\x44\x22\x53\x99\xD3\x08"
-    "\xE0\xEA\xEC\xE0\xCD\xAE\x96\x50\x45\x97\x51\x6C\xBD\xB8\x73\x80"
-    "\xFE\x4C\xC1\x7E\x6F\x8A\xF8\xFB\x60\xBD\xD4\xC2\x7F\x27\x07\x3B"
-    "\x73\x6B\x36\x73\xB8\x55\x63\x82\x9A\xB3\xEA\xBD\xF4\x68\x95\x73"
-    "\x0C\x06\x22\x78\x0B\x86\x5C\xA5\xD4\xD5\xE4\x8E\x3C\x55\xC4\x8D"
-    "\x23\x23\x40\xF5\x4B\xAA\x93\xD1\x29\x3E\x64\x48\xD2\x6E\x5A\xD2"
-    "\xAF\xC6\x2D\xCB\x0D\x69\x3A\x85\x32\xA8\xC3\x92\xAE\xDE\xBD\xA9"
-    "\x3E\x09\x59\xAD\x2D\xCE\x40\x34\xEB\x18\xBB\x34\x65\x49\x86\xA5"
-    "\x1A\x26\x6A\x54\xAB\x4F\x47\xCA\x4D\x58\x17\x3E\x2E\xE7\x65\x53"
-    "\xE6\x33\x45\x86\x99\x42\x74\x9F\xDA\x0E\x9D\xBA\x51\xAC\x0E\xA1"
-    "\x54\x49\x6F\x2A\x9D\x3E\xD4\xA6\xB0\xB1\xAF\x3B\xD6\x9D\xF1\x61"
-    "\xB8\x89\x3D\x87\xA3\x91\xF5\x01\xDA\xBB\x6E\xDC\xAF\xEF\x0B\x4B"
-    "\x99\x7E\x56\xC0\xB4\xFA\x14\x3C\xFF\x16\x13\x78\x2B\x95\x63\xA2"
-    "\x09\x88\x79\xC6\xFB\x44\xD7\x17\x33\xF6\x91\x1A\xAD\xCC\xE0\x13"
-    "\x47\x0B\x69\x48\xC3\xAD\x51\x30\xB4\x7D\x68\x7B\x27\xA8\x0E\x4D"
-    "\xD5\xFB\xE2\x1D\x33\xD6\xBC\x9A\xEF\xE0\x1E\x03\x0A\x26\x0E\xE5"
-    "\x48\x3F\x9F\x24\xB8\x7F\x33\x4A\x30\x65\xFE\x5A\x5E\x0B\xA8\x7E"
-    "\xAA\xED\xA5\x55\xF2\x38\x61\xA0\xFB\x50\x29\x2D\x69\x37\x99\xB9"
-    "\x9C\xAE\xC8\xC6\x0D\x8E\x8C\x17\x44\xEE\x1A\x17\x13\x78\x51\xAE"
-    "\x51\x6B\x68\xCD\x66\xAD\xF8\xF4\x5F\xCD\xBF\x77\x3C\xC5\x01\x1B"
-    "\x9F\x89\xE9\x8B\x00\x40\xF7\x0D\xED\x0D\x14\x74\xA3\x04\x42\x8F"
-    "\xF9\x72\xEA\x7D\x75\x97\x83\x61\xD9\xBD\xCC\xF6\x8A\x5E\xF1\x3A"
-    "\x92\x2C\x50\x5F\xC6\x7B\xB2\xCF\x7C\x4B\xF3\xF3\x62\x3D\xDC\xEE"
-    "\x58\x42\x28\x3E\x83\x49\x76\x4A\xB9\xD3\xA0\x96\xC5\x5A\xDF\xA8"
-    "\xED\xD8\xA6\x74\xBB\x07\xE5\x52\x9B\x72\xC4\x3F\x0A\x3C\x69\x1B"
-    "\x57\xA0\xA3\x0A\x51\x91\xD3\x45\x35\xE9\x13\x3D\xB8\xE0\xAB\x45"
-    "\x1D\x53\x29\xC5\x05\xC6\x0B\xD6\xBE\x37\x8B\x05\x95\x9C\x3C\xFC"
-    "\xD5\xF1\x03\x19\xAB\x45\x5D\x45\xA5\x87\xA7\x84\x11\xD6\x1E\x41"
-    "\x89\xDF\xD2\x1B\xA4\x4C\x6B\xBE\xB0\x82\xBE\xBA\xD7\x40\xE9\xB7"
-    "\xFA\xAB\x78\x7B\x62\xDF\x9E\x84\x6F\xDD\x15\x30\x63\x10\x0F\x5C"
-    "\x3C\x2E\xE4\x49\x0B\xA4\x6B\x1E\x32\xB0\xFB\x2C\x86\x19\xA5\x4D"
-    "\x22\xC6\xDF\x09\xBC\x16\xD4\x79\xE4\x42\x5B\x20\xEF\x9D\xB0\xD5"
-    "\xE0\xBD\xF8\x15\xC0\x98\xD7\xE2\x8D\x63\x0C\x00\x80\xF3\x3B\x02"
-    "\x27\x40\xE4\x5B\x9C\x0F\xF1\x15\xFE\xF5\x5B\xB9\x58\xEB\xC6\x2D"
-    "\xD4\xBD\x29\x97\xFB\x8E\xE3\x4F\x09\xA4\x9B\xA7\x93\x64\x75\x99"
-    "\x83\x9A\xA1\x19\x65\x30\xBE\xBF\x6A\xCA\x59\x53\x16\x18\xBF\x3A"
-    "\x10\x80\xE6\xC2\x52\x05\x52\x46\x60\xF2\xA3\xBA\x1B\x86\xD4\x78"
-    "\x02\xCC\xF3\x49\x82\x5D\xF3\x1E\x56\x9B\xDA\x69\x1E\x78\x24\x85"
-    "\xC7\x4D\x38\xCC\x4F\xAB\xBA\x19\x69\x8F\xFC\xAB\x6A\xF2\xAE\x30"
-    "\x8E\x7B\xD4\x84\xCB\xD5\x5C\xC5\x64\xD1\x8E\x87\x8D\x86\xC5\x5C"
-    "\xC5\xC6\x3F\x9F\x0D\x06\xF6\x8D\xC2\xF5\x88\xB6\x8A\xCC\x4D\x3E"
-    "\xB4\xC7\x0B\x1A\xFC\xD5\xA2\x28\xA6\x6A\x93\x23\xC4\x7A\x08\x2B"
-    "\x3F\x82\xF0\x0A\x9E\xE5\x17\xB1\xC7\xE4\x4B\xE6\x65\x9C\x87\x07"
-    "\x33\xDE\x83\x8C\xCF\x66\x5E\x09\xCA\x88\x2F\x5E\xD0\x1B\xB1\xC7"
-    "\xFB\x8A\x31\xC6\xF7\x77\xF9\x5D\x7C\xEF\x83\x5E\x7A\x7B\x31\x86"
-    "\x3A\xDC\x63\xB2\xD3\xE8\x79\x39\x9F\x56\xE7\x63\xBC\x91\xBA\xA8"
-    "\x9B\x87\xF3\xF2\x8C\x52\x47\x7F\x03\x76\x40\x31\x3C\x5C\x2C\xAB"
-    "\x49\x51\x63\x4A\xCA\xEF\xAA\x6A\xD1\xE3\x0C\x9C\x13\xEA\x90\xA2"
-    "\x40\xF0\x47\x90\x30\xC1\xED\xA5\xD9\xB5\x29\x90\xCB\x98\x9C\x9C"
-    "\xD5\xB0\xBC\x2D\xAB\x29\xE6\x3F\x9F\xAD\xE9\x9E\x55\x46\x69\x4C"
-    "\x60\x94\x1A\x68\x7D\xFB\x0A\x1E\xAF\x3C\x82\xFE\x38\x5B\x24\xAE"
-    "\x93\xF2\x08\x1D\x1A\x78\xC9\x03\x05\xA3\x44\xD5\xB9\x62\xC4\xD8"
-    "\x42\xDC\xE3\xBE\x25\x74\xC5\x6E\xBA\x8C\xF6\x4D\x59\xBF\x2C\xF2"
-    "\xE9\x3A\xB5\x9C\x36\x63\x0F\xAF\x00\x77\x1E\x8C\x4D\xC9\xC4\x32"
-    "\x9B\x83\x42\x73\xC3\x56\x0C\x81\xA0\x13\x1C\x47\xAB\x86\x22\x1C"
-    "\x41\x2B\xCE\xAB\x73\xE8\x95\x13\xBD\xA8\x46\x39\x2F\xE6\x53\x8E"
-    "\x63\x00\x78\xDA\x02\xC5\xB2\x38\x31\x38\x2F\x6C\x77\xC9\x5A\xE5"
-    "\x78\x31\xE0\x9B\xB7\xCB\x94\xD5\x2D\x73\x70\x3B\xB4\x74\x20\xFF"
-    "\x2F\x0F\xB7\x53\x76\xCF\x68\xA7\x80\x77\x4F\x8F\x5D\xC6\x79\xEC"
-    "\x9A\x52\x68\xF1\x5C\x43\x83\x65\xA0\x9C\xEC\x3E\xD3\xE4\x63\x60"
-    "\x19\xDD\x42\xAF\x4B\x9D\x81\x94\xA0\xC7\xDD\xAC\x2F\x60\x41\x4F"
-    "\x06\x59\xB1\x7C\xCF\x91\xFB\x88\x64\xEB\xC9\xCB\x97\x2F\x5E\x0E"
-    "\xB7\xB7\x40\xD7\x83\x7C\x8D\xA3\xEC\x16\x04\x6C\xCA\x6D\x5B\x34"
-    "\xC5\xEC\x9E\x98\x23\xAC\xD6\x25\x1D\x46\x7B\x9C\x16\xCB\x58\xEE"
-    "\x18\x6A\x35\x31\x4A\x98\xA6\xB8\x4D\x5C\x65\xE7\x74\xEF\x16\x6F"
-    "\x18\xE7\x73\x5A\x4A\x69\x2E\x6A\xBE\x64\x2E\xF9\x84\x3D\x08\xEE"
-    "\x8A\x4E\x6A\xFA\xE3\xB6\x42\x21\xD8\x28\xCA\xC2\xB4\xCD\xAE\xEE"
-    "\x6B\xE6\x11\x98\x09\xF3\x82\x28\x8B\x76\xA3\xDA\xEB\xBD\x3A\xB5"
-    "\xC1\x66\xF1\x46\x31\x21\x8F\xA8\x2B\x1C\x2D\x4C\x9D\x41\x21\x6D"
-    "\xB4\x99\x9E\x88\x7F\x86\x55\x85\x4B\x36\xF6\xD0\x5F\xE0\x61\x64"
-    "\xF3\x9D\xB4\xD2\x70\xC1\x7D\x6D\x95\xAF\xDF\xAE\x40\x3B\x87\x6A"
-    "\xD4\x27\x1F\x2F\x31\xAA\xC9\x16\xD0\xC9\xC8\x89\x78\x14\x96\xB2"
-    "\x31\x21\x05\xDD\xC7\x7C\x7D\x5B\xC4\x07\x14\xB9\xAA\xD9\xF4\x48"
-    "\x02\x68\xDB\x24\x05\xF0\x6C\x91\x7E\x55\xA6\x5F\x4D\x13\xD3\x5E"
-    "\xBD\x9E\x4F\x24\xE5\xC3\xF3\xD3\xA2\xC0\x4C\xBE\x5E\x8B\x46\x86"
-    "\xF4\x91\xA1\x71\x04\xC4\xC0\xFF\x4B\xF8\xBF\xE3\xD0\x73\x2F\x6B"
-    "\x06\x71\x84\x31\x88\x77\x3E\xD1\x96\x20\x8E\x56\xCD\xEB\xB3\x0A"
-    "\x57\x8C\x12\x98\x36\xAC\xCF\x0B\x16\x1F\xEB\xB1\x8A\xCD\xF2\x6E"
-    "\x45\xE5\xF1\x30\x30\x08\xEF\x1E\xF8\xAD\x08\x02\x55\x48\x08\xA5"
-    "\xE8\x77\x36\x42\xE5\xF7\x96\x32\x83\x17\x75\xCF\x24\x34\x31\x1F"
-    "\xB7\x1E\x6A\x13\x08\xB5\xC0\x61\x36\x6F\xA8\x4D\x74\x45\x75\xA2"
-    "\x11\x77\xEF\x86\xED\x08\x9B\xE1\xB7\x83\x2D\x7B\x8C\xD5\x44\xD4"
-    "\xDF\x53\xA7\x9B\x9E\x7C\x80\x57\xC4\x6C\x77\xC3\xDB\x0E\xDE\xF5"
-    "\xEF\x7B\x88\xC3\x1B\x31\xB0\x25\x8D\x67\x6A\x44\x53\x5A\x2F\x3C"
-    "\xCF\x16\xFD\xC0\xCA\x7E\x60\xD3\xC8\xD5\x12\xDE\x4F\xE4\x27\xAB"
-    "\xD8\x33\xB4\x30\xA1\x87\xCC\xB0\xA3\x1B\x00\xF0\xD4\x30\x3E\x74"
-    "\x07\xAB\x2D\x5E\x57\xEC\xF4\x20\x41\xCD\xD7\x74\x83\x00\x2C\xE3"
-    "\x66\x25\xAC\x3C\xC9\x23\x85\x2B\x02\x66\xBF\x5F\xF4\x1C\x05\xBC"
-    "\xAC\xEB\x95\x94\x22\xD6\x57\xE3\x36\xA2\xE5\x5A\x66\x68\x7F\xE0"
-    "\x8D\x72\x30\x8B\xE2\x55\x55\x87\x62\x80\xAA\x6F\xDB\x9C\x56\x9F"
-    "\xBE\xEF\x7B\xE8\xEC\x1A\x68\x68\x7F\x68\x74\xE5\xDC\x3E\xB4\xE3"
-    "\x7D\x9B\xF3\xE9\x2B\x74\x7E\xCB\x9A\x02\x1A\x8D\x4C\x25\x95\x09"
-    "\x0B\x52\xBC\xEF\x13\x7F\xD3\x36\x1B\xA1\xB7\xE3\xC2\x29\x5C\xCC"
-    "\x69\x5C\x6B\xC5\x7F\x5C\x2D\xC1\x38\x96\xF2\xAE\xDF\xE0\xAD\x3D"
-    "\xCC\xD6\xED\x4E\x7D\xA4\x04\x50\x8C\xED\xD8\x25\x32\x48\x37\x4C"
-    "\x71\xD8\x19\xD5\xF1\xB1\x3B\xAC\x93\xFC\xDF\x4D\xF3\x72\xD7\x9F"
-    "\x46\x7D\xD3\x3D\xDD\x38\x3D\x5C\xFB\xEB\x59\x35\x3D\xFF\xB2\x28"
-    "\xA7\xC3\xCF\x3E\x70\x79\xBA\x7A\x47\xA3\xE0\x1F\x0A\x0B\xFD\x78"
-    "\xB6\xE0\x3F\x25\xFF\x99\x5E\x6E\xFF\x92\x58\xFE\xC1\xBC\xF0\xBC"
-    "\x6A\xAA\x25\x2D\x6F\x87\x67\xF8\xF5\xC5\xBC\xA0\x5F\x40\x19\xFE"
-    "\x7C\x7D\x5E\xD1\x4F\x2F\x34\xEF\x6A\x72\x10\x95\x01\x4B\x80\x7E"
-    "\xEE\x32\x5E\xAE\xCB\x3D\x0A\x5D\x40\x67\xA1\xEE\x12\xEF\xDE\x25"
-    "\x4B\x76\x78\xA6\x76\x1C\xF1\x06\xA9\xD5\x32\x57\x8B\x93\xEC\x14"
-    "\x90\xF0\x06\x74\xD9\xAC\x9D\x95\x0C\x7E\x12\xD9\x05\x52\x0D\xE9"
-    "\xCB\x50\xDD\xC7\x35\x75\x03\xF4\xA6\x2C\xC7\xFD\x2B\x8B\x26\xFB"
-    "\x93\xE9\xF8\x16\x60\xBF\xAD\x72\x43\x05\x5E\xE5\x85\xB7\x40\xCE"
-    "\x8A\x25\x2E\xDE\x47\x7C\x81\xFC\x37\xD5\xF2\x3C\x5F\x46\x45\xED"
-    "\x04\x10\x00\x15\x17\x54\xF3\x9A\xFE\x35\xA5\xE9\x97\x44\x00\xC4"
-    "\x24\xAC\xC6\x57\x64\x8D\xE3\xD0\x6B\x66\xC5\x4E\x4D\x17\xDF\x8A"
-    "\x38\x4E\x23\x3D\x49\xC3\xCB\x5C\xBC\xA0\x0A\xF1\x67\x2F\xDB\x42"
-    "\xC3\x61\x6B\x94\x6D\x1D\x33\x09\xF8\x75\x59\x00\xA6\xBA\xC0\xAF"
-    "\x28\x30\xF4\x08\xE5\x61\x2B\x65\x2C\x91\x90\xC2\xCA\x9C\x39\xB7"
-    "\x97\x1D\x63\x46\x09\x76\x9B\xED\x8E\x77\x91\xC0\x07\xE3\xDD\x11"
-    "\xAE\xAD\x18\x02\x14\xFE\xF1\x8A\x84\x7E\x59\x35\xD0\x20\x83\x57"
-    "\x3B\xAF\xBD\x5C\x2E\x9A\x58\x7B\x86\x9B\x1B\xC1\x2B\x6D\x79\xA0"
-    "\x30\x61\xB3\x01\xF7\x5E\x13\xEB\x82\x61\xA1\x50\x8D\xF4\x6F\x6B"
-    "\x5D\xCB\x36\x6D\xAB\x17\x1F\xE2\xAF\xF9\x0E\x62\xF6\x4D\x0E\x9D"
-    "\x37\x23\x64\xC0\x08\x9B\x2F\xE7\xD8\x1A\xE6\xBF\xC9\xA9\x5E\x73"
-    "\x04\xAB\x8D\x1C\x9A\xC3\xFD\xB2\x17\x89\x5E\x35\x6B\x0C\x68\x53"
-    "\x3E\x7F\xA7\x5B\xB4\x1B\xDE\x55\x77\x19\x41\xAB\xBB\x79\x03\xCC"
-    "\x5E\x83\x5C\xC6\x74\xD7\xA8\xA5\x69\x83\x1A\x77\xBC\x2A\x77\x36"
-    "\xAD\x93\xC4\xF6\x1A\x15\x6E\xDC\x46\x1A\x1E\x57\xE7\xE9\x06\x0D"
-    "\x54\xE1\x92\xB1\xBA\xF4\x69\xA9\x82\xEF\x13\x0F\xA4\x3E\x03\x65"
-    "\x04\x06\x27\x66\x96\x3A\x99\x97\xFF\xB0\x96\xD4\x5E\x36\xC8\x3E"
-    "\xD7\x3F\x22\xF9\x3E\x55\x23\x3C\x2F\xA6\x4B\x5B\xCB\x8A\x91\x54"
-    "\xD7\xDF\xAB\x75\x8D\x17\x59\x7B\xCA\x6B\xA8\x75\x00\x30\xBD\x29"
-    "\x8A\x25\x05\xC7\x4B\x8D\x96\x52\x68\x5A\xF7\xE8\xF2\xBC\x29\xAB"
-    "\x74\xCF\x9E\xA9\x8E\x6E\xD7\x55\xDB\x83\x3B\x0F\x8C\x32\x4A\x6A"
-    "\x32\x45\xC3\xF5\xB0\xD9\x33\xD2\x8A\xB8\x6F\x66\xE5\x02\xB0\xA9"
-    "\xE7\x36\xA9\x55\x39\x7F\x8F\x1B\x0C\x16\xEB\x48\xA4\x32\x83\x3F"
-    "\xF3\x1C\x18\x9F\xCF\x04\x40\xB2\x2A\x4D\xF9\xED\x55\xE5\x73\xFC"
-    "\xFF\xE1\x6D\xA0\x96\x47\xCC\x15\xAB\xEF\x29\x94\x85\x6F\x0C\x55"
-    "\xD7\xA3\x13\xEA\xA1\x8E\x98\x69\xE8\xB2\xA7\x02\x77\x4A\x69\xAD"
-    "\x0B\xC2\x8B\x57\x40\x81\x54\x62\xA1\xED\xAE\x1E\xFA\x48\xB5\xDF"
-    "\xE2\x8C\xF4\xDF\x4A\xA8\x82\x39\xC9\x11\xE9\x91\x2B\x93\x38\x51"
-    "\x05\x80\xD8\xE7\x23\x47\x02\x68\x3E\x0B\xE0\x90\x67\x23\x87\x83"
-    "\xDB\x99\x01\xFC\x10\xAF\xDF\x99\xDB\x3C\xCA\x76\x1E\xD8\xC9\x4D"
-    "\x17\x76\x47\x90\x33\x31\xBA\xED\x90\x85\xA5\x39\x9C\x2F\x16\xB3"
-    "\xB5\xE8\xBA\x21\x75\xDC\x3F\xF0\xAA\xC3\x39\xBA\x36\xE8\x8D\x5E"
-    "\x4D\x36\x00\x81\xFB\x74\xB2\xD7\x32\xF2\x0B\xE4\x47\xB5\x4B\xEE"
-    "\x76\xF6\xE5\x81\xC3\x89\x58\x30\xB7\x6C\x76\xB0\x34\x11\x98\x9D"
-    "\xB6\x10\x66\x97\xAB\x7E\x08\x8D\xCB\x93\x28\xE6\x90\x07\xC7\xD0"
-    "\x91\xB2\x62\xD9\xDD\x5D\xC4\xEF\x78\x8D\x4F\xB4\x45\xCA\x4C\x17"
-    "\xD5\x3B\x5E\xAB\x13\x5E\x20\xF4\x32\xAC\xCE\x70\xA1\x0F\xBD\xCE"
-    "\x17\x60\xA3\x63\x1F\x87\x91\x81\xA2\x2D\x4C\x98\xA3\x35\x6A\x87"
-    "\xD6\x7D\x07\x8C\xA6\xD6\x04\x5C\xC8\x32\x4D\xA1\xBE\xE0\xAC\xCA"
-    "\x6A\x1C\xE2\x28\x3C\xB4\xDC\xA3\x44\x5E\x28\x33\x05\x5B\xD3\xF3"
-    "\x18\x33\xB8\xB6\xAF\x0E\x70\x6D\x1F\xAC\x7E\xF9\x52\x6F\x52\x0A"
-    "\x3B\x8C\x7C\x5A\x9D\xCF\xD5\x63\xAA\xC3\x29\x21\xC8\xBF\x77\x40"
-    "\x8A\x69\xC7\x65\x6C\xF7\x7A\x1B\x19\x45\x15\x8E\x44\x7D\xF4\x30"
-    "\xAC\xCE\x32\x55\xD5\xF6\x79\xB2\x36\x87\x7B\x73\xC0\xAB\x1C\xFF"
-    "\xEC\xEA\xC1\x8D\x11\x0C\xF9\x6D\xC0\x68\xB1\x93\x35\xBA\xF4\x66"
-    "\x4B\xDC\x10\x23\x7E\x97\xA0\x2E\x51\x48\xC9\x09\xE4\x8E\xC0\x84"
-    "\xDD\x63\xE8\x1B\x09\xCE\x24\x43\x6A\xF4\xAA\x07\x10\x28\xB3\x61"
-    "\x68\xDB\x3D\x92\x3C\xDF\xDE\x6C\x35\xA4\x27\x13\xCB\xAE\x6B\x5B"
-    "\x0E\xA2\xA3\xAF\x6D\x36\x20\x59\x34\x8F\xDF\xCC\x44\x3E\xCE\x1E"
-    "\xAB\x43\x39\x6A\xE3\x6C\x9C\xAC\x99\x5A\x71\x73\x26\x44\x77\xCD"
-    "\xB2\x27\x78\x4A\xBF\xB5\x39\xDD\x21\x06\x9F\x24\x89\x21\x2E\xDC"
-    "\xAE\x81\xD1\x42\x4C\xDA\xE4\xB8\xE6\x0A\x58\x8C\x43\xA1\x62\x23"
-    "\x03\x72\x24\x66\x23\x23\x8B\x2A\x8A\x61\x24\x64\xC4\x3C\xCA\xBC"
-    "\x02\xC4\x3B\xD0\x9F\x23\xC1\x4A\x52\xA7\x59\x60\x6C\xA0\xEA\x66"
-    "\x3E\x0E\x71\xC9\x6B\x07\xB2\xEF\x40\x12\x4B\x76\x0C\x59\x6B\x6C"
-    "\x6B\x90\x0E\xF2\xD6\x74\x6A\x9A\x91\x69\x8E\x68\xC6\xC8\x90\x2C"
-    "\xC8\x0D\xE3\x2E\x3C\x87\x9B\xA8\x7F\x94\x91\x4D\x60\x6A\x24\x7B"
-    "\x40\xE3\xC4\xF3\x08\xFC\x5E\x28\x3C\x04\xB0\x55\x75\xE9\x3F\xDC"
-    "\x74\x89\xEA\xB7\x74\x5F\x3B\xFB\x82\x2E\xB7\xDD\x0D\xA2\xA3\xD5"
-    "\xF1\x31\x5E\x3A\x49\x19\x5A\xA9\xA2\x39\xDE\xC2\xE5\x3B\xEB\x0E"
-    "\xD5\x83\xFF\x8F\xF6\x2B\x0F\xB2\x37\x6F\xBB\xF8\x33\xE0\xAD\xA2"
-    "\x81\xE3\x56\x0E\x9C\xA6\x40\x2A\xE5\x1A\xC4\x4B\xCF\x63\xF4\x26"
-    "\x70\x2F\x75\x99\x3E\x15\x5C\xD7\x87\x17\xF5\xB4\x6E\x86\xB4\xAB"
-    "\x87\xD9\x3B\xD7\xD6\xC7\x60\x36\xC8\xE8\x9D\x93\xA2\xD9\xAA\xB3"
-    "\xF3\x25\xCC\xC2\xA0\x51\x4A\x0C\x3B\x9D\x9C\x21\xEB\xF8\xD1\x92"
-    "\xEF\x68\xCE\x31\xCC\x01\x03\xDB\x59\xB1\xF5\xF4\x0D\xBE\x62\x62"
-    "\xD2\xFA\xE8\x3A\x4A\x48\xF3\xCB\xA9\x2B\xA6\x17\xC0\x1E\x6B\xDD"
-    "\x93\xF7\xDF\x8F\x5B\x62\x89\x12\xF0\x2A\xB2\x27\x06\x1D\x2D\x61"
-    "\xA3\x38\x52\x45\xF0\x13\x09\x6D\x70\x62\x3F\x62\x9F\x20\x9C\x2F"
-    "\x13\x43\x15\x5F\x3A\xBC\xD6\x39\xF8\x54\xFC\x46\x65\xE3\x35\xF0"
-    "\x08\xCB\x09\xAC\xB5\xC6\xD1\x9A\x2E\x53\xCD\xBC\x9B\x8C\x0D\x6A"
-    "\x6B\xA8\xE0\x0F\x4B\xCC\xC1\x81\x6C\x48\x5B\x51\xFC\x88\x14\xD1"
-    "\x74\xEB\x3C\x59\xA1\xA0\x7D\x38\xCA\xBC\xB8\x28\x26\x2B\xB0\xD2"
-    "\x75\x8B\x92\xA8\xE2\x8D\xC2\x8F\x3D\x6F\x03\xD4\xFC\xAC\xC6\xC5"
-    "\x41\xF6\x0B\x0E\x94\xCF\x3E\xC8\x38\x49\x72\xC4\x3B\x6D\xD1\x9E"
-    "\xF8\x8E\x76\x33\xBF\x22\x72\xAD\xAA\x6B\xE5\x1F\x7E\xDC\x8E\x77"
-    "\x48\x48\x4B\x0B\x37\x4E\x84\x79\xBA\xE9\x4D\x62\x1F\xC9\xEC\x0D"
-    "\x59\x19\x3E\x75\x9F\x44\x97\x2D\xF8\xE1\xD8\x1C\x4A\x92\x26\x55"
-    "\x17\x47\xE9\x44\x9C\x97\xAD\x31\x36\xFA\x73\xBB\x23\xA5\x2D\xB3"
-    "\x99\xF0\x7E\xA6\xBD\x9C\xD7\x5F\xAA\xFC\x4C\xCB\x54\x65\x45\x0E"
-    "\x71\xB5\x30\x1E\xA3\x93\x44\xC5\x52\xF0\xE8\xA8\x27\x39\xD4\x50"
-    "\xAD\x1A\xBC\x55\x53\x5B\x9C\xD8\x1C\xDE\x99\xC7\x0B\xDC\x6D\x52"
-    "\xB5\xA7\xC7\xF1\x18\x0C\x0A\x1D\x51\x85\x2B\x4C\x51\x32\x1E\xDB"
-    "\x8D\x6B\xAC\x8D\xF1\x4B\x3C\xB8\x90\x4F\xE3\x5A\x9C\x9F\x79\xF8"
-    "\xBE\xF8\xD3\x9F\xA2\xA8\x3E\xAD\xC7\x3E\xAD\xC7\xFE\x49\xD6\x63"
-    "\x9E\x0D\x13\x2E\x34\x7E\x3F\x4B\x29\xE9\x51\xB3\x6E\x57\x41\x56"
-    "\xCC\x5F\xEB\xF8\xD7\x6C\x29\xD9\x82\x76\x4F\xAD\xEF\xA5\xD4\xAD"
-    "\xF4\xA7\x3E\x49\xDD\x8E\x58\x2C\x25\x3C\x93\x86\x35\xC1\x11\x39"
-    "\x49\xF0\xCE\x30\x70\x23\x29\x05\x2D\xE8\x94\xDF\x59\x73\xA2\xDA"
-    "\x95\xDA\xD3\xE4\x6A\xC1\x9E\xDF\xB1\x07\xA5\x51\xFB\xCA\xD2\x3B"
-    "\xBA\x14\x08\x09\x6A\xBB\x32\xA9\x12\x8D\xFA\x4B\x15\x67\xE8\x32"
-    "\xAA\x9B\x5D\x5D\x2C\x30\x04\x0E\x54\x25\x84\xD6\xB1\x9C\x49\x1E"
-    "\x7A\xAB\xD2\xAF\xC4\xA2\x34\x30\xA6\xFD\x20\xBA\x98\xE5\x42\x97"
-    "\xD7\x2C\xA4\xF6\xA4\x3D\x7E\x13\xE9\x03\x23\x51\x53\x1D\x4E\xDC"
-    "\x21\xB5\x80\xCB\x23\x51\x2E\xC5\x49\xE8\x44\x8C\x96\x89\x1A\xDA"
-    "\x1E\x37\xD5\x37\xE5\x05\x18\xFA\xFF\xE9\xEF\x94\x2A\x53\x24\xEB"
-    "\x4B\x39\x05\x89\xFC\xA4\x5D\xC5\x50\x01\x2C\xF6\x4E\x30\xFB\x01"
-    "\xC3\x0C\x9D\x0E\x6C\x69\x09\xC6\x59\xF5\x68\x0D\x82\x89\x18\x9C"
-    "\x7B\x19\xE2\x1F\xD1\xBF\x3D\x92\x3C\x1A\x6F\x78\x77\xA7\x4B\x57"
-    "\xC3\x57\xC2\xD3\xF0\xF1\xBB\x3D\x46\xB0\xE6\x94\xA0\x52\x68\xB7"
-    "\x6B\xF5\xFC\xAD\x76\x7C\xAC\x2D\xB2\xE7\x5B\xDB\x43\x7D\x2F\xC2"
-    "\xAA\x7A\x76\xBE\xF9\x2A\xF5\x08\x4F\x42\x81\x93\xA6\x47\x77\x9A"
-    "\xE8\x28\x84\x81\x55\x90\x2F\xCB\xB4\x12\xB2\x9A\xFA\xAB\x6C\x97"
-    "\x9E\x04\x2D\xB7\x4F\x2D\xA0\x8E\xA4\x4A\xF6\x87\x09\xBF\x3B\x3F"
-    "\xBB\xCD\xAA\x1D\x57\x8B\x93\x0F\xC3\x44\x44\xCB\x77\xEA\xF2\x89"
-    "\xA8\x7B\x8B\xDE\xA1\x17\xF2\x07\xE5\x84\xD4\x00\xBC\x18\xB0\x19"
-    "\x0C\x41\x8F\x73\x28\x7F\x7D\x5A\xAD\x66\x53\xBE\x80\xEC\x34\x7F"
-    "\x5F\xC4\x83\xE0\x6A\x7F\xF9\xF0\x74\x4E\x27\x0D\xC5\x71\x98\xB9"
-    "\x5A\x1D\xC4\xCF\x6B\x3D\x3D\x76\x5E\xFA\xBE\x52\x0A\xB0\xCE\xC0"
-    "\xD6\xD1\xF0\x01\x01\x64\x04\x71\xFA\xD9\xA9\x3D\xA0\xAF\xC1\xED"
-    "\xB1\x04\x58\x92\xA3\xC9\x14\x96\x3F\x2F\x75\x08\xF7\x3D\x0C\xD7"
-    "\xA6\x12\xD3\x0C\x56\xA3\xE5\x8C\x2A\x8F\xB7\xDB\xD4\x80\xD5\xE3"
-    "\x0A\xAD\x77\xC0\xDA\x9E\x5C\x36\xD9\x4E\x8C\x19\xCD\xB2\xC3\xF6"
-    "\x5A\xF9\x94\x44\xA1\x3E\xA1\xC3\x9D\xDB\xD9\x79\x31\x5D\x96\xF5"
-    "\xF0\x87\x79\x8E\x45\x13\x8A\x26\xE9\x3F\x08\xAE\x07\xB3\x59\x1A"
-    "\x35\x4D\x4E\xC6\xB2\x60\xFB\x70\x5A\xCD\xB7\xF0\x6E\x12\x3A\xC8"
-    "\xA3\xAA\x44\x8B\x03\x4C\xDF\xD5\x34\x9F\x37\xAE\x4C\x8A\x82\x50"
-    "\x11\xA5\xAD\x74\x47\x87\x3A\x8D\xBF\x1D\xC4\x78\xE3\x07\xD3\xA5"
-    "\x69\xAA\xEE\x7A\x05\xDF\xC4\xD0\x80\x49\xF4\xE0\xED\xF6\x76\x90"
-    "\x44\x39\x1C\x74\xF1\x89\x29\xA6\xEF\xF9\xE8\x01\x0D\xBE\xDC\x13"
-    "\x43\x6A\xFC\x28\x6A\x1E\x30\x9B\xF2\xE9\xD4\x95\xF7\xB2\x29\xCE"
-    "\x6A\x4E\x7B\xD0\xA7\x7A\x74\xA6\x49\xD2\x53\xFE\x1F\xC7\xA7\x10"
-    "\xD2\x13\xF7\xB0\x28\x4A\xEF\x86\xCC\x89\x35\x28\xCD\x1A\x1A\x7B"
-    "\x14\x82\x48\x69\xD8\x71\xF0\x3B\x6D\x86\xD6\xC6\x77\x5E\x04\x26"
-    "\x4E\x94\x68\x8E\x95\xC5\x75\x84\xD1\x2B\xFF\x93\x20\x32\xC6\xBF"
-    "\x3E\xEC\x6B\xDB\x8E\x48\xF0\x30\x10\x31\x59\x0F\x09\x6E\x5A\xD6"
-    "\xA3\x29\xBC\x1D\xC0\xC5\xAA\xB6\xF1\x9C\x51\xD3\x84\xAE\x81\xE9"
-    "\x25\xD5\xEE\xA8\xD9\x7D\x6B\x1D\x83\xFB\x9A\xFB\x34\xBD\xA8\x21"
-    "\x4D\x9E\xFE\x59\xDE\xE0\x01\x8C\x58\x37\x24\x4C\x0B\xAA\x29\x36"
-    "\xB5\xC9\x67\x6E\x4B\xA2\x4E\xC4\xE0\xF0\x9B\xEB\x27\x23\x82\xD3"
-    "\x29\xDC\x96\x2C\x8D\x98\x0A\xC8\x48\x4D\x39\x0F\x27\xBE\x60\x96"
-    "\x08\x33\x92\xEF\x04\x39\xC9\x19\x7F\x49\x8B\x7F\x80\xC1\x94\x26"
-    "\xF3\xA2\x5D\x73\xEB\x5B\x9E\xEC\x34\xDC\x32\x09\xB7\x62\x30\xEA"
-    "\x3F\x28\x8F\x14\x51\x92\x99\x84\x8B\x21\x38\xB6\x17\x39\x0C\x1F"
-    "\x53\xA5\x6D\x89\xCF\x0B\x95\x77\x54\x6E\xEE\xB5\x37\xAE\x85\xD3"
-    "\x96\xC3\xD6\x5E\xC1\x0B\x1D\x71\x3E\x6F\xE5\x8D\xE2\x49\xED\x94"
-    "\xC2\x05\xB4\x28\xE9\x33\xC3\x3F\xA2\xE8\xCE\x84\x29\x46\xC4\x2E"
-    "\x12\xB0\x0D\xF7\x87\x79\x7D\x5A\x1E\x07\xDE\xE6\x8D\xE6\x59\x55"
-    "\x20\xB2\x13\xD0\xB6\xBD\xD4\x32\xBB\xA6\xB7\x0D\xF0\x4C\x54\x41"
-    "\x02\x84\xE1\x37\x46\xBB\x8E\xD0\xBD\x5D\x36\xE4\xE1\xC6\x68\x9E"
-    "\x06\x37\x74\xC3\xA9\x2C\x89\xB6\xC5\xCC\x8D\x96\x89\x6F\x16\xB4"
-    "\xEE\x33\x84\x45\xF0\xE8\xDF\xCA\xF6\x0B\x25\xFA\x02\xA9\x8C\x4F"
-    "\x17\x2E\xA3\x56\x73\xEE\x35\xCD\xE6\xCE\xE5\x73\x5A\x3D\xE9\x35"
-    "\x82\x9B\xCF\x83\xCF\x5A\x78\x43\x37\xC8\xEB\x71\x5F\xA2\x10\xF9"
-    "\x37\x6A\x6F\x15\x41\x0B\x2E\xFD\x30\x6A\x06\xBA\x07\x14\x8C\x31"
-    "\x48\x05\x7F\x28\x96\x93\x20\xA7\xB7\x5C\x11\x5A\xEB\x05\xCD\xBA"
-    "\x79\xDC\xAE\x73\x0E\x4E\x66\x43\x95\x93\x5C\x83\x19\xD1\x73\x8D"
-    "\x38\x0B\xF0\xC6\x83\x54\xB6\x5B\xFC\xAC\x74\xED\x4D\x89\xE4\x2F"
-    "\x9C\xF2\xD6\x1E\xE0\x15\xA3\x8A\x23\x10\x1C\x1C\xCC\x2C\xC6\x20"
-    "\xDB\x9F\xDD\xCF\x1E\xEC\xEE\x6E\xAB\x1C\xC1\xEC\xFD\x06\x84\xBB"
-    "\x9E\x07\x3F\x4B\xC7\xD2\x89\x85\x80\x0E\x64\xD3\x16\xBD\xDE\x7C"
-    "\x44\x3F\x32\x6E\x9C\x43\x05\xB8\x8E\x2B\x02\x3D\xA2\x2F\x24\xF9"
-    "\x45\x23\x33\x7B\x87\x7C\x7F\x1B\x92\x5D\x4C\xF7\xE4\x63\x51\x1D"
-    "\x37\xB7\x98\x8E\x7F\x89\x7A\x3E\x95\xBE\x73\x85\x81\x5B\x4C\xFB"
-    "\x56\xBE\x02\x0F\x67\x49\x71\xAB\x17\xEE\x87\xB9\x27\x00\x70\xCB"
-    "\x4C\x4B\xBD\x49\x03\x59\xF7\x9E\x1D\xA4\xB0\xFB\x2A\xDA\x23\xD9"
-    "\x3B\x5F\x9F\x90\xB5\x98\x83\x80\x53\x3B\x57\xCD\xA9\xBE\xDA\xA5"
-    "\x8A\xF9\x43\x7C\x8D\x6E\x50\x07\xCA\x5C\x65\xCD\x53\x07\x0E\x95"
-    "\x6C\x19\x28\x39\x9B\xDC\x8D\x9C\x14\x72\x07\x62\x20\xEE\x6D\x1A"
-    "\x4C\x64\x53\x68\x96\x6B\xDE\xA0\x23\x4B\x6D\x19\x1F\x31\xBE\x4A"
-    "\xDB\x8F\x0D\x0A\x0D\xC4\xE4\x24\xDC\x1E\xE9\x04\xF5\x2A\x46\x42"
-    "\xE7\xF4\x5A\xBA\x89\xB8\x68\xB7\x56\x67\x89\xF7\x92\xC3\xAB\x9C"
-    "\xF0\x4E\x7A\x2F\x8A\xA0\x20\x5C\xF4\xCD\x79\xA7\x62\x08\xB8\x26"
-    "\xFE\xEE\x25\xC5\x32\x00\xF6\x87\x9B\x14\x8C\xE2\x26\x38\x29\x18"
-    "\x7D\x75\xCB\xEB\xB7\xFA\x6B\x8F\xE4\x53\xB4\x60\xC1\x9C\x57\xF8"
-    "\xD7\xA9\x6B\xD6\x50\x3D\x33\x09\x1D\x53\xCC\x74\x7F\x6B\xF8\x58"
-    "\x94\x8A\x0D\x07\x28\x15\x7B\xEC\x24\x2A\xF3\x04\x8F\x72\x95\x79"
-    "\xCF\x3C\x78\xEF\x00\x81\x2A\xE1\x3D\xF5\xEB\xB0\x3B\x57\xBA\x06"
-    "\x11\xC8\xE6\xC2\x8A\x20\x32\x05\x2B\x9E\x78\xB0\x7E\x14\x97\x2A"
-    "\xE0\x3F\x96\xA5\xBC\x44\x0A\x58\xC2\x7B\xE4\x41\xDB\x43\xA1\x0A"
-    "\xD6\x3E\xF0\xA8\xF1\xA2\xB3\x14\x31\xDE\xD3\x96\x0B\x07\x6C\x0A"
-    "\xB0\xE7\x9C\xF9\xE4\xEB\x95\xBD\x3D\x57\x25\x43\x39\x3C\x5A\xF9"
-    "\xF7\xED\x72\x67\xB9\xD7\xE5\x9A\x62\x6C\x4F\x1C\xD2\xDD\xBB\xF6"
-    "\xE2\x97\x28\x86\x67\xC5\xFA\xA8\xCA\x97\xD3\x34\x96\x77\x0A\xA2"
-    "\x05\x13\x74\x6B\x8A\x12\x78\xD5\x41\x87\x16\xA2\x04\x06\xBD\x91"
-    "\x1E\xC5\x72\x47\x5D\x68\x30\xA9\xAA\x25\x8C\x69\xCA\xB3\xAA\x53"
-    "\x20\xEA\x7C\x88\x74\xE5\x53\xAE\xA6\x1D\x71\x61\xAD\x45\x55\xDF"
-    "\x09\x92\xA6\x21\x31\xCF\xF3\x39\xF0\x3E\x76\x09\x31\x4F\x67\x67"
-    "\xA6\xBF\xD4\x83\x26\xD2\x27\xCE\x2B\x8F\xD9\xFA\x5D\xC0\x3E\xF5"
-    "\xE2\xEF\x51\xCE\xA8\x97\x27\x4A\xC2\xDC\x97\xDB\x99\xBA\xE7\x98"
-    "\xEE\x3C\xB3\x14\xEA\xBB\x60\xF1\x9C\xB7\x09\x11\x13\xFA\xFB\x9B"
-    "\x97\x0F\x9F\x3F\x39\x7C\xFC\xE4\xBB\x87\x7F\x3B\x7C\xFE\x0A\x34"
-    "\xF9\x1F\x77\x9D\xF7\xAF\x7F\x7C\xF9\xFA\xBB\x27\x87\x0F\x1F\xBD"
-    "\x7E\xFA\xD3\xC3\xD7\x4F\x1E\xE3\xEC\xFE\xFA\xE1\xD7\xF6\xC1\xF0"
-    "\x3F\xD4\x81\x61\xC5\xD6\x6D\x95\x20\xC8\x29\xFE\xF8\x49\x80\x40"
-    "\x3C\xEA\x40\xF1\xF0\xFB\x67\xED\xF5\x63\x3C\x4C\xBA\x68\x67\xDD"
-    "\xC9\xE2\xFF\xFD\xE2\x6F\xAF\x5E\x3F\x7D\xD4\x5E\xBB\x39\x73\xD8"
-    "\x8E\xA2\x8B\x8A\x76\x34\xDF\xBE\x78\xFD\xE2\xDB\x17\x0F\xBF\x6B"
-    "\xA5\x04\x05\x63\xE7\x04\x24\xA3\x03\x47\x17\x29\x51\x3C\xD6\xDE"
-    "\x8B\x5C\xE2\xDA\xE7\x1A\xCC\xEE\xCB\x26\x93\x77\x4D\x5A\x69\x1E"
-    "\xD7\xAB\xA3\x7A\xB2\x2C\x8F\x8A\xA1\x2F\x98\x23\xD2\xAB\x9E\x3D"
-    "\xD3\x56\x52\xB4\x79\x83\xB2\x8E\x30\x6E\x58\xEE\x4A\x35\x86\x42"
-    "\x78\x85\xB2\x57\xAA\x39\x14\xBA\x2B\x94\x6D\xAB\x79\x83\x7B\xA7"
-    "\xD2\x77\x3C\x76\x5F\xA5\xD8\x47\xAE\xC0\xE2\xD5\xB4\x3F\x9C\xCD"
-    "\x86\x57\x27\xB4\xE3\x06\xE1\xF8\x05\xC2\xAE\x8B\x00\x4C\xC4\xF9"
-    "\x74\x56\x68\xF2\x94\x51\x20\x88\xD5\x70\x4F\xE7\x98\xB4\x03\xB4"
-    "\xC6\x6A\x06\x96\x26\x67\xB1\xC1\xB9\xCE\x9A\x08\xB4\x28\x04\xC2"
-    "\xDE\xE3\xC4\xA7\x8B\x91\x5B\x9D\x63\x26\x4B\x39\x9E\xC9\x59\x46"
-    "\x99\x70\x28\x78\x64\x5A\xE8\x92\x5E\xC1\x6A\xE1\x94\x8B\xAE\xD7"
-    "\xAA\xB9\x32\x6A\x86\x8A\xEE\x51\x36\xCD\x9B\xDC\x49\x2D\x46\xBB"
-    "\x03\x99\x06\x88\x66\x28\xF0\x07\x79\xEC\x44\x3A\x76\x74\x6C\x02"
-    "\xC6\x33\x11\x77\x63\x2F\xC6\xAD\x97\x74\xEB\x4F\xB4\xA4\xAF\xDF"
-    "\xFA\xF8\x9F\x2C\x7D\x9E\x15\x20\x08\xF4\xDE\x6C\x42\xA1\x5F\xF4"
-    "\x2A\x24\x72\x16\xD1\xE7\xD5\xB4\xA0\x2C\x9B\x87\x8C\x59\xFF\x4E"
-    "\x1E\xD6\x4F\x45\x14\xE0\x47\x76\x9F\xD0\x01\x9B\x76\xE0\x8D\xF7"
-    "\x9F\xA3\x46\xAE\xDD\x7D\xB7\xD0\x7B\x1B\x13\x78\x88\x65\x6E\xA1"
-    "\xEF\x9C\x99\x2E\xD9\x6F\xE1\x0A\x80\xA4\x3A\x78\xDC\x93\x29\x61"
-    "\xB9\xD5\x02\x14\x07\x5F\x83\x48\x67\x70\x6E\x46\xC0\xA1\x9E\x1B"
-    "\x62\x51\x1F\xE1\x8E\x32\xE9\x06\x79\x74\x03\x52\x73\x23\x0C\x09"
-    "\x6D\x95\x14\x4B\xE2\x2B\x1C\x92\x9D\xF8\xAB\x7E\xBC\x49\x94\xBD"
-    "\x15\x19\xD2\x75\xDD\x20\xDB\x7A\xC8\x52\x9A\x71\xB7\xC0\xB7\xEB"
-    "\xCB\xD5\xCD\x31\x29\xB4\x46\x53\x2C\x8A\x2F\x90\x49\xB6\xE2\xAF"
-    "\xFA\xF1\x28\x51\xF6\x46\x64\x6B\x53\x1E\xF4\x10\x94\x34\x17\x6E"
-    "\x81\x09\x57\x10\x94\xEE\x26\xF7\xC8\x42\x44\x77\xB6\x47\x3D\x62"
-    "\xAB\x39\x5B\xD1\x53\x6D\x38\x73\xFE\x21\x6D\x6C\xFA\xF5\x7A\xA6"
-    "\xBE\xD8\xDF\x38\x3C\x53\xA2\x0B\xEB\xDD\xF9\x6A\x36\xDB\x77\x0D"
-    "\x5D\x4F\x2B\x20\xB0\x97\x9F\x5D\x0C\x07\x27\x33\x39\x65\x15\x15"
-    "\xC8\xA9\xE8\x66\x19\xCA\xCF\xC2\x51\xD5\xBA\x54\xF1\x29\x17\xA4"
-    "\x21\x2A\xD5\x42\x7F\xFB\xBB\xAC\x11\xEA\x25\x5F\x13\x30\x6C\x23"
-    "\x33\x9E\x6C\x3E\x42\x25\xB1\x26\xCA\xD8\x0D\xDB\x10\xD2\x16\x69"
-    "\x04\x07\x25\xD9\x48\x8D\x6C\x86\xB5\xEA\x7B\x0F\x64\xF8\x0A\x43"
-    "\xCE\x2B\xDC\x08\x99\x94\xC7\xE5\x84\x7A\x45\x85\xD2\xE3\x03\xBE"
-    "\xE2\xAF\x3C\x16\xBF\x35\x84\xC2\xE7\xD3\x2E\xFA\x18\x0F\x69\xCB"
-    "\x2E\x3F\x50\x9D\x8E\xBB\xA1\x77\x99\xAF\xFB\x81\xF8\xE1\x7E\x19"
-    "\x31\xD2\xE6\x74\xB1\xCD\xF7\xD5\x6B\x3C\x41\x3E\xAA\x03\x8F\x53"
-    "\xA1\x62\x8E\x6C\x3A\x51\x9E\xF2\x0C\x2F\xE2\xE1\x2C\xAA\x6A\xAF"
-    "\x89\xF7\x81\xD1\x2D\x3A\xAB\x72\xF6\xAE\x3E\x79\xF5\xC3\x1F\xBF"
-    "\xE0\x28\x21\x25\xAA\x6E\x10\x00\xC6\x39\x98\x54\xFF\x5F\x1D\x88"
-    "\x56\x45\x83\x93\x64\x9B\x6D\xB9\xCF\x3D\x67\xA5\x3E\xD1\xC9\xC9"
-    "\x2C\x1F\xEC\x32\xBD\x35\xDE\x4C\xA0\xB6\x56\x23\x8A\x31\x31\x81"
-    "\x26\x63\xE8\x84\xF7\x77\xDC\x9A\x50\xC9\xFF\x24\xA6\xD4\x93\xA2"
-    "\x79\x78\x51\xD6\x2F\xE6\x9C\x5F\x66\xE8\xA5\xBA\xEC\x8F\xE1\xF5"
-    "\x79\x75\x4D\x0C\x40\x03\x9E\x7D\xB9\x16\x09\xD7\x43\x00\x14\x60"
-    "\xF4\xFA\xB5\x28\x60\x04\xD1\xF2\x9D\xF3\xD0\x65\x4C\x89\x25\x74"
-    "\x6D\x8B\x25\x13\x4F\x2A\xEB\xD8\xD4\xFD\x07\xA6\x63\x89\xFF\xBB"
-    "\x0C\xCA\x70\x4D\xD3\x7B\x40\x46\x8F\xC9\xF9\x9F\xC8\x9A\x69\x83"
-    "\x81\x98\x2E\xDD\x67\x10\xB6\xD6\xDD\x35\x7E\x5A\xAB\xBE\x7A\xE1"
-    "\x1E\x03\xAF\xB5\xE6\x8F\x35\xE8\x12\xCB\xD2\xD4\x80\x73\x5C\x1F"
-    "\x1B\x0C\x39\xD7\x65\xF2\x4F\x38\xE8\x36\x1B\x70\xCE\x18\x4A\x05"
-    "\x03\x65\xD9\x06\xF1\x40\x57\xEA\xDB\x94\xA3\xAA\x57\x94\x89\xBB"
-    "\xCA\xD2\xE1\x24\xE6\x81\x17\x57\xE2\x02\x8A\xDF\x4E\x34\x89\x84"
-    "\x12\xBF\x04\x8C\x71\x6B\x03\x84\xF9\xDE\xB2\xC7\x7F\xE7\x0E\x05"
-    "\xC8\xDE\xCB\x5E\x01\x1E\x30\xE7\x40\x4A\x31\xF0\xBD\x9A\x4D\xBD"
-    "\xC3\x98\xFA\x3E\xC3\x7B\xF7\xEF\x70\x8B\x65\x88\x02\xF2\x08\x73"
-    "\x64\x0F\xB5\xA8\x9B\x9D\x05\x86\x3D\x54\x2B\x25\x3A\xD6\xCF\x77"
-    "\xDC\x1F\xC8\x33\xBB\xFA\x94\xDB\x1E\x27\x0A\x76\x3E\x74\x7D\x4D"
-    "\x5E\xAF\x96\xE6\xF2\x5E\x8C\x4D\x83\x12\xE5\xEA\x4C\xD1\x58\x1D"
-    "\x73\x26\x6C\x2B\xC8\xFA\xAC\xDC\x06\x08\x39\x61\x80\x8F\xD1\x1E"
-    "\x20\x78\xB6\x88\x21\x33\x28\x1D\x6E\xE1\xFA\x0E\xC4\x16\x83\x08"
-    "\x30\xF1\x8C\x93\xBA\xE3\x59\xB9\x19\x9E\x72\xDE\x14\x27\xCB\x00"
-    "\x4B\xB4\x69\x69\x2C\xD3\x62\x89\x3B\x25\xE5\xFB\xC2\xE2\xB9\xB4"
-    "\x81\x99\x3D\x6E\x45\xE3\xCC\x81\x07\xD9\x9B\x0F\xE3\xF1\x38\xEC"
-    "\xD0\xCB\x51\x96\x78\x11\x84\x7A\x7A\x75\xA1\xAC\x98\x90\x6E\xEF"
-    "\xDD\xBE\xBF\x9E\xAA\x8B\xE6\x47\xAF\x78\xCB\x61\xBF\xEE\x3B\x31"
-    "\xEC\xA0\xEE\xDC\x38\x43\x91\x03\x09\xA1\xD2\x9C\x76\xFF\x7B\x4F"
-    "\x29\xEA\x46\xD0\xCB\x37\xC4\x82\x7A\x0C\x2A\xA6\xB8\x10\xF0\x6F"
-    "\xC7\xEE\xDD\x0A\x61\x03\x9F\x47\x2B\x92\xF7\x33\x88\x16\xF6\xAC"
-    "\x0B\x97\xEF\xC1\x95\x0E\xDD\x4D\xE6\x41\x71\x03\x4D\x36\xF7\x3F"
-    "\x24\x9A\x1C\xAD\x48\xDE\x21\xB1\x41\x93\xED\xBD\x0A\x6E\xB5\xBD"
-    "\x9A\xFC\x6C\x71\xAD\x86\x3E\x5B\xA4\x9A\x28\x11\xE3\xD5\x0C\x9B"
-    "\x34\xE9\x19\xBA\x20\x34\xEA\x7E\xCD\x28\x6F\xAB\x19\xA5\xD3\x8C"
-    "\x72\xA3\x66\xE0\x9D\xB6\xCF\xCA\x4D\x9A\x71\x3D\xB1\x7B\x96\x14"
-    "\xB8\x67\x8E\x98\x3D\xDB\x48\xC0\x9E\xA1\x68\x3D\xEB\x21\x54\xCE"
-    "\xD5\xEA\x1C\xA8\xCD\x5A\xD4\xDC\xBB\x5D\x1D\xFD\xBD\x98\x98\xE3"
-    "\x22\xFA\xAF\x7F\xFA\xD3\x54\x9E\xB8\x8D\xA9\xA9\x5E\x10\x9E\x56"
-    "\x5E\xB9\xB6\xDB\xC0\xD3\x83\x60\x2E\xF8\x6A\xD9\x22\x73\x6D\xF0"
-    "\x81\x56\x24\x83\xBD\x94\x4E\xF4\x0B\xA8\x61\x38\xD8\x4B\x69\x14"
-    "\xAF\xC0\x33\x8C\xB3\x75\x46\xA2\x0F\x50\x22\x40\xD9\x02\x80\x95"
-    "\x3D\x8B\x57\x61\xEF\xFE\x6D\x35\xE0\x3A\x39\xE4\xDE\xB0\xFB\x63"
-    "\x00\x1E\x3E\x14\x25\x24\xE7\x3C\x46\xBA\x78\x9F\xBB\x80\xDE\x13"
-    "\x89\x51\xB0\xD6\xE3\xB4\x87\xD1\x05\xF4\x9E\x08\x58\xD5\x0D\x6E"
-    "\x69\x7A\x48\x7F\x25\x24\xF7\x87\x07\x59\x2A\x48\xF9\x5C\x75\x8C"
-    "\x07\xA9\xE8\x70\x9E\x6B\xA9\x86\x57\xFA\xAB\x36\x64\xF1\x5F\xD7"
-    "\x8E\xDD\x46\xD7\xB5\x8D\xDC\x7C\xA9\xAE\xE2\x65\x5B\x53\x07\x6C"
-    "\xEA\x0B\x7A\x0F\xD9\x98\x75\x83\x3D\x71\x29\x49\xE0\xAF\xAB\x6A"
-    "\x66\xE3\x5C\x29\xB6\x93\xE0\x0F\x1B\x7C\x11\x29\x45\xF7\x48\xD1"
-    "\xC2\x21\x52\xF4\xBD\x79\x99\x2C\xFF\x73\x39\x85\x85\x6B\xA4\xEC"
-    "\x39\xBD\x88\x96\x7B\x99\xCF\x4F\x0A\x2E\x18\x89\x4C\x5D\xE2\x5B"
-    "\x5D\x3C\x19\xDE\xCA\x63\x83\xB2\x0B\x99\x92\x13\xBA\xBE\x86\x23"
-    "\x58\x39\x80\x95\x82\x54\x85\x25\x89\xC6\xB2\xBB\x34\x68\xF2\xA3"
-    "\x6C\x91\xCF\x8B\x19\x95\xE0\xE5\xC4\x4F\x1B\x94\x22\xCD\x67\xB5"
-    "\x9E\xBC\x1A\xF8\xD2\x59\x0A\x3A\x60\xE6\x68\x3C\x9E\x8B\x9B\x37"
-    "\x60\xD4\x42\x35\x2D\x00\x6A\x99\x12\x01\x79\xF3\x96\x80\x9E\x6B"
-    "\x53\x89\xCE\x50\x3E\xFD\x9E\x6F\xC1\xDA\x51\x29\x6A\xE6\x78\xC0"
-    "\x01\x84\x0D\xA4\xB0\xE2\xE6\x14\xF9\xE4\x54\x27\x9F\x4E\xA1\xD4"
-    "\xA6\x88\x40\x99\x5F\x64\xD7\x41\xF9\x6C\xF1\x94\xCA\x09\x94\x60"
-    "\x1D\xD0\xA1\x8A\x2B\x22\x2C\x19\x61\x1A\x60\x6A\x00\x44\x2C\x32"
-    "\xB5\xCB\x75\xBF\x24\xC3\x91\x65\x17\x8D\xBC\xFE\xB0\x20\xCF\x4D"
-    "\xAA\x13\xC1\x39\xFB\x5A\x35\x7C\x24\x68\x1E\x09\xF2\xB6\x0D\x3B"
-    "\xE2\x43\x43\xB3\xA5\xBE\xF3\x41\xAA\x7D\xB5\x5C\xD1\x6B\x52\xAB"
-    "\xFE\x3D\x5D\xBF\x27\x32\x53\x99\x7C\x17\xB8\x52\xC6\x03\xF6\x7C"
-    "\x65\x15\x26\x1B\x4B\xDF\x04\x96\xFA\xA0\xEF\x46\xA7\x2B\xF3\x90"
-    "\x2D\xF3\x73\x99\x4D\x8E\x5C\x36\xF3\x2A\xC0\x7E\xE3\x8B\xE7\x0E"
-    "\x72\xF9\xD0\x8D\xCA\x22\x76\x7E\x5A\x82\x84\xA1\x5F\x89\x90\x70"
-    "\x4A\x99\x7A\x3B\x20\x8E\x74\xA4\xC3\x44\x27\x6D\x08\x80\x79\xEA"
-    "\x61\xC2\x02\x83\x9B\x61\xA4\x42\xE5\x6D\x1C\x7D\x59\xDA\x81\x18"
-    "\x47\x4C\x0C\xF7\x2D\x38\x0F\xBA\x58\xCA\x01\x8D\x47\x78\x7A\x1D"
-    "\x73\xF3\x9F\x56\x95\xBA\x6A\x10\x78\x5C\xD8\x74\x86\xFA\xE0\x40"
-    "\x73\x5E\xA9\x2A\xB6\x03\xAA\xBB\x38\x6D\xF4\xCF\x4D\x73\xBA\x05"
-    "\x71\x8A\xD3\xFF\x7A\x3E\x15\x6E\x95\xEA\x03\xE4\x79\x28\x3F\xBA"
-    "\x27\xBC\xC6\xDC\x54\x3F\x98\x44\x2B\xC4\x97\x5E\x94\x38\xEC\xB8"
-    "\x15\x3A\xA6\xBD\xE8\xF0\x18\x7A\xD3\x94\x5C\xEE\x9B\x43\x9F\x75"
-    "\x81\x33\x5D\xA3\xCF\xE3\xF8\x53\x65\x66\x1C\x97\xB5\x9A\x18\xDE"
-    "\x98\x5A\x1D\xD3\x72\x28\xE7\x8F\x6D\x91\x53\xA5\x05\x8A\x60\xDE"
-    "\x8A\x03\x0B\x87\x13\x63\xBF\x1C\xD8\xAB\x50\x85\xEB\xAD\x96\xF7"
-    "\x3E\x9E\x16\x93\x77\x09\x38\xAD\x6C\x5F\xA3\x3B\x3C\x01\xA2\xB4"
-    "\x44\x0B\xC8\xB3\xC5\xB7\x40\x4C\x1B\x40\xD9\x05\x30\x8D\x03\x08"
-    "\x32\x94\xC3\x38\xFA\x12\x5D\xFA\x1D\xCE\x48\x6F\x76\x7E\x84\x57"
-    "\x04\x93\xC7\xC7\x07\xC4\xC3\xBF\x78\xAA\xF2\x79\xAD\x4E\x83\xF8"
-    "\x0B\xF3\x48\x2E\x0E\x8A\xC0\x20\x0A\x35\xD0\x51\x05\x84\x92\x94"
-    "\x50\x30\x15\xD8\x46\x7D\x32\x44\xF8\x99\x38\xB8\xD1\xA8\xE7\x11"
-    "\x5D\x9F\x5C\xE1\xBC\x0D\x34\xFB\x1A\xE1\x63\xC1\xFA\x77\xEF\x32"
-    "\x27\x53\x5E\x87\xAF\x4B\x75\xB8\x8C\xA0\x46\xE2\x28\x2E\x07\x85"
-    "\x99\x7C\x3E\xF7\x6C\x6C\xFE\x7B\x15\x95\x8F\x7B\x28\x65\xD3\x14"
-    "\xD3\x64\x72\x2A\x76\x5E\xA8\x8B\x0F\x9D\x9D\x00\x6D\x8A\x85\x7B"
-    "\x04\x30\xBB\x1D\x95\x7A\xC7\x47\x72\x4D\x23\x8B\x0C\x64\x66\x22"
-    "\x5E\xC6\x12\x31\x3A\xE3\x8C\xC3\x3A\xA8\xC2\x61\x40\x9C\x17\x3C"
-    "\xE4\xB2\x58\x1F\x46\xE3\x83\x68\x03\x83\x06\x78\x36\x9B\x91\xD1"
-    "\x43\x99\x94\x57\x73\xF3\x66\xE0\x86\x4C\xA9\x64\x19\x21\x4B\x30"
-    "\x87\xC0\x80\x1B\x39\xD0\xB5\xBC\x06\x60\x55\xD3\x59\x59\x53\x06"
-    "\xCC\x80\x63\x03\x2F\xDD\x28\xE8\x6A\x98\x31\xCA\x7F\xB0\x79\xA0"
-    "\xF4\x93\x49\x31\x74\x28\xC4\x36\xCB\xEC\x38\x0B\xE8\xB1\x44\x43"
-    "\x83\x86\x38\x54\x4A\x4E\xA2\x58\x66\x5F\x2A\xAC\xEA\x78\x3A\x3E"
-    "\xC2\x03\x51\xF1\x64\x22\xE7\x72\x47\x87\xCB\xBD\x29\xBD\x3C\x44"
-    "\x02\xF2\x7B\xDE\x28\x54\xAE\xB5\x39\x6E\xB3\x95\xDE\x7E\xAC\xC5"
-    "\x38\xAE\x0B\xCE\x6E\x37\x0C\x7C\x31\x23\xD5\xB4\x71\xB0\x97\xD0"
-    "\x07\x9B\x71\x60\x19\x34\x09\x3F\x56\x2F\x64\xDA\xB9\x65\x91\xC5"
-    "\x7D\x5C\x7D\x90\x3D\x5B\x58\x34\x8E\xFF\xAB\x57\xE1\x52\x14\x2E"
-    "\x37\x2D\x2C\x1A\xF0\x2C\x41\x76\x98\x0E\xBC\xCD\xE5\xC9\x83\xC4"
-    "\xAA\x9F\xF8\x48\x15\x43\xC9\xD1\x70\xB1\x29\xA2\xA5\x72\xD9\x3E"
-    "\x5F\x87\xA2\xC2\x78\xD8\x34\x30\xBF\xE3\xB5\x08\x81\x5A\xD6\x0A"
-    "\x0F\xEF\x8F\x50\x50\x6C\x16\x10\x9E\x98\xCE\x35\xF3\x75\xDC\x69"
-    "\xCD\x58\x28\xE0\xD6\xDF\xD8\xF7\x89\x89\x0D\x2A\x13\x36\x0A\x60"
-    "\x98\xE0\x06\x75\x26\xA3\x24\x9F\x09\x91\xDB\x9C\x97\x13\x9A\xA8"
-    "\xCA\x93\x79\x85\x79\x34\x06\x5E\x1F\x07\x2C\xF2\xFA\xCF\xB1\x39"
-    "\xA6\xD5\x64\x75\x86\x69\x08\xFF\x67\x55\x2C\xD7\xAF\xD4\x4A\x79"
-    "\x28\x97\xED\x52\x0B\x45\xED\x11\x8B\x30\x8E\x45\x29\x1E\x4F\x9B"
-    "\xC1\xCB\xBF\x5E\x5C\x5C\xA8\xA0\xC7\x12\x93\x53\x1D\x8B\xA5\xBA"
-    "\x15\x06\xD7\xB2\x11\xDE\x82\x31\xE6\x1D\x35\x3E\x8F\x83\xAF\xD2"
-    "\x84\x68\x20\x29\xD1\xBE\x3D\x24\x3C\x0F\xD7\x44\xEC\x58\x51\xD6"
-    "\x7D\x71\x5D\xAC\xA5\x87\xB5\xBC\x11\xAC\x53\x0F\xEB\xF4\x1A\x58"
-    "\xAD\x07\xC5\x8B\x3B\x57\x97\x14\x60\xCA\x02\x16\x62\x72\x68\xF0"
-    "\x48\xEB\xD4\x2B\x66\x70\x4D\x8B\x96\xC1\xD5\x12\x1F\x9E\x1A\x59"
-    "\x16\x1F\xFA\x32\x66\xB8\x22\x28\x31\x6B\xA8\x39\x74\x78\x8D\x41"
-    "\xD6\x67\xC4\xB7\x19\xFF\xAD\x03\x2E\x05\xDB\xBE\x08\x48\x09\x7E"
-    "\x0A\xAC\x6D\x31\x10\x97\xCA\x24\x50\x62\x51\x60\xF9\xD6\x25\x03"
-    "\x6C\xD0\xBB\xA7\xBB\x1D\xD9\xE8\x38\xDA\x2A\xCA\xFA\x59\xE2\xFA"
-    "\x9C\x0F\xA7\xBC\x05\x57\x55\xE0\x7C\x9A\xD5\x12\x60\x24\x0F\xFD"
-    "\x48\x7A\x02\xBA\xAA\x2E\xEF\x3E\xB9\x6E\x41\x22\xD9\xAF\xBB\xDA"
-    "\x44\x75\x04\x22\x38\xCE\xA7\xD3\x27\xEF\x61\xD6\x60\x6E\x15\x60"
-    "\xC4\x4E\x68\x19\x86\x76\x44\x35\x7F\xE5\xC3\x53\x9E\x9E\x00\x2F"
-    "\x28\x04\x5A\x78\xB3\x63\xAB\x2E\xDC\x99\x00\xD4\x0A\xCE\x4B\xA1"
-    "\x6B\xD2\x91\xF2\x31\x98\xB0\x4F\x00\xC9\xB0\x40\x25\x55\x44\x08"
-    "\x23\xCF\x38\xD3\xA5\xE7\x0D\xB5\x64\xF4\x6D\x23\x46\x2E\xC6\xC6"
-    "\x66\xC8\x55\xC1\x36\xE4\x76\x44\x6D\x84\x9A\x8B\xB5\x22\x2E\xAF"
-    "\x86\xB8\xEC\x44\x3C\xBD\x1A\xE2\x69\x0B\xE2\x68\x76\x6F\x92\xC5"
-    "\x16\x1D\x7E\xC8\x53\x0A\xC5\x4E\x2E\x8A\x25\x25\x00\x9F\x4F\x8A"
-    "\xF1\xBC\x3A\x1F\x6E\x68\xA7\xF6\x38\xB7\x7F\xCD\xF1\x5E\x2D\x6E"
-    "\x7F\xB8\xA7\x12\x0A\xB8\xC3\xFD\x86\xC6\x3B\xE7\xC9\xFE\x7D\x0E"
-    "\xF9\x28\x6D\x37\x38\xEA\x3B\xF1\x5F\x6B\xE0\x77\x61\xBF\xCE\xD8"
-    "\xEF\xC4\x7D\x8D\xE1\xDF\x89\xBB\x9F\x06\xC0\x4F\xEB\xF9\x2C\x3B"
-    "\xEC\x37\x4A\x79\x61\xF3\x55\xD0\x90\x7B\x5F\xD6\xE5\x51\x39\xD3"
-    "\xA9\x9C\x65\xE2\xFB\xFA\xB4\x3A\x4F\x24\x8C\xE1\xC1\xF2\x8A\x01"
-    "\xA2\x56\x85\x2E\x9C\xB6\x29\x00\x20\x30\x58\x4D\xB1\xE4\x94\xAD"
-    "\x00\x82\x0B\xA9\xE1\xF1\xD0\x5A\x8D\x57\x4B\x02\x72\x5A\x4E\x8B"
-    "\x34\x49\x49\xB5\x92\x20\x09\xB1\x5D\x95\x24\xDB\x49\xCB\x02\x8C"
-    "\xC2\xE5\x7D\xE5\x99\xC4\x2E\x73\x00\xAC\x63\xE1\x47\x0B\xA1\xFC"
-    "\xF7\x18\x1B\xC0\xC5\x29\x4B\x3D\x0B\x5C\xD2\x6F\x69\x1C\xB4\x20"
-    "\xCE\x93\xC2\x6C\xE5\xF2\x2F\xAE\xBE\x33\xB5\xBD\xBD\x62\x8A\x89"
-    "\xA1\x5C\xD4\xC0\x58\xAE\xDB\xD4\xA8\xDD\x9B\x9B\x79\x2F\xC5\xCA"
-    "\x89\x89\x52\x7E\x6D\xEF\xC8\x20\xDD\x56\x8A\x5B\x91\xA0\x3C\xDF"
-    "\xEB\xAD\x0C\x18\x38\xA0\xD5\x6B\x9B\x68\x6C\x59\x4C\xAA\xA5\xB8"
-    "\xC3\xB4\x98\x13\x4E\x8B\x3D\xBC\xE4\x35\x2D\x37\x71\x2D\x3F\x2C"
-    "\xDE\x07\x79\x59\x35\x63\x4C\xA8\xDB\x24\xC7\x3D\xED\x1C\x53\xB3"
-    "\xE2\xC6\x36\x20\x3B\x41\x67\x20\x9E\x74\x14\x12\x48\x5E\x29\xAD"
-    "\x66\x6A\x54\x33\x75\xAB\x1B\x90\x6A\x1E\x83\x71\x7D\x82\xD7\x4C"
-    "\xAA\x49\xA7\xE5\xA2\x51\x5C\xA7\xAA\x8C\x9E\xCB\x25\x7E\x57\x3E"
-    "\xCB\x8B\xB7\xD9\x09\x30\x71\x6E\x9D\x0F\x24\x54\xB8\x73\x99\x16"
-    "\x24\x1D\x61\x62\xCB\x88\x8F\xF6\x81\x07\x5E\x0D\xDE\xE1\x05\x4A"
-    "\x53\xE8\xCA\x69\x44\xE0\x34\x3A\x35\x3F\x02\x50\x20\x64\x1F\x9C"
-    "\x4D\xA7\x5F\xCD\x1A\xEB\x32\xB3\x6E\x74\x1D\x02\xA5\xFA\x85\xB2"
-    "\x57\x9B\x25\xBE\x96\x1D\x8B\xBB\xD7\x47\x27\xFB\xC6\xED\x11\x5D"
-    "\xA7\x3E\xA5\x9A\x44\xED\x89\xFC\x21\x43\xF2\x76\x99\x61\xD5\x08"
-    "\xE0\xA5\x58\x45\x7C\xD5\x06\xB6\xC3\x5D\x4D\x79\xA9\x15\xE8\x9B"
-    "\xF2\x2D\xE9\xB3\xE1\xE0\x3F\xF0\xC8\x75\x19\x4F\x4F\x6D\xF4\x7B"
-    "\xD4\xA9\xDD\x92\x5C\xD9\x5B\xDC\x46\xC6\x90\x67\x8E\xDC\xD8\xF8"
-    "\x51\xA1\x8C\xC6\x1D\x2F\x78\xEA\x04\xD8\x38\xA3\xA6\x94\x09\x54"
-    "\x91\x4D\xB4\x4B\xE9\x31\xC4\x8D\x8E\x53\x39\x05\xBE\x5F\x9D\x15"
-    "\xCB\x72\xA2\x3A\xAD\x21\xBD\x29\x9D\xEB\x03\x27\xFA\xC3\x1F\xAD"
-    "\xEA\xB2\xBE\x5D\xE7\x22\xB6\xC4\xC1\xA9\xC0\xC2\xFA\x58\x2C\x33"
-    "\x61\x48\xB7\xCA\x32\xBB\x85\x30\x70\xC2\x38\xAE\xC7\x32\xC7\x6C"
-    "\xFC\x48\x0C\x33\x51\x5A\xB7\xC9\x2F\xDA\x25\x19\xA8\x30\x8B\x28"
-    "\x8F\x22\xEC\x09\xB8\x53\xFE\x06\xDC\x29\x3F\x06\x77\x4A\xE2\x4E"
-    "\x79\x3D\xEE\x4C\x7F\x03\xEE\x4C\x3F\x06\x77\x68\x94\x3D\x6B\x19"
-    "\x5F\xA9\xA1\x25\xEC\x88\xE7\x68\x79\x99\xCD\x72\x9A\xDB\x6C\x76"
-    "\xD7\xBE\x76\x67\x62\x22\x0C\xEC\xB3\xB8\xF5\x27\xBB\x02\x67\xF1"
-    "\xF9\x5A\x07\x87\xB9\x41\x58\x54\x37\xC6\x38\xD4\xCA\x36\x15\x41"
-    "\x2A\x26\x63\x9E\x4A\x7D\x7E\x16\xBB\x8C\x37\x56\x1B\xC2\xF8\x47"
-    "\xAB\x18\x3B\x4C\xD9\xE7\x45\x76\x8E\x99\xF7\x8D\x49\x5D\x73\x56"
-    "\x6B\xA4\x6F\xAB\x3A\x3E\xDE\x8A\xE1\x4D\x47\x74\x78\x5D\xAB\xD8"
-    "\x43\x96\xE7\x50\xCD\xCD\xBB\x6F\x47\x61\xB8\xFE\x28\xE2\xC3\x18"
-    "\x31\x45\x94\xCF\x22\x51\xA3\xD8\x16\x89\xC4\xA1\xA4\xC8\x44\x7C"
-    "\x3E\xB8\x70\x7D\x5C\x75\x8F\x3D\x46\x42\x9C\x1F\x34\x72\x86\xC6"
-    "\x56\x71\x27\x15\xC7\xB5\x41\x6F\x05\x1B\x42\xB2\x5B\x06\x96\x16"
-    "\x4E\x1C\x3C\xD1\xDA\xF4\xB0\x4A\x55\xB9\x6F\x16\x2E\x0D\xEE\x04"
-    "\x70\xC8\xF2\x92\xED\x45\x15\x23\x78\x73\x1C\x90\xDB\xFC\xC2\x79"
-    "\x74\x4B\x1C\xF0\x6C\x9D\x54\x95\x9B\x72\xE0\xC6\xD8\xC1\xB1\x05"
-    "\xD6\x0B\x75\x3B\x6C\xB0\xB3\x72\xBC\xAA\x8F\x29\x00\x1C\x10\x61"
-    "\x7D\x63\xB7\xD4\xE2\xD2\xB6\x38\x56\xD5\x47\x6D\x31\x93\x31\xBD"
-    "\xE5\x16\x5B\x21\x8F\x56\xB5\x49\x8B\x53\x53\xEC\xCF\xCB\x12\x8C"
-    "\x04\x35\xA9\x90\x47\x3D\x31\xAD\xE9\x02\xB1\x7B\xE4\x83\x45\xA6"
-    "\x97\x5A\x3F\xB8\x48\xC9\xE7\x4F\x64\x15\x29\xCF\x37\x24\xEE\x89"
-    "\x15\x69\x18\xF0\x8C\xDF\x1C\xE6\xC0\x96\x64\x07\x6C\x14\xE1\x6D"
-    "\x45\x07\x94\x04\xFD\x31\x9A\x2B\x11\x47\x2C\xD4\x0D\x40\x98\xE3"
-    "\xE2\x75\x79\x06\x10\x98\x9C\x61\x28\x03\x1C\x3F\xC7\x7B\x61\x76"
-    "\x93\x99\xD1\xB8\x9E\xF0\x44\xB4\x99\x44\x11\x75\xC2\xD1\x12\x21"
-    "\x47\x91\xA4\x02\xDE\x02\xB4\x07\xD9\x40\xD9\x3B\xD1\x6B\xA2\x04"
-    "\x86\x1E\x77\xEF\x7A\xFC\x25\x67\x1B\x19\x2D\x1C\x16\x8C\x89\x7B"
-    "\x5B\xCB\x5C\x75\xFE\x4D\xB3\x51\x9C\xAB\x36\x23\x43\xF0\xCF\x4C"
-    "\x3D\x09\xC6\x45\x10\xDA\x53\xCB\x51\x84\x7A\x36\xEF\x8D\x90\xCE"
-    "\x0C\xC7\x50\xC1\x3C\x10\x4F\x8C\x12\xC1\x51\xA6\x70\x94\xFD\x71"
-    "\xA4\x9A\x04\xBA\xAA\x1B\x07\x6F\x57\x61\x2F\xF3\x41\xB5\xA1\xBD"
-    "\x10\x79\x77\xBB\xDF\xF9\x8A\x3F\xFC\x21\xF3\x50\x98\x45\xBD\x45"
-    "\x66\x7C\x36\x23\xF2\x07\x77\x13\x16\xC5\xFC\x6C\x71\xD5\x82\xE5"
-    "\x55\x0B\xA2\xEF\xAA\xB3\x68\xB7\x54\xE3\xC7\xCD\x5C\xE4\xAB\xCA"
-    "\x5E\x28\xF0\xA3\xCF\x4D\x4F\x87\xE5\x36\xC6\xFA\xC3\x80\x3D\x02"
-    "\x4D\x78\x3C\xCB\x4F\x28\x84\xDA\xC6\xD8\xF7\xF9\xD0\x89\x81\xDE"
-    "\xD0\xB6\x43\xCF\xDC\x03\x64\x7D\x3E\xCF\x16\x78\xA0\x9D\x4E\x83"
-    "\x47\xB6\x2D\x63\x9F\x5E\x71\xE8\x9D\x48\xDA\xE3\xDD\x3B\x8B\x3B"
-    "\x21\xEE\xCE\x0C\xD1\xB3\x15\x74\x7B\xD3\xD1\xAC\xAC\x4F\xF1\x0C"
-    "\x2E\x46\xB7\xD7\xCE\x3E\x46\xC7\x27\x12\x44\xDD\x4F\xDE\xF0\xB3"
-    "\x59\x6C\x70\xDB\x47\xC5\xAE\x46\x12\x84\x88\x83\xFE\xFE\x5C\x73"
-    "\x15\xF4\x9D\xE9\x39\xAE\x84\xB4\x2B\x01\xC6\x55\x90\x06\x29\x27"
-    "\xAE\x84\xC4\x4F\xF8\x70\x25\x24\x7E\xBA\x85\x7E\x48\xE2\xD7\x2B"
-    "\xF6\x87\x48\xBF\xB5\xF7\xD1\x26\xC6\xF0\x76\x97\x15\xD2\x65\xA4"
-    "\x94\xA1\x51\x54\xD6\x59\x75\x7C\x3C\x22\x3B\x95\x6C\x18\x1E\x65"
-    "\x7C\x26\x63\xD9\x3E\xDA\x4C\x02\x2D\x8C\x1C\x89\xA0\x6E\x28\x81"
-    "\x81\xDA\xFA\xBC\x0E\xE9\xED\xB3\x80\x55\xEE\x03\xBC\xA5\x1E\x6C"
-    "\xBB\xCF\x85\xC2\x1F\xD0\x8D\xF4\x83\xED\x91\x3E\x7E\xB8\x6B\xFE"
-    "\xEB\xE8\xF1\x6B\x69\xD2\x2B\x6A\xD0\xAB\x6B\xCE\x2B\x6A\xCC\x2B"
-    "\x69\xCA\xB4\x5E\x63\xAF\x60\x7B\x1B\x5B\x46\x40\xF4\x4D\xF8\x34"
-    "\x95\x1B\x2F\xB5\x70\x53\x27\x65\x60\xC1\x53\x56\xD3\x12\x7F\xD1"
-    "\x5D\xDA\xFA\xF5\x8E\x76\x1C\x6B\xF7\xA9\x7D\x41\x91\xC1\xB8\x02"
-    "\x52\x07\x9E\xA1\x14\x09\x63\xCA\x9F\x7A\xEF\x52\x64\x9C\x4B\xAC"
-    "\xF8\x44\xC4\x58\x34\xDB\x9E\xD8\x6A\x97\x11\xD1\xE1\x42\xD1\xB9"
-    "\x23\xB1\x23\xD6\xB8\x3D\xAD\x5C\x4B\x34\x4B\x57\x4A\x12\x29\x3D"
-    "\x94\x02\xCE\xFE\x14\x89\x33\xEC\xD9\xA4\x3D\x7B\x10\x4A\xBC\x97"
-    "\xA7\x97\xF6\xE4\x01\x0C\x27\xD7\x9C\x8C\x11\xA3\xBA\xE4\x03\x01"
-    "\x69\x4F\x3B\x00\x94\xFD\x21\x20\x6C\x88\x35\x40\xD8\x1F\x92\x22"
-    "\xD3\x0B\x48\x90\xF9\xB1\x61\xEE\xBB\xDB\xC8\xB8\x27\x82\x7F\x0C"
-    "\x13\xD4\x6F\x89\x4F\x45\xF8\x20\x2A\xF5\x55\xDE\xAB\xA8\x82\x6D"
-    "\xF0\x6E\x45\xF5\x35\x9D\xC8\x04\xD3\x6E\xF8\x97\xF0\xFE\x5C\x1C"
-    "\x65\xAF\xAA\xC9\x3B\x58\xC1\xBE\x6A\x96\x45\x7E\x86\xDE\xF4\xF0"
-    "\x0E\x5E\x9B\x9B\x41\x03\x71\xA1\xE1\x69\x55\x37\x73\x9A\x79\xF1"
-    "\xC0\xF1\x28\x03\x79\x3C\x29\x9E\x70\x20\x81\x96\x5D\x1B\x87\x53"
-    "\x53\x69\x06\xAA\x61\x88\xE6\x30\x3F\x1D\xD5\x5C\x3D\xE5\x0D\xF9"
-    "\xF3\x03\x59\xE2\x7D\xBE\xCC\xD4\x5B\x9D\x26\xDB\x1D\x83\xEA\x5A"
-    "\xCC\x58\xEC\x94\x2A\x87\x69\xA7\xA1\x8D\x4C\xED\xF8\xC5\x0F\x4F"
-    "\xBE\xA7\xED\x79\x7E\x3B\xA6\x1B\x63\xF9\xE8\x6C\x4B\xCC\xB6\x83"
-    "\xDE\xD2\x03\xDA\xC4\x60\x1E\xFE\x72\x5E\xEF\xDD\xBF\xFF\xD9\x07"
-    "\xCD\x8F\xCB\xBD\xCF\x3E\x60\x8B\x2E\xEF\x73\x9B\x7F\x19\x65\x6F"
-    "\xB6\xF2\xE5\x74\x55\xCE\xAB\xAD\xB7\x62\x74\x2A\x4A\x60\xA0\xE4"
-    "\xCB\x35\x9E\xDA\x03\xD4\x00\xB8\xCC\xD7\x7C\x91\xED\x96\xD0\x0E"
-    "\x78\xC9\xA9\x17\xB1\xC5\xA5\xAB\x79\xB5\x28\xE6\x38\x35\x69\xC2"
-    "\x87\x31\xFD\xEF\x44\x94\x7A\x3D\x99\x21\x86\xD0\x09\x70\x79\x27"
-    "\x5E\x9F\xCA\x25\xEF\x54\x79\x56\x07\xE1\x5B\x9D\xB5\x2E\x8B\x49"
-    "\x51\xBE\xB7\x99\xEA\x63\x4E\x08\x98\xDB\xF4\xB5\xE0\x74\xD6\x51"
-    "\xF9\x85\x12\xD5\x29\x51\x9B\xA8\xAC\x58\x9A\x50\x74\xE4\x90\xDA"
-    "\x87\x2E\xCF\x8F\x66\x45\x76\x34\xAB\x8E\x38\x10\xA7\xAE\xCB\x13"
-    "\xCA\x4D\x59\x9E\x9D\x64\xF5\x72\xD2\xE2\xE2\x3A\x5A\x37\x45\xAD"
-    "\x3A\xFF\xC7\x72\xDE\xFC\xF9\x21\xF6\x14\xB6\x7C\x4C\x57\x3C\xB1"
-    "\x7B\x52\xFD\x42\x7B\xEA\xEF\x8B\xE2\x84\xE5\xBD\x0D\x2B\x92\xC2"
-    "\x48\xBF\x86\xAF\xC3\x37\x54\xCD\x98\x05\xE0\x6D\x70\x1D\xB3\xD3"
-    "\x84\xB8\xF3\x4C\x8C\xC2\x31\xB4\x08\x90\xFF\xF8\xF2\xBB\xF1\x04"
-    "\x4A\x36\x05\xE7\x3B\x82\xDF\x43\x2C\xAF\x6E\x8E\x76\x79\x50\xAD"
-    "\x28\x7A\xAD\xCA\x68\xBF\xB5\x6C\x82\x4A\xA2\xD7\x3F\xFB\x1D\x7E"
-    "\x9E\x2F\xE7\x2D\x3D\xBE\x9A\x17\x17\x0B\xA0\x04\x2F\x59\x47\x5F"
-    "\xAE\x7B\x57\x01\x74\x6E\x28\x09\x9E\xC1\xB0\x9F\x10\xCE\xC9\x0C"
-    "\x73\x5C\x5C\x6B\x34\x10\x8A\xA8\x4B\xCC\x53\x48\x71\xF2\x2E\xC1"
-    "\x56\xA1\x0B\xBE\x8A\x8B\x49\xB1\x40\x1A\x5A\xA3\xBB\xFD\xDA\x4D"
-    "\x29\x66\x86\x45\xD2\x15\x9A\x81\xB3\x4D\x10\x69\xCE\x14\x87\xFE"
-    "\xE6\x6C\x38\x0C\xF4\x20\x0D\x30\xAB\x30\x1F\x7D\xF7\xE2\xD5\x93"
-    "\xC7\xDB\xA4\x46\xFB\xC0\x3E\xFD\xFF\xDB\x7B\xD6\xE6\xB6\x8D\x5D"
-    "\xBF\xE7\x57\x30\x6A\xE6\x4A\x6A\x65\xC5\x49\x4F\xE7\xB4\x4E\xDD"
-    "\x4E\xE2\xA4\x8F\x7B\xF2\x9A\xC4\x39\x9D\x33\x99\x8C\x43\x49\xB4"
-    "\xCD\x46\x26\x35\x24\x15\x27\x4D\xFD\xDF\xEF\x02\xD8\xF7\x62\x49"
-    "\xCA\x76\x9E\xF7\x68\x3A\x75\x48\xEE\x62\x77\xB1\x58\x2C\x16\xC0"
-    "\x02\x0F\x7F\x65\x25\x4F\x59\x17\xB1\xEA\x2B\xA0\xCF\x98\x49\x8C"
-    "\xA4\x45\x70\xE2\xE2\x0A\xEA\x11\x0C\xB6\x66\x42\xE3\x5E\x34\xC1"
-    "\xB2\xB3\x79\xCA\x66\x60\xFF\xD4\xBB\x26\xC6\x91\x4A\xD4\x89\xE0"
-    "\xD9\xEF\xF6\x8E\xA9\xC2\x54\x59\x01\x82\x40\x35\xA5\xEE\x57\xEE"
-    "\xA8\x98\x54\x7F\x80\x79\x3C\xC5\xF7\x70\x25\x7E\x99\x83\x7F\xE1"
-    "\x44\xE6\x9F\xD3\x79\xEB\x74\x0E\xD7\x3A\x17\x87\x02\x70\xF7\x4F"
-    "\x67\xE2\x33\x9C\xE8\xBE\xB6\xB2\xD4\x2D\xA6\x49\xB2\x8F\xAE\x87"
-    "\x45\x03\x2E\x7C\x56\xC6\x57\xBC\x0A\x87\x10\xD0\x25\x02\x56\x5B"
-    "\x0A\xA0\x5E\x01\x04\xE5\xF2\x07\x77\xD9\x65\x4A\x87\x14\x5C\xE6"
-    "\xE7\x75\x6D\x1C\xEC\x64\xA2\x72\x59\x76\x58\x63\xF7\x81\xC1\x6D"
-    "\x09\x48\xBA\xC5\x46\x70\xE8\xD9\x1A\xFC\x27\x20\x63\x84\x10\x55"
-    "\x0A\xD1\xA7\xFB\xF9\xAB\xEC\x34\x87\xE3\x1A\xC6\x96\x31\xC5\x01"
-    "\x04\x78\x2E\x9A\x51\x41\x97\xB4\x8B\x3E\xC0\x10\x02\xCD\x22\x03"
-    "\x20\x0A\x63\xBF\x83\x47\xA1\x49\x05\x88\xED\xAC\x57\xAB\x25\xF4"
-    "\x5A\x9A\x68\x90\x32\xAA\x35\x74\x7B\x42\x0E\x08\x43\x01\xFA\xB6"
-    "\xC2\xD2\x10\xE1\x00\x4A\xE1\xF5\x5D\x83\xBE\xA1\x49\x38\x28\x70"
-    "\xAB\x4E\x60\x10\x70\x87\xC6\x3E\xC3\xCC\x83\x5F\x23\x8E\x91\xB5"
-    "\xE3\x94\x1E\xEB\x3C\x85\xD0\x17\x6F\x84\x1A\x7D\x1A\xB5\x00\x40"
-    "\xE2\xD2\x1B\xAF\xC0\x69\x14\x9F\x12\x01\xFF\x11\x3C\x59\x0C\x6F"
-    "\x91\x01\x6E\xD7\xCB\x45\x42\xCC\x93\xF2\xFB\xEA\x6E\x9C\xC2\x05"
-    "\xC3\x19\xFA\x45\x34\x3A\xF4\x08\x54\xF7\x1A\xD4\x13\x8E\x87\xA8"
-    "\x89\x84\xE2\xE2\x24\x00\x0A\x70\x10\x30\x38\xB6\x28\x5F\x0D\x49"
-    "\xBF\xE9\x12\xF9\x82\x4D\x92\x63\xD3\x73\xBB\xE3\x07\x45\xD9\x1C"
-    "\x00\x81\xAE\x4F\x32\xF2\x2D\xA9\x20\x38\x4B\x41\x1A\x5C\x41\x37"
-    "\x0A\xAC\x9E\x35\x3D\x69\x4E\xFF\xDC\x19\x83\x7E\x4D\x15\xA1\x10"
-    "\x7F\x78\xED\x26\xC5\xD9\x4D\xF6\xD3\x99\x17\x55\x4C\x90\xB9\x78"
-    "\xA9\x6F\x22\x63\xD0\x2F\xF1\xE2\xBE\xC0\x14\x30\xA9\xAF\x3D\x18"
-    "\x53\xFB\xFA\x35\x46\x09\xA7\x80\x2F\xE8\xF9\x7B\xF7\xD1\x03\x54"
-    "\xF5\x57\x4E\x58\x3B\x06\x88\x7F\x0F\x90\x36\x60\xBA\x85\x8D\x2E"
-    "\x43\x32\x07\x26\xB9\xF3\x0A\xB0\x1C\x0C\xED\xF7\x7F\x4B\xF2\x32"
-    "\xE8\x88\x42\x9E\xAC\x23\x5E\xA9\x3C\x98\xD2\xBB\x9E\x81\x64\xDC"
-    "\xF5\x2D\x48\xF0\xD2\x86\x14\x8C\xC0\xCD\x78\x24\x7D\xEC\xE1\xC6"
-    "\x86\x37\x02\xA6\xB2\x7D\xCB\x56\xE3\x10\xF3\xC5\x0B\x10\x42\xDE"
-    "\xC9\x8A\x79\x66\x8F\xDC\x8D\x0D\xB7\xD1\x1C\xD6\x13\x9B\x5D\xB8"
-    "\xB9\x71\xC0\x66\xD7\x58\xF5\x9C\x1D\x47\x7E\x44\x18\xDC\x87\x3D"
-    "\x5A\xA4\x4F\xF5\x05\xE6\xE4\xF9\x0B\xAE\x80\xFC\xE0\xEE\xD1\x9F"
-    "\xC3\x1D\x7E\x0F\x33\xF1\x5B\xFC\x36\xEA\xAD\x36\x2C\xE4\xD9\xA0"
-    "\xDC\xFA\x90\x6C\xD6\x9A\x2C\xFF\xFE\x3E\x4C\x2F\x32\xB8\x14\x51"
-    "\x1A\xDD\xDB\x32\x39\x74\xBF\xF3\x06\xFF\xE1\x07\x66\xE6\x70\x8E"
-    "\xC4\x1B\xDF\x9A\xAB\x86\xD2\x61\xCF\xC5\x15\x90\xAA\xC8\x6D\x62"
-    "\x6B\x8B\x32\x74\xA7\x5A\xD8\xA5\xE9\x6A\x5D\x1F\x8F\x54\xAB\x60"
-    "\xD7\x04\x48\x75\x06\x9E\x84\x0A\x98\x37\x9B\x06\x08\x55\x8E\x4C"
-    "\x57\xD8\x96\x80\x3E\x1E\x7B\x32\x16\xD1\xE2\xC8\x1B\x36\x5C\x41"
-    "\xF2\x87\xAC\x38\xB1\x98\x40\xD3\xDF\x6D\x79\x5E\xA9\xCD\x7D\x88"
-    "\xC3\xBC\xAA\x71\x0A\x27\x86\xB1\x94\x10\x0F\xA9\xE6\x48\xEF\x8B"
-    "\xBA\xA6\x1F\xE5\x30\xF2\x63\xC8\x61\xDC\xF9\xEC\x4B\xC0\xFD\xB1"
-    "\x17\xC4\x2C\x09\x34\x27\x23\xA7\xD3\x98\xAC\x53\x2F\x50\x0B\x22"
-    "\x2C\x93\x96\xCB\x6D\xEC\xCD\xB4\x8B\xDD\x7B\x85\xED\x2D\xBD\xBC"
-    "\xCB\xAE\x5D\xB7\xE4\xDA\x2E\xC9\x35\x3C\xDB\xDB\x84\x8C\xD9\x7B"
-    "\x72\x9F\x24\x82\x62\x77\xF6\xDA\xAE\xEC\x5D\x02\x82\x3A\xAF\x47"
-    "\xC6\x6E\x47\x02\x65\x7A\xB1\x1C\x18\xAD\xDE\x67\x16\x89\xA1\x3B"
-    "\x10\x43\x4B\x1C\x86\x44\xF3\x67\xEE\x70\xAE\x59\xBD\xBE\x83\xBB"
-    "\xC4\x4B\xB8\x4B\x2E\x0E\x03\x9C\x53\x07\x13\x71\x2E\x82\x9D\x1F"
-    "\x1E\x7A\x5D\xBF\xFF\x02\xEF\xCA\x77\x5F\x95\x7F\x0F\x13\xC2\x5F"
-    "\x94\x7F\x4F\x73\xD2\x11\xF3\xA4\x47\xC8\x13\x4F\x42\xF0\xEE\xDB"
-    "\x9D\x57\xD4\xA2\xE3\x9D\x2C\x4C\x12\xA6\x92\x95\x6E\x71\x78\xC6"
-    "\xC9\x90\x85\x22\x6E\x95\xFA\x50\x89\xB7\x69\x45\xD9\x61\xAD\xE4"
-    "\xCD\xD8\xEC\x4C\xE7\x4B\x21\x89\x02\x86\x60\x99\x8C\x06\x08\x22"
-    "\xA2\xBF\x4E\x2C\xD9\x0B\x64\xAE\x88\xE2\xD4\xDE\x5A\x64\xC9\x2E"
-    "\x1D\xA8\x82\x6F\xCE\x39\x31\xE0\xA6\xC4\x54\xAA\x37\x46\x2F\xF7"
-    "\x6F\xDF\x31\x29\x85\x47\xD7\xDE\xB1\x12\xE2\xD9\xF8\x65\xB7\x2A"
-    "\x36\xA6\x0F\x16\xB8\x35\x2A\x81\xF3\x61\x97\x68\xFE\x52\x10\x6C"
-    "\x6F\x4D\x1F\x0C\xC1\x56\xBE\xE2\x0B\xA1\xF8\x5C\x6B\xD8\xF0\x04"
-    "\xF6\xA6\x15\x79\x52\xCB\x59\xA1\x55\x40\x57\xDE\x53\x21\x01\x4B"
-    "\xE5\x1C\x84\xAF\xA3\x2F\xBA\xA6\xBD\xAE\xED\x5B\x4E\x46\x42\xC4"
-    "\xBF\x31\x5B\xF3\x65\xD8\x75\xFB\x5B\x91\xCF\x69\x41\xB5\x5A\xE9"
-    "\x61\xA5\xFD\x28\x19\xD9\xAC\x69\x00\x44\x9A\xA7\x16\x1B\xB0\xD1"
-    "\x4E\x93\xA2\x14\x42\xB6\xBE\x4E\xEB\x64\x95\x42\xA8\xE6\x8A\x8E"
-    "\xDB\x68\xF6\x69\x50\x57\x08\x36\xC7\x25\xC4\xB0\x9D\x1F\x8B\x11"
-    "\xD5\x5A\xC7\x66\x79\x4A\x58\x3A\x16\xEF\x0B\xF8\xF1\xEC\x6B\x30"
-    "\xDE\x47\x74\xE8\x71\xBE\xDA\x7A\x1E\xF5\x7E\x0F\xBB\xF7\x98\x7A"
-    "\x37\x72\x00\x4E\x3C\x10\x13\x27\x16\xA9\x9B\x26\x6E\x75\x7A\x02"
-    "\xE9\x1B\x05\x1D\xC2\x1F\x65\x82\x90\x04\x0A\xB5\xA2\x5F\xC1\xB7"
-    "\x23\xFA\x11\x30\xB3\x07\x88\x11\x5F\xEF\xAB\x7F\xAB\x22\x14\x80"
-    "\x99\xD0\x1B\xC4\x25\xA3\xFA\x07\x30\x20\xF1\xF1\xE6\xB6\xF3\x16"
-    "\xC7\x15\xBE\x6E\x30\x5F\xF4\x0D\xF7\xE5\xAC\x6C\x9A\xF2\x24\x2C"
-    "\x0C\x57\xF1\x8F\x2A\xF0\xDF\xD8\x2B\x97\x78\x50\x1C\x40\xE4\xEB"
-    "\x7A\x56\x56\xE5\x20\x34\xA4\x13\x9E\xDB\xCE\x85\x10\x9D\x12\x0B"
-    "\x39\x9C\x26\x08\x09\x5C\x82\xF9\x80\x06\x8D\x3C\xFE\x4D\x34\x07"
-    "\xD1\xD7\x67\xAA\xA0\x9D\x72\x42\xBE\x42\xD5\xCE\xCD\xBB\x7B\x04"
-    "\x82\x89\x85\xAC\xD1\x7D\x46\x95\x4D\x28\x5F\xFD\x45\x30\x2E\xB1"
-    "\x0E\x8B\xB9\x0A\x9A\xE1\x79\xF0\x10\xE7\xA1\x81\x8F\xA8\x59\x27"
-    "\x66\x89\x9E\x3A\x35\xEC\xFE\x6C\x97\x58\x96\x04\xCD\x03\xB5\xFC"
-    "\x19\xDA\x40\x32\x89\x9E\xE0\xEE\xE6\x69\x5A\x2D\x26\x40\xD5\x63"
-    "\x95\x2B\x00\xE3\xF4\xEA\xD5\x24\x96\x0B\x4C\x04\x58\x75\xC1\x63"
-    "\x4A\xA5\x7A\x88\x5E\x20\x15\x73\x41\x70\x78\x54\x11\x9C\xC7\xA7"
-    "\x27\x23\xBA\xC7\x1A\x52\x07\x81\x97\x3D\x4B\x7E\x96\xCF\xD0\xF0"
-    "\x4E\xB2\xA5\x1F\x5A\x86\x26\xD9\x51\x2E\x96\x79\xDA\x94\x92\x11"
-    "\xA9\xD9\x1E\x89\xBA\x13\x5C\x8A\x63\xE0\x54\x55\xDD\x36\x90\xC6"
-    "\xE2\x29\xDC\x60\xC4\x30\x7E\x97\xAD\x8C\x74\x59\x7B\x48\x46\x2C"
-    "\x35\xE2\xAA\x3E\xB6\xA7\xF5\x43\x41\x90\x81\x45\x59\xA2\x01\xC5"
-    "\x58\x05\x73\x3A\x17\xCB\xAF\x19\x05\x56\x5B\x07\x60\xC1\x41\xCB"
-    "\x0F\x47\xBA\xA1\x98\xED\xBA\x91\x33\xB6\x6B\x35\x28\xF6\x60\xD6"
-    "\xB3\x39\xF7\x4E\x8D\x5E\xAF\x79\x81\xE6\xCD\x8E\x9C\xC5\xB4\xC1"
-    "\xC0\xFA\x70\xA7\x57\xCC\x00\x5B\xF6\xED\x4E\x40\x23\xA1\x6B\xFD"
-    "\x59\x9B\xE1\x97\xE2\x56\x63\x86\x15\x19\xB8\xDA\x9A\x27\xF4\x6F"
-    "\x5D\x63\xB0\x13\x4C\x40\x34\x1D\xD8\x6A\x4B\x9F\x16\xDD\xE1\x0C"
-    "\x24\x26\x61\x87\xA7\x7F\x79\x09\xBD\x0A\xFA\x58\x38\x5F\x62\x3E"
-    "\x88\x31\x4A\x5D\x55\xE5\x62\x0D\x96\x0B\x0A\x0B\xEE\x10\xEB\x05"
-    "\x68\x15\x3D\x05\x7B\x53\xEB\xE5\x93\xEB\x17\x4C\xAF\x54\x96\x66"
-    "\xEB\xA2\xA4\xEA\x4C\xD3\xE7\x44\xAC\x80\x20\x41\xAB\x28\xBD\xD3"
-    "\x6D\x80\x8B\xF3\xD7\x7D\x03\xED\xBF\x7C\xD6\xE9\xF5\x25\xD2\x2D"
-    "\x4D\xD9\x85\x09\x97\x99\xAB\x4F\x87\x7C\xE7\xE9\x72\xBE\x5E\x62"
-    "\x14\xB6\xD7\x19\xE5\x54\xC1\x7B\x8C\xA0\x3B\x02\x07\x7B\xF1\x98"
-    "\x16\x0F\xEA\xE4\x24\x5F\x8A\xE3\x36\x5E\x81\x8D\x13\xAE\xCA\x02"
-    "\x11\x50\xAF\x2E\x51\xE0\xBD\xB7\x33\x05\x35\x14\x39\x55\x01\x94"
-    "\x37\xB1\x4B\x47\xAA\x4B\xE8\x10\x14\xEB\x93\x82\x14\xF9\x89\xD1"
-    "\x6C\x3B\x29\x42\x8A\x12\xAD\x87\x91\xAB\xC6\xB2\x61\xBA\xCF\xD3"
-    "\xD8\x87\x1F\x68\xD8\xBB\x76\x1C\xAC\x11\xCE\x90\x87\xA6\x9C\xF5"
-    "\x89\xBB\x12\xD5\x87\x22\x7C\xAD\xCE\x3E\x27\x79\x83\xF7\x1B\x4C"
-    "\x23\x80\x81\xD1\x58\x10\x32\xF8\xDC\x63\x7F\xDC\x9A\xF6\x6D\xD9"
-    "\xB0\x6B\x5B\x62\xE9\x88\x4F\x3F\x49\x85\xE0\x56\xE4\xDA\x2C\x35"
-    "\x8F\x6E\x38\xBD\xD6\xE4\xE1\x08\xB1\x29\x3A\xF5\xD3\xAE\xEA\x75"
-    "\x54\x05\x27\xD0\x20\x96\x30\x56\xC0\x99\x0D\xE1\xC1\xAF\x88\xAC"
-    "\xF3\x56\xBF\xC8\x59\x95\xA5\xAF\x94\xB3\x04\x45\x6E\x53\x6E\xA2"
-    "\xF6\x7A\x0B\x81\x7A\x2B\x9A\xE3\x87\xD0\xEF\xEB\x49\xC1\x71\x40"
-    "\x59\x22\xA2\xA2\xC5\x73\xBF\x7F\x59\x3D\x3C\x0E\x72\x24\x23\x8F"
-    "\x77\x18\xA1\x1F\x8B\x4F\x65\x5E\x3C\x60\xA7\x83\x9B\x0B\x27\xBF"
-    "\x08\xFC\xB4\xA3\x47\x56\x34\x79\x95\xC9\x73\x95\x4F\x5A\x0D\x86"
-    "\x03\x15\xCB\xE7\x69\xF3\x76\x09\x6C\x77\x4E\x89\x23\x51\x01\x71"
-    "\xC7\x3D\xD5\xFA\xBE\x84\x76\xF5\x27\x90\xB6\x96\xAE\x08\xA9\xFE"
-    "\x9D\xE6\x8B\xE6\xD8\x3C\x1E\x67\x70\xCE\x0E\x7B\xE9\x77\x3A\x15"
-    "\x13\x07\xD3\x83\x3D\x68\x2B\x2B\xDD\x79\xD1\xA3\x09\x16\x06\x9E"
-    "\x42\x9F\x35\xF9\xB2\x9E\x02\x2F\xBB\x43\x1F\x46\xB2\x97\x13\xAD"
-    "\x5B\x98\x36\xF9\xFC\xD5\x7D\x54\x7A\x07\x69\x46\xE4\x62\x23\x3D"
-    "\x81\x04\x3D\x85\x47\xAE\x98\x52\x1C\x38\x03\x16\xEB\x4A\xD5\xC3"
-    "\xEF\x5C\x45\x52\x2D\xA8\x62\xE2\x89\x2B\xA4\x55\x0D\x2E\x02\x2D"
-    "\xF8\x54\x82\xEA\x76\x20\xB5\x16\x14\x94\xBE\xC9\x64\xCA\xA2\xBA"
-    "\xAD\xB4\x46\x93\x3C\xB1\x4B\x12\x93\x68\x1C\xC3\x05\x26\xC4\xF4"
-    "\x6D\x31\x4F\xA8\x22\x9A\xC0\x78\xA4\x7A\x68\x22\xBB\xED\xA1\x55"
-    "\x2B\x7D\x2E\x13\xA8\xD4\x32\x5D\x26\x48\xF5\xF3\xD1\xE7\x3F\xA3"
-    "\xCA\x0E\xF0\xD9\x0B\x91\xA2\x27\xA8\x25\xC1\x35\x64\xAF\x2F\xF8"
-    "\x2A\x57\xD6\x78\x0A\x30\xEF\x60\xA7\x48\xF3\x65\xBD\xD8\x17\x04"
-    "\x5B\xFB\xAB\xCF\xE0\xB4\x3F\xFC\xFB\x02\x0D\x16\x74\x78\x64\x61"
-    "\x2B\xD4\xF6\x87\xFC\x04\xB0\x6A\x81\xC6\x67\x0D\xBB\x83\x3A\x9B"
-    "\x2A\x3F\x41\x25\xB8\xBA\x30\x06\x62\x33\x38\x1A\x0A\x4E\x5D\x2B"
-    "\x27\x16\x6A\x1E\x13\x36\x02\x66\xE5\xE5\xAC\x6E\x06\x81\xD7\xC5"
-    "\x48\x4C\xD0\xDC\x4D\xEF\x63\x8F\x97\xA5\xD8\x9F\xFC\xE1\x0B\xA6"
-    "\xEC\xE8\x3E\xDB\xB6\x73\xF8\xB9\x85\x61\x34\x77\x30\xBF\x94\x07"
-    "\x85\xF6\xEB\xE7\x83\xB4\x19\xBC\x10\xCB\xD8\x74\xAC\xD5\x47\x1B"
-    "\x42\x95\x38\x9A\xD7\xAE\xDE\x78\xA5\xAD\xEE\x78\x5F\xFA\xF7\xC7"
-    "\xEF\x50\x1B\x7A\xC0\x7B\xBD\xA5\xC3\x11\x9B\x20\xF7\x0E\x57\x59"
-    "\xB8\x0D\xD0\xD7\x70\x12\x94\x22\xF2\xA2\x0C\xA1\x4F\x63\xA2\x77"
-    "\x4F\x33\x29\x16\xA1\x1C\x41\x3E\xCA\x40\x97\x29\x2C\x1C\xAE\x02"
-    "\xBA\x33\xAF\xAB\x54\xEA\x80\x91\x27\x53\x72\x44\x41\x92\x98\xD3"
-    "\xCD\xCA\x17\x9A\xAE\x20\xAD\x64\x95\xA3\xEF\x2D\x64\x34\x2A\x16"
-    "\x70\x87\xBC\x17\x22\xB2\x46\xA5\x21\x87\x4B\xB0\x48\xF7\xE2\xD9"
-    "\x9B\x33\xF4\x13\x53\xB3\xEF\x2B\xF7\xDD\xAF\x0C\x93\xB4\x79\x9B"
-    "\xBC\x47\x3F\x72\xDA\x1C\x5B\x97\xE1\xDD\x2F\xC9\x37\x2E\xA5\xF5"
-    "\xA5\x06\x40\x17\x89\xFF\x80\x61\x89\xF5\x59\x5A\x93\xDF\x38\xC4"
-    "\x25\xA9\x93\x57\xD9\x0A\xAE\x0D\x59\x72\x6A\x2F\xE8\x16\xC6\x54"
-    "\xEC\x96\xED\xA0\x90\x57\x00\x30\xEA\x24\x7B\xF7\xB8\x80\xFC\x36"
-    "\x1A\xD4\x14\xEE\x85\x41\x62\x27\x44\x6F\x52\x2E\x03\x64\xA4\x93"
-    "\x74\xC0\xBD\xDC\x5E\xB6\xC0\x14\x2C\xC4\x01\xFB\x23\xCF\xC9\x7A"
-    "\x35\xBF\x25\x96\x85\x93\x1D\xD0\xCD\xDB\x26\xAF\xB7\xBB\xE6\x2A"
-    "\xAF\x88\xBC\xED\xCE\xF5\xF4\x2C\xA4\x4F\xA4\x16\xAB\x3E\x4F\x2D"
-    "\x6E\x01\xE8\xA3\xFD\x2A\x98\x08\xB9\x52\xDA\xA6\xB6\x0B\xA2\x3F"
-    "\x0F\x97\x00\x32\xD2\xC9\x36\x6A\x39\x6F\x2F\x3B\xA8\xC5\x06\x1B"
-    "\xD9\xF7\x7A\x35\xFF\xA1\x89\xC5\x91\xD2\x3C\x4E\x49\x2A\x40\x87"
-    "\x51\x5A\x2D\x45\x58\xE3\x0A\xFD\xF6\x93\xBF\xB2\xAA\x54\x29\xAB"
-    "\x13\x4A\x05\x9E\xAC\x8B\x65\x56\x2B\xCE\x08\xE7\xDC\x22\xC9\x72"
-    "\xD0\x73\x24\x20\x44\x05\xC0\x2C\x21\x4F\x75\x6C\xEB\xE6\x77\xDF"
-    "\x39\x1D\x82\x67\xBE\x1F\xB8\x39\x63\x2F\x70\x88\x2D\xDB\x71\x7F"
-    "\x21\xF2\xB7\xB2\xCA\xFF\x02\x47\xC6\x25\x1C\x25\xD5\x1E\x33\x31"
-    "\x48\x9C\x24\xDF\x8A\xFF\xB8\x7B\x82\x1A\xCD\x5A\xAE\xC5\x73\xF1"
-    "\xF6\x80\x42\x56\x70\x23\x20\x8A\x3B\x57\xF7\x71\x5D\x60\x75\xDD"
-    "\x7F\x51\xEC\x71\x29\x4E\xF7\x1D\xE5\x6E\x85\x7D\x37\x4D\xAD\x84"
-    "\x34\x0A\x6D\x8D\x38\xA5\xAE\xB3\x16\xC7\x2C\x7A\x18\xC4\xB4\x8F"
-    "\x83\x16\x63\x8F\x81\x30\x05\xCF\x3D\x10\x97\x03\x44\x47\xC2\x4D"
-    "\x99\x4E\xD9\x7E\xDE\x49\x93\xB1\x20\xBA\xE6\xCC\x29\xD6\x6B\xA0"
-    "\x1F\x68\xAE\x7A\xF4\x3F\x2C\x77\x8E\x01\x5C\x60\x8E\xB4\xF9\xFB"
-    "\x1C\xD3\xF3\xF8\xF4\xA4\x7B\x72\xAC\x42\xBD\x46\x66\x5B\xA0\xE3"
-    "\x13\x23\xB9\xE1\xF9\xA6\xA5\xB3\xDF\x7E\xA9\x8D\x3B\xDE\x32\x21"
-    "\xA6\xE7\x2C\x9F\x2E\x8B\xB6\x99\x90\xBE\x13\xF2\xAC\xD4\x7A\x10"
-    "\x8D\x68\x1F\x1C\x86\xFB\xF2\xDA\x3B\xF3\x45\x49\x82\xE3\x69\x53"
-    "\xFE\x92\xBF\x11\x9B\xE7\x8D\xF1\xD9\x4B\x8B\x82\x4C\x89\xA8\x6E"
-    "\xA3\x05\xBA\xDC\xA2\x5A\xA0\xAB\x12\x11\xED\x86\xD1\x53\x48\xE0"
-    "\xEA\x83\xEE\x16\xC0\x0B\x5E\x6E\x0C\x4D\x75\xC3\x81\x16\xE9\x9B"
-    "\x3E\x58\x59\xDA\x1F\xBD\x93\xE9\x8F\xB1\xBE\xC4\x6A\x8B\xDE\xC4"
-    "\x34\x1F\xC9\x75\x8C\x36\x0A\x7D\x33\xE0\xAD\xCE\xF1\xAA\x2F\xC7"
-    "\x1C\x93\x2E\xCB\xE2\x48\xE9\x2B\xE1\x70\x16\x51\xA9\xDE\xB6\x6C"
-    "\x29\x42\x38\x73\x4C\x2B\x9E\xAF\x99\xEC\xAD\x5D\x04\x3A\x6B\xCF"
-    "\x75\x54\x23\xDB\xD6\x8C\xEF\xC3\xD6\xA7\x9D\xA4\x17\x8A\x83\x35"
-    "\xF6\x52\x6A\x91\xAF\xBD\xF3\xC7\x7E\x36\xD1\xAA\xE3\x6B\xEF\x82"
-    "\x2E\xC3\x4C\xC4\xCF\xDB\x7A\xE6\xC5\x31\x7A\xB4\x3D\xFD\x2E\xF9"
-    "\x9A\xCC\xCA\xEE\xBC\x49\x6D\x8E\x47\x2B\xEC\x74\x0A\xF6\x80\xCA"
-    "\x85\x80\x4F\x68\xBA\x6E\xE3\x10\xD6\x42\x6D\x2B\x66\x90\xC6\x95"
-    "\x8A\x9B\x51\x02\x07\xAD\x98\x93\xAB\x6F\x43\x41\x2F\x4E\xF7\x55"
-    "\x10\xEA\x88\x3E\x6B\xA7\x58\x7A\x0C\xDC\x62\x75\x29\xFB\xD1\x2A"
-    "\x85\x26\x1D\xF1\x19\xFF\x4E\xEC\xBE\xFA\xF1\x80\x42\x6F\xD0\xD4"
-    "\x78\x5E\x26\x14\x7F\x84\x54\x9F\xE4\xEC\x8F\xF7\x79\x0F\x31\x24"
-    "\xC0\xBC\xC4\x50\x41\xC6\x9A\x0A\x33\x56\x0B\xAA\xAD\x31\x84\x41"
-    "\x91\xA4\x50\x96\x40\x68\xA7\xD1\xEC\x4D\x7A\xB2\x5A\x66\xA6\x16"
-    "\x46\x43\x78\x77\x05\x6D\xA3\x74\xD2\xD9\x91\x4F\xE2\x59\x3A\x93"
-    "\x0D\x76\x64\xA0\x4E\xF9\x5A\x50\xC1\x60\xE7\xE6\xB7\xFF\x34\x6F"
-    "\xE4\x41\x6D\xE7\xFB\xEF\xA7\x3F\x7C\x2B\x38\xC7\xB6\xF9\x44\x27"
-    "\xCD\x9D\x1F\x6E\x4E\xB7\xB7\xDD\x2F\x8B\x9C\x7C\x03\x05\xAC\x9B"
-    "\xFF\x0C\xBE\xA6\x02\xDC\xCD\x1B\xFF\xD8\xFE\xF6\xBB\xEF\xE8\xDD"
-    "\x19\xFC\x39\x63\x2E\x24\xAB\xA1\xE8\xFB\x18\xC6\x1D\x76\x02\x61"
-    "\x4C\x90\xFD\xCF\xF1\x98\xF7\x9B\x28\x52\x1A\x17\x08\xF4\x0F\x35"
-    "\x08\x74\x2F\x11\x73\xD9\x68\xF1\xBD\x5C\x3C\x40\x6C\x67\xF6\x6B"
-    "\x5A\x68\xF2\x35\xBE\x37\xDE\x7B\x32\x02\x41\xC5\xDE\xA2\x12\x1F"
-    "\x79\xD3\xA0\x1C\x08\x57\x49\x8C\x8B\xAF\xF3\xBE\xF3\xE4\xE2\x5D"
-    "\x27\x88\x4D\xED\x5C\x87\x0A\x54\xB8\x96\x2F\x7E\xBD\x9E\xD5\xF3"
-    "\x2A\x9F\x65\x23\x3D\x9E\x09\xAE\x80\x73\x5E\x4B\x6B\xBB\xA9\x84"
-    "\x17\x7F\x9C\xDE\x6D\x75\xF4\x6E\x5D\x5C\x76\xFF\x04\x25\xE4\x78"
-    "\xF1\x4E\x9D\xA0\x5F\x65\x62\x57\x09\xDC\x36\x4D\x7C\x6D\xE9\xDD"
-    "\x02\x61\xB5\xC9\xC1\x21\x88\xAA\x6D\xCA\x2A\xEA\x7B\x2E\x80\xBE"
-    "\x68\xAD\x23\xEB\x11\xF0\x1F\xDD\x8A\x31\x55\x89\x07\x9D\x7A\x16"
-    "\xC8\xA5\x3D\x6F\x9E\xF4\x00\x16\x89\x38\xC8\xA0\x52\xEE\x62\x97"
-    "\x8B\x4A\x02\xBA\x21\x2A\x7F\x72\x2B\xC6\x51\xE9\x40\x8F\xA0\xB2"
-    "\x3F\x2E\x3B\xA1\x31\xB8\x74\x91\x59\x16\x0F\x24\x7D\x23\x53\xC4"
-    "\x70\x59\x2E\x12\x0D\xBF\x01\x6C\x30\xE1\xBD\x94\x27\xC7\x71\x5A"
-    "\x3F\x3A\x2D\x1E\x57\xE5\x2A\xAB\x9A\xB7\x23\x8B\xBD\xB1\xB6\x1C"
-    "\x88\xC4\x6A\xB9\xA8\xD0\x7D\x76\x6C\x22\x60\xC9\xC1\xC0\x4D\xBD"
-    "\xFA\x38\x3F\x0C\xA4\x88\x10\x87\x5E\x2D\xBA\x8F\x2F\x3A\xFD\xDC"
-    "\xEA\xE5\x8B\xFE\x26\x1D\x45\x81\xA0\x4D\xBB\x0E\x8A\xB5\x8A\xB2"
-    "\x16\xC0\x26\x5C\x50\x12\x22\xAE\x9A\x68\x67\xB9\xA8\xC1\x80\x83"
-    "\x01\x60\x0B\x08\xEA\x4A\x69\x78\x4E\x21\x28\x0E\x9C\xE7\x1A\x8C"
-    "\x07\xD2\xDD\x89\x43\x3A\x32\x0A\x19\xE7\xB9\x21\xFF\x17\xE0\x0E"
-    "\x41\x81\xC4\xA6\x59\xD1\x54\x79\x56\x33\xA3\x6C\x21\xCE\xE8\xBA"
-    "\xE2\xAD\xDF\x6D\x4C\xAD\x97\xD2\xD3\x0A\xAB\x2A\x83\x84\x9A\xE8"
-    "\x36\x82\x1A\x74\xE4\x11\x0A\x24\x04\xF7\xA1\x3C\x31\x28\x34\xDB"
-    "\x18\x8A\xDD\xF0\x52\xD8\xB5\x77\x82\xB6\xCF\xB6\xA8\x1F\x2F\x03"
-    "\x66\x6F\x46\xC1\x3F\xF1\xBC\x6A\x9E\xAE\xD2\x79\xDE\xB0\xB1\x10"
-    "\x0D\x9D\xF3\x5B\x86\x32\x86\x86\xDB\xB5\xBF\x6C\xF8\xFA\x55\x56"
-    "\x67\x6E\x7D\x56\xAC\xA1\x89\x0C\xC4\x17\x7A\x1D\x8A\x2F\x97\x3C"
-    "\x6D\xAD\xD3\x15\x99\x26\xC5\x90\xE2\x93\xB5\x41\x62\x5C\x69\xC0"
-    "\x0C\xB1\x0C\x8E\x6B\x2A\x88\xB1\x5F\x89\x0C\xE2\x7C\x1D\xCB\x6D"
-    "\x2E\x52\xFB\xC4\x5E\x5F\x8B\xEC\x30\x5D\x2F\x29\x45\x02\xC8\x94"
-    "\xDC\x7C\xCB\x0A\x3E\x87\x15\xF5\xC7\xC9\xCF\xDE\x36\xB0\xE3\x40"
-    "\x8C\x74\xC0\x5E\xAE\xBD\x3A\x40\x15\xA2\x1D\xB0\xF7\xF4\x3E\x1D"
-    "\x20\xA7\x40\x77\x9F\x19\x91\x8B\x21\xF9\x05\x60\xC2\x0E\x9F\xCC"
-    "\x03\xCE\x15\xAC\x07\xE7\xAE\xB1\x21\x02\xC6\xC1\xD6\xF1\x4F\x1C"
-    "\x3B\x9E\x7E\x83\xC8\xB4\x59\xFE\x11\x6C\x64\x61\x0C\x53\x32\x62"
-    "\x36\x35\xED\xED\x60\x75\x74\xFB\x85\x74\xA7\xF8\xD1\x84\x34\x0E"
-    "\xC6\x67\xE2\x37\x51\xB0\x16\x19\x26\xCC\x29\x13\xEE\x85\x1B\xAC"
-    "\x02\xD6\x29\x1D\x8E\x8C\xDA\x31\x5D\x45\x54\x8B\xAC\x60\xDF\x0B"
-    "\x56\xD5\x73\x16\xC7\x45\xAF\x42\x40\xB7\x3F\xD8\x2D\x08\x6C\xEC"
-    "\x9C\x8E\xE4\xAD\x02\x18\xFC\x42\x42\xCC\x3F\x9E\x7B\x77\x2F\x7D"
-    "\x89\x0A\x00\xBB\xA3\x98\xB1\x7D\x69\x56\x49\x15\x70\x61\x56\xFD"
-    "\xDB\xFA\xAE\x36\xBF\xC1\x8E\xDE\x07\xED\xAF\x30\xA1\xF0\x09\xFE"
-    "\x5A\xEF\x71\xDB\x12\xEF\xF1\xAF\xF5\x1E\x75\x09\x89\xE3\x5D\x3F"
-    "\xC0\x65\x21\xDE\xE2\x5F\xEB\x3D\xF0\x67\xF1\x1A\xFE\x58\x6F\x25"
-    "\x9B\x82\xB1\xD0\xBF\xEC\x6F\xC4\x43\xE1\x1B\xFD\xCB\xFA\x66\x16"
-    "\xBE\xF8\x6C\x1E\xEC\x6B\xC1\x72\x16\x41\x9B\x24\xFF\xF9\xD1\x43"
-    "\x59\x6B\xC9\x5E\x94\xD1\xFF\x6E\x0D\x43\x4D\x5A\x27\x82\x45\x0B"
-    "\x3F\x5B\xD2\x9A\x57\x59\xB9\x80\x35\xA8\x1D\x1F\xE2\x87\xA3\xFA"
-    "\x08\x5C\x6B\x64\x44\xC6\x13\xAD\x53\x02\x1F\x26\x2A\x72\xB2\xAE"
-    "\x21\xF2\xDC\x6B\x72\x57\x3A\x2C\x97\x4B\x8A\x0F\x23\x20\x1F\x97"
-    "\x0B\xF0\x44\x87\x50\xF0\xB0\xE2\x60\x3B\xA1\xA7\x9A\x9E\x94\x2C"
-    "\x49\x2F\xA5\x3C\xE3\x5F\x75\x56\x37\x08\x22\xF7\x9D\x55\x8E\x6D"
-    "\x21\xDC\xB1\xEF\x81\x70\x79\x78\x6A\x80\x9C\x5A\x09\xA3\xA7\x77"
-    "\xEA\x96\xA0\x90\xA3\x56\xE2\xE2\xDF\x98\x38\xDC\x3E\xBE\x80\xD6"
-    "\xC9\x21\x17\xB3\xDD\xC3\xBF\x24\xD2\xEC\x8A\x82\xBD\x5D\x1D\x51"
-    "\xCA\x00\x6F\x7B\x1E\xC0\x42\xC2\x9D\x47\x53\x85\x3A\xE6\xEA\x14"
-    "\x03\x74\xC4\x55\x03\xC4\xD2\xBA\x30\x0F\xF4\x48\x02\x8D\xC0\x3C"
-    "\x3A\x0F\x4C\x5A\xF3\x2D\x50\x69\xF4\x1E\x5C\x19\x24\xCD\x70\x2B"
-    "\x62\xAF\x10\xAE\x5B\x72\xD7\xFE\x18\x9D\xC6\x76\xFD\xFF\x6A\xE9"
-    "\xBE\x6C\x2D\x9D\xDB\xC1\x8F\xA7\x0E\xE1\x15\x0D\xF3\x72\xF5\x56"
-    "\xA9\x0D\xF0\xF2\x38\x52\x74\x9F\xCA\xEF\x41\x41\xA0\x99\xC6\x7F"
-    "\xCF\xF9\x01\xE1\x84\x87\x6D\x8B\x71\x39\x9E\xED\x9F\xFB\xE1\xF9"
-    "\xBD\x89\x8B\x31\xC1\xEF\x73\x11\x9F\xAE\x27\xF9\x09\xA6\xCB\x78"
-    "\x60\x24\x11\x8C\xFF\x30\x9C\x5E\x97\xD8\x38\x80\x88\xD5\x7F\xD6"
-    "\x43\xAB\xF0\xFE\xBA\x6A\x96\x99\x1B\x3D\x57\x57\x6B\xF0\xE3\x01"
-    "\x04\x45\x3B\x98\x9B\x60\xBD\x1C\x84\x7F\x65\x6F\x67\x65\x5A\x2D"
-    "\xE2\x50\x5E\xC9\x12\x2D\x90\xD2\xE2\x55\xAC\x27\xE2\x53\x47\x3F"
-    "\xFE\xB7\x7C\x5B\xC3\x8D\xA9\x08\x84\x3F\xE5\x67\x16\x0A\xA0\xEF"
-    "\x0A\xF2\xBB\xB2\x5A\xE4\x85\x4A\x17\x44\x89\xE3\x65\x9A\x73\x0C"
-    "\x0D\xA7\x02\xAF\x5B\xE1\x66\x0D\xA8\xFA\xCA\x75\x4E\x58\x83\x0E"
-    "\x3D\x48\x0B\x81\xFF\x8A\xAC\xEF\xB6\xBC\x46\x2F\x4A\x21\xB1\x3B"
-    "\xE5\xCD\x00\x64\x11\xA4\xCA\xF6\x22\xAB\xB2\xCE\x7A\x00\x79\x2C"
-    "\x8A\xB9\x5F\xC7\xC9\x95\x77\x52\x96\x4B\x46\x57\xED\x25\x4D\x12"
-    "\x0D\xA4\xA0\x20\x89\x46\x31\x12\x5A\x7F\xBF\x3C\xB9\xFD\xE0\xDE"
-    "\xC1\xDD\x7B\xF7\x6F\xFF\xE7\xE0\xC1\x53\xB1\x12\xBF\xDD\x76\xBE"
-    "\x3F\x78\xB4\xFF\xE8\x89\x09\x25\x06\xC1\x66\xDC\xD8\x62\x5F\xE1"
-    "\xC0\xB7\x34\x87\xD9\x9A\xEB\xE8\x90\x83\x5B\x01\x20\x2B\x64\x96"
-    "\x02\x65\x47\xD1\xEA\x0B\xEC\xF1\xA3\xA7\xF7\x5A\x3B\x05\x78\xEC"
-    "\x09\xA6\xAB\x4B\x6D\xA0\xB4\x58\x7E\xDE\xA8\x94\x17\x08\xFE\xC8"
-    "\xCA\x58\xDE\x74\xB1\x5B\x53\x4B\x45\x6B\xE0\xFD\xAB\xBA\x93\xB1"
-    "\x61\xBD\xB6\x16\x37\x50\xC1\xC6\xA5\xC2\x0B\x44\x73\xE4\xE5\x44"
-    "\x08\x6E\x7D\xFE\x8E\x9E\x2B\xF4\xA2\x77\xC8\xA3\x18\xEC\x26\x4C"
-    "\x3E\xB2\x47\xAB\xB3\xAA\xDC\xEF\x70\x09\xB8\x12\x0C\x73\xBD\x4C"
-    "\x05\xFB\x40\x03\x91\xCE\x07\xE0\x24\xA3\x50\x35\x30\xB1\x02\x05"
-    "\x3B\xCD\x1B\x19\xCB\x4F\xF2\x60\xD3\x33\x55\x18\xF8\x28\xC2\xA4"
-    "\xCC\x16\x4E\x34\xC0\x8C\xA6\x24\x0E\xC5\x1E\x12\x27\x3A\xCB\xCD"
-    "\x32\x10\x9F\x6B\x21\xE1\x40\xFA\x15\x59\x20\x88\x20\x09\x8A\x04"
-    "\x6F\x11\xEC\xB0\x96\x43\x01\xA2\x85\x63\xC3\x89\xF7\x6A\x5B\x81"
-    "\x69\x6B\x44\x6A\x4D\x41\x6D\x10\x82\x74\x01\x2C\x88\xB6\x4D\xA3"
-    "\x27\x08\x46\x8C\x1B\x18\x86\x46\x32\xDC\x80\x82\x7B\x83\xCA\x46"
-    "\x8A\x94\xB0\x65\x6A\xB1\x91\xB9\xD0\x4D\xB4\x19\x76\x17\xE8\xB8"
-    "\x4D\x81\x69\x4D\x91\xB5\xF8\xCF\x3B\x49\xEF\x7D\x8E\xDC\x84\x08"
-    "\xE7\x99\xA2\x0E\x08\xE7\xC6\xA1\xCB\x77\x63\x08\x6C\x91\x28\x90"
-    "\xC8\x5B\xBE\xF7\xC3\x5F\x1B\x80\x0D\x48\x3C\x14\x69\x2E\x40\xDD"
-    "\xB8\x67\xB7\x10\x36\x7C\xBF\x74\x9A\xF6\xF7\xB3\x73\xCE\xC8\x7B"
-    "\x9E\x90\xBE\xF4\xCC\xCE\xC7\x7B\x20\x65\x69\xE9\xE3\x90\x35\xB7"
-    "\x63\x3F\x73\xA2\x78\xB2\x2E\x68\x2F\xD4\x29\x6D\x64\x8E\x31\xB9"
-    "\x39\xF8\xED\x86\x27\x70\xD5\x0C\x77\x10\xFD\x38\xA1\x3F\x5B\x0F"
-    "\x8D\xDC\xA9\xD1\x3F\xC5\xC9\x34\xBC\xFE\xD1\x6D\x2E\xB3\xF3\xBA"
-    "\x07\xAE\xCD\xCE\x99\xCF\x9E\xEC\xDF\xBF\x77\xF0\xF4\xF1\xBD\x7B"
-    "\x77\x0F\xF6\x7E\xBB\xFD\xF0\xD7\x7B\x7D\x8E\x99\x4E\x72\xCA\xE4"
-    "\xC9\xA3\x7F\xDF\x7B\x22\x41\x25\xFF\xBA\xF7\x9F\x3B\x8F\x6E\x3F"
-    "\xB9\x9B\xFC\xFE\xF0\xF1\xB3\x7D\x37\x3D\xE5\x15\x9A\x17\xD9\xA8"
-    "\x28\x79\x70\xF7\xD1\x1F\x0F\x51\x44\x77\x5F\x09\x39\x3C\x28\xFA"
-    "\xEC\xB1\x57\xF0\xD9\x63\x10\xD7\xCD\xC1\x2E\x72\xE0\xB5\x94\x21"
-    "\x4C\x5A\x99\x8F\x20\xE5\xEB\x8C\x1F\xB3\x72\xF1\x96\x09\xDB\x2E"
-    "\x4E\xE4\x8B\xF2\xB4\x18\x4C\xA4\x54\x88\x09\xCC\xC4\xB8\xEE\x8A"
-    "\x97\x1E\xFD\xF7\x00\xB5\x5E\x05\x80\x9E\xB1\x19\x67\xBD\x91\xBF"
-    "\x07\xE1\xFB\x73\x18\xF8\xC5\xE3\xA8\x87\x7D\x1F\x39\x32\x2D\x98"
-    "\x93\xB3\xE4\xEF\xBF\x55\x7A\x60\x8C\xC9\xEC\xA5\x15\xCE\xA6\x62"
-    "\x00\x7B\x90\x87\x4B\xE0\x73\xF8\xED\xF7\x43\xC6\x07\x60\xBD\x4A"
-    "\x52\x71\xFA\x77\x43\x58\x50\x80\xE7\x55\x85\x7F\xEF\x12\x1F\x66"
-    "\xC2\x53\xB4\xEB\x48\x99\xED\xD7\x5B\x9F\x13\xE3\xF0\x1D\x8F\x5E"
-    "\xAF\x52\xAB\xFB\xC3\xF9\xC7\x36\x37\x1C\x98\xF9\x8F\x3A\x20\x68"
-    "\xA2\xAA\x83\x98\xE5\x3D\x06\xF4\xED\x3F\xB9\x01\xE1\xFD\x8D\x8F"
-    "\x39\x20\xBA\x8C\xBC\xF9\x68\x7E\xE0\x46\x43\x37\x4E\x3E\xEA\xFC"
-    "\xD0\xC5\xE9\xE8\x78\x7A\x2C\xC6\x67\xAB\x2F\x6B\x29\x3E\x7B\xFC"
-    "\x45\x2D\x44\x1C\xCE\x97\xB3\x0C\x71\x38\x5F\xCA\x22\xA4\xB9\xD9"
-    "\x60\x09\x7E\x32\x22\xF8\xC7\x16\xB1\x11\x11\x15\xB8\x85\xAB\xB2"
-    "\xEB\x26\x5F\xE6\x4D\x9E\xF9\x25\x9F\x08\x79\x15\x22\xC1\x53\xC2"
-    "\x5E\x55\xBA\x92\x6F\x0F\xD0\xEC\xC1\xCB\xEF\x5A\x94\xDE\xDC\xB8"
-    "\xE3\x08\xD8\x1B\x57\xC7\x0C\x0B\xD0\xAF\xFD\xB2\x5C\x1A\x6C\xE0"
-    "\x99\x01\xFB\x7B\xD0\xC0\x87\xF0\xD0\xE0\xE6\xE6\x25\xDC\x63\x5A"
-    "\x37\xEB\xE4\x1C\x94\x77\xB2\xDB\x73\x26\x32\x32\xE4\x54\x00\x55"
-    "\x02\x55\xA6\x1C\xDF\xB6\x33\xAF\xEB\x3D\x27\x0D\x25\x76\xE5\xCE"
-    "\xBA\x69\xCA\xC2\x3C\xD3\xAD\xF6\x62\xB5\x6E\xB4\x31\x46\xD2\x35"
-    "\x4E\xD1\xAE\x3B\x65\x23\x9B\xCC\xA1\xE6\xE3\xAC\x9A\x67\xE8\xCE"
-    "\xB6\x3D\xFD\x61\xA2\x56\xF1\xE1\xB2\x4C\x1B\x78\x35\xBD\x91\x14"
-    "\x65\x75\x92\x2E\xF3\xBF\x82\x98\x04\x0E\x80\xFB\x90\x4B\x45\x02"
-    "\xE9\x00\x20\x24\xD4\xD7\x99\x54\x8B\x18\x60\x94\x12\x84\x46\x27"
-    "\x00\x0D\x06\x13\xCD\x53\xC8\xE3\x49\xAC\x9B\x05\x68\x51\x64\x56"
-    "\x11\x9A\xFF\x64\x86\x15\x20\x3E\x08\xE4\x68\x7A\x2B\xCB\x02\xBB"
-    "\x2A\xF0\xDE\x67\x95\x25\x56\xB2\x91\xB3\xB1\x65\x3D\xD1\x36\x95"
-    "\x30\x9B\x02\xA6\xDD\xC4\x06\xA8\x43\x0F\xD3\x93\x8C\x49\xBA\xE0"
-    "\x17\xF3\x8A\x58\x93\x71\x50\xEB\x69\x82\x29\x01\xA7\xB4\x3F\xF2"
-    "\x85\x8C\x6F\x69\x13\x06\xFC\x70\xE6\x26\xDE\x04\x4D\x18\x7C\x5B"
-    "\xD7\x68\x6F\x4C\x21\x34\xA5\xFC\xDF\x8D\x49\x72\xD3\xFA\xC6\x90"
-    "\x8A\x9F\x58\x29\x96\x43\x94\x49\x21\xEA\x5B\xF6\xEC\xFC\x58\x55"
-    "\x36\xCB\xA5\x9D\x13\xD6\xD7\xD4\x09\xD9\x69\xE3\x3B\x9E\x01\x54"
-    "\x93\xBC\xC5\xC3\x7D\x1C\xDF\xAE\xAA\xF4\xED\x14\x56\xF2\x48\x03"
-    "\x65\x73\x81\x5A\x2B\x66\x1C\x81\xA7\xA6\xD6\x69\x63\x7A\x92\xAE"
-    "\x46\x33\x48\x92\x35\x9B\xE6\x0B\x8C\xE5\x72\x1B\x9C\xEA\xA7\x4D"
-    "\xF9\x6C\xB5\x12\x2B\x37\x85\xBC\xE3\xC9\x37\xF4\xB9\x5E\xE6\xF3"
-    "\x6C\x74\xC3\x6E\xC1\x9A\x6F\x37\xCB\xAF\x7F\x5A\x3B\x47\x5E\xCA"
-    "\x3E\x69\x5D\x63\x84\x1D\xC3\x68\x8F\x62\x91\x35\xC0\x8D\xD8\xC9"
-    "\xC9\xEB\xED\xBD\xBD\xC6\xDE\x9D\x55\xF2\xEA\x55\x67\x08\x0E\x18"
-    "\x87\x7F\x4B\xF5\xAB\xB6\xC3\x7B\xBC\x9A\x2A\x18\x6F\xF2\x67\x5E"
-    "\x71\x1D\x7E\x4D\x5B\xF5\x75\x44\xE8\x5F\xE1\x1C\xAF\xF2\x5D\xE7"
-    "\x98\x3F\x1C\xD2\x5F\xAB\x3C\xB2\x42\xE8\x9D\x67\xBB\x87\xA9\x90"
-    "\x9E\x54\x0D\xE3\x85\x0A\xA1\x8B\x96\x6F\x85\xEC\x2F\xA8\x09\x73"
-    "\x5F\x13\xB7\x3E\x86\x2C\x27\xE8\xB2\xBA\x88\x06\x9E\x9E\x89\xDD"
-    "\x2A\x4B\x8B\x33\x6A\x20\x81\xCB\xCC\xB0\xF4\xE8\xC9\x28\x9B\xE5"
-    "\x7E\xD8\x15\x2C\x1A\xFB\x07\xF5\x65\x4D\x55\xCD\x89\x3B\x77\x04"
-    "\xAC\xBB\xD1\xEC\xDA\xF7\x9D\xA7\xAA\x38\xDD\xD4\x8B\x5D\x02\xEB"
-    "\x9C\x63\x0A\xFC\x74\xDB\xE2\xF2\x54\x38\xB2\x68\x64\x79\x03\xB4"
-    "\xC7\xD2\x31\xB6\x4A\x6F\x3E\xC4\x8A\xCD\xCB\x05\x25\x27\xB7\xC6"
-    "\x2A\x63\x6E\x1A\x34\x89\x9A\xB1\xF9\xF6\x8D\x86\x04\xE2\x7E\x59"
-    "\xAE\xF0\x4E\x45\xED\xDF\xA9\xB0\x70\x32\x76\x8E\x6B\xED\x49\x65"
-    "\xE5\x29\xAF\xCA\x04\x37\xAB\x9B\xDB\x45\x7E\x82\xC1\x14\x7F\x11"
-    "\x33\x9F\x8D\x4C\x9B\x31\x1D\x91\xC1\x00\xF9\x88\xA2\x98\x91\x48"
-    "\x09\x51\xED\x95\x3A\x87\x8E\x3F\x26\xAC\x63\xB1\xCC\x7A\x53\xC6"
-    "\x63\x87\xE3\x56\x39\xF8\x1C\xB6\xDA\x9E\x88\xCF\xE9\xBA\xD5\x59"
-    "\x33\x29\xF2\x65\x1E\x06\x46\x92\x11\x85\xC5\x77\x9F\x97\x07\x69"
-    "\xFC\xE0\x07\x05\xA7\x79\x21\x16\xF0\x6F\xFB\x0F\xEE\x7B\x55\x90"
-    "\xD3\xC5\xAB\x85\xA9\xE4\x16\x79\x9D\xCE\x96\x59\x70\xC0\xD5\x55"
-    "\x54\x01\xB5\x32\xDA\x8F\x27\xF0\xEB\xA6\x71\x8C\x16\x09\xDB\x5D"
-    "\x66\x66\xB6\x4C\x86\x70\x04\x19\x4A\x76\xA2\x8A\x62\xF4\x0B\xEA"
-    "\x02\x65\x4A\x96\x15\x6A\x96\x0C\x00\x82\x45\x05\x23\x2A\xFB\xFB"
-    "\xE2\x8B\x25\x06\x38\xDB\xAA\x41\xA2\x7A\x98\xA8\x63\xC1\x75\x49"
-    "\x4F\xA9\x4D\x3C\x83\xA7\x02\x65\x03\xDE\xAC\x75\x0E\x92\xD1\xD5"
-    "\xDA\xC9\x06\x7E\xED\x01\xE2\xCF\x47\xE4\x4C\xAF\x31\x23\xE5\xA6"
-    "\x5D\x86\x9D\xA9\xCB\x5A\xB7\x11\xE9\x9B\x5D\xFA\x5E\x21\x37\x3F"
-    "\xDF\xD5\x4E\xD2\x84\xE2\xEA\x9F\xD1\x26\x1A\xDD\x20\xB9\xDD\x54"
-    "\x2C\x3F\xFA\xF6\xF7\xDF\x72\x93\xCA\xEB\xA7\xD8\xC4\xC8\x3D\x48"
-    "\xB1\x99\x6D\xD5\x7A\x02\x6A\x97\xD5\x61\x8B\xC8\xE9\xE2\xA3\x0F"
-    "\x21\xD0\xD1\x5C\xE5\x18\x82\x99\xBC\x60\x0F\xF1\x98\x5D\x8C\x62"
-    "\xA3\x6C\xA7\x97\x2E\xC7\x3F\xB6\x2F\xCD\x65\xA0\x1C\x4F\x5D\xDC"
-    "\x41\x1D\x2A\xC6\x2C\x6C\x16\xB5\x3D\xF5\xF2\x30\x6B\xA0\x9A\xBC"
-    "\xF6\x41\xDE\xA8\x8F\xCB\xF5\x72\x41\x82\xDD\x2C\x53\xB2\x47\x6E"
-    "\xF9\x80\x82\xF3\x93\xE4\x97\x6E\x55\xB8\x52\x6F\xAA\x9C\x94\x95"
-    "\xF4\x66\x2A\x8B\xB9\x38\x08\x0A\x4C\x24\x99\xA8\x85\xDF\x81\xCC"
-    "\x54\xDD\xC0\xF8\x87\x17\x46\x66\x10\x34\x78\x09\xB1\x68\xA4\x24"
-    "\x9A\xEA\x8A\x9E\xCD\x2C\x72\x17\xB2\xFD\x2E\x06\x93\x3C\xB9\xED"
-    "\x48\xE8\x27\xB1\x9E\xE1\x15\x34\x8D\x0F\x8C\xD6\xEF\x9E\x13\x2F"
-    "\x60\xB7\x84\x70\x18\x3E\x8F\xE3\xA8\xD4\xDD\x88\xDC\xB4\xC8\x3C"
-    "\x2F\x65\x2E\x2A\xD0\x6B\x31\xC6\xA3\x23\x50\x44\x64\xCD\x69\x26"
-    "\x5D\xDD\x34\x17\x22\xB9\x4B\xB9\xFE\xA2\x6F\x9A\x7C\xB9\x49\x23"
-    "\x1D\x99\xB3\x69\x18\x94\xA8\x99\xE1\xB7\xED\xA1\xCE\x6D\x99\x3B"
-    "\xF4\x7C\xF1\x91\xDB\x5B\x3D\x6B\xFC\x2D\x03\x2B\x49\xE4\xDA\x42"
-    "\x57\x65\xD0\xEE\x32\x55\xD9\x34\xB6\x9B\x4B\xD1\x3D\xF6\x9C\x4F"
-    "\x98\x0B\xB8\x86\x70\x62\x02\xC4\x01\x42\x06\xE0\x4E\x71\x94\x03"
-    "\xB4\x5C\x77\xDA\x98\x01\xF8\x39\xD3\xD7\x05\xAE\x7A\x46\x45\x74"
-    "\x01\xCB\xBD\xB7\xF4\xBF\x8C\x65\xDF\x91\x9F\xFD\x12\x57\xBE\xE7"
-    "\x63\x75\xEE\x85\xDF\xEE\xB2\xCC\x74\x43\xAE\xD5\x39\x50\xEB\xB2"
-    "\xFF\x81\x17\x7E\x1F\x20\xE3\xFC\x25\xF9\x06\x7B\x4C\x90\x73\x3B"
-    "\x53\xB3\x49\x1A\x4C\xB1\xAC\xB0\x9D\x70\x56\x7B\xBA\x05\x3A\x9C"
-    "\xB3\xAD\xBD\x67\x45\x7D\xE1\x16\xFB\x7A\xD3\x3D\xF3\x1D\xE7\x20"
-    "\xB0\x1F\x67\x24\xE9\x61\xC0\xF3\x4E\xC3\xC4\x51\x59\x85\x07\x7F"
-    "\xCA\x75\x56\x4F\x98\xCC\x3C\x90\x93\xED\xBC\xE4\xE2\x6C\xE8\xF2"
-    "\x26\xE7\xF4\x48\x12\xB5\x28\xC6\x8A\xD3\x3E\x7D\x30\xF3\xC0\x48"
-    "\xBE\xAC\xD4\x1C\x90\x0C\x57\x91\xF0\x75\x8B\x1F\x7C\x58\xD3\x6A"
-    "\xC2\x62\x4B\x60\x4D\x3B\x94\x1E\xF7\xE8\xCB\x4F\x36\x98\x99\xB4"
-    "\x45\x25\x76\x41\xDC\xB2\xD0\x44\xDE\xD8\x5C\x11\xE3\x39\x66\xE2"
-    "\x7F\x52\x43\xE1\x33\x44\xBB\x89\xA2\x6C\xB8\x66\x82\x56\x30\xDD"
-    "\xBC\xA8\x62\x25\x9A\xC7\x26\xA4\xFF\xBF\xDF\x80\x59\xB2\x38\x43"
-    "\x35\x3F\x43\x93\x84\x41\xA3\x6D\xAF\x9B\x66\x85\x90\x2B\xD6\x99"
-    "\x63\x95\xD5\x18\x9C\xC0\x75\xD7\xD1\x8D\xED\x6D\x92\xCF\x1D\x4A"
-    "\x70\x0C\x3A\x10\xAC\x14\x35\x1C\xEB\xC2\xDB\x39\x5A\xA7\x8C\xA3"
-    "\x13\x9B\x1B\xB5\x0F\x6D\x30\xD8\x68\x50\x68\xE0\xA6\x00\xF3\xAA"
-    "\xAB\xC1\x6E\xD6\x61\x4C\x37\xD6\x0F\x1D\x87\x14\x1E\x82\x28\xA4"
-    "\xB2\x84\x79\x70\xCC\xE7\xB6\xC0\x81\x16\x74\xFB\x85\x55\xD2\xA8"
-    "\x5D\x45\x29\xF3\xF0\x5E\x2F\x5C\xF6\xF1\xAF\x0D\x8E\xC5\xEA\xBA"
-    "\xA8\xFD\xCE\x6B\xDB\xFA\x24\x5B\xB7\x0D\xC0\xA6\xEC\xA6\x17\x3E"
-    "\x5B\xAD\xF9\x03\xC6\x9A\x3F\xF0\xAC\xE9\x82\xB4\xF2\x05\x6E\xD3"
-    "\x96\x49\x7D\x20\x4D\xEA\xAF\xF5\x47\x6D\x57\x1F\x5C\x91\xAE\xB2"
-    "\x9E\x29\x7E\x57\x53\x37\xEE\xCE\xBE\xC0\x2D\x9B\xC9\x54\x60\x3A"
-    "\x19\xE9\xC6\x0A\xE5\xE1\xDA\x63\x7C\x1D\x8F\x33\xBA\xB3\xA4\x72"
-    "\x06\x2B\x46\xF4\xE8\xD9\x3E\x86\x65\x11\xBC\x82\xE0\x2D\xDC\x32"
-    "\x53\x15\xDA\xC3\x0E\xF6\x1E\xC6\xE1\x10\x25\x92\xE0\xA7\xB2\xCF"
-    "\xAF\xE4\x2D\xFA\xA4\x10\xF2\x8C\xA5\x21\x12\xFB\x9E\xD3\x56\x0B"
-    "\x70\x44\x03\x0B\x5C\xF0\x4B\x69\x8A\x9B\x10\xFC\xF2\x30\x91\x8A"
-    "\x2D\xD3\x70\xAC\xA5\x5E\x3F\xD1\x12\xFE\x30\x66\x6F\x53\x09\x18"
-    "\xB5\x3A\xCA\x90\xDA\x8D\xA6\x44\xB0\x6C\x9C\xF6\xA9\x3F\x0C\x95"
-    "\xE1\x94\x8A\x45\x70\xA4\x90\x4F\x85\x04\x8E\x5E\xAB\x89\x27\x86"
-    "\xDE\x40\x93\xF8\x2E\x06\xFE\x24\x2F\xFE\x1D\xB4\xC0\x61\x49\xD9"
-    "\x85\x54\xD4\xB8\x14\x62\xBA\xE8\xA6\xF3\x62\xBE\x5C\xD7\xCA\x57"
-    "\x80\x6B\x27\x7D\xB3\x61\x3B\x32\x0C\x5D\x57\x3B\x3A\x25\xAC\xD6"
-    "\x4B\xB2\x73\xF1\xE4\xDE\xFE\x0E\xE9\x2A\xC1\xBF\x41\x9C\xB6\x10"
-    "\x2B\x1A\xFD\x13\xA9\x88\x84\x7D\xB4\xB0\x11\xC6\xDA\xAE\x1E\xD2"
-    "\xAA\x22\xB7\x10\x6B\x4F\xB0\x68\x65\x92\x60\xBC\x04\x45\x84\xD6"
-    "\x0E\x8C\x03\x99\xB0\x9D\x44\x64\xC8\xCE\xAD\x29\x6B\x98\xA5\xF6"
-    "\x4C\x12\x33\x5B\x96\x2D\x79\xE2\x22\x32\x4D\x08\xE5\xE1\x8C\xD1"
-    "\x88\xDD\xEC\x0B\x7A\x5A\x2C\x80\xE3\x4E\x80\x72\x6A\x00\x94\x0D"
-    "\xD0\x17\x01\x25\xF3\x51\x0D\x30\xFC\x6F\xAA\xE8\x55\x62\x14\x8F"
-    "\x54\x23\x89\x21\x35\xD8\x89\xEE\xE5\xD8\x16\x1D\x55\xB0\x18\xB7"
-    "\x95\x78\xEC\x56\x31\x24\xC2\x00\x7D\xC7\xE3\x3D\xAC\xF0\x20\xD1"
-    "\xAB\xCB\xC9\xB4\x3C\x80\xF3\x69\x37\xC6\xA8\x77\xAF\xAA\xF9\x1E"
-    "\xB7\x40\x91\x04\x01\xC4\xE8\x81\x90\xBB\x8D\xAB\xFD\x67\xE5\xD7"
-    "\x4D\x1B\x23\x35\xF8\x2D\x89\x87\xFA\xB8\x3C\x4D\xD2\xDA\x25\x75"
-    "\xB7\x0F\x9E\xD1\x24\x96\x17\x5A\x59\x13\x88\xA5\x91\xFD\x1D\xF9"
-    "\x10\x68\x6B\x64\xE8\xBA\xCE\x3C\xD0\xEE\xF6\x12\xE3\xE7\x8A\x2D"
-    "\x83\x66\x32\x28\x74\x8F\x9A\x3A\x23\xB3\x5E\x23\x1F\xBB\x6C\x17"
-    "\x2D\x4C\x44\xB1\x0A\x69\x5B\xB0\x19\x84\x10\xB1\x79\xE6\x20\xCB"
-    "\xD2\xC9\xE0\x41\x56\xAC\x47\x1E\x4B\xB0\x87\x30\x71\xBB\x3A\x49"
-    "\xA2\x16\x0B\xF7\x30\x91\xD9\xF6\x1B\x84\x20\x4E\x84\xC5\x7A\x58"
-    "\x7B\x2B\xDB\xAA\x05\xC7\x2C\x6D\xF3\x70\x49\x45\xDB\x3E\xEC\xAE"
-    "\x05\x07\x2D\x00\xE0\xF4\x96\xD3\x64\x38\x05\xA6\x2A\xB4\x9E\xDB"
-    "\x9C\x6D\x2B\x71\x5A\x8C\x1D\x9D\x19\x4B\x18\xAB\xB6\x0C\xA9\xF6"
-    "\x33\xA0\xD5\xEC\x63\x52\x29\xE6\xA5\x68\xA5\xCF\xEC\x02\x94\x89"
-    "\xE6\x66\x09\xE0\xBD\x93\x66\x16\x27\x4A\x35\xAD\xD0\x1F\x4C\x2C"
-    "\x51\x34\x9F\x07\x51\x92\xE5\xED\xFF\x1D\x55\x92\x00\x70\x41\xB2"
-    "\xB4\x4D\xBC\xE7\xA3\xA9\x3E\x24\xF5\x61\x38\xDC\x65\xD0\xD2\xFF"
-    "\x4F\x06\xB7\x77\x9C\xCD\x5F\x7D\x1E\xA4\x34\x87\xAE\xA2\xE3\xC7"
-    "\xA7\x47\x4C\xC0\xCD\x07\x52\x50\x1C\x24\xE8\xD7\x22\x4F\xCC\xA0"
-    "\x98\x7C\x9F\x64\xE5\x9F\xCB\x89\xAC\xF5\xE9\xBC\xD7\x69\x1C\x6D"
-    "\x78\xB4\x52\xC1\xCD\xA5\xB2\x4E\xDC\x9A\x94\x3C\x39\xB8\x85\x8E"
-    "\xD5\x5F\x3C\xD3\x1F\x65\x4D\x9D\x0C\x65\xD5\xA1\x8D\x99\x0E\x72"
-    "\x2F\x57\x40\xA6\xE9\xF2\x96\x52\xFE\xD7\xE8\x3F\x63\x7B\xBB\x46"
-    "\x7E\x5B\x9E\xB7\x0D\xD1\x07\xA4\x0F\x90\x8E\xEF\x9D\xF5\xB5\xBB"
-    "\x0D\x55\x55\x1E\x40\x60\x71\x25\x15\xB2\x74\xA1\x7D\x4F\x6B\x12"
-    "\x4F\x23\x9F\xF6\x9A\xD4\x91\xA1\xF3\x0B\xAD\x47\xCA\x12\x12\x77"
-    "\x84\xD3\x4B\x3F\x70\x6F\x53\x6B\x8D\x33\x4B\xB6\xB9\xAC\x85\x10"
-    "\xD1\xF5\xAC\x0D\xDC\x7B\xE2\x22\xF0\x33\xE6\x25\x25\x16\xAA\x5C"
-    "\xE8\xD2\xC3\xCB\x91\x0A\xB5\xF7\x70\x5E\x18\x63\x7F\xE8\x42\xCC"
-    "\xEF\x75\x47\x7A\xAF\x53\xC7\x79\xBF\x8D\xA9\x26\xE7\x2F\x7E\xD7"
-    "\xC3\xFB\x31\x9F\xF6\x0A\xFB\xC4\x04\x28\x5A\xF0\xD9\x1B\xD0\xD1"
-    "\xD7\xAE\x01\x26\x38\xD0\x0F\x76\xC2\x43\xFE\x24\x28\xBF\x4F\xA1"
-    "\xD7\xAD\xA7\xB0\x0C\x0A\xBA\xA6\x10\x3E\x86\xA5\x50\x86\x31\xA5"
-    "\xF0\x31\x2C\x85\x5C\xD5\x94\x22\x95\x4F\x50\x0A\x29\xC3\x94\xC2"
-    "\xC7\xC0\xFC\x63\x6B\x36\xB5\x19\xC8\x7E\xC9\x18\x47\x24\xEA\x6E"
-    "\x5D\x39\x43\xF7\x07\x63\xAF\xF0\x8D\x1D\x9E\xD1\x02\x40\x70\x36"
-    "\x0B\x3C\x3B\xA6\xB5\x56\x3C\x2A\xA6\x70\x94\xBF\xCE\xE4\x02\x8F"
-    "\x8A\x1B\x6A\xA5\x02\x0C\xD2\x08\xFA\x25\x02\xC5\x77\xB4\x80\x52"
-    "\x8D\xF2\xEB\x8D\xD5\x5C\x6A\x74\xEA\xF6\x3D\x45\xAF\xD2\xAB\xE2"
-    "\x18\x1D\x7D\xBD\x19\xAF\x06\xF2\x69\x6B\x7B\xDB\x7E\x4A\xE1\xAE"
-    "\xAC\x0F\x13\x9C\x40\x6F\x78\x2D\x95\xF1\x67\x74\xF1\x13\xD3\x5D"
-    "\xAC\xED\xFA\x54\x69\x5C\x8F\x15\x45\xFA\x17\x09\xE1\xC7\xAA\xA4"
-    "\xC5\x94\xD7\xD9\x2F\x70\xE1\x72\x64\xA0\xB8\xFE\x09\x79\xFD\x30"
-    "\x7D\x38\x72\xF4\xBE\x5C\x3B\x76\x15\x1D\xC6\x5C\xCF\x9F\xAD\x95"
-    "\x86\xA4\x20\x4E\x37\x7E\xD4\x05\xFB\x43\xD6\x13\xD9\x0A\xF9\x27"
-    "\xA3\x39\x6F\x83\x2C\xBF\xD8\x55\xFB\x72\x48\x6E\x15\x08\xBE\xC1"
-    "\xBD\xE6\xEE\x6B\xBB\xAC\xC3\x70\x0E\xBA\xE0\xD9\x87\x6B\xFC\x5E"
-    "\xCC\x2B\xDA\x6E\x95\x7C\xE1\x68\x4E\x84\x04\xB0\x91\xA5\x93\xE4"
-    "\x61\x49\x85\xF4\x40\x0E\x77\x70\x43\xD3\x16\x2D\xA2\x22\x02\x3C"
-    "\x66\x8D\xE0\x5A\x86\x9A\xD5\x41\x46\x1E\x60\x54\x89\x4E\x10\x70"
-    "\x51\xD5\x03\x61\xDD\xFF\xED\x02\xA7\xF8\x58\xAE\x31\x64\x7A\x84"
-    "\x43\x19\xD6\xD6\x37\xD6\x4E\x6B\xB1\x42\xDC\x2E\x12\x06\x04\x6B"
-    "\xA7\x8B\x01\x5A\x64\xF3\xFC\x44\xEC\xC0\x36\x20\xC9\xE4\xCB\x43"
-    "\xF3\x15\x5C\x1F\xC1\x44\x91\x17\x0E\xB8\xC0\x0D\x09\x3B\xA5\x29"
-    "\x60\x24\x2F\xFF\x6A\x8C\x4C\x5C\x54\x4E\xCC\x70\x27\x7A\x48\x13"
-    "\xDD\xAA\xAB\xD8\x74\x91\x0C\x07\xA6\x14\x12\xB7\x09\x22\xCB\x30"
-    "\xC9\x31\x24\x34\x82\x39\x59\x96\xE5\x4A\x57\x03\x87\x78\x9D\x53"
-    "\xC6\x75\x60\xD1\x3D\x71\x6D\x58\x7E\xBA\x42\x6F\x35\xD3\xEB\x1F"
-    "\x77\x93\x91\x9E\x82\x2D\x33\x0A\x95\x0C\x01\x7E\xAE\x98\xA5\x3A"
-    "\xA1\xA3\x13\x8C\x2C\x4E\x27\xA1\x7E\x63\x01\xD2\x19\x8D\x35\x32"
-    "\xC6\x93\x64\x7B\x92\xF8\x89\x94\x3D\x17\x19\x0B\xD3\x5C\x60\xF8"
-    "\x58\x69\x9A\x0C\xBF\x46\xCC\xC4\x74\x37\xFB\xEF\x0A\x7F\xFF\x2B"
-    "\x3C\x2F\xE2\x2B\x9C\xB3\xF8\x7F\xC8\x15\xAE\x29\x60\xB3\x15\x2E"
-    "\x87\xF4\x39\xAC\xF0\x9F\x60\x85\xAB\x29\xF8\xE6\xB2\x56\xF8\xD6"
-    "\x67\xB2\xC2\xF7\xC4\xA9\xB7\x4A\xD0\xCD\xDE\x35\x6A\x4A\x55\x59"
-    "\xFC\x2E\x9A\x67\xF6\x8D\x88\xEA\x73\x80\x4F\x07\xB6\x47\x04\x50"
-    "\x5A\x33\xDD\x33\x6F\xC2\xBC\x85\x1F\xE6\x78\x53\x1F\xA7\xAA\x4B"
-    "\x76\x9E\xB7\x98\x31\x54\xE9\x74\xB6\x7B\xF8\xE4\x76\x49\x5A\xFE"
-    "\x6E\x87\x1E\x6B\xEE\xAB\x49\x50\x5A\xAF\x1C\x53\x5A\xBF\xB2\xD3"
-    "\x72\x05\x08\x82\x1C\x5D\xC1\x4B\x29\xC1\xDD\x8A\x8B\x70\xC6\xD9"
-    "\x0D\x03\x66\x44\xB2\x02\xA0\x2F\x67\x77\xE4\x49\xBA\x8D\x06\xE9"
-    "\x46\x99\x1B\x68\x57\x74\x18\x8C\xE0\x7E\xCF\xF0\xEE\xA3\x07\xD2"
-    "\xD6\x77\xBF\x4C\x17\xD9\x62\x38\x31\xB4\xE0\xBA\x2B\xBF\x16\x74"
-    "\x07\x8A\xA7\xDF\xCA\xBA\xB1\x43\x6B\x2C\xCB\x39\x9E\x5B\xA7\x65"
-    "\x95\x1F\xE5\x85\xF2\x98\xD6\xB7\x82\xAD\x5B\xF0\x9C\x91\x53\xDE"
-    "\x1B\x56\x8A\xDE\xE5\x5B\xF2\xAD\xC5\x4B\xF3\xC7\xDA\xDF\x04\x6F"
-    "\x42\x48\x92\xAF\xC0\xF7\x7A\x24\xF5\xC1\xE8\x2A\x5C\x61\x0E\xAC"
-    "\x44\xEB\xBE\x88\x34\xA4\x5F\xA6\x5C\xFC\xA3\x6C\x39\x51\xFE\x44"
-    "\xF4\xE5\x89\x20\xB8\x46\x1C\x84\x9C\x5B\x19\xF6\x27\x38\xFA\x39"
-    "\x8F\x14\x34\x33\xF9\x99\x94\x4E\x3B\xCE\x57\x87\xED\x89\x5D\xA0"
-    "\xC9\xD3\xE5\xBF\x9D\x03\x20\x99\x5F\xA7\xC0\xE3\xD0\x81\x7B\x88"
-    "\xA6\x8C\x59\xF9\x26\x08\x70\x65\x57\x07\x9F\xF0\xA5\xB2\x7A\xB0"
-    "\x6C\xED\xEA\xD5\xF0\xA0\x69\xAA\xA8\xBC\xC7\x66\x19\xB1\x3E\x32"
-    "\x41\x8B\x2C\x4C\xD5\xA4\x07\xD1\x8D\x13\xE7\xE0\x4C\xF0\x6D\x07"
-    "\xF6\xD5\xDD\xDD\x30\x15\xB5\x41\xBC\xA0\xC5\xC3\xFC\x48\xA0\x29"
-    "\x74\x4A\xC7\xDC\x0F\xEE\xCC\x71\xE6\xED\x69\x4E\xEE\xF1\x83\x34"
-    "\x9B\xB3\x39\xA9\x69\x0C\x3F\x27\xC7\xF9\x22\x1B\xC1\x8A\xAC\xD7"
-    "\x95\x80\xB5\x83\x9B\xAC\x79\xE1\x32\x21\x2B\x3A\x99\xD5\xC2\x11"
-    "\xDF\x02\x14\x63\xC7\xA8\x7E\xD8\xD2\x91\x58\xAC\x7B\x59\xBE\x84"
-    "\x4B\x46\x6C\x29\xEC\xA0\x68\xE3\x57\x51\x30\x2C\xD1\xAA\xDF\xC6"
-    "\xAA\x9D\x0D\x60\x37\xE2\x0D\xF4\xC1\xC0\xE9\xEC\x00\x9A\x69\x45"
-    "\x34\x36\x73\x3A\x03\x14\x63\xBF\xC4\x3F\xBB\x38\x3C\xFC\x31\x5A"
-    "\x71\x96\x83\xCC\xCB\xAA\xCA\xEA\x55\x59\x2C\x4C\xC0\x7D\x58\xF8"
-    "\x82\x7C\x54\x5C\x8D\x8A\x48\x90\x38\x86\x0D\xD3\x73\x51\x34\x44"
-    "\x67\x47\x77\xCD\x1A\x8F\xCC\xD5\x0D\x1C\xB9\x86\xD9\x1B\x38\x66"
-    "\x4D\xEF\x44\xF0\x61\x2F\x67\x81\x9C\x1B\x02\x2B\xDB\x41\xD1\x59"
-    "\x95\xA5\xAF\x18\xE8\x24\x66\xEE\x30\x5F\x68\x13\xDD\x2A\x0B\xFF"
-    "\xB3\xD7\x32\xAF\x93\x8A\xB5\x47\xAE\xFF\x7C\x83\xEB\xD9\x49\xDE"
-    "\xB4\x34\x36\xBC\x31\xEC\xD1\x8E\xBA\xD3\x13\x14\xA5\x2D\x93\xE3"
-    "\x31\xC4\xDD\x31\x0E\x93\x68\xE6\xE5\xB5\x77\x6A\x57\x3A\xBB\x2E"
-    "\xB7\xC8\x9F\xC5\x5E\xB5\x7B\xED\x1D\x12\xEA\xD9\xFF\x88\x0E\x89"
-    "\x07\xEC\xD6\xD9\x4B\x2B\x29\x6A\x26\x66\x73\x84\x60\x5C\x7A\x9C"
-    "\xC2\xA5\x8F\x11\x11\x97\x18\x29\x7B\x69\xCF\xBE\x6F\xF4\x52\x5E"
-    "\x00\x85\x1D\xEA\xDA\x3B\x04\x78\x96\x1C\x0A\xAE\x57\xC3\xA5\x01"
-    "\x94\xFB\xD6\xF5\x8E\xF8\xA4\x40\x4E\xE9\xD5\xD9\x4B\x6F\x1D\x8C"
-    "\x79\xF2\xBF\xBD\x58\x08\x49\x9B\xAE\x34\x55\xD0\x08\x48\x7F\xF3"
-    "\x25\x44\x79\x77\x6F\x1E\x81\xF4\x25\x08\x74\x88\xDF\xEA\x21\xAE"
-    "\x01\x21\xFC\xD9\xD6\x58\x53\x32\x03\x59\x2F\x07\x2A\x74\xCC\x46"
-    "\x6A\x5B\xD7\x3D\x0B\x03\x5E\x0D\xA7\xD8\xC0\xD0\xF4\xBE\xF5\x8E"
-    "\xA3\x98\x85\xB2\xC0\xA6\x60\x17\x1E\xF3\xF8\x24\x66\xBC\x9C\x52"
-    "\x77\x1F\x96\x0B\x9F\x01\x1B\x42\x18\x07\x12\xC6\x5C\x89\xC3\xD7"
-    "\x09\xB1\x89\x10\x20\x56\x65\x5E\xC8\x58\x61\xE9\x02\x31\xA6\x4A"
-    "\xCB\xED\x48\xD4\x3A\xC9\xAA\x94\xC8\xB5\x06\x9D\xF2\x9F\x75\x59"
-    "\xD8\x22\x89\x64\x3B\x78\x19\x96\x88\x1A\x44\x1D\x21\xA1\xE8\x1C"
-    "\x24\x77\xB3\x65\xFA\x36\xB9\x29\x38\x8C\xA0\x87\x05\x9E\xD4\x40"
-    "\xF1\xAE\x40\x43\xC4\x1E\x7D\x1B\xD6\xC1\x32\xA4\x54\x10\x1F\xCB"
-    "\xB5\x38\x7F\x78\x18\x21\xB2\x74\xA8\x9A\x46\xF5\x92\xA3\x52\x23"
-    "\xAB\x29\xE2\xE2\xA3\x25\xA0\xF8\xA9\xE9\x0F\x46\x3A\x62\x89\x2F"
-    "\x06\x1D\x0F\x2F\x1C\x68\xF0\xBB\xEE\x97\x47\x8F\x40\xC4\xB6\x44"
-    "\x67\x41\x5D\x7B\x27\x40\x9D\xC1\x92\x91\xAB\x36\x12\x0A\x44\x1C"
-    "\x19\x07\x59\x41\xD1\x42\x70\x43\xC2\x6B\x14\x7C\x03\x72\xCA\x80"
-    "\xD0\x20\x8C\x1F\x9E\xA8\xE5\x3C\xB9\xE1\x37\x22\x9D\x6B\xC4\xD2"
-    "\xF8\x4D\x54\x7E\x0A\x15\x77\x9D\xCD\x4D\x6E\x6C\xD1\xEA\xC1\x9A"
-    "\xE2\x7E\xEC\x3A\xC3\xFE\x6D\xAD\xF3\x21\xBF\x81\xEB\xBA\xEE\xFA"
-    "\x33\x1D\x85\x3D\x8D\xAF\xDA\x2A\x3E\xC0\x0F\x40\xC5\xE2\xE7\xBD"
-    "\xFC\x8A\x66\x68\x2A\xB9\xF7\x56\x8A\x64\x12\x9B\x26\xF8\xA1\x99"
-    "\xB3\x6D\x6E\xE0\x67\x49\xEC\xB6\xB8\x2E\x1D\xB2\xA3\x55\x43\xDB"
-    "\x3C\xFF\x96\x2B\x17\xBC\xC2\xB8\xBF\x91\xF9\x92\xD6\x16\x6E\xAA"
-    "\x5C\x4C\x30\xF3\xA5\xEA\x76\x5D\x07\x57\x16\x9D\x04\x71\x46\x4A"
-    "\x03\x2F\x55\x26\xEE\x6B\x91\x24\x99\xCE\xA3\x8F\x4F\x84\xF6\x1C"
-    "\xAB\xBF\x50\x68\x6D\x83\x11\x22\x4C\x7E\x3C\xE3\x77\xAE\x49\x72"
-    "\x73\x7B\x7B\xDB\xCD\xC1\x86\xEE\x09\x16\x25\x1D\x65\xCA\xEF\xF9"
-    "\xCE\xDB\xDF\x17\xA3\x61\xDD\x08\x0E\x7D\x22\x11\x66\xAA\xEC\x71"
-    "\x51\x1C\xF9\xBA\x26\x6B\x99\x03\xA5\x6E\xF2\xE5\x92\x6E\xB1\xB5"
-    "\xC1\x10\xCF\x5B\x58\xD4\xAB\x0C\x90\xBB\x6B\xD3\xF5\xFC\x2D\x66"
-    "\x10\xB8\x47\x76\x03\xC0\x62\xA6\xBE\xB7\xF5\xCF\xC5\x6B\xBC\xC6"
-    "\x25\x66\xAE\x98\x43\x38\xBF\x43\x3B\x9C\x1C\xE4\xD0\x5C\x2F\x33"
-    "\xE7\xE6\x31\xB5\xEE\x64\x7A\x30\x41\x7A\xBD\xFC\x78\xD4\xAC\x90"
-    "\x9F\x9F\x96\x42\x10\x80\x53\xFD\x53\xF7\xCD\x48\x1F\xEE\x8F\xC5"
-    "\x4E\x54\xA0\x4B\xC4\xF7\x37\x26\x38\x43\x72\x41\xCA\xD1\xD2\x4D"
-    "\x4D\x0D\x67\xCF\x7E\x66\xA1\xDC\x9C\x58\x9D\x74\x60\xD9\xF7\x45"
-    "\x31\xB0\xAC\x79\x1C\xA9\x4D\x71\xE2\xB6\xE8\x0E\x4B\x65\x52\xEC"
-    "\x43\x43\x03\x55\x78\x4B\xE2\x74\xE0\xF4\xE5\x4F\x3E\x67\xE3\x6E"
-    "\xF2\xAB\x18\xC5\xE3\xD4\xD3\xDA\x8C\x82\x96\xAD\xBB\x4C\x83\xAF"
-    "\xFC\xA6\x92\x9F\x92\x69\x2D\xB9\x88\xF9\xF7\x16\x68\x52\x57\x42"
-    "\x68\x19\x30\x17\x9F\xCE\xF1\x13\x64\xA4\x20\x4A\xCD\x9F\x14\x06"
-    "\x37\xE8\x59\xFA\x26\xAF\xE1\x6C\x01\x57\x7B\xFB\x15\x6E\x4E\xCB"
-    "\x5E\xFD\x07\x59\xEB\x0D\xC4\x33\xD9\xA4\x6B\xAA\x3B\x5B\x52\x23"
-    "\x9C\x4C\xE5\x47\x7A\x11\xED\xA5\xEA\x59\xBC\x1E\xD7\x35\x2A\xBC"
-    "\x61\xCF\xFE\xCA\x2A\x42\x80\x82\x02\x2F\xA4\xD1\xE4\x14\x2D\xB6"
-    "\x7D\x20\x41\x5F\x2F\x07\x12\xF4\xE9\x70\x99\xAF\x70\xB2\xE8\x20"
-    "\xFB\x13\x19\x87\x9E\xC3\x61\x76\x57\x9D\x5B\x5F\x74\x23\xAF\x2F"
-    "\x18\xD3\x63\xAC\xA1\x3E\x05\x98\x74\xD8\x80\xB5\xF6\x20\xA5\x6A"
-    "\xAF\x25\x0C\x05\xF9\xE5\xDB\x84\x09\x5B\x63\x4B\xD7\x69\xCD\x59"
-    "\xB6\x36\xF8\x4F\x67\xC9\xB6\xF5\xCA\x59\xAE\x9D\x05\x2F\x6D\xA9"
-    "\xFA\x2D\xF5\x59\xA6\x6C\x9D\x4B\x5B\xA2\xD1\x1E\xC9\x45\xD5\xD2"
-    "\xBE\x5E\x76\xF4\xEB\x03\xB4\xFF\xFA\x8A\xB6\xFA\xA1\xD6\xD6\x51"
-    "\xD9\x94\xBF\x96\xE9\x32\x5C\x1C\xEC\x07\xFB\xE2\x6E\x10\x51\x9E"
-    "\xB0\x02\x10\xB7\x8E\x44\x4D\xBD\x12\x83\xCF\x07\xF0\xF9\xE0\x4D"
-    "\xEC\xC3\xDB\xD8\x87\x46\x1C\x0C\x2B\x90\x7F\xDC\x02\x78\xC4\xDF"
-    "\x92\x49\x3F\xB6\x8E\xAA\x12\xF2\x1C\xB1\x00\xF0\x00\x1E\xF9\x46"
-    "\x11\x81\xAC\x8F\x31\x94\x61\x2A\xC5\x00\x5F\x0F\xC2\xB7\xA3\x84"
-    "\xC7\x96\xD5\x3C\x65\x02\x26\xD5\xC3\x20\xF6\x21\x99\xD2\x13\x90"
-    "\x96\x18\xC1\x72\xD9\x59\x12\x28\xC8\x2E\xE9\x49\x7B\x8C\x99\x69"
-    "\x97\x33\x3E\x45\x66\xDB\x46\x7D\xBE\xE0\x7A\xBF\xAE\x33\x0A\xF7"
-    "\x74\xA0\x69\x40\x7F\x7D\x2E\xBA\x9C\x17\xF2\xF3\x36\xAE\x02\xF3"
-    "\x7C\x63\xF0\xC2\x2D\x99\xBE\x71\x4B\xEA\x67\xBF\x24\xB8\xBD\x96"
-    "\x15\xD9\x8E\x50\x15\x2D\x6B\x84\xEF\xFD\x9A\x82\x78\xB2\xA3\xCA"
-    "\xAD\xE5\xBE\xF3\x6B\x2C\xB2\x0A\x52\xC0\xE6\xAF\x33\xBB\x8E\xFF"
-    "\x56\xD7\x52\xD8\xB7\xA3\x25\xA7\x4B\x54\x0A\x51\xFC\x20\x93\x81"
-    "\x74\xB5\x2C\x9B\xC6\xD5\x51\xD3\x9C\x41\xD2\x14\x9D\x1C\x50\x59"
-    "\xED\xC4\xAC\x05\xEF\x46\x76\x5E\x07\x93\x00\x75\xA0\x12\xAF\x4C"
-    "\xA4\x6E\x7C\xAA\x3F\xDD\x59\x1F\x1E\x66\xD5\xD3\xFC\xAF\x6C\x34"
-    "\x76\xE5\x6F\xC8\x6D\x72\xD1\x46\x29\x41\xCA\x06\xAD\xEA\x12\x01"
-    "\x85\xEE\x61\x2A\xCB\x18\x89\x0E\xFC\xB4\xDA\x0E\x93\xA0\x34\x98"
-    "\xF6\x2B\x3D\x08\x02\xFB\x38\x85\x39\x87\x10\xC2\x0C\xA2\x27\x11"
-    "\x5C\x4C\x68\xD5\xC8\xEE\x3C\x28\x17\xD9\x72\xCC\x31\x10\x6B\x6D"
-    "\x30\x29\x69\x6D\x94\xB7\x24\x59\x85\x23\x50\xCB\x67\x83\x09\xCB"
-    "\xEF\xD5\x50\xED\x46\xE3\x7A\xE1\xF0\xD7\x68\xBA\xF2\x64\x5A\xBE"
-    "\x22\xB6\x69\xDE\xB9\xAC\x19\xC7\x63\x4D\x89\x1C\xAC\x35\x62\x27"
-    "\x8F\x67\x7F\x1A\x83\x6A\x03\xF3\x57\x52\x97\x03\x8C\xA1\xAD\xB6"
-    "\xA4\xA4\xDD\xF4\xE5\xE6\x48\xEF\x20\x2F\xC8\x2C\xEA\x52\x16\x3B"
-    "\xD2\x2E\x72\x71\x73\xBC\xFA\x94\x12\xA6\x2F\xED\x4D\x24\x4E\x30"
-    "\x26\xB0\xB4\x3F\x51\x00\xC3\x4D\xFD\x39\xDB\xF5\x17\xDE\x26\xCC"
-    "\x27\x90\xEF\x4B\x23\x38\x91\x9E\xDC\xAF\xA0\xED\xA7\x33\x67\x84"
-    "\xE2\xD9\x1B\x96\x80\x02\xE3\xB1\x3A\xD0\xA4\x33\x98\x8F\xC1\x54"
-    "\xFC\x63\x99\x17\xAF\xE0\x21\xA2\x67\x70\x38\x8E\x4A\xBA\x6A\x51"
-    "\xA0\xF5\x7A\xC4\xCD\x96\x19\x4C\x84\x77\x99\xF9\x6C\x5B\xDF\x16"
-    "\x9C\x16\x3A\xB5\x4A\x45\x48\xC0\x43\x22\x97\x03\x14\x46\xD7\x9D"
-    "\x1B\xD4\x45\x12\x13\x36\x4F\x83\xF1\x66\xC3\x95\x0D\x6D\x4C\x0D"
-    "\xBF\x22\x38\x4A\x36\x1C\x4E\x94\x6D\x71\x8A\x95\xE0\x99\xA6\x92"
-    "\xB6\x79\x92\xE6\x86\x21\xDB\xC0\x32\xEE\x7C\x3D\xF1\x5E\x75\xCA"
-    "\xAA\xFC\x14\x32\x03\x0A\x3E\x7B\x68\xB3\xBF\x07\x07\x4D\xEB\x23"
-    "\xAF\x44\xB2\x0A\xF0\xD2\x78\xA8\x14\xEB\xBF\x20\x8C\x0C\x1E\x5F"
-    "\x09\x8E\xFA\x0E\xF8\x68\x1F\xF0\x54\x72\x5D\xA1\x3E\xAF\x7B\xB5"
-    "\x31\x47\x0E\xDC\x2E\x39\x8E\xEF\x7C\x70\xD9\x3E\xD4\x1D\x98\xBF"
-    "\xBF\xDA\xA0\x6C\x22\xB1\xD2\x16\x60\x18\x5D\x0C\xAF\x40\x19\x9C"
-    "\x54\xC8\x46\x5A\x08\xB5\x98\x91\xEC\xC4\x95\xB7\x2C\x7D\x22\xC5"
-    "\x28\x1E\x41\x10\x18\x0D\xAB\x26\xDD\x26\x06\x1A\xCA\xD0\xEB\x40"
-    "\xD5\x21\xFD\xAB\xCB\x59\x75\x7D\x03\x40\x88\xA4\x73\x31\x28\xA8"
-    "\xE8\xC4\x8F\xAC\xAF\xB8\x9D\x66\x62\xFF\x5E\x89\x91\xA8\x93\xF5"
-    "\x67\x6A\x65\x03\x41\x9F\xA8\x48\x92\x71\x96\x98\x63\x65\x03\xC2"
-    "\x66\x12\x0D\xF1\x04\xCE\x14\x0C\xA9\xD8\x1D\x00\xDF\x07\x7F\xD1"
-    "\x47\x8A\x31\x07\xB4\x2E\xF4\x1C\x97\xA7\xAD\x2D\x33\x47\xA6\x29"
-    "\xA4\x9E\x42\xC2\x1B\x85\x42\x60\x47\x7B\x60\x25\x6C\x6D\x8F\x59"
-    "\x87\x7D\x10\xC4\x0A\x79\x31\x64\xB2\x92\x5F\x6C\xF6\xF9\xCD\xE8"
-    "\xA2\x68\x6D\x4B\xE2\x7E\x41\xD0\xB1\xF4\xEE\x2E\x16\x7B\x41\xE9"
-    "\xD5\xC3\x4E\x50\xBC\x34\xD3\x67\x56\x39\xF9\xA4\x0F\x42\x3B\xE6"
-    "\x94\xE5\xC3\x1D\x65\xA3\x4B\xC0\xE5\xC4\xED\x93\xE7\x99\x9E\xCA"
-    "\x15\x19\x9B\x18\xAF\x10\xCF\x2E\x85\x71\xA3\xED\x04\x0F\x18\xD1"
-    "\xBB\x2C\x96\x65\xBA\x90\x89\xCC\x6F\x79\x75\xC9\xF0\xE6\x64\x25"
-    "\x19\x52\x64\x75\x6A\x94\x5C\x93\xCE\x4C\x96\x3E\x1C\xFF\xBE\x4A"
-    "\xB1\x44\x09\x1A\xD4\xB7\x43\xF0\xD4\xDE\x2B\xD7\x18\x0F\x67\xFB"
-    "\x96\x33\x0A\x51\x2B\x3A\x0C\xF0\xB3\xC9\x66\x72\xDF\x58\xAA\x1D"
-    "\xEF\x34\x5F\x2E\xD5\x96\x22\x88\x07\xF9\x3C\x34\x50\xB7\x0C\x9F"
-    "\x36\x13\x53\x00\x4C\xFB\x8E\x95\x74\xDC\x6B\xFC\xE5\x8A\x1B\x3E"
-    "\xB8\x18\x51\x58\x63\x32\x5E\xA3\x1F\x8B\xED\x59\x64\x59\x52\x5B"
-    "\x5C\x79\xCC\x8C\x5A\xAE\x25\x38\x53\x75\x35\x0F\x1C\xB5\xD2\x95"
-    "\xD8\x85\xB2\x9F\x0F\xE6\xB3\xDD\x6B\xEF\xEE\x82\x91\xBB\x10\x63"
-    "\x1A\x9F\xBD\xEC\x1C\xA4\xBA\x68\x67\xEC\xAB\x9B\x76\x0A\x9D\x8D"
-    "\xE2\x90\x1D\x0C\xC6\x41\xDB\x26\xD4\x7B\x85\xCA\x46\x13\x43\xFF"
-    "\x2E\x37\x01\xF0\x43\x5F\x7A\x1B\x88\x6F\xD7\x67\x87\xC0\xBA\x6F"
-    "\x58\xD4\x68\x17\x55\x63\xF3\x24\x24\x8C\x6A\x0C\xAE\xAE\x4A\xA1"
-    "\x0F\xE6\x56\xE7\x56\x4F\x9D\x2C\xCA\x62\xA8\x92\x78\x49\xF7\x21"
-    "\xBC\xFC\xA3\xD2\xA1\xC2\x3F\xEA\x64\x96\xE1\x75\x10\x55\x2E\x27"
-    "\x79\x52\xA0\xAD\xA9\x29\xA8\x08\x3A\x63\xDA\xF2\x97\xDD\x15\xDE"
-    "\xC7\x04\xBD\x2A\x2C\xE5\x37\x76\xEC\xC5\x70\x1C\xF5\x9F\x40\x37"
-    "\x33\xD1\x1D\x4C\xDA\xBC\xAB\x7D\xD7\x43\x77\x34\x36\x43\xB0\x8F"
-    "\x2D\xB9\xD8\x5A\xFA\x46\x48\xFB\x90\x1D\xF2\x16\xAB\x72\x80\x87"
-    "\x4B\x1B\x14\xD2\x81\x96\xAF\xD3\x71\x0D\x66\x23\x9F\x95\x1E\xFE"
-    "\x7C\xD4\xA2\x5A\x15\xBE\x1F\xAD\xE9\xBD\xF1\xD6\xDB\x5B\x0B\x4A"
-    "\x3E\x51\x3C\x46\xBD\x05\xDF\x63\x8B\xA1\xA6\x47\xF3\x36\x6F\x09"
-    "\xF1\xD9\x71\xB2\x90\xCE\xCB\x1D\x55\x50\x2F\xAB\x8E\x94\xF6\x89"
-    "\xC4\x38\x48\xB7\x7A\x88\x88\x62\x73\x2A\xE6\x00\x11\x90\x43\x4C"
-    "\xF8\x37\x09\x24\x4E\x44\x59\x83\x14\x58\xF2\x50\x59\x7A\x01\x07"
-    "\x0B\xBE\xD5\x3B\x9C\xF7\x0A\x67\xF9\x41\xBB\x17\x38\xEF\xFD\xED"
-    "\xB9\x60\x27\xF7\xA4\x3F\xBC\x8D\xF4\xAC\x7D\x8E\x32\x77\x8E\x94"
-    "\x47\x7D\x47\x9D\x03\xB4\x27\xB8\x08\xCE\x36\x40\x70\x66\x21\x18"
-    "\x2A\x1A\x17\xEB\x3E\x8E\xFE\xD6\x56\xF8\xC7\x1D\x7B\xAC\xA7\xB3"
-    "\xD6\x7E\x4B\xFF\x77\x67\xC0\xED\x55\x44\x8D\x13\x21\x2C\xB9\x03"
-    "\x3D\x9D\xF5\x1F\xA8\xED\x3E\x0F\x15\xCD\x40\x63\x8E\xF6\xCE\xD5"
-    "\x74\x92\x35\xF2\xBF\x5A\xE7\x43\x17\x52\x2E\x49\xFA\x45\xEF\x7E"
-    "\xEA\x1A\xAA\x0F\x82\x15\xFC\x1F\xE2\xDE\x13\xC4\xB6\x85\x03\x00"
+    "\x1F\x8B\x08\x08\xF4\x1A\xD4\x6A\x00\x03\x62\x75\x6E\x64\x6C\x65"
+    "\x2E\x6A\x73\x00\xED\xBD\x6B\x7B\xDB\x46\x92\x30\xFA\xDD\xBF\x02"
+    "\xE6\xE4\x59\x51\x09\x45\xCB\x99\x9D\xB3\xB3\x72\x94\x79\x1D\xDB"
+    "\x49\xFC\x26\xBE\x1C\xDB\x99\xEC\x1C\x3F\x7E\x14\x88\x84\x24\x8C"
+    "\x29\x80\x4B\x80\x96\x34\x8E\xFE\xFB\xA9\x4B\x5F\xAA\x6F\x00\x28"
+    "\xC9\xCE\x65\xC2\x9D\x8D\x05\xA0\xBB\xBA\xBA\xBA\xBA\xBA\xBA\xBA"
+    "\xBA\xEA\xCE\x1D\xFB\xCB\x0E\xD7\xD5\x7C\x51\x4C\xFF\xD9\x64\x77"
+    "\x9C\xDF\xAD\x5B\xF0\xF1\x78\x51\x1F\xE6\x8B\x6C\x56\x57\x4D\x9B"
+    "\x57\x6D\x73\x8B\xFE\xCA\xBE\x7F\xF4\xF5\xAB\x83\x1F\xBF\x7D\xF4"
+    "\xE8\xFB\x6C\x3F\x1B\x2D\x8A\xA3\x76\x74\x4F\x7D\x7A\xF1\xF8\x9B"
+    "\x6F\xC5\xB7\x55\x79\x7C\x62\x3F\xDA\x7A\x07\x8F\x9F\x3E\x7C\xF4"
+    "\x3F\x50\x62\x37\x52\xD1\x7C\xBC\x1B\xAB\xF8\x10\x3E\x8C\x77\xCF"
+    "\x77\xEF\x66\x5F\x7C\x11\x40\xDC\x8E\x82\x73\xAA\x04\x0D\x41\x9D"
+    "\x5B\x77\x3E\xFD\xF4\x56\xF6\x69\xF6\xB2\xAC\x8E\x17\x45\x5B\x57"
+    "\x59\x5B\x67\x8B\xBA\x7E\xBB\x5E\x66\x55\x7E\x5A\x64\xF5\x51\x76"
+    "\x76\x52\x14\x8B\x66\x0A\xC5\xEE\xA8\x36\x7E\xA4\x37\x08\xFB\x68"
+    "\x5D\xCD\xDA\xB2\xAE\xC6\xDB\xD9\xFB\x5B\x19\xFC\x54\x01\xA7\x37"
+    "\xFC\x05\x7F\x4C\xB2\xBD\x6C\x77\x62\x5F\x31\xA5\xF6\xB2\xBB\xF4"
+    "\xEA\xF2\x5E\x00\xE6\xE9\xFD\x27\x8F\x00\xCA\x6B\x0F\x4A\x00\x82"
+    "\x9E\xDF\x84\xF5\x89\x0A\xB6\x36\x92\x63\x22\x9F\x3E\xE7\x8A\xB7"
+    "\xE8\x1F\xDD\x21\x80\xB0\xAE\x5A\xD3\x2D\xFC\xAD\x8A\x76\xBD\xAA"
+    "\x04\x52\xD3\x45\x51\x1D\xB7\x27\xDC\xE2\xA5\x57\x1F\xA9\x37\x26"
+    "\xD2\x3D\xAE\xE6\xC5\x79\x27\xA0\xD7\xB6\xDC\x9B\x38\xB4\x12\xBF"
+    "\x31\xB8\xA7\x00\x38\x09\x8D\x48\xFE\xDA\x94\x4B\x41\x9B\x0F\x01"
+    "\xF5\x30\x05\xA7\x29\x16\x47\xEE\xB0\x62\x67\x61\x08\xF1\x1F\x31"
+    "\x2C\x84\x34\xBC\xA6\x7F\xE5\xFB\x39\xBE\x9C\x8B\x37\x44\x6C\x78"
+    "\x49\xFF\x4E\x34\x23\xDC\x12\x38\x61\x9B\xF7\x6E\x5D\x6E\x8F\xB7"
+    "\xEF\x05\x63\xCB\x88\x68\xDE\x52\x83\x6B\xF8\xEA\xF3\xC9\x2D\x80"
+    "\x65\xFA\xCE\x7D\x5A\x9F\x1E\x16\xAB\x90\x08\x5D\x04\x80\xCE\xEB"
+    "\xD9\xD2\xD8\xD9\x72\x92\xB7\xD9\x49\xBD\x98\x37\x50\x37\x9F\xD7"
+    "\xD5\xE2\x02\x79\xEF\xA8\x3C\x5E\xAF\x72\x6A\xEF\x5D\xBE\x58\x17"
+    "\xCE\xEC\xE1\xEF\x80\xB7\x33\x79\xA8\x7D\x82\x8F\xBF\x4F\xB3\xFF"
+    "\xC3\xB8\x34\xD9\xFB\x8A\x90\xBD\xCC\x76\x32\xFE\x0B\xE7\xE4\x69"
+    "\xB9\x58\x94\x4D\x31\xAB\x6A\x68\x19\xA6\x6C\x73\x52\x9F\xE9\x9A"
+    "\xB1\x1F\xA1\x5A\x64\x6D\x09\x53\x3A\x3F\x2F\x1B\x84\x81\x2F\x96"
+    "\x67\xA7\x77\x9A\x65\x51\xCC\xBB\x2A\xB7\xC5\xA2\x38\x2D\xDA\xD5"
+    "\x45\xB6\x5C\xD4\xED\x54\x15\xBD\xE3\xF2\x94\x29\xF4\x1C\xCA\x3C"
+    "\x69\xB0\x4F\x9A\x9C\x77\x77\xE1\x77\x4F\x73\xCF\xE0\x3E\x36\xF9"
+    "\xE9\x72\x51\x34\xC0\x3E\x02\x83\xC3\xF5\xD1\x51\xB1\xEA\xC3\xE1"
+    "\x2B\x2A\xF5\xB2\xFC\x57\x21\xF1\xF8\x9C\xB1\x70\xAA\x2C\xEB\xA6"
+    "\x78\xA5\xAB\x25\x2A\x78\x82\xE1\x24\x5F\xB5\x5F\xE5\xB3\xB7\xC7"
+    "\x2B\xE0\xD6\xF9\x83\x7A\x51\xAF\x64\xA5\xD1\x9F\xEE\xFE\x15\xFF"
+    "\x6F\x04\x3D\x1D\xFD\xE9\xCF\xFF\x0F\xFE\xDF\xE8\xD3\x3B\xF7\xB4"
+    "\x68\x73\x01\xDD\x87\xC1\x88\x80\x78\xF4\x35\xFE\xDF\x28\x40\x17"
+    "\x79\xFC\x25\x8E\x57\x58\x67\x81\xFC\x7E\x08\xCC\x16\xD6\xA2\xA9"
+    "\x90\xA8\x16\xAF\x81\xED\xBC\xCA\x57\xC7\x45\x9B\x68\xE8\x78\x55"
+    "\x14\x55\xA2\xA5\x54\xC5\x44\x1D\x6C\xEB\xF9\xD9\x69\xA2\xA1\x8B"
+    "\x62\xB1\xA8\xCF\x12\x2D\x45\xAB\xA5\x6A\xE0\x50\x7F\x5F\x56\x45"
+    "\x58\x63\x59\x56\x6F\xE3\xE5\x9F\xD7\x65\x15\xE9\xC9\xAA\x98\x87"
+    "\xE5\xF3\x77\xC5\x2A\x3F\x2E\x88\xCE\xEE\x04\xF8\x7C\x03\xFE\xD7"
+    "\x33\xBB\xAE\x60\x66\x1F\x16\xED\x19\xD0\x0C\xE0\x2C\x8B\xBC\xA5"
+    "\x59\x9B\x57\x19\x34\x78\x92\x57\xC7\xDD\x93\x76\x56\x9F\x9E\xE6"
+    "\xD5\x7C\x92\x35\x35\xCD\xF4\x55\x0D\xE8\x6D\x35\xD9\x1C\xC4\x14"
+    "\x7C\x20\x51\xB0\xCA\xC6\x38\x37\x4F\x9B\xED\x2E\x48\x6F\xAB\xFA"
+    "\xAC\xC9\xCE\x40\x70\xAC\x8A\xAC\x69\x01\xBF\xEC\xA4\x58\x15\x89"
+    "\x39\xA8\xDA\xFD\xB6\x00\xE6\x3E\x04\xA4\x3D\x4A\xFC\xC5\x12\x82"
+    "\xA5\x61\xB8\x98\x78\x92\x04\x44\xB8\xF7\x66\x12\x29\x6B\x67\xBC"
+    "\x2C\x6F\xDF\x8A\x3A\xC1\x94\x87\x1A\xC1\x3B\xB9\x38\x45\x26\x3C"
+    "\xAE\x55\x91\xD7\x7E\x2D\x33\xBB\x75\x79\xF3\x42\x94\x74\xE7\x34"
+    "\x94\x74\x5F\xF8\x7A\x8E\x53\xD4\x7B\xE3\x41\x15\x13\x51\x81\x15"
+    "\x6F\x7C\xB8\x6E\x61\xFF\x95\x07\x59\x4F\x3C\x05\x56\x3F\xFA\x30"
+    "\x45\x31\xE7\xD9\x1B\x0D\x33\x2B\xD5\x48\x98\x67\xAF\x9C\x9D\x8D"
+    "\xAA\xA0\x7D\x21\x4A\xBA\xF3\x10\x4A\xBA\x2F\x1C\xB5\xC3\xE7\x55"
+    "\xD2\x41\xFC\x97\x13\xA9\xFC\xB8\xFA\x08\xA8\x23\xB0\x5B\x28\x4F"
+    "\x97\xF5\x0A\x54\xEF\x7A\xB1\x38\x04\x86\x78\xD9\xE6\x6D\x91\x1D"
+    "\xAD\xEA\xD3\x6C\x34\xBD\xB3\x52\x6F\x0F\x1A\x7C\x0D\xFB\x8D\x91"
+    "\xD1\x23\x1E\xE0\x0C\x58\xAD\x67\xA4\x13\xB4\x58\x10\xA6\xE4\x51"
+    "\xBD\x82\x46\x9A\xF2\x5F\xF9\xE1\xA2\x98\x64\xCB\x1C\xBA\x88\x7F"
+    "\x66\xB3\xBC\x7A\x97\x93\x26\x91\xE1\xFF\x83\x12\x5E\xA9\x77\x59"
+    "\xD9\x70\x95\x02\xE6\x7B\xD9\xC2\x2C\x9F\xD5\xF5\x6A\x5E\x56\x88"
+    "\x47\x73\xD1\xB4\xC5\x29\xD6\xE0\x52\x45\x8B\x0A\x03\x2D\xFE\xE5"
+    "\x79\xB1\x10\x45\x1B\x10\x2E\x73\xFA\xC2\x60\x9F\x63\xD3\xC5\x4A"
+    "\x55\x9D\xE5\x80\xDE\x1C\xEB\x82\x34\xC2\x2F\xA2\xA4\x41\xEA\xFF"
+    "\x2C\xF3\x55\x7E\x9A\xBD\x87\x6E\x81\x8E\x74\x99\xCD\x1A\x60\x77"
+    "\xC0\x1F\x06\x74\x95\x2C\xC0\x7D\x90\x5F\x3F\xBD\x74\x51\xC8\x48"
+    "\x7D\x32\x32\x86\x6B\xFC\xBD\x2C\xCE\x1E\x18\xBA\x8D\x65\x53\x13"
+    "\x0B\x77\xE2\x42\x9A\x64\xA7\x45\xD3\x00\x37\x7C\xB5\x86\x4F\xEB"
+    "\xE5\x1C\xFA\xFD\x84\xDF\x68\x25\x10\x34\xBB\xEC\x60\x66\xB0\xDE"
+    "\x07\x79\x3B\x2F\x8E\xE0\xEF\xF9\x3D\xF1\x9D\x91\x8E\x7F\x9C\x97"
+    "\xAB\xF6\xE2\x81\x2E\x01\x23\x5C\xF8\x1F\x51\xC4\x98\x4F\xAE\x00"
+    "\x3D\x80\x11\xE2\xBA\x5A\x1D\x31\x0C\x0B\xAC\x76\x9A\xBF\xD5\x44"
+    "\x77\x46\xEE\x34\x6F\x67\x27\x19\x49\x30\x18\x19\x64\x05\x53\x4B"
+    "\xE1\x3A\x3D\x2B\xE7\xED\x09\x34\xAA\x9F\x67\x8B\x12\xCA\xFE\x88"
+    "\x6F\xEF\x05\x85\x4F\x0A\x9C\xAF\x41\xE9\x6F\xE9\x75\x62\x57\x41"
+    "\x23\x72\xBF\x6D\xF3\xD9\x49\x31\x07\xC4\x01\xDD\x17\x8F\x5E\xED"
+    "\x51\x2F\xB3\xF2\x28\x7B\x07\x9F\x91\x93\x40\xA1\xCB\x55\xA9\x8C"
+    "\x26\x05\xC1\x09\xB6\x21\xB7\x6F\xDB\x51\x88\xB7\xC8\x50\xB0\x55"
+    "\x87\x4C\xD0\xD4\xD8\x47\x46\x7E\xC7\x1F\x2E\x3E\x35\x6C\xFF\x17"
+    "\xF5\xF1\x78\x04\xC5\x8A\xD3\x25\xCD\x0B\x06\xA9\x29\x4C\x18\xB7"
+    "\x67\xE5\xAC\x20\xBC\x8F\xAB\x1A\x56\xFE\xE9\x68\xFB\x9E\x03\xCB"
+    "\x11\x09\xFA\xA5\xC2\x95\x69\x2A\x98\x69\x5E\xCF\xD6\x38\x46\xD3"
+    "\xFF\x5D\x17\xB0\xD4\xC0\x88\xCD\xDA\xDA\xE5\xDE\xED\x60\x38\x68"
+    "\x1C\xF4\xE7\x48\x4D\x2A\x24\xAB\x79\x3C\x74\xCF\x22\xE3\xCC\x86"
+    "\x29\x77\x97\x8B\x8E\x55\x63\xB2\x74\xD0\x35\x7F\x08\xE6\x45\xC7"
+    "\x10\x7C\x5F\x82\xE8\xA9\x60\x9E\x0F\xA7\xBF\x85\x07\x3B\xB5\x72"
+    "\xA1\x15\x8E\x85\x86\x74\x63\xE3\xE0\xCD\x5B\x97\xD8\xE2\x63\x82"
+    "\x70\x8C\xA7\x22\xDC\x10\x8A\xD1\xDC\xB7\xDD\x20\x03\x90\x43\x49"
+    "\x87\x5C\xE1\x6C\x10\x75\xBF\xD4\x75\xFD\xC1\x80\xC9\xB4\x6A\xE3"
+    "\x50\x70\x40\x6E\x5F\x75\x52\x10\x5C\x31\x06\x66\x9C\x60\x02\x9B"
+    "\x49\x7D\xD5\x41\xB1\x60\x3F\x23\xC3\x97\xC4\xF8\x6E\xB6\xBF\xBF"
+    "\x2F\x8A\xF8\x08\x8B\x49\x91\xCF\xE7\x8F\xDE\xC1\xBC\xE2\xEE\xC3"
+    "\x7A\x30\xE2\x15\x71\x34\xC9\x0E\xEA\xEA\x05\xFD\x2D\xC7\x09\x7F"
+    "\x20\xA0\xFC\xE7\x92\xF6\xC5\x2B\x9A\xEF\xA8\x6A\xD3\x02\xA1\xD7"
+    "\x8C\x89\x5F\xBA\xC5\x35\xD8\xA7\x0E\x2E\xE0\xA5\xDE\x26\x9B\xB2"
+    "\xCE\x63\x79\x34\x1E\xDF\xBE\x6D\x57\xA2\xED\xEC\x3F\xFE\x23\x1B"
+    "\xB7\x17\xCB\x02\x34\x7C\x67\x51\x22\x02\x8C\x78\xB5\x1C\x05\x03"
+    "\x86\x3F\x0B\x65\xDA\xAC\x0F\x9B\xD9\xAA\x3C\x2C\xC6\x0E\x8C\x09"
+    "\x51\xDF\x1B\x97\xCB\xD8\x60\x00\x5E\x9D\xB3\x36\x5C\xBC\x88\x0C"
+    "\x87\x65\x4B\x5B\x93\xEC\x04\xF4\x9C\x09\xEC\xD1\x41\xA1\x59\x95"
+    "\x6D\x09\x2A\x43\x16\xE0\xEB\xFF\xA0\x3E\x52\x4C\xCD\x3D\x60\xAD"
+    "\x65\x39\x43\xF3\x63\x59\x01\x84\x7C\x31\xA4\x3E\x8E\xAD\x12\x17"
+    "\xA4\xFD\x80\xBE\x94\x19\xCE\x18\x02\xA0\x44\x51\xDF\x94\xA0\x65"
+    "\xDD\x83\x3D\x17\xA0\x53\x18\x18\xAC\x5D\x0C\x02\xC2\x08\x03\x2E"
+    "\xA0\x59\x00\x36\xB0\x8C\x9C\xE6\x17\xD9\x49\x39\x2F\x02\x7E\x38"
+    "\xE0\x01\xFA\xBE\xAE\x97\xE3\x65\xB1\x82\x16\x41\xE7\x9C\x15\x53"
+    "\xD8\x6A\x01\xD5\xA3\x13\xA5\x57\x14\x37\x6D\xBD\xFC\x20\x93\xBF"
+    "\x5E\x7E\xF8\xB9\xBF\x13\xCC\xFD\xDD\xE1\x73\x7F\x55\x9C\xC2\xEE"
+    "\xF6\x26\xA6\xBF\xD7\x59\x64\xCC\x6E\x11\xF0\x31\xA6\xF5\xBA\xDA"
+    "\x6C\x62\x3B\x8F\x67\x65\x35\xAF\xCF\xA6\x33\x64\xAF\xC5\xFD\xAA"
+    "\x3C\x25\xB3\xE4\xD7\x2B\x34\x4F\x0B\x2E\x74\x78\x2E\x39\x7E\xDA"
+    "\x84\x71\x47\xFD\xC3\x1C\x40\x53\xA7\x5C\x94\xED\x85\xFC\x4A\x0B"
+    "\x1E\xDA\x25\xCD\x72\x17\x53\x17\x5F\x72\x81\xE8\x8A\xA7\x2B\xA7"
+    "\xD7\x3B\x28\x10\xA8\x1E\xA6\x5A\x72\x39\x51\x05\xFA\x85\x9B\xF3"
+    "\x19\x6B\x8D\x2D\xD3\x6D\x44\x30\x83\x31\x0A\x83\x34\xC6\xC9\x49"
+    "\x90\xC0\x18\xA1\x5D\x1B\x25\xE6\x01\x42\x0A\xD8\x7D\x86\x9D\x3F"
+    "\xCA\x17\x4D\xE1\x0A\x10\xF5\xED\xE7\x9F\x9D\xDD\x4D\x20\x43\x1C"
+    "\x1D\x89\x76\x89\x63\x8F\x3D\xBD\xCD\x11\x35\x75\x25\xBC\x15\xF3"
+    "\x92\x82\xBB\x01\xE2\x58\x3E\x18\xF9\x40\x5D\xEE\xC0\x58\x2D\x7B"
+    "\x7A\xE1\x02\xD8\x39\x20\x3B\x5F\xE5\x67\x69\x6E\xF2\x7A\x29\xFA"
+    "\xE7\xF2\x59\xD0\x7D\x51\x31\xE8\xBF\x16\x6B\xE3\x02\x05\x9F\xC3"
+    "\x50\x82\x34\xD8\xC0\x76\x1C\x42\x5D\x29\x39\x32\xD6\xC2\x2D\x83"
+    "\x6A\xB9\x47\xBF\x53\x21\xB1\xA2\xFB\x65\xFD\xA3\xDD\xE9\xEA\xAD"
+    "\x5E\xC9\xE1\x7F\x44\x82\x5E\x5A\x7A\xBD\x4F\x8C\x33\x2D\x95\x68"
+    "\xB4\x7C\xD9\xE6\xA7\xCB\x54\x6F\xB7\x59\x21\x61\xD9\xAF\x97\x72"
+    "\x1E\x1D\x98\x3F\xA6\x8A\xE0\x79\xB9\x28\xF4\xEE\x5A\x94\x30\x5D"
+    "\x15\xB0\x05\x6B\xDA\x0D\xA4\x69\x8F\xC9\xD3\x5D\x9B\xF1\x74\xCC"
+    "\x79\x21\x8D\x5B\x66\xCB\x8B\x86\x2D\xF3\x20\x4A\xD8\x1D\x14\x94"
+    "\xB0\x0F\x13\xBF\x35\x25\x79\x4D\x63\xEA\x59\x94\xD3\xE2\x15\x8A"
+    "\xE8\x3F\xC5\x57\x2D\xCA\xE0\xAB\xFE\x53\x7C\xB5\x14\x86\xEF\xF6"
+    "\xC1\xC1\xC2\x10\x9A\x70\x30\x4F\x12\x03\x67\x43\x83\x78\x38\x2F"
+    "\x9C\x92\x42\xF9\xA1\x82\xE2\x59\x94\x33\x3C\x0F\x65\xCC\xDF\x5D"
+    "\x27\x8E\x78\xEA\xE7\xFF\xB2\x1F\x8B\xC3\xEC\x65\x3D\x7B\x0B\x4B"
+    "\x1C\xAA\x08\x2F\xD0\xB6\x9E\x3D\x60\xC3\xA1\xEF\x4F\x80\x2E\x05"
+    "\xD6\x72\xC5\x65\xB8\xEE\xF8\xA4\x6E\x5A\x3A\x33\xCD\xD0\x7E\xB8"
+    "\xFF\xD7\xCF\xA5\x75\x4A\x6E\x43\x35\x1F\xDA\x85\x17\x54\x87\x22"
+    "\x3F\xCD\x80\x01\x8F\x0B\x54\x5E\xF3\xEC\xAC\x38\x6C\x18\x25\x32"
+    "\x46\xFE\xF5\xAE\xAC\xF1\x2E\x5F\x65\xEA\xEB\x7E\x56\xAD\x17\x8B"
+    "\x70\x35\x7E\x89\xA4\x25\xBB\x4D\xC4\x12\xC3\x75\x53\x76\x9F\x17"
+    "\x45\x3E\xBF\x88\x55\x54\x4D\xA2\x16\x04\x24\xE3\x5E\x4F\x9F\x3D"
+    "\x7F\xF4\x94\xA4\x09\x7F\x9D\xE2\xC1\xE9\x05\xD9\x4C\x5D\x39\x65"
+    "\x3B\xCB\xAA\x7D\xAE\x4D\xB3\xA8\x72\x36\x20\xF2\x78\xA7\x51\xD5"
+    "\x6D\x06\xDB\x0E\xD0\x9C\x17\xC5\xFC\xB8\xD0\x75\xA0\x43\x45\x35"
+    "\x67\xD5\x02\xCA\x93\x0D\x0A\xEB\x1E\x17\xAD\xFB\x01\x8D\x98\x0C"
+    "\x37\xD4\x5E\x0A\xB4\x2E\x73\x9B\xA0\xAE\x8D\x82\x1D\xBB\x85\x14"
+    "\x74\x7D\x34\xCA\x6E\xD3\xD2\x6D\x61\xE8\xDE\x39\x40\x1C\x7C\x22"
+    "\x3A\x50\x58\xDD\x23\xCE\xE3\x23\x97\x32\x1E\x3D\xE6\x13\xDA\xA5"
+    "\x5A\xB2\x3C\x5A\xAD\xE8\x34\xCB\x23\x8A\x7C\x0D\x24\x29\xF0\x51"
+    "\x57\xD2\x4B\x00\x23\x05\x8A\xFF\xE1\x05\x15\x6A\x8A\x15\x32\x7E"
+    "\xC9\x86\xE3\xAD\x47\x2F\x5E\x3C\x7B\x31\xDE\xDE\xCA\x8E\x50\x1E"
+    "\x4E\x03\x72\x12\x4C\xA3\x00\x87\xF4\x3C\xC9\x0D\x72\x49\x72\x4A"
+    "\x18\x29\x7A\x26\x81\x44\x6B\xFB\xF4\x9C\x2D\x0A\x98\x2C\xDC\x3D"
+    "\x1A\x17\xEA\x1C\xD5\x14\xD6\x4A\x9C\x82\x35\x1E\x8A\xC1\x6A\x47"
+    "\x05\xA1\x54\x8D\x96\x03\x4D\x2C\xDD\xFD\xCC\x45\x8F\xA0\x87\x08"
+    "\x26\x58\x8D\x3E\x25\xC8\x16\x30\x82\xB2\xED\x23\xE2\x3C\xED\x60"
+    "\xB5\xA9\x0A\x6A\x56\x96\xB4\x27\xA8\x58\xDE\xC1\x02\x85\xA6\xD4"
+    "\x7E\x48\xDA\xCA\x17\x12\xFB\x84\x4A\x5E\xE0\x51\x18\xF5\x63\xDC"
+    "\x16\xE7\xBA\x4F\x93\x2C\x50\xD1\xA4\x8E\x71\x9B\xBE\x46\x15\x8A"
+    "\xB7\xD0\x9D\x35\x2C\xE2\x40\xEA\x93\xFC\x1D\xCD\xD5\x25\x70\x13"
+    "\x30\xE1\x22\xA7\xB5\x54\xCD\x5B\x09\xCD\x48\xA4\xED\x88\x1E\x25"
+    "\x0A\x8A\x09\xDC\x53\xD2\xB2\x66\xAA\xA0\x6B\x45\xB9\x2D\xFA\x1E"
+    "\x68\x9B\xFE\x80\xF2\xBC\xC1\xFD\xF6\xC5\xF6\x28\xA6\x24\xA6\x9B"
+    "\x42\x97\x88\x8E\x6D\xBC\xB3\xDC\x4C\x91\x56\x7B\xD9\x28\xFB\x2C"
+    "\x93\xD8\x79\xBB\x1C\x5B\x74\xEC\x31\x65\xBA\x52\x5C\x97\xB5\x9B"
+    "\xEB\x19\x1E\x4E\x8C\xA9\xDB\x9D\x56\x07\x07\x5D\x9E\x72\x8C\x2F"
+    "\x57\xBD\xD7\x49\xC6\x9F\x98\x8C\x9F\xBC\xA7\xF7\x97\xDB\x3F\x45"
+    "\x71\x8C\xEE\x37\xA2\x76\x54\x77\x66\x98\xB5\x13\xF6\xBB\x66\x29"
+    "\x1B\xFF\x74\xD6\xEC\xDD\xB9\xF3\xC9\x7B\xBD\x90\x5F\xEE\x7D\xF2"
+    "\x1E\x57\xDF\xCB\x3B\x4A\x20\xFF\x34\xC9\x5E\x6F\xE5\xAB\xF9\xBA"
+    "\xAC\xEA\xAD\x37\x72\x6A\x31\x9D\x0F\xCB\x2A\x5F\x5D\xBC\xBA\x58"
+    "\x62\x0F\xA0\xE0\x2A\xBF\x60\x0F\x97\xAD\x7B\x5D\x83\xAC\x6A\xD7"
+    "\x55\xBD\x2C\x2A\xE1\x49\x94\x8D\x63\xA6\x84\x0E\x1A\x63\x7D\x50"
+    "\x38\xBB\x4D\x08\xA6\x35\xB3\x15\x10\x0D\x9E\x36\xC1\xB6\x14\x7F"
+    "\x30\x07\xB4\x79\x83\xD6\x7A\x65\x04\x81\xD2\x53\x7F\x8F\xE1\x55"
+    "\xD3\x45\xA6\x34\x0A\xCD\x8F\x65\x7B\x32\x1E\x11\xEA\x51\x3B\x89"
+    "\xFE\x81\xB0\xF8\xE7\x1A\x04\xC2\xAA\x38\xC2\x83\x91\x0C\x6A\x34"
+    "\xFA\xA0\x53\x11\x80\x74\xB5\xAA\x3E\x4B\xC2\x90\x84\xFA\xC9\x21"
+    "\xD4\x5E\xF6\xC9\x7B\x8D\xD8\xE5\x4F\x1E\xB9\x0C\xD9\xB2\x02\x98"
+    "\x2B\xD9\x87\xB6\x58\xF4\xF7\x41\xA3\x6F\x3D\x9E\xA0\x0F\x0A\xAF"
+    "\x9B\xC0\xBB\xAB\xED\x65\xBE\x02\xF4\xEB\x35\x2F\x22\xC2\xEB\x2B"
+    "\x27\x5E\x41\x29\xB0\x5C\x1F\x2E\xCA\xE6\x24\x2B\xDB\x24\x20\xBB"
+    "\x65\x24\x0B\x58\xBA\xB7\x1A\x73\xD9\xD9\xFD\xEC\xFF\xBE\x7C\xF6"
+    "\x74\x4A\x98\x08\x2A\x2E\xCA\x59\x31\xFE\xCF\x89\x61\x9F\x29\xCA"
+    "\x7E\xF2\x97\x7C\x06\x7C\xB6\x0D\x54\xDD\xD6\x5B\xF2\xE6\x6D\xB9"
+    "\xCC\xB6\x90\xD6\x5B\x9D\x2D\x0B\xFB\x9A\xEA\xD4\xD8\x7A\x93\x8C"
+    "\x26\x16\xA7\xC4\x60\xE3\xEF\xF2\x2A\x6C\x80\x7E\x0B\xC3\xF9\x00"
+    "\x4B\xFF\x22\x2C\x40\x0D\xB3\x9F\xD1\x07\x1C\x79\x6A\xA5\x6B\xD0"
+    "\xFF\xB2\xC1\xA0\x13\x65\x37\x1F\x75\xAC\x36\x9A\x10\x2A\x37\x3D"
+    "\xD6\xC7\x75\x5B\xFF\x31\xD6\xD8\xD8\xA2\x7C\x5B\xEC\x65\x5B\xEF"
+    "\x89\x24\xA3\xBD\xF7\xA3\xF3\xD1\xDE\xCE\x9F\x77\x77\xA7\xBB\xF4"
+    "\x9B\x8C\x2E\x46\x7B\xF6\x21\x1F\xED\xFD\x79\x7A\xF7\x3F\xEF\xFE"
+    "\xE5\xBF\xFF\x3C\x19\x91\xD2\x3D\xDA\x1B\xDD\x7F\xF0\xED\xE3\x47"
+    "\x7F\x7F\xF4\x70\x04\xDF\xDB\xD1\xDE\x7F\xED\xFE\xD7\x5F\xFF\x9F"
+    "\xFF\xBE\xBC\xEC\x1E\x70\x66\x33\x6C\xF4\x9B\x3A\x5F\xDC\x18\xAB"
+    "\xD1\xC0\x6E\xCE\x6A\xD4\xF9\x89\x41\xE7\xA6\xD9\x0D\xF5\xF9\xC1"
+    "\xDC\x06\x85\x5B\x58\x9E\x9B\x5F\x84\xE3\x54\xE3\x1F\x5E\xC0\xE8"
+    "\x86\x6E\x6A\x61\x41\x12\x6F\x3E\xEE\x50\x6B\x34\xD1\xB8\xDC\xF4"
+    "\xA8\xCF\x4E\xE7\x80\x2A\x1A\x59\x9C\xFD\x4C\x27\x13\xB4\x27\x68"
+    "\x43\x39\xA9\xD7\x0B\xD8\xCC\x17\xB4\xDE\x0B\x9B\x01\xF9\x10\x29"
+    "\x0F\x71\xDC\x03\x38\x06\x92\xD8\x0F\x50\x73\x37\x0B\xA0\xF1\xF5"
+    "\xA9\x7A\xFA\xD7\xCD\x5B\x12\xEC\x65\x76\x5F\xD8\x35\x52\x5A\x98"
+    "\xFE\x85\x5B\x6A\xEE\xFA\xCB\x1F\x1E\x3C\x78\xF4\xF2\xE5\x04\x77"
+    "\x94\x30\x11\x81\x1D\x57\xC6\x7C\x02\x34\xD8\x4A\xF7\x52\x8D\xC3"
+    "\xCD\x75\xE7\x29\x34\x2F\xBB\x34\x48\xCB\x34\xFD\x4B\xED\x7F\x00"
+    "\x42\xB0\xFB\x71\xBA\xD1\xC5\x64\xE9\xCE\xA5\x3B\x06\x22\x65\x56"
+    "\x94\xEF\x60\x4B\xBE\xAE\x8A\xF3\x25\x08\x17\xF4\x13\x84\xDD\xA2"
+    "\x9E\x0B\xC3\xB4\xE7\xE0\x6D\x27\x4A\x1A\x9D\xB3\x7C\x55\xF9\xBB"
+    "\x9A\x18\x3E\xBC\xD3\x32\xD6\x19\x7F\xCB\x13\x62\x70\x79\x2F\xB1"
+    "\x0B\x9A\x2D\x58\x69\xB9\xF2\xA6\x8B\x00\x04\x9B\x2E\xDB\x86\x31"
+    "\xD1\xC6\x91\xBB\xE4\xFD\x74\x36\x2E\xCE\x67\xC5\x12\x31\xD8\x64"
+    "\x53\xAD\xEB\xA8\x8D\xB5\x01\xD1\xBF\x27\x46\xDB\x90\xE7\x54\xC0"
+    "\xF8\xFA\xCD\xE3\x97\x71\x60\xDC\x25\xFB\x9D\xB5\x02\x3F\xF8\xFE"
+    "\xD9\xCB\x47\x0F\xF9\x84\x7C\x48\xD9\xC7\x4F\xBF\x89\x0A\x35\x55"
+    "\x97\x68\xEA\x9F\xDC\x5D\x46\x06\x30\x20\x6E\xE4\x80\x06\x98\x06"
+    "\x36\xF1\x8D\x7B\x46\x43\x22\x57\x1F\x41\x78\x27\x0F\xEA\xC0\xC1"
+    "\x39\xDD\x50\xF6\x74\x3A\xDB\x50\x7F\x4B\xF7\x68\x34\xBE\xA1\x5B"
+    "\x34\xFE\xEB\xD4\x23\xD3\x15\xD5\xA2\xBF\x64\x4B\xD6\xB6\x86\x0D"
+    "\xDA\x27\xB7\x5D\x5E\x02\xB8\x5D\xFE\x5B\x7C\xB7\xE6\x66\x28\x60"
+    "\x1F\xE4\xB9\x8E\x32\x75\xE1\xB9\x8E\xFA\xD3\xAD\xAF\xBF\xEA\x3F"
+    "\xA5\x43\xB5\xB1\x0F\xA2\x23\xB5\x79\xD0\x0E\xD4\xF8\x5F\x65\x87"
+    "\x51\x24\xC6\x03\x96\x3B\x77\x22\x27\x2C\xF3\xFA\x34\x5B\xB7\xE8"
+    "\x54\x50\x16\xC1\x0D\x4D\x75\x49\xF3\x5B\xF4\xAC\x21\x63\x35\xBB"
+    "\xBD\xAA\xFB\x55\xE4\x70\xB3\x0F\x2F\xB3\xFD\x2F\xD5\x00\x16\x0B"
+    "\x60\x90\xBC\xA1\x33\x26\xF4\x14\x1B\x6F\x41\xA1\x79\x51\x6D\x6D"
+    "\xE3\x01\x0F\x2E\xEE\x27\xF5\x59\x04\x14\xBD\xEE\x00\xC5\x8E\x27"
+    "\x01\xB4\x79\xD9\x90\xC7\x76\x08\x50\x7F\xE9\x43\x4F\x95\x9B\x6F"
+    "\x6D\xEB\x02\xFA\x8D\x3A\x35\x55\x2D\x15\x55\xA2\x21\xF5\x61\x00"
+    "\xEE\x9D\x4D\x91\xB9\x8C\xC6\x28\x1C\xA2\xD4\xF0\x38\x07\x5E\xD0"
+    "\x5A\xB1\x6A\xC7\xFC\x8F\x10\x55\x28\x23\xE8\xF8\xE1\xF6\x7E\x16"
+    "\x7C\xC4\x5F\x7B\xB2\x02\xDA\xA3\xB9\x8D\x0D\xAF\x23\x53\x0A\x90"
+    "\x2A\x17\x56\x7E\x5E\x12\x29\x3E\xBD\xF5\xE9\xA7\x59\x7E\x08\x62"
+    "\x6F\x0D\xE2\x83\x2E\xDD\xB1\x4B\x1A\xDF\xAC\xB9\x25\xDD\xC7\xA1"
+    "\xD8\xF8\xDC\x22\x32\x1E\x71\x19\x3E\x61\x50\x86\x2A\xF8\x6E\x31"
+    "\x40\xFB\x9C\x63\xF5\x56\x4C\x3C\x3E\xCF\xBE\xDC\xCF\x76\xB7\xB3"
+    "\xBF\x65\xE7\xD9\x5E\xB6\x73\x7E\xCF\xE2\x32\xAB\x0B\x34\x78\xAB"
+    "\xEB\x6C\xE8\x59\x8C\xB7\x38\xDB\xE2\xD8\x43\x06\x5D\x24\x6E\x04"
+    "\x99\xF3\xEC\x67\xF4\x93\xB9\x34\xB7\x0B\xBE\x01\x61\x77\x9A\x9F"
+    "\x97\xA7\xEB\x53\x52\xE6\xCE\x6A\xC4\xA6\x58\x95\x33\x71\x29\xD1"
+    "\x71\xBB\xD7\xB7\x90\xCE\xA3\x6F\x2F\x6E\x25\xAE\x2C\x69\x3F\x6F"
+    "\xD1\xD8\x39\xA9\xF4\x17\x9E\xDF\x3E\x14\x18\x9F\x4F\xB2\x8B\x6B"
+    "\x75\x37\x51\xE9\x62\xF8\x80\x5D\xE8\x01\xBB\x08\xC8\x55\x56\xE5"
+    "\x47\xA3\x16\xB4\xD5\x4D\xAD\xB2\xFA\xC5\xA9\xF5\x45\x82\x58\x7F"
+    "\xCF\x17\x25\xB9\xC5\xE5\x6A\xAE\xE1\x19\xA0\x66\x76\xEC\x4C\x4D"
+    "\x5A\x45\xBE\x58\x10\x1D\x40\x8C\x2C\x9A\xEC\x0C\xB6\x2B\xE8\xFB"
+    "\x5F\x65\x2B\xDC\xF5\x25\x09\xCA\x10\xF5\x0F\x8F\x38\x9F\x42\xFB"
+    "\xCE\x68\xE0\x84\x7A\xA7\x70\x08\x41\xFC\x6C\x0E\xCE\x2F\x91\x8A"
+    "\x06\x44\x69\x05\x02\x9F\x8A\xF2\x3E\x08\xFE\xA7\x07\x83\x60\xEA"
+    "\x2E\x81\xA6\xB7\x6E\x40\x8F\xBC\x95\xB8\x18\x97\x49\x1C\x33\x25"
+    "\xD5\x4C\xD3\xDC\x40\x55\x1B\xD8\xB3\x93\x62\xF6\x96\x1A\xCB\xE7"
+    "\x7D\x48\xE7\xE7\x43\x90\x56\xF3\xED\x83\x20\xAD\x60\x27\x91\x3E"
+    "\xAC\x41\xC3\xCC\xAB\x4B\x54\x21\xB9\x45\x39\x58\xFA\xCA\x07\x0D"
+    "\x34\x56\x37\xA5\x26\xBC\xA6\xE0\x47\x83\xEB\x74\x38\xB2\x80\x67"
+    "\xBE\x5E\xB4\x08\x92\xE1\x8C\x0D\x94\x6D\x77\xFA\x94\x0D\x31\xA9"
+    "\xBA\xEA\x4D\xD4\x99\x10\x37\x08\xBF\x8A\x09\x51\xDA\x79\x61\xBB"
+    "\xE3\xB9\x93\xC1\x4C\x52\x93\x87\x29\x4D\x1E\x9C\x6A\x6A\x6D\xF3"
+    "\x59\x97\xE3\x37\xA5\x4B\x53\x93\x58\xD6\x34\x02\xC5\x7F\xFE\xD9"
+    "\x71\x3D\x0D\x0B\x1B\xC0\xA0\x1F\x5B\x94\xFE\x96\x71\x47\xB2\x2F"
+    "\xB1\xE4\x36\x10\x5A\x3F\xEF\xD3\x8B\xED\x6D\x0B\xD6\xD7\xC9\x6D"
+    "\x1B\xD8\xE5\x1E\x84\x5C\xA4\xA8\x42\x2F\x4E\x5F\x60\x41\x81\xD3"
+    "\x17\xFB\xF4\x42\xE2\x14\xE2\x85\xBF\xE8\xF1\x21\xFE\xA4\x8F\xBA"
+    "\xFD\xAF\x7B\x92\x27\x16\x5C\xBC\x4C\x97\xA3\x80\xB1\x32\x22\xD7"
+    "\xA2\x06\x0A\xB0\x6B\xBF\x95\x57\x5F\x20\xC9\xD4\x94\x2A\xDB\xEC"
+    "\xB0\x98\xD5\xB0\x3B\xA4\x32\xF0\x21\xAC\xF2\x25\x76\x27\x51\x3E"
+    "\x3F\xA7\xF2\xE4\x01\x70\x56\x22\x7B\x13\x8B\x9A\x9B\xBA\x53\x67"
+    "\xCD\x37\xA8\x0A\xB6\x9C\x30\xF5\x84\x76\x24\x99\xED\xB6\x43\xFF"
+    "\x4E\x79\x9F\x49\x5E\xBA\x52\x3D\x18\xEE\x8D\xEA\x61\x43\x5F\x32"
+    "\xFA\xBE\xD6\xA6\x0D\x82\x58\xCC\x70\x09\x72\xAE\x1A\x44\xF8\xFB"
+    "\x9E\x57\x40\x41\xD2\x05\xF2\x73\x67\x4D\xA2\x32\x62\xD4\x4F\xF3"
+    "\xA5\x5D\x83\xD0\xA5\xB1\x50\x32\x87\x34\x2E\xF6\xC8\xA0\x17\xB7"
+    "\x5C\x45\x64\xA9\x49\x8F\xD7\x34\x9F\x20\xF9\xE9\x0F\x1A\xE0\x9A"
+    "\x9E\xE1\x9F\x1B\x1E\x10\xD5\xD4\xD5\xEB\x6E\x3A\x30\xAA\x2E\x75"
+    "\xE8\xAA\x35\x87\xB6\x29\xB6\xCF\x88\xEB\x0B\x1A\x84\x7D\x83\xF7"
+    "\x8E\xEE\xFD\x3D\x51\xB0\xAD\x75\x31\x6E\x68\x87\x51\x75\x95\x10"
+    "\xA6\xB7\xA9\xBF\x0D\x4B\x85\xAE\x77\x47\x34\xF5\x19\xD7\x15\xF2"
+    "\x60\x55\xB0\x82\x82\xA8\xA2\x4B\x3F\x7A\x2D\xBD\x2D\x8A\x25\xB9"
+    "\xF4\x2C\x16\x7A\xC3\xC4\x01\x26\x60\x12\xD7\xAB\xF2\xB8\x04\x95"
+    "\x85\x0A\x23\x04\x0A\xEE\x21\x84\x13\xC6\x0E\xA9\xB2\x25\x6E\x44"
+    "\xE6\xFA\x68\xF9\x18\x44\x20\xC8\xA2\x72\xD1\x16\xAB\xAF\x15\x7B"
+    "\xD1\x56\x04\x74\x20\xD8\x47\xCD\xF2\xD5\x5C\xB7\xC7\xCC\xA8\x5B"
+    "\x45\x79\x81\x05\x9F\x3E\x7B\xF5\x68\x2F\x7B\xA5\x96\xF4\x26\x3F"
+    "\x22\xD6\x5D\xA3\x9D\x9C\x5C\x74\x70\xB1\x83\x91\x88\x5F\x1B\xBC"
+    "\xBF\x58\x8C\xB7\x27\x08\x86\x7F\x7C\xEB\x64\x5E\x17\xEC\x06\x46"
+    "\x0E\x33\xB9\xC2\x6E\xBC\x9D\x9D\x16\xED\x49\xED\xC9\x22\xFE\x88"
+    "\x3B\xC2\x31\xF6\x7B\xE2\xF5\x45\x4F\x00\x74\x20\x34\x04\xDB\xCF"
+    "\x5E\xBF\xB9\xA7\xDD\x8F\x32\x74\x78\x25\xAE\x58\x1F\x9F\x64\x45"
+    "\x6E\xAF\xA1\x4E\xB2\x7C\xB9\x5C\x5C\x28\x88\xCA\xC8\xDF\x9C\x68"
+    "\xD2\x91\xB7\x83\xE1\xB8\x78\xB3\xF8\xC3\x53\xFB\x31\x3A\x90\x95"
+    "\x74\x8D\x00\xFE\xF9\x82\x86\x48\x87\xDF\x81\x17\xE8\xEA\x1F\x33"
+    "\x82\xB5\xE6\x46\xEC\x3E\x55\x79\x5D\xBE\xF1\x5D\x7B\xFC\x96\xC7"
+    "\xAA\x46\xD4\xD8\x64\x06\x0F\xFB\x61\x4A\x6E\xB0\x68\x69\x00\x42"
+    "\x82\xF1\x3E\x9C\x28\x72\x54\xAE\x9A\x96\xAF\xF2\x22\xD3\x68\xDC"
+    "\xE9\x26\x39\x7E\x67\xC6\x14\x83\xC7\x75\xBF\xC6\x6A\x5F\x43\x21"
+    "\x31\x8A\x1A\x37\x21\xBF\xF0\x83\xEC\x14\x13\x88\x82\xF3\x28\xF2"
+    "\x4C\x4B\x75\xF2\x11\xF6\x8C\x5C\xA3\xA9\x28\xEF\x78\x5D\xDA\x50"
+    "\xE5\x66\x49\xA7\x29\x1C\xED\x07\xC6\x23\x34\xB1\xF9\x7D\xC6\x59"
+    "\xE1\xF7\xB6\xE9\xED\x2E\x30\xFD\xE6\x9D\x25\xFE\x19\xD6\x55\xF6"
+    "\x36\xBD\x7A\x6F\x09\x85\x8E\xA6\x26\xFC\x35\x4A\x1F\xCF\xC4\x72"
+    "\x54\xA0\xA1\x37\x69\x68\x31\xDB\x31\x2E\x77\xB6\x82\xF9\x06\xA2"
+    "\x09\xF7\x59\x74\x29\xA1\x59\xC2\x10\x73\xD4\x9F\x7A\xDD\xBA\xEA"
+    "\x31\x55\xC1\x03\xA4\x57\xFC\x75\xBC\x5E\x2D\x26\xBA\xE8\x13\x9C"
+    "\xE3\x18\xB5\x44\xDE\x89\x9F\x97\x73\x2C\xFB\x6C\xDD\xDA\x1B\x0D"
+    "\x92\xB7\x51\xCE\x3E\x87\x81\x01\xF5\x67\x6C\x6D\xE3\x80\x45\xBD"
+    "\x40\xB5\x7F\x55\xFC\x13\x64\x56\xC8\x80\xAA\x49\x80\xD9\x14\xAD"
+    "\x46\x26\x6D\x5B\x77\xB0\x08\x55\x46\x6E\x65\x6C\x35\x90\xAD\x17"
+    "\xEC\xAC\x4F\xED\xCC\xF1\xF0\x71\xCB\xB9\x60\x27\xFA\x2C\x4F\x2F"
+    "\x89\x3C\x48\x93\x6D\x07\xFC\x14\xB5\x3F\xB7\x77\x44\xE3\x98\xB0"
+    "\x80\xF1\x7B\x60\x7C\x49\x75\x2F\xF1\xDA\x3E\xEE\x9B\xD6\xCB\xF0"
+    "\xC4\x00\x0B\x6B\x02\xA8\xF2\x91\x33\x02\xBA\xCC\x67\xA9\x90\x3A"
+    "\x5E\x93\x67\x00\x5B\xCC\x1F\xC7\x75\x3D\xBF\x9D\x6D\x4D\x0C\x67"
+    "\x24\x4E\x62\xD4\x90\x8D\x3B\x8A\x79\x47\x25\x1E\x91\xD8\xDF\xCF"
+    "\x52\xA9\x58\x05\x7E\x7F\x09\x14\xD9\xB4\x47\x48\x62\xA5\xC8\x71"
+    "\x32\x9A\x4F\x68\x8C\xC9\x92\xB7\xA0\x33\x03\x58\xE8\x96\xE4\xC8"
+    "\xC6\xAC\x6F\xF9\x28\x4A\x3C\x49\x3B\x66\xDD\xB0\x7F\xA6\x15\x86"
+    "\x68\xBD\xA1\x5D\x3A\x11\xAF\x31\xA2\x2E\x3D\x94\x69\x72\x3B\x66"
+    "\x3A\xCD\xBE\xC9\x4F\x8B\x65\x3E\xCF\x7E\x48\x1A\x50\xED\x34\x55"
+    "\x65\xA3\x21\xC2\xD4\xBA\x4A\xBA\x0D\xA8\x08\xC7\x5C\x94\x9D\xB1"
+    "\xB9\x63\xBA\xA4\x8E\x4B\x56\xF1\x59\x98\x2E\x99\x0C\xE1\xA3\x0A"
+    "\x62\xE3\xCF\xA1\xDC\x58\x57\x08\x67\xAF\x05\x8A\x4A\x81\xB3\x5C"
+    "\x18\x7C\x60\xBB\x68\x5A\xE4\x35\xDB\xE7\x86\xD8\x12\xEF\x55\x49"
+    "\x2D\xF3\x16\x15\x55\x01\x20\xE8\xAA\xC1\x72\xEF\xA1\x26\x30\x9B"
+    "\x9A\x8E\x74\x4C\x28\x2E\xC0\x8B\xBF\xAA\xD7\x3F\x37\x6E\x85\x7F"
+    "\x29\x81\x69\x20\x6A\x43\x76\x30\xC2\x4F\x68\x77\x73\xB8\x6E\x5B"
+    "\x1D\x49\x0E\x07\x7A\x77\xBA\x8B\x3A\xD4\x5D\xFE\x87\x35\x50\x6D"
+    "\x51\xE3\x7A\xFA\x5F\xDF\xB2\xC6\x90\xFE\xCE\x3B\x1F\x1D\x5C\x0A"
+    "\xC1\x21\xCB\x00\xBC\x54\x3D\x3E\xF3\x52\x3B\x2B\xBE\xEF\x6E\xCC"
+    "\x2E\xD9\x98\x5F\xE0\x5D\xE7\x43\xB2\x44\x14\xD5\x7C\x3B\x05\xA9"
+    "\x40\x5F\x70\x86\x83\x4E\xF3\x04\x65\x0E\x33\x60\x8C\x4F\x0A\xC4"
+    "\x17\xFB\xDC\x86\x05\x12\x98\x51\x4B\xD5\x63\x8A\x13\x47\xCD\x03"
+    "\x25\x0C\x40\xB6\x7F\x51\x5D\x8F\xB5\x61\xE3\xF7\x15\xD1\x80\x36"
+    "\x0D\x63\x87\x1E\xAA\x93\x85\xEB\xB1\x2D\x76\x43\xA2\xF4\xF0\xDD"
+    "\x94\x07\x83\x91\xBD\x6A\x6D\xEC\xE1\xF0\xDD\x18\x31\xD3\x1D\xF1"
+    "\x27\xED\x96\xB9\x17\x5B\x4D\x8C\x9F\x64\x59\x0C\xF4\x23\xC6\x9B"
+    "\xE9\x1B\x83\xAB\xB8\x59\x52\xE7\x53\x1E\xCF\x1D\x35\x8E\xB0\x39"
+    "\xA3\x3F\xBA\xF9\xBC\xE2\xC8\x84\x06\xAD\x9D\xBB\x57\xE6\x73\x04"
+    "\xE4\x71\x39\x41\xFB\x37\x62\x73\x8C\x34\xC6\x4C\x2E\x88\xD1\xCB"
+    "\xE2\xA6\xEC\x6F\x98\xC1\xB1\x0F\x5B\x51\x36\xBA\x0E\x7B\x8F\x2D"
+    "\x1D\x81\x9D\x61\x19\xBA\x93\x7D\xBE\xBD\x31\xA3\xE3\x21\x13\x1F"
+    "\x27\x65\x46\xA0\xF0\x82\x9D\x9F\xF3\x3B\xBA\x3A\x8D\xFA\x2A\xAE"
+    "\x89\x14\xB8\x8F\xF5\x57\xBB\x6C\x1B\xEE\x7F\x45\x46\x8B\x39\x47"
+    "\xCB\x34\x77\xB3\x14\x78\x75\x8F\xAB\xC1\x20\xBE\x79\xA3\x0C\x1C"
+    "\xAA\x2C\x3E\xC0\x1E\x04\xF6\x2F\x8D\x86\xA5\x6C\x20\xB4\x27\x87"
+    "\xFF\x1E\xAF\x79\x9B\xAA\xA3\x07\x52\xF0\x2F\x0A\xD2\x61\xED\x2A"
+    "\x40\x6B\xB2\xA5\x1C\x5E\x68\x20\xF3\x62\x56\x92\xB9\x83\xED\x10"
+    "\x0A\x13\xBA\x97\x86\x81\x57\xF3\x56\xA1\x00\x10\x2F\x84\xF7\x99"
+    "\x46\x3D\x35\xAD\xD5\xB1\xD2\x31\x6B\x23\xE4\x9D\xA7\x07\x47\x05"
+    "\x97\xD5\xEA\x0F\x7C\xA6\xE8\x52\xD4\x0B\xFB\xAE\x71\x6E\xAE\x55"
+    "\xF9\xBB\xF2\x38\x6F\xEB\xD5\xF4\xB8\x68\x95\x7E\xD5\x8C\xFD\xA9"
+    "\xFC\x9A\x5B\x7D\x43\x03\xF3\xEC\xE8\xB1\x1E\x16\x6A\x54\xAB\x5C"
+    "\x8A\x88\x9A\xA6\x24\xBF\x28\x40\x1A\xE0\x31\x36\x6D\x96\xEA\xC8"
+    "\x86\x3A\x9F\x6C\x47\x31\x83\x68\x2A\xD9\x8E\xE6\x9B\xC1\x4D\x29"
+    "\x1E\x7E\x8F\x7D\xD9\x33\x4D\x4E\x34\x20\xFB\x4A\x1F\xBE\x11\x37"
+    "\xE2\xC0\xE9\xA6\x2C\x17\x42\x13\xCD\x12\x06\xFA\xA8\x84\x07\xDD"
+    "\xC2\x26\x3F\x1C\x20\x97\xA6\xA2\x21\xFB\xF6\xDE\x55\x60\x1B\xE3"
+    "\xBE\xD0\x91\x70\x22\x29\xE8\x93\x6B\xC1\x94\x0B\x12\x02\x25\x22"
+    "\x25\x05\xB0\x52\x9E\x49\x62\x58\x0D\x7A\xE2\xB0\xF1\xC4\xA3\xC4"
+    "\x24\x24\x83\x6F\xC4\x20\x6F\x68\xC7\x33\x09\x7F\x6A\x60\xDF\xB8"
+    "\xE1\x49\xEC\xF0\x5A\xCD\xFC\xD2\xBB\xEF\x2E\xB5\xF4\xB1\xA7\x73"
+    "\x63\xE4\x8D\x68\x9C\x98\xA8\xB2\x2D\x3B\x16\x31\xB3\x69\x85\x39"
+    "\xA2\x5E\xC7\xD4\x7F\x97\x30\x03\x36\x01\x16\x37\xAC\xFA\x58\x19"
+    "\x60\x5C\x30\xD1\x0D\x01\xFE\x38\x36\x23\x16\x76\xB4\x7B\x7A\xF3"
+    "\xDA\xC0\x7B\xD3\xAB\xED\xA7\x7A\x13\x0C\xEB\x46\x1D\xE2\xDA\xBA"
+    "\x4B\x01\xAC\x9E\x5E\xA9\xF2\x6E\xC7\xD4\xCB\xD7\x02\x74\x7F\xEF"
+    "\xA2\x31\xA3\xF4\x55\x6F\x6C\xCB\xAC\x7B\x16\xF7\xA8\x2F\x9D\x3F"
+    "\x3D\x46\x7B\xC1\x8C\x99\x38\xA5\x8D\x36\xC3\x25\xCD\xA3\x5B\x4A"
+    "\xA8\xF6\x5C\x4E\xBC\x70\xC2\x7E\x7A\xFB\x5B\x8A\xFA\xE9\xBD\x8B"
+    "\x05\xFD\x74\x9C\xD6\x74\xD4\xCF\x27\xF6\xC6\x3E\x59\x2E\xB7\xA6"
+    "\x77\x94\x93\xE9\xC1\xE1\xBA\x99\xFE\xB3\xD9\x12\x85\x15\x74\x53"
+    "\x52\x0F\x87\x5B\x2A\x12\x48\x74\x2B\x12\x48\x54\x56\xA1\x08\x0E"
+    "\xF8\xFE\x55\x5D\x2F\x2C\x26\x18\x9F\x87\xCB\x1F\xB4\xF8\x21\x52"
+    "\xEB\xC7\x72\x0E\xEB\x60\xA4\xDA\x19\x7D\x10\xF5\xA2\x5E\x60\xDA"
+    "\x98\x41\x21\xFB\x6C\x38\xCE\xD0\x27\x8C\x1C\xF7\xFC\xB8\xA7\xB9"
+    "\xA6\x88\x1B\xCC\xD3\x77\x0D\xE1\x9B\x84\x36\xA6\x17\x86\x45\x5D"
+    "\xA1\x69\x5C\x3B\xBD\x85\x45\x9B\x86\x0F\x49\x14\x7C\x8A\x08\x8A"
+    "\x31\x1D\xE8\xDC\x84\xE6\xA8\x16\x61\xFC\x32\x03\x38\xEB\x01\xF0"
+    "\x90\xF5\x9E\x55\x45\x04\x1E\x6A\xAA\x6D\xBB\x50\x6A\xC0\xE6\x50"
+    "\x5F\x9D\xD5\x11\xA8\xB0\xE6\x16\x54\x76\x23\xA8\x0A\x4B\xA5\xF6"
+    "\xF7\xA0\xAA\x4E\xCB\xD1\x61\xBB\x0F\x26\xE0\x98\x82\xE9\x22\xAA"
+    "\x61\x36\xFD\x30\x01\xCF\xFF\xAF\x58\xC5\xFA\x4E\x90\xFE\x05\xDF"
+    "\x14\x38\xB5\xA1\xEA\xC7\xF1\x46\xE1\x29\xFC\x52\xFD\xF6\x81\x0E"
+    "\xA5\xE3\x8D\xC3\x04\x3C\xBF\x5E\x94\xCB\x14\xB8\x23\xF8\x86\xA7"
+    "\x1A\xEF\x0A\xDC\xA8\x90\x5F\xCF\x61\x7D\x3E\x04\xD3\x1B\x81\xFA"
+    "\xBE\x3E\x44\x6B\xE9\xA5\x8C\x70\xC2\x3F\x74\xED\x79\xFC\x74\x4F"
+    "\x08\x52\xF7\xA4\x22\x2A\x21\xC6\x7A\x89\x51\x02\x81\x1F\xFD\x49"
+    "\xEF\xBE\xD5\x53\x37\x7C\x8B\x53\x4F\xBF\x75\xA6\x8E\x7C\x69\x78"
+    "\xDF\x2B\x49\xCC\xE6\x15\x0C\xDE\xE9\xC1\xF1\xCA\xD9\x77\xF2\x62"
+    "\xD3\x2D\x7B\xE8\x72\x10\x2C\x4C\xEE\xE9\xAB\xFA\xC7\x08\x33\x73"
+    "\x56\x24\xBF\xFB\x2A\x9B\x31\x2A\x07\x60\x28\x9E\x9B\x8C\x72\x21"
+    "\xEA\x1F\x28\x05\xEF\xA5\xD2\x40\x9D\x55\x6A\x6C\x57\x77\x19\x56"
+    "\x4F\x60\x46\x32\xCB\x82\x16\xE0\xF1\xA7\x60\x63\xAE\x0D\x56\x64"
+    "\xB9\xF2\x6B\x66\xC6\x37\x7B\x76\x4F\x67\x2D\xCE\x22\x68\x36\x5E"
+    "\xBE\x6F\xBA\x63\x4D\x6A\x0F\x32\xFA\x01\xFB\x52\xBC\x05\x05\x16"
+    "\xF4\xD3\xAA\x96\xF0\x30\xDE\xB5\x6E\xC7\xC7\xF1\x31\x6F\xC6\x18"
+    "\x4B\xC4\x51\xB9\xF5\x4A\x24\xD5\x2B\xF4\x18\x58\x15\x7C\x28\xAE"
+    "\x5F\x71\x60\x51\xDE\xB6\xC2\xBB\x3A\xDC\x8F\x3E\x17\xFB\xD1\x21"
+    "\x9D\x89\xF7\x46\xD3\x5D\x76\x65\xEA\xF7\xE5\xFE\xB9\x25\x77\xB4"
+    "\x2F\xA6\x23\x74\xA6\x78\x4E\xC0\xD6\x15\x5B\x27\xA8\x5B\xAA\x19"
+    "\x03\x98\x45\x04\xDE\x65\xDA\xB9\x3B\xB1\xD8\x2A\x38\x62\xBF\xAE"
+    "\x0B\x5A\x44\x91\x18\x92\x0F\x26\x1E\xC5\x39\x54\x8D\x45\x3C\x69"
+    "\x04\xEA\xE4\xB4\x9C\x42\xF0\x43\x1F\x30\x0D\x51\x04\x41\x9B\x80"
+    "\x84\x4D\x32\x55\x80\xA9\x03\x0A\x26\xB6\x00\x94\xE8\x2B\x8B\x4A"
+    "\x8C\x72\xAA\x58\x8C\x22\x69\xAA\x45\xD8\x07\x47\x42\x66\x0F\x77"
+    "\xB0\x13\x0E\x32\xB7\xA8\x73\x40\x56\xF9\xC1\x78\x7B\x50\x67\x25"
+    "\xF7\x21\xA1\x74\xD9\xE3\xA3\x5A\xE2\x54\xE5\xB3\xA9\xDC\x33\x01"
+    "\x0A\xCB\x6D\xB1\x62\x6B\xEF\x4C\xE5\x82\x52\xE5\xA0\xF7\xE6\x0B"
+    "\x51\xC0\x6F\x02\x05\x1D\xE2\x7A\xF7\x2F\x6A\xC6\x3A\xD8\x7A\xBB"
+    "\x70\x5A\xD1\x40\x71\xCB\x35\x4D\x62\xD0\xBE\x2F\xDF\x15\x57\x87"
+    "\x98\x2D\xD0\x56\xCB\x01\xC7\x1C\xE8\x20\x6C\xAF\x38\x4E\x5A\xB1"
+    "\xF1\xC1\x6D\x34\x4E\x8E\x76\xE4\x43\xFA\xD0\xE3\xA4\x16\xA4\x1B"
+    "\x1A\x27\x05\xED\x46\xC6\x69\xBE\xCC\xB5\x84\xC5\x43\x53\xB9\x71"
+    "\x3C\x10\x3C\x81\xAB\x0D\xEA\x6A\xBC\x57\xF1\xB5\x00\xFC\x39\x8B"
+    "\xD3\x24\x1B\x89\xCA\x23\xF7\x11\xF1\x86\x57\xA6\xE6\x5D\x1C\xBF"
+    "\x5D\xF5\x1F\x10\x59\x9F\x8B\x6F\xEE\x22\xEF\x7A\xB9\x1D\x08\x5A"
+    "\x5C\x0D\x3F\x55\x79\xE4\x3E\x5E\x01\x3F\x55\x73\xDB\x0F\xEA\x66"
+    "\xD7\x13\xDA\xE0\x8F\xC3\xE3\x5B\x23\xDA\xF6\x5D\x0C\x71\x29\x22"
+    "\xFE\xC6\xBB\xCB\x5C\x44\xDE\x57\xD4\x36\x71\x53\x5D\x5D\x83\x71"
+    "\xD6\xAC\x14\x40\x57\xA8\x8F\xB6\x5F\x6B\x28\x6F\xB2\x3D\x07\xC0"
+    "\xCE\x5D\xC7\x9E\x20\xBB\xA5\x46\x25\x1A\xE4\x2B\xD1\xAC\x62\x01"
+    "\x7B\x6D\x28\x05\x94\xCB\x6F\x0E\x99\x9E\xFA\xC1\xE3\x64\xBF\x02"
+    "\x74\xAC\xD6\x0F\x1C\xD9\xE0\x0A\xC0\x89\x0D\xBB\x81\x03\x8F\x6D"
+    "\x0A\x18\xAA\xF4\x03\xBD\x12\xB5\x75\xBD\x7E\xF0\x57\xA1\xB6\xAA"
+    "\xD6\x0F\xFC\x2A\xD4\xD6\x93\xDE\x05\x8E\xAA\xBE\xAE\xC4\x5B\xFC"
+    "\x68\x66\x11\x35\x5C\x7D\x45\xA0\x8D\x01\x50\x5E\xE1\xA6\xB2\x0B"
+    "\x46\x77\x01\xC5\x93\x9D\x10\xC2\x02\x2E\x29\x3B\x12\x78\xF4\xC6"
+    "\x2B\xF7\xC9\xD5\x91\x1F\xC3\xD9\x14\xFA\x4E\x45\x3E\x4D\x7B\xE1"
+    "\xA8\xA9\xE6\x59\x4B\x7D\xBA\x0F\x02\x03\x15\x22\x60\xEC\xD8\x74"
+    "\x00\x91\xC2\x2A\x8E\xCA\x30\x18\x7A\x2A\x25\xC8\xA2\x46\xB0\x1F"
+    "\x11\x2C\x18\xC7\x63\x18\x08\x55\xD0\x47\x43\x6A\x01\x53\xC9\x2E"
+    "\xF7\xC2\x62\x6A\x6A\x25\x8A\x6D\x10\x5A\xBA\x23\xA9\x89\x08\x47"
+    "\x1F\xDC\x50\xDD\x20\x8D\xC9\xC8\x3B\xFE\xDE\x94\xD9\x63\x09\x4A"
+    "\x62\xCC\x1C\xC9\x72\x12\x63\xD6\x8E\x62\x49\x41\x11\xE7\xB6\x1E"
+    "\xC4\xE2\x12\x23\xCE\x30\x29\x50\x0E\x4B\xC8\xA1\x4A\x73\x84\x2C"
+    "\x75\x25\x8E\x08\x72\x1B\x05\x32\xFF\xF6\x6D\x67\x8C\x1C\x30\xD6"
+    "\xBE\xA2\xD2\x0B\x2D\x54\x96\x02\xB3\xD9\x50\x71\x3A\x33\x0A\xE5"
+    "\xED\xD8\x6E\x62\x79\x63\x5C\xDC\x3A\xB2\xBE\x5C\x2B\xB9\x0A\x45"
+    "\x6D\xC2\x6F\x8C\x24\x5D\x64\xA2\x33\x67\xDF\xE1\xD0\xA9\x45\x17"
+    "\x82\x3A\x83\xF4\xE0\xD5\xF1\xC6\x24\x54\xC8\x0E\xD7\x04\xF4\x18"
+    "\x83\x53\xBC\x33\xEE\xEE\x36\xC5\xAA\xA6\x55\x00\x27\x9A\xF8\x64"
+    "\xA4\x90\x32\x26\x8F\x51\x34\x49\x42\x6F\x7D\xBC\xBB\xD1\x0D\x22"
+    "\x19\x9D\xC4\xA5\x1B\x5D\xCD\xA7\x7E\xD5\xEB\x15\x80\x79\x57\x34"
+    "\x41\x0D\x15\x56\x3C\x4C\x61\x13\xE9\xCC\x41\x5D\x29\xF3\xDD\x03"
+    "\xFD\x96\x2A\x45\x3A\xD8\x07\xD6\xEB\xA3\x85\xFC\x50\x7C\x88\x01"
+    "\xF7\xE2\x43\xEA\xD3\x5D\xC3\xFC\xB1\x51\x77\x0A\x44\x70\x62\xFE"
+    "\xB2\x68\x40\xD9\x07\x7C\x77\xAE\x33\xA8\x07\xB6\xED\x08\xBD\x58"
+    "\xDB\x4E\x81\x9E\xB6\xD5\x72\xB6\x49\xDB\x46\x92\xA6\xDA\x36\x05"
+    "\x06\xB4\x0D\x65\x53\x6D\xA7\x3A\x4E\xEB\x66\xBA\xDB\xF8\x79\x58"
+    "\xA7\xB1\xE4\x86\x1D\xEF\x6A\x5B\x7D\x1E\xD6\xE9\xAE\xB6\xD3\xE2"
+    "\xDF\x97\x7D\x1D\x5A\x41\xBA\xE8\xA5\x34\x24\x2A\x7F\x30\xB2\x20"
+    "\x49\xA3\x0F\x86\xB8\x4A\xE7\xA2\x41\xEE\x5E\x7C\x9C\x64\x3E\xD7"
+    "\x4A\x9A\xD3\x2F\x9D\xE3\x79\x67\xF0\xA2\xD9\x26\x32\xD0\x24\x4A"
+    "\x88\x24\xE6\xB9\x11\xA1\xD6\x05\xF9\x17\x94\x6B\x51\xB4\x3E\x9E"
+    "\x68\xEB\x6D\xFE\xC3\x4A\xB7\x41\xCD\x7F\x20\x01\x37\xB4\xEB\x1F"
+    "\x48\xC6\x0D\xED\xFA\x55\xC5\x9C\x23\x0D\x3A\xA5\x9C\x57\xD2\x57"
+    "\xE9\x28\xC3\x55\x20\xDD\xF0\xD7\x99\x29\x4A\x0B\xB8\xAB\xAA\xCF"
+    "\x57\xCD\x6D\x48\x2E\x6F\xE9\x24\x52\xD1\x0C\x50\x7D\x09\xA0\x12"
+    "\xD9\x94\x28\xC1\xD3\x87\xC8\xEF\xD4\x97\xDE\xA9\x2B\xBB\xD3\x35"
+    "\xF1\xE9\x4D\xB2\xD5\x9B\x63\x6B\x48\x7A\x28\x95\xF9\xC6\xF5\x78"
+    "\x14\x08\x1F\x14\x15\xD5\x15\x27\xF9\x0C\x2C\x34\x29\x77\xE4\x1A"
+    "\xD3\x2C\xC8\x5E\x06\x4D\x78\x80\x88\xC7\x83\x8C\x89\xF6\x82\x96"
+    "\x10\x6C\x42\x21\xB3\x58\x47\xD3\x09\x75\xE4\x06\x4A\xAF\xAB\xDD"
+    "\x89\x81\x92\x93\x27\x91\xEB\xC8\x23\xA4\xA4\x74\xCC\x1D\x20\xB8"
+    "\xC2\x64\x0E\x91\x13\xAE\xCE\xB2\x5F\x7C\x0E\xA0\x5C\xB5\x2D\xAC"
+    "\xC0\x81\xD5\x15\x39\x09\x77\x39\xFD\x0B\x0E\x1E\x26\xD9\x6B\x69"
+    "\xB5\x9F\x38\x56\xE5\x37\xF0\xF5\x8D\xC4\xC9\xB5\x9F\x36\x71\x43"
+    "\xFB\x44\xC7\x65\x22\xAF\x4D\xED\xB0\x0A\x53\x2C\xFB\x9B\xFC\xF2"
+    "\x7A\xF7\x4D\xB6\x97\xED\x4A\x6E\xEC\x80\x6E\x0C\xCB\x29\xE8\x9F"
+    "\x7B\xD0\xEF\x6A\xE8\x16\xBC\x14\xC7\x96\x99\xD8\x4B\x42\xA2\x21"
+    "\x05\x7C\xA2\x5C\xC0\x1F\xA9\x89\x14\x9B\x95\xEE\xA1\x38\xF0\xAF"
+    "\x4E\xA1\x91\xA3\x8E\x7B\xAC\x27\x89\xC8\x0F\xA3\x8A\x42\xB9\xAA"
+    "\xE0\x10\x07\x2A\xF9\x21\x45\x42\x58\x97\xD6\xAD\x27\x6C\xC2\x43"
+    "\xED\x49\x51\xAD\x5D\xE5\x49\xA5\x00\x49\x8B\x05\x2E\x86\x57\xF0"
+    "\x13\xF5\xD2\x3D\xCB\xDF\xE5\xE5\x82\x02\xDE\xD1\x99\x3D\x27\x0A"
+    "\xE1\x55\x56\x05\x6C\x59\x15\xEA\xDE\x02\x07\xA6\x6A\xC8\x49\xA0"
+    "\x89\x41\xD4\xF1\xF3\xA8\x55\x3A\x18\x53\x7F\x13\xF7\x72\x6D\x57"
+    "\x2F\xB3\xE7\x8B\xA3\xB0\x93\xAE\x63\xE6\x54\xC1\xE2\x8A\x44\xA4"
+    "\xC4\xC9\xE5\x68\x92\x79\x8D\x0C\x83\x8C\x76\xB8\x14\x4C\xCD\xDA"
+    "\xC2\xAE\x37\x14\xEC\x03\x94\xB9\x29\xB8\x74\x5A\x32\x91\xEA\x58"
+    "\x64\xB0\x25\xBB\x2B\xA0\xCE\x42\x10\xB0\x85\x4F\x6F\xA3\x67\xDA"
+    "\xF3\xD2\xD1\xC4\x0E\xD4\xCF\x3F\xDF\x0C\xED\x19\xAC\xD7\xE0\x35"
+    "\x69\x2F\xC4\x8A\x30\x97\x5E\x9F\xF6\xFA\xA4\x6A\x22\x75\xD1\x04"
+    "\xED\xB5\x48\x8A\xD1\x5E\xC9\x9A\x4E\x61\x43\x04\xE3\x35\xF7\x91"
+    "\x0E\x64\xF0\x2B\x91\x3D\x14\xC5\xC3\xA4\x79\x74\xC4\x3B\xC5\x5E"
+    "\x85\xF6\xCC\xB1\x33\x79\x16\x71\x90\xF4\x40\xDF\x77\x7A\x17\x37"
+    "\x5D\x46\x5E\xA9\x8C\x51\xE4\x75\xC4\xD2\x45\xDD\xC0\x3E\x5C\x97"
+    "\x0B\xE5\xEA\xED\x7A\x23\x75\x80\x3B\x20\x60\x9A\xED\x5D\x84\xC2"
+    "\xCD\x30\xCB\x2A\x76\x7E\xF3\x4F\xF0\x31\xA6\x75\xE9\x9D\xB9\xAB"
+    "\xCE\xA7\x00\xE9\x6B\x46\x43\x40\x99\xE3\xFB\x10\xD8\x81\x0A\xFA"
+    "\x49\x78\xE9\xB5\x13\x15\x5D\x05\x5F\x5F\x02\x8F\xDC\xEE\xC7\x51"
+    "\x70\xAA\x7D\x19\x86\xDF\xD0\xBF\xD8\x3D\x0B\x59\xB7\xEF\x6E\x85"
+    "\xED\xB7\x1A\xB5\x7D\x1B\x65\x87\x17\x0B\x45\xF8\xF1\x88\x0B\xC4"
+    "\xFA\xAA\x7F\x5C\x62\xDA\xF2\x29\x08\xA1\x91\xBC\x96\x21\xCA\xAB"
+    "\x50\x72\x9A\x32\x9D\x55\x1C\x66\x98\x52\xC4\x83\xF9\x83\x13\x60"
+    "\xB1\x71\xED\x87\x70\x96\xBF\x78\xB8\x6F\x17\x58\x10\x15\x76\xA4"
+    "\x63\xC0\x46\xE3\x64\x77\xC5\xE5\x4E\x01\xC6\xB0\xB6\x0E\xD4\x10"
+    "\x6C\xF0\x66\x50\x60\x38\x7F\x07\xE1\xA6\x4C\xED\x14\x69\x56\xE3"
+    "\xF8\x0D\xCB\x35\xEB\x9F\x13\x33\xF6\xF5\x8A\xB4\x1E\x3F\x20\x67"
+    "\xEA\xC7\x5C\x81\xE2\xE3\xAE\xF9\x5A\xD7\x88\x07\xF2\x50\x94\x20"
+    "\x7F\x30\xEB\x56\x6A\x70\xE9\x48\xBF\xDE\xA5\xC3\x93\x73\xE7\x68"
+    "\x12\xE5\xCE\x6E\x8F\xA5\x38\xF4\xC0\x73\x09\x7D\x4F\x3B\xDC\x96"
+    "\xF4\x6F\x37\x42\xA5\x9B\xE2\x68\x71\xA5\xF8\x11\xB3\xB4\x4A\xD6"
+    "\x60\xAE\x87\x6C\x35\xE6\x9C\x4E\xAB\xBC\x1C\xCD\xF0\xC2\x51\x8F"
+    "\x93\x57\xE9\x3F\xBD\xB4\x2E\xF2\x30\x28\x91\xCF\xFA\x32\x00\xDF"
+    "\x89\x8E\x14\x60\xBC\xCC\x07\x7D\xBB\x5D\x79\x37\xDE\x33\x41\x42"
+    "\xB5\x0A\x27\x42\x83\x56\xB5\x9A\x10\xFE\xC5\xCA\x98\x72\xE8\x4D"
+    "\x5E\x07\xAF\xC1\x73\xB9\x08\xC8\x08\x14\x54\x0B\x03\x05\xA2\x8A"
+    "\x54\x1B\x34\x3F\x2D\x4B\x5E\x6D\x82\x0E\xD4\x39\x9A\x8F\xAC\x74"
+    "\x98\x6E\x75\x8B\x0C\xD1\xFB\x10\x92\xB6\xB1\x32\x9C\x0D\x97\x7A"
+    "\x53\xF1\x17\x5C\xE7\x7F\x22\xD1\xF5\xC9\xFB\xF2\xB2\x23\xDF\x86"
+    "\xBF\xD4\xFF\xDB\xAC\xF0\xFD\x78\xC6\x17\x8D\x34\x3B\x39\x53\x3B"
+    "\xA6\x43\x0C\x0E\x25\x2B\x0A\x77\x2A\x0C\xBC\x44\x3D\x08\x2C\x6B"
+    "\x1F\xD6\x28\xE7\x8A\x26\xA3\x30\x14\xF6\xCE\x22\xDD\xC1\xA1\x4B"
+    "\x19\x55\x71\x16\x0B\xEE\x94\x36\x6D\x1C\x5B\x24\x43\xCC\xEF\x79"
+    "\x85\xF5\xDE\x42\x57\x42\xC3\xE0\xF8\x18\x53\x0A\x1C\x4F\x4B\x79"
+    "\x84\xE1\xEF\x20\xA2\x15\xBC\xB8\x77\xF6\xBA\x76\xA2\x82\x30\xBE"
+    "\x0D\xB1\x0F\x3A\xBB\x9C\x09\xE3\x3E\xC0\xF0\xE7\xED\x68\x26\xBA"
+    "\x17\xC3\xAB\x92\x46\xC0\x97\xF9\xD3\xC3\x08\x0B\xEE\x7C\x81\xA1"
+    "\x34\x9A\x42\xDD\x0B\xD2\x0E\x34\xE8\x19\x6F\x6D\x58\x14\x04\xC0"
+    "\xD3\x1D\xE7\x75\xB5\xA5\xE2\x79\x62\x88\x5B\xA3\x56\xE9\x15\xDF"
+    "\x46\x8F\x84\xCF\xD3\x18\x02\xE5\x51\xEF\xC6\xCA\x5B\x19\x28\x4D"
+    "\x14\xA2\x49\xB1\xDD\x8D\x91\xDD\x41\x13\x16\xEA\xAA\xC8\x4A\x6B"
+    "\x8C\xF7\x21\x18\x7D\x8E\x4F\x23\x28\xF9\x57\xAD\xE2\x82\x2B\xD3"
+    "\x5C\x77\x17\x22\x88\x5D\xCB\x75\xDD\x02\x38\xC9\x95\x7A\x43\x30"
+    "\x6C\x98\x7C\x91\xAE\x54\x03\x50\x69\x6A\x5C\xDD\x11\x5F\xE9\x1D"
+    "\xAD\x0E\xF1\x68\x2B\x50\x19\xB7\x59\xCC\x0B\x2C\x1A\x8D\xAD\x57"
+    "\x29\x3E\x33\x3D\x31\x77\xA2\xD0\xB0\x1D\x4C\xA8\x3E\x30\x42\x3D"
+    "\xCE\x94\x71\x7C\xC3\xDA\x6C\x99\x8C\xA9\xB6\x03\x8D\xF6\xBB\xD3"
+    "\x4D\x2B\xB3\x41\xEE\x0A\xB5\xD2\x4D\xCA\x64\x4A\x91\x95\x6E\xC0"
+    "\x28\xEC\xF8\x11\x3F\x87\x90\xDC\x47\x63\x73\x42\x5F\x99\xC8\x9B"
+    "\x13\xF8\x4A\xC4\x35\xC7\x5A\xFE\x2E\xE5\x47\x9C\xE9\x79\xF4\x52"
+    "\xE2\x24\xB6\xC0\xC1\xD7\xA3\xF2\x38\xFB\xE1\x71\xC7\xFE\x84\xDD"
+    "\xEA\x12\xFB\x84\xD0\xA3\x24\x16\x81\xC4\xAE\xAE\xEE\x8A\x9A\xF6"
+    "\x71\x4C\x6B\x04\xFD\xAB\x85\x37\x8B\x51\x3D\xF0\x67\xF0\x10\x36"
+    "\xD2\x75\xDD\xD5\x51\x11\xBE\x8F\x0A\xE4\xA2\x30\x26\xD2\x39\x3A"
+    "\x4C\x84\x5E\x54\x68\xAA\xA9\xE6\x9E\xCA\xDA\x91\x7D\x80\xA1\xA1"
+    "\xE6\x1C\x1B\xDB\x19\x60\xE9\x86\x63\xB6\x99\x3F\xD8\xA1\xD6\x24"
+    "\x0E\xE3\x52\x66\x26\xD7\xA0\x09\xC1\x1F\xDE\x16\x55\x31\xAD\x60"
+    "\xF9\x39\x2C\x8C\x2B\xC3\xA7\x4E\xAB\xE6\xEC\x07\xE8\x28\xA0\xA0"
+    "\x36\x7E\x6D\xB6\x92\xBE\x44\x71\xCE\xF2\x2C\x45\x14\x46\x6B\xBD"
+    "\xC2\xB0\x15\xA0\xAF\xC5\xFA\xE3\xA0\x2E\x6B\x47\x7B\xA1\x6D\x4D"
+    "\xD1\xD5\x7E\x53\x09\xB6\xA9\xF4\xEA\x9B\x05\x69\x46\x0C\x7C\xB0"
+    "\xBA\x78\xD1\x21\x72\x07\x3B\xFA\xED\x58\x0F\xAB\x10\x7A\x54\xB7"
+    "\xF6\x66\xBF\xCA\x32\xE0\x0C\x41\x8E\xB1\x60\x17\x0B\xD0\xDF\xD0"
+    "\x7B\x19\xC3\x2B\xCF\x57\xF9\x59\x0C\xAC\x93\x29\x31\xC4\xE8\x93"
+    "\xF7\xDC\x93\x36\x5F\x81\xAA\xC2\xBB\x9E\xCB\xED\x9F\x36\x93\x1F"
+    "\x94\xC8\xF4\xB1\xA6\x9E\x03\x6B\xFB\x7A\xE3\xE4\xBA\x88\xFD\x12"
+    "\xF4\xEB\x5F\x16\x07\xF4\x3E\xD1\x33\xEB\x7D\xF6\x6B\xEB\x19\xAF"
+    "\xC2\x57\xEF\x99\xEB\xDB\xF6\x6B\xEB\x9D\x3D\x25\x76\x3A\x46\xAE"
+    "\x3C\x45\xC7\x6C\x0E\xDD\xE6\x7E\x6D\x3D\xB3\x67\xB0\xFD\x3D\x93"
+    "\xCB\x26\x19\xF0\x30\x02\xBE\x67\xB8\xD5\xF6\xBC\xE4\x12\xA5\xCC"
+    "\x25\xDA\x00\x9B\x5A\xA9\x22\x36\x3D\x49\x34\x2F\xF4\xD3\x94\x8A"
+    "\xF3\xD6\xC4\xAB\x94\x18\x1B\x75\xC8\xD7\x7A\x31\xEA\xE8\xEE\x9E"
+    "\xFF\x12\x7F\x91\xD4\x30\xFA\x53\xDC\x19\xAA\xAE\x54\x44\x18\xED"
+    "\xB1\x3C\xC9\xFC\x7C\xC2\x0D\x8C\x2F\x66\x42\x55\x05\x82\x50\x75"
+    "\xB8\xD5\x0E\xFD\x8D\x43\x73\x7D\xDC\xD0\x15\xD3\x89\x08\x83\xB8"
+    "\x19\x2E\x15\x4B\xFC\x32\x8D\x93\xE3\xA9\xBC\x39\x5A\xCE\xF2\x78"
+    "\x6D\xCC\x54\x6A\xAD\xA1\x68\x38\x49\x66\x7F\xA8\xD8\xBA\x31\x37"
+    "\xD7\x7A\xCA\x44\xE0\x9E\x6E\xC3\xA0\xC3\x09\xD6\xF5\x8F\x12\x69"
+    "\xCF\x54\xFE\x92\x48\x68\x1B\xF4\x1A\x8C\x64\x6B\x35\x4E\xA7\x3A"
+    "\x6D\xAB\x79\xE1\xE5\x6F\x75\x0B\x8A\x67\x27\xB3\xAA\x2C\x25\x9E"
+    "\x44\x19\x7B\xF3\x10\x8A\xD8\x07\x51\xC2\xDE\x44\x83\x12\xF6\xC1"
+    "\x69\x47\x5E\x35\xA3\xA6\xE4\x0B\x89\xB9\x72\x7E\x45\xA4\xD5\x9F"
+    "\x32\x8F\xAB\x72\x45\xC5\x3C\xAE\xEA\xCF\xA0\x15\xE5\x18\x6A\x1A"
+    "\x51\xCF\xA2\x9C\x75\x4C\x83\x42\xF6\xC1\xCD\x08\x2B\x7D\xFD\x38"
+    "\x31\xAC\x7C\xE3\x96\x55\x4B\x15\x17\x53\x0F\xD1\x12\xBC\xC1\xDC"
+    "\xF3\x2F\xE6\x47\xCB\x92\x00\xDE\xF3\x2E\xD9\x47\x4B\xD2\xDD\xEB"
+    "\x3D\xEF\xC6\x7C\x58\x12\x17\xE3\x3D\xE1\xA4\x18\x2D\xE1\x61\xE8"
+    "\xC6\x87\xF2\xCA\xBA\x18\x3A\x91\x9F\xBC\x92\x2E\x86\x4E\x2C\x29"
+    "\x2A\x69\xC4\x22\x14\x32\x7F\xC7\xA2\x15\xB2\x2B\x2D\xEE\xC5\x79"
+    "\x92\x7C\x53\xB7\xF5\x37\x75\xBE\x78\x52\xCF\x31\x29\x6C\x66\x12"
+    "\x34\x18\x63\x36\x97\x7B\xFA\xEC\xD5\xC1\x8B\x1F\x9E\x3E\x7D\xFC"
+    "\xF4\x1B\xCC\x9B\x2E\x1E\x47\xF7\x44\xB1\x97\xAF\xEE\xBF\x78\xA5"
+    "\xCA\xE8\xBF\x9D\x02\x02\x46\xAC\xFE\xFD\x07\xDF\x3E\x7E\xF4\xF7"
+    "\x47\x0F\xF1\xBB\xFE\x7B\xE4\x46\xD8\x50\x12\x49\x23\x2C\x05\x3F"
+    "\x2E\xC4\x7B\x12\xD5\x09\x47\xFE\xC9\x9B\xF5\x4A\xEF\x8C\xE8\xD8"
+    "\x48\xA5\xF4\x6C\x96\x78\xFA\x8E\xD9\xCD\x80\x0A\x2B\xBB\x9D\x3F"
+    "\x77\x82\xC2\xF0\x2F\x01\x28\xE7\x8C\x88\x1E\x24\x1B\x8C\xE3\x22"
+    "\x0E\x8A\xCB\x8B\xD8\x52\xCB\x55\x8D\xC1\x17\xCB\x7C\x01\x9B\xBF"
+    "\xD2\x7A\x09\x2C\xEB\xB2\x6A\xBF\xAE\x57\x67\xF9\x6A\x8E\x81\x55"
+    "\xFE\xEB\x2F\xD4\x27\x7A\x8D\x18\xE0\x7B\x0C\xE5\x7C\xB4\xCA\xD5"
+    "\x02\x79\x84\xBB\xEE\x62\x71\x08\x4B\x8A\x81\xD2\x82\x4C\x5E\xA1"
+    "\x0B\xBF\x1B\xDE\x28\xC0\x82\x82\xDF\xAC\x24\x0E\x3A\x32\x2C\xDD"
+    "\x38\x3D\x55\x34\x7F\x3F\x9D\x4E\x9D\x71\xB8\x8C\x04\x19\x19\xBF"
+    "\x2D\x2E\x5C\x1D\x60\xEC\xD4\x99\x9E\xE4\xCD\xB3\xB3\xEA\x39\x74"
+    "\x1C\x54\x86\x0B\x2A\xEE\xAF\xD5\xFA\x2A\x00\x35\xFC\x1A\x4A\xBC"
+    "\xF1\xF5\x03\x51\xCA\xBB\x3F\x7C\xE9\x62\xD4\x30\x46\xCA\x85\xF7"
+    "\xBA\x88\x09\x8C\x80\x1E\x9E\x1E\x79\x19\x6B\x9F\x76\xEA\xEE\x09"
+    "\x51\x17\x39\x19\x82\xD7\x05\xF6\x02\x8E\x5C\x95\x20\x48\x53\x8E"
+    "\xB6\x9A\xEA\x3D\xFB\x10\x53\x99\x10\x8B\xA9\x8E\x20\x2C\x22\xB6"
+    "\x8A\x06\xD2\x77\x09\xCE\x3B\xF0\x39\x4F\xA1\xF2\x3F\x36\xB9\xB1"
+    "\x40\x01\xC3\xD8\x9E\x6F\xD0\xF4\x45\x47\xD3\x17\xA9\xA6\xFF\x31"
+    "\xBE\x88\x34\x7D\x01\x4D\x5F\x6C\xD0\xB4\x99\x4F\x1D\x28\x98\x32"
+    "\x29\x54\x5E\x19\x20\xA6\x68\x04\x35\xF3\x8D\x12\xE2\x39\x20\x07"
+    "\xA1\x2A\x05\x48\x07\xB6\xB2\x58\x0A\xE1\xE7\x12\x94\xAC\x10\x41"
+    "\x5B\x7E\x06\xCC\x43\xF0\x5D\xC8\xCB\x1D\x51\xCD\x51\xAE\x48\xA6"
+    "\xA9\xFD\x5B\x5B\x67\x1C\x37\x32\xBE\xC9\x69\xEB\x67\xF4\x35\xD6"
+    "\x5B\x77\x16\x8F\x08\x1E\xEB\x81\x38\xB3\x5C\xF7\xA0\x11\xAA\x2D"
+    "\xE7\xC1\xDB\x0B\x78\x7B\x11\xBC\x95\x1D\x84\x02\x2E\xD5\xBD\xB2"
+    "\x66\x18\xA1\xA0\xE0\x24\x5B\xCA\xCE\xFF\x4E\x75\x16\x84\x2C\xEB"
+    "\x04\x52\xFD\xA3\x77\x8D\xF3\x8E\x44\x0F\xBC\xA5\x7F\x1D\x25\x57"
+    "\xF4\xDE\x85\xF1\x52\x7F\x52\x7F\x8A\xAF\x44\x15\xB7\xF4\xFF\x70"
+    "\xC9\xFF\x11\x6F\x89\x4A\x6E\xA9\x7F\x70\xA9\x7F\x88\xB7\x1D\x54"
+    "\x73\xEB\x3E\x77\x0B\x7A\x6F\x44\xD9\x28\x6D\x5D\x58\xAF\x44\x11"
+    "\xF9\xE8\x40\x61\x16\x22\x20\xFC\xE7\x44\x4C\x0A\x87\x6F\x6F\x5D"
+    "\x6E\xE3\xB6\xF5\x17\x0A\xD4\xFC\x77\xCE\x77\x0D\x7C\x1F\xA9\xFA"
+    "\xCE\x7C\xBC\x81\x40\xCF\xA2\x83\xB1\xA8\x66\xB6\xA3\xF8\x55\x57"
+    "\xB7\xBA\x85\x07\x83\xE6\x33\xA7\x61\x36\x35\xF9\x78\x47\x45\x95"
+    "\x56\x29\xC5\x31\x58\x8A\x50\x50\x50\xE7\x42\x95\x35\x43\x9D\x35"
+    "\x23\xDB\x47\xD1\x16\xA8\xBA\xB9\x59\xC3\x3F\xBD\xCC\x56\x35\x08"
+    "\x8E\x07\xF5\xE9\x29\xBA\x40\xDD\x0A\x9C\xD8\x1E\xE8\x3B\x74\x91"
+    "\x6F\xFF\xF3\xB8\x5A\xAE\xDB\xC8\x87\x7F\xA4\x3E\x18\x26\x4A\x15"
+    "\x50\x9C\x4A\x5C\xCB\xB9\x49\xC3\x32\xCF\xDE\x72\x68\xF2\x18\xB6"
+    "\x74\xFF\xD2\x7E\x96\x91\x70\x95\x06\x1F\x0B\x85\x2B\x69\xA0\x22"
+    "\xC4\xC9\xAE\xDB\x57\xDC\x63\xFB\xFC\x0F\xEF\xD9\xED\x9F\x7D\x1F"
+    "\x74\x6B\x62\xB2\x7D\xC7\xB9\x44\x3B\xEB\x34\x1A\x82\xEE\xB4\x09"
+    "\x82\x2B\xBB\xEA\x47\xC1\x95\x01\x60\xB6\x4D\x4B\x22\xD8\xBA\x0A"
+    "\x44\xA2\xC2\x6C\x1C\x03\x69\x76\x94\xE9\x4F\x01\x69\x6E\xC9\x5D"
+    "\x8D\x52\xBA\x74\xF0\x5A\x2B\x5B\xCF\x75\x08\x47\xEF\x87\x37\x0E"
+    "\x81\xD6\x5B\x4D\x76\x0E\xD2\xAA\x29\x29\xB3\xAB\xA9\x44\x93\xD1"
+    "\xC4\x6C\x94\x95\xC8\xAB\xF1\x9C\x9D\x26\x68\x56\xAA\x88\xA2\xCE"
+    "\x3E\xA1\xBB\xC1\x0B\xD3\xA0\xD8\x5D\x84\x2D\xEA\xC6\xCA\x23\xA8"
+    "\x91\x6E\x4F\xEE\x08\xA6\x6E\x04\x4C\xCA\x6B\x67\x0B\x84\x55\xBC"
+    "\x46\x45\x8B\x56\x59\x49\xB7\x1C\xDB\xD1\xA8\x96\xF5\x7E\x86\x77"
+    "\x37\xBD\xBB\x1A\x09\x49\x07\x9E\x54\xFB\xA3\x61\x90\x26\x1C\x70"
+    "\x72\xBE\xCA\x8F\xBD\x00\x99\xF5\xDB\x47\x15\xB9\xAC\x79\xA3\xA9"
+    "\xFB\x8A\x0E\xB4\x6F\x75\x0E\x36\x4C\x80\x73\x58\x64\xB3\x45\x89"
+    "\xC6\x5D\x67\xDB\x84\x9B\xAC\x02\x67\xB2\x31\x3E\x9B\x18\xB9\x84"
+    "\x85\xDC\xD8\x6A\x15\xDC\x0D\xA1\x2C\x59\x54\x59\xC9\x68\x2F\xD6"
+    "\x5C\x54\x33\xBD\x07\x66\x67\x35\x81\x1E\x4C\x83\x06\x53\x10\x51"
+    "\x1A\x72\x2A\xA4\xEE\x72\xAA\x2C\xBB\x24\x17\xC4\xC6\xCE\x5C\x28"
+    "\x8E\x07\x6E\x3B\x38\x67\xB1\x16\xFF\x78\xD1\xF5\xB1\x75\x05\x63"
+    "\xBC\x50\xAD\x05\x5F\xFC\xF3\x4C\x0A\xBF\x30\x04\x94\xB3\x35\xF5"
+    "\x3F\x02\x45\x38\xA0\x3B\x2F\x48\xFE\x5A\xE2\xF0\x89\x1C\x0C\xC9"
+    "\x5B\x3A\x1F\x75\x5F\x34\xCF\x46\x5D\xC2\x72\xB4\x1A\xEF\x39\x11"
+    "\xC8\xF3\x2F\x89\x40\x9E\x81\x7C\xD5\x9E\x64\x42\x45\x7E\x5C\x95"
+    "\x68\x37\x28\xFF\xA5\xFC\x94\xAD\xDA\x61\x86\x3F\xAE\x28\x1F\x94"
+    "\x50\x93\xB9\x8C\x4A\x39\x6A\x7C\xE3\x9D\x6A\x9C\x03\xD6\x6A\x9F"
+    "\xE6\xC4\x2F\x09\x0B\x92\x78\x80\xD2\x3A\x73\xBC\xAE\x44\x3E\x54"
+    "\x26\x87\x57\x07\x84\x0B\xD3\xD4\x45\x77\x53\x17\xD1\xA6\x2E\x36"
+    "\x68\xCA\xAA\x8B\xBA\x49\xA1\x90\x0F\xAA\x18\x45\x41\xEE\x0F\x87"
+    "\xA2\xE2\x71\x4D\xB8\x8D\xEA\x46\xC8\x48\xAC\x91\xF2\x98\x77\x7C"
+    "\x23\x43\x69\x11\xDD\x2C\x52\xB9\x04\x47\x28\x3B\x01\xEE\xDE\x55"
+    "\xE3\xC7\x82\x39\x24\x6E\xA6\xE4\x3F\xC2\x92\x17\xF1\x92\x76\x2F"
+    "\x1C\xD4\xB0\x43\x14\xAD\xE9\x6C\x4A\x83\xCA\x0E\x51\xB7\x37\x20"
+    "\x89\x98\x5F\x0F\x51\xC3\x3C\x2D\xAB\x42\x39\x6C\x68\xE7\x47\x39"
+    "\xB3\xB2\xC3\x1A\x24\x0F\x89\x14\x1D\x46\x23\x3C\xAA\x33\x99\xFC"
+    "\xD4\x65\x87\x4B\x94\x4E\x2F\x1E\xBD\xDA\x33\xEB\x27\x4B\xB1\xB2"
+    "\x61\x70\x43\xAE\x3E\x94\x0D\xF5\xE1\x2B\x2C\x1F\x8F\x40\xC7\xA2"
+    "\x31\xD5\xB9\xAF\x4A\xB9\x4C\x4C\x30\xB5\xDB\x59\x41\x2B\x9A\xD2"
+    "\x9B\x4A\xDD\x30\x3B\xF3\x60\x51\xCA\x07\x40\xCE\x5A\xE8\x84\xDD"
+    "\x76\xDC\x17\xD1\xE9\x1D\x8E\x1D\x2B\xB3\xD6\xDB\x5C\xDB\x33\x2C"
+    "\x4D\x87\xA5\x75\xF1\xB1\xD4\xD2\x40\xE4\xCF\x10\x0E\xF3\x9A\xC5"
+    "\x35\xE0\x38\xBD\xB0\x09\x6A\x6F\xEC\xE0\xE4\xD9\x03\x5D\xAA\xEA"
+    "\xA8\x8E\x2A\xA2\xA3\x01\xC1\x09\xF0\x30\x5B\x1D\x8C\x7B\x01\x4B"
+    "\x8F\xF9\xE2\x46\x72\xD4\x79\x0C\x5D\x2A\x50\x46\x43\xEE\x9B\xC9"
+    "\x68\x68\xB3\x19\x8E\x4E\xCB\x06\xC3\xDD\xB9\x44\x72\xAE\xC8\x71"
+    "\xB0\x72\x21\xF9\x0F\x3C\xD1\x7F\x20\x38\x34\x13\xF6\x46\x07\x0F"
+    "\x21\x52\xEC\x72\xC0\x45\x65\x63\x03\x4C\x35\xDC\xFF\xBE\x45\x47"
+    "\x50\x29\x6E\x0D\x8D\x84\x81\x8C\x34\x2E\x99\xC1\x9F\x11\x5E\x54"
+    "\x46\x7F\x92\x69\xF6\x2D\x75\xA8\xD9\x62\x2E\x6E\xC5\xC4\x66\x90"
+    "\x51\x8F\xE2\x52\xB3\x23\x60\x6D\x5F\x08\x4F\xE7\xBC\x54\x84\x0A"
+    "\x55\x21\x21\xDB\xFC\x90\xD1\x6D\xCF\x4A\x56\xAA\xCB\xE3\x0A\x78"
+    "\x6D\x3E\xF5\x4F\x4C\x03\x12\x09\x44\x89\xBC\x52\xC5\x33\x37\x5D"
+    "\x82\xA0\xAB\x0F\x22\x91\x65\xAC\xF6\x67\x81\x84\x35\x79\x07\x29"
+    "\xAB\x5D\x0C\xA9\xF6\x8F\xA0\x5A\xA0\x31\x76\x55\x77\xF7\xA5\x12"
+    "\x8C\xD0\x29\xBB\x00\xE8\xED\xA7\xAC\xEA\xE9\x9B\x5D\xD5\xE5\x66"
+    "\x55\x82\x08\xD4\x47\x2F\xFE\xAC\x29\x29\x02\xCB\x20\x7F\x6E\x2B"
+    "\x2D\x1E\x17\x27\x1E\x79\x4E\x5E\x4E\xEC\xD9\x3B\x19\x87\xC4\xAA"
+    "\x75\xA2\x2E\x0D\x65\xC7\xBE\xC8\xB5\xD7\xE1\xCC\x21\xD3\xA4\x6B"
+    "\x83\x12\xB2\x69\xAA\x40\x6A\xA3\x92\x66\xBD\x54\xC1\xF4\x86\x25"
+    "\xC5\x44\xA9\x62\x21\xA3\xA4\xC2\xD2\xF6\x8E\x7E\x2C\x28\xAC\xC3"
+    "\x15\x57\x0F\xB8\x35\x24\xAC\xEC\xA0\xF8\xDC\x29\x06\xE3\xF8\x8A"
+    "\x16\x01\xC3\x73\x78\xDA\xAA\xE5\xF5\x55\x45\xDF\x75\xE2\xDD\x92"
+    "\x32\xD0\xDD\x27\x6A\x83\x99\x2F\x12\xD5\xB2\xC4\xF7\x1C\xED\x2D"
+    "\x10\x91\xA6\xF6\xC5\x80\xDA\x81\xA4\x34\xB5\x5D\xB6\xED\x86\x12"
+    "\x08\xCC\x10\x5C\xC8\x92\x61\x94\xCC\xB0\x96\x9E\x12\xB1\xC0\x9E"
+    "\x68\x18\xE1\xE6\x23\xE2\xD6\x40\x90\x33\xA6\x1B\x8A\x23\x75\x63"
+    "\xF1\x22\x7A\xC2\x59\xE2\x2F\x11\xE8\xD7\x5A\x0C\xD3\x31\x82\x07"
+    "\xE4\xBF\x24\xB6\xE9\x10\xB4\xCA\x05\xF7\xFB\x8F\x13\x1D\xF4\x9A"
+    "\x53\xB3\x5E\x7E\xF8\x99\x39\x2C\x6A\xE9\x75\xA6\x66\x34\x18\xE3"
+    "\x26\xB3\xB3\x0F\xC0\xE0\x09\xDA\x07\xE8\x8A\x73\xB4\x2B\xC6\x23"
+    "\x55\x32\x53\x34\x1E\x97\xF2\x0A\xB3\xB4\x0F\xD0\x0D\x4F\x54\x11"
+    "\x7B\xF6\x9A\x53\x15\x7F\x9D\xA1\x2D\xED\xFC\xDC\x28\xC6\xA2\x97"
+    "\x34\xEF\x5D\xD9\x94\x87\x98\x7B\xEF\x42\x7E\x65\xFB\x6D\x3A\x7E"
+    "\x65\x6F\x7C\xC6\x83\xDE\x00\x8D\xD1\x10\x98\x07\x7D\x31\x30\x0F"
+    "\xBA\x82\x60\x5A\x1D\xEC\x06\xA3\x60\x1E\xF4\x85\xC1\x4C\xA1\x44"
+    "\x71\x30\xAF\x88\x92\x1D\xA4\x55\x01\x6A\xD9\xEA\x8E\x32\x75\xE0"
+    "\x90\x39\x05\xEC\xDE\xF6\x07\x5B\x42\x19\x58\x39\xB0\x02\x56\x47"
+    "\x6C\xFB\x02\x67\x18\x8B\x8F\x8A\x27\xA1\x8C\xF4\xFC\xC4\xCD\x4F"
+    "\x4C\xA5\xC4\xCF\x26\xF7\x62\x64\xEA\x6A\x71\x81\x99\xE8\xB8\x6D"
+    "\xD3\xA2\xB6\x9B\x90\x69\xE4\x25\x7A\x78\x0D\xB1\x8B\x0C\x89\xE8"
+    "\x89\x2E\x70\xF9\x5B\x50\xFE\xD7\xAB\x82\x4F\x4E\x98\x14\x30\x71"
+    "\x40\xFC\x36\xEA\x09\x2F\xF2\x16\xB3\x7A\x65\x6F\xFD\x46\xA4\x95"
+    "\x1F\xDA\x30\x15\x05\x70\xA3\xA8\xA0\xF2\x8A\x00\x4B\xF3\xD8\xB5"
+    "\x00\xF7\x2E\x00\x90\xD3\xF5\xF4\x47\x8A\xA2\x23\x76\x86\xB1\x39"
+    "\x4D\x35\x2F\x06\x1B\x83\x78\x0A\x9B\xE8\x55\xA9\xEC\xA5\xC6\xFA"
+    "\x8F\x86\x72\x6B\x04\x8F\xDC\xD8\x88\xBA\xD7\x98\xF5\xE3\x97\x40"
+    "\x19\x0D\xEE\xD6\x98\xBE\x01\xCA\xEE\x4A\xF5\x4B\xA0\x2E\x0D\xF8"
+    "\xA1\x51\xBE\xA3\x2B\x41\x5F\xF4\xA2\xD7\x77\x95\xE4\xD5\xB3\x87"
+    "\xCF\x30\x35\xF8\xF2\xC2\x76\x8A\x6D\x57\x28\x12\xE8\xD8\xED\x54"
+    "\x1B\x34\xF9\x9C\x2D\x02\x47\x18\xDA\x8D\xAD\xCD\xB0\xB7\x38\xB4"
+    "\x9F\x22\x3C\x6D\x02\x54\xEF\xC6\xDA\x5F\x0E\x43\xA6\x6A\x07\x36"
+    "\xF1\xB7\x74\x29\x8A\xB9\x63\x39\x0A\xA6\xA3\xF5\x09\x2A\xA4\xF2"
+    "\x5C\x79\x8B\xFA\xD8\x1B\xED\x55\x41\xDE\x5A\xE8\xA1\xB5\x2A\x8F"
+    "\xCB\x2A\x5F\x38\xE7\x8F\xB6\xFF\x11\x5B\x63\xB2\xFF\xDF\xE6\x8B"
+    "\x56\xF7\x7D\x3B\x21\xC9\x55\x1C\x05\x34\x3E\x6E\x69\xC7\xE1\x2D"
+    "\x0C\x34\xB0\x25\xDC\x81\xB7\xB4\x32\x21\x2B\xC7\xAE\x96\x34\xC7"
+    "\xE1\xB5\x12\x54\x56\x9A\x63\x3E\xCE\x91\xBA\x47\xB0\x58\xD2\xF5"
+    "\x93\xB1\xF4\xAB\x8C\x2B\xA6\x7C\xE9\xC3\x78\x49\xEF\x0D\xB9\x52"
+    "\xF1\x63\x41\x61\x21\x8E\x6B\xA5\x8A\xD7\xEB\x15\xF9\x07\x04\xAA"
+    "\xB7\x21\xE6\xA0\x5B\x1E\x16\x1D\xE9\xD8\x9D\xC2\x88\xCF\xD7\x61"
+    "\x8D\xB0\x47\xE0\x68\xBC\x2F\xB2\x82\x4F\xA0\xA2\x95\x9C\xF3\x96"
+    "\x30\x14\x8B\x2D\xD6\x71\xAE\xA5\x2D\x64\xC4\x68\x3B\xDC\x9A\x3E"
+    "\xF3\x04\xAE\x63\x5C\x6E\x84\x0C\xC6\xF7\xBC\x83\x06\x2C\x08\x9A"
+    "\x1A\x2F\xA0\xA8\xE1\xA0\xC8\x0F\x74\xC5\x4C\x45\x80\x3B\x02\x3E"
+    "\x6F\x4E\x64\x8E\x5D\xA7\xAD\x60\x68\x57\xB0\xAA\xCE\xB3\x9C\xAF"
+    "\xF4\xE2\xC0\xDE\xBE\xDE\xC0\xA6\x2E\xD1\x58\xCD\xE6\x09\xAE\xE8"
+    "\xE6\x54\x87\x96\x72\x7B\x8C\x3C\x54\x9F\x89\xEB\x14\xE1\x22\x3E"
+    "\x28\x7A\x5E\x5E\x5D\x68\x77\x05\x56\x6D\x26\xEA\x74\xC3\x30\xD0"
+    "\x21\xE8\x17\x18\x81\x06\xF9\x61\xEA\xD5\x16\xC5\x4A\x2E\x41\x72"
+    "\x19\xEF\xD4\x29\xA0\x38\x81\xC8\x33\x25\xBC\x4E\x7D\x56\xB0\x86"
+    "\x43\x97\xC8\x0D\x73\x2B\xB6\x8E\xDF\xA9\x96\x6C\x1D\x51\x74\x42"
+    "\x3D\x86\xC2\x82\x99\x5A\xF7\xE2\x90\xE2\x31\x5F\x79\x95\x75\x34"
+    "\x0D\xB5\xBB\xD5\xE1\x5D\x53\xC0\xE3\xF0\x68\x99\x14\xF0\xF4\xB2"
+    "\xE9\x01\xBD\x67\x34\x3F\x8A\x70\x45\x3B\x55\x5C\xBF\x91\xDC\x65"
+    "\x45\xA4\xBC\x46\x2F\x50\xF9\x50\x5B\xEC\x1B\xE9\x85\xD1\x63\x3C"
+    "\xA0\x1F\xB6\x17\x52\x0F\xF1\xF6\xFB\x37\xD2\xAB\x40\xB5\x49\x34"
+    "\xB2\x59\x2F\x3B\x64\x6D\x78\xC6\xCF\x2D\x53\x88\x9B\xF0\x58\xBF"
+    "\xEB\xA3\x87\xBB\x54\x3F\xF0\xEE\x85\xA5\xB5\xAD\xEC\x84\x8B\xB3"
+    "\x68\x05\xEB\x28\x4F\xCD\xB1\x31\x6D\xC8\x7D\x60\x2C\x88\x8B\x8A"
+    "\x44\x26\x2A\x84\x02\xD2\x97\x90\xEA\x94\x77\x09\xDA\x67\x8D\xE2"
+    "\x7D\x01\xDB\x2E\x90\xF5\xFA\xF3\x8E\x8C\x54\x62\xB6\x90\xF4\x81"
+    "\x4E\x71\xCC\x45\xE3\xC6\xD3\x08\xA3\x71\x26\x4C\xF6\x81\x94\x4C"
+    "\x15\x86\xC3\x4D\x33\x15\x74\x5A\x24\xBB\x93\x15\x74\x98\x43\xFA"
+    "\xBC\xD4\xE5\x59\x3A\xDD\x29\xB4\x8F\xC2\xE3\xDA\x1E\x9D\xEF\xD9"
+    "\x33\x7A\x79\xE5\xB0\x92\x25\xC4\xD3\x95\x2E\x49\xDE\xC4\x95\xCC"
+    "\xFE\x4B\x90\x43\x2E\x87\x7E\x88\x2B\xA9\xC3\x2E\x71\x5E\xE7\xA2"
+    "\x68\xE7\x75\x43\xFC\xAF\x77\xDB\xF0\x8E\xFB\x73\xD2\xFC\xDD\x09"
+    "\x7E\xD6\xB7\xD9\x7A\xF6\x7A\xD7\x11\x95\x1D\x50\x05\xB9\x04\x7E"
+    "\x0B\x6E\xA0\x59\x4B\xA1\xB9\x28\x6E\x5E\xAD\x02\xE3\xB8\xFC\x64"
+    "\xEF\xA4\x0B\x77\x8C\x27\xCA\x1D\xC3\x16\xF4\xB3\x75\x8E\x74\xD3"
+    "\x23\x72\xED\xD0\xC1\xC2\x4C\xF9\xD7\x82\x6A\x6F\x12\xAD\x3C\x66"
+    "\x09\xDD\xD5\x4A\xD3\x62\xC6\x78\x6C\xC3\xB8\x9C\xE9\x7B\xEE\x9D"
+    "\x20\x55\x29\xC7\x83\x84\xF2\xE8\x98\xA6\x90\x8E\x0E\x5D\x5F\xAB"
+    "\x3A\x6F\xEE\xA5\x88\x15\x18\x6D\xE3\xF5\xF1\x5E\xA9\xDB\xCE\xEB"
+    "\x37\x51\x8B\x9D\x28\x34\x5D\xAE\x9B\x13\x51\x2B\xB1\x1F\x95\x26"
+    "\xE1\x9E\x81\x76\x38\x67\x70\x7F\xC7\x1D\xBD\x65\xF3\xF7\xD7\x18"
+    "\x9F\xEE\xEB\x55\x7D\x8A\xB3\x51\x16\x77\x10\x89\x88\xCD\x54\x47"
+    "\x28\xAF\x5A\xB4\x0B\x47\xE8\x75\x40\xDD\x10\x37\xEA\x9D\x3E\x44"
+    "\xCE\x2F\x9D\xEF\xFE\xE5\x46\xCD\x3C\x1D\x51\xA0\x37\x22\xD8\x30"
+    "\xC2\xB9\x04\x84\xFE\x6E\x40\xBE\x90\x6B\xDC\xA7\x38\x79\x29\x58"
+    "\x00\x30\x94\x13\x35\x02\x83\xB2\xAF\x17\xE8\xF5\xB6\x2C\x66\xE5"
+    "\x51\xE9\xBA\x17\xC8\xF6\xDD\x8B\x07\xEF\xAF\x30\x25\x49\x97\x19"
+    "\x30\x27\x29\xFC\x6F\x74\xF0\xF1\x07\xB2\x73\x5E\xAE\x38\x2A\x88"
+    "\xB5\x64\x38\xD8\x5C\x55\x0C\xC5\x10\x74\xE5\x50\x6C\xA6\xC3\xA7"
+    "\x69\x22\x26\x87\x20\x6B\x9F\x5A\x06\xDD\x3A\x5C\xD5\xF9\x9C\x36"
+    "\xDF\xB1\x9E\x6D\xCE\x84\x2E\x1D\xA3\x1C\x28\xA5\x0D\xCC\xAC\x47"
+    "\xB0\xC6\x8F\xE5\x90\x7F\xB9\x61\x27\xD3\xF1\x04\x25\x4B\xAA\x54"
+    "\x32\xE7\x78\x0D\xAA\x71\x55\x25\xC5\xA4\x78\x13\x8E\xFF\x92\xCB"
+    "\xB5\x46\x05\xD7\x6B\xFD\xB7\xA3\x20\xC9\x12\xE2\x29\x5E\x06\xE6"
+    "\x9C\x5B\x0C\x5E\xC4\xE2\x05\x28\x3C\x79\x11\xEF\xB8\xE1\x36\x8A"
+    "\xDC\x70\x1B\x89\x2A\xA5\xCE\xE1\x0B\x05\xD7\x2D\x1E\x89\x95\x45"
+    "\xE3\x95\x19\x1F\x88\x94\x29\x13\x63\x3E\x60\xBF\x77\x53\x3B\x72"
+    "\x29\x6E\xE4\xE0\x26\xAE\x7D\x59\xD4\xE0\xE5\xC1\x4C\xD9\x14\xDD"
+    "\x0A\xB1\xBB\x77\x03\x9A\x49\xDF\x81\x1B\x75\xDD\x81\x1B\xDD\x12"
+    "\xDA\x0D\xC6\x0A\xB8\xD6\xB5\x2D\x82\x80\xD9\x80\xDA\x5C\x0F\x9F"
+    "\x7E\x8B\x79\x6A\xF0\xED\xB6\xBA\xF0\x64\x2E\x8D\xFC\x5D\x67\xF5"
+    "\xEA\xBC\x35\xD2\xB4\xC2\x62\xE2\xDC\x1A\x31\xC0\x16\x79\xD3\xBE"
+    "\xC4\xBD\x5B\xC3\xF1\xB7\xCD\x54\x3E\x2D\x17\x0B\x8C\xEA\x7A\x94"
+    "\x61\x11\xDA\xD2\xA0\x65\x05\x1B\xB7\x49\xD8\x78\x97\xE5\x1E\x97"
+    "\x5A\x2F\x4C\x27\x90\x4B\xE2\x66\x8C\x9D\x38\xA7\x92\x0C\x26\xC4"
+    "\x01\x9A\x29\x17\x75\xDE\xEE\x39\x97\x7F\x8E\xD6\x14\x5D\x69\x55"
+    "\xB7\xED\x02\xA3\x04\x2E\x6A\xF2\x69\x9B\x9D\xC0\x5E\xF2\x18\x9D"
+    "\xBC\xA9\xE7\x8D\x0B\x5B\x13\xF3\x43\xC0\xD6\x78\xAB\x1B\x4C\x13"
+    "\x01\x9B\xCE\xD8\xF4\x69\xDF\x91\x5B\x3C\x8E\xE0\x40\x20\xBA\x38"
+    "\x4F\x78\x73\xA7\xC4\x1D\x8D\x39\xF0\x32\xEF\x8D\x4C\x2A\x0A\x71"
+    "\x80\x9D\xF0\xC8\x93\xC3\xE6\xE0\xBB\xE9\x25\x1A\xA7\xF2\xC8\x7F"
+    "\x91\xB8\x46\xB3\x9B\xB8\x46\xE3\xCC\x93\xED\x08\x96\x9A\x20\x57"
+    "\xC2\x52\x57\x1E\xF9\x2F\xAE\x82\xA5\x99\xB7\xF7\xFC\xB0\xE3\x43"
+    "\xD2\xCD\x5F\xDD\x53\x79\x88\x7F\xD0\x86\x0E\xC4\x4E\xF5\x08\x37"
+    "\x78\x3E\xB1\x61\x69\x67\x54\x12\xA5\x37\xF0\x40\xE8\xF0\x8A\x15"
+    "\x5E\x46\x7E\x48\xB2\x4D\xFC\x60\xFD\xDD\xDA\x26\x34\xF5\x27\x51"
+    "\x17\xE1\xE2\x3E\xA2\x29\xC2\xA5\x3C\x4A\xFB\x08\x67\xE5\x01\x39"
+    "\xF6\x93\x50\x58\x28\x37\x9F\xC6\x97\x07\x1F\xD9\xF3\x54\x2E\x91"
+    "\x89\x44\xD8\x9B\x3B\x7B\xC6\x48\x1D\xFA\x3E\xF6\x91\x3B\x5D\xE3"
+    "\xE3\xE5\x14\xEF\x1B\xDA\x0F\x9D\x52\x3C\x4E\xC9\xAE\x7C\xC5\x51"
+    "\x42\xFE\x8A\xD2\x16\x0F\xF6\xEC\xBA\x8E\x63\xD7\xD5\xFC\xBA\xFE"
+    "\x48\x6D\x3C\xD4\xA3\x6B\xB3\x04\xC6\x11\x1E\xEE\xF5\x5B\x8A\xB0"
+    "\xF1\x07\xF6\x75\x1A\x74\xC8\xEA\x6A\xFE\xB1\x9E\x75\x1C\x54\x72"
+    "\xBD\x7B\x9D\xC0\xDC\x2E\x0F\x04\x16\xF4\xA5\x64\x1D\x88\x20\xF1"
+    "\x01\x58\x10\xAD\x4B\x11\x44\xDF\xA9\x53\xE9\x61\xC4\x15\x5B\x4A"
+    "\xC1\xC0\xAF\x6D\x4A\x06\x7E\xFE\x02\x13\x02\x25\x9A\xE6\x53\x28"
+    "\xDD\xB8\xA7\x20\x8C\x05\xEA\x11\x0B\x5B\x6A\x31\xD2\x3F\xBA\x84"
+    "\xDE\xA2\xCF\xDC\x69\xC9\xCE\x31\x18\x22\x61\x49\xE1\x30\x80\xE1"
+    "\x43\x87\x09\x95\x66\x05\xF4\x90\x7D\xD2\x44\x1E\xE6\x6E\x9A\x60"
+    "\xD1\x36\x14\xC2\xA3\xB6\x57\xB0\xC9\x1A\x53\x82\x89\xB1\xDC\x98"
+    "\x7D\x96\xDD\xDD\xDD\xDD\x8D\x5A\xF7\x6C\x3B\x0E\x37\xE0\x88\xFA"
+    "\x07\x78\xAE\x2E\x9E\x70\x48\x10\xB0\x34\x33\x24\x61\x19\x8D\x39"
+    "\x01\x0B\x29\x1E\xF2\x82\x83\x06\x1F\x35\x26\x0A\x19\x25\xBA\x2B"
+    "\xFD\x93\xEB\x67\xE4\x0E\xBF\xD3\xD4\xC4\xED\x55\xCC\xB7\x5A\xFF"
+    "\x62\x3B\xEC\x74\x61\x67\x07\xED\x0C\x64\xBC\x52\xE8\xAD\xB2\xA9"
+    "\xB7\xC7\x73\x79\x88\x29\x84\x24\xFB\xAE\xD1\xA5\x33\xF7\xA8\xB2"
+    "\x2B\x26\x7E\xEF\x59\xE5\x26\x39\xD5\x1D\x0A\xCA\x89\xF8\x91\xD2"
+    "\xAD\xA7\x8F\x2F\x3F\xE6\xA1\xE2\xEF\xF7\xC8\xB0\xF3\xB8\x34\x1A"
+    "\xA3\x14\xA4\xE6\x9F\xCA\x6A\xB6\x58\xCF\x8B\xD0\x6A\x78\x0B\x56"
+    "\x74\xE3\x83\xA5\xAC\xA5\x59\x4B\x69\x33\xDB\xD5\x05\x1B\xE2\x1C"
+    "\x53\x60\xDE\x64\x20\x7B\xCB\x06\x9D\x93\x0B\xF4\xB2\x9A\xDA\xFA"
+    "\x2A\x0B\xF8\x2B\x53\x9D\xC2\x80\x33\xA3\x35\x74\xA9\xDF\x40\x06"
+    "\x59\x00\xEA\x09\xAA\x28\x4D\x76\xB8\x3E\x3A\xA2\x73\x0A\x84\xAF"
+    "\x70\x80\xA9\xC3\x9D\x6B\x02\xF0\x0F\xF2\xEA\x5D\xDE\xB8\xF6\x3E"
+    "\x72\x1E\x55\x00\x55\x01\x82\xA6\xDC\x19\x57\x45\x53\xFE\x0B\xC6"
+    "\xE0\x1E\xE2\xDE\xE6\x6F\xD1\x7B\x49\x15\x7B\x8E\xB5\x30\x7A\x95"
+    "\xDF\x8C\x5F\x80\xFA\xC2\x6A\x51\xC3\x82\xCC\xF6\x66\xB3\xCA\x24"
+    "\x10\x30\x0A\x51\x61\xEB\x95\xA7\x4B\x8E\x3C\x8E\x2E\xBD\xF4\x9D"
+    "\x53\x52\x28\x5B\xAB\x06\x40\x2C\xDA\x64\x45\x35\xAB\xD1\x63\x9E"
+    "\x08\x06\x70\x78\x9C\xFE\x85\x19\xA8\x71\x40\x75\xD4\xAF\x07\x38"
+    "\x17\x57\xEB\x19\x00\xAD\xB2\xF3\xC9\x85\x0E\xCF\xE2\xC6\xF8\xE2"
+    "\x05\xFF\x32\x3B\x8F\xBE\xBD\xF0\xC2\x64\x51\x9C\x88\xF1\xF9\x24"
+    "\x33\xF1\x1F\x75\x48\xC0\x73\x8C\x67\x87\x01\x98\x2E\x2E\x29\x32"
+    "\x2E\x4B\x82\x07\x27\x80\xF1\x0F\xC0\x73\x4D\x34\x2A\xAE\x9B\xEB"
+    "\x64\xB6\x5E\x10\xF5\x80\x88\x19\xCA\x9F\x12\x3D\x6E\x0E\x2F\xB2"
+    "\x45\x7E\x58\x2C\x78\x44\xDB\x72\xF6\xB6\xD1\x55\xF0\x05\xBA\x41"
+    "\x93\x8F\x3E\x99\x5D\x5B\xF4\x75\x5B\x11\x84\xA4\xC8\xE5\x73\xA6"
+    "\x4B\xD8\x65\x1C\xC1\x32\x01\xE0\xD0\x4E\x9E\x65\x3B\x26\xA0\x02"
+    "\x17\x00\x0C\x96\x38\x08\x15\xEE\x8A\x30\xEE\x0D\x50\x1F\xA9\x0D"
+    "\x1B\x16\x74\x97\x84\x8A\x8C\xD7\x44\xC3\x1F\xFC\x53\xB1\x88\x08"
+    "\xE5\xD1\x5F\xFF\xFA\xD7\xE9\x5F\x47\x29\x1C\x57\xE5\xF1\x89\x40"
+    "\xF2\xD7\x81\x63\x67\x48\x09\xC6\x91\x22\x05\x1C\xD6\x2B\xE4\x52"
+    "\x98\x7B\x38\xE1\xA0\x3C\x52\x7C\x02\x10\x97\x13\xEE\xD8\x04\x8A"
+    "\xB4\x6D\x7D\x7A\xE9\x2C\x7C\xBF\x04\x4F\xF0\x74\x7D\x41\x33\x14"
+    "\x48\x89\x92\x05\xE8\xFD\xF9\xC3\x4B\xB2\x2D\x21\xE9\xFD\x1A\x7A"
+    "\x82\x60\xE3\xDF\x73\xDA\xB7\x3F\x18\xED\xB7\xC5\x68\x46\xA8\x81"
+    "\x1E\x37\xFB\x8A\x60\x34\x63\x35\xDE\x13\x31\xB0\x13\x6F\x04\xF7"
+    "\x35\xA2\x13\x9F\x6C\xE6\x8B\xE7\xCF\xBF\x28\xD0\x8B\xB9\x59\xE6"
+    "\x33\x8E\x5C\xC6\xCC\x6B\x4A\xB0\xA8\xC4\x46\x9E\xC0\x72\x52\xCE"
+    "\x50\x56\x2A\x3C\xA6\x2A\x5A\x36\x82\x1F\x3B\x68\x78\xB7\x0F\x5A"
+    "\xC6\xA5\x1B\x80\x8B\x6E\x00\x01\xE1\x33\x1D\x7E\x2C\xE7\x98\x57"
+    "\x1E\xCF\x1B\xC7\x02\xAF\x69\x3E\x6B\xD7\x39\x7B\x9D\x01\x23\x7C"
+    "\x55\x9F\x7F\x0F\x1F\x61\x7B\xD4\x59\xE6\x05\xB6\x0A\x85\xC4\x54"
+    "\xF9\x2C\xFB\x3C\x8E\x7F\xD8\xBC\xEC\x56\xB2\xFD\xEE\x42\x49\x04"
+    "\x3C\x0C\x98\x8F\xBE\x2D\xA8\x38\xB7\xEE\xA8\xC6\xA7\xF9\x79\x37"
+    "\x35\xEE\x37\x33\x5C\xC3\x7B\xE8\xF1\xB0\xA0\x62\xE2\xD4\x42\xFF"
+    "\xBA\xBB\x61\xA0\x77\x17\x53\xE0\xB7\x3B\x3B\x1C\x0F\xE4\x8B\x68"
+    "\x83\x5E\xE9\xF1\x41\x10\x77\x17\xA3\xED\x4B\x5A\x79\x05\x08\x3D"
+    "\x0C\x94\xEB\x0D\xA8\x57\x8C\xA7\x64\x12\x94\x1B\xBD\x3B\xB5\xAF"
+    "\x10\x53\x17\x20\x89\x27\xA5\x11\xDF\x8B\xA9\xC4\x14\x69\x36\xA2"
+    "\x25\x51\xDE\x63\x57\xDF\xC1\x3C\x01\x46\x5B\xE1\x10\x79\x65\x65"
+    "\x4D\xF3\xFC\x26\xC7\x98\xDB\x77\xC5\x1B\xBD\x68\x24\x02\xF1\xF1"
+    "\x57\xCD\xE4\xBB\xE1\x27\xC3\x82\xF2\x1B\x8E\x8A\xF7\x6A\xA5\x8A"
+    "\xC9\xB6\xD1\x98\xEB\x96\x62\x42\xFB\xC5\x50\x0A\xC0\xBB\xCF\xBD"
+    "\x77\x8A\x5D\xF6\xB3\x3F\xCB\xA6\xA1\x07\x0F\xEA\x45\x8D\x07\x2C"
+    "\xA3\xB3\x93\xB2\x2D\x46\x91\x73\x35\xB5\x6A\x76\x1F\xAD\xE9\x2E"
+    "\xBA\x86\x47\xBB\xE4\xEB\x7F\x39\xA2\x56\x0D\x83\x32\x63\x7D\x5E"
+    "\xD5\xEB\xD8\x48\x6B\xAA\xAB\x9F\x5D\xC3\x14\x04\xB3\xAA\x27\x17"
+    "\xF3\x33\x1A\x92\x68\x65\xFE\x04\x63\xBF\x2C\xCF\x8D\xEC\x0E\x21"
+    "\x9C\xF0\xC8\xC5\x20\xA8\x4F\x49\x10\x8E\xBA\xE0\x69\x0A\x78\x74"
+    "\xB6\xD0\x71\x2F\x89\x11\x4E\xF3\xD5\x31\x80\x92\x24\xE9\xFA\x01"
+    "\x20\xFA\x81\x6A\x34\xE7\xFB\x83\x5A\xB3\x52\x80\x70\xF1\xEC\x56"
+    "\x0E\x5C\xBD\xC0\xC1\x88\xF9\xF0\x83\xA2\x64\x74\x81\xEF\x4B\x4A"
+    "\xA0\xB6\xD2\xEA\x80\x55\x03\x48\xE5\x33\x9F\x81\xD0\xB0\x5D\x32"
+    "\x91\x57\xFD\x35\x9F\x2D\x0B\x8A\x25\xF4\xAA\xEF\x67\x9E\x56\x93"
+    "\xD8\x61\x59\xF9\x4D\x4F\x61\xFD\x3C\xE5\xA1\x9E\x12\xB3\x84\xC5"
+    "\xCD\xB4\xF6\xCB\x33\x6B\x6C\x60\xAE\x66\xAB\x87\xC6\x3E\x81\x36"
+    "\x3A\xE5\x6D\x00\x13\x34\xE5\xEF\xF5\x3C\x1F\x9B\x19\xEF\x9D\x65"
+    "\x59\x39\x60\xFE\xEE\x6F\xE2\x8F\x5D\xDE\xEF\x58\xF9\xA6\x61\xB9"
+    "\x4F\x0B\x27\xD5\xF4\xE7\xD9\xBA\xAD\x5F\x16\x2D\x4D\xC9\xFB\x30"
+    "\x60\xE3\x6B\xE9\xD2\x52\x4F\xC3\xD5\xCB\x9A\x17\xA6\x52\x89\x3F"
+    "\x30\x5A\xBC\x33\x53\x27\xDE\x4C\x9C\xC8\x25\x2F\x76\x5A\x24\xD0"
+    "\x56\x6D\x4E\x79\x6B\xA1\x9F\x68\x8B\xE1\x4A\x83\x1D\xF3\x51\x6D"
+    "\x3D\xBC\xD9\x6F\xBF\xF3\xBA\x9C\xCC\x62\x07\x54\xCB\xE8\x72\x37"
+    "\xCD\x14\x14\xB3\xC8\xF5\x6D\x92\xE3\xF5\x12\x44\xCB\x83\x1D\x24"
+    "\x62\x24\x7A\xC7\xC1\x35\xEB\xA3\x6C\xB9\xA8\x5B\x86\x5A\x56\x76"
+    "\x79\x05\xAC\xCA\x8A\x4C\x6E\x09\xC0\xA8\x59\xF8\x80\xF1\xDD\x75"
+    "\xE1\xAE\xF4\x92\x29\xE0\xF2\xBB\xEB\x42\x56\x9A\x8F\x03\x59\xBD"
+    "\xDB\x10\xF4\x9D\x40\x56\xBA\x1C\x1D\xDB\x6D\xBA\xA2\x93\xB5\x37"
+    "\xFC\x47\x2C\x0C\x5A\x81\x5B\xB9\xF2\x5F\x29\x71\xF0\x5F\xF1\xCE"
+    "\xA8\x71\xFC\x07\x7A\x0A\x6E\x12\xD6\xA8\x68\x9F\x94\x15\x66\x59"
+    "\x1A\x83\x06\xEB\x1E\xD0\x92\x46\x0B\xFF\xDD\x60\xB1\x38\x55\xB0"
+    "\xA2\xA9\x50\x34\xA4\x18\x0E\x9C\xE9\x69\x0C\x3A\xB3\x8B\x03\xE9"
+    "\xD0\xF0\xDF\x4D\x70\x50\xB0\xA2\x38\xE4\xE7\x29\xC4\x13\xF9\x5B"
+    "\x80\x08\x9F\x65\x63\x42\x64\x87\x1E\xB7\xB3\x3B\x5A\x3B\x8E\x74"
+    "\x84\x04\xD5\x98\x19\xED\xD9\x11\x3D\x39\x1D\xD2\xFA\xB5\x53\x62"
+    "\x83\xCE\x51\xFD\x28\xA6\xAD\x85\x14\xAB\xC4\xD2\x2C\x59\x93\x3F"
+    "\x77\x76\x4B\x41\x10\xA2\xD1\xEF\x98\xD9\x24\xF8\x10\x53\x5D\xF3"
+    "\xB4\x17\x90\x6A\xB8\x71\x77\x36\x57\x12\x51\x2C\x80\x1F\xFF\x31"
+    "\xA6\x79\x13\x0F\x9C\x81\x85\x68\x67\x3F\x04\x0C\x4D\xB0\xC4\xA1"
+    "\xB5\x46\xE7\x55\x92\xE4\x58\x82\xBE\x2A\x84\x62\x0B\x47\x0A\xBB"
+    "\x61\x50\x95\xE0\xD8\x89\xC1\x0D\x01\x7F\x45\x12\xA0\xB7\xDF\xFF"
+    "\x33\x3E\xF0\xD6\x98\x00\xD2\xAB\x7A\x39\x04\x4C\x6B\x4E\xFC\xD2"
+    "\xE8\x0C\xE8\xA8\x41\x68\x20\x01\x01\xBB\x61\x50\x49\xF8\xC6\x89"
+    "\x97\x18\x6B\xD4\x9B\x59\x45\xB8\x48\x02\xB7\x65\x58\x7C\xEF\x80"
+    "\x7C\x70\x4C\x2A\x77\xB7\xE9\x06\x31\x5B\x8F\x31\x27\xD6\x24\xDB"
+    "\xA2\x91\xDC\xEA\xA0\xD6\x0B\xBD\x9B\xDA\xA4\xFD\x95\x32\x61\x0D"
+    "\x40\x00\x51\xED\x6A\x1F\x89\x6A\x21\x9F\x0F\x69\x5D\xB7\x80\x19"
+    "\xC7\x26\xBC\x3A\x45\x69\xB1\x85\x86\xA7\x62\xD5\xD5\xBA\xE2\x95"
+    "\xEB\x21\xA0\x96\xC2\x28\x39\x34\x0E\xF0\x17\xE0\x99\x42\xC5\x6F"
+    "\x01\x8F\xAE\x26\x59\xBE\x28\x8F\x71\x2D\xB4\x30\x30\xBF\x05\xEE"
+    "\x74\xF0\x25\x2C\x1D\xF3\x45\xB1\xE5\xF9\xB4\xDC\x8E\x18\x3E\x52"
+    "\x41\x01\x0B\x76\x85\x7D\x08\x6D\xA3\x2A\x8F\x93\x8B\x2F\x98\xAB"
+    "\x7D\x10\xEE\x7E\x6C\x34\x65\xA5\x37\x6E\x1E\x09\x56\x7B\xF5\x10"
+    "\x68\xBC\xBE\xB4\xC5\x1B\x89\x2D\x1F\xAF\x41\xE1\x8E\x71\x9F\x7A"
+    "\x54\x2E\x16\x2F\xDB\x8B\x05\xD2\xE1\x20\xB2\xF3\x33\x05\x89\x0E"
+    "\x8A\x8A\x44\xCD\x44\x99\xAF\x2C\x5D\x35\x89\x23\x25\xB1\x59\x6F"
+    "\x90\x86\x44\xD3\x76\x47\x99\x45\x98\x9F\x44\xF1\x1A\xC3\x96\xB3"
+    "\x59\xF0\x46\x07\xCD\x74\x19\x46\xAA\x7E\x5B\x0C\xA2\xF5\x61\x71"
+    "\x5C\x56\xCF\x73\x5C\xEC\x23\x5F\xF1\x4A\xE0\xAB\x5A\xAF\x57\x17"
+    "\xB1\x22\x08\x1C\x8B\xA8\xC5\x27\x5A\x86\xF1\x19\x6F\x4E\x76\x25"
+    "\x9A\x2F\xE4\x49\xCA\x6F\x7E\x0C\xBC\x8D\xE8\x99\xB2\xFF\x28\x12"
+    "\xA2\xE2\x28\xF4\x15\xA2\x09\xDA\x52\x60\x23\x57\xF2\xE5\x9E\x32"
+    "\xFB\x42\x2B\x70\xF0\x37\x7A\x9A\xC6\xFA\xDB\x66\xE7\xD4\x2E\x9F"
+    "\x6D\x8C\xC7\x4A\x99\xFC\x12\x4B\xFF\x8D\x8E\x25\x4A\x4C\x24\x40"
+    "\x8D\xDF\xC9\xF4\xE7\x1D\xF8\xBC\x0D\x1B\x9C\x5D\xDF\x27\xB8\x93"
+    "\x5F\x62\x3C\x73\xEE\xF2\x42\x8C\x67\xB0\x88\x73\xC0\x90\x2A\x6F"
+    "\xF9\xC7\x52\x7C\x33\x46\x62\x0D\xEE\xFC\x57\xC9\x3B\x1B\xB0\xCE"
+    "\xB0\xE1\x88\x0C\x85\xAB\xC3\x25\x06\x43\x68\x68\x09\xF2\x5F\x65"
+    "\xFA\xFE\x03\x41\xFF\x7E\xA7\xEF\x89\xB6\xC7\x6A\xB5\x14\x27\xB0"
+    "\x4B\xC8\x2B\xCE\x5F\xCC\x84\x6A\x61\xA6\x66\xB0\x6A\x3F\x36\x85"
+    "\x3F\xC2\x0C\x86\xD6\xE4\x19\x77\xB2\xFC\x55\x66\xB0\x13\x19\x6B"
+    "\x99\xE5\xD9\x49\xBD\x2A\xFF\x85\x4E\xE9\x0B\x9D\xF6\x19\x5D\x96"
+    "\xF0\xBC\x4D\x1A\x5B\xF8\x18\x60\x98\x09\xC6\xD1\x09\x43\x15\x12"
+    "\x69\x7C\x9A\x2F\x91\x12\xC6\x56\x31\xB1\x26\x03\xA5\xD2\x6B\xCD"
+    "\x7A\x7B\xBB\x1B\x7D\x0C\xC7\x87\xEE\x9E\x37\x8E\xBC\x97\x48\xD7"
+    "\x43\xFE\x22\x89\xBC\xDD\x46\x01\xBB\x7A\x9B\x9D\xB4\x0F\xA6\x37"
+    "\x5D\xC9\x47\xD1\x7B\x17\x78\x62\xAA\xEF\xC6\x19\x53\x3D\x07\xFE"
+    "\x98\xB6\x9C\xF3\xEC\x26\x0D\x35\x07\x0C\x9C\x34\xD4\x3C\xBA\xA5"
+    "\x8C\x69\x8D\x4B\x99\x47\x89\x9B\x67\x56\x46\xF4\xBC\x57\x2E\x4C"
+    "\x65\xFC\x62\x88\xEA\x41\x94\x38\x35\x9F\x4F\x83\x6F\xD6\x6C\xA5"
+    "\x6A\xF3\x83\xAC\x6D\x3E\x9F\x86\xDF\xCA\x39\x41\xF5\x52\xB1\x92"
+    "\x7C\x55\xA9\x53\xF1\x4F\x99\x36\x55\x7D\x6A\xBD\xF7\x8E\x79\xC6"
+    "\x56\x55\x13\xD8\xAD\x6F\x0A\xB5\xB1\x12\xD2\x00\x83\x03\x26\x1E"
+    "\xBD\x52\xC6\xC0\xA2\x8A\x99\xE7\x08\x34\xDD\x25\xE7\x39\x06\x4F"
+    "\x16\xB4\x2F\xBC\x92\xCA\x32\xA1\x8A\xA9\x27\xAF\x8C\xB5\x83\xA8"
+    "\x62\xF6\x45\x08\x4D\xB6\xAA\x1F\xA3\xF0\x64\x41\xF1\x26\xD6\x63"
+    "\xC5\xF0\xE2\x31\xDA\x5F\x5B\xCC\x3C\x47\xF0\xB3\xA5\xD4\x53\x1C"
+    "\x3B\x5B\xCC\xBE\xE8\xF0\xFF\x8D\x3A\x3A\xD0\xD6\x4B\x1F\x27\x48"
+    "\x7F\x07\x73\x7C\xEA\x3A\x3D\x74\x3B\x34\xDC\xAC\x67\x82\xE3\x6C"
+    "\x70\x08\xE2\x76\x24\x3E\x92\x0B\xAB\xF9\xBA\x02\x19\x26\x1B\x00"
+    "\x14\xCD\xB7\xE3\x55\x51\x54\xA3\xF0\xEE\xD8\x8D\x78\x29\x5C\xD3"
+    "\x3B\x61\xC7\x71\x0C\xF8\xFC\xE1\x83\x1E\x27\x43\x75\xA4\xB3\x73"
+    "\xF3\x87\x39\x3B\x37\x7E\x8C\xB3\xF3\x01\x0E\x70\x76\xAE\x73\x74"
+    "\x93\xF2\x1D\xD8\xF9\xD8\x5E\x03\xC3\x35\xF0\xDF\xD6\xF1\x7E\x90"
+    "\xDC\x9E\xDB\xB0\x53\xD5\x69\xC4\x99\xC1\xF6\x61\xB3\x66\x5E\xE9"
+    "\x99\x3E\x36\x73\xDE\x3D\xA4\x10\x92\xC0\xFC\xDD\xDF\xC4\x1F\x8E"
+    "\x0A\x7F\x38\x2A\xFC\xE1\xA8\xF0\x51\x1D\x15\xBA\xD6\xA7\xEE\x95"
+    "\xA6\x67\xCD\x88\x8F\xF2\x6F\xEF\xE0\x9E\x05\xE6\xE3\xCA\xA2\xBD"
+    "\x6C\x23\x3A\xCB\x18\x5E\x4F\xCF\xF1\xE6\x2A\x9B\x20\xE9\xBE\x2E"
+    "\xBD\xFA\x42\xEF\x71\x43\x7F\x63\x55\xE6\x82\xAA\xE1\x4E\xD2\xBE"
+    "\xF9\xC2\xD8\x9D\xBC\xDD\x65\x2A\xA5\x6B\xAE\xB2\x84\xBF\x47\xDB"
+    "\xC3\xA5\xCA\x0C\x49\x8C\xC0\x0B\x76\xD3\x75\x07\x72\x19\x0E\x27"
+    "\xBC\x3D\x27\x1B\x51\xE4\xC3\x85\xFC\xE0\x8D\xB0\x24\x17\x74\x65"
+    "\xC2\x50\x26\x5C\xA7\x93\x70\x54\x70\x6A\x36\xDC\x92\x84\xE6\xA3"
+    "\xDE\x82\xF7\x10\xF3\x22\x01\xEA\x02\x41\x5D\x78\xA0\x92\x13\xEB"
+    "\x7B\xA3\xA5\x73\xFE\x42\xEA\x5A\x9A\x8E\x5A\xFE\x61\x40\xB5\xC7"
+    "\x30\x32\x39\x5E\x52\xF3\x0B\x61\xDB\x29\xCA\xF2\xB7\x0B\xF7\x5B"
+    "\x4C\x79\x72\x75\xA6\xC4\x38\x80\x72\x36\x96\xA8\xA4\x47\xE2\x6A"
+    "\xB6\xC4\xE7\xD0\x00\x2D\x34\xB9\x50\xDF\x6E\xD4\xA0\x48\xD1\xFB"
+    "\x40\x05\x78\x28\x7A\xE1\x74\xC9\xBD\x55\xEB\x7C\xC2\x08\x91\x4F"
+    "\x49\x7B\xF3\xBB\x81\x5B\x95\xE5\x2E\x49\x09\xB6\x01\xB9\xF5\x2A"
+    "\xAA\xE4\x11\xCB\xBB\x2B\x4D\x51\x73\x06\x36\xA7\x29\x07\x8D\xDE"
+    "\xBD\x56\xA3\xAA\x93\x11\x79\xB4\x1B\x9B\x0E\x21\x16\xF8\x13\x31"
+    "\xDF\xDD\xD7\xBC\x25\x6D\x8A\x63\xBA\x05\x49\x06\x36\x20\x12\x2C"
+    "\xF7\xCB\xBB\x9B\x00\x8A\x23\x78\xB7\xF3\x06\x3B\xE9\xBD\xD0\x8B"
+    "\x09\xB4\xB5\x1D\x2D\x75\x19\x52\xA2\xBB\x33\x2C\x0A\x73\x1C\xE8"
+    "\x4D\x6A\x32\xEA\x48\xD0\x7B\xC1\xF7\xF0\xD6\x3A\x31\x91\x47\x1E"
+    "\x0F\x53\xA4\x6B\x4E\x4A\x58\xA9\x62\x8F\xE9\x5F\x7A\x24\x43\x42"
+    "\xA5\xD0\x8A\xE6\xEC\x1B\xA0\x5B\x93\x5C\xA3\xCD\x1B\x8A\xB5\x7A"
+    "\xDD\xFE\x7A\x24\x5B\xCA\x9B\x3C\x2D\xE3\xB0\xC8\x1F\x72\xEE\x77"
+    "\x26\xE7\x22\xF3\x73\x33\x11\x15\x01\x70\x6D\xD9\xF9\xA1\x64\x5B"
+    "\xFF\x9B\xB8\xA4\xB1\x7F\x6D\x32\xF9\x91\x9D\xD5\x7C\xA7\xDC\x6B"
+    "\xBF\xC9\x49\x4F\x66\x8E\xE6\xDF\x69\xDA\x6F\x32\x15\xD5\x34\xBC"
+    "\xDE\xDC\xFF\x25\x17\xA8\x87\xB4\x9B\xCD\x30\x54\xFD\xA2\x60\x66"
+    "\xED\xDC\xBD\xEC\xDE\xD8\xEE\x05\xF7\xD1\xCF\x55\x67\x7E\x73\x1C"
+    "\xC5\xE3\x4E\x1B\x96\xE7\xAD\x1C\xFC\xA0\x2F\xF7\x64\x57\xC2\x61"
+    "\x56\x20\xC2\x7C\xBF\x3C\xCE\xFA\x73\x14\x89\xA1\xC3\x2B\x4E\xA4"
+    "\x49\xAE\x93\x3C\xA7\xCD\x3E\x06\xED\xA1\xED\x7D\x7D\x34\xD0\x92"
+    "\x71\x71\xF5\xF1\x0F\x60\xCD\xF3\xE6\xE4\x59\x05\x32\x69\x59\x37"
+    "\x65\x8B\x51\x67\x31\x86\xC8\x31\x86\x45\x06\xF9\x87\x5F\x61\x80"
+    "\x10\xE3\x69\x66\x60\x24\x7F\xAF\x50\x9E\x91\x93\xE1\x09\xF4\x8D"
+    "\xBC\x24\xD1\x2F\xF0\xA4\x20\x40\x1C\x72\xA5\x3C\xEA\x05\x53\xD5"
+    "\x8C\xD6\xD1\x11\x02\x6B\xD6\xCB\xE5\xA2\xC4\xC8\xEE\x08\xC8\x82"
+    "\xED\x05\x43\xD9\xB8\xF2\xE5\xD4\x31\xE7\x01\x6B\x28\xF0\xD3\x4E"
+    "\x92\x40\xDB\x3B\xDA\xCE\xE0\x12\x66\xC2\x59\xA7\x5A\xDD\xD7\x93"
+    "\xA2\x17\x13\x8F\x18\x01\x52\x18\x4B\x65\x80\x95\xB2\xA9\xF5\x70"
+    "\x41\xBB\x74\x8F\x11\xC7\x08\xA1\xA5\x67\xF7\xB7\x86\xEF\xF0\x78"
+    "\x5F\xCE\x8A\x89\x06\xB6\x8F\x44\xD1\x9D\xA6\xE0\x6B\x37\xE5\x77"
+    "\x73\xC3\x7E\xA6\x31\x5B\x07\x9A\x3A\xA2\x66\x8E\x30\xE0\x9B\xF6"
+    "\x53\xD5\xDD\x0E\xE2\xCF\xA9\x0F\x5F\x66\x71\xB1\xCF\xF2\xA6\xAE"
+    "\x9E\xD3\x7D\x5A\x0C\xA8\x4B\xE5\xC3\xBD\x13\xAA\xA2\xF5\xD1\x91"
+    "\x5B\xEE\xE8\x28\x2C\xE8\x23\x85\xF4\x8F\x63\x05\x5F\x52\x68\xE1"
+    "\x6F\x50\x6B\xA1\xA2\x65\x9D\x6E\xF8\xB4\xE6\x21\x54\x1D\xBF\xD6"
+    "\x3D\x9C\x58\xB0\x6F\x92\x2B\x9D\x25\x8C\xBB\x00\xAB\xC8\x3D\xEE"
+    "\x60\xA1\xDB\x4F\x52\x34\x0B\x48\x77\x93\x90\xAC\x4F\x4A\x0F\x24"
+    "\x47\x13\x4D\xB9\x1A\xC9\x5E\xBF\xD9\x56\x51\xD5\x39\x14\x12\x1E"
+    "\xA8\xD4\x98\x4D\x01\xE1\xDC\x8A\x31\xE4\x50\xC9\x6F\x9C\x79\xAC"
+    "\xDC\x47\xB3\x2D\x26\x5F\x64\x4B\x6D\xAF\xDC\xFF\x94\xC3\x25\x85"
+    "\x2F\xFF\x10\xF9\xDE\xEF\x0F\x91\x0F\x1C\xF7\x77\xC5\x70\xE8\x8C"
+    "\xF6\xDB\x16\xF8\x31\x3B\x39\xCA\xC4\xB8\x89\xFC\x0F\x81\xEF\xFD"
+    "\x7E\x09\x81\x3F\x09\x0E\x23\xAE\x2A\xF0\x27\xC1\x92\xFE\x11\x05"
+    "\xBE\xED\xF7\xC6\xF2\x9E\xFC\x25\x72\x8A\x82\x97\xAF\x0E\xCB\x76"
+    "\x95\xAF\x2E\xB2\x45\x3D\xCB\xD9\x23\xA8\x22\x79\xC0\xC7\x2C\xCE"
+    "\x49\xFD\x83\x45\xB9\x5C\xE2\x24\x82\x99\x3E\xAF\x61\xA9\xC8\x8F"
+    "\x31\x60\x21\x67\x95\x5D\xAE\xEA\x77\xE5\x1C\x13\x1A\x92\xA9\x17"
+    "\xA8\x63\x1C\x68\x3F\x45\x99\x45\x11\xFB\xF8\xDB\x11\x66\xAB\x20"
+    "\x53\x67\xD0\x16\x8B\x31\x5D\x0D\xBF\x11\xB2\x67\x18\x0E\xFF\xB0"
+    "\x20\xE1\x51\x01\x13\xC0\x87\xD5\x59\xD9\x14\x18\xBF\x90\xBE\x55"
+    "\x75\x6B\xBE\xF7\x7A\x16\x74\xBA\x16\x85\xEB\x58\x7A\x53\xA3\x2D"
+    "\x32\xF1\x65\x4E\x7F\x8D\xAF\x75\x1A\x19\xBE\x62\x95\xFA\x6A\xAE"
+    "\x5B\xA5\x85\x69\x70\x69\xCB\x95\xA8\x1F\xF9\x0A\x17\x6F\xA2\x3F"
+    "\xC4\x1D\xAE\xEB\x8A\xDA\xF4\x39\x64\xFC\x10\x32\x6D\x4E\x4D\x48"
+    "\x95\xEE\xD9\x8F\x3F\xFF\x92\xDD\x72\x77\x7A\x4E\xFF\xD5\x57\xED"
+    "\xEC\xE0\xDC\x90\xE1\x86\xBD\xB5\x9F\xD7\x26\x4F\xD2\x46\x4E\xDA"
+    "\x01\x5B\x12\x20\x3A\x9D\x36\x7E\x6D\xFA\x78\x5B\x5D\x60\xE8\xF0"
+    "\x61\x93\xA6\x49\x55\x59\xD8\x1C\x84\x23\x4A\xD4\x60\xA9\x6A\x18"
+    "\x5D\xD5\x29\x6F\x8C\x98\x0A\xC1\xCC\x78\xB3\x59\xF4\x1E\x0C\x74"
+    "\x45\xB7\x46\x9A\x8E\xB3\x72\x7B\x2B\x49\xBB\xA6\xE3\xB9\xF8\xC4"
+    "\xE7\xCF\x89\xCF\x98\x9E\x9B\x3D\x5F\x70\xB8\xE7\x81\xBD\x70\xC1"
+    "\x5E\x04\x2B\x56\xB0\xF0\x4C\xC4\xE5\x8A\xBB\xD6\x09\xDE\xE7\x14"
+    "\xC1\xAB\x83\x19\x26\x64\x0E\xF2\xF3\x4C\x8C\xF5\xBF\x27\xC3\xDC"
+    "\x3F\x2F\x86\xB2\x8B\x65\x95\x80\x11\xFA\xB9\x27\xCA\x29\x96\x4B"
+    "\x02\x1E\xE8\x67\x9C\x0D\x98\xC4\x3A\xE0\x48\x3D\xC6\x89\xEB\x28"
+    "\xFE\x1C\x72\x36\x24\xF3\x9D\x7F\xA8\xFB\x62\x56\xC4\x76\xDC\x17"
+    "\x5B\xDE\xA5\x42\x77\xE3\x85\xDC\xFB\x3E\xC4\x2B\x51\x97\x24\xCF"
+    "\x0F\x29\xD5\xA5\x98\x8B\xE7\x86\x7D\x42\x17\x1C\x1A\x64\xF2\xA0"
+    "\xD9\xC9\xEE\x76\xF5\x0D\x0B\x7F\x76\xB5\xC2\x9F\xF5\x17\xDE\xB9"
+    "\x5A\xE1\x04\x1A\x1E\xA9\x3F\xCC\x1D\xF5\xF8\x25\xEE\x88\x57\xEC"
+    "\x47\xBD\xC4\xAD\x3A\xEC\xF5\xB8\xFF\x48\x2A\x39\x01\x29\x5B\x3B"
+    "\x46\x3A\x75\x0F\x0C\x4B\x8C\xF5\xCD\x69\x38\x4B\xF5\x2E\x06\x00"
+    "\x35\xA6\xDB\xFE\xE9\x96\xCC\xF0\x3A\x52\xA7\x5D\x98\x3C\xFD\xE7"
+    "\x9F\x33\xBB\x69\x0C\x0F\xC4\x30\x83\xA9\xCD\x1F\x1A\x68\x56\x9C"
+    "\x19\x4B\xE4\x16\x76\xF0\x3D\x5D\xE3\xC5\x44\x0C\x17\x9B\x67\x1A"
+    "\xDE\x69\xD1\x9E\xD4\x73\xA9\x43\x5E\x6E\x80\x78\xD5\x83\x75\x75"
+    "\x93\x28\x57\x5D\xF8\xF6\xE6\x08\xF8\x8D\xDC\x4F\xB3\x4E\xEE\x5C"
+    "\xCC\x3E\x7B\xB7\xB5\xF4\x1C\x53\x97\xB5\xF4\xE3\x07\xBE\xED\x26"
+    "\x8F\xD3\x30\x09\xAA\x78\x94\xB7\xC4\x94\xDE\x87\x77\xC4\xD4\x9F"
+    "\xCE\x57\x5C\xE4\xE9\x1B\xFE\x21\xA1\x2F\x6A\x82\x0A\xFF\x78\x6F"
+    "\x91\x5A\xEA\x0B\xFE\xE9\x7D\xE5\x23\x73\xF5\x9D\x1F\xBC\xFB\x4D"
+    "\xF4\x52\x5D\x6D\xA2\xBF\xBD\xEF\xF6\xE4\x44\x15\xB2\x2F\xBC\x92"
+    "\xDA\xE0\xA6\xCA\xE9\x47\xFF\xCE\x95\xB8\x70\x65\xEF\x50\x65\xF1"
+    "\x4B\x54\xE1\x2D\x2A\xA5\x29\x2E\x65\x8C\xFF\x39\xDB\x1B\x74\x02"
+    "\x04\x7B\xCD\x0A\x7D\x9B\xDC\xB8\xFB\x78\x6E\x5C\x37\x85\xCD\x96"
+    "\xE0\x07\xDA\x6F\x0A\x27\x89\xC0\xD8\x29\xAD\x67\xA8\xD2\xB4\x48"
+    "\x03\xDC\x57\xD1\x6A\xEF\x89\x2F\x17\xC9\x2F\x0B\x73\x04\xBC\x2F"
+    "\x6F\x7D\x71\x11\xBE\xF4\xC5\x1D\x0C\xEE\x7C\x71\x7D\xED\x18\xFD"
+    "\xF9\xAE\xF3\x56\x3B\x46\x7B\xAF\xD9\x2F\xFA\xAE\xFB\xD2\x38\x46"
+    "\x7B\x85\x31\x39\xE9\xF1\x0A\x9D\x86\xED\x6D\x2E\xB4\xBC\x1C\xD6"
+    "\xAB\x3A\x76\xA3\x8B\xF0\xEC\xBB\xD0\x45\x85\x52\xDB\x80\xAB\xDC"
+    "\xE7\xE2\x82\xD1\x50\xB1\xED\x49\xEC\x52\xD7\x26\xAE\x27\xC3\xEE"
+    "\x21\xF1\xC6\x8D\x9B\x75\x97\x7C\x3D\x74\xBA\xDB\xBD\x9B\x68\xFF"
+    "\xEE\x11\x83\x8E\x03\xE5\x9B\x47\x9B\xEC\xCB\xED\xAC\xD1\x8B\xB0"
+    "\x4E\x69\xC1\x24\x51\x19\x25\x60\x2E\xAD\x3A\xFD\xC4\x5B\x31\x5B"
+    "\x62\x74\x21\xB1\x61\x14\x87\xD6\x9F\x2D\x9A\xB5\x4B\x7B\x0F\xD1"
+    "\xA9\x6E\x3C\x5A\xE2\x71\x72\xF0\xF6\xBF\x81\x39\x9D\x01\x83\xB6"
+    "\xF1\x6B\xF1\x06\x60\x15\x83\x06\x4B\xF6\x00\x2F\x36\x95\x92\x4B"
+    "\x34\x78\x5C\xB4\xE3\x32\x96\xBE\xCA\x4B\x59\xE7\x61\x1D\xB7\x57"
+    "\x9F\xEF\x71\x0B\xB8\x13\xC8\x38\x79\x71\x79\x5A\x44\x8B\x5E\xE8"
+    "\xA2\x17\x93\xE0\xFB\x65\x97\x55\x9A\xD5\x06\xCA\x65\xA6\xF4\x06"
+    "\x67\x7C\x50\x37\x43\xE7\x4F\x50\x48\x28\xD3\xF3\x74\xB4\x2D\x68"
+    "\xE9\xB3\x97\xDB\x0D\xA3\x8E\xED\xE9\x41\xF3\xA2\x8B\x57\xFC\xB1"
+    "\x72\xBE\x18\x35\xC4\xE5\x1A\x12\xE1\x7E\xAE\xB2\x50\xAE\xC4\x1C"
+    "\x1C\xED\x75\x3C\x35\x3D\xA6\x2A\xD7\x2D\x8E\xEE\xE8\xF3\x79\x90"
+    "\xF0\x1D\x08\x3D\x5B\x14\xF9\x2A\xC3\x5B\x52\xA0\xAC\x72\x2D\xA7"
+    "\x48\x4C\x5F\x87\x77\x47\xE5\xF1\x94\xD6\x92\xAF\x5C\xF1\xE8\xC7"
+    "\x82\x90\xD5\x5F\x14\xB3\x76\x8C\x89\x72\x27\x06\xBF\x33\x7D\xC1"
+    "\x48\x86\x1E\x0E\xB1\xF4\x91\x26\x6B\xB5\x3E\x18\xED\x2A\x3B\xF0"
+    "\xE6\x93\xB9\xF8\xC4\x7B\x7E\x19\xB9\x30\x7A\x22\xA1\x56\x1B\x79"
+    "\xBB\x29\x56\x4C\x2F\x3F\x4E\x6F\xFD\xAB\x4E\xB1\x8A\xBC\x40\x89"
+    "\xEB\x52\xB1\x42\x66\xC1\x72\xA9\x17\x5C\x95\xE2\xBA\x3D\x14\xC5"
+    "\x33\x8E\x1C\x74\x2B\x75\x3D\xA6\xAB\x34\xD3\x28\x7E\xF9\x74\x3A"
+    "\xEC\x4A\x93\xDB\x9D\x8B\x9B\x06\xA8\x7F\x7E\x27\xFD\x67\xBE\x27"
+    "\x76\x5E\x0C\xE8\xAE\x73\x61\x55\xF2\x3F\x7E\x55\x9C\xBF\x3D\x75"
+    "\x82\x18\x4E\xFD\xE0\x88\xE2\x85\x0A\x24\x18\xA3\xC3\xF0\x96\x44"
+    "\xBC\xC9\xA9\x1B\xC5\xD2\x3C\x9A\x76\x7C\x99\xEF\x2A\x70\x7A\xF9"
+    "\x48\x1E\x2A\xFA\xC4\x93\x04\x0C\x27\x61\x84\x8A\xF8\x33\x4A\xDE"
+    "\x75\xC7\x7A\x48\x63\x80\x1D\x5D\x05\x84\xBD\x21\x0B\x74\x3A\x1A"
+    "\x2F\xA0\x59\xB2\x9F\x4E\x63\x15\x7E\x68\x70\xD7\xD8\xFC\xEF\x1A"
+    "\xE4\x4B\x96\x37\x4B\x90\x57\x98\xE4\xB1\xAC\xA3\xA5\x13\x4B\xE5"
+    "\xB9\x8A\xE7\x41\x17\x8A\x25\x8D\xB5\x21\x70\x74\x1E\x4B\x91\xA8"
+    "\x2B\xB3\x71\x30\xAC\xAC\x8C\x86\x9D\x95\x75\xA6\x73\x03\x65\xC7"
+    "\x60\x93\xAA\x73\xD1\x8B\xED\x45\xBA\xC1\x8B\x5E\x6C\xBB\x2A\x6B"
+    "\x6C\x2F\x2C\xB6\x17\x49\x6C\x13\x40\x58\xF2\xE9\xC8\xF7\xDA\x9A"
+    "\x1B\xCA\x63\xBF\x86\x09\x7E\x6F\xAC\xB6\x81\x90\x15\x74\x7D\x58"
+    "\xB2\xFA\xFB\xBC\x58\xD1\xF9\x37\x92\x98\xB1\xBF\x23\x31\xB8\x97"
+    "\xC6\xF3\x22\x02\xE2\xC2\x05\xC1\x28\xDD\x4B\x82\x98\x87\x10\x30"
+    "\x05\x4C\x80\xDC\x24\x6C\x2C\x3E\x65\x48\xE6\x6B\xA8\x64\x33\x9B"
+    "\x67\xA8\x72\xFB\xED\x70\xA6\x3D\x3B\x19\x52\x54\xD2\xA3\x20\xC7"
+    "\xE4\xD3\x00\x5C\x48\x64\x23\x60\x75\x48\x68\xCD\xB3\x11\xD6\xB1"
+    "\x65\x15\x87\xF9\x67\x92\x9F\x29\x3C\xD2\x6C\x67\x86\xDE\xE1\x84"
+    "\x21\x88\x5E\xF8\x88\x5E\xA4\x11\xBD\xF0\x11\xF5\x1D\x13\x3F\xD3"
+    "\x98\x24\x06\x87\x44\x2B\xBA\x01\x85\x0B\x14\xFE\xAC\x2C\x1D\xB4"
+    "\x5E\x44\x9C\x52\x0C\x00\xCF\x0F\x74\xD7\x3F\xC4\xFE\x33\xFC\xAF"
+    "\x17\x80\xF1\x2A\x1A\x5A\x9D\xE9\xE1\x44\xC0\x1D\xED\x8E\x26\x41"
+    "\xC0\x40\x3B\xEA\x32\x5C\xAC\x29\x1A\x23\x9D\xDA\xBF\xD1\x36\x61"
+    "\x43\xC2\xA1\x18\xB3\x2F\x61\x9D\x35\x97\xAA\x5C\x01\xA7\x37\x8E"
+    "\x91\x7B\x03\x9D\x0D\x8A\x88\x14\xA2\x45\xF1\x56\x2D\xED\xCA\xEB"
+    "\xDE\x69\x13\xEF\xCE\x0D\xBB\x2E\x44\x0E\x22\x5D\x03\xE6\x46\xF4"
+    "\xE8\x60\xC0\xD9\x7A\xB5\xC2\x33\x24\x76\x79\xC3\xBD\x3E\x06\x3B"
+    "\x59\x95\xF0\x8E\x1D\x56\xE0\x7F\x2C\x42\x53\xE2\x96\x01\xA0\x01"
+    "\x29\x58\x25\xB8\x43\x5D\xC3\x2D\xE2\xF3\x46\x15\xBC\x9F\xC6\x9F"
+    "\xBC\x17\x2D\x4C\xCF\x41\x57\xFE\x1A\x26\xEF\x7C\xFC\xF9\xF6\xE5"
+    "\x24\x73\x3F\x5E\x74\x7D\xCC\xE5\xC7\x9F\x22\xD9\xB0\x2C\x62\x14"
+    "\xB4\xDD\x77\x11\xC8\x8A\x05\xF4\x30\x54\x9C\x02\xE1\xB6\xBB\x2D"
+    "\xA5\x82\xEF\x8B\x84\xBF\x40\xCC\xEC\xDC\xED\xAC\xE3\x6E\x73\x23"
+    "\xBA\xAB\x47\xC9\x9F\x3E\x79\xEF\x49\x4D\xD3\xF7\xBB\xD4\x77\xFF"
+    "\xEA\xF9\xBD\x4D\x60\xEA\xC3\xCD\x38\xCC\xC8\x61\xAA\xED\xB2\x23"
+    "\x0C\x00\xE2\x45\x27\x96\xBE\x37\xC9\x06\x10\x13\x38\x76\x1C\xCF"
+    "\xE2\x4F\xCD\x2B\x9A\x02\xC1\x04\x53\x54\xF1\x27\x56\x7F\x11\x67"
+    "\xCC\xFA\x63\x19\x76\x1C\x57\x38\x06\x02\x3E\xAD\x70\x5E\x85\x87"
+    "\x15\xDA\xE4\x2E\x1F\xC3\xA3\x0A\x5D\x4A\x3E\x4A\x73\x7A\xCE\x86"
+    "\x72\xFA\xB7\x2B\xF4\x17\xD0\xAF\x3C\x5D\xD6\xAB\x36\xA3\x4C\xC4"
+    "\x98\x43\xFC\x55\x5D\x2F\x1A\x3E\xA0\xDE\x9A\xDE\xC1\xA4\xD5\x9C"
+    "\x5B\xFC\xA0\xC5\x0F\xD3\x7F\x36\x5B\x5E\x2D\x58\xDB\x31\x9F\x76"
+    "\x58\xED\x8C\x3E\x88\x7A\x31\x1B\x79\x6D\x52\xF4\xE2\x5E\x20\xCF"
+    "\x4E\xD7\x8B\xB6\xDC\x29\x54\xB2\x5B\xDE\x25\x60\x95\x71\xB3\x28"
+    "\x61\x03\xBD\xAD\x6B\xB0\x11\xB5\xAC\x66\x2B\x2A\x79\x67\x5E\xA8"
+    "\xBF\x74\x01\xA4\xC7\xA7\xCA\x48\x06\x7A\xC4\x72\x91\x5F\x10\x9B"
+    "\x2C\xD0\x4B\x98\x73\x07\x07\x26\xF7\x17\x80\x09\xDA\x96\x89\x10"
+    "\x97\xD9\x4A\x3E\x8A\x50\x36\xF8\x44\xCD\x33\x74\x0F\xAA\x5E\xE4"
+    "\x3E\xCD\x06\xFD\x00\xEC\xB3\x1F\x5E\x69\xB0\x0C\x82\x94\xBE\x19"
+    "\x79\x05\xB6\xB5\x93\xC0\x7B\x30\x58\xFD\x03\xE4\xEE\xE0\x26\xAB"
+    "\x02\xF2\xCE\x04\x10\xDF\xB1\xEE\x6D\x71\x11\xC5\x4D\x74\x19\x8B"
+    "\x50\x32\x2F\x1A\x14\xD3\xCB\x20\x4E\x11\x90\xE2\x3B\x1F\x5A\x1C"
+    "\x52\x94\x6A\xBE\x9B\x21\x4C\x7E\xD6\xCA\x63\xF0\x94\xAC\xC9\x80"
+    "\x56\xF5\x19\xD0\x4D\xE0\x96\x51\x52\xEB\x06\x9A\x88\x42\x2D\xAB"
+    "\x0E\xA8\x6A\xF7\xB3\x31\x54\xC3\x8F\x31\xA8\xF9\x29\xC5\x25\x83"
+    "\x11\x85\x62\xC8\xB0\x0A\xE2\xE1\x45\xB6\xC6\x9B\x84\x19\xB3\x38"
+    "\xAC\xE5\xD9\xE1\x1A\xC4\x78\xD5\xC4\x9A\x80\x7A\xE5\x69\xBE\x68"
+    "\xA2\x88\x1B\xEF\x77\x2E\x8D\xF6\x38\x53\xBE\xAC\x9C\x7E\xA8\xA3"
+    "\x87\x70\xFC\x66\x0D\x1D\xA9\x82\xE8\x00\x00\x7E\x03\xF0\x11\x85"
+    "\x07\x6C\x3C\xEA\x95\x60\x06\x9E\xEA\x34\xF5\xB8\x9E\x9A\xC0\x09"
+    "\xF8\x8F\xAB\xE5\xBA\x8D\x76\x20\x01\xBF\xA4\x0A\xDD\x40\x5F\x15"
+    "\xE7\x2E\xCC\x3E\xA0\x82\x0E\x7D\xE8\xCE\x12\x13\x23\x80\x6C\x19"
+    "\x80\x87\xB0\x07\xF2\xC3\x62\x30\x64\x2B\xE0\x22\x90\xCD\xC9\x11"
+    "\xF1\x34\x4B\xE4\x07\x46\xB4\x5E\x6A\xC8\x74\x8E\x14\x2D\x22\x8E"
+    "\x93\xE4\x21\x63\xB4\x2C\xEB\x7D\x8E\x70\x9C\xE0\x94\x9E\xE8\xA9"
+    "\xAF\x54\x35\x3D\x71\x27\x66\xB2\x4D\x2C\x7D\x26\x86\x31\x55\x69"
+    "\xC9\x76\xF6\x15\x73\xCA\x3E\x2C\xA6\xF8\xC7\x6B\x74\x4F\xD8\xA7"
+    "\xD1\x7B\x03\x9B\x0D\x3D\xE8\xF0\x79\x4A\x2F\x77\x68\x48\xF9\x0B"
+    "\x0E\x9A\xFD\x00\xB8\xF0\x6B\xA4\xB8\x78\x5D\x56\xA3\xED\xEC\x16"
+    "\x2F\xDA\x26\x90\x25\xB3\x70\x3C\x94\x25\xD5\xD3\x58\x25\x0B\x28"
+    "\xB4\x3A\x00\xCC\xBA\x3E\x33\x92\xDE\x67\xFA\x8F\x38\x32\xB3\x83"
+    "\x7E\x08\x2B\x6C\x91\x57\x97\xF6\xA8\x70\xB5\xA6\x90\x4B\x62\x75"
+    "\xE5\x70\x4B\x87\x5A\x02\x3D\x7C\xF6\x44\xC3\x89\xFC\x74\xE6\xC5"
+    "\xA3\x1C\x35\xE8\x00\x10\x39\x97\x87\x90\xBC\xA3\xB6\xB2\xC1\xD5"
+    "\xC6\x9E\x8E\xD0\xD7\xE8\xC9\xAB\x26\x79\xF7\xE1\x2B\xFA\xC5\x5B"
+    "\x34\xA0\x65\x7C\x93\x37\x4D\x3D\x2B\x69\xC9\x04\x44\xF4\x9C\xB0"
+    "\x47\x84\x4F\x9F\xBD\x7A\xA4\x95\x29\x14\xB1\xA7\xF5\x0A\xE3\xEF"
+    "\xE5\xB8\x4B\x9A\x15\x44\x95\xE3\x0A\xDE\xCD\xC3\x43\xC5\xBE\x39"
+    "\x45\xE7\xB1\x7D\x93\x29\x46\x18\xC6\x86\x97\x62\xE7\x48\x29\x1B"
+    "\xFB\x34\x4B\x39\x99\x2F\xEA\xE3\xF1\x08\x8A\x15\xA7\x4B\xBA\x07"
+    "\xC1\x20\xB3\x36\x3F\xCC\x50\xF5\xCA\xDA\xB3\xD2\xED\xDD\x95\x62"
+    "\xA5\xEB\x79\x30\xAF\x67\x6B\x24\xEB\xF4\x7F\xD7\xC5\xEA\xE2\xA5"
+    "\x92\x4A\x63\x39\x63\xDD\x0B\xDB\x62\x4C\xB7\xD5\x21\x1F\x9F\xEF"
+    "\x81\xBE\x2F\x6B\x5D\x12\x2B\x1D\x21\x2B\xFD\x24\x55\x7B\x77\x96"
+    "\x59\x60\x21\x02\x54\x46\x7A\xCE\xC9\xE9\xD7\x55\x11\x8B\xC4\x9A"
+    "\x9C\xF5\x36\x38\x0B\x9A\xE3\xE9\xDA\x55\x0B\x4A\x88\x5A\xBD\x3B"
+    "\x0A\xC1\xFB\x3F\x54\x87\x11\xEE\xE7\x3B\x89\xF0\x0E\x98\xDE\xE3"
+    "\xF5\xC3\xE2\x08\x79\x9C\x77\x06\xC0\xF2\x13\xBF\x2E\x79\x63\x35"
+    "\x78\x9C\xB5\x28\x9B\xB6\xA8\xA0\xCC\x47\x64\x7E\xC6\x2B\xC1\xFC"
+    "\xDF\x6B\x84\x86\x73\xBE\x85\xC7\x11\x28\xA0\x67\x78\xFF\xC5\x74"
+    "\xED\x3A\x93\x60\xC8\x8C\x4C\x2D\x18\x6E\xA1\xAE\x55\x23\xCA\xBA"
+    "\x31\xD9\x1F\x63\xD5\x4E\x58\xD1\x65\xC4\xF6\xB3\x8F\x0B\x55\xB0"
+    "\x65\x4D\x48\xF2\x88\x18\xB0\x08\xE9\xC5\xC7\xD6\xA4\x53\x9E\x77"
+    "\x85\x75\xE8\x8A\x2E\x3A\x66\xB1\x41\x99\x10\xAB\x9C\xB8\x40\xE9"
+    "\xB0\x4D\x24\x55\x94\x05\xF5\xA5\xF6\xE9\x88\x84\xA8\x6C\xD1\xA7"
+    "\xA6\xAB\x55\x35\xBD\x62\x93\xE9\xB0\x30\xF7\x79\xBC\xD2\x6F\x8B"
+    "\x62\x89\xBE\x42\xEB\x8A\x83\x45\xE8\x2D\x5D\x83\xCD\xDD\x69\xE8"
+    "\x24\xCD\x25\x09\x6E\x26\x0F\xF3\x05\x4E\xA0\x86\x37\xC3\xCB\x45"
+    "\xC1\x15\xEF\xB9\x25\x77\x18\x8A\xEC\x3C\x3A\x69\x20\xF5\xF7\xF7"
+    "\x5D\xAA\xDC\x60\xC5\x7A\x29\xEB\x5D\xAB\x22\x0F\x78\xAA\xE6\x87"
+    "\x17\x45\x01\x15\x5C\x71\x74\xFB\xAA\x8B\x71\xE3\xF1\x92\x91\x52"
+    "\xA0\xA4\xD0\xEA\x7C\x9D\x75\xD9\x82\x75\x7D\x7A\x10\xE3\xBB\x74"
+    "\x35\xD5\x16\x89\xF8\x15\xF5\xF5\x89\xDA\xB0\xD2\x6A\x9A\xCF\xE7"
+    "\x8F\x70\x1A\x30\x99\x40\xF7\x1F\xCD\x4E\xF0\x2B\x28\xD3\x07\x35"
+    "\xBA\x8C\xC2\xDF\xF3\xD8\xCD\xAE\x4E\x18\xA4\xCC\x33\x88\xEF\x61"
+    "\xCB\xF0\x03\x59\x00\x62\x36\x6F\x23\xEA\x62\x88\x2C\xCA\xD9\x5B"
+    "\x06\xF2\x58\xEF\x2A\x92\x98\x80\x28\xEC\x06\xF1\xB0\x88\x83\xB8"
+    "\xEA\x45\xB3\x97\xCE\x02\xFB\x87\x3C\xF9\xB7\x90\x27\x2E\x4E\x37"
+    "\x26\x4E\x1C\x4E\xFA\x40\xD2\x64\x27\x90\x26\xBB\x11\x69\x72\x5D"
+    "\x71\x02\x53\xAC\x7E\x57\x5C\x5B\xA2\x44\xC1\x5C\x41\xA8\xC4\xD1"
+    "\xD9\x54\xAE\xF4\x41\x19\x22\x5A\x92\x23\xA6\x25\xCB\x1D\xF5\x0F"
+    "\x8F\xF9\xBB\xB2\x29\x0F\xCB\x45\xD9\x5E\xC8\xAF\xA4\xB0\x35\x27"
+    "\xF5\xD9\x26\xEA\x9A\x6F\x33\xD0\x3C\xA5\xE1\x74\x68\x6C\xFA\x67"
+    "\x34\x37\x5D\xF7\xA4\x9C\xCF\x8B\x2A\xA5\xAE\xD1\x51\x03\x43\x8F"
+    "\x2A\x6C\xBA\xE5\x2E\x75\x0D\x8A\x90\xE8\xC4\x16\x7F\xCD\x12\x15"
+    "\xF0\x54\x7B\x1D\x57\xB4\x39\x34\xB8\x99\x5A\x40\xF4\xE2\xDA\xB5"
+    "\x84\x0C\x8D\x56\xFB\x08\x52\xD4\x76\x5E\xB8\x96\x6B\x9E\x48\x2A"
+    "\x3D\xAA\x80\x2F\x80\xF0\xF5\x58\x58\x23\x62\xCE\xD8\x03\x56\xF3"
+    "\x6F\x81\x4A\x7F\xF0\xDB\xEF\x92\xDF\x04\x42\x11\x7E\x4B\x2E\x8B"
+    "\x09\x7E\x43\x68\x37\xC0\x6F\x3F\xA8\x33\x31\x94\xA7\x7C\x64\x86"
+    "\x5C\xB0\x2A\x2A\x3C\x1F\x2A\xC9\xC9\x1A\x97\xC9\xE4\x4D\x08\x23"
+    "\xDD\xE9\xD4\x8F\xC7\x06\x98\x8C\x9F\xF8\xC0\xCD\x67\xB3\xE0\xC7"
+    "\x43\x63\xCE\x1F\x29\x16\x2B\x9D\x4B\x52\xDB\x1F\x7E\x60\xC4\xB1"
+    "\x27\xE3\xBD\xCF\x28\xB9\x37\x3C\xC5\xB5\x4E\x3A\x4D\x64\x6A\x9D"
+    "\xE6\x2D\xCC\xBD\x46\x3D\xE1\xFD\x81\x62\x56\xAF\xE6\xA6\x9E\x85"
+    "\x4D\xC7\x17\xDC\xC0\xF6\x54\x9E\x92\xF2\xAB\x7B\xD7\x1A\xB5\xA1"
+    "\xE3\xA3\x0F\x7D\xAE\x34\x4E\xAE\xB1\x3E\x35\x5E\xD3\x8F\x39\x60"
+    "\x82\xA8\x37\x39\x6A\xA0\x70\x32\xCC\x9F\x7F\x76\x8F\x9F\xA6\x65"
+    "\x03\xFF\xC2\x84\x18\xBF\x2D\x2E\x02\x25\xD4\x2D\xDA\x14\xED\xDF"
+    "\xF1\x94\x68\x6C\x0E\xAB\xDC\xEF\xC7\xFA\x3B\x81\xBA\xE2\xFC\x7D"
+    "\x82\xDD\xD3\xEB\x05\xF7\x8B\x1E\x37\xE2\x8A\x2C\xC1\x17\xAB\x62"
+    "\x87\x25\x41\x87\x56\x67\x08\xED\xE8\x76\x7C\xEE\xC9\xE4\xE5\xD3"
+    "\xCF\x71\xD0\x79\x45\x42\x0C\x5E\xC6\xBE\x08\xC3\x93\xF1\x30\x07"
+    "\x9A\x60\x44\x09\x7B\x5D\x30\xC9\x62\x2C\xA2\xFD\x20\xF6\x3D\xC7"
+    "\x14\x3D\x45\x69\x1F\x30\x8E\x9D\x41\x8A\x7D\xC2\x24\xF3\x27\x71"
+    "\x1C\x18\xB9\x22\x79\xB0\x0C\x77\x58\xB3\xAC\x02\x87\xDC\xA7\xD0"
+    "\x0B\xC5\x83\xFA\x70\x8F\xA3\x54\xD1\x2B\x4D\x7C\x66\x79\x41\xFB"
+    "\xB3\xDC\xD0\x58\xB3\x91\x4B\x29\xBB\x1F\x1A\x93\xED\xC0\x9B\x43"
+    "\x6A\x9E\x33\x48\x0A\x5B\xB3\x26\x67\x79\xD8\x09\xA2\x9F\x20\x00"
+    "\x38\xCE\x4F\x61\x82\xD5\xF5\xD2\x54\x73\xAF\x8E\x01\xDF\x35\xC5"
+    "\xD7\x8B\x3A\x6F\xB9\x81\x29\x28\x21\xC0\x02\x53\xFA\x6E\xEF\x5A"
+    "\x25\x26\x10\x91\x9B\x8B\xDE\xEB\x2B\x6B\xC8\x29\xCB\x07\xF1\x0C"
+    "\xE4\xCE\xED\xC6\xBA\xDC\x87\x51\x37\x11\xD2\xA8\x9A\xCD\xE1\x8D"
+    "\x61\xEA\x79\x53\x4D\x6B\x3E\x35\xB7\x0D\x75\x9E\xB9\x8B\xA3\x75"
+    "\x7B\xF2\xAE\x0F\xD9\x4D\x37\xFC\x5E\x98\xCD\xE9\x87\xEE\x85\x6D"
+    "\x68\x70\x2F\x8C\xD7\x40\xD0\x8B\x5B\x96\x97\x63\x7E\x77\xD2\x28"
+    "\x41\x5E\x77\xF2\x45\xE0\x73\x87\x1F\x8D\xC7\x1D\x3E\x04\xFE\x76"
+    "\xAA\x84\x7D\x98\xC8\xD6\x8C\xCD\x87\x9A\x32\x4F\xF2\x12\xBF\x63"
+    "\x1F\x1B\xED\x79\x06\x33\xA7\xA4\xB0\x21\x51\x41\xF1\x3C\xF1\xFB"
+    "\xA8\xD4\x65\xD3\x45\xF5\x2C\xE1\x29\xD5\x1E\x41\xA9\x3F\xC5\x57"
+    "\xAD\xFB\xE2\x25\x49\xF5\xA7\xF8\x6A\xD7\x73\xF8\x6E\x1F\xA2\x25"
+    "\x68\x2C\x9D\x62\x3C\xBA\xB6\xAC\x10\xFB\x50\x4E\x3C\x75\xA6\x26"
+    "\xBD\xF5\xD1\x5D\x14\xAD\xEF\x4B\x41\x21\x19\x94\x67\x34\x82\x09"
+    "\x5D\x60\xDE\x15\xAB\x07\xF5\xE9\x29\x28\xE7\xDC\x0B\x73\x17\x57"
+    "\x1B\x82\xD4\x89\x97\xE3\xDC\xA2\xDF\x7C\x45\x7E\x3C\xDB\x9B\x78"
+    "\x9F\x28\xD7\x9F\xF0\xA4\xF1\x0F\xBF\x90\x3F\xFC\x42\xD2\x7E\x21"
+    "\xBF\x0B\x9F\x10\xC3\xFB\x5D\x8E\x16\x6A\x4E\x6D\x16\x7C\xE0\x0F"
+    "\x1F\x8B\x6E\x2E\xFA\xB5\xFA\x58\x38\x65\x62\xA2\xD1\xB6\xD7\xC7"
+    "\x0D\x7F\xF8\x3A\xFC\x71\x36\x19\x54\xFC\x5D\x9D\x4D\xFE\xE1\xEB"
+    "\x10\x3D\x9C\x64\xB1\xD1\xED\x1B\xF0\x00\xFF\xFC\xC3\x2F\xE0\x8F"
+    "\xB9\xF7\x87\x5F\xC0\x4D\xFA\x05\xA8\xA9\xD7\x77\x7C\xDE\x37\xFB"
+    "\x92\x9D\xFA\xE3\xE8\xFC\x8F\xA3\xF3\x7F\xAB\xA3\xCC\x3F\x8E\xCE"
+    "\xFF\xE0\xB7\x7F\xCF\xA3\x73\xE7\xC8\x04\xD7\x8B\xA8\x35\xBB\x29"
+    "\xE8\x10\xBD\xA1\x9B\x8A\x64\xB5\xA3\x54\x7E\x68\xC5\x13\x78\xEA"
+    "\x18\xB8\xD2\xBA\xC7\x39\x5F\x6C\xFC\xDB\xE0\x84\xD1\x16\x8D\x07"
+    "\xFC\xB3\x49\x4B\xB4\x85\x50\xB6\x78\x7F\xB5\xCA\x2F\xA6\x65\x43"
+    "\xFF\x8E\x43\x23\x62\x18\x6F\x37\x28\x32\x05\x4D\xF2\x11\xCC\x9A"
+    "\xB0\x76\xB6\xFF\x65\x64\xF5\x0D\x8A\x4D\x09\x3F\xFF\x82\xFC\xA5"
+    "\xEC\xCD\x1F\xD6\x77\xA7\x8F\x1F\xCC\xFA\x9E\xB2\x85\xDF\x71\x7F"
+    "\x99\x73\x5D\x3D\xF3\xBE\xDE\xB9\x45\xFF\xCB\xBE\x2B\x2E\xEE\xD0"
+    "\x89\x17\xF6\x66\x55\x64\x67\x27\xC5\x4A\x9D\x40\x36\x18\x6F\x07"
+    "\x05\x6E\x43\x87\xE7\x58\x3A\x67\x3B\x58\x45\x13\xA4\x6C\xE9\x2A"
+    "\xFA\x8A\x8E\xD0\x0A\x14\xA5\xB3\xB7\x53\x2C\xC5\x87\xED\x1E\x10"
+    "\xCA\x75\x95\x63\x34\xED\xAD\x79\x79\x74\xB4\x95\x61\xC9\xC3\xA2"
+    "\x3D\x2B\x00\x1C\x06\x7E\x96\xAE\x2C\x9C\x21\xA7\x04\xD8\xEA\x48"
+    "\x9C\x91\x65\x45\x8C\x8B\xED\xBB\xFD\x43\xCE\xA4\x12\x8D\x7B\x8E"
+    "\x37\x3A\xAA\x6B\x50\x14\x47\x87\xF9\x6A\xA4\x8B\x20\x10\x7D\xC6"
+    "\xD9\xB8\xA7\xFA\x54\x9C\xCA\x09\x4B\xBF\xD3\x8E\xCA\xF9\xF5\x52"
+    "\x21\xF1\xFE\xD2\x0D\xA5\x8B\x41\x99\xCC\xB7\x6C\x3A\x9D\x3A\xE5"
+    "\x2F\xE9\xE4\x57\xBD\x12\x44\x24\x2C\x8C\xA6\x69\xDF\xA7\x61\xA4"
+    "\xEA\xF2\x58\x11\x62\x54\x0E\xE8\xBA\xB8\xD0\x6F\xB9\xA8\xC0\xF6"
+    "\x20\x6F\x9A\x62\xD5\xE2\x7D\xFC\x7D\x2B\x25\xE9\x8C\xDF\xDB\x87"
+    "\x68\xB1\x87\x77\xF3\x6F\xA3\xB4\xE3\x6B\xCA\x23\x8E\x0B\x3E\x1A"
+    "\x91\x08\x8C\xB9\x57\xF8\xB1\xBF\xB7\x3D\xF1\x17\x35\x40\x1D\x2B"
+    "\x9D\x80\xAF\xD4\x1F\x61\xDE\xA2\x13\x8C\xAA\xDB\xE3\xD7\xF4\x29"
+    "\x07\x2A\x88\xBC\x66\x48\xCE\x3A\xA5\x25\x54\xCB\xEC\xFA\x77\xC5"
+    "\x10\x0E\x15\xF4\x81\xB4\x5C\xC0\x0C\xC9\x88\x4C\x56\xFE\x31\x8D"
+    "\x5F\xC3\xCB\x37\x00\x86\xEA\x45\x24\xE2\x71\x67\x7B\x83\x1A\xD2"
+    "\x13\xDF\xB6\xD7\xD5\x0E\xD4\x6F\x9C\x66\x22\x1B\x03\x06\x35\x05"
+    "\x50\x8D\x97\x4C\x40\xE6\xC2\x2A\xDA\x62\x75\x8A\x11\xA9\x29\xA5"
+    "\x1E\x12\xFA\x84\xE6\x73\x23\xA6\xFB\xC0\xA1\x91\x23\xA0\x9D\x73"
+    "\xAE\x4F\x0B\x3F\x74\xBD\x2D\xBA\x41\x6F\xEC\xC4\xBA\x7A\x87\x1E"
+    "\x88\x09\x7C\xE5\x3E\x19\x44\xAE\xDC\x2D\x9C\x42\x88\x23\x1F\xE2"
+    "\x19\x07\x23\x5D\x16\xBA\x5B\x94\xE8\x8D\x63\xC7\x10\x04\xAE\x6D"
+    "\x76\xF3\x9E\x03\xA2\xD7\x66\x6B\xC7\x57\x0B\x85\x8B\x20\xE7\xD5"
+    "\x46\x54\xF2\xE7\x04\xC3\x23\xE8\x1A\xF8\xB9\xAA\xD5\x42\xE3\x8F"
+    "\xBB\x4D\x95\xF9\xB8\x52\x4E\x4B\xF5\x6A\x8E\x39\x17\x5D\x12\xDB"
+    "\x2C\x39\x94\x2A\xC2\xAE\x63\x57\x67\x9F\x1F\xAA\xD9\x4D\x30\x50"
+    "\x7A\x52\x64\xFF\xF1\x1F\x8E\x8C\xBE\x3D\x8C\xD7\x5C\xF1\x62\x46"
+    "\xE5\xDA\x43\x6E\x5A\xEF\x10\x66\xA6\xB5\x21\xF2\xCC\x76\x27\x26"
+    "\xD2\x8C\xC1\x87\x8B\x81\xC2\x71\xE1\xF0\x08\x69\x20\xBA\x8C\xF6"
+    "\xD2\xA2\xAD\xA8\xC3\x21\x12\x98\x8A\x9C\x46\x05\xAE\x4E\x0E\x3E"
+    "\xEC\xEA\x70\x55\x74\x09\xC5\xDA\x8B\xBB\x06\xE8\xDF\x1C\xF4\xF7"
+    "\xB6\x88\x7F\x0F\xF6\x4B\x1D\xF4\x77\x62\xB0\x33\xB5\x16\x0B\x87"
+    "\x5A\x0D\x06\xA8\x39\xAD\xDF\x49\x8B\x56\x59\xA1\x33\x10\x95\xB7"
+    "\xC5\x90\xAA\x14\xBA\x9A\xCC\x91\x27\x0A\xB9\x69\x64\x06\xA8\x71"
+    "\x49\x0D\x32\x1A\xC5\xC7\x5C\x92\xA4\x9B\xE6\xF4\xAB\x51\xCB\x52"
+    "\x43\xAA\x4E\x21\x0F\x6A\xB7\xA4\xAB\x0F\x6F\x6A\x4C\x42\x52\x6B"
+    "\x8D\x33\x60\xCD\x26\x46\x2E\x8D\x59\x92\x60\xA9\x8E\x89\x16\xD5"
+    "\xEE\xD3\xE1\x72\xE3\xD6\x85\xAF\xCB\xAA\x6C\xCB\x7C\xA1\xD0\x30"
+    "\x4B\x88\x1E\x53\x3B\xA0\x73\xD7\x8B\xD5\x41\x94\x1A\x19\x8C\xA5"
+    "\x33\x86\x5A\x15\x36\xFA\x75\xCF\xBE\x33\x3E\x0D\x37\xD1\xE7\x70"
+    "\x36\xB2\x3C\x40\x7D\xD7\xF5\xFB\xF5\x6D\x61\x29\xD5\xCF\x32\x98"
+    "\x16\x9F\x82\xE6\xDF\x60\x00\x6F\x25\x72\x8C\x37\x01\x11\xCF\x58"
+    "\x9F\x28\x7D\x31\x43\x9F\xA8\xD9\xCA\x04\x3E\x76\xA4\x90\x2E\x69"
+    "\xA8\x35\x09\xA6\xB6\x5F\xDA\xE6\x04\xD5\xAE\xA9\xFA\x5C\xBC\x67"
+    "\xC5\xAA\xEA\x6A\x07\xCF\x18\x90\x31\x71\x2A\x47\xC6\xF9\x38\x41"
+    "\xFD\x9B\x11\x82\x29\xF5\xD7\xD2\x5A\x94\x1A\x26\xDA\x5E\x58\x21"
+    "\x8F\x0B\x06\x9A\x0F\x95\xD0\x92\x7A\x93\x59\xCB\x29\x45\x36\x1E"
+    "\x70\x64\xBC\x21\x72\xF7\xB8\x18\xC0\x8B\x62\x8D\x5A\x45\x6B\xB1"
+    "\xE8\x84\xA7\xFF\xD5\xF4\x7B\xCB\x4B\x1C\x90\xF1\x3B\xB1\x7C\x51"
+    "\x01\x90\x7D\x63\x9B\x81\x82\x32\x4A\x60\xE9\x29\x27\xA7\xBE\xA7"
+    "\x72\x39\x18\x92\x7D\x9A\xD9\x51\xD1\x3B\x5E\x87\x93\x05\xE8\xCB"
+    "\xF8\x48\x0E\x59\x6F\x69\x7D\x5E\x5E\x8C\xB7\x7B\xB6\x10\x8A\xCE"
+    "\xA0\x92\x9D\x50\xEC\x34\x68\x65\x79\xA1\x33\x6A\x3B\xBA\x29\x65"
+    "\xF7\xA0\x58\x6A\x73\xF6\xF8\x47\x86\x27\x69\xE3\x32\x74\x54\x20"
+    "\x2A\x74\xFA\xB0\x26\x79\xA2\x27\x17\xFC\x69\x41\xC7\x44\x4A\x71"
+    "\x8E\xFE\x82\x8D\x6F\xCD\x62\x46\x25\x23\x0F\xFF\xE9\xD8\x81\x8C"
+    "\xD6\xA2\x52\x51\xE9\xE9\x29\xCB\x08\x6D\x8F\x4A\x89\x67\x69\x0D"
+    "\x52\xAA\x35\x27\xAC\xA0\x3F\xDD\x34\x50\xFA\xAB\xFE\x53\x7C\x3D"
+    "\xB6\x5F\x8F\xC3\xAF\xEE\x0E\x98\x21\x88\x17\x2E\x1C\xB7\xE4\x71"
+    "\x47\x49\x57\x3D\xE4\xC2\xEE\xBB\x18\x64\xE4\x36\x09\x18\x9F\x13"
+    "\x70\x6D\x51\xE7\x95\x5B\xDA\x16\xF2\xBE\x09\x5D\x0D\xBE\x8B\xA7"
+    "\xA0\x8C\xF9\x2C\xBE\x38\xCA\x00\x14\x70\x9E\x23\xE5\x44\x11\xF9"
+    "\x15\xD7\x43\xFC\x84\xFF\xFA\xBD\x5C\x5E\xE8\xCE\x2D\x55\xDE\x94"
+    "\xCB\x7B\x8E\xE1\x4F\x31\xA4\x1B\xA7\x93\x78\x75\x95\x83\x98\xA1"
+    "\x15\x65\x34\xBD\xB3\x6E\xCB\x45\x5B\x16\xE8\xBF\x3A\x12\x05\x4D"
+    "\xC2\x52\x55\xA4\x8C\x94\xC9\x0F\x9B\xFE\x32\x24\xC6\x13\xC5\x3C"
+    "\x9B\x24\xE8\x35\xEF\x60\xB7\xA9\x8D\xE6\x81\x45\x52\x58\xDC\x84"
+    "\xC1\xFC\xA4\x6E\xDA\x89\xB6\xC8\xBF\xAC\x67\x6F\x0B\x63\xB8\x47"
+    "\x49\xB8\x5A\x57\xCA\x27\x8B\x4E\x3C\xAC\x37\x2C\xC6\x2A\x36\xF6"
+    "\xF9\x6C\x34\x8A\x7E\x79\xD2\xB0\x20\xD5\x09\x6C\x9C\x5A\x78\x03"
+    "\xA3\xA1\x18\x7A\x99\x35\xCC\xE5\x98\x36\x05\xCF\x98\x4C\x0A\x20"
+    "\x3A\x1C\x06\xD1\xFF\x72\x59\x14\x73\x75\x3A\x12\xA2\x73\x00\x5B"
+    "\x46\x2A\xE1\x55\x3C\xCD\xCF\x63\xAF\xC9\x08\xCD\xFB\x3F\x0F\x0E"
+    "\x86\xCA\x87\xC9\xB1\x58\x78\x35\x28\x94\xBE\xF8\x40\x5F\xC4\xE1"
+    "\xF0\x4B\x86\x18\x3F\x18\xE6\x6F\xF1\x43\x13\xFA\xE8\x1D\xE2\x18"
+    "\xEC\xF0\x70\xCA\xAE\xBF\x67\x65\x35\xAF\xCF\xA6\x98\xCA\xBA\x68"
+    "\xDA\xFB\x55\x79\x4A\x31\xA7\xBF\x06\x05\xA2\x18\x1F\x2C\x57\xF5"
+    "\xAC\x68\x30\x96\xE5\xF7\x75\xBD\x1C\x70\x79\xCE\xF1\x91\x48\x61"
+    "\x20\xE8\x23\x50\x98\xE1\xB9\xD4\xE2\xDA\x18\xC8\xFD\x4F\x4E\x56"
+    "\x6E\xD8\x17\x97\xF5\x1C\x03\xA7\x2F\x2E\x28\x41\x2B\x83\x34\xBA"
+    "\x33\x32\x0E\xF4\xBE\x7B\xEB\x8F\xAC\x06\xE3\x71\xBA\x4C\xE4\xA1"
+    "\xF2\x10\x1D\x9B\xF2\x92\x06\xAA\x8C\xE2\x56\x27\x37\x89\x51\xA2"
+    "\x78\xC4\x7D\x15\xEA\x8A\xC3\x74\x19\x1D\x9B\xB2\x79\x51\xE4\xF3"
+    "\x8B\xD4\x3E\xDC\x4C\x5A\xCC\x1D\xEE\xBC\x98\x9A\x9A\x89\xFD\x39"
+    "\x7B\x93\xE6\x86\xAC\x25\x4F\x47\xB2\xE1\x90\x6B\x24\x88\xD3\xAA"
+    "\x3E\x83\x51\x39\xD6\xBB\x71\xE4\xF3\xA2\x9A\xB3\x03\x04\x94\xA7"
+    "\xB3\x53\xAC\x8B\x2B\x8A\xF3\xC1\x0E\x97\x6C\x55\xCE\x17\x53\x7C"
+    "\xF3\x7E\x99\xBA\xBA\x67\x0E\x6C\x07\x97\x1E\xE0\x7F\xF3\x60\x3B"
+    "\x75\xF7\x8C\x58\x0B\x68\xF7\xF8\xC8\x25\x9C\x47\xAE\x39\xF9\x24"
+    "\x57\xBA\x34\xA8\x14\xCA\x3A\xEF\x13\x4D\xBE\x06\x92\x51\xFA\x7A"
+    "\x5D\xEB\x14\xB8\x04\x4D\xF5\x66\x63\x72\x78\xC1\x9A\x5C\xB1\x7A"
+    "\xC7\x2E\xFF\x08\x64\xEB\xD1\x8B\x17\xCF\x5E\x8C\xB7\xB7\x60\x91"
+    "\x00\xFE\x9A\x46\xC9\x2D\x10\xD8\x94\xDA\xB6\x6A\x8A\xD8\x03\x21"
+    "\x47\x48\xAD\x6B\x3A\x84\xF6\x28\x2D\xF6\xBF\x3C\x30\xD4\x6B\x22"
+    "\x94\xD0\x69\xF1\x7C\xB9\xCE\xCE\x28\x61\x17\x9F\x34\xE7\x15\xED"
+    "\xC1\x34\x15\x35\x5D\x32\x17\x7D\x82\x1E\x78\x85\x45\x57\x43\xFD"
+    "\x73\x7B\xA1\x00\x6C\xE4\x9E\x61\xFA\x66\xCD\x02\x0D\xD3\x08\xF4"
+    "\x8B\xAA\x20\xCC\xA2\xC3\xA8\x0E\x89\xAF\x8E\x6D\x70\xCA\xBC\x91"
+    "\x33\xC9\x03\x1A\x0A\x47\x0A\xD3\x60\x90\x2F\x1C\x9D\xC2\x27\x1C"
+    "\xA7\x61\x3B\xE2\xA2\x8D\x23\xF4\x2D\xBC\x8C\x9C\xDA\x93\x54\x1A"
+    "\x2F\x79\xAC\xAD\xF0\xF5\xFB\x15\x48\xE7\x50\x8C\xFA\xE8\x63\xF6"
+    "\xA3\x86\x74\x01\x1D\xC5\x9C\x90\x47\x66\x29\x5B\xE3\x8B\xD0\x7F"
+    "\x3F\xD8\xD7\x45\xFC\x82\x22\xC8\x35\xAB\x1E\xC9\x02\x5A\x37\x49"
+    "\x15\xF8\x6E\x99\xFE\x54\xA6\x3F\xCD\x13\xCB\x5E\x73\x51\xCD\x24"
+    "\xE6\xE3\xB3\x93\xA2\xC0\x10\xC0\x5E\x8F\x26\x06\xF5\x89\xC1\x71"
+    "\x02\xC8\xC0\xFF\x97\xF0\xFF\x8E\x25\xD0\xCD\xF2\x0C\xEC\x08\x73"
+    "\x10\x93\x45\xD1\x59\x22\xCE\x56\x4D\xEB\xD3\x1A\xB7\x9A\xB2\x30"
+    "\x9D\x74\x9F\x15\xCC\x3E\xD6\xD4\x15\x5B\xE5\xDD\x86\xCA\xA3\x71"
+    "\xA0\x10\xDE\xDE\xF7\x7B\x11\x78\xB8\x10\x13\x4A\xD6\xEF\xED\x84"
+    "\x0A\x0C\x2E\x79\x06\x33\x7C\x2F\x64\x69\x22\x3E\x9E\x59\x34\xC6"
+    "\x83\x6A\x89\xD3\xAC\x6A\xA9\x4F\x94\xDB\x3A\xD1\x89\xDB\xB7\xC3"
+    "\x7E\x84\xDD\xF0\xFB\xC1\x5B\x02\x74\xF2\x44\xD0\x4F\x69\xD0\xCD"
+    "\x48\xDE\xC5\xDC\x32\xDB\xFD\xE5\xED\x00\xEF\xFA\x89\x22\xE2\xE5"
+    "\x0D\x1B\xD8\x9A\xC6\xA4\x35\xA1\x25\x6D\x10\x9C\xEF\x96\xC3\x8A"
+    "\x95\xC3\x8A\xCD\x23\x39\x29\xBC\x47\xA4\x27\x8B\xD8\x53\xD4\x30"
+    "\x61\x84\xCC\xB4\xA3\xD4\x01\x78\xDD\x18\x5F\xBA\x93\xD5\x56\x6F"
+    "\x6A\xB6\x96\x10\xA3\xE6\x17\x94\x7A\x00\xF6\x7F\x8B\x12\xB6\xAC"
+    "\x64\xCA\xC2\x1D\x01\x93\xDF\xAF\x7A\x86\x0C\x5E\x36\xCD\x5A\x72"
+    "\x11\xCB\xAB\x69\x17\xD2\x72\x2F\x33\xB6\x0F\x98\x8A\x0E\x56\x51"
+    "\xCC\x71\x75\x20\x26\xA8\xFA\x6B\x9B\xE3\xF1\xD3\xDF\xF7\x3C\x70"
+    "\x76\x0F\x34\xB6\x0F\x1A\x5C\x59\xD9\x97\x76\xBE\x6F\x73\x20\x7E"
+    "\x05\xCE\xEF\x59\x5B\x40\xA7\x91\xA8\x24\x32\x61\x27\x8B\x89\x42"
+    "\xF1\x99\xCE\xE7\x08\xBC\x9D\x17\x4E\xE5\xA2\xA2\x79\xAD\x05\xFF"
+    "\x51\xBD\x02\xE5\x58\xF2\xBB\xFE\x82\xE9\x7E\x98\xAC\xDB\xBD\xF2"
+    "\x48\x31\xA0\x98\xDB\xB1\xEC\x33\x88\x37\x2C\x71\x38\x18\xF5\xD1"
+    "\x91\x3B\xAD\x93\xF4\xDF\x4D\xD3\x72\xD7\x5F\x46\x7D\xD5\x3D\xDD"
+    "\x39\x3D\x5D\x87\xCB\x59\xB5\x3C\xFF\xB4\x2C\xE7\xE3\x4F\xDE\x73"
+    "\x7D\xCA\xD9\xA3\x41\xF0\x83\x82\x42\x0F\xDF\x2D\xF9\x9F\x92\xFF"
+    "\x99\x5F\x6E\xFF\x94\xD8\xFE\xC1\xBA\xF0\xA4\x6E\xEB\x15\x6D\x6F"
+    "\xC7\xA7\xF8\xE7\xB3\xAA\xA0\x27\xC0\x0C\x1F\x5F\x9D\xD5\xF4\xE8"
+    "\xF9\xF4\x5D\x8D\x0F\xA2\x3C\x60\x11\xD0\xEF\x5D\xC2\xCB\x7D\xB9"
+    "\x87\xA1\x5B\xD0\xD9\xA8\xBB\xC8\xBB\x49\x68\x49\x0F\xCF\xD4\x51"
+    "\x25\xA6\x9E\x5A\xAF\x72\xB5\x39\xC9\x4E\x00\x08\x9F\x5C\x97\xED"
+    "\x85\xB3\x93\xC1\x5F\x22\x2C\x41\xAA\x23\x43\x09\xAA\xC7\xB8\xA1"
+    "\x61\x80\xD1\x94\xF5\x78\x7C\x65\xD5\xE4\x78\x32\x1E\xDF\x40\xD9"
+    "\x6F\xEA\xDC\x60\x81\x39\xC0\x30\x7D\xE4\xA2\x58\xE1\xE6\x7D\xC2"
+    "\x99\xE7\xBF\xAE\x57\x67\xF9\x2A\xCA\x6A\xC7\x00\x00\xB0\x38\xA7"
+    "\x96\x2F\xE8\xBF\xA6\x36\x3D\x49\x00\x80\x4C\x42\x6B\x7C\x49\xDA"
+    "\x38\x4E\xBD\x76\x51\xEC\x34\x94\x31\x57\x38\x80\x1A\xEE\x49\x2A"
+    "\x5E\x26\x63\x83\xAA\xC4\xBF\xBD\x6C\x0B\x15\x87\xAD\x49\xB6\x75"
+    "\xC4\x28\xE0\x9F\xAB\x02\x20\x35\x05\xFE\x89\x0C\x43\xAF\x90\x1F"
+    "\xB6\x52\xCA\x12\x31\x29\xEC\xCC\x99\x72\x7B\xD9\x11\x86\xA2\x60"
+    "\x7B\xDB\xEE\x74\x17\x11\xBC\x3B\xDD\x9D\xE0\xDE\x8A\x4B\x80\xC0"
+    "\x3F\x5A\x13\xD3\xAF\xEA\x16\x3A\x64\xE0\x6A\xAB\xB7\x17\x04\x46"
+    "\x23\x6B\x2F\x7F\x73\x27\x78\xA7\x2D\x6F\x22\x26\x74\x36\xA0\xDE"
+    "\x2B\x22\x5D\x30\x2D\x14\xA8\x89\x7E\xB6\xDA\xB5\xEC\xD3\xB6\xFA"
+    "\xF0\x3E\xFE\x99\x93\x17\xB3\x51\x73\xEC\x7C\x99\x20\x01\x26\xD8"
+    "\x7D\xB9\xC6\x36\xB0\xFE\xCD\x4E\xF4\x9E\x23\xD8\x6D\xE4\xD0\x1D"
+    "\x1E\x97\xBD\x88\xDB\xAB\xD9\x63\x40\x9F\xF2\xEA\xAD\xEE\xD1\x6E"
+    "\x98\xE4\xEE\x32\x02\x56\x0F\xF3\x06\x90\xBD\x0E\xB9\x84\xE9\x6F"
+    "\x51\x73\xD3\x06\x2D\xEE\x78\x4D\xEE\x6C\xDA\x26\xB1\xED\x35\x1A"
+    "\xDC\xB8\x8F\x34\x3D\xAE\x4E\xD3\x0D\x3A\xA8\xFC\x2C\x63\x6D\xE9"
+    "\x6B\x56\x05\x27\x22\x0F\xB8\x3E\x03\x61\x04\x0A\x27\x86\xA4\x3A"
+    "\xAE\xCA\x7F\x59\x4D\x6A\x2F\x1B\x65\x9F\xE9\x87\x48\xA0\x50\xD5"
+    "\x09\xCF\x8A\xE9\xE2\xD6\xB1\x63\x24\xD1\xF5\xCF\xFA\xA2\xC1\x0C"
+    "\xD8\x9E\xF0\x1A\x6B\x19\x00\x44\x6F\x8B\x62\x45\x5E\xF5\x52\xA2"
+    "\xA5\x04\x9A\x96\x3D\xBA\x3E\x9F\xE6\x2A\xD9\xB3\x67\x9A\xA3\xB4"
+    "\xBC\xEA\x5C\x71\xE7\xAE\x11\x46\x49\x49\xA6\x70\xB8\x1E\x34\x7B"
+    "\xB9\x5A\x21\xF7\xF5\xA2\x5C\x02\x34\xF5\xDE\x46\xC3\x2A\xAB\x77"
+    "\x78\x32\x61\xA1\x4E\x44\x0C\x34\xF8\xA7\xCA\x81\xF0\xF9\x42\x14"
+    "\x48\x36\xA5\x31\xFF\x70\x4D\xF9\x14\xFF\xFF\x30\x8D\xA8\xA5\x11"
+    "\x53\xC5\xCA\x7B\xF2\x81\xE1\x54\xA3\x2A\xAF\x3A\x81\x1E\x6B\x57"
+    "\x9B\x96\xB2\x44\x15\x78\xC4\x4A\x7B\x5D\x60\x5E\xCC\x1D\x05\x5C"
+    "\x89\x95\xB6\xFB\x46\xE8\x23\xB5\xFE\x01\x57\xA4\xFF\xAB\x98\x2A"
+    "\x58\x93\x1C\x96\x9E\xB8\x3C\x89\x0B\x55\x50\x10\xC7\x7C\xE2\x70"
+    "\x00\xAD\x67\x41\x39\xA4\xD9\xC4\xA1\xE0\x76\x66\x0A\xBE\x8F\xB7"
+    "\xEF\xAC\x6D\x1E\x66\x3B\x77\xED\xE2\xA6\x2B\xBB\x33\xC8\x59\x18"
+    "\xDD\x7E\xC8\xCA\x52\x1D\xCE\x97\xCB\xC5\x85\x18\xBA\x31\x0D\xDC"
+    "\xBF\x30\x47\x62\x85\xA6\x0D\xFA\xA2\x77\x93\x2D\x94\xC0\x03\x3E"
+    "\x39\x6A\x19\xD9\x05\xF2\xC3\xC6\x45\x77\x3B\xFB\x62\xDF\xA1\x44"
+    "\xCC\x0B\x5C\x76\x3B\xD8\x9A\x08\xC8\x4E\x5F\x08\xB2\x4B\x55\xDF"
+    "\xF7\xC6\xA5\x49\x14\x72\x48\x83\x23\x18\x48\xD9\xB0\x1C\xEE\x3E"
+    "\xE4\x77\xBC\xCE\x27\xFA\x22\x79\xA6\x0F\xEB\x1D\xAF\xD7\x09\x2B"
+    "\x10\x5A\x19\xD6\xA7\xB8\xD1\x87\x51\xE7\xCC\xD9\x68\xD8\xC7\x69"
+    "\x64\x4A\xD1\x09\x27\xAC\xD1\x1A\xB4\x83\xEB\x3D\xA7\x18\x2D\xAD"
+    "\x89\x72\x21\xC9\x34\x86\x3A\x33\x5A\x9D\x35\x38\xC5\x91\x79\x68"
+    "\xBB\x47\x11\xC0\x90\x67\x0A\xD6\xA6\xAB\x18\x31\xB8\xB5\x2F\xF7"
+    "\x71\x6F\x1F\xEC\x7E\x39\x1B\x38\x09\x85\x1D\x06\x3E\xAF\xCF\x2A"
+    "\xF5\x9A\xDA\x70\x6A\x08\xF4\x3F\xDD\x27\xC1\xB4\xE3\x12\xB6\x7F"
+    "\xBF\x8D\x84\xA2\x06\x27\xA2\x3D\x7A\x19\x36\x67\x89\xAA\x5A\xFB"
+    "\x2C\xD9\x9A\x43\xBD\x0A\xE0\x2A\xC3\x3F\x9B\x7A\xF0\x60\x04\x7D"
+    "\x85\x5B\x50\x5A\xEC\x62\x8D\x26\xBD\xC5\x0A\x0F\xC4\x88\xDE\x25"
+    "\x88\x4B\x64\x52\x32\x02\xB9\x33\x30\xA1\xF7\x18\xFC\x26\x82\x32"
+    "\x49\x5F\x1C\xBD\xEB\x01\x00\x4A\x6D\x18\xDB\x7E\x4F\x24\xCD\xB7"
+    "\x37\xDB\x0D\xE9\xC5\xC4\x92\xEB\xDA\x9A\x83\x18\xE8\x6B\xAB\x0D"
+    "\x88\x16\xAD\xE3\x37\xB3\x90\x4F\xB3\x87\xEA\x36\x8F\x3A\x38\x9B"
+    "\x26\x5B\xA6\x5E\xDC\x9C\x0A\xD1\xDF\xB2\x1C\x09\x5E\xD2\x3F\xD8"
+    "\x9A\xEE\x20\x83\x6F\x92\xC8\x10\x15\x3E\xAC\x82\xD1\x81\x4C\x5A"
+    "\xE5\xB8\xE6\x0E\x58\xCC\x43\x21\x62\x23\x13\x72\x22\x56\x23\xC3"
+    "\x8B\xCA\x8B\x61\x22\x78\xC4\xBC\xCA\xBC\x0A\x44\x3B\x90\x9F\x13"
+    "\x41\x4A\x12\xA7\x59\xA0\x6C\xA0\xE8\x66\x3A\x8E\x71\xCB\x6B\x27"
+    "\xB2\x6F\x40\x12\x5B\x76\xF4\x75\x6B\x6D\x6F\x10\x0F\xB2\xD6\xF4"
+    "\x4A\x9A\x89\xE9\x8E\xE8\xC6\xC4\xA0\x2C\xD0\x0D\xFD\x2E\x3C\x83"
+    "\x9B\x68\x7F\x92\x91\x4E\x60\x5A\x24\x7D\x40\xC3\xC4\x8B\x0C\xFC"
+    "\x5D\x08\x3C\x2C\x60\x9B\xEA\x93\x7F\x78\xE8\x12\x95\x6F\xE9\xB1"
+    "\x76\xCE\x05\x5D\x6A\xBB\x07\x44\x87\xEB\xA3\x23\xCC\x56\x49\xA1"
+    "\x5D\xA9\xA1\x0A\xD3\x77\xF9\xC6\xBA\x03\xF5\xE2\xFF\xA5\xF3\xCA"
+    "\xFD\xEC\xF5\x9B\x3E\xFA\x8C\xF8\xA8\x68\xE4\x98\x95\x03\xA3\x29"
+    "\xA0\x4A\x41\x0A\x31\x5B\x7A\x0C\xDF\x04\xEC\x95\xAE\x33\xA4\x81"
+    "\xEB\xDA\xF0\xA2\x96\xD6\xCD\x80\xF6\x8D\x30\x5B\xE7\xBA\xC6\x18"
+    "\xD4\x06\xE9\xBD\x73\x5C\xB4\x5B\x4D\x76\xB6\x82\x55\x18\x24\x4A"
+    "\x89\xFE\xAA\xB3\x53\x24\x1D\xBF\x5A\x71\x72\xE7\x1C\xDD\x1C\xD0"
+    "\x23\x9E\x05\xDB\x40\xDB\xE0\x4B\x46\x26\x2D\x8F\xAE\x23\x84\x34"
+    "\xBD\x9C\xB6\x62\x72\x01\xF4\xB1\xCE\x33\x79\xFF\xFB\xB4\xC3\x97"
+    "\x28\x51\x5E\x79\xF6\xC4\x4A\x47\x6B\x58\x2F\x8E\x54\x15\xFC\x45"
+    "\x5C\x1B\x1C\xDF\x8F\xD8\x2F\xF0\x03\xCC\xC4\x54\xC5\x8F\x0E\xAD"
+    "\x75\xF0\x3E\xE5\xBF\x51\x5B\x7F\x0D\xBC\xFB\x72\x0C\x7B\xAD\x69"
+    "\xB4\xA5\xCB\x54\x37\x6F\x27\x7D\x83\xBA\x3B\x8A\x72\x18\x35\xC7"
+    "\x7D\xF4\x38\xA3\x79\x01\xAC\x3F\x85\x37\x5D\x7D\x85\xF6\xDC\xD1"
+    "\xC7\x00\x10\x82\x00\x2C\x30\xC7\x08\x77\xC7\x75\x83\x04\xB1\xA9"
+    "\x0E\x19\xA6\x0A\xC0\xB7\x40\x9F\xF6\x10\xD4\xF9\x27\xE8\xDD\xD0"
+    "\x85\x2C\xFE\x44\x34\x6B\x24\x30\xEB\xBD\x20\xEF\xD8\x21\xBE\x38"
+    "\x2F\x66\x6B\xD8\x17\x68\x1A\x66\xEB\xAA\x2D\x17\xD9\x89\x6E\x02"
+    "\x17\xA4\xF9\xBA\x48\xB6\x10\xA7\xAE\x25\x94\x42\xF9\x47\x35\x41"
+    "\xF7\xB3\x9F\x70\xC6\x7E\xF2\x5E\x3A\x6C\xD2\x89\x80\x43\x1C\x7D"
+    "\x24\x90\xA0\xA4\x3B\x70\x91\x09\xA6\x9A\xEB\xA5\x8D\xCB\x81\x0E"
+    "\x0A\xE9\xA1\xF4\x2A\x92\xA3\x2A\x8C\x5B\x77\x05\xC7\x41\xD5\x8D"
+    "\xE8\x12\xFB\xC9\x41\xDB\x90\xF6\xE1\x5B\xF7\x4D\x74\xC3\x85\x3F"
+    "\xF6\x2A\xA2\xB8\x70\x52\xE8\xB2\x7F\x51\xC4\xEC\xDA\xE9\x1D\xA4"
+    "\x7F\x1F\x76\x8E\x77\x05\x73\x13\x76\xDB\xB4\x7D\xF6\xFA\x9B\xAC"
+    "\x1F\x69\x83\xAD\xF4\xDF\x31\xEE\x73\xA6\x53\x34\xEF\x28\x2F\x10"
+    "\x9E\x65\xCD\x2C\x87\x16\xEA\x75\x8B\x89\x44\xB5\xAE\x8C\xDD\x61"
+    "\x9F\x02\xCC\x59\x6F\xE3\xC8\x3D\x3E\x8A\x7B\x8F\x90\xD3\x8B\xAA"
+    "\x5C\x63\x54\x96\xE9\xD4\x1E\xB9\x63\x6B\x0C\x5F\xC2\x41\x13\x44"
+    "\x1A\xD6\xF2\xEC\xD4\x83\xF7\xF9\x5F\xFE\x12\x05\xF5\xC7\x4E\xF2"
+    "\x8F\x9D\xE4\x6F\x64\x27\xE9\x69\x5F\xE1\x16\xE9\xD7\xB3\x09\x94"
+    "\xB6\x40\x6B\x30\x16\x68\xC5\x2C\xCD\x8E\x65\xD0\xD6\x92\x3D\xE8"
+    "\xB6\x31\xFB\xF6\x55\xDD\x4B\x7F\xAD\x94\xD8\xED\x88\x6D\x5E\xC2"
+    "\xA6\x6A\x48\x13\xDC\x0A\x94\x08\xEF\x8C\x03\x03\x98\x12\xD0\x02"
+    "\x4F\xF9\x37\x4B\x4E\x14\xBB\x52\x7A\x9A\xF0\x34\x38\xF2\x3B\xF6"
+    "\x6E\x38\x4A\x5F\x59\x7B\x47\xD7\x02\x26\x41\x69\x57\x26\x45\xA2"
+    "\x11\x7F\xA9\xEA\x5C\xBA\x8C\xCA\x66\x57\x16\x0B\x08\x81\xE9\x57"
+    "\x31\xA1\x35\x89\x67\x92\x86\xDE\x7E\xFA\x4B\xB1\x9D\x0E\xB6\x01"
+    "\xBE\xFB\x5F\x4C\xD5\xA1\x7C\x3D\x4B\x29\x3D\xC9\x3B\xC1\xF8\x28"
+    "\xC1\x4C\xD4\x58\x87\x0B\x77\x88\x2D\xC0\xF2\x50\x94\x46\x04\x62"
+    "\x3A\xE1\x5D\x66\xFC\x9D\xB6\xA7\x6D\xFD\x75\x79\x0E\x5B\x94\xFF"
+    "\xF4\xCF\x78\x95\x2A\x92\x0D\xC5\x9C\xDC\x5B\xFE\xAE\x8D\xDC\xD0"
+    "\x00\x6C\x53\x8F\x31\xE0\x03\x97\x19\x3B\x03\xD8\xD1\x13\xF4\x10"
+    "\x1B\xD0\x1B\x2C\x26\xBC\x87\x3E\xCD\x10\xFE\x84\xFE\x3B\x20\xAE"
+    "\xA5\xB1\xE3\xF7\x0F\xBA\x34\x92\x7C\x29\x6C\x24\x1F\x7F\xD8\x63"
+    "\x08\x6B\x4A\x09\x2C\x85\x74\xBB\xD6\xC8\x7F\xD0\x81\x8F\xF5\x45"
+    "\x8E\x7C\x67\x7F\x68\xEC\x85\x43\xD8\xC0\xC1\x37\x7F\x4A\x39\xC2"
+    "\x8B\x50\x60\x5E\x1A\x30\x9C\xC6\xAF\x0B\xCB\xC0\xB6\xC9\xE7\x65"
+    "\xDA\x3A\x59\x49\xFD\x65\xB6\x4B\x6F\x82\x9E\xDB\xB7\xB6\xA0\xF6"
+    "\x01\x4B\x8E\x87\x71\x1C\x3C\x3B\xFD\x90\x4D\x3B\x46\x22\x27\x04"
+    "\x88\xF1\xE5\x96\xDF\x54\xBE\x8D\xA8\x61\x8E\xBE\xA1\xFD\xF4\xB9"
+    "\x32\x9F\xEA\x02\xBC\x19\xB0\x41\x1B\x41\x8E\xF3\x25\x84\xE6\xA4"
+    "\x5E\x2F\xE6\x9C\x73\xED\x24\x7F\x57\xC4\xDD\xF7\x1A\x7F\xFB\xF0"
+    "\xB8\xA2\xCB\x95\xE2\x22\x4F\xA5\x76\x07\xF1\x9B\x66\x8F\x8F\x9C"
+    "\x8F\xBE\x95\x97\x5C\xC3\x33\xD0\x75\x74\xF9\x00\x01\x52\x82\x38"
+    "\xE2\xEE\xDC\xC6\x24\xD0\xC5\xED\x85\x0A\xD8\xDA\xA3\xCA\x14\xD6"
+    "\x3F\x2B\xB5\xF3\xF9\xA7\xE8\x68\x4E\x35\xE6\x6A\xB7\x8F\x8D\xC7"
+    "\xFB\x6D\x5A\xC0\xE6\x71\x87\x36\xD8\xD5\x6E\x4F\x6E\x9B\xEC\x20"
+    "\xC6\x94\x66\x39\x60\x7B\x9D\x74\x4A\x82\x50\xBF\xF0\xA8\x80\xFB"
+    "\xD9\x9B\x8B\x2F\xCB\x06\x58\xF2\x3C\x93\xA8\x71\xA2\x93\xF8\xEF"
+    "\x07\x19\xD1\x6C\x60\x4A\x8D\x93\x13\xA4\x2D\x38\xF8\x9C\xD7\xD5"
+    "\x16\xA6\x63\xA1\x2B\x48\xAA\x49\xD4\x38\x40\xF5\x5D\xCF\xF3\xAA"
+    "\x75\x79\x52\x54\x44\x13\x13\x46\xEA\x74\x67\x87\x0A\x40\xB0\x1D"
+    "\x78\xA7\xE3\x0F\x23\xC4\x69\xAC\x6E\x7B\x15\x5F\xC7\xC0\x80\x4A"
+    "\x74\xF7\xCD\xF6\x76\x10\x37\x3A\x9C\x74\xF1\x85\x29\x26\xEF\xF9"
+    "\xD2\x04\x4D\xBE\xDC\x63\x43\xEA\xFC\x24\xAA\x1E\x30\x99\xF2\xF9"
+    "\xDC\xE5\xF7\xB2\x2D\x4E\x1B\x8E\xF4\x30\xA4\x79\x34\x03\x4A\xD4"
+    "\x53\x06\x23\xC7\xA6\x10\xE2\x13\xB7\xB0\x28\x4C\x6F\x87\xC4\x89"
+    "\x75\x28\x4D\x1A\x9A\x7B\xE4\x3C\x49\x91\xE7\x71\xF2\x3B\x7D\x86"
+    "\xDE\xC6\xCF\x8C\x04\x24\x8E\x0D\x69\x2E\xC4\xC5\x65\x84\x91\x2B"
+    "\xFF\x9B\x40\x32\x46\xBF\x21\xE4\xEB\x3A\x48\x49\xD0\x30\x60\x31"
+    "\xD9\x0E\x31\x6E\x9A\xD7\xA3\x51\xCB\x9D\x82\xCB\x75\x63\x3D\x51"
+    "\xA3\xAA\x09\x65\xBE\x19\xC4\xD5\xEE\xAC\xD9\x7D\x63\x2D\x89\xF7"
+    "\x34\xF5\x69\x79\x51\x53\x9A\xCE\x28\x16\x79\x8B\x57\x47\x62\xC3"
+    "\x90\x50\x2D\xA8\xA5\xD8\xD2\x26\xDF\xB9\x3D\x89\x1A\x11\x83\x6B"
+    "\x7B\xAE\x9D\x8C\x10\x4E\x47\xAD\x5B\x31\x37\x62\xF4\x23\xC3\x35"
+    "\x65\x15\x2E\x7C\xC1\x2A\x11\x06\x61\xDF\x09\xC2\xB0\x33\xFC\x92"
+    "\x36\xFF\x50\x06\xA3\xB8\x54\x45\xB7\xE4\xD6\x89\xAD\xEC\x32\xDC"
+    "\xB1\x08\x77\x42\x30\xE2\x3F\xA8\x8F\x18\x51\x5C\x9D\x84\x89\x21"
+    "\xB8\x70\x18\xB9\xC6\x1F\x13\xA5\x5D\xB1\xDE\x0B\x15\x6A\x55\x1E"
+    "\x4B\x76\x77\xAE\x83\xD2\x96\xC2\x56\x5F\x71\x22\x28\xA4\x68\xA3"
+    "\x68\xD2\x38\xB5\x70\x03\x2D\x6A\xFA\xC4\xF0\x2F\x57\xBA\x2B\x61"
+    "\x8A\x10\xB1\xDC\x09\xB6\xE3\xFE\x34\x6F\x4E\xCA\xA3\xC0\xDA\xBC"
+    "\xD1\x3A\xAB\x2A\x44\x8E\x0E\xBA\x0E\xC6\x3A\x56\xD7\xF4\x39\x03"
+    "\xDE\xE6\x2A\x88\x81\xD0\x71\xC8\x48\xD7\x09\x9A\xB7\xCB\x96\x2C"
+    "\xDC\x78\xEA\xD3\xE2\x51\x74\xB8\x94\x25\xC1\x76\xA8\xB9\xD1\x3A"
+    "\xF1\xC3\x82\xCE\x73\x86\xB0\x0A\x5E\x5A\x5C\xDB\x71\xA1\xD8\x66"
+    "\xC0\x95\xF1\xE5\xC2\x25\xD4\xBA\xE2\x51\xD3\x64\x4E\xED\xA0\x8C"
+    "\xF4\xB5\xD1\x0B\xFE\xE3\x3F\xB2\xDB\x1D\xA7\x73\x80\x14\x46\x98"
+    "\xB7\xB6\xF9\xAD\x26\x9B\x43\x55\x68\x86\xC2\x39\xAC\xB2\x23\x20"
+    "\x3C\x87\x2C\x28\xE7\x0B\xAF\xA3\x2A\xBC\xB8\x3D\x86\x27\x59\xBD"
+    "\x2A\x96\x45\xDE\x36\xCA\x25\x8C\x0F\x44\xEC\x99\xD8\xCA\xC6\x88"
+    "\x72\xE9\x28\x21\x8D\x2A\x8C\x0F\xB1\x3D\x8A\x1A\xCC\xD2\xB2\x57"
+    "\x6F\x80\xDC\xF8\x2C\x7C\x05\xC6\x93\x4B\x41\x9C\x96\x3B\x12\x84"
+    "\x08\x8B\xD2\x78\x5B\x24\xDA\x4D\xEA\x97\x51\x1D\xD7\xBD\x37\x62"
+    "\x34\x5D\xAA\xF8\xBC\x58\xCD\x82\x18\xED\x72\xBB\x6B\x55\x33\xD4"
+    "\x59\xAB\xB8\xD2\xEA\xDC\x67\xCD\xC6\x2A\xC6\xBC\x2E\x66\xE6\x95"
+    "\xAB\xA1\xDA\x02\xAF\xBD\x92\x4A\x31\x8D\x5F\x61\x6F\xBC\xF5\x9E"
+    "\x8C\xA1\x73\x3E\xFF\x04\xB8\x42\x64\xB0\x63\x88\x03\x83\x89\xC5"
+    "\x10\x64\xFF\xB3\x3B\xD9\xDD\xDD\xDD\x6D\x15\xF3\x99\x4D\xFB\x00"
+    "\x70\xD7\x3B\x9E\xC8\x12\x9B\x6B\xB1\xC5\x45\x16\x53\xFE\x85\x7A"
+    "\xBB\xA2\x4F\x68\xD1\x48\x8E\xFE\x0C\xD0\x00\x6E\x52\x0B\xAF\x77"
+    "\x36\xC1\xCC\x4F\x1A\x98\x39\x49\xE5\x7C\x7C\x88\x76\x31\xDF\x93"
+    "\xAF\x45\x73\xDC\xDD\x62\x3E\xFD\x29\xCA\xA5\x4A\x98\xBB\xCC\xC0"
+    "\x3D\xA6\x43\x39\x7F\x75\x0A\x55\x00\x91\xA5\x0D\x0F\xFB\xDC\x8B"
+    "\x19\x78\x1E\xA8\xB9\xDE\x84\xF5\x6C\x06\x2F\x7D\x92\xD9\xFD\xF5"
+    "\xC7\x43\xD9\x0B\x7B\x90\xE0\xB5\x98\xF5\x83\x43\x75\xD7\xED\x89"
+    "\x4E\xD5\x53\xC7\x8C\x3D\xFE\x72\x65\x40\x07\x2B\x95\x8A\x82\xA8"
+    "\xEE\x81\x2A\xDE\x32\xA5\xE4\x52\x79\x3B\x72\x81\xCB\x9D\x88\x31"
+    "\x49\x98\x14\xCF\x22\xC8\x45\xBB\xBA\x50\x87\xFD\xA8\x86\xAE\xE2"
+    "\x33\xC6\x97\xD7\xF7\x62\x93\x42\x17\x62\x74\x12\x36\x9D\x74\xC2"
+    "\x01\xE5\xBA\xA2\x63\xB4\xAD\xDC\xC0\x6A\x74\x14\xAD\xA3\xFE\x7B"
+    "\xC1\xFE\x55\x8C\x7F\x27\x5C\x1B\x2D\x17\x04\x8B\xFE\x72\xBE\xA9"
+    "\xC5\x83\x5B\xE2\xBF\xBD\x20\x67\xA6\x80\x7D\x70\x83\xBC\x91\x3B"
+    "\x0B\x07\x79\xA3\x3F\xDD\xFA\xFA\xAB\xFE\x73\x40\x30\x31\xDA\x8D"
+    "\x61\x0C\x33\xFC\xD7\x69\x6B\xD1\x52\x3B\x0B\x59\x3A\x26\x98\x29"
+    "\x1F\x6F\xF8\x5A\xD4\x8A\x4D\x07\xA8\x15\x7B\xED\x04\x9E\xF3\x18"
+    "\x8F\x62\xCF\x79\xEF\xBC\xF2\xDE\xBD\x0E\x55\xC3\x7B\xEB\xB7\x61"
+    "\x8F\xE5\x74\x0B\xC2\xBF\xD0\x2D\x2B\x7C\xFB\x54\x59\xF1\xC6\x2B"
+    "\xEB\x3B\xD7\xA9\x0A\xFE\x6B\x59\xCB\x8B\x6F\x81\x35\xBC\x57\x5E"
+    "\x69\x7B\x57\x57\x95\xB5\x2F\x3C\x6C\x3C\xA7\x39\x85\x8C\xF7\xB6"
+    "\x23\x81\x84\x0D\xE9\xF6\x84\x03\xD2\x7C\xB5\xB6\xD9\x90\x55\x8C"
+    "\x9A\x83\xC3\xB5\x9F\x3F\x99\x07\xCB\x4D\x7F\x6C\xAA\xB1\x3E\x71"
+    "\x40\xB9\x94\x6D\x22\x9F\x28\x84\xEF\x8A\x8B\xC3\x3A\x5F\xCD\xD3"
+    "\x50\xDE\xAA\x12\x1D\x90\x60\x58\x53\x98\xC0\xA7\x1E\x3C\x34\x13"
+    "\x25\x20\x68\x2F\x81\x28\x94\x5B\x2A\x41\xC5\xAC\xAE\x57\x30\xA7"
+    "\x29\x6E\xAE\x0E\x69\xA9\xE3\x5B\x52\x0A\xAF\x5C\x2D\x3B\x22\x01"
+    "\xB1\x05\xD5\xDC\x0A\x82\xE0\x21\x32\x4F\xF2\x0A\x68\x1F\x4B\x2A"
+    "\xCD\xCB\xD9\xA9\x19\x2F\xF5\xA2\x8D\x8C\x89\xF3\xC9\x23\xB6\xFE"
+    "\x16\x90\x4F\x7D\xF8\x67\x94\x32\xEA\xE3\xB1\xE2\x30\xF7\xE3\x76"
+    "\xA6\xF2\x56\x53\x0E\x3B\x8B\xA1\xCE\xED\x8B\xD7\xEF\x8D\xE7\x9E"
+    "\x90\xDF\x5F\xBF\xB8\xFF\xE4\xD1\xC1\xC3\x47\xDF\xDF\xFF\xC7\xC1"
+    "\x93\x97\x20\xC9\xFF\xBC\xEB\x7C\x7F\xF5\xC3\x8B\x57\xDF\x3F\x3A"
+    "\xB8\xFF\xE0\xD5\xE3\xBF\xDF\x7F\xF5\xE8\x21\xAE\xEE\xAF\xEE\x7F"
+    "\x65\x5F\x8C\xFF\xA4\xEE\x71\x2B\xB2\x6E\xAB\xB8\x4D\x4E\xF5\x87"
+    "\x8F\x02\x00\xE2\x55\x0F\x88\xFB\x4F\xBF\xEB\x6E\x1F\x9D\x7D\xD2"
+    "\x55\x7B\xDB\x4E\x56\xFF\xBF\xCF\xFE\xF1\xF2\xD5\xE3\x07\xDD\xAD"
+    "\x9B\xAB\xA0\xDD\x20\xFA\xB0\xE8\x06\xF3\xCD\xB3\x57\xCF\xBE\x79"
+    "\x76\xFF\xFB\x4E\x4C\x90\x31\x76\x8E\x81\x33\x7A\x60\xF4\xA1\x12"
+    "\x85\x63\xF5\xBD\x48\x52\xDE\x21\x69\x4D\xFB\x93\x87\x26\x73\x87"
+    "\x5A\x6E\x9E\x36\xEB\xC3\x66\xB6\x2A\x0F\x8B\xB1\xCF\x98\x13\x92"
+    "\xAB\x9E\x3E\xD3\x55\x53\xF4\x79\x83\xBA\x0E\x33\x6E\x58\xEF\x4A"
+    "\x2D\x86\x4C\x78\x85\xBA\x57\x6A\x39\x64\xBA\x2B\xD4\xED\x6A\x79"
+    "\x83\x3C\x62\xE9\x9C\x9D\xFD\xA9\x31\x87\xF0\x15\x68\xBC\x1A\xF7"
+    "\xFB\x8B\xC5\xF8\xEA\x88\xF6\x64\x84\x8E\x27\x84\x76\x4D\x04\xA0"
+    "\x22\x56\xF3\x45\xA1\xD1\x53\x4A\x81\x40\x56\x97\x7B\x5C\x61\x2C"
+    "\x15\x90\x1A\xEB\x05\x68\x9A\x1C\x5C\x08\xD7\x3A\xAB\x22\xD0\xA6"
+    "\x10\x10\x7B\x87\x0B\x9F\xAE\x46\x67\x06\xEC\x10\x5A\xCA\xF9\x4C"
+    "\x96\x40\x0A\x50\xC4\xEE\xC1\x85\xAE\xE9\x55\xAC\x97\x4E\xBD\xE8"
+    "\x7E\xAD\xAE\x94\x52\x33\x56\x78\x4F\xB2\x79\xDE\xE6\x4E\xC4\x37"
+    "\x3A\xFA\xC8\x74\x81\x68\xE0\x08\x7F\x92\xC7\x02\x05\xE0\x40\xC7"
+    "\x16\x60\xB2\x2F\xC5\x3E\x4C\x3B\x93\xAE\xEB\x5F\xB4\xA6\x2F\xDF"
+    "\x86\x18\xD7\x2C\x7E\x9E\x16\x20\x10\xF4\xBE\x6C\x82\xA1\x5F\xF5"
+    "\x2A\x28\x72\x70\xD7\x27\xF5\xBC\xA0\xE0\xA7\x07\x0C\x59\x3F\x27"
+    "\x63\x28\xA4\xDC\x25\xF0\x27\x87\x4F\xC8\x80\x4D\x07\xF0\xC6\xC7"
+    "\xCF\x11\x23\xD7\x1E\xBE\x0F\x30\x7A\x1B\x23\x78\x80\x75\x3E\xC0"
+    "\xD8\x39\x2B\x5D\x72\xDC\xC2\x1D\x00\x71\x75\xF0\x7A\x20\x51\xC2"
+    "\x7A\xEB\x25\x08\x0E\x4E\x6B\x49\x57\xA3\x6E\x86\xC1\xA1\x9D\x1B"
+    "\x22\xD1\x10\xE6\x8E\x12\xE9\x06\x69\x74\x03\x5C\x73\x23\x04\x09"
+    "\x75\x95\x14\x49\xE2\x3B\x1C\xE2\x9D\xF8\xA7\x61\xB4\x49\xD4\xFD"
+    "\x20\x3C\xA4\xDB\xBA\x41\xB2\x0D\xE0\xA5\x34\xE1\x3E\x00\xDD\xAE"
+    "\xCF\x57\x37\x47\xA4\x50\x1B\x4D\x91\x28\xBE\x41\x26\xDE\x8A\x7F"
+    "\x1A\x46\xA3\x44\xDD\x1B\xE1\xAD\x4D\x69\x30\x80\x51\xD2\x54\xF8"
+    "\x00\x44\xB8\x02\xA3\xF4\x77\x79\x40\x70\x28\x3C\x22\x19\x45\x2D"
+    "\x62\xEB\x8A\xB5\xE8\xB9\x56\x9C\x39\x2C\x94\x56\x36\xFD\x76\x3D"
+    "\x55\x5F\x9C\x6F\x1C\x9C\x2A\xD6\xC5\xEB\x60\xEB\xC5\xE2\x9E\xAB"
+    "\xE8\x7A\x52\x01\x0B\x7B\x61\xF3\xC5\x74\x70\x02\xC6\x53\xB0\x57"
+    "\x01\x9C\xAA\x6E\x16\x38\xFE\x34\x9C\x55\x9D\x5B\x15\x1F\x73\x81"
+    "\x1A\x82\x52\x3D\xF4\xCF\xF6\xCB\x06\x4B\xBD\xE0\xB4\x0F\xE3\x2E"
+    "\x34\xE3\x39\x00\x22\x58\x12\x69\xA2\x84\xDD\xB0\x0F\x21\x6E\x91"
+    "\x4E\xB0\xC7\x95\x75\x43\xC9\x16\xD8\xAA\xCE\x63\x21\x7D\x73\xB8"
+    "\x64\x55\xE3\x41\xC8\xAC\x3C\x2A\x67\x34\x2A\xEA\x9E\x00\xBE\xE0"
+    "\x94\x8D\xE5\x91\x78\xD6\x25\x14\x3C\x1F\x77\x31\xC6\x74\x15\x54"
+    "\x74\x7B\x5F\x0D\x3A\x9E\x86\xDE\x66\xBA\xDE\x0B\xD8\x0F\xCF\xCB"
+    "\x88\x90\x36\xD4\x8E\xED\xBE\x2F\x5E\xE3\x79\x0B\x50\x1C\x78\x94"
+    "\x0A\x05\x73\xE4\xD0\x89\xC2\xC7\xD3\xA9\x38\x07\xB7\x55\x67\x4D"
+    "\x7C\x0E\x8C\x66\xD1\x45\x9D\xB3\x75\xF5\xD1\xCB\xE7\x7F\xFE\x9C"
+    "\x5D\xA0\x14\xAB\xBA\x1E\x0E\xE8\xC4\x61\x32\x30\x7C\xB9\x2F\x7A"
+    "\x15\xF5\xBC\x92\x7D\xB6\xF5\x3E\xF3\x8C\x95\xFA\xDA\x2B\xC7\x18"
+    "\xBD\xBB\xCB\xF8\x36\x78\x7D\x57\x1D\xAD\x46\x04\x63\x62\x01\x4D"
+    "\x3A\x08\x0A\xEB\xEF\xB4\x33\xCE\x95\xFF\x4B\x2C\xA9\xC7\x45\x7B"
+    "\xFF\xBC\x6C\x9E\x55\x1C\xF6\x67\xEC\x45\x20\x1D\x0E\xE1\xD5\x59"
+    "\x7D\x4D\x08\x80\x03\x5E\xEC\xB9\x16\x0A\xD7\x03\x00\x18\xA0\x6B"
+    "\xFE\xB5\x30\x60\x00\xD1\xFA\xBD\xEB\xD0\x65\x4C\x88\x25\x64\x6D"
+    "\x87\x26\x13\x8F\xF5\xEB\xE8\xD4\xC3\x27\xA6\xA3\x89\xFF\xBB\x4C"
+    "\xCA\x70\x4F\x33\x78\x42\x46\xEF\x00\xFA\xBF\xC8\x9E\x69\x83\x89"
+    "\x98\xAE\x3D\x64\x12\x76\xB6\xDD\x37\x7F\x3A\x9B\xBE\x7A\xE5\x01"
+    "\x13\xAF\xB3\xE5\x8F\x35\xE9\x12\xDB\xD2\xD4\x84\x73\x4C\x1F\x1B"
+    "\x4C\x39\xD7\x64\xF2\x1B\x9C\x74\x9B\x4D\x38\x67\x0E\xA5\x9C\x81"
+    "\xB2\x6C\x03\x7F\xA0\x2B\x8D\x6D\xCA\x50\x35\xC8\xCB\xC4\xDD\x65"
+    "\x69\x77\x12\xF3\xC2\xF3\x2B\x71\x0B\x8A\x67\xC7\x9B\x44\x96\x12"
+    "\x4F\xA2\x8C\x31\x6B\x43\x09\xF3\x77\xC7\x19\xFF\xAD\x5B\xE4\xFD"
+    "\xFB\x69\xF6\x12\xE0\x80\x3A\x07\x5C\x8A\x5E\xFD\xF5\x62\xEE\xDD"
+    "\x34\xD5\xF9\x29\x3F\xBD\x73\x8B\x7B\x2C\x5D\x14\x90\x46\x18\xBA"
+    "\x7C\xAC\x59\xDD\x9C\x2C\x70\xD9\x03\xB5\x53\xA2\x98\x05\x94\xAB"
+    "\x15\x0A\x0B\x62\xE9\x2B\x7C\x7B\x1C\xBF\xD9\xF9\x51\x56\xA1\xBC"
+    "\x59\xAF\x4C\x32\x66\xF4\x4D\x83\x1A\xE5\xFA\x54\xE1\x58\x1F\x71"
+    "\x80\x72\xCB\xC8\xFA\x22\xE0\x06\x00\x39\x1A\x82\x0F\xD1\xDE\x8E"
+    "\xF8\x6E\x19\x03\x66\x40\x3A\xD4\xC2\xFD\x1D\xB0\x2D\x3A\x11\x60"
+    "\x3C\x20\x74\x79\xB2\x70\xCA\xCD\xE0\x94\x55\x5B\x1C\xAF\x02\x28"
+    "\xD1\xAE\xA5\xA1\xCC\x8B\x15\x9E\x94\x94\xEF\x0A\x0B\xE7\xD2\x3A"
+    "\x66\x0E\x48\x56\xC7\x01\x1D\xF7\xB3\xD7\xEF\xA7\xD3\x69\x38\xA0"
+    "\x97\x93\x2C\xF1\x21\x70\xF5\xF4\xDA\x42\x5E\x31\xFE\xEA\xDE\xB7"
+    "\x7B\xFE\x7E\xAA\x29\xDA\x1F\xBC\xEA\x1D\x37\x19\xFB\x53\x95\xD8"
+    "\x49\xDD\x7B\x70\x86\x2C\x07\x1C\x42\xB5\x39\x1B\xC2\x53\x4F\x28"
+    "\xEA\x4E\xD0\xC7\xD7\x44\x82\x66\x0A\x22\xA6\x38\x17\xE5\xDF\x4C"
+    "\xDD\x94\x17\x61\x07\x9F\x44\x1B\x92\x69\x33\x44\x0F\x07\xB6\x85"
+    "\xDB\xF7\x20\xD3\x46\x7F\x97\x79\x52\xDC\x40\x97\x4D\x5A\x8E\x44"
+    "\x97\xA3\x0D\xC9\xD4\x1E\x1B\x74\xD9\xA6\xBB\x70\x9B\x1D\xD4\xE5"
+    "\xEF\x96\xD7\xEA\xE8\x77\xCB\x54\x17\x25\x60\xCC\x98\xB1\x49\x97"
+    "\xBE\x43\x13\x84\x06\x3D\xAC\x1B\xE5\x87\xEA\x46\xE9\x74\xA3\xDC"
+    "\xA8\x1B\x98\xA3\xF8\xBB\x72\x93\x6E\x5C\x8F\xED\xBE\x4B\x32\xDC"
+    "\x77\x0E\x9B\x7D\xB7\x11\x83\x7D\x87\xAC\xF5\xDD\x00\xA6\x92\x79"
+    "\xC8\x94\xA3\x36\x4B\x51\x93\x47\xBD\x3E\xFC\x67\x31\x33\x77\x61"
+    "\xF4\xBF\xFE\xD5\x56\xD3\x78\x22\x49\x56\x5B\x3F\x23\x38\x9D\xB4"
+    "\x72\x75\xB7\x91\x27\x07\x41\x5D\xF0\xC5\xB2\x05\xE6\xEA\xE0\x23"
+    "\x2D\x48\x46\x7B\x29\x99\xE8\x57\x50\xD3\x70\xB4\x97\x92\x28\x5E"
+    "\x85\xEF\xD0\xCF\xD6\x99\x89\x7E\x81\x12\x0B\x94\x1D\x05\xB0\xB1"
+    "\xEF\xE2\x4D\xD8\x5C\xCE\x9D\x0A\x5C\x2F\x85\xDC\x8C\xC9\x3F\x04"
+    "\xC5\xC3\x97\xA2\x86\xA4\x9C\x47\x48\x17\xEE\x13\xB7\xA0\xF7\x46"
+    "\x42\x14\xA4\xF5\x28\xED\x41\x74\x0B\x7A\x6F\x44\x59\x35\x0C\x6E"
+    "\x6D\x7A\x49\xFF\xCA\x92\x3C\x1E\x5E\xC9\x52\x95\x94\xEF\xD5\xC0"
+    "\x78\x25\x15\x1E\xCE\x7B\xCD\xD5\xF0\x49\xFF\xA9\x15\x59\xFC\xAF"
+    "\xAB\xC7\x6E\xA3\xE9\xDA\x7A\x6E\xBE\x50\xA9\x95\x59\xD7\xD4\x0E"
+    "\x9B\x3A\xE1\xF2\x01\x2B\xB3\xAE\xB3\x27\x6E\x25\xA9\xF8\xAB\xBA"
+    "\x5E\x58\x3F\x57\xF2\xED\xA4\xF2\x07\x2D\x7E\x88\xD4\xA2\xF4\x5E"
+    "\xB4\x71\x88\x54\x7D\x67\x3E\x26\xEB\xFF\x58\xCE\x61\xE3\x1A\xA9"
+    "\x7B\x46\x1F\xA2\xF5\x5E\xE4\xD5\x71\xC1\x15\x23\x9E\xA9\x2B\xFC"
+    "\xAA\xAB\x27\xDD\x5B\x79\x6E\x50\xE8\x24\x53\x53\x05\xFC\x23\x0F"
+    "\x56\x76\x60\x25\x27\x55\xA1\x49\xA2\xB2\xEC\x6E\x0D\xDA\xFC\x30"
+    "\x5B\xE6\x55\xB1\xA0\x1A\xBC\x9D\xF8\xFB\x06\xB5\x48\xF2\x59\xA9"
+    "\x27\x53\x3D\x5F\x3A\x5B\x41\xA7\x98\xB9\xF7\x8F\x97\xFE\xAA\x16"
+    "\x94\x5A\x68\xA6\xA3\x80\xDA\xA6\x44\x8A\xBC\x7E\x43\x85\x9E\x68"
+    "\x55\x89\x2E\x88\x3E\x7E\xCA\xC9\xC9\x76\x54\xFC\x9D\x0A\x2F\x38"
+    "\x00\xB3\x01\x17\xD6\xDC\x9D\x22\x9F\x9D\xE8\x98\xE0\x29\x90\x5A"
+    "\x15\x11\x20\xF3\xF3\xEC\x3A\x20\xBF\x5B\x3E\xA6\x7A\x02\x24\x68"
+    "\x07\x74\xA9\xE2\x8A\x00\x4B\x06\x98\x2E\x30\x37\x05\x84\x2F\x32"
+    "\xF5\xCB\x35\xBF\x24\xDD\x91\xE5\x10\x4D\xBC\xF1\xB0\x45\x9E\x98"
+    "\x38\x2E\x82\x72\xF6\xB3\xEA\xF8\x44\xE0\x3C\x11\xE8\x6D\x1B\x72"
+    "\xC4\xA7\x86\x26\x4B\x73\xEB\xBD\x14\xFB\x6A\xBB\xA2\xF7\xA4\x56"
+    "\xFC\x7B\xB2\x7E\x4F\x84\xDD\x32\xC1\x3C\x70\xA7\x8C\xD1\x03\x38"
+    "\x93\x18\x46\x52\x4B\x27\x68\x4B\xFD\xD0\x76\xA3\x63\xB1\x79\xC0"
+    "\x56\xF9\x99\x0C\x95\x47\x26\x9B\xAA\x0E\xA0\xDF\xF8\xE6\xB9\x07"
+    "\x5D\xBE\x74\xA3\x42\xA4\x9D\x9D\x94\xC0\x61\x68\x57\x22\x20\x1C"
+    "\x2F\xA7\xD9\x0E\x90\x23\x19\xE9\x10\xD1\x89\x89\x02\xC5\x3C\xF1"
+    "\x30\x63\x86\xC1\xC3\x30\x12\xA1\x32\x49\xCA\x50\x92\xF6\x00\xC6"
+    "\x19\x13\x83\xFD\x01\x8C\x07\x7D\x24\x65\x87\xC6\x43\xBC\x9A\x8F"
+    "\x29\x13\x4E\xEA\x5A\x65\x80\x04\x1A\x17\x36\x56\xA3\xBE\x38\xD0"
+    "\x9E\xD5\xAA\x89\xED\x00\xEB\x3E\x4A\x1B\xF9\x73\xD3\x94\xEE\x00"
+    "\x9C\xA2\xF4\xEF\xCF\xA6\xC2\xBD\x52\x63\x80\x34\x0F\xF9\x47\x8F"
+    "\x84\xD7\x99\x9B\x1A\x07\x13\x45\x86\xE8\x32\x08\x13\x87\x1C\x1F"
+    "\x04\x8F\xF9\x20\x3C\x3C\x82\xDE\x34\x26\x97\xF7\xCC\xA5\xCF\xA6"
+    "\xC0\x95\xAE\xD5\xF7\x71\xFC\xA5\x32\x33\x86\xCB\x46\x2D\x0C\xAF"
+    "\x4D\xAB\x8E\x6A\x39\x96\xEB\xC7\xB6\x08\x18\xD3\x51\x8A\xCA\xBC"
+    "\x11\x17\x16\x0E\x66\x46\x7F\xD9\xB7\x19\x6A\x85\xE9\xAD\x91\xE9"
+    "\x38\x4F\x8A\xD9\xDB\x44\x39\x2D\x6C\x5F\xA1\x39\x3C\x51\x44\x49"
+    "\x89\x8E\x22\xDF\x2D\xBF\x01\x64\xBA\x0A\x94\x7D\x05\xE6\xF1\x02"
+    "\x02\x0D\x65\x30\x8E\x7E\x44\x93\x7E\x8F\x31\xD2\x5B\x9D\x1F\x60"
+    "\xE6\x66\xB2\xF8\xF8\x05\xF1\xF2\x2F\xDE\xAA\xA4\x60\xC9\x78\x1B"
+    "\xC4\xDF\x98\x47\x02\x8D\x90\x07\x06\x61\xA8\x0B\x1D\xD6\x80\x28"
+    "\x71\x09\x39\x53\x81\x6E\x34\x24\xFC\x85\x1F\x66\x84\x3B\x8D\x72"
+    "\x1E\xC1\x0D\x09\xE1\xCE\xC7\x40\x8B\xAF\xB0\x7C\xCC\x59\xFF\xF6"
+    "\x6D\xA6\x64\xCA\xEA\xF0\x55\xA9\x2E\x97\x51\xA9\x89\xB8\x8A\xCB"
+    "\x4E\x61\x26\x58\xD1\xA7\xD6\x37\xFF\x9D\xF2\xCA\xC7\x33\x94\xB2"
+    "\x6D\x8B\x79\x32\xF2\x16\x1B\x2F\x54\x3E\x4A\xE7\x24\x40\xAB\x62"
+    "\xE1\x19\x01\xAC\x6E\x87\xA5\x3E\xF1\x91\x54\xD3\xC0\x22\x13\x99"
+    "\x89\x88\x01\x11\x22\x4A\x67\x9C\x70\xD8\x06\x35\x38\x0E\x90\xF3"
+    "\x9C\x87\x5C\x12\xEB\xCB\x68\x7C\x11\x6D\x64\xC0\x00\xCD\x16\x0B"
+    "\x52\x7A\x28\x4C\xF4\xBA\x32\x5F\x46\xAE\xCB\x94\x8A\x04\x12\x92"
+    "\x04\x63\x08\x8C\xB8\x93\x23\xDD\xCA\x2B\x28\xAC\x5A\x3A\x2D\x1B"
+    "\x0A\xEF\x19\x50\x6C\xE4\xC5\x52\x05\x59\x0D\x2B\x46\xF9\x2F\x56"
+    "\x0F\x94\x7C\x32\xF1\x93\x0E\x04\xDB\x66\x99\x9D\x67\x01\x3E\x16"
+    "\x69\xE8\xD0\x18\xA7\x4A\xC9\x11\x22\xCB\xEC\x0B\x05\x55\x5D\x4F"
+    "\xC7\x57\x78\x21\x2A\x1E\x29\xE5\x4C\x9E\xE8\x70\xBD\xD7\xA5\x17"
+    "\x64\x49\x94\x7C\xCA\x07\x85\xCA\xB4\x56\xE1\x31\x5B\xE9\x9D\xC7"
+    "\x5A\x88\xD3\xA6\xE0\xD0\x7D\xE3\xC0\x16\x33\x51\x5D\x9B\x06\x67"
+    "\x09\x43\xA0\x19\x03\x96\x01\x93\xB0\x63\x0D\x02\xA6\x8D\x5B\x16"
+    "\x58\xDC\xC6\x35\x04\xD8\x77\x4B\x0B\xC6\xB1\x7F\x0D\xAA\x5C\x8A"
+    "\xCA\xE5\xA6\x95\x45\x07\xBE\x4B\xA0\x1D\xC6\x3A\xEF\x32\x79\xF2"
+    "\x24\xB1\xE2\x27\x3E\x53\xC5\x54\x72\x24\x5C\x6C\x89\xE8\x68\x5C"
+    "\xF6\xCF\x97\xA1\x28\x30\xEE\xB7\x2D\xAC\xEF\x98\xAD\x22\x10\xCB"
+    "\x5A\xE0\x61\x5A\x0F\x55\x8A\xD5\x02\x82\x13\x93\xB9\x66\xBD\x8E"
+    "\x1B\xAD\x19\x0A\x39\xDC\xFA\x07\xFB\x3E\x32\xB1\x49\x65\xDC\x46"
+    "\xA1\x18\x46\xEF\x41\x99\xC9\x20\xC9\x66\x42\xE8\xB6\x67\xE5\x8C"
+    "\x16\xAA\xF2\xB8\xAA\x31\x8E\xC6\xC8\x1B\xE3\x80\x44\xDE\xF8\x39"
+    "\x3A\xC7\xBC\x9E\xAD\x4F\x31\xC6\xE2\xFF\xAE\x8B\xD5\xC5\x4B\xB5"
+    "\x53\x1E\xCB\x6D\xBB\x94\x42\x51\x7D\xC4\x02\x8C\x43\x51\x82\xC7"
+    "\x93\x66\xF0\xF1\x7F\xCE\xCF\xCF\x95\xD3\x63\x89\x91\xB7\x8E\xC4"
+    "\x56\xDD\x32\x83\xAB\xD9\x08\x6B\xC1\x14\x83\xAA\x1A\x9B\xC7\xFE"
+    "\x97\x69\x44\x74\x21\xC9\xD1\xBE\x3E\x24\x2C\x0F\xD7\x04\xEC\x68"
+    "\x51\xD6\x7C\x71\x5D\xA8\xA5\x07\xB5\xBC\x11\xA8\x73\x0F\xEA\xFC"
+    "\x1A\x50\xAD\x05\xC5\xF3\x3B\x57\x19\x18\x30\x64\x01\x33\x31\x19"
+    "\x34\x78\xA6\xF5\xCA\x15\x33\xB9\xE6\x45\xC7\xE4\xEA\xF0\x0F\x4F"
+    "\xCD\x2C\x0B\x4F\x45\x6A\x6A\xDA\x12\x43\xA2\x9A\x4B\x87\xD7\x98"
+    "\x64\x43\x66\x7C\x97\xF2\xDF\x39\xE1\x52\x65\xBB\x37\x01\x29\xC6"
+    "\x4F\x15\xEB\xDA\x0C\xC4\xB9\x32\x59\x28\xB1\x29\xB0\x74\xEB\xE3"
+    "\x01\x56\xE8\xDD\xDB\xDD\x0E\x6F\xF4\x5C\x6D\x15\x75\xFD\x10\x78"
+    "\x43\xEE\x87\x53\xDC\x82\xAB\x0A\x70\xBE\xCD\x6A\x11\x30\x9C\x87"
+    "\x76\x24\xBD\x00\x5D\x55\x96\xF7\xDF\x5C\xB7\x45\x22\xA1\xBD\xFB"
+    "\xFA\x44\x6D\x04\x2C\x38\xCD\xE7\xF3\x47\xEF\x60\xD5\x60\x6A\x15"
+    "\xA0\xC4\xCE\x68\x1B\x86\x7A\x44\x5D\xBD\xF4\xCB\x53\x9C\x9E\x00"
+    "\x2E\x08\x04\xDA\x78\xB3\x61\xAB\x29\xDC\x95\x00\xC4\x0A\xAE\x4B"
+    "\xA1\x69\xD2\xE1\xF2\x29\xA8\xB0\x8F\x00\xC8\xB8\x40\x21\x55\x44"
+    "\x10\x23\xCB\x38\xE3\xA5\xD7\x0D\xB5\x65\xF4\x75\x23\x06\x2E\xE6"
+    "\xC6\x66\xC0\x55\xC5\x2E\xE0\x76\x46\x6D\x04\x9A\xAB\x75\x02\x2E"
+    "\xAF\x06\xB8\xEC\x05\x3C\xBF\x1A\xE0\x79\x07\xE0\x68\xE8\x72\xE2"
+    "\xC5\x0E\x19\x7E\xC0\x4B\x0A\xF9\x4E\x06\x29\xB0\x36\xD3\x53\x07"
+    "\xDC\xDB\xBF\xE6\x7C\xAF\x97\x1F\x7E\xBA\xA7\x02\x0A\xB8\xD3\xFD"
+    "\x86\xE6\x3B\x07\x01\xFF\x75\x4E\xF9\x28\x6E\x37\x38\xEB\x7B\xE1"
+    "\x5F\x6B\xE2\xF7\x41\xBF\xCE\xDC\xEF\x85\x7D\x8D\xE9\xDF\x0B\x7B"
+    "\x98\x04\xC0\x5F\xE7\xFD\x2C\x3B\xED\x37\x0A\x79\x61\xE3\x55\xD0"
+    "\x94\x7B\x57\x36\xE5\x61\xB9\xD0\x71\xAA\x65\x54\xFF\xE6\xA4\x3E"
+    "\x4B\x04\x8C\xE1\xC9\xF2\x92\x0B\x44\xB5\x0A\x5D\x39\xAD\x53\x40"
+    "\x81\x40\x61\x35\xD5\x92\x4B\xB6\x2A\x10\xE4\x09\x87\xD7\x63\xAB"
+    "\x35\x5E\x2D\x08\xC8\x49\x39\x2F\xD2\x28\x25\xC5\x4A\x02\x25\x84"
+    "\x76\x55\x94\xEC\x20\xAD\x0A\x50\x0A\x57\x77\x94\x65\x12\x87\xCC"
+    "\x29\x60\x0D\x0B\x3F\xD8\x12\xCA\x7E\x8F\xBE\x01\x5C\x9D\x42\xF0"
+    "\x33\xC3\x25\xED\x96\xC6\x40\x0B\xEC\x3C\x2B\xCC\x51\x2E\x3F\x71"
+    "\xF3\xBD\x71\xFB\x6D\xFE\x2C\x46\x86\x82\xB7\x02\x61\xB9\x6D\xD3"
+    "\xA2\x36\x6F\x6E\x66\xBD\x14\x3B\x27\x46\x4A\xD9\xB5\xBD\x2B\x83"
+    "\x94\x44\x16\x8F\x22\x41\x78\xBE\xD3\x47\x19\x30\x71\x40\xAA\x37"
+    "\x36\xD0\xD8\xAA\x98\xD5\x2B\x91\x5A\xB6\xA8\x08\xA6\x85\x1E\xE6"
+    "\xDE\x4D\xF3\x4D\x5C\xCA\x8F\x8B\x77\x41\x5C\x56\x4D\x18\xE3\xEA"
+    "\x36\xCB\xF1\x4C\x3B\xC7\xD0\xAC\x78\xB0\x0D\xC0\x8E\xD1\x18\x88"
+    "\x37\x1D\x05\x07\x92\x55\x4A\x8B\x99\x06\xC5\x4C\xD3\x69\x06\xA4"
+    "\x96\xA7\xA0\x5C\x1F\x63\xF6\x4F\xB5\xE8\x74\xE4\x7F\xC5\x7D\xAA"
+    "\x8A\xE8\xB9\x5A\xE1\xDF\xCA\x66\x79\xFE\x26\x3B\x06\x22\x56\xD6"
+    "\xF8\x40\x4C\x85\x27\x97\x69\x46\xD2\x1E\x26\xB6\x8E\xF8\x69\x1B"
+    "\x78\x60\xD5\xE0\x13\x5E\xC0\x34\x05\xAE\x9C\x47\x18\x4E\x83\x53"
+    "\xEB\x23\x14\x0A\x98\xEC\xBD\x73\xE8\xF4\xB3\xD9\x63\x5D\x66\xD6"
+    "\x8C\xAE\x5D\xA0\xD4\xB8\x50\x68\x6E\xB3\xC5\xD7\xBC\x63\x61\x0F"
+    "\xFA\xE9\x48\xE6\x78\x3C\xA2\xDB\xD4\xB7\x54\x93\xA0\x3D\x96\x3F"
+    "\xE0\x92\x7C\x5C\x66\x48\x35\x81\xF2\x92\xAD\x22\xB6\x6A\x53\xB6"
+    "\xC7\x5C\x4D\x41\xB7\x55\xD1\xD7\xE5\x1B\x92\x67\xE3\xD1\x9F\xF0"
+    "\xCA\x75\x19\x8F\xBD\x6D\xE4\x7B\xD4\xA8\x1D\x4B\xBC\xA4\x6A\x78"
+    "\x9B\xDB\xC8\x1C\xF2\xD4\x91\x1B\x9B\x3F\xCA\x95\xD1\x98\xE3\x05"
+    "\x4D\x1D\x07\x1B\x67\xD6\x94\x32\x80\x2A\x92\x89\x4E\x29\x3D\x82"
+    "\xB8\xDE\x71\x2A\xA6\xC0\xD3\xF5\x69\xB1\x2A\x67\x6A\xD0\x5A\x92"
+    "\x9B\xD2\xB8\x3E\x72\xBC\x3F\xFC\xD9\xAA\x32\x11\xEE\x3A\x59\xE6"
+    "\x12\x17\xA7\x02\x0D\xEB\x63\x91\xCC\xB8\x21\x7D\x50\x92\xD9\x23"
+    "\x84\x91\xE3\xC6\x71\x3D\x92\x39\x6A\xE3\x47\x22\x98\xF1\xD2\xFA"
+    "\x90\xF4\xA2\x53\x92\x91\x72\xB3\x88\xD2\x28\x42\x9E\x80\x3A\xE5"
+    "\x2F\x40\x9D\xF2\x63\x50\xA7\x24\xEA\x94\xD7\xA3\xCE\xFC\x17\xA0"
+    "\xCE\xFC\x63\x50\x87\x66\xD9\x77\x1D\xF3\x2B\x35\xB5\x84\x1E\xF1"
+    "\x04\x35\x2F\x73\x58\x4E\x6B\x9B\x8D\xEE\x3A\x54\xEF\x4C\x2C\x84"
+    "\x81\x7E\x16\xD7\xFE\xE4\x50\xE0\x2A\x5E\x5D\x68\xE7\x30\xD7\x09"
+    "\x8B\xDA\x46\x1F\x87\x46\xE9\xA6\xC2\x49\xC5\x44\xCC\x53\xA1\xCF"
+    "\x4F\x63\x99\x86\x63\xAD\x61\x19\xFF\x6A\x15\x43\x87\x25\xFB\xAC"
+    "\xC8\xCE\x30\xF2\xBE\x51\xA9\x1B\x8E\x6A\x8D\xF8\x6D\xD5\x47\x47"
+    "\x5B\x31\xB8\x69\x8F\x0E\x6F\x68\x15\x79\x48\xF3\x1C\xAB\xB5\x79"
+    "\xF7\xCD\x24\x74\xD7\x9F\x44\x6C\x18\x13\xC6\x88\xE2\x59\x24\x5A"
+    "\x14\xC7\x22\x11\x3F\x94\x14\x9A\x08\xCF\x2F\x2E\x4C\x1F\x57\x3D"
+    "\x63\x8F\xA1\x10\xA7\x07\xCD\x9C\xB1\xD1\x55\xDC\x45\xC5\x31\x6D"
+    "\xD0\x57\x41\x86\x10\xED\x8E\x89\xA5\x99\x13\x27\x4F\xB4\x35\x3D"
+    "\xAD\x52\x4D\xDE\x33\x1B\x97\x16\x4F\x02\xD8\x65\x79\xC5\xFA\xA2"
+    "\xF2\x11\xBC\x39\x0A\xC8\x63\x7E\x61\x3C\xFA\x40\x14\xF0\x74\x9D"
+    "\x54\x93\x9B\x52\xE0\xC6\xC8\xC1\xBE\x05\xD6\x0A\xF5\x61\xC8\x60"
+    "\x57\xE5\x78\x53\x1F\x93\x01\xD8\x21\xC2\xDA\xC6\x3E\x50\x8F\x4B"
+    "\xDB\xE3\x58\x53\x1F\xB5\xC7\x8C\xC6\xFC\x03\xF7\xD8\x32\x79\xB4"
+    "\xA9\x4D\x7A\x9C\x5A\x62\x7F\x5C\x95\xA0\x24\xA8\x45\x85\x2C\xEA"
+    "\x89\x65\x4D\x57\x88\x2C\x5D\xE1\x26\xD3\x0B\xAD\x1F\x64\x89\xF2"
+    "\xE9\x13\xD9\x45\xCA\xFB\x0D\x89\x24\xB8\x22\x0C\x03\xDE\xF1\xAB"
+    "\x60\x0D\xEC\x08\x76\xC0\x4A\x11\xA6\x62\xDA\xA7\x20\xE8\x0F\x51"
+    "\x5D\x89\x18\x62\xA1\x6D\x28\x84\x31\x2E\x5E\x95\xA7\x50\x02\x83"
+    "\x33\x8C\xA5\x83\xE3\x67\x98\x17\x66\x37\x19\x19\x8D\xDB\x09\x6F"
+    "\x44\x9B\x45\x14\x41\x27\x0C\x2D\x11\x74\x14\x4A\xCA\xE1\x2D\x00"
+    "\xBB\x9F\x8D\x94\xBE\x13\xCD\x81\x25\x20\x0C\x48\x2C\xEC\xD1\x97"
+    "\x8C\x6D\xA4\xB4\xB0\x5B\x30\x06\xEE\xED\xAC\x73\xD5\xF5\x37\x4D"
+    "\x46\x71\xAF\xDA\xCC\x0C\x41\x3F\xB3\xF4\x24\x08\x17\x01\x68\x6F"
+    "\x2D\x47\x01\xEA\xD5\x7C\x30\x40\xBA\x33\x1C\x03\x05\xEB\x40\x3C"
+    "\x30\x4A\x04\x46\x99\x82\x51\x0E\x87\x91\xEA\x12\xC8\xAA\x7E\x18"
+    "\x7C\x5C\x85\xA3\xCC\x17\xD5\xC6\x36\xDB\xF3\xEE\xF6\xB0\xFB\x15"
+    "\xFF\xF1\x1F\x99\x07\xC2\x6C\xEA\x2D\x30\x63\xB3\x99\x90\x3D\xB8"
+    "\x1F\xB1\x28\xE4\xEF\x96\x57\xAD\x58\x5E\xB5\x22\xDA\xAE\x7A\xAB"
+    "\xF6\x73\x35\xFE\xDC\xC8\x45\xBE\xA8\x1C\x04\x02\x7F\xFA\xDE\xF4"
+    "\x7C\x5C\x6E\xA3\xAF\x3F\x4C\xD8\x43\x90\x84\x47\x8B\xFC\x98\x5C"
+    "\xA8\xAD\x8F\xFD\x90\x1F\xDD\x18\x18\x5C\xDA\x0E\xE8\xA9\x7B\x81"
+    "\x6C\xC8\xEF\xBB\x25\x5E\x68\xA7\xDB\xE0\x91\x63\xCB\xD8\x6F\x90"
+    "\x1F\x7A\x2F\x90\x6E\x7F\xF7\xDE\xEA\x8E\x8B\xBB\xB3\x42\x0C\xEC"
+    "\x05\x65\x6F\x3A\x5C\x94\xCD\x09\xDE\xC1\x45\xEF\xF6\xC6\x39\xC7"
+    "\xE8\xF9\x45\x9C\xA8\x87\xF1\x1B\xFE\x36\xF3\x0D\xEE\xFA\x29\xDF"
+    "\xD5\x48\x80\x10\x71\xD1\xDF\x5F\x6B\xAE\x02\xBE\x37\x3C\xC7\x95"
+    "\x80\xF6\x05\xC0\xB8\x0A\xD0\x20\xE4\xC4\x95\x80\xF8\x01\x1F\xAE"
+    "\x04\xC4\x0F\xB7\x30\x0C\x48\x3C\x77\xE4\xF0\x12\xE9\xAF\x36\xDD"
+    "\x63\x62\x0E\x6F\xF7\x69\x21\x7D\x4A\x4A\x19\x2A\x45\x65\x93\xD5"
+    "\x47\x47\x13\xD2\x53\x49\x87\xE1\x59\xC6\x77\x32\x56\xDD\xB3\xCD"
+    "\x04\xD0\x42\xCF\x91\x08\xE8\x96\x02\x18\xA8\xA3\xCF\xEB\xA0\xDE"
+    "\xBD\x0A\x58\xE1\x3E\x5A\x14\x47\x78\x95\xE1\x33\x21\xF0\x47\xAB"
+    "\xF2\xF8\x04\x5E\x4E\xF4\xF5\xC3\x5D\xF3\xBF\x9E\x11\xBF\x96\x24"
+    "\xBD\xA2\x04\xBD\xBA\xE4\xBC\xA2\xC4\xBC\x92\xA4\x4C\xCB\x35\xB6"
+    "\x0A\x76\xF7\xB1\x63\x06\x44\xBF\x84\x6F\x53\xB1\xF1\x52\x1B\x37"
+    "\x75\x53\x06\x36\x3C\x65\x3D\x2F\xF1\x89\x12\x85\xEB\xCF\x3B\xDA"
+    "\x70\xAC\xCD\xA7\xF6\x03\x79\x06\xE3\x0E\x48\x5D\x78\x86\x5A\xC4"
+    "\x8C\x29\x7B\xEA\xA7\x97\x22\xE2\x5C\x62\xC7\x27\x3C\xC6\xA2\xD1"
+    "\xF6\xC4\x51\xBB\xF4\x88\x0E\x37\x8A\x4E\x8E\xC4\x1E\x5F\xE3\xEE"
+    "\xB0\x72\x1D\xDE\x2C\x7D\x21\x49\x24\xF7\x50\x08\x38\xFB\x28\x02"
+    "\x67\xD8\xBB\x49\x7B\xF6\x22\x94\xF8\x2E\x6F\x2F\xED\xC9\x0B\x18"
+    "\x4E\xAC\x39\xE9\x23\x46\x6D\xC9\x17\xA2\xA4\xBD\xED\x00\xA5\xEC"
+    "\x83\x28\x61\x5D\xAC\xA1\x84\x7D\x90\x18\x99\x51\x40\x84\xCC\xC3"
+    "\x86\xB1\xEF\x3E\x44\xC4\x3D\xE1\xFC\x63\x88\xA0\x9E\x25\x3C\xE5"
+    "\xE1\x83\xA0\xD4\x9F\x32\xAF\xA2\x72\xB6\xC1\xDC\x8A\xEA\xCF\x74"
+    "\x20\x13\x0C\xBB\xE1\x27\xE1\xFD\xB1\x38\xCC\x5E\xD6\xB3\xB7\xB0"
+    "\x83\x7D\xD9\xAE\x8A\xFC\x14\xAD\xE9\x61\x0E\x5E\x1B\x9B\x41\x17"
+    "\xE2\x4A\xE3\x93\xBA\x69\x2B\x5A\x79\xF1\xC2\xF1\x24\x03\x7E\x3C"
+    "\x2E\x1E\xB1\x23\x81\xE6\x5D\xEB\x87\xD3\x50\x6D\x2E\xD4\xC0\x14"
+    "\xCD\x61\x7D\x3A\x6C\xB8\x79\x8A\x1B\xF2\xD7\xBB\xB2\xC6\xBB\x7C"
+    "\x95\xA9\xAF\x3A\x4C\xB6\x3B\x07\x6D\x3E\xE5\xC0\x77\x4A\xD5\xC3"
+    "\xB0\xD3\xD0\x47\xC6\x76\xFA\xEC\xF9\xA3\xA7\x74\x3C\xCF\x5F\xA7"
+    "\x94\x31\x96\xAF\xCE\x76\xF8\x6C\x3B\xE0\x2D\x3E\x20\x4D\x0C\xE4"
+    "\xF1\x4F\x67\xCD\xDE\x9D\x3B\x9F\xBC\xD7\xF4\xB8\xDC\xFB\xE4\x3D"
+    "\xF6\xE8\xF2\x0E\xF7\xF9\xA7\x49\xF6\x7A\x2B\x5F\xCD\xD7\x65\x55"
+    "\x6F\xBD\x11\xB3\x53\x61\x02\x13\x25\x5F\x5D\xE0\xAD\x3D\x00\x0D"
+    "\x05\x57\xF9\x05\x27\xB2\xDD\x12\xD2\x01\x93\x9C\x7A\x1E\x5B\x5C"
+    "\xBB\xAE\xEA\x65\x51\xE1\xD2\xA4\x11\x1F\xC7\xE4\xBF\xE3\x51\xEA"
+    "\x8D\x64\x86\x10\x42\x23\xC0\xE5\xAD\x78\x7B\x2A\x96\xBC\xD3\xE4"
+    "\x69\x13\xB8\x6F\xF5\xB6\xBA\x2A\x66\x45\xF9\xCE\x46\xAA\x8F\x19"
+    "\x21\x60\x6D\xD3\x39\xCF\xE9\xAE\xA3\xB2\x0B\x25\x9A\x53\xAC\x36"
+    "\x53\x51\xB1\x34\xA2\x68\xC8\x21\xB1\x0F\x43\x9E\x1F\x2E\x8A\xEC"
+    "\x70\x51\x1F\xB2\x23\x4E\xD3\x94\xC7\x14\x9B\xB2\x3C\x3D\xCE\x9A"
+    "\xD5\xAC\xC3\xC4\x75\x78\xD1\x16\x8D\x1A\xFC\x1F\xCA\xAA\xFD\xEB"
+    "\x7D\x1C\x29\xEC\xF9\x94\x52\x3C\xB1\x79\x52\x3D\xA1\x3E\xF5\xCF"
+    "\x65\x71\xCC\xFC\xDE\x05\x15\x51\x61\xA0\x5F\xC1\x9F\xE3\xD7\xD4"
+    "\xCC\x94\x19\xE0\x4D\x90\x8E\xD9\xE9\x42\xDC\x78\x26\x66\xE1\x14"
+    "\x7A\x04\xC0\x7F\x78\xF1\xFD\x74\x06\x35\xDB\x82\xE3\x1D\xC1\xF3"
+    "\x18\xEB\xAB\xCC\xD1\x2E\x0D\xEA\x35\x79\xAF\xD5\x19\x9D\xB7\x96"
+    "\x6D\xD0\x48\x34\xFD\xB3\x3F\xE0\x67\xF9\xAA\xEA\x18\xF1\x75\x55"
+    "\x9C\x2F\x01\x13\xCC\x20\x8F\xB6\x5C\x37\x57\x01\x0C\x6E\xC8\x09"
+    "\x9E\xC2\x70\x2F\xC1\x9C\xB3\x05\xC6\xB8\xB8\xD6\x6C\x20\x10\x51"
+    "\x93\x98\x27\x90\xE2\xE8\x5D\x82\xAE\x42\x09\xBE\x8A\xF3\x59\xB1"
+    "\x44\x1C\x3A\xBD\xBB\xFD\xD6\x4D\x2D\x26\x86\x05\xD2\xE7\x9A\x81"
+    "\xAB\x4D\xE0\x69\xCE\x18\x87\xF6\xE6\x6C\x3C\x0E\xE4\x20\x4D\x30"
+    "\x2B\x30\x1F\x7C\xFF\xEC\xE5\xA3\x87\x94\xAE\x7E\x50\xD9\xC7\x4F"
+    "\xBF\x89\x6A\x9E\xAA\x2E\x51\xD5\x37\x40\x5F\x46\x06\x31\x91\x16"
+    "\xC1\x89\x8B\x0B\xDC\x03\x02\xB6\x89\x84\xC6\xBD\x6E\x82\x65\x67"
+    "\xF1\x54\xCD\xE0\xFA\x69\x56\x4D\x8A\x23\x95\xE9\x1D\xC1\x0F\x8F"
+    "\xE5\x8A\xA9\xC3\x54\x89\x00\x41\x68\x9A\xD2\xF7\x2B\xF7\x74\x4C"
+    "\xAA\x1F\xF1\x78\x3C\xA7\xF7\x78\x25\x7E\x51\xA2\x7F\xE1\x44\xE5"
+    "\x9F\x33\x79\xEB\x4C\x0E\xD7\xA6\x84\x4D\x01\xBA\xFB\xE7\x87\xF0"
+    "\x19\x77\x74\x9F\x8A\x2C\x75\xF3\x69\x96\xBD\x22\xD7\xC3\xAA\x45"
+    "\x17\x3E\x91\xF1\x95\xAE\xC2\x11\x04\x72\x89\xC0\xD9\x96\x23\xA8"
+    "\xB7\x08\x41\xBB\xFC\xE1\x5D\x76\x95\xD2\x21\x47\x97\xF9\x59\xD3"
+    "\x58\x07\x3B\x95\xA8\x5C\x95\xDD\x6A\x08\x7D\x14\x70\x3B\x00\xC9"
+    "\xB4\xD8\x82\x84\x3E\x5C\xA3\xFF\x04\x66\x8C\x00\x55\xA5\x02\x9C"
+    "\xBE\x2F\xDF\x16\x67\x25\x6E\xD7\x28\xB6\x8C\x2D\x8E\x20\xD0\x73"
+    "\xD1\xF6\x0A\x51\x32\x2E\xFA\x08\x03\x14\x9A\x79\x81\x40\x34\xC5"
+    "\x1E\xA3\x47\xA1\x4D\x05\x48\xED\xAC\x97\xCB\x05\x62\xAD\x8E\x68"
+    "\x88\x33\x56\x6B\x44\x7B\xC2\x0E\x08\x5B\x00\xFA\xBE\xA6\xD2\x16"
+    "\xC1\x41\x92\xE2\xEB\x87\x96\x7C\x5B\x36\xE1\x20\xD0\x56\xEF\xC0"
+    "\x30\xE0\x0E\xF7\xFD\x90\x32\x0F\x7E\x4A\x34\x26\xD1\x4E\x43\x7A"
+    "\x62\xF2\x14\x22\x2E\x5E\x0F\x0D\xF9\x0C\x69\x11\x80\xA2\xA5\xD7"
+    "\x5F\xA0\x69\x92\x9E\x8A\x00\xFF\x00\x99\x0C\xDD\x9B\x17\x48\xDB"
+    "\xF5\x62\x9E\xB1\xF0\xE4\xFC\xBE\x06\x8D\x33\xBC\x60\x78\x48\x7E"
+    "\x11\xAD\x09\x3D\x82\xD5\xBD\x06\xCD\x80\xD3\x26\x6A\xA2\xA0\xB8"
+    "\x34\x09\x80\x22\x1C\x02\x8C\x8E\x2D\xDA\x57\x43\xF1\x6F\xBE\x20"
+    "\xB9\x20\x59\x72\xDB\x62\x2E\x11\x3F\xA8\xEA\xF6\x00\x19\x74\x7D"
+    "\x5A\xB0\x6F\xC9\x0A\x83\xB3\x54\x6C\xC1\x05\xBE\xD1\x60\xCD\xA8"
+    "\x99\x41\x73\xF0\x73\x47\x0C\xF1\x9A\x6A\x46\x61\xF9\xF0\xCE\x4D"
+    "\x8A\xB3\x9F\xBD\xCA\x0F\xBD\xA8\x62\xC0\xE6\xF0\xD2\xDC\x44\xA6"
+    "\xA0\x5F\xF0\xE2\x7B\xA0\x14\x0A\xA9\x4F\x3D\x18\x53\x79\xFD\x9A"
+    "\xA2\x84\x73\xC0\x17\xF2\xFC\x7D\xF8\xEC\x09\x99\xFA\x57\x4E\x58"
+    "\xBB\x08\x10\xFF\x1E\x20\x2F\xC0\x7C\x0B\x9B\x5C\x86\x54\x0E\x4C"
+    "\x76\xE7\x05\xB0\x31\x18\xC6\xEF\xFF\x9E\x92\x65\x88\x88\x26\x9E"
+    "\xAA\x03\xAF\x74\x1E\x4C\xE5\x5D\x1F\x81\x64\xDD\xF5\x05\x24\x7C"
+    "\x29\x21\x05\x3D\x70\x33\x1E\x29\x1F\x7B\xBC\xB1\xE1\xF5\x20\x52"
+    "\x59\xDE\xB2\x35\x34\xA4\x7C\xF1\x00\x02\xF4\x9D\xA2\x9A\x15\xB2"
+    "\xE7\x6E\x6C\xB8\x8D\xC6\xB0\x99\x48\x71\xE1\xE6\xC6\xC1\x33\xBB"
+    "\x56\xD4\x73\x56\x1C\xF5\x91\x60\xC4\x3E\x3C\xE0\x49\xFA\xD2\x5C"
+    "\x60\xCE\x5E\xBF\x89\x15\x50\x1F\xDC\x35\xFA\xB7\x70\x87\xDF\xA3"
+    "\x4C\xFA\x16\xBF\x24\xBD\x68\x43\x10\x4F\x82\x72\xEB\x63\xB2\x59"
+    "\x31\x58\xFE\xFD\x7D\x1C\x5E\x12\x70\x39\x91\x34\xB9\xB6\x15\xAA"
+    "\xEB\x3E\xF2\x96\xFE\xE1\x87\xC8\xC8\xD1\x18\xC1\x1B\xFF\x34\x57"
+    "\x77\xA5\xE7\x3C\x97\x66\x40\xAE\x23\xB7\xC1\xD2\x96\x14\xE8\x4E"
+    "\xB5\x10\xA5\xE9\x72\xDD\x9C\x8C\x75\xAB\x78\xAE\x89\x90\x9A\x02"
+    "\x3D\x09\x35\x30\x6F\x34\x2D\x10\xAE\x9C\x18\xAE\xB0\x2D\x80\xBE"
+    "\xBD\xED\xE9\x58\xCC\x8B\x63\xAF\xDB\x78\x05\xC9\xEF\xB2\x96\xC4"
+    "\x30\x80\x16\xDF\x5D\xB5\x5F\x69\xEC\x7D\x88\xA3\x72\xD5\xD0\x10"
+    "\x4E\xAC\x60\xA9\x31\x1E\x52\x13\x63\xBD\xDF\xD5\x35\xFD\xA4\x84"
+    "\x51\x1F\x43\x09\xE3\x8E\xE7\x50\x06\x1E\x4E\xBD\x20\x66\x49\x60"
+    "\x39\x19\x3B\x48\x53\xB2\x4E\x33\x41\x05\x44\x9C\x26\x1D\x97\xDB"
+    "\xA2\x37\xD3\xAE\x77\xEF\x15\x97\xB7\xFC\xE6\x2E\xBB\xF6\xDD\x92"
+    "\xEB\xBA\x24\xD7\xC6\xC5\xDE\x26\x6C\x1C\xBD\x27\xF7\xAB\x24\x50"
+    "\xEA\xCE\x5E\xD7\x95\xBD\x1B\x20\x50\xEF\xF5\xC8\xD4\xED\x48\xE4"
+    "\x4C\x2F\x96\x43\xC4\xAA\xF7\x1B\x8B\xC4\xD0\x1F\x88\xA1\x23\x0E"
+    "\x43\x66\xE4\x73\x6C\x73\x6E\x44\xBD\xB9\x83\xBB\xA0\x4B\xB8\x8B"
+    "\x58\x1C\x06\xDC\xA7\x8E\x26\xB0\x2F\xC2\x95\x1F\x1F\x06\x5D\xBF"
+    "\xFF\x1D\xDE\x95\xEF\xBF\x2A\xFF\x01\x06\x24\x7E\x51\xFE\x03\x8D"
+    "\x49\x4F\xCC\x93\x01\x21\x4F\x3C\x0D\xC1\xBB\x6F\x77\x55\x55\x8B"
+    "\xB7\x77\xAA\x30\x6B\x98\x5A\x57\xBA\x17\xA3\x33\x0D\x86\x2A\x94"
+    "\x70\xAB\x34\x9B\x4A\xBA\x4D\x0B\x65\xB7\x1A\xAD\x6F\xA6\x46\x67"
+    "\x3A\x5B\x80\x26\x8A\x14\xC2\x69\x32\x1E\x11\x88\x84\xFD\x3A\x13"
+    "\xBA\x17\xEA\x5C\x09\xC3\xA9\x5C\x5A\x54\xC9\x3E\x1B\xA8\x86\x6F"
+    "\xF7\x39\x29\xE0\xB6\xC4\x54\x99\x37\xC6\x3F\xBD\xBA\xFF\x95\x4D"
+    "\x29\x3C\xFE\xE4\x7D\x54\x43\xBC\xDC\xFE\xA9\xDF\x14\x9B\xB2\x07"
+    "\x03\x6D\xAD\x49\xE0\x6A\xD4\x65\x9E\xBF\x11\x02\xCB\xA5\xE9\xA3"
+    "\x11\x58\xE4\x2B\xBE\x16\x89\xAF\x34\x87\xAD\x4C\x88\xDE\xB4\x62"
+    "\x4F\x6A\x35\x2A\x3C\x0B\xF8\xCA\x7B\x0E\x1A\xB0\x32\xCE\x61\xF8"
+    "\x3A\xFE\x62\x6A\xCA\x79\x2D\x6F\x39\x59\x0D\x91\xFE\x4D\x9D\x35"
+    "\xDF\xC4\xB9\xEE\xF0\x53\xE4\x2B\x9E\xA0\x8A\x56\x06\x9C\xD2\xFE"
+    "\x22\x19\xD9\xC4\x30\x20\x21\xED\x53\xC7\x19\xB0\xB5\x4E\xB3\xA1"
+    "\x14\x43\xB6\xBE\xCB\x9B\x6C\x99\x63\xA8\xE6\x15\x6F\xB7\xE9\xD8"
+    "\xA7\x25\x5B\x21\x9E\x39\x2E\x30\x86\xED\xEC\x04\x7A\xD4\x18\x1B"
+    "\x9B\xF0\x94\x10\x36\x16\xEF\x0B\xFA\xF1\xBC\x32\x60\xBC\x8F\xE4"
+    "\xD0\xE3\x7C\x95\x76\x1E\xFD\xFE\x01\xA1\xF7\x9C\xB1\x1B\x3B\x00"
+    "\x27\x1E\x88\x89\x13\x8B\xD4\x4D\x13\xB7\x3C\x3B\xC5\xF4\x8D\xC0"
+    "\x87\xF8\x8F\x3E\x82\x50\x0C\x8A\xB5\x92\x5F\xD1\xB7\x23\xF9\x11"
+    "\x29\xF3\x00\x09\x03\x5F\xBF\xD7\x7F\xEB\x22\x1C\x80\x99\xC9\x1B"
+    "\xC4\x25\xE3\xFA\x07\xD8\x21\xF8\xF8\xF9\xAE\xF3\x96\xFA\x15\xBE"
+    "\x6E\x29\x5F\xF4\x5D\xF7\xE5\x61\xDD\xB6\xF5\x69\x58\x18\xAF\xE2"
+    "\x1F\xAF\xD0\x7F\xE3\x41\xBD\xA0\x8D\xE2\x08\x23\x5F\x37\x87\xF5"
+    "\xAA\x1E\x85\x07\xE9\x4C\xE7\xAE\x7D\x21\x46\xA7\xA4\x42\x8E\xA4"
+    "\x09\x42\x02\xD7\x78\x7C\xC0\x9D\x26\x19\x7F\x9E\xCC\x41\xF4\xE9"
+    "\xA5\x2E\x28\x53\x4E\xA8\x57\x64\xDA\xF9\xFC\xE1\x03\x06\x11\x89"
+    "\x85\x6C\xC8\x7D\xC9\x95\x6D\x28\x5F\xF3\x05\x04\x17\xCC\xC3\x6A"
+    "\xA6\x83\x66\x78\x1E\x3C\x2C\x79\xB8\xE3\x63\x6E\xD6\x89\x59\x62"
+    "\x86\x4E\x77\x7B\xB8\xD8\x65\x91\xA5\x40\xC7\x81\x0A\x7F\x86\x2E"
+    "\x90\x91\x44\x4F\x78\x77\xF3\x2C\x5F\xCD\x27\xC8\xD5\xDB\x3A\x57"
+    "\x00\xC5\xE9\x35\xB3\x09\xA6\x0B\x0E\x04\x9E\xEA\xA2\xC7\x94\x4E"
+    "\xF5\x90\xBC\x40\x0A\x63\xC1\x70\xE2\xA4\x62\x38\xCF\xCF\x4E\xC7"
+    "\x7C\x8F\x35\xE4\x0E\x06\xAF\x30\xCB\xFE\xA6\x9E\xB1\xE1\xBD\x6C"
+    "\xC7\x3C\x74\x74\x4D\x89\xA3\x12\xA6\x79\xDE\xD6\x4A\x10\xE9\xD1"
+    "\x1E\x43\xDD\x09\x4D\xC5\x6D\x94\x54\xAB\xA6\xAB\x23\xAD\x90\x29"
+    "\xB1\xCE\x40\x37\x1E\xAB\x56\xC6\xA6\xAC\xEC\x92\x55\x4B\xAD\xBA"
+    "\x6A\xB6\xED\x79\xF3\x14\x18\x32\x38\x51\x56\x64\x20\x35\x56\xC3"
+    "\x9C\xCE\x60\xFA\xB5\xE3\xE0\xD4\xD6\x01\x58\xC5\xA0\x95\x47\x63"
+    "\xD3\x50\xEA\xEC\xBA\x55\x23\xB6\x2F\x1A\x84\x35\x38\xEA\xD9\x5C"
+    "\x7A\xBB\x46\x0F\xEB\xB8\x42\x73\xBE\xA7\x46\x31\x6F\x29\xB0\x3E"
+    "\xDE\xE9\x85\x11\x88\x96\xBD\xD8\x0B\x78\x24\x74\xAD\xBF\xEC\x3A"
+    "\xF8\xE5\xB8\xD5\x94\x61\x45\x05\xAE\x16\xE3\x44\xFE\xAD\x6B\x0A"
+    "\x76\x42\x09\x88\xA6\x23\x69\xB6\xF4\x79\xD1\xED\xCE\x48\x51\x12"
+    "\x57\x78\xFE\xCB\x4B\xE8\x55\xF1\xC7\xCA\xF9\x92\xF2\x41\x4C\x71"
+    "\xEA\x72\x55\xCF\xD7\x78\x72\xC1\x61\xC1\x1D\x66\xBD\x06\xAF\x92"
+    "\xA7\xE0\x60\x6E\xBD\x79\x76\xFD\x1D\xF3\x2B\x97\xE5\xD1\xBA\x2E"
+    "\xAB\x3A\xC3\xF4\x5B\x62\x56\x24\x10\xF0\x2A\x69\xEF\x7C\x1B\xE0"
+    "\xFA\xF2\xF5\x95\x85\xF6\x87\x9C\x75\xB0\xBE\x41\xBE\xE5\x21\xBB"
+    "\x36\xE3\x46\xC6\xEA\xD7\xC3\xBE\xB3\x7C\x31\x5B\x2F\x28\x0A\xDB"
+    "\xBB\x82\x73\xAA\xD0\x3D\x46\xB4\x1D\xA1\x83\x3D\x3C\xE6\xD5\x93"
+    "\x26\x3B\x2D\x17\xB0\xDD\xA6\x2B\xB0\x69\xC6\xD5\x59\x20\x02\xEE"
+    "\x35\x25\x2A\xBA\xF7\x76\xA9\xA1\x86\x2A\xA7\x2E\x40\xFA\x26\xA1"
+    "\x74\xAC\x51\x22\x87\xA0\x14\x4E\x1A\x52\xE2\x07\xBD\xD9\x75\x52"
+    "\x84\x54\x35\x9D\x1E\x26\xAE\x1A\xAB\x86\xF9\x3E\x4F\x2B\x37\x3F"
+    "\xD8\xB0\x77\xED\x38\x98\x23\xB1\x83\x3C\x3A\xCA\x59\x9F\xBA\x33"
+    "\x51\x7F\xA8\xC2\xD7\x7A\xEF\x73\x5A\xB6\x74\xBF\xC1\x36\x82\x14"
+    "\x18\x6F\x03\x23\xA3\xCF\x3D\xE1\xE3\xD6\x94\xB7\x65\x43\xD4\x76"
+    "\x60\xEA\xC0\xA7\x2F\x95\x41\x70\x27\x71\x6D\x96\x9B\x27\x37\x9C"
+    "\x41\x73\xF2\x68\x4C\xD4\x04\xA4\xBE\xDC\xD7\x58\x27\x4D\x70\x40"
+    "\x06\x98\xC2\x54\x81\x46\x36\x84\x87\xBF\x2A\x31\xCF\x3B\xFD\x22"
+    "\x0F\x57\x45\xFE\x56\x3B\x4B\x70\xE4\x36\xED\x26\x2A\xE7\x5B\x08"
+    "\xD4\x9B\xD1\x31\x79\x88\x78\xDF\xC9\xAA\x98\x04\x54\x25\x12\x26"
+    "\x5A\xDA\xF7\xFB\x97\xD5\xC3\xED\x60\x8C\x65\xD4\xF6\x8E\x22\xF4"
+    "\x53\xF1\xA9\xCA\x8B\x87\xE2\x74\xF4\xF9\xDC\xC9\x2F\x82\x3F\xE3"
+    "\xE8\x51\x54\x6D\xB9\x2A\xD4\xBE\xCA\x67\xAD\x96\xC2\x81\xC2\xF4"
+    "\x79\xD9\x5E\x2C\x50\xEC\xCE\x38\x71\x24\x19\x20\xBE\x72\x77\xB5"
+    "\xBE\x2F\xA1\xAC\xFE\x02\xD3\xD6\xF2\x15\x21\x8D\xDF\x59\x39\x6F"
+    "\x4F\xEC\xE3\x49\x81\xFB\xEC\x10\x4B\x1F\xE9\x1C\x06\x0E\x87\x87"
+    "\x30\xE8\x2A\xAB\xDC\x79\xC9\xA3\x09\x27\x06\xED\x42\x7F\x68\xCB"
+    "\x45\x33\x45\x59\xF6\x15\x7F\x18\x2B\x2C\x27\xC6\xB6\x30\x6D\xCB"
+    "\xD9\xDB\xEF\xC9\xE8\x1D\xA4\x19\x51\x93\x8D\xED\x04\x0A\xF4\x14"
+    "\x1F\x63\xC5\xB4\xE1\xC0\xE9\x30\xCC\x2B\x5D\x8F\xBE\xC7\x2A\xB2"
+    "\x69\x41\x17\x83\xA7\x58\x21\x63\x6A\x70\x09\x28\xE0\x73\x09\xAE"
+    "\xDB\x43\xD4\x06\x38\x28\x3F\x2F\x54\xCA\xA2\xA6\xAB\xB4\x21\x93"
+    "\xDA\xB1\x2B\x16\x53\x64\xDC\xC6\x0B\x4C\x44\xE9\xFB\x30\x4E\x64"
+    "\x22\x9A\x60\x7F\x94\x79\x68\xA2\xD0\xF6\xC8\x6A\x8C\x3E\x37\x09"
+    "\x54\x59\x99\x6E\x12\xA4\xFE\xF9\xE4\xF3\x9F\xC9\x64\x87\xF4\x1C"
+    "\x44\x48\xC0\x84\xAC\x24\x34\x87\xE4\xFC\xC2\xAF\x6A\x66\x6D\x4F"
+    "\x11\xE6\x57\x84\x14\x5B\xBE\xC4\x8B\x57\xC0\xB0\x8D\x3F\xFB\x2C"
+    "\x4D\x87\xC3\xFF\x1E\xC8\x20\xA0\xE3\x63\x14\xB6\x26\xED\x70\xC8"
+    "\x2F\x90\xAA\x02\x34\x3D\x1B\xD8\x3D\xDC\xD9\xAE\xCA\x53\x32\x82"
+    "\xEB\x0B\x63\xA8\x36\xA3\xA3\x21\x48\xEA\x46\x3B\xB1\x70\xF3\x94"
+    "\xB0\x11\x29\xAB\x2E\x67\xF5\x0B\x08\xBA\x2E\xC6\x6A\x82\x91\x6E"
+    "\x66\x1D\x7B\xBE\xA8\x61\x7D\xF2\xBB\x0F\x42\xD9\xB1\x7D\x76\x2D"
+    "\xE7\xF8\x73\x0B\x63\x6F\xBE\xA2\xFC\x52\x1E\x14\x5E\xAF\x5F\x8F"
+    "\xF2\x76\xF4\x06\xA6\xB1\x45\xAC\xD3\x47\x1B\x43\x95\x38\x96\xD7"
+    "\x3E\x6C\xBC\xD2\x02\x1D\xEF\xCB\x70\x7C\x7C\x84\xBA\xC8\x83\xDE"
+    "\xEB\x1D\x08\x27\xCE\x04\x63\xEF\x68\x96\x85\xCB\x00\x7F\x0D\x07"
+    "\x41\x1B\x22\xAF\x2B\x10\x86\x34\x06\xD8\xBD\x2C\x94\x5A\x44\x7A"
+    "\x04\xFB\x28\x23\x5F\xE6\x38\x71\x62\x15\xC8\x9D\x79\xBD\xCA\x95"
+    "\x0D\x98\x64\x32\x27\x47\x04\x96\xA4\x9C\x6E\x22\x5F\x68\xBE\xC4"
+    "\xB4\x92\xAB\x92\x7C\x6F\x31\xA3\x51\x35\xC7\x3B\xE4\x83\x08\x51"
+    "\xB4\x3A\x0D\x39\x5E\x82\x25\xBE\x87\x67\x6F\xCC\xC8\x4F\x4C\x8F"
+    "\xBE\x6F\xDC\x77\xBF\x46\x84\xA4\x94\x6D\xEA\x1E\xFD\xD8\x69\x73"
+    "\x5B\x5C\x86\x77\xBF\x64\x9F\xB9\x9C\x36\x94\x1B\x90\x5C\xAC\xFE"
+    "\x23\x85\x15\xD5\x0F\xF3\x86\xFD\xC6\x31\x2E\x49\x93\xBD\x2D\x96"
+    "\x78\x6D\x48\xE8\xA9\x83\xA0\x0B\x8A\xE9\xD8\x2D\xBB\x41\x21\xAF"
+    "\x00\x52\xD4\x49\xF6\xEE\x49\x01\xF5\x6D\x3C\x6A\x38\xDC\x4B\x84"
+    "\x88\xBD\x10\xBD\x41\xB9\x09\x90\x09\x24\x79\x83\x7B\xB3\x58\x76"
+    "\xC0\x04\x11\xE2\x80\xFD\x22\x2E\xC9\x06\x35\xBF\x03\xD3\xC2\xC9"
+    "\x0E\xE8\xE6\x6D\x53\xD7\xDB\xDD\xE3\x2A\xAF\x88\xBA\xED\x1E\xC3"
+    "\xF4\x32\xE4\x4F\xE2\x16\x51\x3F\xCE\x2D\x6E\x01\xC4\x51\xBE\x0A"
+    "\x06\x42\xCD\x94\xAE\xA1\xED\x83\xE8\x8F\xC3\x0D\x80\x4C\x20\xD9"
+    "\xC5\x2D\x57\xC5\xB2\x87\x5B\x24\xD8\xC4\xBA\x37\xA8\xF9\x8F\xCD"
+    "\x2C\x8E\x96\xE6\x49\x4A\x36\x01\x3A\x82\x52\xB4\x94\x10\x8D\x4B"
+    "\xF2\xDB\xCF\xFE\x55\xAC\x6A\x9D\xB2\x3A\xE3\x54\xE0\xD9\xBA\x5A"
+    "\x14\x8D\x96\x8C\xB8\xCF\xAD\xB2\xA2\x44\x3B\x47\x86\x4A\x54\x00"
+    "\x4C\x28\x79\x1A\xB1\x9D\xCF\xFF\xF2\x17\x07\x21\x7C\x8E\xE3\x41"
+    "\x8B\x33\x61\x41\x5D\xEC\x58\x8E\x87\x2B\x91\xDF\xD6\xAB\xF2\x5F"
+    "\xE8\xC8\xB8\xC0\xAD\xA4\x5E\x63\x26\x96\x88\x93\xEC\xCF\xF0\xBF"
+    "\xD8\x3D\x41\x43\x66\xA3\xD7\xD2\xBE\x78\x77\xC4\x21\x2B\x62\x3D"
+    "\x60\x8E\xBB\x12\xFA\x34\x2F\xA8\xBA\xC1\x1F\x8A\x3D\xAF\x61\x77"
+    "\xDF\x53\xEE\x5E\x88\xBB\x6D\x6A\x09\xDA\x28\xB6\x35\x8E\x19\x75"
+    "\x9D\xB9\xB8\x1D\x25\x4F\x84\x30\xDD\xFD\xE0\xC9\x38\xA0\x23\x91"
+    "\x82\x57\xEE\x88\x2B\x01\x92\x3D\x89\x0D\x99\x49\xD9\x7E\xD5\x41"
+    "\x53\xB1\x20\xFA\xC6\xCC\x29\x36\xA8\xA3\x1F\x69\xAC\x06\xE0\x1F"
+    "\x96\xBB\x42\x07\xAE\x31\x46\xE6\xF8\xFB\x0A\xC3\xF3\xFC\xEC\xB4"
+    "\x7F\x70\x44\xA1\x41\x3D\x93\x27\xD0\xE9\x81\x51\xD2\xF0\x6A\xC3"
+    "\xD2\x8B\xB7\x5F\x6A\x63\xC4\x3B\x06\xC4\x62\x1E\x95\xD3\x75\xD5"
+    "\x35\x12\xCA\x77\x42\xED\x95\x3A\x37\xA2\x09\xEB\x83\x23\x70\x7F"
+    "\xFA\xE4\xBD\xFD\xA2\x35\xC1\xED\x69\x5B\x7F\x5D\x9E\xC3\xE2\x79"
+    "\x77\xFB\xF2\x27\xC1\x41\xB6\x44\xD2\xB6\xD1\x01\x5D\x2D\x51\x1D"
+    "\xD0\x75\x89\x84\x75\xC3\xDA\x29\x14\x70\xFD\xC1\xA0\x85\xF0\x82"
+    "\x97\x1B\x43\xD3\x68\x38\xD0\x12\xB8\x99\x8D\x95\xB0\xFE\x98\x95"
+    "\xCC\x7C\x4C\xE1\x92\xAA\x0D\xD8\xA4\x2C\x1F\xD9\x1D\x8A\x36\x8A"
+    "\xB8\x59\xF0\x02\xB9\xB8\xE9\xCB\x39\x8E\xC9\x17\x75\x75\xAC\xED"
+    "\x95\xB8\x39\x4B\x98\x54\xEF\x8B\xB3\x14\x50\xCE\x9C\xA3\x15\xCF"
+    "\xD7\x4C\x61\x2B\x8B\x20\xB2\x72\xAC\x93\x16\xD9\xAE\x66\x7C\x1F"
+    "\xB6\x21\xED\x64\x83\x48\x1C\xCC\xB1\x9F\x94\x15\xF9\x93\xF7\x7E"
+    "\xDF\x2F\x27\xC6\x74\xFC\xC9\xFB\x00\x65\x1C\x89\xF4\x7E\xDB\x8C"
+    "\x3C\x6C\xA3\xC7\xBB\xD3\xBF\x64\x9F\xF2\xB1\xB2\x3B\x6E\xCA\x9A"
+    "\xE3\xF1\x4A\x74\x38\x41\x3C\x90\x71\x21\x90\x13\x86\xAF\xBB\x24"
+    "\x84\x98\xA8\x5D\xC5\x2C\xD1\x62\xA5\xD2\xC7\x28\x81\x83\x56\xCA"
+    "\xC9\xD5\x3F\x43\x21\x2F\x4E\xF7\x55\x10\xEA\x88\x3F\x1B\xA7\x58"
+    "\x7E\x0C\xDC\x62\x4D\x29\xF9\x28\x4A\xD1\x91\x0E\x7C\xA6\x7F\x27"
+    "\x12\x57\x3F\x1E\x50\xE8\x0D\x9A\x5B\xCF\xCB\x8C\xE3\x8F\xB0\xE9"
+    "\x93\x9D\xFD\xE9\x3E\xEF\x11\x85\x04\x98\xD5\x14\x2A\xC8\x9E\xA6"
+    "\xE2\x88\x35\xC0\xB5\x0D\x85\x30\xA8\xB2\x1C\xCB\x32\x08\xE3\x34"
+    "\x5A\x9C\xE7\xA7\xCB\x45\x61\x6B\x51\x34\x84\xF7\xB7\xE8\x6C\x94"
+    "\x77\x3A\x7B\xEA\x09\x9E\x95\x33\xD9\x68\x4F\x05\xEA\x54\xAF\x81"
+    "\x0B\x46\x7B\x9F\xFF\xF9\xBF\xEC\x1B\xB5\x51\xDB\xFB\xEB\x5F\xA7"
+    "\xFF\xFD\x67\x90\x1C\xBB\xF6\x13\xEF\x34\xF7\xFE\xFB\xF3\xE9\xEE"
+    "\xAE\xFB\x65\x5E\xB2\x6F\x20\xC0\xFA\xFC\xBF\x82\xAF\x39\x80\xFB"
+    "\xFC\xEE\x7F\xEE\xFE\xF9\x2F\x7F\xE1\x77\x97\xF8\xCF\x65\xE4\x42"
+    "\xB2\xEE\x8A\xB9\x8F\x61\xDD\x61\x27\x18\xC6\x84\xC4\xFF\x8C\xB6"
+    "\x79\xDF\x42\x91\xDA\xBA\x40\x90\x7F\xA8\x25\xA0\x7B\x89\x38\x96"
+    "\x8D\x96\xDE\xAB\xC9\x83\xCC\x76\x29\x5F\xF3\x44\x53\xAF\xE9\xBD"
+    "\xF5\xDE\x53\x11\x08\x56\xD1\x5B\x54\xF0\x31\x7E\x34\xA8\x3A\x12"
+    "\xAB\x04\xFD\x8A\xD7\xF9\xD0\x79\x72\xE9\xAE\x13\xC6\xA6\x76\xAE"
+    "\x43\x05\x26\x5C\xE1\x8B\xDF\xAC\x0F\x9B\xD9\xAA\x3C\x2C\xC6\xA6"
+    "\x3F\x13\x9A\x01\x57\xBC\x96\xD6\x75\x53\x89\x2E\xFE\x38\xD8\xED"
+    "\xF4\x60\xB7\xAE\x6E\x1A\x3F\xE0\x84\x92\x2E\xDE\xE9\x1D\xF4\xDB"
+    "\x02\x56\x95\xC0\x6D\xD3\xC6\xD7\x56\xDE\x2D\x18\x56\x9B\x1D\x1C"
+    "\x82\xA8\xDA\xB6\xAC\xE6\xBE\xD7\x00\xF4\x4D\x67\x1D\x55\x8F\x81"
+    "\x7F\xE1\x56\x4C\x99\x4A\x3C\xE8\x8C\x59\xA0\x97\x0E\xBC\x79\x32"
+    "\x00\x58\x22\xE2\x60\x84\x94\x6A\x15\xBB\x59\x52\x32\xD0\x0D\x49"
+    "\xF9\xA5\x5B\x31\x4D\x4A\x07\x7A\x82\x94\xC3\x69\xD9\x0B\x2D\x42"
+    "\x4B\x97\x98\x75\xF5\x44\xF1\x37\x09\x45\x0A\x97\xE5\x12\xD1\xCA"
+    "\x1B\xA4\x46\x24\xBC\x97\xF6\xE4\x38\xC9\x9B\x67\x67\xD5\xF3\x55"
+    "\xBD\x2C\x56\xED\xC5\x58\x88\xB7\xE8\x59\x0E\x46\x62\x15\x2E\x2A"
+    "\x7C\x9F\x9D\x9A\x08\x44\x72\xD0\x71\x5B\xAF\x39\x29\x8F\x02\x2D"
+    "\x22\xA4\xA1\x57\x8B\xEF\xE3\x03\xD2\xAF\x05\x96\x6F\x86\x1F\xE9"
+    "\x68\x0E\x44\x6B\xDA\x1D\x34\xAC\xAD\x38\x6B\x01\x2E\xC2\x15\x27"
+    "\x21\x8A\x55\x83\x76\x16\xF3\x06\x0F\x70\x28\x00\x6C\x85\x41\x5D"
+    "\x39\x0D\xCF\x19\x06\xC5\xC1\xFD\x5C\x4B\xF1\x40\xFA\x91\x38\xE2"
+    "\x2D\x23\xE8\x38\xAF\x2D\xFB\xBF\x41\x77\x08\x0E\x24\x36\x2D\xAA"
+    "\x76\x55\x16\x4D\xA4\x97\x1D\xCC\x99\x9C\x57\xF1\xD3\xEF\x2E\xA1"
+    "\x36\xC8\xE8\x29\xC2\xAA\xAA\x20\xA1\x36\xBA\x0D\x70\x83\x89\x3C"
+    "\xC2\x81\x84\xF0\x3E\x94\xA7\x06\x85\xC7\x36\x96\x63\x37\xBC\x14"
+    "\xF6\xC9\x7B\xE0\xED\xCB\x1D\xC6\xE3\xA7\x40\xD8\xDB\x5E\xC4\x9F"
+    "\xE2\xB2\x6A\x96\x2F\xF3\x59\xD9\x46\x63\x21\x5A\x3E\x8F\x2F\x19"
+    "\xFA\x30\x34\x5C\xAE\xFD\x69\x13\xAF\xBF\x2A\x9A\xC2\xAD\x1F\x55"
+    "\x6B\x78\x20\x03\xF5\x85\x5F\x87\xEA\xCB\x0D\x0F\x5B\xE7\x70\x25"
+    "\x86\x49\x0B\xA4\xF4\x60\x6D\x90\x18\x57\x1D\x60\x86\x54\x46\xC7"
+    "\x35\x1D\xC4\xD8\xAF\xC4\x07\xE2\xF1\x3A\xC2\x6D\x2E\x51\xFB\x54"
+    "\xCE\xAF\x79\x71\x94\xAF\x17\x9C\x22\x01\x75\xCA\xD8\x78\xAB\x0A"
+    "\xBE\x84\x85\xFA\xDB\xD9\xDF\xBC\x65\x60\xCF\x81\x98\x40\x40\x4E"
+    "\xD7\x41\x08\x70\x85\x24\x02\x72\x4D\x1F\x82\x00\x3B\x05\xBA\xEB"
+    "\xCC\x98\x5D\x0C\xD9\x2F\x80\x12\x76\xF8\x6C\x1E\x48\xAE\x60\x3E"
+    "\x38\x77\x8D\x2D\x13\x44\x1C\x6C\x1D\xFF\xC4\x6D\xC7\xD3\x6F\x94"
+    "\x18\x36\xE1\x1F\x11\x8D\x2C\x4C\x61\x4A\xC6\x91\x45\xCD\x78\x3B"
+    "\x08\x44\x77\xDF\x28\x77\x8A\x2F\x6C\x48\xE3\xA0\x7F\x36\x7E\x13"
+    "\x07\x6B\x51\x61\xC2\x9C\x32\xE1\x5A\xB8\xC1\x2C\x88\x3A\xA5\xE3"
+    "\x96\xD1\x38\xA6\xEB\x88\x6A\x89\x19\xEC\x7B\xC1\xEA\x7A\xCE\xE4"
+    "\xB8\xEE\x55\x08\x44\xFB\xA3\xDD\x82\xA0\xC6\xAE\xE8\x48\xDE\xA9"
+    "\x80\xE1\x2F\x64\xC4\xF2\x97\x73\xEF\x1E\x64\x2F\xD1\x01\x60\xF7"
+    "\xB4\x30\x96\x97\x66\xB5\x56\x81\x17\x66\xF5\xDF\xE2\xBB\x5E\xFC"
+    "\x46\x7B\x66\x1D\x94\x5F\x71\x40\xF1\x13\xFE\x2B\xDE\xD3\xB2\x05"
+    "\xEF\xE9\x5F\xF1\x9E\x6C\x09\x99\xE3\x5D\x3F\xA2\x69\x01\x6F\xE9"
+    "\x5F\xF1\x1E\xE5\x33\xBC\xC6\x7F\xC4\x5B\x25\xA6\xB0\x2F\xFC\x97"
+    "\xFC\xC6\x32\x14\xBF\xF1\x5F\xE2\x9B\x9D\xF8\xF0\xD9\x3E\xC8\x6B"
+    "\xC1\x6A\x14\xD1\x9A\xA4\xFE\xFC\xC5\x43\x59\x1B\xCD\x1E\xCA\x98"
+    "\xBF\x3B\xC3\x50\xB3\xD5\x89\x61\xF1\xC4\x2F\x16\x3C\xE7\x75\x56"
+    "\x2E\x14\x0D\x7A\xC5\xC7\xF8\xE1\x64\x3E\x42\xD7\x1A\x15\x91\xF1"
+    "\xD4\xD8\x94\xD0\x87\x89\x8B\x9C\xAE\x1B\x8C\x3C\xF7\x8E\xDD\x95"
+    "\x8E\xEA\xC5\x82\xE3\xC3\x00\xE4\x93\x7A\x8E\x9E\xE8\x18\x0A\x1E"
+    "\x67\x1C\x2E\x27\xFC\xD4\xF0\x93\xD6\x25\xF9\xA5\xD2\x67\xFC\xAB"
+    "\xCE\xFA\x06\x41\xE2\xBE\xB3\xCE\xB1\x0D\xCA\x5D\xF4\x3D\x32\x6E"
+    "\x1C\x9E\xEE\x60\xCC\xAC\x44\xD1\xD3\x7B\x6D\x4B\x58\xC8\x31\x2B"
+    "\xC5\xE2\xDF\xD8\x38\xDC\x3E\xBD\x90\xD7\xD9\x21\x97\xB2\xDD\xE3"
+    "\x5F\x8A\x68\xB2\x22\x88\xB7\xDB\x63\x4E\x19\xE0\x2D\xCF\x23\x9C"
+    "\x48\xB4\xF2\x18\xAE\xD0\xDB\x5C\x93\x62\x80\xB7\xB8\xBA\x83\x54"
+    "\xDA\x14\x8E\x03\x3D\x56\x40\x13\x30\x8F\xAF\x02\x93\xE7\x7C\x07"
+    "\x54\xEE\xBD\x07\x57\x05\x49\xB3\xD2\x8A\xC5\x2B\x86\xEB\x56\xD2"
+    "\x75\x38\x45\xA7\xA9\x55\xFF\x0F\x2B\xDD\xEF\xDB\x4A\xE7\x22\xF8"
+    "\xCB\x99\x43\xE2\x86\x86\x59\xBD\xBC\xD0\x66\x03\xBA\x3C\x4E\x1C"
+    "\x3D\xA4\xF2\x07\x30\x10\x18\xA1\xF1\xC7\x3E\x3F\x60\x9C\x70\xB3"
+    "\x2D\x04\x97\xE3\xD9\xFE\x5B\xDF\x3C\x7F\x30\x75\x31\xA5\xF8\xFD"
+    "\x56\xD4\xA7\x3B\x59\x79\x4A\xE9\x32\x9E\x58\x4D\x84\xE2\x3F\x6C"
+    "\x4D\xEF\x28\x6A\x1C\x60\xC4\xEA\x7F\x36\x5B\xA2\xF0\xAB\xF5\xAA"
+    "\x5D\x14\x6E\xF4\x5C\x53\xAD\xA5\x8F\x07\x18\x14\xED\x60\x66\x83"
+    "\xF5\xC6\x20\x7C\x57\x5C\x1C\xD6\xF9\x6A\x9E\x86\xF2\x56\x95\xE8"
+    "\x80\x94\x57\x6F\x53\x98\xC0\xA7\x1E\x3C\xFE\x6F\x7D\xD1\xE0\x8D"
+    "\xA9\x04\x84\x7F\xAA\xCF\x51\x28\x48\xBE\x5B\x24\xEF\xEA\xD5\xBC"
+    "\xAC\x74\xBA\x20\x4E\x1C\xAF\xD2\x9C\x53\x68\x38\x1D\x78\x5D\x84"
+    "\x9B\xB5\xA0\x9A\x5B\x77\x62\xCA\x1A\x22\xF4\x24\xAF\x80\xFE\x2B"
+    "\x3E\x7D\x97\xFA\x1A\xBF\xA8\x41\x63\x77\xCA\xDB\x0E\xA8\x22\xC4"
+    "\x95\xDD\x45\x96\x75\x53\x0C\x00\xF2\x1C\x8A\xB9\x5F\xB7\xB3\x5B"
+    "\xEF\x95\x2E\x97\x8D\x6F\xCB\x29\xCD\x1A\x0D\xA6\xA0\x60\x8D\x46"
+    "\x0B\x12\x9E\x7F\x5F\xBF\xB8\xFF\xE4\xD1\xC1\xC3\x47\xDF\xDF\xFF"
+    "\xC7\xC1\x93\x97\x30\x13\xFF\xBC\xEB\x7C\x7F\xF2\xEC\xD5\xB3\x17"
+    "\x36\x94\x18\x06\x9B\x71\x63\x8B\xFD\x89\x3A\xBE\x63\x24\xCC\xCE"
+    "\xCC\x44\x87\x1C\xDD\x0B\x00\x89\x90\x59\x1A\x94\x8C\xA2\x35\x14"
+    "\xD8\xF3\x67\x2F\x1F\x75\x22\x85\x74\x1C\x08\xA6\x0F\xA5\x2E\x50"
+    "\x46\x2D\xBF\x6A\x54\xCA\x6B\x04\x7F\x8C\xEA\x58\xDE\x70\x45\x97"
+    "\xA6\x8E\x8A\xA2\xE3\xC3\xAB\xBA\x83\xB1\x61\xBD\xAE\x16\x37\x30"
+    "\xC1\xA6\xB5\xC2\x6B\x44\x73\x8C\xEB\x89\x18\xDC\xFA\xEA\x88\x5E"
+    "\x29\xF4\xA2\xB7\xC9\xE3\x18\xEC\x36\x4C\x3E\x89\x47\x81\xAC\x2E"
+    "\xF7\x18\x2F\x01\xAF\x40\x60\xAE\x17\x39\x88\x0F\x3A\x20\x32\xF9"
+    "\x00\x9C\x64\x14\xBA\x06\x25\x56\xE0\x60\xA7\x65\xAB\x62\xF9\x29"
+    "\x19\x6C\x31\xD3\x85\x51\x8E\x12\x4C\xCE\x6C\xE1\x44\x03\x2C\x78"
+    "\x48\xD2\x50\x64\x97\x62\xAA\xB3\x5A\x2C\x03\xF5\xB9\x01\x0D\x07"
+    "\xD3\xAF\xA8\x02\x41\x04\x49\x34\x24\x78\x93\x60\x2F\x7A\x72\x08"
+    "\x20\x3A\x24\x36\xEE\x78\x6F\x77\x15\x98\x76\x46\xA4\x36\x1C\xD4"
+    "\x05\x21\x48\x17\x10\x05\xD1\xB5\x68\x0C\x04\x11\x51\xE3\x46\x56"
+    "\xA0\xB1\x0E\x37\xE2\xE0\xDE\x68\xB2\x51\x2A\x25\x2E\x99\x46\x6D"
+    "\x8C\x5C\xE8\x66\xDE\x0C\xD1\x45\x3E\xEE\x32\x60\x8A\x21\x12\x93"
+    "\xFF\xAA\x83\xF4\xC1\xC7\xC8\x4D\x88\x70\x95\x21\xEA\x81\x70\x65"
+    "\x1A\xBA\x72\x37\x45\xC0\x0E\x8D\x82\x98\xBC\xE3\xFB\x30\xFA\x75"
+    "\x01\xD8\x80\xC5\x43\x95\xE6\x1A\xDC\x4D\x6B\x76\x07\x63\xE3\xF7"
+    "\x1B\xE7\x69\x7F\x3D\xBB\xE2\x88\x7C\xE0\x01\x19\xCA\xCF\xD1\xF1"
+    "\xF8\x00\xAC\xAC\x4E\xFA\x62\xC4\x9A\xC9\xD8\xCF\x31\x55\x3C\x5B"
+    "\x57\xBC\x16\x9A\x94\x36\x2A\xC7\x98\x5A\x1C\xFC\x76\xC3\x1D\xB8"
+    "\x6E\x26\xB6\x11\xFD\x65\x42\x7F\x76\x6E\x1A\x63\xBB\x46\x7F\x17"
+    "\xA7\xD2\xF0\xFA\x5B\xB7\x99\xCA\xCE\xEB\x6E\xB8\x36\xDB\x67\xFE"
+    "\xF0\xE2\xD5\xF7\x8F\x0E\x5E\x3E\x7F\xF4\xE8\xE1\xC1\x83\x6F\xEF"
+    "\x3F\xFD\xE6\xD1\x90\x6D\xA6\x93\x9C\x32\x7B\xF1\xEC\xEF\x8F\x5E"
+    "\x28\x50\xD9\x77\x8F\xFE\xF1\xD5\xB3\xFB\x2F\x1E\x66\x8F\x9F\x3E"
+    "\xFF\xE1\x95\x9B\x9E\xF2\x16\x8F\x8B\x6A\x14\x4A\x1E\x3C\x7C\xF6"
+    "\xE3\x53\x52\xD1\xDD\x57\xA0\x87\x07\x45\x7F\x78\xEE\x15\xFC\xE1"
+    "\x39\xAA\xEB\x76\x63\x97\xD8\xF0\x0A\x63\x48\x24\xAD\xCC\x2F\xA0"
+    "\xE5\x9B\x8C\x1F\x87\xF5\xFC\x22\x12\xB6\x1D\x76\xE4\xF3\xFA\xAC"
+    "\x1A\x4D\x94\x56\x48\x09\xCC\xA0\x5F\x0F\xE1\xA5\xC7\xFF\x03\x40"
+    "\xAD\x97\x01\xA0\x1F\xA2\x19\x67\xBD\x9E\x7F\x00\xE5\xFB\xB7\xD0"
+    "\xF1\xEB\xC7\x51\x0F\x71\x1F\x3B\x3A\x2D\x1E\x27\x17\xD9\xCF\x3F"
+    "\xEB\xF4\xC0\x14\x93\xD9\x4B\x2B\x5C\x4C\xA1\x03\x0F\x30\x0F\x17"
+    "\xD0\x73\xEB\xCF\x7F\xDD\x8A\xF8\x00\xAC\x97\x59\x0E\xBB\x7F\x37"
+    "\x84\x05\x07\x78\x5E\xAE\xE8\xDF\x87\x2C\x87\x23\xE1\x29\xBA\x6D"
+    "\xA4\x91\xE5\xD7\x9B\x9F\x13\xEB\xF0\x9D\x8E\x5E\xAF\x53\xAB\xFB"
+    "\xDD\xF9\xCF\xDD\x58\x77\x70\xE4\x7F\xD1\x0E\x61\x13\xAB\x26\x88"
+    "\x59\x3E\xA0\x43\x7F\xFE\xAF\x58\x87\xE8\xFE\xC6\x2F\xD9\x21\xBE"
+    "\x8C\xBC\x79\x6F\xFE\x3B\xD6\x1B\xBE\x71\xF2\x8B\x8E\x0F\x5F\x9C"
+    "\x4E\xF6\x67\xC0\x64\xFC\x61\xF9\xFB\x9A\x8A\x3F\x3C\xFF\x5D\x4D"
+    "\x44\xEA\xCE\xEF\x67\x1A\x52\x77\x7E\x2F\x93\x90\xC7\x66\x83\x29"
+    "\xF8\xAB\x51\xC1\x7F\x69\x15\x9B\x08\xB1\x42\xB7\x70\x5D\x76\xDD"
+    "\x96\x8B\xB2\x2D\x0B\xBF\xE4\x0B\xD0\x57\x31\x12\x3C\x27\xEC\xD5"
+    "\xA5\x57\xEA\xED\x01\x1D\x7B\xC4\xF5\x77\xA3\x4A\x6F\x7E\xB8\xE3"
+    "\x28\xD8\x1B\x57\xA7\x0C\x0B\x88\xD7\xAB\xBA\x5E\x58\x6A\xD0\x9E"
+    "\x81\xF0\x3D\x68\xF1\x43\xB8\x69\x70\x73\xF3\x32\xED\x29\xAD\x9B"
+    "\xD8\x39\x07\xE5\x9D\xEC\xF6\xB1\x23\x32\x3E\xC8\x59\x21\x54\x05"
+    "\x54\x1F\xE5\xF8\x67\x3B\xB3\xA6\x79\xE0\xA4\xA1\x24\x54\xBE\x5A"
+    "\xB7\x6D\x5D\xD9\x67\xBE\xD5\x5E\x2D\xD7\xAD\x39\x8C\x51\x7C\x4D"
+    "\x43\xB4\xEF\x0E\xD9\x58\xB2\x39\xD6\x7C\x5E\xAC\x66\x05\xB9\xB3"
+    "\xED\x4E\xFF\x7B\xA2\x67\xF1\xD1\xA2\xCE\x5B\x7C\x35\xBD\x9B\x55"
+    "\xF5\xEA\x34\x5F\x94\xFF\x0A\x62\x12\x38\x00\xBE\xC7\x5C\x2A\x0A"
+    "\x48\x0F\x00\xD0\x50\xDF\x15\xCA\x2C\x62\x81\x71\x4A\x10\xEE\x1D"
+    "\x00\x1A\x8D\x26\x46\xA6\xB0\xC7\x13\xCC\x9B\x39\x5A\x51\x54\x56"
+    "\x11\x1E\xFF\xEC\x90\x2A\x60\x7C\x10\xCC\xD1\x74\xA1\xCA\xA2\xB8"
+    "\xAA\xE8\xDE\xE7\xAA\xC8\x44\xB2\x91\xCB\x6D\x71\x7A\x62\xCE\x54"
+    "\xC2\x6C\x0A\x94\x76\x93\x1A\x60\x84\x9E\xE6\xA7\x45\x24\xE9\x82"
+    "\x5F\xCC\x2B\x22\x06\xE3\xA0\x31\xC3\x84\x43\x82\x4E\x69\x3F\x96"
+    "\x73\x15\xDF\x52\x32\x06\xFE\x68\xE4\x26\xDE\x00\x4D\x22\xF4\x16"
+    "\xD7\x68\xEF\x4E\x31\x34\xA5\xFA\xCF\xDD\x49\xF6\xB9\xF8\x16\x61"
+    "\x15\x3F\xB1\x52\x2A\x87\x68\x24\x85\xA8\x7F\xB2\x27\xF3\x63\xAD"
+    "\x8A\xC3\x52\x9D\x73\xE2\xFC\x9A\x3A\x21\x3B\x25\xBD\xD3\x19\x40"
+    "\x0D\xCB\x0B\x19\xEE\xD3\xF8\xFE\x6A\x95\x5F\x4C\x71\x26\x8F\x0D"
+    "\xD0\x68\x2E\x50\x31\x63\xB6\x13\xF0\xF4\xD0\x3A\x6D\x4C\x4F\xF3"
+    "\xE5\xF8\x10\x93\x64\x1D\x4E\xCB\x39\xC5\x72\xB9\x8F\x4E\xF5\xD3"
+    "\xB6\xFE\x61\xB9\x84\x99\x9B\x63\xDE\xF1\xEC\x33\xFE\xDC\x2C\xCA"
+    "\x59\x31\xBE\x2B\x5B\x10\xE3\xED\x66\xF9\xF5\x77\x6B\x57\xC8\x4B"
+    "\x39\x24\xAD\x6B\x8A\xB1\x53\x14\x1D\x50\x2C\x31\x07\x62\x3D\x76"
+    "\x72\xF2\x7A\x6B\xEF\xA0\xBE\xF7\x67\x95\xBC\x7D\xDB\xE9\x82\x03"
+    "\xC6\x91\xDF\xCA\xFC\x6A\xCE\xE1\x3D\x59\xCD\x15\xAC\x37\xF9\x0F"
+    "\x5E\x71\x13\x7E\xCD\x9C\xEA\x9B\x88\xD0\xDF\xE0\x3E\x5E\xE7\xBB"
+    "\x2E\x29\x7F\x38\xA6\xBF\xD6\x79\x64\x41\xE9\x9D\x15\xFB\x47\x39"
+    "\x68\x4F\xBA\x86\xF5\x42\xC5\xD0\x45\x8B\x0B\xD0\xFD\x81\x9B\x28"
+    "\xF7\x35\x4B\xEB\x13\xCC\x72\x42\x2E\xAB\xF3\x64\xE0\xE9\x43\x58"
+    "\xAD\x8A\xBC\xBA\xE4\x06\x32\xBC\xCC\x8C\x53\x8F\x9F\xAC\xB1\x59"
+    "\xAD\x87\x7D\xC1\xA2\x09\x3F\xAC\xAF\x6A\xEA\x6A\x4E\xDC\xB9\x63"
+    "\x14\xDD\xAD\x11\xD7\xBE\xEF\x3C\x57\xA5\xE1\x66\x2C\xF6\x19\xAC"
+    "\xB3\x8F\xA9\xE8\xD3\x7D\x21\xE5\xB9\x70\x62\xD2\xA8\xF2\x16\xE8"
+    "\x80\xA9\x63\xCF\x2A\xBD\xF1\x80\x19\x5B\xD6\x73\x4E\x4E\x2E\xFA"
+    "\xAA\x62\x6E\x5A\x32\x41\xCD\xD4\x78\xFB\x87\x86\x0C\xE2\xFB\xBA"
+    "\x5E\xD2\x9D\x8A\xC6\xBF\x53\x21\x68\xB2\xED\x6C\xD7\xBA\x93\xCA"
+    "\xAA\x5D\xDE\xAA\x00\x69\xD6\xB4\xF7\xAB\xF2\x94\x82\x29\x7E\x0D"
+    "\x23\x5F\x8C\x6D\x9B\x29\x1B\x91\xA5\x00\xFB\x88\x92\x9A\x91\x29"
+    "\x0D\x51\xAF\x95\x26\x87\x8E\xDF\x27\xAA\x23\x44\x66\xB3\xA9\xE0"
+    "\x91\xE1\xB8\x75\x0E\x3E\x47\xAC\x76\x27\xE2\x73\x50\x17\xC8\xDA"
+    "\x41\x51\x2F\xCB\x30\x30\x92\x8A\x28\x0C\xDF\x7D\x59\x1E\xA4\xF1"
+    "\xC3\x1F\x16\x9C\x96\x15\x4C\xE0\x6F\x5F\x3D\xF9\xDE\xAB\x42\x92"
+    "\x2E\x5D\x2D\x4C\x25\x37\x2F\x9B\xFC\x70\x51\x04\x1B\x5C\x53\x45"
+    "\x17\xD0\x33\xA3\x7B\x7B\x82\xBF\x7E\x1E\xA7\x68\x91\xB8\xDC\x15"
+    "\x76\x64\xEB\x6C\x0B\xB7\x20\x5B\x4A\x9C\xE8\xA2\x14\xFD\x82\x51"
+    "\xE0\x4C\xC9\xAA\x42\x13\x65\x03\x84\x20\xB8\x60\xCC\x65\x1F\xCF"
+    "\x7F\xB7\xCC\x80\x7B\x5B\xDD\x49\x32\x0F\x33\x77\xCC\x63\x28\x99"
+    "\x21\x95\xCC\x33\x7A\x09\x24\x1B\xC5\x8F\xB5\xAE\xC0\x32\xA6\x5A"
+    "\x37\xDB\xE0\xAF\x3B\x40\xFC\xD5\x98\x3C\x82\x35\x65\xA4\xDC\x14"
+    "\x65\x5C\x99\xFA\x4E\xEB\x36\x62\x7D\xBB\x4A\x3F\xAA\xD4\xE2\xE7"
+    "\xBB\xDA\x29\x9E\xD0\x52\xFD\x37\xB4\x88\x26\x17\xC8\xD8\x6A\x0A"
+    "\xD3\x8F\xBF\xFD\xFC\xB3\x5A\xA4\xCA\xE6\x25\x35\x31\x76\x37\x52"
+    "\xD1\xCC\xB6\x7A\x3E\x21\xB7\xAB\xEA\xB8\x44\x94\x7C\xF1\xD1\x87"
+    "\x10\xD8\x68\x6E\xC7\x04\x82\x1D\xBC\x60\x0D\xF1\x84\x5D\x8A\x63"
+    "\x93\x62\x67\x90\x2D\xC7\xDF\xB6\x2F\xEC\x65\xA0\x92\x76\x5D\xB1"
+    "\x8D\x3A\x56\x4C\x9D\xB0\x09\x6E\x7B\xE9\xE5\x61\x36\x40\x0D\x7B"
+    "\xBD\x42\x7D\xA3\x39\xA9\xD7\x8B\x39\x2B\x76\x87\x85\xD6\x3D\x4A"
+    "\xE1\x03\x8A\xCE\x4F\x4A\x5E\xBA\x55\xF1\x4A\xBD\xAD\x72\x5A\xAF"
+    "\x94\x37\x53\x5D\xCD\x60\x23\x08\x94\xC8\x0A\xA8\x45\xDF\x91\xCD"
+    "\x74\xDD\xE0\xF0\x8F\x2E\x8C\x1C\x62\xD0\xE0\x05\xC6\xA2\x51\x9A"
+    "\x68\x6E\x2A\x7A\x67\x66\x89\xBB\x90\xDD\x77\x31\x22\xC9\x93\xBB"
+    "\xB6\x84\x7E\x12\xEB\x43\xBA\x82\x66\xE8\x41\xD1\xFA\xDD\x7D\xE2"
+    "\x35\xCE\x2D\x31\x1C\x86\x2F\xE3\x62\x5C\xEA\x2E\x44\x6E\x5A\xE4"
+    "\xB8\x2C\x8D\x5C\x54\xE0\xD7\xD0\xC7\xE3\x63\x34\x44\x14\xED\x59"
+    "\xA1\x5C\xDD\x8C\x14\x62\xBD\x4B\xBB\xFE\x92\x6F\x9A\x7A\xB9\x49"
+    "\x23\x3D\x99\xB3\xB9\x1B\x9C\xA8\x39\x22\x6F\xBB\x43\x9D\x4B\x9D"
+    "\x3B\xF4\x7C\xF1\x89\x3B\xD8\x3C\x6B\xFD\x2D\x83\x53\x92\xC4\xB5"
+    "\x85\xBE\xCA\x68\xDD\x8D\x54\x8D\xA6\xB1\xDD\x5C\x8B\x1E\xB0\xE6"
+    "\xFC\x8A\xA5\x80\x7B\x10\xCE\x42\x80\x25\x40\x28\x00\xDC\x21\x4E"
+    "\x4A\x80\x8E\xEB\x4E\x1B\x0B\x00\x3F\x67\xFA\xBA\xA2\x59\x1F\x31"
+    "\x11\x5D\xE3\xE4\xDE\x9B\xFA\xBF\x8F\x69\xDF\x93\x9F\xFD\x06\x67"
+    "\xBE\xE7\x63\x75\xE5\x89\xDF\xED\xB2\x1C\x41\x43\xCD\xD5\x19\x72"
+    "\xEB\x62\xF8\x86\x17\x7F\x1F\x21\xE3\xFC\x0D\xF9\x06\x7B\x42\x30"
+    "\xE6\x76\xA6\x47\x93\x2D\x98\x30\xAD\xA8\x9D\x70\x54\x07\xBA\x05"
+    "\x3A\x92\xB3\xAB\xBD\x1F\xAA\xE6\xDA\x2D\x0E\xF5\xA6\xFB\xC1\x77"
+    "\x9C\xC3\xC0\x7E\xB1\x43\x92\x01\x07\x78\xDE\x6E\x98\x25\x6A\xD4"
+    "\xE0\x11\xDF\xE5\x3A\xB3\x27\x4C\x66\x1E\xE8\xC9\x32\x2F\x39\xEC"
+    "\x0D\x5D\xD9\xE4\xEC\x1E\x59\xA3\x86\x62\x51\x75\xDA\xE7\x8F\xC8"
+    "\x38\x44\x34\xDF\xA8\xD6\x1C\xB0\x4C\xAC\x22\xD3\xEB\x5E\xBC\xF3"
+    "\x61\x4D\xD1\x84\x10\x4B\x78\x9A\x76\xA4\x3C\xEE\xC9\x97\x9F\xCF"
+    "\x60\x0E\xD5\x59\x54\x26\x0B\xD2\x92\x45\x47\xE4\xAD\x94\x8A\x14"
+    "\xCF\xB1\x80\xFF\x28\x0B\x85\x2F\x10\x65\x13\x55\xDD\xC6\x9A\x09"
+    "\x5A\xA1\x74\xF3\x50\x45\x24\x9A\xA7\x26\x94\xFF\xBF\xDF\x80\x9D"
+    "\xB2\x34\x42\x4D\x7C\x84\x26\x59\x84\x8C\xF2\xBC\x6E\x5A\x54\xA0"
+    "\x57\xAC\x0B\xE7\x54\xD6\x50\x70\x82\xD7\x5D\xC7\x77\x77\x77\x59"
+    "\x3F\x77\x38\xC1\x39\xD0\xC1\x60\xA5\x64\xE1\x58\x57\xDE\xCA\xD1"
+    "\x39\x64\x31\x3E\x91\xD2\xA8\xBB\x6B\xA3\xD1\x46\x9D\xA2\x03\x6E"
+    "\x0E\x30\xAF\x51\x0D\x56\xB3\x9E\xC3\x74\x7B\xFA\x61\xE2\x90\xE2"
+    "\x43\x10\x85\x54\x95\xB0\x0F\xCE\xF1\xB9\x54\x38\xE8\x04\x5D\xBE"
+    "\x10\x25\xAD\xD9\x15\x4A\xD9\x87\x0F\x7A\xE1\x72\x88\x7F\x6D\xB0"
+    "\x2D\xD6\xD7\x45\xE5\x3B\xAF\x6D\xF1\x49\xB5\x2E\x0F\x80\x6D\xD9"
+    "\x4D\x2F\x7C\x76\x9E\xE6\x8F\x22\xA7\xF9\x23\xEF\x34\x1D\x58\xAB"
+    "\x9C\xD3\x32\x2D\x8E\xD4\x47\xEA\x48\xFD\x9D\xF9\x68\xCE\xD5\x47"
+    "\xB7\x94\xAB\xAC\x77\x14\xBF\x6F\xB8\x9B\x56\x67\x5F\xE1\x56\xCD"
+    "\x14\x3A\x30\x9D\x8A\x74\x23\x42\x79\xB8\xE7\x31\xBE\x8D\xC7\xE9"
+    "\xDD\x65\xB6\x72\x3A\x0B\x3D\x7A\xF6\xC3\x2B\x0A\xCB\x02\xB2\x82"
+    "\xE1\xCD\xDD\x32\x53\x1D\xDA\x43\x06\x7B\x0F\xE3\x70\x40\x89\x2C"
+    "\xF8\xE9\xEC\xF3\x4B\x75\x8B\x3E\xAB\x40\x9F\x11\x16\x22\x58\xF7"
+    "\x9C\xB6\x3A\x80\x13\x19\xA2\xC0\x41\x5E\xAA\xA3\xB8\x09\xC3\xAF"
+    "\x8F\x32\x65\xD8\xB2\x0D\xA7\x5A\x1A\xF4\x83\x96\xE8\x47\x31\x7B"
+    "\xDB\x15\xC0\x68\xF4\x56\x86\xCD\x6E\x3C\x24\x20\xB2\x69\xD8\xA7"
+    "\x7E\x37\x74\x86\x53\x2E\x96\xA0\x91\x26\x3E\x17\x02\x1A\xBD\xD3"
+    "\x03\xCF\x02\xBD\xC5\x26\xE9\x5D\x0A\xFC\x69\x59\xFD\x3D\x68\x21"
+    "\x46\x25\x7D\x2E\xA4\xA3\xC6\xE5\x18\xD3\xC5\x34\x5D\x56\xB3\xC5"
+    "\xBA\xD1\xBE\x02\xB1\x76\xF2\xF3\x0D\xDB\x51\x61\xE8\xFA\xDA\x31"
+    "\x29\x61\x8D\x5D\x32\x3A\x16\x2F\x1E\xBD\xDA\x63\x5B\x25\xFA\x37"
+    "\xC0\x6E\x8B\xA8\x62\xC8\x3F\x51\x86\x48\x5C\x47\x2B\x49\xB0\xE8"
+    "\xD9\xD5\x53\x9E\x55\xEC\x16\x22\xD6\x04\xC1\x2B\x93\x8C\xE2\x25"
+    "\x68\x26\x14\x2B\x30\x75\x64\x12\x45\x92\x88\xA1\x90\x5B\x73\xD6"
+    "\x30\x61\xF6\xCC\x32\x3B\x5A\xE2\x2C\x79\xE2\x12\x32\xCF\x98\xE4"
+    "\xE1\x88\x71\x8F\xDD\xEC\x0B\x66\x58\x04\xC0\xED\x5E\x80\x6A\x68"
+    "\x10\x94\x04\xE8\xAB\x80\x4A\xF8\xE8\x06\x22\xF2\x6F\xAA\xF9\x55"
+    "\x51\x94\xB6\x54\x63\x45\x21\xDD\xD9\x89\xC1\x72\x5B\xAA\x8E\x3A"
+    "\x58\x8C\xDB\x4A\x3A\x76\x2B\x74\x89\x29\xC0\xDF\x69\x7B\x8F\x33"
+    "\x3C\x48\xF4\xEA\x4A\x32\xA3\x0F\xD0\x78\xCA\xC6\x22\xE6\xDD\xDB"
+    "\x7A\xBC\xB7\x3B\xA0\x28\x86\x40\x66\xF4\x40\xA8\xD5\xC6\xB5\xFE"
+    "\x47\xF5\xD7\x4D\x1B\x63\x33\xF8\x3D\x45\x87\xE6\xA4\x3E\xCB\xF2"
+    "\xC6\x65\x75\x17\x07\xEF\xD0\x24\x95\x17\x5A\x9F\x26\xB0\x48\xE3"
+    "\xF3\x77\x92\x43\x68\xAD\x51\xA1\xEB\x7A\xF3\x40\xBB\xCB\x4B\x4A"
+    "\x9E\x6B\xB1\x8C\x96\xC9\xA0\xD0\x23\x6E\xEA\x92\x8F\xF5\x5A\xF5"
+    "\xD8\x77\x76\xD1\x21\x44\xB4\xA8\x50\x67\x0B\x52\x40\x80\x8A\x1D"
+    "\x17\x0E\xAA\x2C\xEF\x0C\x9E\x14\xD5\x7A\xEC\x89\x04\xD9\x85\x89"
+    "\x8B\xEA\x24\x4B\x9E\x58\xB8\x9B\x89\x42\x9E\xDF\x10\x04\xD8\x11"
+    "\x56\xEB\xAD\xC6\x9B\xD9\xA2\x16\x6E\xB3\xCC\x99\x87\xCB\x2A\xE6"
+    "\xEC\x43\xA2\x16\x6C\xB4\x10\x80\x83\x6D\xCC\x92\xE1\x14\x98\xEA"
+    "\xD0\x7A\x6E\x73\xF2\xAC\xC4\x69\x31\xB5\x75\x8E\x9C\x84\x45\xCD"
+    "\x96\x21\xD7\xFE\x06\x78\xB5\xF8\x25\xB9\x94\xF2\x52\x74\xF2\x67"
+    "\x71\x0D\xCE\xA4\xE3\x66\x05\xE0\x83\xB3\x66\x91\x66\x4A\x3D\xAC"
+    "\x88\x0F\x25\x96\xA8\xDA\xDF\x06\x53\xF2\xC9\xDB\xBF\x1D\x57\xB2"
+    "\x02\x70\x4D\xB6\x94\x47\xBC\x57\xE3\xA9\x21\x2C\xF5\x71\x24\xDC"
+    "\x4D\xF0\xD2\xBF\xA7\x80\x7B\x70\x52\xCC\xDE\xFE\x36\x58\x69\x86"
+    "\xA8\x92\xE3\xC7\xAF\x8F\x99\x50\x9A\x8F\x94\xA2\x38\xCA\xC8\xAF"
+    "\x45\xED\x98\xD1\x30\xF9\x21\xD9\xCA\xDF\x97\x33\x5B\x9B\xDD\xF9"
+    "\xA0\xDD\x38\x9D\xE1\xF1\x4C\x45\x37\x97\x95\xD8\x71\x1B\x56\xF2"
+    "\xF4\xE0\x0E\x3E\xD6\xFF\xD2\x9E\xFE\xB8\x68\x9B\x6C\x4B\x55\xDD"
+    "\x92\x94\xE9\x61\xF7\x7A\x89\x6C\x9A\x2F\xEE\x69\xE3\x7F\x43\xFE"
+    "\x33\xD2\xDB\x35\xF1\xDB\xF1\xBC\x6D\x98\x3F\x30\x7D\x80\x72\x7C"
+    "\xEF\xAD\x6F\xDC\x6D\xB8\xAA\xF6\x00\xC2\x13\x57\x36\x21\x2B\x17"
+    "\xDA\x0F\x34\x27\x69\x37\xF2\xEB\x9E\x93\x26\x32\x74\x79\xAD\xF9"
+    "\xC8\x59\x42\xD2\x8E\x70\x66\xEA\x07\xEE\x6D\x7A\xAE\xC5\x8E\x25"
+    "\xBB\x5C\xD6\x42\x88\xE4\x7A\xD6\x05\xEE\x03\x49\x11\xFC\xD9\xE3"
+    "\x25\xAD\x16\xEA\x5C\xE8\xCA\xC3\xCB\xD1\x0A\x8D\xF7\x70\x59\xD9"
+    "\xC3\xFE\xD0\x85\x38\xBE\xD6\x1D\x9B\xB5\x4E\x6F\xE7\xFD\x36\xA6"
+    "\x86\x9D\x7F\xF7\xAB\x1E\xDD\x8F\xF9\x75\xCF\xB0\x5F\x99\x02\xC5"
+    "\x13\xBE\x38\x47\x1B\x7D\xE3\x1E\xC0\x04\x1B\xFA\xD1\x5E\xB8\xC9"
+    "\x9F\x04\xE5\x5F\x71\xE8\x75\xF1\x14\x96\x21\x45\xD7\x16\xA2\xC7"
+    "\xB0\x14\xE9\x30\xB6\x14\x3D\x86\xA5\x48\xAA\xDA\x52\x6C\xF2\x09"
+    "\x4A\x11\x67\xD8\x52\xF4\x18\x1C\xFF\x48\xCB\xA6\x39\x06\x92\x2F"
+    "\x23\x87\x23\x8A\x74\xF7\x6E\x5D\x92\xFB\x83\x3D\xAF\xF0\x0F\x3B"
+    "\xBC\x43\x0B\x04\x11\x3B\xB3\xA0\xBD\x63\xDE\x18\xC3\xA3\x16\x0A"
+    "\xC7\xE5\xBB\x42\x4D\xF0\xA4\xBA\xA1\x67\x2A\xC2\x60\x8B\xA0\x5F"
+    "\x22\x30\x7C\x27\x0B\x68\xD3\x68\x7C\xBE\x45\x2D\x97\x86\x9C\xA6"
+    "\x7D\xCF\xD0\xAB\xED\xAA\xD4\x47\xC7\x5E\x6F\xFB\x6B\x80\xFC\xBA"
+    "\xAD\xBD\x5D\x3F\x6D\x70\xD7\xA7\x0F\x13\x1A\x40\xAF\x7B\x1D\x95"
+    "\xE9\x67\x6D\xF1\x13\x8B\x2E\xD5\x76\x7D\xAA\x0C\xAD\xB7\x35\x47"
+    "\xFA\x17\x09\xF1\x17\x35\x49\xC3\x90\x37\xC5\xD7\x78\xE1\x72\x6C"
+    "\xA1\xB8\xFE\x09\x65\xF3\x34\x7F\x3A\x76\xEC\xBE\xB1\x76\x64\x15"
+    "\x13\xC6\xDC\x8C\x9F\xB4\x4A\x63\x52\x10\x07\x8D\x2F\x4C\xC1\xE1"
+    "\x90\xCD\x40\x76\x42\xFE\xD2\x5A\xCE\xBB\x20\xAB\x2F\xB2\xEA\x50"
+    "\x09\x19\x9B\x05\x20\x37\x62\xAF\x63\xF7\xB5\x5D\xD1\x61\x25\x07"
+    "\x5F\xF0\x1C\x22\x35\x1E\x57\xB3\x15\x2F\xB7\x5A\xBF\x70\x2C\x27"
+    "\xA0\x01\x6C\x74\xD2\xC9\xFA\xB0\xE2\x42\x7E\x60\x87\x3B\xBC\xA1"
+    "\x29\x55\x8B\xA4\x8A\x80\x8F\x45\x0B\x52\xCB\x72\xB3\xDE\xC8\xA8"
+    "\x0D\x8C\x2E\xD1\x0B\x02\x2F\xAA\x7A\x20\xC4\xFD\xDF\x3E\x70\x5A"
+    "\x8E\x95\x86\x42\x16\x23\xEA\xCA\x56\x23\xBE\x45\xCF\x69\x85\x28"
+    "\xA4\xE5\x22\x8B\x80\x88\x9E\xD3\xA5\x00\xCD\x8B\x59\x79\x0A\x2B"
+    "\xB0\x04\xA4\x84\x7C\x7D\x64\xBF\xA2\xEB\x23\x1E\x51\x94\x95\x03"
+    "\x2E\x70\x43\x22\xA4\x0C\x07\x8C\xD5\xE5\x5F\x43\x91\x89\x4B\xCA"
+    "\x89\xED\xEE\xC4\x74\x69\x62\x5A\x75\x0D\x9B\x2E\x91\x71\xC3\x94"
+    "\x63\xE2\x36\x60\xB2\x82\x92\x1C\x63\x42\x23\x1C\x93\x45\x5D\x2F"
+    "\x4D\x35\x74\x88\x37\x39\x65\x5C\x07\x16\x83\x89\x7B\x86\xE5\xA7"
+    "\x2B\xF4\x66\x33\xBF\xFE\x62\x3F\x1B\x9B\x21\xD8\xB1\xBD\xD0\xC9"
+    "\x10\xF0\xE7\xAA\x59\x1A\x09\x13\x9D\x60\x2C\x24\x9D\x82\xFA\x99"
+    "\x00\x64\x32\x1A\x1B\x62\x6C\x4F\xB2\xDD\x49\xE6\x27\x52\xF6\x5C"
+    "\x64\x04\xA5\x63\x81\xE1\x53\xA5\x79\x30\xFC\x1A\xA9\x23\xA6\x87"
+    "\xC5\x1F\x33\xFC\xC3\xCF\xF0\xB2\x4A\xCF\xF0\xD8\x89\xFF\xC7\x9C"
+    "\xE1\x86\x03\x36\x9B\xE1\xAA\x4B\xBF\x85\x19\xFE\x25\xCE\x70\x3D"
+    "\x04\x9F\xDD\xD4\x0C\xDF\xF9\x8D\xCC\xF0\x07\xB0\xEB\x5D\x65\xE4"
+    "\x66\xEF\x1E\x6A\x2A\x53\x59\xFA\x2E\x9A\x77\xEC\x9B\x50\xD5\x67"
+    "\x08\x9F\x37\x6C\xCF\x18\xA0\x3A\xCD\x74\xF7\xBC\x59\xE4\x2D\xFE"
+    "\x28\xC7\x9B\xFE\x38\xD5\x28\xC9\x3C\x6F\xA9\xC3\x50\x6D\xD3\xD9"
+    "\x1D\xE0\x93\xDB\xA7\x69\xF9\xAB\x1D\x79\xAC\xB9\xAF\x26\x41\x69"
+    "\x33\x73\x6C\x69\xF3\x4A\xA6\xE5\x0A\x08\x84\x39\xBA\x82\x97\x4A"
+    "\x83\xBB\x97\x56\xE1\xAC\xB3\x1B\x05\xCC\x48\x64\x05\x20\x5F\xCE"
+    "\xFE\xC8\x93\x7C\x1B\x0D\xD3\x8D\x46\x6E\xA0\xDD\x32\x61\x30\x82"
+    "\xFB\x3D\x5B\x0F\x9F\x3D\x51\x67\x7D\xDF\xD7\xF9\xBC\x98\x6F\x4D"
+    "\x2C\x2F\xB8\xEE\xCA\xEF\x80\xEF\xD0\xF0\xF4\x6D\xDD\xB4\x32\xB4"
+    "\xC6\xA2\x9E\xD1\xBE\x75\x5A\xAF\xCA\xE3\xB2\xD2\x1E\xD3\xE6\x56"
+    "\xB0\xB8\x05\x1F\x3B\xE4\x54\xF7\x86\xB5\xA1\x77\x71\xC1\xBE\xB5"
+    "\x74\x69\xFE\xC4\xF8\x9B\xD0\x4D\x08\xC5\xF2\x2B\xF4\xBD\x1E\x2B"
+    "\x7B\x30\xB9\x0A\xAF\x28\x07\x56\x66\x6C\x5F\xCC\x1A\xCA\x2F\x53"
+    "\x4D\xFE\x71\xB1\x98\x68\x7F\x22\xFE\xF2\x02\x18\xAE\x85\x8D\x90"
+    "\x73\x2B\x43\x7E\xC2\xAD\x9F\xF3\xC8\x41\x33\xB3\xBF\xB1\xD1\x69"
+    "\xCF\xF9\xEA\x88\x3D\x58\x05\xDA\x32\x5F\xFC\xDD\xD9\x00\xF2\xF1"
+    "\xEB\x14\x65\x1C\x39\x70\x6F\xD1\x51\xC6\x61\x7D\x1E\x04\xB8\x92"
+    "\xD5\xD1\x27\x7C\xA1\x4F\x3D\xA2\x62\xED\xF6\xED\x70\xA3\x69\xAB"
+    "\xE8\xBC\xC7\x76\x1A\x45\x7D\x64\x82\x16\xA3\x30\x75\x93\x1E\x44"
+    "\x37\x4E\x9C\x43\x33\x90\xDB\x0E\xEC\xDB\xFB\xFB\x61\x2A\x6A\x4B"
+    "\x78\xE0\xC5\xA3\xF2\x18\xC8\x14\x3A\xA5\x53\xEE\x07\x77\xE4\x62"
+    "\xC7\xDB\xD3\x92\xDD\xE3\x47\x79\x31\x8B\xE6\xA4\xE6\x3E\xFC\x2D"
+    "\x3B\x29\xE7\xC5\x18\x67\x64\xB3\x5E\x01\xAC\x3D\x5A\x64\xED\x0B"
+    "\x57\x08\x89\xE8\x64\xA2\x85\xE3\x78\x0B\x58\x2C\xDA\x47\xFD\xA3"
+    "\x96\x8E\x61\xB2\x3E\x28\xCA\x05\x5E\x32\x8A\x96\x22\x04\xA1\x8D"
+    "\x6F\xA0\x60\x58\xA2\xD3\xBE\x4D\x55\x7B\x1B\x20\x34\xD2\x0D\x0C"
+    "\xA1\xC0\xD9\xE1\x01\x36\xD3\x49\x68\x6A\xE6\xEC\x10\x49\x4C\x78"
+    "\xC1\x9F\x7D\x12\x1E\xFF\xB1\x56\xF1\xA8\x04\x99\xD5\xAB\x55\xD1"
+    "\x2C\xEB\x6A\x6E\x03\xEE\xE3\xC4\x07\xF6\xD1\x71\x35\x56\xCC\x82"
+    "\x2C\x31\x24\x4C\xCF\x45\xD1\x32\x9D\x8C\xEE\x5A\xB4\x1E\x9B\xEB"
+    "\x1B\x38\x6A\x0E\x47\x6F\xE0\xD8\x39\xBD\x97\xA0\x87\x9C\xCE\x40"
+    "\x9C\xBB\x40\x95\xDD\xA0\xE8\xE1\xAA\xC8\xDF\x46\xA0\xB3\x9A\xB9"
+    "\x17\xF9\xC2\x8B\xE8\x4E\x5D\xF9\x9F\xBD\x96\xE3\x36\xA9\x54\x7B"
+    "\xEC\xFA\x1F\x6F\x70\x7D\x78\x5A\xB6\x1D\x8D\x6D\xDD\xDD\x1A\xD0"
+    "\x8E\xBE\xD3\x13\x14\xE5\x25\x33\x26\x63\x58\xBA\x53\x1C\x26\x68"
+    "\xE6\xA7\x4F\xDE\xEB\x55\xE9\xF2\x8E\x5A\x22\xFF\x06\x6B\xD5\xFE"
+    "\x27\xEF\x89\x51\x2F\xFF\x03\x10\x82\x07\x42\xEB\xF2\x27\x91\x14"
+    "\xB5\x80\xD1\x1C\x13\x18\x97\x1F\xA7\x78\xE9\x63\xCC\xCC\x05\x3D"
+    "\x8D\x5E\xDA\x93\xF7\x8D\x7E\x52\x17\x40\x71\x85\xFA\xE4\x3D\x01"
+    "\xBC\xCC\x8E\x40\xEA\x35\x78\x69\x80\xF4\xBE\x75\xB3\x07\x9F\x34"
+    "\xC8\x29\xBF\xBA\xFC\xC9\x9B\x07\xDB\x71\xF6\xBF\x3F\x9F\x83\xA6"
+    "\xCD\x57\x9A\x56\xD8\x08\x6A\x7F\xB3\x05\x46\x79\x77\x6F\x1E\xA1"
+    "\xF6\x05\x0C\xBA\x45\xDF\x9A\x2D\x9A\x03\xA0\xFC\xC9\xD3\x58\x5B"
+    "\xB2\x40\x5D\xAF\x44\x2E\x74\x8E\x8D\xF4\xB2\x6E\x30\x0B\x03\x5E"
+    "\x6D\x4D\xA9\x81\x2D\x8B\x7D\xE7\x1D\x47\x18\x85\xBA\xA2\xA6\x70"
+    "\x15\xDE\x8E\xD3\x93\x85\xF1\x62\xCA\xE8\x3E\xAD\xE7\xBE\x00\xB6"
+    "\x8C\xB0\x1D\x68\x18\x33\xAD\x0E\xDF\x61\xC2\x66\xA0\x40\x2C\xEB"
+    "\xB2\x52\xB1\xC2\xF2\x39\x51\x4C\x97\x56\xCB\x11\xD4\x3A\x2D\x56"
+    "\x39\xB3\x6B\x83\x36\xE5\x7F\x36\x75\x25\x55\x12\x25\x76\xE8\x32"
+    "\x2C\x33\x35\xAA\x3A\xA0\xA1\x98\x1C\x24\x0F\x8B\x45\x7E\x91\x7D"
+    "\x0E\x12\x06\xF8\x61\x4E\x3B\x35\x34\xBC\x6B\xD0\x18\xB1\xC7\xDC"
+    "\x86\x75\xA8\x8C\x29\x15\xE0\x63\xBD\x86\xFD\x87\x47\x11\x66\x4B"
+    "\x87\xAB\xB9\x57\x3F\xC5\xB8\xD4\xEA\x6A\x9A\xB9\xE2\xD1\x12\x48"
+    "\xFD\x34\xFC\x87\x3D\x1D\x47\x99\x2F\x05\x9D\x36\x2F\x31\xD0\xE8"
+    "\x77\x3D\x2C\x8F\x1E\x83\x48\x2D\x89\xCE\x84\xFA\xE4\x3D\x80\xBA"
+    "\xC4\x29\xA3\x66\x6D\x22\x14\x08\x6C\x19\x47\x45\xC5\xD1\x42\x68"
+    "\x41\xA2\x6B\x14\xF1\x06\xD4\x90\x21\xA3\x61\x18\x3F\xDA\x51\xAB"
+    "\x71\x72\xC3\x6F\x24\x90\x6B\x61\x6A\x7C\x0B\x95\x5F\x62\xC5\x7D"
+    "\x67\x71\x53\x0B\x5B\xB2\x7A\x30\xA7\x62\xBF\xE8\x3C\x23\xFC\x76"
+    "\xD6\xE5\x56\x7C\x01\x37\x75\xDD\xF9\x67\x11\xC5\x35\x2D\x5E\xB5"
+    "\x53\x7D\xC0\x1F\x82\x4A\xC5\xCF\xFB\xE9\x4F\x3C\x42\x53\x25\xBD"
+    "\x77\x72\x62\x93\xD4\x30\xE1\x8F\x8E\x39\xBB\xC6\x06\x7F\x42\x63"
+    "\x97\xEA\xBA\x72\xC8\x4E\x56\x0D\xCF\xE6\xE3\x6F\x63\xE5\x82\x57"
+    "\x14\xF7\x37\x31\x5E\xEA\xB4\x25\x36\x54\x2E\x25\x22\xE3\xA5\xEB"
+    "\xF6\x5D\x07\xD7\x27\x3A\x19\xD1\x8C\x8D\x06\x5E\xAA\x4C\x5A\xD7"
+    "\x12\x49\x32\x9D\x47\x9F\x9E\x04\xED\x35\x55\x7F\xA3\xC9\xDA\x05"
+    "\x23\x24\x98\xFA\x78\x19\x5F\xB9\x26\xD9\xE7\xBB\xBB\xBB\x6E\x0E"
+    "\x36\x72\x4F\x10\x9C\x74\x5C\x68\xBF\xE7\xAF\x2E\x1E\xCF\xC7\x5B"
+    "\x4D\x0B\x12\xFA\x54\x11\xCC\x56\x79\x10\x8B\xE2\x18\xAF\x6B\xB3"
+    "\x96\x39\x50\x9A\xB6\x5C\x2C\xF8\x16\x5B\x17\x0C\x78\xDE\xA1\xA2"
+    "\x5E\x65\x84\xDC\x5F\x9B\xAF\xE7\xEF\x44\x3A\x41\x6B\x64\x3F\x00"
+    "\x2A\x66\xEB\x7B\x4B\xFF\x0C\x5E\xD3\x35\x2E\x18\xB9\x6A\x86\xE1"
+    "\xFC\x8E\x64\x38\x39\xCC\xA1\xB9\x5E\x14\xCE\xCD\x63\x6E\xDD\xC9"
+    "\xF4\x60\x83\xF4\x9A\x3B\xF7\x68\xCF\xAD\x61\xF1\x6F\x1B\x8A\x5D"
+    "\xAA\x14\xE6\xF6\xAC\xCE\xD8\x9C\x92\x1F\xA1\xD1\x96\x15\x08\x34"
+    "\x6C\xDE\xD3\xB5\xFE\x7A\x97\xD6\xC6\xBF\x7E\x6E\x94\x6C\xBC\x2C"
+    "\x38\x01\xC4\x8E\xE8\x0A\x95\x8A\x68\x57\x9E\xAE\x17\x98\xE5\x5B"
+    "\xA0\x74\xD2\xB6\xCB\xE7\x68\xEE\x50\x47\x89\x8F\xAB\x76\x6C\x6C"
+    "\x07\x64\x07\xF9\xF9\xE7\x6C\xF4\xD7\x5D\xED\x7D\x23\x07\x02\x54"
+    "\xFC\x97\x84\x2E\x54\x7E\xE9\xBE\xB1\x30\x4E\x60\xB1\xAC\xC8\x6B"
+    "\xC3\x34\xF5\x59\x76\x77\x42\xEC\xE4\xC0\x54\xD7\x4A\x0D\xC4\x07"
+    "\xF2\xB9\x07\xDE\xE7\x13\x41\x5B\x07\xAA\xBC\xE6\x4A\xF1\x70\xED"
+    "\xE3\x58\xAF\xE5\x13\xB7\x6D\x77\xA6\xE8\x04\x90\x43\x58\x7F\xA4"
+    "\x0B\xEF\x28\x56\x70\xA9\xF6\xCF\x78\xAA\xC9\xFD\xEC\x1B\xE8\xCF"
+    "\xF3\xDC\x33\x36\x8D\x83\x96\xC5\x15\xAC\xD1\x9F\xFC\xA6\xB2\x2F"
+    "\xB3\x69\xA3\x84\x9F\xFD\x7B\x07\x0D\xC0\x4B\xD0\xB5\x46\x91\xFB"
+    "\x5A\x57\xF8\x01\xAF\x69\x88\xCA\x60\xA9\x74\xD8\x0D\x30\xCB\xCF"
+    "\xCB\x06\xB7\x44\x78\x23\x79\x58\x61\x98\x01\x83\xF0\x47\x15\xF1"
+    "\x1C\xC3\xB0\x6C\x82\x9A\x46\x67\x47\x19\xB2\xB3\xA9\xFA\xC8\x2F"
+    "\x92\x58\x6A\xCC\xD2\xF5\x62\xA8\x71\xE1\x0D\x31\xFB\x57\xB1\x62"
+    "\x02\x68\x28\xF8\x42\x9D\xF5\x9C\xD1\x41\xF3\x10\x48\x88\xEB\xCD"
+    "\x40\x42\x9C\x8E\x16\xE5\x92\x06\x8B\xF7\xDF\x5F\xF2\x99\xD6\x6B"
+    "\xDC\x83\xEF\xEB\xED\xF6\x9B\x7E\xE2\x0D\x05\x63\x31\xA6\x1A\xFA"
+    "\x53\x40\x49\x47\x0C\x88\xB9\x87\x99\x60\x07\x4D\x61\x2C\x18\x9F"
+    "\xBE\x6D\x98\x67\x36\x35\x75\x9D\xD6\x9C\x69\x2B\xC1\xFF\x7A\xA6"
+    "\x6C\x17\x56\xCE\x74\xED\x2D\x78\x63\x53\xD5\x6F\x69\xC8\x34\x8D"
+    "\xD6\xB9\xB1\x29\x9A\xC4\x48\x4D\xAA\x8E\xF6\xCD\xB4\xE3\xDF\x10"
+    "\xA0\xC3\xE7\x57\xB2\xD5\x8F\x35\xB7\x8E\xEB\xB6\xFE\xA6\xCE\x17"
+    "\xE1\xE4\x88\x7E\x90\xF7\x8D\x83\x40\xF8\x4C\x15\x84\xB8\x73\x0C"
+    "\x35\xCD\x4C\x0C\x3E\x1F\xE0\xE7\x83\xF3\xD4\x87\x8B\xD4\x87\x16"
+    "\xF6\xB3\x2B\x54\xDB\xDC\x02\x64\x99\xD8\x51\xB9\x4A\x76\x8E\x57"
+    "\x35\xA6\x67\x8A\x02\x20\xBB\x41\xE2\x1B\x07\x32\x12\x1F\x53\x24"
+    "\xA3\x0C\x90\x01\xBD\x9E\x84\x6F\xC7\x59\x9C\x5A\xA2\x79\x4E\x60"
+    "\xCC\x16\x93\x51\xEA\x43\x36\xE5\x27\x64\x2D\xE8\xC1\x62\xD1\x5B"
+    "\x12\x39\x48\x96\x74\x3B\xD0\x44\x4E\xC7\xF6\x63\x67\x66\x89\xD1"
+    "\x96\xA4\x2F\xE7\x31\xEC\xD7\x4D\xC1\x51\xAA\x0E\x0C\x0F\x98\xAF"
+    "\xAF\x01\xE5\xB2\x52\x9F\x77\x69\x16\xD8\xE7\xBB\xA3\x37\x6E\xC9"
+    "\xFC\xDC\x2D\x69\x9E\xFD\x92\xE8\xAD\x0B\x0A\x25\x1D\x79\x91\x05"
+    "\x5D\xD5\x08\xDF\xFB\x35\x81\x79\x8A\xE3\x95\x5B\xCB\x7D\xE7\xD7"
+    "\x98\x17\x2B\xCC\x5C\x5B\xBE\x2B\x64\x1D\xFF\xAD\xA9\x65\xB7\x08"
+    "\x5A\xE7\x07\x7D\x7B\x41\xB6\x2C\x0E\x7B\x64\x13\xA7\x2E\x17\x75"
+    "\xDB\xBA\xA6\x75\x1E\x33\xCC\xF5\x62\x72\x1A\xEA\xC3\x46\x18\xB5"
+    "\xE0\xDD\x58\xA6\xA3\xB0\x79\x5B\x47\x3A\x5F\xCC\x44\x99\xF4\xA7"
+    "\xE6\xD3\x57\xEB\xA3\xA3\x62\xF5\xB2\xFC\x57\x31\xDE\x76\xF5\x6F"
+    "\x4C\xC9\x72\xDD\x46\x39\xAF\xCB\x06\xAD\x9A\x12\x01\x87\x3E\xA0"
+    "\x0C\x9C\x29\x16\x1D\xF9\xD9\xC0\x1D\x21\xC1\xD9\x3B\xE5\x2B\xD3"
+    "\x09\x06\xFB\x3C\xC7\x31\xC7\xC8\xC7\x11\x42\x4F\x12\xB4\x98\xF0"
+    "\xAC\x51\xE8\x3C\xA9\xE7\xC5\x62\x3B\x26\x40\xC4\xDC\x88\x64\xD2"
+    "\x95\x24\xEF\xC8\x0D\x8B\x5B\xA0\x8E\xCF\x96\x12\xC2\x5D\xD7\x72"
+    "\xED\x46\xFD\x7A\xE3\xC8\xD7\x64\x96\xF5\x6C\x5A\xBF\x65\xB1\x69"
+    "\xDF\xB9\xA2\x99\xFA\x23\x86\x44\x75\x56\xF4\xD8\x49\x3F\x3A\x9C"
+    "\xC7\xB0\xDA\xC8\xFE\xAB\xB8\xCB\x01\x16\xE1\xAD\xAE\x5C\xAA\xFD"
+    "\xFC\xE5\xA6\x76\xEF\x61\x2F\x4C\x88\xEA\x72\x56\xB4\xA7\x7D\xEC"
+    "\xE2\xA6\xA6\xF5\x39\x25\xCC\xBA\x3A\x98\x49\x9C\x18\x52\xE8\x20"
+    "\xF0\x42\x03\x0C\x17\xF5\xD7\x51\xD4\xDF\x78\x8B\x70\x3C\xEF\xFD"
+    "\x50\x1E\xA1\x81\xF4\xF4\x7E\x0D\xED\x55\x7E\xE8\xF4\x10\x9E\xBD"
+    "\x6E\x01\x14\xEC\x8F\x40\xA0\xCD\x0F\x71\x3C\x46\x53\xF8\x63\x51"
+    "\x56\x6F\xF1\x21\x61\x67\x70\x24\x8E\xCE\x15\x2B\x38\x50\xBC\x1E"
+    "\xC7\x46\xCB\x76\x26\x21\xBB\xEC\x78\x76\xCD\x6F\x01\xA7\x83\x4F"
+    "\x45\xA9\x04\x0B\x78\x44\x8C\xA5\x2E\xC5\xDE\xF5\xA7\x34\x75\x89"
+    "\x14\x89\xF6\x67\xC0\x78\xA3\xE1\xEA\x86\x92\x52\x5B\x7F\x62\x38"
+    "\x5A\x37\xDC\x9A\xE8\x23\xD1\x29\x55\xC2\x67\x1E\x4A\x5E\xE6\x59"
+    "\x9B\xDB\x0A\xC5\x06\x95\x71\xC7\xEB\x85\xF7\xAA\x57\x57\x8D\x0F"
+    "\x61\xA4\x43\xC1\x67\x8F\x6C\xF2\x7B\xB0\xD1\x14\x1F\xE3\x46\x24"
+    "\x51\x20\xAE\x8D\x87\x46\xB1\xE1\x13\xC2\xEA\xE0\xE9\x99\xE0\x18"
+    "\xF2\x50\x8E\x0E\x01\xCF\x25\xD7\x2B\xB2\xEC\xF5\xCF\xB6\xC8\x96"
+    "\x83\x96\xCB\x98\xC4\x77\x3E\xB8\x62\x1F\xEB\x8E\xEC\xBF\xDF\x48"
+    "\x50\x92\x49\x44\xB6\x05\x8A\xFE\x4B\xB6\x58\x4E\x3C\xA5\x23\x4D"
+    "\xF2\x44\x68\x60\x44\x8A\x53\x57\xDF\x12\xF6\x44\x0E\xAD\x3C\xC6"
+    "\xD8\x35\x06\x16\x9B\x79\x39\x3E\x52\x41\xCE\x12\xBA\x0E\x9B\x8D"
+    "\x5D\xC9\x6A\xEA\x5B\x00\xA0\x92\xCE\xA0\x53\x58\xD1\x09\x7B\xD9"
+    "\xDC\x72\x91\x8E\x84\x2C\xBE\x95\x62\x51\x27\x59\xD1\x54\x24\x31"
+    "\x21\x57\xAE\x44\x6E\xF4\x28\x33\xA7\xCA\x06\x8C\x1D\xC9\x8F\x14"
+    "\x67\xF0\x48\xC1\x90\x8B\xDD\x0E\xC4\x71\xF0\x27\x7D\xA2\x58\x64"
+    "\x83\xD6\x47\x9E\x93\xFA\xAC\xB3\xE5\xC8\x96\x69\x8A\x19\xB3\x88"
+    "\xF1\xC6\xA1\x12\xD8\xD3\x1E\x1E\x6E\x76\xB6\x17\x99\x87\x43\x08"
+    "\x14\x55\xF2\x52\xC4\x8C\x6A\x7E\xA9\xD1\x8F\x2F\x46\xD7\x25\x6B"
+    "\x57\xEE\xF9\x6B\x82\x4E\x65\xA5\x77\xA9\x38\x08\xCA\x20\x0C\x7B"
+    "\x41\xC5\xB5\x99\x21\xA3\x1A\xD3\x4F\x86\x10\xB4\x67\x4C\xA3\x72"
+    "\xB8\xA7\x6C\x72\x0A\xB8\x92\xB8\x7B\xF0\x5C\x63\x44\x5B\x2F\xF9"
+    "\x00\x2A\xE2\xCC\xE2\x9D\x55\x51\xB8\x6B\x99\x97\x82\x02\x91\xD7"
+    "\xD5\xA2\xCE\xE7\x2A\xFF\xFA\x3D\xAF\x2E\x9F\x17\x3A\xC9\x54\xB6"
+    "\x38\x20\x3C\x37\xCA\x1E\x55\x97\x36\xB9\x20\xF5\xFF\x95\xCE\x0C"
+    "\xC5\x79\x25\xF4\xB7\x23\x74\x30\x7F\x50\xAF\x29\x8C\xCF\xAE\x7B"
+    "\xA8\x06\xB5\x92\xDD\x40\xF7\xA0\xE2\x50\xAD\x1B\x0B\xBD\xE2\x9D"
+    "\x95\x8B\x85\x5E\x52\x80\x79\x48\xCE\x63\x03\x4D\x47\xF7\x79\x31"
+    "\xB1\x05\xD0\x23\xC1\x39\xDC\xDD\x1E\xD4\xFF\x7A\x19\xEB\x3E\x7A"
+    "\x46\x71\x34\x66\x3E\x73\x27\xF7\x1B\xE9\x10\x25\x0E\x80\x3B\x3C"
+    "\x90\xEC\x88\x0A\x8F\x18\x1A\xA9\x66\x35\x0B\xFC\xCB\xF2\x25\xAC"
+    "\x42\xC5\xDF\x0E\x66\x87\xFB\x9F\xBC\x7F\x88\x67\xF3\x15\xF4\x69"
+    "\xFB\xF2\xA7\xDE\x4E\xEA\xFB\x81\xF6\x58\x78\x53\xA4\xC8\x47\x2A"
+    "\x0D\xD9\xA1\x60\x1A\xB4\x3C\x56\x7D\x54\xE9\x24\x3A\x29\xF2\xEF"
+    "\xC7\x06\x00\x7F\x74\x05\x40\x02\xF1\xDD\x11\xA2\x5D\x88\x7A\x9D"
+    "\x08\x6E\x94\x45\x75\xDF\x3C\x0D\x89\x82\x31\xA3\x87\xAE\x36\xE8"
+    "\xE3\x71\xAB\x73\x19\xA9\xC9\xE6\x75\xB5\xA5\x73\x8F\x29\xAF\x27"
+    "\xBA\xB3\xA4\xB3\xB8\xE2\x1F\x4D\x76\x58\xD0\x2D\x16\x5D\xAE\x64"
+    "\x7D\x12\xC8\xD6\x36\x1C\x0B\xC5\x1C\x6F\x3B\xD7\x9C\x3C\x47\xB9"
+    "\x88\x33\x88\x30\x7E\x13\x62\x6F\xB6\xB6\x93\x6E\x1F\xE4\x1D\x07"
+    "\xE8\x50\xAE\xE9\x7D\xE3\x72\x1F\x7A\xD1\x45\x13\x1B\xFB\xD4\x52"
+    "\x93\xAD\x03\x37\x26\xDA\xC7\x44\xC8\x9B\xAC\xDA\x6F\x1F\xEF\x9A"
+    "\x70\x24\x0A\x9E\xBE\x0E\xE2\x06\xCC\x46\xAE\x36\x03\xDC\x10\xB9"
+    "\x45\x3D\x2B\x7C\xF7\x5F\x8B\xBD\x75\x32\x7C\xB0\x06\x4E\x3E\xD5"
+    "\x32\x46\xBF\x45\x97\x69\x21\x50\xF3\xE3\x59\x97\x93\x07\x7C\x76"
+    "\x7C\x43\x94\xCF\x75\x4F\x15\xB2\xCB\xEA\x2D\xA5\xDC\x91\x58\xBF"
+    "\xEE\x4E\xC7\x16\x28\x36\xE3\x62\x0E\x10\x80\x1C\x52\xC2\xBF\x00"
+    "\xA1\x68\x02\x65\x2D\x51\x70\xCA\x63\x65\xE5\xBC\x1C\x4C\xF8\x4E"
+    "\xA7\xF6\xB8\x33\x7B\x54\x1E\x74\x3B\xAF\xC7\x9D\xD6\x3D\xCF\xF1"
+    "\xEC\x91\x72\xE3\x97\x44\x2F\xBA\xC7\xA8\x70\xC7\x48\x5F\x04\xE8"
+    "\xA9\x73\x40\xE7\x09\x2E\x81\x8B\x0D\x08\x5C\x08\x02\x63\x45\xEB"
+    "\x19\x3E\xE4\x7E\x82\x58\x0A\x7F\xFC\x4A\xF6\xF5\xEC\xB0\x13\x6F"
+    "\xE5\xB6\xEF\x74\xB8\xBB\x0A\xD4\x38\x05\x65\xC9\xED\xE8\xD9\xE1"
+    "\xF0\x8E\x4A\xAF\x7F\xAC\x68\x3B\x9A\xBA\x1F\xE0\xDC\xA8\x67\x5D"
+    "\xA3\xFC\x57\xE7\x78\x98\x42\xDA\x93\xCA\xBC\x18\x8C\xA7\xA9\xA1"
+    "\x71\x00\x51\xF0\xFF\x03\x8B\x28\x26\x3E\x78\x89\x03\x00"
 };
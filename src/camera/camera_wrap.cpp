@@ -66,8 +66,7 @@ int initCamera()
         esp_err_t err = esp_camera_init(&config);
         if (err != ESP_OK)
         {
-            LOG_ERROR("Camera init failed with error 0x");
-            LOG_ERROR(err);
+            LOG_ERROR("Camera init failed with error 0x%x", err);
             return -1;
         }
 
@@ -32,13 +32,27 @@ const int BUILTIN_LED_PIN = 33;    // not the 'flash' led, the small led
 
 // speed controller constants
 const unsigned int CONTROL_POLL_MS = 20;        // how often to run speed controller
-const unsigned int CONTROL_HISTORY_LENGTH = 2;  // number of samples used for smoothing speed control
+const unsigned int CONTROL_HISTORY_LENGTH = 2;  // number of samples used for smoothing speed control; power of two
 const unsigned int CONTROL_HISTORY_MS = CONTROL_POLL_MS * CONTROL_HISTORY_LENGTH;   // time interval for smoothing speed control
 const speed_type SPEED_TOLERANCE = 0.3;         // +/- range for target speed
 const encoder_count_type CONTROL_MIN_ENCODER_COUNT = PULSES_PER_REVOLUTION / 4;     // travel at least 1/4 turn before calculating velocity
 const unsigned int CONTROL_SETTLE_MS = 20;     // number of milliseconds after changing direction that we
                                                // we continue to integrate encoder ticks in the prior direction
                                                // in order to handle inertia.
+
+// wheel speed estimate; see wheel/speed_estimator.h
+typedef enum {
+    SPEED_DIFFERENCE,       // distance change across the control history; least lag, most noise
+    SPEED_AVERAGE,          // exponential moving average of the difference
+    SPEED_MEAN,             // mean of the last SPEED_FILTER_WINDOW differences
+    SPEED_MEDIAN,           // median of the last SPEED_FILTER_WINDOW differences; rejects encoder glitches
+    SPEED_SAVITZKY_GOLAY,   // least-squares slope of the last SPEED_FILTER_WINDOW distances
+    NUMBER_OF_SPEED_FILTERS,    // SHOULD ALWAYS BE LAST
+} SpeedFilter;
+const SpeedFilter SPEED_FILTER = SPEED_DIFFERENCE;  // estimate used by speed control
+const unsigned int SPEED_FILTER_WINDOW = 5;         // samples in windowed speed filters; odd
+const speed_type SPEED_AVERAGE_ALPHA = 0.5;         // weight of newest sample in SPEED_AVERAGE
+
 // pose
 const unsigned int POSE_POLL_MS = 20;        // how often to run pose estimation
 const encoder_count_type POSE_MIN_ENCODER_COUNT = CONTROL_MIN_ENCODER_COUNT;     // travel at least 1/5 turn before updating pose
@@ -52,4 +66,66 @@ const distance_type WHEELBASE = 13.5;   // centimeters
 
 const distance_type POINT_FORWARD_FRACTION = 0.75;  // position of forward control point as fraction of wheelbase
 
+// goto goal approach controller
+const speed_type GOTO_CRUISE_FRACTION = 0.5;    // cruising speed as fraction of span between min and max speed
+const distance_type GOTO_SLOW_DISTANCE = 30;    // start slowing down this far from goal (centimeters)
+const float GOTO_HEADING_GAIN = 2.0;            // turn rate in radians/sec per radian of heading error
+
+// path planning
+const unsigned int MAP_MAX_COLUMNS = 48;    // largest map that can be uploaded
+const unsigned int MAP_MAX_ROWS = 48;
+const unsigned int MAP_MAX_CELLS = MAP_MAX_COLUMNS * MAP_MAX_ROWS;
+const unsigned int PLAN_HEAP_ENTRIES = MAP_MAX_CELLS / 2;  // planner open list capacity
+
+// geofence
+const speed_type GEOFENCE_DECELERATION = 60;    // assumed braking deceleration for stopping distance (cm/sec^2)
+const distance_type GEOFENCE_MARGIN = 10;       // default distance to keep from fences (centimeters)
+const float GEOFENCE_TURN_TOLERANCE = 0.35;     // turn in place until heading is within this of inward direction (radians)
+
+// command deadman timer
+const unsigned long DEADMAN_TIMEOUT_MS = 1000;  // halt if moving and no movement command or heartbeat within this time; 0 disables
+const unsigned long DEADMAN_RAMP_MS = 300;      // time to ramp down to a halt when deadman expires
+
+// on-rover scripts
+const unsigned int SCRIPT_MAX_BYTES = 512;      // largest compiled script
+const unsigned int SCRIPT_MAX_DEPTH = 4;        // deepest nesting of repeat blocks
+const unsigned int SCRIPT_OPS_PER_POLL = 8;     // most script instructions run per control loop tick
+
+// persistent settings
+const unsigned long SETTINGS_DEBOUNCE_MS = 2000;    // write changed settings once they have been quiet this long
+
+// wifi connection manager
+const unsigned long WIFI_JOIN_TIMEOUT_MS = 10000;   // give up on a join that scans all channels after this long
+const unsigned long WIFI_REJOIN_TIMEOUT_MS = 3000;  // give up on a join to the cached access point after this long
+const unsigned long WIFI_BACKOFF_MIN_MS = 500;      // wait after first failed join
+const unsigned long WIFI_BACKOFF_MAX_MS = 30000;    // longest wait between failed joins
+
+// multiplexed websocket; build with -D USE_MULTIPLEX_SOCKET to carry
+// commands, telemetry and video on one socket instead of two
+const unsigned int MUX_SOCKET_PORT = 82;            // replaces the command socket's port
+const unsigned int MUX_VIDEO_CHUNK_BYTES = 4096;    // most jpeg bytes sent before queued commands and telemetry get a turn
+
+// udp control port; build with -D USE_UDP_COMMANDS to accept
+// sequenced movement commands and send telemetry over udp
+const unsigned int UDP_COMMAND_PORT = 83;               // rover listens for commands here and sends telemetry back to the sender
+const unsigned long UDP_SEQUENCE_RESET_MS = 2000;       // accept any sequence after this long without a packet; sender may have restarted
+
+// command latency instrumentation
+const unsigned long LATENCY_REPORT_MS = 5000;   // publish latency histograms this often when there are new samples
+
+// structured logging
+const unsigned int LOG_RING_RECORDS = 64;       // log records held until drained; must be a power of two
+const unsigned int LOG_ARG_BYTES = 39;          // binary argument bytes per record; later arguments are dropped
+const unsigned int LOG_DRAIN_PER_POLL = 8;      // most log records formatted and sent per loop
+const unsigned int LOG_TEXT_BYTES = 128;        // longest formatted log line
+
+// health checks
+const unsigned long LOOP_OVERRUN_US = 2 * CONTROL_POLL_MS * 1000UL;    // a loop this long misses a speed control poll
+const unsigned long HEALTH_WINDOW_MS = 10000;           // a loop overrun or telemetry drop degrades health for this long
+const unsigned long HEALTH_LOOP_STALLED_MS = 500;       // control loop is failed if it has not run for this long
+const unsigned long HEALTH_FRAME_STALE_MS = 2000;       // camera is degraded if streaming and no frame for this long
+const unsigned long HEALTH_FRAME_FAILED_MS = 10000;     // camera is failed if streaming and no frame for this long
+const unsigned long HEALTH_ENCODER_SILENT_MS = 500;     // encoder is failed if its wheel is powered with no edges for this long
+const unsigned long HEALTH_TELEMETRY_STUCK_MS = 5000;   // telemetry is failed if its buffers stay full this long
+
 #endif // CONFIG_H
\ No newline at end of file
@@ -1,8 +1,9 @@
-// #include <Arduino.h>
 #include "encoder.h"
+#include "../hal/clock.h"
+#include "../hal/gpio.h"
 
 #define LOG_LEVEL DEBUG_LEVEL
-#include "./log.h"
+#include "../log.h"
 
 // defined in encoderInterrupts.cpp
 extern bool encoderInterruptAttached(encoder_iss_type interruptServiceSlot);
@@ -71,7 +72,7 @@ void Encoder::setDirection(
     //
     ++this->_settingDirection;    // so ISR knows not to use this state while it is changing
     this->_settleDirection = this->_direction ? this->_direction : direction;  // remember inertial direction
-    this->_settleTimeMs = millis() + this->_settleMs;
+    this->_settleTimeMs = halMillis() + this->_settleMs;
     this->_direction = direction;
     --this->_settingDirection;    // now safe for ISR to use this state
 }
@@ -106,7 +107,7 @@ void FASTCODE Encoder::encode()
     // and use them to compute the direction.
     //
     const encoder_direction_type direction = 
-        (this->_settingDirection || (millis() > this->_settleTimeMs)) 
+        (this->_settingDirection || (halMillis() > this->_settleTimeMs)) 
         ? _direction 
         : _settleDirection;
 
@@ -145,7 +146,7 @@ bool Encoder::attached()     // RET: true if attached, false if not
  * Set the pin mode and enable polling
  */
 void Encoder::attach() {
-    pinMode(_pin, INPUT_PULLUP);
+    halPinMode(_pin, HAL_INPUT_PULLUP);
     if(this->_interrupt_slot >= 0) {
         attachEncoderInterrupt(*this, this->_interrupt_slot);
     }
@@ -168,7 +169,7 @@ void Encoder::detach() {
 gpio_state Encoder::readPin() // RET: pin state GPIO_LOW or GPIO_HIGH
 {
     if(attached()) {
-        return (gpio_state)digitalRead(_pin);
+        return halDigitalRead(_pin);
     }
     return GPIO_LOW;
 }
@@ -2,7 +2,7 @@
 #define ENCODER_H
 
 #include "../gpio/gpio.h"
-#include "../gpio/interrupts.h"
+#include "../hal/isr.h"
 #include "../config.h"
 
 typedef int encoder_iss_type;  // encoder interrupt slot 
@@ -1,16 +1,15 @@
 /**
  * Provide for some number of encoder interrupt service routines
  */
-// #include <Arduino.h>
 #include <assert.h>
+#include <stddef.h>
 #include "encoder.h"
 
 
 #define LOG_LEVEL DEBUG_LEVEL
 #include "../log.h"
 
-#include "../gpio/pwm.h"
-#include "../gpio/interrupts.h"
+#include "../hal/isr.h"
 
 
 //////////////// LM393 wheel encoders ////////////
@@ -66,7 +65,7 @@ bool attachEncoderInterrupt(
     if(!encoderInterruptAttached(interruptServiceSlot)) {
         _encoder[interruptServiceSlot] = &encoder;
 
-        ATTACH_ISR(_isr_routines[interruptServiceSlot], encoder.pin(), CHANGING_EDGE);
+        halAttachIsr(encoder.pin(), _isr_routines[interruptServiceSlot], CHANGING_EDGE);
     }
     return &encoder == _encoder[interruptServiceSlot];
 }
@@ -85,7 +84,7 @@ bool detachEncoderInterrupt(
     if(encoderInterruptAttached(interruptServiceSlot)) {
         Encoder *theEncoder = _encoder[interruptServiceSlot];
         if(theEncoder == &encoder) {
-            DETACH_ISR(_isr_routines[interruptServiceSlot], encoder.pin());
+            halDetachIsr(encoder.pin());
 
             _encoder[interruptServiceSlot] = NULL;
         }
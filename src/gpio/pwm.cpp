@@ -1,5 +1,5 @@
 #include "pwm.h"
-#include "analogWrite.h"
+#include "../hal/pwm.h"
 
 
 
@@ -51,7 +51,7 @@ PwmChannel& PwmChannel::attach()    // RET: this attached channel
 {
     if(!_attached) {
         // set pin mode and analog write channel
-        pinMode(_pin, OUTPUT); analogWriteChannel(_pin, _channel);
+        halPwmAttach(_pin, _channel);
         _attached = true;
     }
 
@@ -81,8 +81,22 @@ PwmChannel& PwmChannel::writePwm(pwm_type pwm)  // IN : pwm value (0 to pwmMask)
                                                 // RET: this channel
 {
     if(_attached) {
-        analogWrite(_pin, pwm, _pwmMask);
+        halPwmWrite(_pin, pwm, _pwmMask);
+        if(nullptr != _writeHook) {
+            _writeHook(_pin, pwm);
+        }
     }
 
     return *this;
 }
+
+pwm_write_hook_type PwmChannel::_writeHook = nullptr;
+
+/**
+ * Set the function called after every pwm write
+ * on any channel.
+ */
+void PwmChannel::setWriteHook(pwm_write_hook_type hook) // IN : hook function or nullptr for none
+{
+    _writeHook = hook;
+}
@@ -7,6 +7,12 @@ typedef unsigned char pwm_resolution_type;  // pwm resolution
 typedef unsigned int pwm_type;              // pwm value
 typedef int analog_write_channel_type;      // analog write channel number
 
+//
+// function called after any pwm value is written;
+// used to timestamp when commands reach the motors.
+//
+typedef void (*pwm_write_hook_type)(gpio_type pin, pwm_type pwm);
+
 /**
  * A gpio pin and analog write channel
  * used to write pwm values to the pin.
@@ -22,6 +28,8 @@ class PwmChannel {
     bool _attached = false;
     pwm_type _pwm = 0;
 
+    static pwm_write_hook_type _writeHook;
+
     public:
 
     PwmChannel(
@@ -79,6 +87,13 @@ class PwmChannel {
      */
     PwmChannel& writePwm(pwm_type pwm);  // IN : pwm value (0 to pwmMask)
                                         // RET: this channel
+
+    /**
+     * Set the function called after every pwm write
+     * on any channel.  It runs in the caller of writePwm(),
+     * so it must be quick.
+     */
+    static void setWriteHook(pwm_write_hook_type hook); // IN : hook function or nullptr for none
 };
 
 #endif // GPIO_PWM_H
@@ -0,0 +1,23 @@
+#ifndef HAL_CLOCK_H
+#define HAL_CLOCK_H
+
+//
+// Hardware abstraction: time since boot.
+//
+// On the rover these are the framework's millis() and
+// micros(), forced inline so they cost nothing and stay
+// in IRAM for interrupt handlers that call them.
+// On Linux (TESTING) see hal/linux_hal.h.
+//
+
+#ifndef TESTING
+    #include <Arduino.h>
+
+    __attribute__((always_inline)) inline unsigned long halMillis() { return millis(); }
+    __attribute__((always_inline)) inline unsigned long halMicros() { return micros(); }
+#else
+    extern unsigned long halMillis();   // RET: milliseconds since start
+    extern unsigned long halMicros();   // RET: microseconds since start
+#endif
+
+#endif // HAL_CLOCK_H
@@ -0,0 +1,46 @@
+#ifndef TESTING
+
+#include <Arduino.h>
+#include "isr.h"
+#include "../error.h"
+
+#define LOG_LEVEL DEBUG_LEVEL
+#include "../log.h"
+
+//
+// The Esp32Cam initializes the interrupt system, as done the arduino 'attachInterrupt()' method.
+// That conflict causes a failure.  So we need to
+// 1. Initialize camera BEFORE the encoder interupts are added
+// 2. Use Esp32 specific code to attach the interrupt routine to avoid a second initialization
+//
+int halAttachIsr(gpio_type pin, gpio_isr_type isr, gpio_interrupt_mode mode) {
+    int err = gpio_isr_handler_add((gpio_num_t)pin, isr, (void *) 1);
+    if (err != ESP_OK) {
+        LOG_ERROR("Handler add failed with error: %d", err);
+        return FAILURE;
+    }
+    err = gpio_set_intr_type((gpio_num_t)pin, mode);
+    if (err != ESP_OK) {
+        LOG_ERROR("set intr type failed with error: %d", err);
+        return FAILURE;
+    }
+    return SUCCESS;
+}
+
+int halDetachIsr(gpio_type pin) {
+    int err = gpio_set_intr_type((gpio_num_t)pin, GPIO_INTR_DISABLE);
+    if (err != ESP_OK) {
+        LOG_ERROR("set intr type failed with error: %d", err);
+        return FAILURE;
+    }
+
+    err = gpio_isr_handler_remove((gpio_num_t)pin);
+    if (err != ESP_OK) {
+        LOG_ERROR("Handler removed failed with error: %d", err);
+        return FAILURE;
+    }
+
+    return SUCCESS;
+}
+
+#endif // TESTING
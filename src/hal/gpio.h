@@ -0,0 +1,42 @@
+#ifndef HAL_GPIO_H
+#define HAL_GPIO_H
+
+//
+// Hardware abstraction: digital gpio.
+//
+// On the rover these are the framework's pinMode(),
+// digitalRead() and digitalWrite(), forced inline so
+// they stay in IRAM for interrupt handlers that call them.
+// On Linux (TESTING) see hal/linux_hal.h.
+//
+
+#include "../gpio/gpio.h"
+
+typedef enum hal_gpio_mode {
+    HAL_INPUT,
+    HAL_INPUT_PULLUP,
+    HAL_OUTPUT,
+} hal_gpio_mode;
+
+#ifndef TESTING
+    #include <Arduino.h>
+
+    __attribute__((always_inline)) inline void halPinMode(gpio_type pin, hal_gpio_mode mode) {
+        pinMode(pin, (HAL_OUTPUT == mode) ? OUTPUT : ((HAL_INPUT_PULLUP == mode) ? INPUT_PULLUP : INPUT));
+    }
+    __attribute__((always_inline)) inline gpio_state halDigitalRead(gpio_type pin) {
+        return digitalRead(pin) ? GPIO_HIGH : GPIO_LOW;
+    }
+    __attribute__((always_inline)) inline void halDigitalWrite(gpio_type pin, gpio_state state) {
+        digitalWrite(pin, (GPIO_HIGH == state) ? HIGH : LOW);
+    }
+#else
+    extern void halPinMode(gpio_type pin, hal_gpio_mode mode);  // IN : gpio pin
+                                                                // IN : input, input with pullup or output
+    extern gpio_state halDigitalRead(gpio_type pin);            // IN : gpio pin
+                                                                // RET: GPIO_LOW or GPIO_HIGH
+    extern void halDigitalWrite(gpio_type pin, gpio_state state);   // IN : gpio pin
+                                                                    // IN : GPIO_LOW or GPIO_HIGH
+#endif
+
+#endif // HAL_GPIO_H
@@ -0,0 +1,65 @@
+#ifndef HAL_ISR_H
+#define HAL_ISR_H
+
+//
+// Hardware abstraction: gpio interrupt handlers.
+//
+// On the rover handlers are attached with the ESP32's
+// own gpio api; see hal/esp32_hal.cpp for why.
+// On Linux (TESTING) a handler runs when the pin is
+// changed with halSetPin(); see hal/linux_hal.h.
+//
+
+#include "../gpio/gpio.h"
+
+#ifndef TESTING
+    #include <Arduino.h>
+
+    #define FASTCODE IRAM_ATTR
+    #define FASTDATA DRAM_ATTR
+
+    // gpio interrupt modes
+    #define DISABLE_INT GPIO_INTR_DISABLE
+    #define RISING_EDGE GPIO_INTR_POSEDGE
+    #define FALLING_EDGE GPIO_INTR_NEGEDGE
+    #define CHANGING_EDGE GPIO_INTR_ANYEDGE
+    #define LEVEL_LOW GPIO_INTR_LOW_LEVEL
+    #define LEVEL_HIGH GPIO_INTR_HIGH_LEVEL
+    typedef gpio_int_type_t gpio_interrupt_mode;
+
+    #define ISR_PARAMS void *params
+#else
+    #define FASTCODE
+    #define FASTDATA
+
+    // gpio interrupt modes
+    typedef enum gpio_interrupt_mode {
+        DISABLE_INT,
+        RISING_EDGE,
+        FALLING_EDGE,
+        CHANGING_EDGE,
+        LEVEL_LOW,
+        LEVEL_HIGH,
+    } gpio_interrupt_mode;
+
+    #define ISR_PARAMS void
+#endif
+
+typedef void (*gpio_isr_type)(ISR_PARAMS);
+
+/**
+ * Run a handler on an input pin's interrupt
+ */
+extern int halAttachIsr(
+    gpio_type pin,              // IN : gpio input pin
+    gpio_isr_type isr,          // IN : handler; must be FASTCODE
+    gpio_interrupt_mode mode);  // IN : edge or level that runs the handler
+                                // RET: SUCCESS or FAILURE
+
+/**
+ * Stop running the pin's handler
+ */
+extern int halDetachIsr(gpio_type pin); // IN : gpio input pin
+                                        // RET: SUCCESS or FAILURE
+
+#endif // HAL_ISR_H
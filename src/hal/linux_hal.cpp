@@ -0,0 +1,167 @@
+#ifdef TESTING
+
+#include <time.h>
+#include "linux_hal.h"
+#include "../error.h"
+
+typedef struct HalPin {
+    hal_gpio_mode mode;
+    gpio_state state;
+    int pwmChannel;             // -1 if not pwm
+    float duty;
+    gpio_isr_type isr;
+    gpio_interrupt_mode interruptMode;
+} HalPin;
+
+static const HalPin PIN_AT_START = {HAL_INPUT, GPIO_LOW, -1, 0, nullptr, DISABLE_INT};
+
+static HalPin pins[HAL_GPIO_COUNT];
+static bool pinsStarted = false;
+static bool simulatedClock = false;
+static unsigned long long simulatedMicros = 0;
+
+static HalPin *pinAt(gpio_type pin) {
+    if(!pinsStarted) {
+        for(unsigned int i = 0; i < HAL_GPIO_COUNT; i += 1) {
+            pins[i] = PIN_AT_START;
+        }
+        pinsStarted = true;
+    }
+    return (pin < HAL_GPIO_COUNT) ? &pins[pin] : nullptr;
+}
+
+static unsigned long long realMicros() {
+    static unsigned long long startMicros = 0;
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    const unsigned long long micros = (unsigned long long)now.tv_sec * 1000000ULL + now.tv_nsec / 1000;
+    if(0 == startMicros) {
+        startMicros = micros;
+    }
+    return micros - startMicros;
+}
+
+//
+// clock
+//
+unsigned long halMillis() {
+    return (unsigned long)((simulatedClock ? simulatedMicros : realMicros()) / 1000);
+}
+
+unsigned long halMicros() {
+    return (unsigned long)(simulatedClock ? simulatedMicros : realMicros());
+}
+
+void halSetMicros(unsigned long long micros) {
+    simulatedClock = true;
+    simulatedMicros = micros;
+}
+
+//
+// gpio
+//
+void halPinMode(gpio_type pin, hal_gpio_mode mode) {
+    HalPin *halPin = pinAt(pin);
+    if(nullptr != halPin) {
+        halPin->mode = mode;
+        if(HAL_INPUT_PULLUP == mode) {
+            halPin->state = GPIO_HIGH;
+        }
+    }
+}
+
+gpio_state halDigitalRead(gpio_type pin) {
+    HalPin *halPin = pinAt(pin);
+    return (nullptr != halPin) ? halPin->state : GPIO_LOW;
+}
+
+void halDigitalWrite(gpio_type pin, gpio_state state) {
+    HalPin *halPin = pinAt(pin);
+    if(nullptr != halPin) {
+        halPin->state = state;
+    }
+}
+
+//
+// pwm
+//
+void halPwmAttach(gpio_type pin, int channel) {
+    HalPin *halPin = pinAt(pin);
+    if(nullptr != halPin) {
+        halPin->mode = HAL_OUTPUT;
+        halPin->pwmChannel = channel;
+    }
+}
+
+void halPwmWrite(gpio_type pin, unsigned int value, unsigned int valueMax) {
+    HalPin *halPin = pinAt(pin);
+    if((nullptr != halPin) && (halPin->pwmChannel >= 0)) {
+        halPin->duty = (valueMax > 0) ? (float)((value > valueMax) ? valueMax : value) / valueMax : 0;
+    }
+}
+
+//
+// interrupts
+//
+int halAttachIsr(gpio_type pin, gpio_isr_type isr, gpio_interrupt_mode mode) {
+    HalPin *halPin = pinAt(pin);
+    if((nullptr == halPin) || (nullptr == isr)) {
+        return FAILURE;
+    }
+    halPin->isr = isr;
+    halPin->interruptMode = mode;
+    return SUCCESS;
+}
+
+int halDetachIsr(gpio_type pin) {
+    HalPin *halPin = pinAt(pin);
+    if(nullptr == halPin) {
+        return FAILURE;
+    }
+    halPin->isr = nullptr;
+    halPin->interruptMode = DISABLE_INT;
+    return SUCCESS;
+}
+
+//
+// hardware side
+//
+void halSetPin(gpio_type pin, gpio_state state) {
+    HalPin *halPin = pinAt(pin);
+    if(nullptr == halPin) {
+        return;
+    }
+
+    const gpio_state previous = halPin->state;
+    halPin->state = state;
+
+    if(nullptr != halPin->isr) {
+        const bool rising = (GPIO_LOW == previous) && (GPIO_HIGH == state);
+        const bool falling = (GPIO_HIGH == previous) && (GPIO_LOW == state);
+        switch(halPin->interruptMode) {
+            case CHANGING_EDGE: if(rising || falling) halPin->isr(); break;
+            case RISING_EDGE:   if(rising) halPin->isr(); break;
+            case FALLING_EDGE:  if(falling) halPin->isr(); break;
+            case LEVEL_LOW:     if(GPIO_LOW == state) halPin->isr(); break;
+            case LEVEL_HIGH:    if(GPIO_HIGH == state) halPin->isr(); break;
+            default: break;
+        }
+    }
+}
+
+gpio_state halGetPin(gpio_type pin) {
+    return halDigitalRead(pin);
+}
+
+float halGetDuty(gpio_type pin) {
+    HalPin *halPin = pinAt(pin);
+    return (nullptr != halPin) ? halPin->duty : 0;
+}
+
+void halReset() {
+    pinsStarted = false;
+    simulatedClock = false;
+    simulatedMicros = 0;
+}
+
+#endif // TESTING
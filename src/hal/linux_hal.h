@@ -0,0 +1,60 @@
+#ifndef HAL_LINUX_HAL_H
+#define HAL_LINUX_HAL_H
+
+//
+// Linux backend of the hardware abstraction, used when
+// the firmware is built on a workstation (TESTING) for
+// tests, the simulator and profiling.
+//
+// The clock is real time since start until halSetMicros()
+// is first called; from then on it is simulated time that
+// only moves when set, so a simulation is deterministic.
+//
+// Pins are kept in memory.  Whatever stands in for the
+// hardware drives inputs with halSetPin(), which runs an
+// attached interrupt handler synchronously, and reads
+// outputs with halGetPin() and halGetDuty().
+//
+
+#ifdef TESTING
+
+#include "clock.h"
+#include "gpio.h"
+#include "pwm.h"
+#include "isr.h"
+
+#define HAL_GPIO_COUNT (40)
+
+/**
+ * Set the simulated clock
+ */
+void halSetMicros(unsigned long long micros);   // IN : microseconds since start
+
+/**
+ * Set an input pin as the hardware would,
+ * running any interrupt attached to that edge
+ */
+void halSetPin(gpio_type pin, gpio_state state);    // IN : gpio pin
+                                                    // IN : GPIO_LOW or GPIO_HIGH
+
+/**
+ * Get the pin's state; last written if an output
+ */
+gpio_state halGetPin(gpio_type pin);    // IN : gpio pin
+                                        // RET: GPIO_LOW or GPIO_HIGH
+
+/**
+ * Get the duty cycle last written to a pwm pin
+ */
+float halGetDuty(gpio_type pin);    // IN : gpio pin
+                                    // RET: 0 to 1.0
+
+/**
+ * Put every pin back to its state at start
+ * and go back to the real clock
+ */
+void halReset();
+
+#endif // TESTING
+
+#endif // HAL_LINUX_HAL_H
@@ -0,0 +1,42 @@
+#ifndef HAL_PWM_H
+#define HAL_PWM_H
+
+//
+// Hardware abstraction: pwm output.
+//
+// On the rover this is the ESP32 analogWrite library,
+// which drives the LEDC peripheral.
+// On Linux (TESTING) see hal/linux_hal.h.
+//
+
+#include "../gpio/gpio.h"
+
+#ifndef TESTING
+    #include <Arduino.h>
+    #include "analogWrite.h"
+
+    inline void halPwmAttach(gpio_type pin, int channel) {
+        pinMode(pin, OUTPUT);
+        analogWriteChannel(pin, channel);
+    }
+    inline void halPwmWrite(gpio_type pin, unsigned int value, unsigned int valueMax) {
+        analogWrite(pin, value, valueMax);
+    }
+#else
+    /**
+     * Make the pin a pwm output on the given channel
+     */
+    extern void halPwmAttach(
+        gpio_type pin,      // IN : gpio pin
+        int channel);       // IN : pwm channel; two pins must not share a channel
+
+    /**
+     * Set the pwm duty as value / valueMax
+     */
+    extern void halPwmWrite(
+        gpio_type pin,              // IN : attached gpio pin
+        unsigned int value,         // IN : 0 to valueMax
+        unsigned int valueMax);     // IN : full duty
+#endif
+
+#endif // HAL_PWM_H
@@ -0,0 +1,50 @@
+#include <string.h>
+#include "etag.h"
+
+/**
+ * Determine if an If-None-Match request header
+ * matches an entity tag
+ */
+bool etagMatches(
+    const char *ifNoneMatch,    // IN : If-None-Match header value, may be nullptr
+    const char *etag)           // IN : entity tag of current content, with quotes, like "\"a1b2\""
+                                // RET: true if the client's copy is current
+{
+    if((nullptr == ifNoneMatch) || (nullptr == etag)) {
+        return false;
+    }
+
+    const size_t etagLength = strlen(etag);
+    const char *tag = ifNoneMatch;
+    while('\0' != *tag) {
+        // skip separators
+        while((' ' == *tag) || ('\t' == *tag) || (',' == *tag)) {
+            tag += 1;
+        }
+
+        // find end of tag
+        const char *end = tag;
+        while(('\0' != *end) && (',' != *end)) {
+            end += 1;
+        }
+        const char *last = end;
+        while((last > tag) && ((' ' == last[-1]) || ('\t' == last[-1]))) {
+            last -= 1;
+        }
+
+        // weak comparison; W/ prefix does not matter
+        if((last - tag >= 2) && (0 == strncmp(tag, "W/", 2))) {
+            tag += 2;
+        }
+
+        const size_t length = last - tag;
+        if((1 == length) && ('*' == *tag)) {
+            return true;
+        }
+        if((length == etagLength) && (0 == strncmp(tag, etag, length))) {
+            return true;
+        }
+        tag = end;
+    }
+    return false;
+}
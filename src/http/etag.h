@@ -0,0 +1,17 @@
+#ifndef HTTP_ETAG_H
+#define HTTP_ETAG_H
+
+/**
+ * Determine if an If-None-Match request header
+ * matches an entity tag, so the response can be
+ * 304 Not Modified instead of the content.
+ *
+ * The header is a comma separated list of tags,
+ * which may be weak (W/"..."), or "*" to match any.
+ */
+extern bool etagMatches(
+    const char *ifNoneMatch,    // IN : If-None-Match header value, may be nullptr
+    const char *etag);          // IN : entity tag of current content, with quotes, like "\"a1b2\""
+                                // RET: true if the client's copy is current
+
+#endif // HTTP_ETAG_H
@@ -1,192 +1,195 @@
 #define index_html_len sizeof(index_html_gz)
+#define index_html_etag "\"b1793238c7e1ced3\""
 const uint8_t index_html_gz[] = {
-    "\x1F\x8B\x08\x08\xD9\x19\x1F\x60\x00\x03\x69\x6E\x64\x65\x78\x2E"
-    "\x68\x74\x6D\x6C\x00\xED\x5D\xE9\x92\xDB\xB8\x11\xFE\xBF\x4F\xC1"
-    "\x60\xAB\xB6\x76\xAB\x96\xD6\x31\x87\x67\x77\x35\xAC\xB2\xC7\xE3"
-    "\x71\x12\x5F\x6B\x39\x76\x92\x3F\x2A\x88\x82\x28\xD8\x14\xA1\x25"
-    "\x41\x1D\xFB\x22\xC9\x63\xE4\x1D\xF2\x26\x79\x92\x34\x00\xDE\x92"
-    "\x46\xBC\x44\xCA\xB3\xF6\x0F\x0F\x78\xA0\xF1\x35\x3E\x74\x37\x9B"
-    "\x68\x49\x83\x3F\x3D\x7B\x73\xF3\xFE\x1F\x6F\x6F\xB5\x19\x9F\xDB"
-    "\xC6\x37\x03\xF5\x47\x83\x7F\x83\x19\xC1\x13\xD5\x94\x87\x73\xC2"
-    "\xB1\x66\xCE\xB0\xEB\x11\x7E\x8D\x7C\x3E\xD5\xAF\x50\xF6\xB2\x83"
-    "\xE7\xE4\x1A\x2D\x29\x59\x2D\x98\xCB\x91\x66\x32\x87\x13\x07\x6E"
-    "\x5F\xD1\x09\x9F\x5D\x4F\xC8\x92\x9A\x44\x97\x07\x3F\x52\x87\x72"
-    "\x8A\x6D\xDD\x33\xB1\x4D\xAE\x7B\x49\x59\x9C\x72\x9B\x18\xB7\xC3"
-    "\xB7\x67\x7D\xED\xCD\x87\xFE\xF9\x65\x77\xD0\x51\xE7\xBE\x89\x6F"
-    "\xB2\xA9\xF3\x59\x73\x89\x7D\x8D\x3C\xBE\xB1\x89\x37\x23\x04\x46"
-    "\xE4\x9B\x05\x20\xE0\x64\xCD\x3B\xA6\xE7\x21\x6D\xE6\x92\xE9\x35"
-    "\x1A\xFB\xCE\xC4\x26\x8F\xC4\x19\x43\x74\x8E\xA5\x78\xA6\x4B\x17"
-    "\x3C\xD9\xED\x13\x5E\x62\x75\x16\x69\x9E\x6B\x46\x9D\x3F\x41\xDF"
-    "\x41\x47\x5D\x89\xB1\xAA\xA9\x1A\xB3\xC9\x26\x81\xDF\x23\x26\xA7"
-    "\xCC\xD1\x4C\x1B\x7B\xDE\x35\x9A\x63\xEA\x24\xD4\x93\xB7\x4C\xE8"
-    "\x52\xA3\x93\x6B\x64\x33\x8B\x65\xAE\x29\xED\xF0\x98\xD8\xDA\x94"
-    "\xB9\xD7\xC8\xC1\x4B\x9D\x33\xCB\xB2\x89\x6E\x8E\x91\xEC\x15\x9F"
-    "\x42\xC6\xFF\xFE\xFD\x9F\xEF\x9C\xB1\xB7\xF8\x45\xFD\x0F\xF3\x75"
-    "\x79\xDE\xD5\x80\x24\x4E\x1D\xCB\x1B\x74\xA4\xA4\xCC\xE8\x1D\x18"
-    "\x7E\x0F\xA0\x80\xB2\x5D\x98\xC2\x5B\x3C\x3A\x21\x63\xEC\xA2\x50"
-    "\x3F\x13\x58\x77\xB1\xEE\x53\x6D\x46\x27\x13\x92\xD5\x35\xEA\x4F"
-    "\x9D\x85\x1F\x4E\xB5\x39\x23\xE6\xE7\x31\x5B\x67\xF5\x11\x2A\xEE"
-    "\xE9\x0E\x37\xC9\x9B\xE7\xC4\xF1\xF7\xDC\x13\xC1\x0C\x90\xC9\x11"
-    "\x75\xCB\x65\xFE\x42\x0D\x34\x75\x01\xAB\x47\x7F\x27\xC1\xC9\xFD"
-    "\x62\xB2\x2C\x44\x3D\x91\xF1\x8E\x78\xCC\xF6\x05\xC3\x3B\x67\x77"
-    "\x4B\x8A\x47\x6C\x58\x10\xE9\xF1\xA3\xC9\x9B\x90\x29\xF6\x6D\xAE"
-    "\x63\xB9\x64\x0E\x00\x92\xE2\xD8\x42\x2E\xAE\x25\xB6\x7D\x98\xC8"
-    "\x5E\x17\x19\x7F\xFB\xFB\xDD\x93\xEF\x7B\x97\xDD\xEE\xBA\xD7\xEF"
-    "\x76\x7F\x18\x74\xD4\x2D\x85\x65\xFD\x84\x8C\xA1\x14\xD5\xBF\x02"
-    "\x51\xDD\xFE\x79\x79\x51\xE0\x1B\xA4\x24\x10\xB2\x7E\x7C\x79\x55"
-    "\x5E\xD0\x63\xC0\xF4\x01\x24\x5D\x81\x76\x97\x55\x94\xBB\x44\x86"
-    "\x90\x03\xC6\xB1\x3E\xBF\xAA\x20\xE7\x02\xDC\x82\x24\x94\x08\x53"
-    "\x08\x5A\xC8\xB8\xF9\xF3\xF3\xEF\xCF\x01\x63\xFF\xA7\xCB\xF2\xB2"
-    "\xCF\x91\xF1\xAB\x00\x79\xD6\x07\x41\xE7\x15\x40\x9E\x21\xE3\x85"
-    "\x94\x04\x52\xD6\xBD\xC7\x15\x20\xC1\xF2\xFA\x55\x4A\x82\xF5\x25"
-    "\x96\x57\x4E\x49\xE0\x29\xE5\xD4\xDC\x63\xA7\xDB\x4E\x28\x75\xF9"
-    "\x3E\x33\xFE\xCD\xC7\x36\xE5\x9B\xC2\x46\x1C\xF4\x03\x95\x54\x23"
-    "\x9F\xFD\x26\x90\xB8\xD8\xB1\x88\x3E\x17\xFE\xBC\xD7\x3D\xA0\x81"
-    "\xEC\x9B\xF4\x79\xB2\x73\x4A\x01\xA4\x81\x28\x69\xC3\xDA\x1C\xAF"
-    "\x61\x8D\x9E\xA1\x84\x5D\x97\x72\x11\x3B\xD0\xE2\x35\x32\x2E\xCF"
-    "\x0E\xCD\x77\x05\x3A\xC6\x2E\xB5\x66\xDC\x21\x9E\x57\x98\x91\xB8"
-    "\x2B\x32\x9E\x46\xED\x2A\xBC\xE8\xFD\x0A\xBC\x24\xE0\x28\x6A\xF4"
-    "\x7E\x40\x4D\x1F\xC5\x16\x51\x27\x31\x87\xD0\x56\xE1\x45\xC4\x72"
-    "\x17\x7B\xBC\x30\x2B\x61\x47\x70\x6B\x41\xAB\x35\x46\x22\x28\x0F"
-    "\x80\x0F\x0F\x73\xDF\xC5\x02\x5B\x61\x46\xE2\xAE\x10\x0F\xA3\x76"
-    "\x6B\xAC\x24\xE0\x3C\x04\x5E\x16\xC4\x84\x54\x64\x44\xA6\x53\x08"
-    "\x59\xC5\xB9\x49\x75\x07\x7E\xD4\xB1\x76\x2B\x8F\x0B\x3F\x23\x66"
-    "\xC4\xD5\xF5\xA0\xD8\xDD\xFD\xDC\xF2\x9A\x45\x38\x4B\x3E\x21\x40"
-    "\xEA\xF6\x9A\x58\xB0\x18\x96\xA4\xB4\x8C\x3E\x32\xEE\x5C\xBC\x91"
-    "\xB9\x60\x95\x87\x9E\x77\x64\xA2\xBD\xA7\x4E\x79\x65\xCE\x05\x10"
-    "\x42\x9C\x6A\x52\x2E\x20\x98\x41\xA3\x9A\x10\x78\x60\x1D\x92\x05"
-    "\xC5\xA7\xF0\xC0\x85\x57\xE3\xC2\x66\x01\x7D\x90\xF1\xE4\xE3\xD3"
-    "\xC2\x4E\xCA\x5B\x51\x6E\xCE\xF2\xAC\x70\xE5\x9D\x02\x80\x68\x2B"
-    "\xB5\xDC\x6D\x39\x9A\xBC\x41\x58\x41\xD0\xC8\x33\x92\xD2\x2B\x04"
-    "\x68\x43\x06\x0C\xF9\x6F\xAC\x66\x3E\x1D\x8F\xE7\xC1\x00\xC4\xC8"
-    "\xC2\xB4\x78\x5C\x09\x3B\x4A\xA6\xB4\x3B\x68\x35\x45\x97\x1A\xB6"
-    "\x35\xCE\x02\xAD\xDB\x26\x0E\x80\xCC\xD9\xA4\xF8\xEB\x88\xA0\x1F"
-    "\x32\x80\xB5\x57\xD0\x28\x1C\x65\x42\x01\x47\x0E\x2F\x4F\x7C\xCE"
-    "\xAA\x44\x96\xA1\xEF\x38\x9B\x2A\x61\xE5\xC6\x66\xFE\xA4\xBC\x04"
-    "\x88\x29\x6F\xA6\x53\x6A\x96\x8F\x4A\x10\x51\x5E\xB0\x79\xCE\xFE"
-    "\x47\xF6\xE2\xC4\x2C\xEE\x20\x88\x09\x2C\xDE\xDE\x68\xC3\xDB\xD7"
-    "\xC3\x37\xEF\x9A\xF1\x0E\x30\x66\x4B\x8E\x41\x68\xDB\xB6\x4F\x00"
-    "\x10\xFD\x32\x3C\xF5\x15\x51\xCF\x86\x6F\x9B\x62\xA9\xDF\x1E\x4D"
-    "\xFD\x53\xE0\x69\x64\x93\x25\xB1\x4B\x70\xA5\x3A\x0A\xBE\xB4\x97"
-    "\xA2\xD5\x5A\x22\x17\x41\xF9\xA2\xD3\xB8\x70\xE3\x21\x5C\x97\x23"
-    "\x89\xBD\x8C\x0D\xA9\x9E\xC8\xB8\x5D\x2F\x98\xE7\xBB\x39\xE3\xEA"
-    "\x6E\x62\xAA\xBC\x20\x8C\xA1\x28\x62\xC2\x37\x84\xE2\x05\x7F\x44"
-    "\x4D\xBF\x7B\x5E\x2B\x39\x42\xF8\x31\xED\xC5\x2A\x11\x7E\x2C\x11"
-    "\x7E\xEE\x6E\x9A\xF1\x68\x56\x6B\x71\xC7\x6A\x35\xEE\xA4\xED\xC7"
-    "\x32\x4B\xE6\x12\x41\x47\x48\xA1\xCB\xE4\x11\xC9\x77\xEB\xEB\x2A"
-    "\xA6\x13\xC2\x48\x5B\xCE\x59\x6C\x37\x17\xB5\x5A\xCD\xD9\x41\xB4"
-    "\x55\x8C\x46\x68\x62\x12\x6A\x53\xC7\x2A\x4C\x48\xA2\xAF\xE2\x44"
-    "\xBB\x51\x47\x55\xB8\xE9\x57\xE1\x26\x89\x28\x4D\xCF\xE5\x91\x02"
-    "\x4E\xAF\x7F\x75\x4C\x7A\xC6\x8B\xE2\x3E\x0D\xFA\x20\xE3\xE9\xDB"
-    "\x66\x7C\x9A\x18\x2C\xA7\x4F\xAB\xE4\xC1\xA4\x52\x6D\x3F\x91\xAD"
-    "\x4A\xB0\xB1\x12\xC0\x3F\x36\xC4\xC6\x2A\x3F\x1B\x35\x47\x98\xD5"
-    "\x29\xF0\xE3\xE2\xD5\xC8\x9A\xE3\xC2\x1C\x05\xFD\x90\xF1\x0E\xAF"
-    "\xB4\xBB\x57\x4F\x1A\xE1\x2A\x1C\xB4\x1D\xBE\x22\x95\xDB\xE6\xCC"
-    "\x26\x4E\x71\xA3\x12\x9D\x90\xF1\x92\x38\x9E\x76\xC3\x5C\x57\xD5"
-    "\x43\x35\xC2\x9A\x1C\xB9\x1D\xCA\x94\xD2\x6D\xF3\x35\x9B\x53\xD7"
-    "\x65\x6E\x61\xCA\x82\x7E\xC8\x78\xA1\xBF\x92\xAD\x46\xE8\x0A\x47"
-    "\x6D\x87\xB1\x48\xE7\xB6\x49\x5B\x4E\x6D\xBA\x28\x4C\x99\xEC\x85"
-    "\x8C\x0F\xFA\x73\xF8\xDB\x08\x5D\x6A\xC4\x76\xC8\x0A\xB4\x6D\x9B"
-    "\xAA\x89\xB9\x2A\x4C\x14\xF4\x41\xC6\xB3\x9B\x8F\xDA\xF7\xCF\xD8"
-    "\xCA\x11\xF5\x7F\xDA\xED\xEB\x1F\x1A\x61\x4C\x0C\xDD\x0E\x5F\x52"
-    "\xE9\xB6\xD9\x32\x99\xCD\xDC\x31\x2E\xEE\x0E\xC3\x8E\xA2\x04\x06"
-    "\x5A\xDA\x53\xDC\x8C\x43\x8C\xC6\x6D\xE2\xA1\x3D\x56\xF2\xC8\x3C"
-    "\x0D\x3A\x0E\xDE\x71\x69\x4F\x8F\xC1\x94\x5A\xBE\x4B\xF6\x88\x8A"
-    "\xCA\x90\xB9\x4B\xF0\x5C\x17\x05\x42\x90\x55\x92\xB8\x1E\x99\xCE"
-    "\x31\x64\x7F\xD1\x79\x2D\x67\x7D\x72\x24\x3C\x2C\x6B\xB6\x99\x17"
-    "\x16\x21\x89\xA6\xAE\x06\x44\xC6\x7F\xFF\x75\x68\x22\xE8\xDC\x4A"
-    "\x40\xDC\x57\xD0\xBC\x5F\xC8\x7E\xC5\x43\x16\xD5\x13\x95\x2E\xAB"
-    "\xE2\x77\x28\x78\x23\xCF\x68\xB2\x7A\x8B\xD9\xF7\x11\x13\xD6\xAA"
-    "\x4B\x35\x95\x9C\xB1\xCF\x39\x73\xBC\x68\x3E\x83\xE3\x78\x98\xFB"
-    "\x26\x50\xDD\xAC\x92\x7D\xC2\x61\xCE\xA8\x6D\xDF\x53\x29\x7E\x47"
-    "\xB8\x36\x14\xF7\x0C\x3A\xAA\x67\x3E\xD1\x41\xB1\x78\x30\xBF\xFB"
-    "\xC5\x0F\x39\x76\xC5\x00\xE2\xB6\xFB\x47\x10\x3B\x6F\xA6\xDA\xA0"
-    "\x2B\x36\xFB\x90\x94\xB0\x25\xAC\xB2\xF7\xC4\x26\x73\xC2\xDD\xCD"
-    "\x7D\xB3\x1D\xAE\x5D\x57\x74\xD1\x79\xD8\x45\xE7\x78\x1C\xCF\x37"
-    "\x1C\xE4\x5C\xA2\x70\xA7\xF8\x18\x84\xA7\x09\x67\xB0\x84\xC5\x3A"
-    "\xC1\x1C\x0B\x61\xD1\x07\x2F\xBE\x9D\x33\xCE\x92\x23\xC5\xE6\x22"
-    "\xEA\x94\xC8\xA4\x80\x73\x0D\x47\xDB\x35\xCC\x42\x18\xC8\xCE\x51"
-    "\xDE\xC2\x95\x7B\x3D\x43\xBE\xB5\xB9\x5F\x8F\x04\xBC\xFD\x1F\x5E"
-    "\xD8\x62\x20\x23\x2F\xB1\x86\x9C\x25\xF6\x92\x0A\xDC\xEF\x12\xD5"
-    "\xFD\xE0\x3F\x83\x46\x1D\x51\x8C\x7D\x06\x61\x26\xB1\xF3\xA3\x48"
-    "\x98\x86\x4B\x3C\xB0\xBB\x6D\xC5\xD8\x67\xF9\xC9\x05\xC2\x73\x58"
-    "\xDA\x7D\x74\x45\x66\xB2\xF3\x72\x92\xB2\xBD\x6B\xA2\x1C\x63\x69"
-    "\x71\x0F\x8D\xB0\x85\x0C\x36\xC7\xE2\xAA\x9C\x4B\xCB\x11\x3E\xD2"
-    "\x0E\xCD\x54\x1D\x8E\xE3\xC9\xB8\xEF\x72\x9B\x44\x63\x18\xEF\xE5"
-    "\x71\x4D\xFE\x8B\x63\xE7\x73\x42\x34\x1C\xD5\x24\xF8\x13\xDB\x40"
-    "\x0C\x34\x13\xC2\xFF\x12\x9C\xA9\x69\x00\x0B\x1C\x99\x6E\x31\x6C"
-    "\xC7\x23\xDC\x31\x51\x74\x73\xC8\xE5\x1E\x36\xE0\xCC\x8C\x97\x33"
-    "\x5B\xB5\x32\xF6\x3C\x53\x14\x30\x13\x78\x60\x5D\x61\x77\x12\x49"
-    "\x90\x72\xA3\x4D\x83\xF0\xAA\xF1\x5C\x35\x0E\x1B\x4E\x56\xBE\x4B"
-    "\x40\x5E\xC2\x06\xD3\xF2\xC3\xAB\x60\x96\xB2\x51\x5C\xBE\x4D\xA6"
-    "\x7C\x8F\x70\x79\xC9\x78\x09\xFF\x97\x80\x2D\x3E\xB0\xB0\x0F\xB4"
-    "\xBC\x66\xBC\x13\x7F\x2A\x79\x12\x79\x39\x45\xE8\xC8\x13\x0F\x0F"
-    "\x61\xA6\xB5\x23\xFB\x2A\xF0\x72\x37\x96\x17\x3C\x93\xFC\xAC\x95"
-    "\xDF\xA0\xD2\x7C\x47\x95\x50\x81\xC9\x00\x5D\xDF\x7D\xBB\xEE\x5F"
-    "\x98\xDD\x5F\x2A\xEC\x59\x25\xF1\x65\x36\xE3\x91\xE6\x71\xB2\x80"
-    "\x13\x8F\xBA\xBD\x78\xFF\xEA\x51\xEF\x90\xF6\xBB\xB6\xAA\x76\x01"
-    "\x7F\x7A\x99\x0B\xF8\x96\x38\x89\x44\x13\x1F\x67\xD5\x83\x35\x00"
-    "\xA0\xAA\x64\x6F\x07\x02\x49\xCA\x69\x24\x3D\xE9\xB6\xCB\x28\x96"
-    "\x83\xA9\x19\x61\x07\xC3\x69\xA2\x8B\x5C\x38\x62\xBB\x73\x4E\x16"
-    "\x58\x2E\xA5\xC3\x13\x18\xD4\x45\xA6\x06\xD5\x2D\x25\x21\x7F\x29"
-    "\xA4\xF1\x9A\x71\x11\x33\x1D\x59\xFB\xA8\xB5\x50\xF1\x17\x4E\x97"
-    "\xE6\x2D\xB0\x29\x12\x0C\x76\xD0\x10\xB7\x67\x4E\xF8\x21\xED\xC9"
-    "\x9A\x7A\x65\xE6\x0E\x43\x3F\x9D\x39\x44\x7E\x56\xBA\x3E\xC5\x42"
-    "\xB1\xC1\xCA\x2E\xE0\x68\xF6\xE8\xF7\x41\xC8\xC9\xA9\xE0\x02\x47"
-    "\x1F\xE5\x0E\xD6\xB5\x1E\x54\x09\x81\x8E\x70\xB1\x5E\x0D\x7F\x27"
-    "\x2E\x2B\xA2\x60\xC2\x93\x0A\xD3\x1B\x89\x60\x32\x12\x42\x02\x4D"
-    "\xFF\x09\xCD\xD3\x72\xA8\x19\x98\x19\x9F\xFA\xA8\xBB\xD7\xAB\x6A"
-    "\x9D\x87\xE5\x57\xB3\x83\x44\x6B\x40\xBC\xE9\xAE\xB0\x06\x74\x31"
-    "\xB9\xBA\x7A\x5D\x2E\xD7\x80\xD8\x1F\x28\xB1\x06\xCA\xBC\xBF\xCC"
-    "\x8C\xBF\xFD\x16\x33\xFB\x8E\xF9\x10\xA9\x09\x05\x77\xBD\xC2\xCC"
-    "\xEA\xDB\xF0\x0B\xE7\x5A\x3C\xAE\x7C\x40\xAB\xE6\x72\xF9\x8A\x1D"
-    "\xC3\xE5\x82\xD8\x3A\x5C\xAE\x52\xF0\x34\x7D\xAE\x50\xB1\xAA\xCF"
-    "\x95\xCE\x20\x70\xBA\x4A\xD7\x13\xF5\xBA\x09\xA0\xF9\xDD\xEE\x1F"
-    "\xC0\xE9\x8A\x45\x50\xD5\xE9\x4A\x70\x81\x17\x52\x8B\xA0\x69\xB7"
-    "\x9B\x40\xD0\x8C\xDF\x4D\xAA\x7C\xF4\x1D\xA4\x02\x39\xC8\xD6\x4B"
-    "\x97\xAF\x79\xC8\x97\x97\x87\xBC\x9F\xB9\x8C\x8B\xED\xAD\x07\x9C"
-    "\x8B\x44\x3A\x9E\x66\x6C\xAC\x9A\x8F\x04\xDA\x05\x91\x31\x52\xF6"
-    "\x04\x83\x63\x0A\xE9\xD7\x8C\xA4\xD6\x8C\x24\x98\xDB\x20\x4E\x44"
-    "\xAB\xA0\xC9\xE8\x98\x82\x70\xFC\xD8\x98\xD6\xF8\x4B\x4C\x49\x86"
-    "\x9C\x10\x97\x3A\xD6\x43\xCE\x4A\x22\x1D\x4F\xD3\xF9\x56\x4C\x4C"
-    "\xBC\x40\xBB\xC0\xF9\x46\xCA\x9E\x9E\xF3\x4D\x23\xFD\x9A\x97\xD4"
-    "\x97\x97\x84\x33\x1B\x38\xA2\x68\x0D\x34\xE8\x7A\xD3\x10\x8E\xEE"
-    "\x7A\x33\x1A\x9F\x52\x52\xB2\xBD\x51\x5B\x35\x2B\x29\xB7\x28\x04"
-    "\x8E\x91\xC0\x31\x5A\x23\x63\xAD\x2D\x98\x47\x05\xC6\xBC\xEB\x21"
-    "\x69\xC4\x62\xF1\xA3\x48\xB9\x50\x68\x08\xCF\xF1\xE7\xC0\x85\x09"
-    "\x6B\x17\x4C\x85\xAA\xCD\x33\x9B\x38\x16\x9F\xC9\xAD\x33\x30\xC7"
-    "\xF0\x28\xFE\xF0\xD7\x7D\x9A\x97\x2B\x03\x2D\x33\x31\x1B\x64\x6C"
-    "\x6A\x9F\x98\xCD\x03\x98\x18\xCE\x6C\xE2\x8A\x52\x17\x64\x44\xCD"
-    "\xBA\xE6\x27\x96\xDD\xE2\x3C\xA9\x42\x23\xEA\x70\x3D\xA8\x28\xA8"
-    "\x65\x8B\x5B\x4A\x1C\x45\x35\x0A\x41\x43\x93\xA7\x4F\x2B\x16\xA7"
-    "\x91\x06\xB1\xF8\xD1\xC5\xC1\x68\xFC\xF8\xE2\x81\x87\xE3\x4A\x25"
-    "\x5E\xF1\x22\x57\x42\x92\xC5\x6B\xE2\xD0\xB8\x91\x7F\x8B\x57\x7F"
-    "\xC4\x82\x3D\x51\xE9\x9A\x2A\x20\x93\xB5\xAF\x2D\x17\x90\x81\xD9"
-    "\x8E\xC3\xAF\x2A\x3C\x5C\x44\x06\x53\x2B\x2B\xBF\xD5\x57\x24\x1E"
-    "\xBB\x26\x56\x2E\x18\x0F\x19\xAF\xC4\x51\x5D\x65\xB0\x74\x12\xC9"
-    "\x3D\x54\x5E\x9B\xBB\x0C\x2B\x05\xB7\x78\x11\x56\xD0\x41\x49\x11"
-    "\xB9\x3C\x2C\x15\xDB\x2E\xFD\x44\x09\x7D\x47\xF2\xA5\x9A\xDC\x59"
-    "\x1C\x8A\xE3\xD3\x72\x61\x31\xC4\xAF\xA9\x44\x92\x7A\x91\x4B\x54"
-    "\xA7\x5E\xA6\xF4\x6A\x7B\xE3\x64\xB9\x17\x18\xFF\xA8\xDC\x17\x4A"
-    "\x49\x12\xEE\xAA\x9D\x5C\xC4\xF7\x88\xAA\xAC\x1B\x45\xC5\xAB\xD2"
-    "\x6D\x86\xA5\xC7\x3F\x37\x92\xA3\x6E\xA3\x38\x9C\xA7\x56\xCA\x52"
-    "\x77\xA8\xDD\xF0\x4B\x42\xE5\x12\x4C\x66\xFB\x73\x47\x17\xBF\xF4"
-    "\x41\x5C\xAF\xA4\x5F\x90\xA2\x46\x4A\x46\x10\x4D\x0B\xD0\x16\x05"
-    "\xB8\x50\x42\xFC\x76\x2D\x81\x0D\x19\xB6\xAC\x8E\x2D\x64\x5F\x19"
-    "\x09\xAE\x2A\x83\xAD\x3C\x83\x12\x31\x75\xC2\x8A\xD0\xD4\x84\xC2"
-    "\x79\x5D\x9E\x2F\x3B\x97\xA1\xDC\x51\x17\xA6\x12\x3C\x64\xA1\x7A"
-    "\xD8\xDD\x19\x56\x52\x66\x84\x36\x3C\xF7\xA3\x56\x73\x92\x95\x0B"
-    "\x48\xAF\x01\x20\xB9\xA9\xC4\xEB\xDD\x54\xE2\x75\x35\x2A\x43\xB9"
-    "\x92\x4A\x88\x19\x75\x50\x99\x90\x19\xA1\x0D\xCF\x35\x4A\x65\x04"
-    "\xA4\xD7\x00\x90\xBC\x54\x82\x99\xD3\xA5\xFC\x22\xEA\xE0\x0B\xA0"
-    "\x02\x64\x0B\x97\x89\xDF\x23\x82\xA8\x87\x6D\x3D\xFE\x6A\xAB\x24"
-    "\xB1\x87\x83\x5D\x96\xDF\xA4\x50\x39\x9C\xE0\xF9\xAF\x0B\xF9\x1D"
-    "\xBA\xD5\x58\xDE\x25\x79\x97\x2A\xF2\x5A\x83\xA4\x6F\xE3\xEA\x35"
-    "\x87\x2B\xEF\x1A\xA0\xF0\xEC\x62\xB9\x01\x88\xC4\x6B\x1B\x75\xB6"
-    "\x36\xF6\x53\xC3\x48\xE6\x69\x0D\xCC\x67\xA5\x66\xE1\x37\xCD\x78"
-    "\x1A\x4F\xAF\x19\x3C\x55\xAD\x3D\x3E\x5F\x1B\xDB\x99\xA1\x24\xDF"
-    "\x93\x1A\xF8\xDE\x96\xBB\xAD\x44\xD3\x9C\x67\x31\xF5\x9A\xC2\x54"
-    "\xEE\x53\xA7\x83\xCE\xAE\x2F\x0B\xC8\xC8\xCA\x26\x45\x83\x8E\xFA"
-    "\xC5\xB6\x41\x47\xFE\xDE\xDD\xFF\x01\x67\x99\xC1\xCA\x06\x6F\x00"
+    "\x1F\x8B\x08\x08\x0C\x29\xD4\x6A\x00\x03\x69\x6E\x64\x65\x78\x2E"
+    "\x68\x74\x6D\x6C\x00\xED\x5D\x59\x92\xDB\xC8\x11\xFD\x9F\x53\xC0"
+    "\x35\x11\x13\x9A\x88\x81\xB8\x34\x9B\xA2\x66\xD8\x70\x48\xAD\x56"
+    "\xCB\xB6\xB6\x11\x65\xC9\xF6\x0F\xA3\x08\x14\x41\xA8\x41\x14\x0D"
+    "\x14\xB7\xB9\x88\x7D\x0C\xDF\xC1\x37\xF1\x49\x9C\x55\x85\x9D\x64"
+    "\x13\x1B\x01\xAA\x47\xFA\x50\x63\xAB\x57\x99\xF5\x72\x41\x02\x49"
+    "\x72\xF8\x87\x17\xEF\xAE\x3F\xFE\xFD\xFD\x8D\x32\x63\x73\x5B\xFB"
+    "\x6E\x28\xFF\x28\xF0\x6F\x38\x23\xD8\x90\x9B\x62\x77\x4E\x18\x56"
+    "\xF4\x19\x76\x3D\xC2\xAE\xD0\x92\x4D\xD5\x01\x4A\x9F\x76\xF0\x9C"
+    "\x5C\xA1\x95\x45\xD6\x0B\xEA\x32\xA4\xE8\xD4\x61\xC4\x81\xCB\xD7"
+    "\x96\xC1\x66\x57\x06\x59\x59\x3A\x51\xC5\xCE\x4F\x96\x63\x31\x0B"
+    "\xDB\xAA\xA7\x63\x9B\x5C\x75\xE2\x58\xCC\x62\x36\xD1\x6E\x46\xEF"
+    "\x2F\xBA\xCA\xBB\x4F\xDD\x5E\xBF\x3D\x6C\xC9\x63\xDF\x45\x17\xD9"
+    "\x96\x73\xA7\xB8\xC4\xBE\x42\x1E\xDB\xDA\xC4\x9B\x11\x02\x33\xB2"
+    "\xED\x02\x24\x60\x64\xC3\x5A\xBA\xE7\x21\x65\xE6\x92\xE9\x15\x9A"
+    "\x2C\x1D\xC3\x26\x8F\xE1\xC8\x1F\x57\x57\x1D\xFD\xE9\x74\xF0\x74"
+    "\x4A\xF4\xFE\x93\xCB\xCB\x2E\x36\x90\xC6\xF1\x22\x60\x4F\x77\xAD"
+    "\x05\x8B\x23\x7D\xC1\x2B\x2C\x8F\x22\xC5\x73\xF5\x10\xEF\x0B\x87"
+    "\x1B\x5C\xF6\xF4\x01\x9E\x0C\x8C\xC1\xC4\xE8\x75\x49\x1F\x69\xC3"
+    "\x96\xBC\x38\xD2\x48\x2E\xE8\x84\x1A\xDB\x98\x96\x1E\xD1\x99\x45"
+    "\x1D\x45\xB7\xB1\xE7\x5D\xA1\x39\xB6\x9C\xD8\x22\x88\x4B\x0C\x6B"
+    "\xA5\x58\xC6\x15\xB2\xA9\x49\x53\xE7\xE4\x1A\xE0\x09\xB1\x95\x29"
+    "\x75\xAF\x90\x83\x57\x2A\xA3\xA6\x69\x13\x55\x9F\x20\x31\x2A\x3A"
+    "\x84\xB4\xFF\xFD\xFB\x3F\x3F\x38\x13\x6F\xF1\x8B\xFC\x1F\x56\xB5"
+    "\xDF\x6B\x2B\x40\x25\xB3\x1C\xD3\x1B\xB6\x04\x52\x6A\xF6\x16\x4C"
+    "\x7F\x40\x20\x9F\xD8\x7D\x32\x05\x97\x78\x96\x41\x26\xD8\x45\x81"
+    "\x7E\x3A\xD8\x86\x8B\xD5\xA5\xA5\xCC\x2C\xC3\x20\x69\x5D\xC3\xF1"
+    "\x96\xB3\x58\x06\xAB\xAF\xCF\x88\x7E\x37\xA1\x9B\xB4\x3E\x5C\xC5"
+    "\x03\xC3\xE1\x22\x71\xF1\x9C\x38\xCB\x03\xD7\x84\x62\xFA\x92\x89"
+    "\x19\x55\xD3\xA5\xCB\x85\x9C\x68\xEA\x82\xAC\x9E\xF5\x1B\xF1\x0F"
+    "\x1E\x86\x49\xB3\x10\x8E\x44\xDA\x07\xE2\x51\x7B\xC9\x19\xDE\xBB"
+    "\xBA\x3B\x28\x1E\xB1\xC1\x20\x92\xF3\x87\x8B\x67\x90\x29\x5E\xDA"
+    "\x4C\xC5\xC2\x64\x8E\x08\x24\xE0\xE8\x42\x18\xD7\x0A\xDB\x4B\x58"
+    "\xC8\x4E\x1B\x69\x7F\xFD\xDB\xED\xB3\x47\x9D\x7E\xBB\xBD\xE9\x74"
+    "\xDB\xED\x1F\x87\x2D\x79\x49\x6E\xAC\xA7\x48\x1B\x09\xA8\xEE\x00"
+    "\xA0\xDA\xDD\x5E\x71\x28\x88\x20\x02\x09\x40\x36\x4F\xFA\x83\xE2"
+    "\x40\x4F\x40\xA6\x4F\x80\x34\x00\xED\xFA\x65\x94\x03\xF7\xE5\x38"
+    "\xE0\x1C\x9B\xDE\xA0\x04\xCE\x25\x44\x0A\x41\x28\xE1\xAE\xE0\x6F"
+    "\x21\xED\xFA\x4F\x2F\x1F\xF5\x40\xC6\xEE\xD3\x7E\x71\xEC\x1E\xD2"
+    "\x7E\xE5\x42\x5E\x74\x01\xA8\x57\x42\xC8\x0B\xA4\xBD\x12\x48\x80"
+    "\xB2\xE9\x3C\x29\x21\x12\x98\xD7\xAF\x02\x09\xEC\x8B\x9B\x57\x46"
+    "\x24\x88\x94\x62\x69\xEE\xF1\xD3\xDD\x20\x94\x38\x7D\x9F\x1B\xFF"
+    "\x73\x89\x6D\x8B\x6D\x73\x3B\xB1\x3F\x0E\x54\x92\x1B\xD9\xFC\x37"
+    "\x26\x89\x8B\x1D\x93\xA8\x73\x1E\xCF\x3B\xED\x23\x1A\x88\xB1\xF1"
+    "\x98\x27\x06\x27\x14\x40\x0A\x40\x09\x1F\x56\xE6\x78\x03\x36\x7A"
+    "\x81\x62\x7E\x5D\x28\x44\xEC\x91\x16\x6F\x90\xD6\xBF\x38\xB6\xDE"
+    "\x25\xE8\x98\xB8\x96\x39\x63\x0E\xF1\xBC\xDC\x8C\x44\x43\x91\xF6"
+    "\x3C\xDC\x2E\xC3\x8B\xDA\x2D\xC1\x4B\x4C\x1C\x49\x8D\xDA\xF5\xA9"
+    "\xE9\xA2\xC8\x23\xAA\x24\xE6\x98\xB4\x65\x78\xE1\xB9\xDC\xC5\x1E"
+    "\xCB\xCD\x4A\x30\x10\xC2\x9A\xBF\xD5\x18\x23\xA1\x28\x0F\x80\x0F"
+    "\x0F\xB3\xA5\x8B\xB9\x6C\xB9\x19\x89\x86\x42\x3E\x0C\xB7\x1B\x63"
+    "\x25\x26\xCE\x43\xE0\x65\x41\x74\x28\x58\xC6\x64\x0A\xB5\x43\x7E"
+    "\x6F\x49\x0E\x07\x7E\xE4\xBE\x72\x23\xF6\x73\xDF\x23\xA6\xE0\xAA"
+    "\xBA\x51\x6C\xEF\xBF\x6F\x79\x4B\x43\x39\x0B\xDE\x21\x40\x81\xF7"
+    "\x96\x98\x60\x0C\x2B\x52\x18\xA3\x8B\xB4\x5B\x17\x6F\x45\xC5\x58"
+    "\xE6\xA6\xE7\x03\x31\x94\x8F\x96\x53\x5C\x99\x1E\x17\x84\x10\xA7"
+    "\x1C\xCA\x25\x24\x33\xD8\x28\x07\x02\x37\xAC\x23\xB2\xB0\xF0\x39"
+    "\xDC\x70\xE1\xF5\x24\xB7\x5B\xC0\x18\xA4\x3D\xFB\xFC\x3C\x77\x90"
+    "\xF2\xD6\x16\xD3\x67\x59\x2C\x5C\x46\x27\x5F\x40\xB4\x53\x5A\xEE"
+    "\xF7\x1C\x45\x5C\xC0\xBD\xC0\xDF\xC8\x32\x93\xD4\x2B\x10\xD0\x86"
+    "\x0A\x18\xEA\xDF\x48\xCD\x6C\x3A\x9E\x2E\x82\x81\x10\x63\x13\x5B"
+    "\xF9\xF3\x4A\x30\x50\x30\xA5\xDC\xC2\x56\x5D\x74\xC9\x69\x1B\xE3"
+    "\xCC\xD7\xBA\x69\xE2\x40\x90\x39\x35\xF2\x3F\x8E\xF0\xC7\x21\x0D"
+    "\x58\x7B\x03\x1B\xB9\xB3\x4C\x00\x70\xE2\xF4\xF2\x6C\xC9\x68\x99"
+    "\xCC\x32\x5A\x3A\xCE\xB6\x4C\x5A\xB9\xB6\xE9\xD2\x28\x8E\x00\x39"
+    "\xE5\xDD\x74\x6A\xE9\xC5\xB3\x12\x64\x94\x57\x74\x9E\x71\xFC\x89"
+    "\xA3\x38\xD1\xF3\x07\x08\xA2\x03\x8B\x37\xD7\xCA\xE8\xE6\xED\xE8"
+    "\xDD\x87\x7A\xA2\x03\xCC\xD9\x50\x60\xE0\xDA\x36\x1D\x13\x40\x88"
+    "\x6E\x11\x9E\xBA\x92\xA8\x17\xA3\xF7\x75\xB1\xD4\x6D\x8E\xA6\xEE"
+    "\x39\xF0\x34\xB6\xC9\x8A\xD8\x05\xB8\x92\x03\x39\x5F\xCA\x6B\xBE"
+    "\xD5\x58\x21\x17\x8A\xF2\x55\x97\x71\xC1\x8B\x87\xC0\x2E\xC7\x42"
+    "\xF6\x22\x3E\x24\x47\x22\xED\x66\xB3\xA0\xDE\xD2\xCD\x98\x57\xF7"
+    "\x13\x53\xE6\x01\x61\x24\x8A\x24\x26\x78\x42\xC8\x1F\xF0\x87\xD4"
+    "\x74\xDB\xBD\x4A\xC9\xE1\xE0\xA7\xF4\x17\xB3\x40\xFA\x31\x79\xFA"
+    "\xB9\xBD\xAE\x27\xA2\x99\x8D\xE5\x1D\xB3\xD1\xBC\x93\xF4\x1F\x53"
+    "\x2F\x58\x4B\xF8\x03\xA1\x84\x2E\x52\x47\xC4\x9F\xAD\x6F\xCA\xB8"
+    "\x4E\x20\x46\xD2\x73\x2E\x22\xBF\xB9\xAC\xD4\x6B\x2E\x8E\x4A\x5B"
+    "\xC6\x69\xB8\x26\x3A\xB1\x6C\xCB\x31\x73\x13\x12\x1B\x2B\x39\x51"
+    "\xAE\xE5\x5E\x19\x6E\xBA\x65\xB8\x89\x4B\x94\xA4\xA7\x7F\xA2\x84"
+    "\xD3\xE9\x0E\x4E\x49\xCF\x64\x91\x3F\xA6\xC1\x18\xA4\x3D\x7F\x5F"
+    "\x4F\x4C\xE3\x93\x65\x8C\x69\xA5\x22\x98\x50\xAA\xE9\x3B\xB2\x75"
+    "\x01\x36\xD6\x5C\xF0\xCF\x35\xB1\xB1\xCE\xCE\x46\xC5\x19\x66\x7D"
+    "\x0E\xFC\xB8\x78\x3D\x36\xE7\x38\x37\x47\xFE\x38\xA4\x7D\xC0\x6B"
+    "\xE5\xF6\xCD\xB3\x5A\xB8\x0A\x26\x6D\x86\xAF\x50\xE5\xA6\x39\xB3"
+    "\x89\x93\xDF\xA9\xF8\x20\xA4\xBD\x26\x8E\xA7\x5C\x53\xD7\x95\xFD"
+    "\x50\xB5\xB0\x26\x66\x6E\x86\x32\xA9\x74\xD3\x7C\xCD\xE6\x96\xEB"
+    "\x52\x37\x37\x65\xFE\x38\xA4\xBD\x52\xDF\x88\xAD\x5A\xE8\x0A\x66"
+    "\x6D\x86\xB1\x50\xE7\xA6\x49\x5B\x4D\x6D\x6B\x91\x9B\x32\x31\x0A"
+    "\x69\x9F\xD4\x97\xF0\xB7\x16\xBA\xE4\x8C\xCD\x90\xE5\x6B\xDB\x34"
+    "\x55\x86\xBE\xCE\x4D\x14\x8C\x41\xDA\x8B\xEB\xCF\xCA\xA3\x17\x74"
+    "\xED\xF0\xFE\x3F\xE5\xE6\xED\x8F\xB5\x30\xC6\xA7\x6E\x86\x2F\xA1"
+    "\x74\xD3\x6C\xE9\xD4\xA6\xEE\x04\xE7\x0F\x87\xC1\x40\xDE\x02\x03"
+    "\x5B\xCA\x73\x5C\x4F\x40\x0C\xE7\xAD\xE3\xA6\x3D\x52\xF2\xC4\x3C"
+    "\x0D\x5B\x0E\xDE\x73\xEA\xC0\x88\xE1\xD4\x32\x97\x2E\x39\x00\x15"
+    "\xB6\x21\x33\x97\xE0\xB9\xCA\x1B\x84\xA0\xAA\x24\x51\x3F\xB2\x35"
+    "\xC7\x50\xFD\x85\xC7\x95\x8C\xFD\xC9\x21\x78\xD0\xD6\x6C\x53\x2F"
+    "\x68\x42\xE2\x9B\xAA\x9C\x10\x69\xFF\xFD\xD7\xB1\x85\xB0\xE6\x66"
+    "\x4C\xC4\x43\x0D\xCD\x87\x41\x0E\x2B\x1E\xB0\x28\xEF\xA8\x54\xD1"
+    "\x3B\xBF\x47\xC1\x6B\x71\x44\x11\xDD\x5B\xD4\xBE\x8F\x98\xA0\x57"
+    "\x5D\xA8\x29\x71\x26\x4B\xC6\xA8\xE3\x85\xEB\xE9\xEF\x47\xD3\xDC"
+    "\xB7\x80\xF2\x62\x59\xEC\x13\x06\x6B\x66\xD9\xF6\x3D\x9D\xE2\xB7"
+    "\x84\x29\x23\x7E\xCD\xB0\x25\x47\x66\x83\xF6\x9B\xC5\xFD\xF5\x3D"
+    "\x0C\x3F\x62\xD8\xE5\x13\xF0\xCB\xEE\x9F\x81\xBF\x79\xD3\xE5\x0B"
+    "\xBA\x7C\xAB\x0F\x45\x09\x5D\x81\x95\x7D\x24\x36\x99\x13\xE6\x6E"
+    "\xEF\x5B\xED\xC0\x76\x5D\x3E\x44\x65\xC1\x10\x95\xE1\x49\xB4\xDE"
+    "\xB0\x93\xD1\x44\xE1\x4A\xFE\x61\x09\x4F\xE1\xC1\x60\x05\xC6\x6A"
+    "\x60\x86\x39\x58\xF8\xF1\x8C\xEF\xE7\x94\xD1\xF8\x4C\x91\xBB\xF0"
+    "\x3E\x25\x62\xE4\x08\xAE\xC1\x6C\xFB\xA6\x59\x70\x07\xD9\x3B\xCB"
+    "\x7B\x38\x73\x6F\x64\xC8\x66\x9B\x87\xF5\x88\x89\x77\xF8\xC3\x0B"
+    "\x3B\x0C\xA4\xF0\x62\x36\xE4\xAC\xB0\x17\x57\xE0\xFE\x90\x28\xAF"
+    "\x87\xF8\xE9\x6F\x54\x91\xC5\xE8\x1D\x80\xE9\xC4\xCE\x2E\x45\xCC"
+    "\x35\x5C\xE2\x81\xDF\xED\x2A\x46\xEF\xC4\x27\x17\x08\xCB\xE0\x69"
+    "\xF7\xD1\x15\xBA\xC9\xDE\xD3\x71\xCA\x0E\xDA\x44\x31\xC6\x92\x70"
+    "\x0F\x8D\xB0\x85\x48\x36\xA7\xE2\xAA\x58\x48\xCB\x90\x3E\x92\x01"
+    "\x4D\x97\x03\x4E\x13\xC9\xD8\xD2\x65\x36\x09\xE7\xD0\x3E\x8A\xFD"
+    "\x8A\xE2\x17\xC3\xCE\x5D\x0C\x1A\xF6\x2A\x02\xFE\x42\xB7\x90\x03"
+    "\xF5\x18\xF8\x9F\xFD\x23\x15\x4D\x60\x42\x20\x53\x4D\x8A\xED\x68"
+    "\x86\x5B\xCA\x9B\x6E\x8E\x85\xDC\xE3\x0E\x9C\x5A\xF1\x62\x6E\x2B"
+    "\x2D\xE3\xC0\x3D\x45\x0E\x37\x81\x1B\xD6\x35\x76\x8D\x10\x41\xE0"
+    "\x86\x2F\x0D\x82\xB3\xDA\x4B\xB9\x71\xDC\x71\xD2\xF8\x2E\x01\xBC"
+    "\x98\x0F\x26\xF1\x83\xB3\xE0\x96\x62\x23\x3F\xBE\x4D\xA6\xEC\x00"
+    "\xB8\x38\xA5\xBD\x86\xFF\x0B\x88\xCD\x3F\xB0\x70\x48\x68\x71\x4E"
+    "\xFB\xC0\xFF\x94\x8A\x24\xE2\x74\x82\xD0\xB1\xC7\x6F\x1E\x82\x4A"
+    "\x6B\x4F\xF5\x95\xE3\xE1\x6E\x84\xE7\xDF\x93\xFC\xAC\x14\x7F\x41"
+    "\xA5\x2C\x1D\xD9\x42\x05\x2E\x03\x74\xFD\xF0\xFD\xA6\x7B\xA9\xB7"
+    "\x7F\x29\xF1\xCE\x2A\x2E\x5F\xEA\x65\x3C\x52\x3C\x46\x16\x70\xE0"
+    "\x71\xBB\x13\xBD\xBF\x7A\xDC\x39\xA6\xFD\xBE\x57\x55\xFB\x04\x7F"
+    "\xDE\xCF\x24\xF8\x0E\x9C\x90\x44\xE1\x9F\x70\x55\x7D\x1B\x00\xA1"
+    "\xCA\x54\x6F\x47\x12\x49\x22\x68\xC4\x23\xE9\x6E\xC8\xC8\x57\x83"
+    "\xC9\x15\xA1\x47\xD3\x69\x6C\x88\x30\x1C\xFE\xBA\x73\x4E\x16\x58"
+    "\x98\xD2\xF1\x05\xF4\xFB\x22\x13\x93\xAA\xA6\x44\xC8\xDE\x0A\xA9"
+    "\xBD\xA5\x8C\xE7\x4C\x47\xF4\x3E\x2A\x0D\x74\xFC\x05\xCB\xA5\x78"
+    "\x0B\xAC\xF3\x02\x83\x1E\x75\xC4\xDD\x95\xE3\x71\x48\x79\xB6\xB1"
+    "\xBC\x22\x6B\x87\x61\x9C\x4A\x1D\x22\x3E\x2B\x5D\x9D\x62\x01\xAC"
+    "\x6F\xD9\x39\x02\xCD\x01\xFD\x3E\x71\x9C\x8C\x0A\x2E\x70\xF8\x51"
+    "\x6E\xDF\xAE\x55\xBF\x4B\x08\x74\x84\x93\xD5\x6A\xF8\x1B\x71\x69"
+    "\x1E\x05\x63\x91\x94\xBB\xDE\x98\x27\x93\x31\x07\xF1\x35\xFD\x07"
+    "\x6C\x9E\x57\x40\x4D\x89\x99\x8A\xA9\x8F\xDB\x07\xA3\xAA\xD2\x7A"
+    "\x58\x71\x35\x3D\x49\x68\x03\xFC\x49\x77\x09\x1B\x50\xF9\xE2\xAA"
+    "\xF2\x71\xB9\xB0\x01\xFE\x7E\xA0\x80\x0D\x14\x79\x7E\x99\x9A\x7F"
+    "\xF7\x29\x66\xFA\x19\xF3\x31\x52\x63\x0A\xEE\x7B\x84\x99\xD6\xB7"
+    "\xE6\x07\xCE\x95\x44\x5C\x71\x83\x56\x2E\xE4\xB2\x35\x3D\x45\xC8"
+    "\x05\xD8\x2A\x42\xAE\x54\xF0\x3C\x63\x2E\x57\xB1\x6C\xCC\x15\xC1"
+    "\xC0\x0F\xBA\x52\xD7\x33\x8D\xBA\x31\x41\xB3\x87\xDD\xDF\x41\xD0"
+    "\xE5\x46\x50\x36\xE8\x0A\xE1\xFC\x28\x24\x8D\xA0\xEE\xB0\x1B\x93"
+    "\xA0\x9E\xB8\x1B\x57\xF9\xE4\x6F\x90\x72\xD4\x20\x3B\x0F\x5D\xBE"
+    "\xD5\x21\x5F\x5F\x1D\xF2\x71\xE6\x52\xC6\x5F\x6F\x3D\xE0\x5A\x24"
+    "\xD4\xF1\x3C\x73\x63\xD9\x7A\xC4\xD7\xCE\xCF\x8C\xA1\xB2\x67\x98"
+    "\x1C\x13\x92\x7E\xAB\x48\x2A\xAD\x48\xFC\xB5\xF5\xF3\x44\x68\x05"
+    "\x75\x66\xC7\x84\x08\xA7\xCF\x8D\x49\x8D\xBF\xC6\x92\x64\xC4\x08"
+    "\x71\x2D\xC7\x7C\xC8\x55\x49\xA8\xE3\x79\x06\xDF\x92\x85\x89\xE7"
+    "\x6B\xE7\x07\xDF\x50\xD9\xF3\x0B\xBE\x49\x49\xBF\xD5\x25\xD5\xD5"
+    "\x25\xC1\xCA\xFA\x81\x28\xB4\x81\x1A\x43\x6F\x52\x84\x93\x87\xDE"
+    "\x94\xC6\xE7\x54\x94\xEC\xBE\xA8\x2D\x5B\x95\x14\x33\x0A\x2E\xC7"
+    "\x98\xCB\x31\xDE\x20\x6D\xA3\x2C\xA8\x67\x71\x19\xB3\xDA\x43\xDC"
+    "\x89\xB9\xF1\xA3\x50\xB9\x00\x34\x10\xCF\x59\xCE\x81\x0B\x1D\x6C"
+    "\x17\x5C\xC5\x92\x2F\xCF\x6C\xE2\x98\x6C\x26\x5E\x9D\x81\x3B\x06"
+    "\x7B\xD1\x87\xBF\xEE\xD3\xBC\x58\x1B\x68\x91\x85\xD9\x22\x6D\x5B"
+    "\xF9\xC2\x6C\x1F\xC0\xC2\x30\x6A\x13\x97\xB7\xBA\x20\x2D\xDC\xAC"
+    "\x6A\x7D\x22\xEC\x06\xD7\x49\x36\x1A\x59\x0E\x53\xFD\x8E\x82\x4A"
+    "\x5E\x71\x0B\xC4\x71\xD8\xA3\xE0\x6F\x28\xE2\xF0\x79\xE5\xE2\xA4"
+    "\xA4\x7E\x2E\x7E\x7C\x79\x34\x1B\x3F\xB9\x7C\xE0\xE9\xB8\x54\x8B"
+    "\x57\x64\xE4\x12\x24\xDE\xBC\xC6\x77\xB5\x6B\xF1\x37\x7F\xF7\x47"
+    "\x04\xEC\xF1\x4E\xD7\x44\x03\x99\xE8\x7D\x6D\xB8\x81\x0C\xDC\x76"
+    "\x12\x7C\x55\xE1\xF1\x26\x32\x58\x5A\xD1\xF9\x2D\xBF\x22\xF1\xD4"
+    "\x3D\xB1\xC2\x60\x3C\xA4\xBD\xE1\x7B\x55\xB5\xC1\x5A\x46\x88\x7B"
+    "\xAC\xBD\x36\x73\x1B\x56\x42\xDC\xFC\x4D\x58\xFE\x00\x89\xC2\x6B"
+    "\x79\x30\x15\xDB\x2E\x7C\x47\x09\x63\xC7\xE2\xA1\x9A\x78\xB3\x38"
+    "\xE2\xFB\xE7\x15\xC2\x22\x11\xBF\x95\x12\x71\xEA\x79\x2D\x51\x9E"
+    "\x7A\x51\xD2\xCB\xD7\x1B\x67\xCB\x3D\x97\xF1\xF7\xCA\x7D\xAE\x92"
+    "\x24\x16\xAE\x9A\xA9\x45\x96\x1E\x91\x9D\x75\xE3\xB0\x79\x55\x84"
+    "\xCD\xA0\xF5\xF8\xE7\x5A\x6A\xD4\x5D\x29\x8E\xD7\xA9\xA5\xAA\xD4"
+    "\x3D\x6A\xD7\xFC\x90\x50\x86\x04\x9D\xDA\xCB\xB9\xA3\xF2\xDF\x03"
+    "\x21\xAE\x57\x30\x2E\x08\xA8\xB1\xC4\xF0\xB3\x69\x0E\xDA\xC2\x04"
+    "\x17\x20\x44\x4F\xD7\x62\xB2\x21\xCD\x16\xDD\xB1\xB9\xFC\x2B\x85"
+    "\xE0\xCA\x36\xD8\xD2\x2B\x28\x24\xB6\x9C\xA0\x23\x34\xB1\xA0\x70"
+    "\x5C\x15\xC7\x8B\xAE\x65\x80\x3B\x6E\xC3\x52\x42\x84\xCC\xD5\x0F"
+    "\xBB\xBF\xC2\x8A\x63\x86\xD2\x06\xC7\x7E\x52\x2A\x2E\xB2\x32\x09"
+    "\xD2\xA9\x41\x90\xCC\x54\xE2\xCD\x7E\x2A\xF1\xA6\x1C\x95\x01\xAE"
+    "\xA0\x12\x72\x46\x15\x54\xC6\x30\x43\x69\x83\x63\xB5\x52\x19\x0A"
+    "\xD2\xA9\x41\x90\xAC\x54\x82\x9B\x5B\x2B\xF1\x45\xD4\xFE\x17\x40"
+    "\xF9\x92\x2D\x5C\xCA\x7F\xB5\x08\xB2\x1E\xB6\xD5\xE8\xAB\xAD\xE2"
+    "\xC4\x1E\x4F\x76\x69\x7E\xE3\xA0\x62\x3A\xCE\xF3\x5F\x16\xE2\x3B"
+    "\x74\xCB\xB1\xBC\x0F\x79\x9F\x2A\xE2\x5C\x8D\xA4\xEF\xCA\xD5\xA9"
+    "\x4F\xAE\xAC\x36\x60\xC1\xBD\x8B\xE9\xFA\x42\xC4\x1E\xDB\xC8\xA3"
+    "\x95\xB1\x9F\x98\x46\x30\x6F\x55\xC0\x7C\x1A\x35\x2D\x7E\xDD\x8C"
+    "\x27\xE5\xE9\xD4\x23\x4F\x59\x6F\x8F\x8E\x57\xC6\x76\x6A\x2A\xC1"
+    "\xB7\x51\x01\xDF\xBB\xB8\xBB\x4A\xD4\xCD\x79\x5A\xA6\x4E\x5D\x32"
+    "\x15\xFB\xD4\xE9\xB0\xB5\xEF\xCB\x02\x52\x58\xE9\xA2\x68\xD8\x92"
+    "\xBF\xD8\x36\x6C\x89\x5F\xC5\xFB\x3F\x94\xED\x8B\x38\x2C\x6F\x00"
     "\x00"
 };
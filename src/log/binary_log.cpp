@@ -0,0 +1,210 @@
+#include <stdio.h>
+#include <atomic>
+#include "binary_log.h"
+
+MpscQueue<LogRecord, LOG_RING_RECORDS> logRing;
+
+static std::atomic<unsigned long> dropped{0};
+
+// indexed by DEBUG_LEVEL .. ERROR_LEVEL
+static const char *LogLevelNames[] = {"DEBUG", "INFO", "WARNING", "ERROR"};
+
+void logCountDropped() {
+    dropped.fetch_add(1, std::memory_order_relaxed);
+}
+
+unsigned long logDropped() {
+    return dropped.load(std::memory_order_relaxed);
+}
+
+unsigned int logDrain(LogSink sink, unsigned int maxRecords) {
+    unsigned int count = 0;
+    LogRecord record;
+    while((count < maxRecords) && logRing.pop(record)) {
+        if(nullptr != sink) {
+            sink(record);
+        }
+        count += 1;
+    }
+    return count;
+}
+
+//
+// an argument read back from a record
+//
+typedef struct LogArg {
+    LogArgType type;
+    int64_t integer;                    // signed and unsigned integers and pointers
+    double real;                        // float
+    char text[LOG_ARG_BYTES + 1];       // string, null terminated
+} LogArg;
+
+/**
+ * Read the next argument from a record
+ */
+static bool readArg(
+    const LogRecord &record,    // IN : record to read
+    unsigned int &offset,       // IN : offset of argument in args
+                                // OUT: offset of next argument
+    LogArg &arg)                // OUT: the argument
+                                // RET: true if an argument was read,
+                                //      false if there are no more
+{
+    if(offset >= record.length) {
+        return false;
+    }
+    const uint8_t *value = record.args + offset + 1;
+    arg.type = (LogArgType)record.args[offset];
+    switch(arg.type) {
+        case LOG_ARG_INT32: {
+            int32_t bits;
+            memcpy(&bits, value, sizeof(bits));
+            arg.integer = bits;
+            offset += 1 + sizeof(bits);
+            return true;
+        }
+        case LOG_ARG_UINT32: {
+            uint32_t bits;
+            memcpy(&bits, value, sizeof(bits));
+            arg.integer = bits;
+            offset += 1 + sizeof(bits);
+            return true;
+        }
+        case LOG_ARG_INT64:
+        case LOG_ARG_UINT64:
+        case LOG_ARG_POINTER: {
+            memcpy(&arg.integer, value, sizeof(arg.integer));
+            offset += 1 + sizeof(arg.integer);
+            return true;
+        }
+        case LOG_ARG_FLOAT: {
+            float bits;
+            memcpy(&bits, value, sizeof(bits));
+            arg.real = bits;
+            offset += 1 + sizeof(bits);
+            return true;
+        }
+        case LOG_ARG_STRING: {
+            const unsigned int length = value[0];
+            memcpy(arg.text, value + 1, length);
+            arg.text[length] = '\0';
+            offset += 2 + length;
+            return true;
+        }
+        default: {
+            offset = record.length;
+            return false;
+        }
+    }
+}
+
+/**
+ * Format one argument using a printf conversion;
+ * the argument is converted to whatever the conversion
+ * expects, so a mismatched format still prints something
+ */
+static int formatArg(
+    char *buffer,               // OUT: formatted argument
+    int bufferSize,             // IN : size of buffer
+    char *spec,                 // IN : conversion so far, like "%-8.2"; room to append 3 chars
+    char conversion,            // IN : conversion char, like 'd'
+    const LogArg &arg)          // IN : argument to format
+                                // RET: chars written, as snprintf()
+{
+    const bool real = (LOG_ARG_FLOAT == arg.type);
+    const bool text = (LOG_ARG_STRING == arg.type);
+    const size_t length = strlen(spec);
+    switch(conversion) {
+        case 'd': case 'i': {
+            strcpy(spec + length, "lld");
+            return snprintf(buffer, bufferSize, spec, real ? (long long)arg.real : (text ? 0LL : (long long)arg.integer));
+        }
+        case 'u': case 'x': case 'X': case 'o': {
+            spec[length] = 'l'; spec[length + 1] = 'l'; spec[length + 2] = conversion; spec[length + 3] = '\0';
+            return snprintf(buffer, bufferSize, spec, real ? (unsigned long long)arg.real : (text ? 0ULL : (unsigned long long)arg.integer));
+        }
+        case 'c': {
+            strcpy(spec + length, "c");
+            return snprintf(buffer, bufferSize, spec, text ? arg.text[0] : (int)arg.integer);
+        }
+        case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': {
+            spec[length] = conversion; spec[length + 1] = '\0';
+            return snprintf(buffer, bufferSize, spec, real ? arg.real : (text ? 0.0 : (double)arg.integer));
+        }
+        case 'p': {
+            return snprintf(buffer, bufferSize, "0x%llx", (unsigned long long)arg.integer);
+        }
+        case 's': {
+            strcpy(spec + length, "s");
+            if(text) {
+                return snprintf(buffer, bufferSize, spec, arg.text);
+            }
+            char number[32];
+            if(real) {
+                snprintf(number, sizeof(number), "%g", arg.real);
+            } else {
+                snprintf(number, sizeof(number), "%lld", (long long)arg.integer);
+            }
+            return snprintf(buffer, bufferSize, spec, number);
+        }
+        default: {
+            return snprintf(buffer, bufferSize, "%%%c", conversion);
+        }
+    }
+}
+
+int logFormat(const LogRecord &record, char *buffer, int bufferSize) {
+    if((nullptr == buffer) || (bufferSize <= 0)) {
+        return 0;
+    }
+
+    const uint8_t level = record.site->level;
+    int offset = snprintf(buffer, bufferSize, "%lu.%06lu %s: ",
+        (unsigned long)(record.timeUs / 1000000), (unsigned long)(record.timeUs % 1000000),
+        (level < sizeof(LogLevelNames) / sizeof(LogLevelNames[0])) ? LogLevelNames[level] : "LOG");
+
+    const char *format = record.site->format;
+    unsigned int argOffset = 0;
+    while((offset < bufferSize - 1) && ('\0' != *format)) {
+        if('%' != *format) {
+            buffer[offset++] = *format++;
+            continue;
+        }
+        if('%' == format[1]) {
+            buffer[offset++] = '%';
+            format += 2;
+            continue;
+        }
+
+        // keep flags, width and precision; drop length modifiers
+        char spec[16] = "%";
+        unsigned int specLength = 1;
+        format += 1;
+        while(('\0' != *format) && (nullptr != strchr("-+ #0123456789.", *format)) && (specLength < sizeof(spec) - 4)) {
+            spec[specLength++] = *format++;
+        }
+        spec[specLength] = '\0';
+        while(('\0' != *format) && (nullptr != strchr("hlLjzt", *format))) {
+            format += 1;
+        }
+        const char conversion = *format;
+        if('\0' == conversion) {
+            break;
+        }
+        format += 1;
+
+        LogArg arg;
+        const int count = readArg(record, argOffset, arg)
+            ? formatArg(buffer + offset, bufferSize - offset, spec, conversion, arg)
+            : snprintf(buffer + offset, bufferSize - offset, "<?>");
+        if(count > 0) {
+            offset += count;
+        }
+    }
+
+    if(offset > bufferSize - 1) {
+        offset = bufferSize - 1;
+    }
+    buffer[offset] = '\0';
+    return offset;
+}
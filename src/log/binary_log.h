@@ -0,0 +1,200 @@
+#ifndef LOG_BINARY_LOG_H
+#define LOG_BINARY_LOG_H
+
+#include <stdint.h>
+#include <string.h>
+#include <type_traits>
+#include "../config.h"
+#include "../hal/clock.h"
+#include "../util/mpsc_queue.h"
+
+//
+// Structured logging.  A log statement does not format
+// text; it writes a fixed size record holding the address
+// of its call site, the time and its arguments as binary
+// into a lock-free ring in RAM.  Formatting happens later,
+// when a sink drains the ring from the main loop, so a
+// statement costs a few copies wherever it runs and never
+// allocates.
+//
+// Use the LOG_ERROR .. LOG_DEBUG macros in log.h rather
+// than calling logWrite() directly.
+//
+
+/**
+ * A log statement's level and format.  There is one per
+ * statement and it is constant, so on the rover it and
+ * the format string stay in flash; only its address is
+ * written to the ring.
+ */
+typedef struct LogSite {
+    const char *format;     // printf style format; a string literal
+    uint8_t level;          // DEBUG_LEVEL .. ERROR_LEVEL
+} LogSite;
+
+//
+// type of each argument in a record's argument bytes;
+// each argument is its type byte followed by its value.
+// strings are a length byte and then their chars, and
+// are truncated to fit.
+//
+typedef enum LogArgType {
+    LOG_ARG_INT32 = 1,      // 4 bytes
+    LOG_ARG_UINT32,         // 4 bytes
+    LOG_ARG_INT64,          // 8 bytes
+    LOG_ARG_UINT64,         // 8 bytes
+    LOG_ARG_FLOAT,          // 4 bytes; doubles are narrowed
+    LOG_ARG_STRING,         // length byte, then chars without a terminator
+    LOG_ARG_POINTER,        // 8 bytes
+} LogArgType;
+
+typedef struct LogRecord {
+    const LogSite *site;            // statement that wrote the record
+    uint32_t timeUs;                // halMicros() when written
+    uint8_t length;                 // argument bytes used
+    uint8_t args[LOG_ARG_BYTES];    // arguments, in order
+} LogRecord;
+
+typedef void (*LogSink)(const LogRecord &record);
+
+extern MpscQueue<LogRecord, LOG_RING_RECORDS> logRing;
+
+/**
+ * Count a record lost because the ring was full
+ */
+void logCountDropped();
+
+/**
+ * Records lost because the ring was full
+ */
+unsigned long logDropped();
+
+/**
+ * Pass records in the ring to a sink, oldest first
+ */
+unsigned int logDrain(
+    LogSink sink,               // IN : called with each record
+    unsigned int maxRecords);   // IN : most records to drain
+                                // RET: records drained
+
+/**
+ * Format a record as a line of text, like
+ * "12.345678 INFO: handling /status"
+ * with time since boot in seconds.
+ * Arguments that were dropped when the record
+ * was written are shown as <?>.
+ */
+int logFormat(
+    const LogRecord &record,    // IN : record to format
+    char *buffer,               // OUT: null terminated text
+    int bufferSize);            // IN : size of buffer
+                                // RET: chars written, not counting the null
+
+//
+// write each argument's type and bytes;
+// an argument that does not fit, and all after it, are dropped
+//
+inline void logPutFull(LogRecord &record) {
+    if(record.length < LOG_ARG_BYTES) {
+        record.args[record.length] = 0;     // not a type; reading stops here
+        record.length = LOG_ARG_BYTES;
+    }
+}
+
+inline void logPutBytes(LogRecord &record, LogArgType type, const void *value, unsigned int size) {
+    if(record.length + 1 + size <= LOG_ARG_BYTES) {
+        record.args[record.length] = (uint8_t)type;
+        memcpy(record.args + record.length + 1, value, size);
+        record.length += 1 + size;
+    } else {
+        logPutFull(record);
+    }
+}
+
+template <class T> inline
+typename std::enable_if<(std::is_integral<T>::value || std::is_enum<T>::value) && (sizeof(T) <= 4)>::type
+logPutArg(LogRecord &record, T value) {
+    if(std::is_signed<T>::value || std::is_enum<T>::value) {
+        const int32_t bits = (int32_t)value;
+        logPutBytes(record, LOG_ARG_INT32, &bits, sizeof(bits));
+    } else {
+        const uint32_t bits = (uint32_t)value;
+        logPutBytes(record, LOG_ARG_UINT32, &bits, sizeof(bits));
+    }
+}
+
+template <class T> inline
+typename std::enable_if<std::is_integral<T>::value && (sizeof(T) > 4)>::type
+logPutArg(LogRecord &record, T value) {
+    if(std::is_signed<T>::value) {
+        const int64_t bits = (int64_t)value;
+        logPutBytes(record, LOG_ARG_INT64, &bits, sizeof(bits));
+    } else {
+        const uint64_t bits = (uint64_t)value;
+        logPutBytes(record, LOG_ARG_UINT64, &bits, sizeof(bits));
+    }
+}
+
+inline void logPutArg(LogRecord &record, double value) {
+    const float bits = (float)value;
+    logPutBytes(record, LOG_ARG_FLOAT, &bits, sizeof(bits));
+}
+
+inline void logPutArg(LogRecord &record, const char *value) {
+    if(nullptr == value) {
+        value = "(null)";
+    }
+    if(record.length + 2u <= LOG_ARG_BYTES) {
+        const size_t room = LOG_ARG_BYTES - record.length - 2;
+        const size_t length = strnlen(value, room);
+        record.args[record.length] = (uint8_t)LOG_ARG_STRING;
+        record.args[record.length + 1] = (uint8_t)length;
+        memcpy(record.args + record.length + 2, value, length);
+        record.length += 2 + length;
+    } else {
+        logPutFull(record);
+    }
+}
+
+inline void logPutArg(LogRecord &record, const void *value) {
+    const uint64_t bits = (uint64_t)(uintptr_t)value;
+    logPutBytes(record, LOG_ARG_POINTER, &bits, sizeof(bits));
+}
+
+inline void logPutArgs(LogRecord &) {}
+
+template <class T, class... Rest> inline void logPutArgs(LogRecord &record, T first, Rest... rest) {
+    logPutArg(record, first);
+    logPutArgs(record, rest...);
+}
+
+/**
+ * Write a record to the ring; if the ring is full
+ * the record is dropped and counted.
+ * Do not call from an interrupt handler; this
+ * code is not in IRAM.
+ */
+template <class... Args> void logWrite(
+    const LogSite *site,    // IN : the statement's level and format
+    Args... args)           // IN : integers, enums, floats, c-strings or pointers
+{
+    LogRecord record;
+    record.site = site;
+    record.timeUs = (uint32_t)halMicros();
+    record.length = 0;
+    logPutArgs(record, args...);
+    if(!logRing.push(record)) {
+        logCountDropped();
+    }
+}
+
+//
+// Write a record for a log statement; the format
+// must be a string literal so it can be kept by address.
+//
+#define LOG_RECORD(_level_, _fmt_, ...) do{ \
+    static const LogSite _logSite_ = {"" _fmt_ "", (uint8_t)(_level_)}; \
+    logWrite(&_logSite_, ##__VA_ARGS__); \
+}while(0)
+
+#endif // LOG_BINARY_LOG_H
@@ -19,6 +19,7 @@
 #include "string/strcopy.h"
 #include "websockets/command_socket.h"
 #include "serial.h"
+#include "log/binary_log.h"
 #include "gpio/pwm.h"
 #include "motor/motor_l9110s.h"
 #include "encoder/encoder.h"
@@ -31,6 +32,18 @@
 #include "rover/rover.h"
 #include "rover/goto_goal.h"
 #include "rover/rover_command.h"
+#include "rover/path_follow.h"
+#include "planner/occupancy_grid.h"
+#include "planner/path_planner.h"
+#include "behavior/arbiter.h"
+#include "behavior/geofence_behavior.h"
+#include "settings/settings.h"
+#include "wifi/wifi_manager.h"
+#include "http/etag.h"
+#include "udp/udp_socket.h"
+#include "metrics/runtime_metrics.h"
+#include "metrics/health.h"
+#include "util/latest_value.h"
 
 //
 // wheel encoders use same pins as the serial port,
@@ -61,6 +74,16 @@ bool builtInLedOn = false;
 #include "wifi_credentials.h"
 //const char* ssid = "******";
 //const char* password = "******";
+//
+// to skip dhcp when joining, also define a static address there:
+//#define WIFI_STATIC_IP
+//const WifiStaticIp staticIp = {{192, 168, 1, 50}, {192, 168, 1, 1}, {255, 255, 255, 0}, {192, 168, 1, 1}};
+//
+#ifdef WIFI_STATIC_IP
+    const WifiStaticIp *wifiStaticIp = &staticIp;
+#else
+    const WifiStaticIp *wifiStaticIp = nullptr;
+#endif
 
 //
 // camera web service endpoints
@@ -71,10 +94,39 @@ void captureHandler(AsyncWebServerRequest *request);
 
 // health endpoint
 void healthHandler(AsyncWebServerRequest *request);
+void pollHealth();
+
+// prometheus metrics endpoint
+void metricsHandler(AsyncWebServerRequest *request);
+void collectRuntimeMetrics(RuntimeMetrics &metrics);
 
 // 404 not found handler
 void notFound(AsyncWebServerRequest *request);
 
+//
+// compressed web app assets are revalidated with their etag.
+// the page always revalidates so a new firmware's page is seen
+// right away.  The page loads the bundles as bundle.js?v=<etag>
+// (tools/bundle.sh writes the etags in), so a new bundle has a
+// new url and a cached one never needs to be asked about again.
+//
+const char *HTML_CACHE_CONTROL = "no-cache";
+const char *BUNDLE_CACHE_CONTROL = "public, max-age=31536000, immutable";
+void sendAsset(AsyncWebServerRequest *request, const char *contentType, const uint8_t *content, size_t length, const char *etag, const char *cacheControl);
+
+// apply settings saved in flash
+void applySettings();
+
+// start http server and websockets once wifi is connected
+void startNetworkServices();
+bool networkStarted = false;    // true once network services are started
+
+// log time taken by a startup stage
+void logBootStage(const char *stage, unsigned long stageStartMs);
+
+// send drained log records to serial and the command client
+void sendLogRecord(const LogRecord &record);
+
 //
 // Create all the parts for the rover.
 // It's CRITICAL that PwmChannels exist for life of the motor instance
@@ -82,6 +134,17 @@ void notFound(AsyncWebServerRequest *request);
 
 MessageBus messageBus;
 TelemetrySender telemetry;
+LoopStats loopStats(LOOP_OVERRUN_US);   // main loop rate for /metrics and /health
+HealthMonitor healthMonitor;            // subsystem health for /health
+LatestValue<HealthMonitor> healthSnapshot;  // copy of healthMonitor for the /health handler
+
+// keeps wifi joined; rover halts while it is down
+Esp32WifiRadio wifiRadio;
+WifiManager wifiManager;
+
+// calibration and camera profile kept in flash across restarts
+PreferencesSettingsStorage settingsStorage("rover");
+Settings settings;
 
 // left drive wheel
 PwmChannel leftForwardPwm(A1_A_PIN, LEFT_FORWARD_CHANNEL, MotorL9110s::pwmBits());
@@ -113,6 +176,17 @@ RoverCommandProcessor roverCommandProcessor;
 
 // rover behaviors
 GotoGoalBehavior gotoGoalBehavior;
+PathFollowBehavior pathFollowBehavior;
+GeofenceBehavior geofenceBehavior;  // keeps rover inside the geofence
+BehaviorArbiter behaviorArbiter;    // chooses which behavior drives the wheels
+
+// map and planner workspace; statically allocated so planning never allocates
+grid_word_type mapBits[(MAP_MAX_CELLS + GRID_WORD_BITS - 1) / GRID_WORD_BITS];
+OccupancyGrid occupancyGrid(mapBits, sizeof(mapBits) / sizeof(mapBits[0]));
+plan_cost_type planCost[MAP_MAX_CELLS];
+uint8_t planFrom[MAP_MAX_CELLS];
+PlannerHeapEntry planHeap[PLAN_HEAP_ENTRIES];
+PathPlanner pathPlanner(planCost, planFrom, MAP_MAX_CELLS, planHeap, PLAN_HEAP_ENTRIES);
 
 // create the http server
 AsyncWebServer server(80);
@@ -134,21 +208,111 @@ void setup()
 
     LOG_INFO("Setting up...");
 
-    // 
-    // init wifi
     //
-    WiFi.mode(WIFI_STA);
-    WiFi.begin(ssid, password);
-    if (WiFi.waitForConnectResult() != WL_CONNECTED)
-    {
-        LOG_ERROR("WiFi Failed!\n");
-        return;
-    }
+    // start wifi association; it runs in the background
+    // while the camera and rover are initialized.
+    //
+    unsigned long stageMs = millis();
+    wifiManager.attach(wifiRadio, messageBus).begin(ssid, password, wifiStaticIp, millis());
+    logBootStage("wifi begin", stageMs);
+
+    //
+    // create background task to execute queued rover tasks
+    //
+    // xTaskCreate(roverTask, "roverTask", 1024, NULL, 1, &roverTaskHandle);
+
+    //
+    // initialize the camera
+    //
+    stageMs = millis();
+    initCamera();
+    logBootStage("camera", stageMs);
 
+    //
+    // initialize rover dependancies
+    //
+    // NOTE: The motors are attached now so the rover is stopped
+    //       from the first loop tick, but the encoders are not.
+    //       I suspect that the camera or wifi code uses the 
+    //       serial pins when they first start, however we use the 
+    //       serial port pins for the wheel encoders.  Wifi is still
+    //       associating at this point, so the encoders are detached
+    //       again below and attached in startNetworkServices(),
+    //       once wifi has connected.
+    //
+    stageMs = millis();
+    telemetry.attach(&messageBus);
+    rover.attach(
+        leftWheel.attach(
+            leftMotor.attach(leftForwardPwm, leftReversePwm), 
+            leftWheelEncoderPtr, 
+            PULSES_PER_REVOLUTION, 
+            &messageBus),
+        rightWheel.attach(
+            rightMotor.attach(rightForwardPwm, rightReversePwm), 
+            rightWheelEncoderPtr, 
+            PULSES_PER_REVOLUTION, 
+            &messageBus),
+        &messageBus);
+    gotoGoalBehavior.attach(rover, messageBus).startListening();
+    pathFollowBehavior.attach(rover, gotoGoalBehavior, occupancyGrid, pathPlanner, messageBus);
+    geofenceBehavior.attach(rover, messageBus);
+    roverCommandProcessor.attach(rover, gotoGoalBehavior, pathFollowBehavior, geofenceBehavior, settings, messageBus);
+    behaviorArbiter.attach(rover);
+
+    // timestamp when movement commands reach the motors
+    PwmChannel::setWriteHook([](gpio_type pin, pwm_type pwm) {
+        roverCommandProcessor.latency().pwmWritten(micros());
+    });
+    behaviorArbiter.addBehavior(geofenceBehavior);
+    behaviorArbiter.addBehavior(roverCommandProcessor.teleopBehavior());
+    behaviorArbiter.addBehavior(gotoGoalBehavior);
+
+    #ifdef USE_WHEEL_ENCODERS
+        // internal led will blink on each wheel rotation
+        pinMode(BUILTIN_LED_PIN, OUTPUT);
+
+        // wheels run open loop until the encoders are attached
+        leftWheelEncoder.detach();
+        rightWheelEncoder.detach();
+    #endif
+    logBootStage("rover", stageMs);
+
+    // saved calibration must be in place before the first control tick
+    stageMs = millis();
+    settings.attach(settingsStorage).load();
+    applySettings();
+    logBootStage("settings", stageMs);
+
+    //
+    // the rover is stopped and safe until a client connects;
+    // network services start in loop() once wifi is up.
+    //
+    LOG_INFO("...Rover Initialized...");
+
+}
+
+/**
+ * Start the http server and websockets.
+ * Called once, when wifi first connects.
+ */
+void startNetworkServices() {
     SERIAL_PRINT("...Wifi initialized, running on IP Address: ");
     SERIAL_PRINTLN(WiFi.localIP().toString());
     SERIAL_PRINT("ESP Board MAC Address:  ");
     SERIAL_PRINTLN(WiFi.macAddress());
+    logBootStage("wifi connect", 0);
+
+    const unsigned long stageMs = millis();
+
+    //
+    // wifi is up, so the serial pins are free for the
+    // wheel encoders (see the NOTE in setup())
+    //
+    #ifdef USE_WHEEL_ENCODERS
+        leftWheelEncoder.attach();
+        rightWheelEncoder.attach();
+    #endif
 
     //
     // init web server
@@ -156,27 +320,24 @@ void setup()
 
     // endpoints to return the compressed html/css/javascript for the browser web application
     server.on("/", HTTP_GET, [](AsyncWebServerRequest *request) {
-        LOG_INFO("handling " + request->url());
-        AsyncWebServerResponse *response = request->beginResponse_P(200, "text/html", index_html_gz, sizeof(index_html_gz));
-        response->addHeader("Content-Encoding", "gzip");
-        request->send(response);
+        LOG_INFO("handling %s", request->url().c_str());
+        sendAsset(request, "text/html", index_html_gz, sizeof(index_html_gz), index_html_etag, HTML_CACHE_CONTROL);
     });
     server.on("/bundle.css", HTTP_GET, [](AsyncWebServerRequest *request) {
-        LOG_INFO("handling " + request->url());
-        AsyncWebServerResponse *response = request->beginResponse_P(200, "text/css", bundle_css_gz, sizeof(bundle_css_gz));
-        response->addHeader("Content-Encoding", "gzip");
-        request->send(response);
+        LOG_INFO("handling %s", request->url().c_str());
+        sendAsset(request, "text/css", bundle_css_gz, sizeof(bundle_css_gz), bundle_css_etag, BUNDLE_CACHE_CONTROL);
     });
     server.on("/bundle.js", HTTP_GET, [](AsyncWebServerRequest *request) {
-        LOG_INFO("handling " + request->url());
-        AsyncWebServerResponse *response = request->beginResponse_P(200, "text/javascript", bundle_js_gz, sizeof(bundle_js_gz));
-        response->addHeader("Content-Encoding", "gzip");
-        request->send(response);
+        LOG_INFO("handling %s", request->url().c_str());
+        sendAsset(request, "text/javascript", bundle_js_gz, sizeof(bundle_js_gz), bundle_js_etag, BUNDLE_CACHE_CONTROL);
     });
 
     // endpoint to check server health
     server.on("/health", HTTP_GET, healthHandler);
 
+    // endpoint for prometheus metrics; runtime stats and command latency
+    server.on("/metrics", HTTP_GET, metricsHandler);
+
     // endpoint for streaming video from camera
     server.on("/control", HTTP_GET, configHandler);     // set a single camera setting
     server.on("/status", HTTP_GET, statusHandler);      // return camera settings
@@ -197,48 +358,44 @@ void setup()
     wsCommandInit();
     LOG_INFO("... websockets server intialized ...");
 
-    //
-    // create background task to execute queued rover tasks
-    //
-    // xTaskCreate(roverTask, "roverTask", 1024, NULL, 1, &roverTaskHandle);
-
-    //
-    // initialize the camera
-    //
-    initCamera();
-
-    //
-    // initialize rover dependancies
-    //
-    // NOTE: This MUST happen AFTER other initializations.
-    //       I suspect that the camera or wifi code uses the 
-    //       serial pins when they first start, however we use the 
-    //       serial port pins for the wheel encoders.  So we must 
-    //       attach to those pins after those systems are started.
-    //
-    telemetry.attach(&messageBus);
-    rover.attach(
-        leftWheel.attach(
-            leftMotor.attach(leftForwardPwm, leftReversePwm), 
-            leftWheelEncoderPtr, 
-            PULSES_PER_REVOLUTION, 
-            &messageBus),
-        rightWheel.attach(
-            rightMotor.attach(rightForwardPwm, rightReversePwm), 
-            rightWheelEncoderPtr, 
-            PULSES_PER_REVOLUTION, 
-            &messageBus),
-        &messageBus);
-    gotoGoalBehavior.attach(rover, messageBus).startListening();
-    roverCommandProcessor.attach(rover, gotoGoalBehavior);
-
-    #ifdef USE_WHEEL_ENCODERS
-        // internal led will blink on each wheel rotation
-        pinMode(BUILTIN_LED_PIN, OUTPUT);
+    #ifdef USE_UDP_COMMANDS
+        udpCommandInit();
+        LOG_INFO("... udp command port intialized ...");
     #endif
 
-    LOG_INFO("...Rover Initialized...");
+    logBootStage("network services", stageMs);
+    logBootStage("drivable", 0);
+    networkStarted = true;
+}
 
+/**
+ * Log time taken by a startup stage,
+ * like "boot: camera took 312ms, at 840ms"
+ */
+void logBootStage(
+    const char *stage,          // IN : name of stage
+    unsigned long stageStartMs) // IN : millis() when stage started; 0 for time since boot
+{
+    const unsigned long nowMs = millis();
+    LOG_INFO("boot: %s took %lums, at %lums", stage, nowMs - stageStartMs, nowMs);
+}
+
+/**
+ * Format a log record drained from the log ring
+ * and send it to the serial port, unless serial is
+ * disabled, and to the command client as log(...)
+ */
+void sendLogRecord(const LogRecord &record) // IN : record to send
+{
+    char text[LOG_TEXT_BYTES];
+    int offset = strCopy(text, sizeof(text), "log(");
+    offset += logFormat(record, text + offset, sizeof(text) - offset - 1);
+    SERIAL_PRINTLN(text + 4);
+
+    if(networkStarted) {
+        offset = strCopyAt(text, sizeof(text), offset, ")");
+        wsSendCommandText(text, offset);
+    }
 }
 
 /**
@@ -248,19 +405,39 @@ void setup()
  */
 void loop()
 {
+    loopStats.tick(micros());
+
+    // wifi associates in the background; start serving once it is up
+    wifiManager.poll(millis());
+    if(!networkStarted && wifiManager.connected()) {
+        startNetworkServices();
+    }
+
     // poll all rover systems (motor, encoders, speed controllers)
     rover.poll(millis());
     roverCommandProcessor.pollRoverCommand(millis());
+    pathFollowBehavior.poll(millis());
+    behaviorArbiter.poll(millis());     // drive wheels with the winning behavior
+    settings.poll(millis());            // apply queued camera settings, write changed settings to flash
     telemetry.poll();   // send any buffered telemetry
-
-    // poll stream to send image to clients via websocket
-    #ifdef ENABLE_CAMERA
-        wsStreamCameraImage();
-    #endif
-    wsStreamPoll();
-
-    // poll stream that gets command via websocket
-    wsCommandPoll();
+    logDrain(sendLogRecord, LOG_DRAIN_PER_POLL);    // format and send logged records
+    pollHealth();       // note subsystem progress for /health
+
+    if(networkStarted) {
+        // poll stream to send image to clients via websocket
+        #ifdef ENABLE_CAMERA
+            wsStreamCameraImage();
+        #endif
+        wsStreamPoll();
+
+        // poll stream that gets command via websocket
+        wsCommandPoll();
+
+        #ifdef USE_UDP_COMMANDS
+            // poll udp control port
+            udpCommandPoll();
+        #endif
+    }
 
     #ifdef USE_WHEEL_ENCODERS
         //
@@ -281,6 +458,32 @@ void loop()
 // for the associated url is received.
 // They should not be called directly.
 
+/**
+ * Send a gzipped asset, or 304 Not Modified
+ * if the client's copy has the same etag.
+ */
+void sendAsset(
+    AsyncWebServerRequest *request, // IN : request for asset
+    const char *contentType,        // IN : mime type of uncompressed asset
+    const uint8_t *content,         // IN : gzipped asset in flash
+    size_t length,                  // IN : bytes in content
+    const char *etag,               // IN : quoted entity tag of content
+    const char *cacheControl)       // IN : Cache-Control header value
+{
+    AsyncWebServerResponse *response;
+    if(request->hasHeader("If-None-Match")
+        && etagMatches(request->header("If-None-Match").c_str(), etag))
+    {
+        response = request->beginResponse(304);
+    } else {
+        response = request->beginResponse_P(200, contentType, content, length);
+        response->addHeader("Content-Encoding", "gzip");
+    }
+    response->addHeader("ETag", etag);
+    response->addHeader("Cache-Control", cacheControl);
+    request->send(response);
+}
+
 /**
  * Handle request for unknown url with a 404 response code
  */
@@ -291,15 +494,170 @@ void notFound(AsyncWebServerRequest *request)
 
 
 /**
- * Health endpoint returns 200 with json body
- * indicating health of server
+ * Apply settings loaded from flash.
+ * Only records that were loaded are applied;
+ * others keep the compiled-in defaults.
+ */
+void applySettings()
+{
+    const unsigned int loaded = settings.loaded();
+    const RoverSettings &values = settings.values();
+
+    if(loaded & settingsBit(SETTINGS_LEFT_PID)) {
+        const PidSettings &pid = values.leftPid;
+        rover.setSpeedControl(LEFT_WHEEL, pid.minSpeed, pid.maxSpeed, pid.Kp, pid.Ki, pid.Kd);
+    }
+    if(loaded & settingsBit(SETTINGS_RIGHT_PID)) {
+        const PidSettings &pid = values.rightPid;
+        rover.setSpeedControl(RIGHT_WHEEL, pid.minSpeed, pid.maxSpeed, pid.Kp, pid.Ki, pid.Kd);
+    }
+    if(loaded & settingsBit(SETTINGS_STALL)) {
+        rover.setMotorStall(values.stall.left, values.stall.right);
+    }
+    if(loaded & settingsBit(SETTINGS_COMMAND)) {
+        roverCommandProcessor.deadman().setTimeout(values.command.deadmanTimeoutMs);
+    }
+    if(loaded & settingsBit(SETTINGS_CAMERA)) {
+        for(int i = 0; i < NUMBER_OF_CAMERA_SETTINGS; i += 1) {
+            if(values.camera.set & (1u << i)) {
+                setCameraProperty(String(CameraSettingStr[i]), String(values.camera.values[i]));
+            }
+        }
+    }
+}
+
+/**
+ * Health endpoint returns json body with the
+ * health of each subsystem and of the rover;
+ * 200 if ok or degraded, 503 if failed
  */
 void healthHandler(AsyncWebServerRequest *request)
 {
-    LOG_INFO("handling " + request->url());
+    LOG_INFO("handling %s", request->url().c_str());
 
-    // TODO: determine if camera and rover are healty
-    request->send(200, "application/json", "{\"health\": \"ok\"}");
+    //
+    // the control loop publishes a copy after each poll;
+    // keep the newest one.  It is judged by the time now,
+    // so a loop that stopped publishing shows as failed.
+    //
+    static HealthMonitor health;    // only touched by the web server task
+    healthSnapshot.take(health);
+
+    // failed answers 503 so a monitor that only looks at status codes notices
+    char buffer[512];
+    const unsigned long nowMs = millis();
+    health.formatHealth(buffer, sizeof(buffer), nowMs);
+    const int status = (HEALTH_FAILED == health.overall(nowMs)) ? 503 : 200;
+    request->send(status, "application/json", buffer);
+}
+
+/**
+ * Give the health monitor the counters
+ * the rover already keeps
+ */
+void pollHealth()
+{
+    HealthInputs inputs;
+    #ifdef ENABLE_CAMERA
+        inputs.cameraEnabled = true;
+    #else
+        inputs.cameraEnabled = false;
+    #endif
+    inputs.streaming = networkStarted && wsStreamActive();
+    inputs.framesCaptured = streamFrames.captured;
+    #ifdef USE_WHEEL_ENCODERS
+        inputs.encodersEnabled = true;
+    #else
+        inputs.encodersEnabled = false;
+    #endif
+    inputs.leftPowered = leftWheel.pwm() > (pwm_type)(leftWheel.stall() * MotorL9110s::maxPwm());
+    inputs.rightPowered = rightWheel.pwm() > (pwm_type)(rightWheel.stall() * MotorL9110s::maxPwm());
+    inputs.leftTicks = rover.readLeftWheelTicks();
+    inputs.rightTicks = rover.readRightWheelTicks();
+    inputs.loopOverruns = loopStats.overruns();
+    inputs.maxLoopUs = loopStats.maxLoopUs();
+    inputs.telemetryBacklog = telemetry.backlog();
+    inputs.telemetryCapacity = TelemetrySender::capacity();
+    inputs.telemetryDropped = telemetry.dropped();
+    healthMonitor.poll(millis(), inputs);
+    healthSnapshot.write(healthMonitor);
+}
+
+/**
+ * Metrics endpoint returns 200 with
+ * Prometheus text format body
+ */
+void metricsHandler(AsyncWebServerRequest *request)
+{
+    LOG_INFO("handling %s", request->url().c_str());
+
+    //
+    // take a copy of the values now, then write the
+    // text a line at a time as the connection asks
+    // for it, so there is never more than one line
+    // buffered, however many metrics there are.
+    //
+    RuntimeMetrics metrics;
+    collectRuntimeMetrics(metrics);
+    MetricsWriter writer(metrics);
+    AsyncWebServerResponse *response = request->beginChunkedResponse("text/plain; version=0.0.4",
+        [writer](uint8_t *buffer, size_t maxLen, size_t index) mutable -> size_t {
+            return writer.read(buffer, maxLen);
+        });
+    request->send(response);
+}
+
+//
+// tasks whose stack high-water mark is reported
+//
+const char *MetricsTaskNames[METRICS_MAX_TASKS] = {
+    "loopTask",     // arduino loop()
+    "async_tcp",    // web server handlers
+    "wifi",         // wifi driver
+    "tiT",          // tcp/ip stack
+};
+
+/**
+ * Copy the current runtime values for /metrics
+ */
+void collectRuntimeMetrics(RuntimeMetrics &metrics) // OUT: current values
+{
+    metrics.uptimeMs = millis();
+    metrics.loopRate = loopStats.rate();
+    metrics.maxLoopUs = loopStats.maxLoopUs();
+    metrics.loopOverruns = loopStats.overruns();
+    metrics.freeHeap = ESP.getFreeHeap();
+    metrics.minFreeHeap = ESP.getMinFreeHeap();
+    metrics.largestFreeBlock = ESP.getMaxAllocHeap();
+    metrics.psramSize = ESP.getPsramSize();
+    metrics.psramFree = ESP.getFreePsram();
+    metrics.frames = streamFrames;
+    metrics.telemetryDropped = telemetry.dropped();
+    metrics.configQueueDepth = roverCommandProcessor.configQueueDepth();
+    metrics.scheduleQueueDepth = roverCommandProcessor.scheduleQueueDepth();
+    metrics.wifiRssi = wifiManager.connected() ? WiFi.RSSI() : 0;
+    metrics.wifiReconnects = wifiManager.reconnects();
+
+    //
+    // the control loop keeps adding to the histograms,
+    // so copy them rather than read them while the
+    // response is sent a line at a time
+    //
+    metrics.hasLatency = true;
+    for(unsigned int stage = 0; stage < NUMBER_OF_LATENCY_STAGES; stage += 1) {
+        metrics.latency[stage] = roverCommandProcessor.latency().histogram((LatencyStage)stage);
+    }
+
+    metrics.taskCount = 0;
+    for(unsigned int i = 0; i < METRICS_MAX_TASKS; i += 1) {
+        TaskHandle_t task = xTaskGetHandle(MetricsTaskNames[i]);
+        if(nullptr != task) {
+            // esp-idf reports the high-water mark in bytes
+            metrics.tasks[metrics.taskCount].name = MetricsTaskNames[i];
+            metrics.tasks[metrics.taskCount].freeBytes = uxTaskGetStackHighWaterMark(task);
+            metrics.taskCount += 1;
+        }
+    }
 }
 
 /**
@@ -309,7 +667,7 @@ void healthHandler(AsyncWebServerRequest *request)
  */
 void captureHandler(AsyncWebServerRequest *request)
 {
-    LOG_INFO("handling " + request->url());
+    LOG_INFO("handling %s", request->url().c_str());
 
     //
     // 1. create buffer to hold image
@@ -351,7 +709,7 @@ void captureHandler(AsyncWebServerRequest *request)
  */
 void statusHandler(AsyncWebServerRequest *request) 
 {
-    LOG_INFO("handling " + request->url());
+    LOG_INFO("handling %s", request->url().c_str());
 
     const String json = getCameraPropertiesJson();
     request->send_P(200, "application/json", (uint8_t *)json.c_str(), json.length());
@@ -365,7 +723,7 @@ void statusHandler(AsyncWebServerRequest *request)
  *   - 'val' is the value of the configuration variable to set
  */
 void configHandler(AsyncWebServerRequest *request) {
-    LOG_INFO("handling " + request->url());
+    LOG_INFO("handling %s", request->url().c_str());
 
     //
     // validate parameters
@@ -392,6 +750,10 @@ void configHandler(AsyncWebServerRequest *request) {
         const int status = setCameraProperty(varParam, valParam);
         if(SUCCESS != status) {
             LOG_ERROR("Failure setting camera property");
+        } else {
+            // remember camera profile; properties not kept are ignored.
+            // this runs on the web server task, so loop() applies it
+            settings.queueCamera(varParam.c_str(), valParam.toInt(), millis());
         }
         request->send((SUCCESS == status) ? 200: 500);
     }
@@ -9,12 +9,20 @@ const char *Messages[NUMBER_OF_MESSAGES] = {
     "SPEED_CONTROL",      // speed control was updated
     "MOTOR_STALL",        // motor stall value was changed
     "ROVER_POSE",         // rover position and/or orientation changed
+    "GOTO_GOAL",          // goto goal update
+    "PATH_FOLLOW",        // path follow update
+    "GEOFENCE",           // geofence triggered or cleared
+    "DEADMAN_HALT",       // client went quiet while moving; ramping to a halt
+    "COMMAND_LATENCY",    // command latency histogram report for one stage
+    "SCRIPT_STATE",       // uploaded script started, stopped or finished
+    "WIFI_STATE",         // wifi connection state changed
 };
 
 const char *Specifiers[NUMBER_OF_SPECIFIERS] = {
     "NONE",
     "LEFT_WHEEL",
     "RIGHT_WHEEL",
-    "ROVER"
+    "ROVER",
+    "BEHAVIOR",
 };
 
@@ -11,6 +11,12 @@ typedef enum Message {
     MOTOR_STALL,        // motor stall value was changed
     ROVER_POSE,         // current rover position and orientation {x, y, angle}
     GOTO_GOAL,          // goto goal update
+    PATH_FOLLOW,        // path follow update
+    GEOFENCE,           // geofence triggered or cleared
+    DEADMAN_HALT,       // client went quiet while moving; ramping to a halt
+    COMMAND_LATENCY,    // command latency histogram report for one stage
+    SCRIPT_STATE,       // uploaded script started, stopped or finished
+    WIFI_STATE,         // wifi connection state changed
     NUMBER_OF_MESSAGES  // THIS SHOULD ALWAYS BE LAST
 } Message;
 
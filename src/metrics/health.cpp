@@ -0,0 +1,231 @@
+#include <string.h>
+#include "health.h"
+#include "../config.h"
+#include "../string/strcopy.h"
+#include "../string/json.h"
+
+const char *HealthStateStr[NUMBER_OF_HEALTH_STATES] = {
+    "ok",
+    "degraded",
+    "failed",
+};
+
+const char *HealthSubsystemStr[NUMBER_OF_HEALTH_SUBSYSTEMS] = {
+    "camera",
+    "encoders",
+    "loop",
+    "telemetry",
+};
+
+/**
+ * Time since an event; 0 if the event was recorded
+ * after currentMillis, as when the caller read its
+ * clock just before the control loop last polled
+ */
+static unsigned long ageMs(
+    unsigned long currentMillis,    // IN : current time in milliseconds
+    unsigned long eventMs)          // IN : time of event in milliseconds
+                                    // RET: milliseconds since event, never negative
+{
+    const long age = (long)(currentMillis - eventMs);
+    return (age > 0) ? (unsigned long)age : 0;
+}
+
+/**
+ * Track how long a powered wheel has gone without an encoder edge
+ */
+void HealthMonitor::_pollWheel(
+    WheelHealth &wheel,             // IN/OUT: wheel to update
+    bool powered,                   // IN : true if motor pwm is above stall
+    uint32_t ticks,                 // IN : encoder ticks since boot
+    unsigned long currentMillis)    // IN : current time in milliseconds
+{
+    if(!powered || (ticks != wheel.ticks)) {
+        // an unpowered wheel is not expected to turn
+        wheel.edgeMs = currentMillis;
+    }
+    wheel.ticks = ticks;
+    wheel.silentMs = currentMillis - wheel.edgeMs;
+}
+
+/**
+ * Record the current counters
+ */
+HealthMonitor& HealthMonitor::poll(
+    unsigned long currentMillis,    // IN : current time in milliseconds
+    const HealthInputs &inputs)     // IN : current counters
+                                    // RET: this instance
+{
+    if(!_started) {
+        _started = true;
+        _inputs = inputs;
+        _frameMs = currentMillis;
+        _backlogFreeMs = currentMillis;
+        _wheels[0] = {inputs.leftTicks, currentMillis, 0};
+        _wheels[1] = {inputs.rightTicks, currentMillis, 0};
+    }
+
+    if((inputs.framesCaptured != _inputs.framesCaptured) || (inputs.streaming && !_inputs.streaming)) {
+        // new frame, or give a new stream time for its first frame
+        _frameMs = currentMillis;
+    }
+    if(inputs.loopOverruns != _inputs.loopOverruns) {
+        _overrunMs = currentMillis;
+        _overrun = true;
+    }
+    if(inputs.telemetryDropped != _inputs.telemetryDropped) {
+        _droppedMs = currentMillis;
+        _dropped = true;
+    }
+    if(inputs.telemetryBacklog < inputs.telemetryCapacity) {
+        _backlogFreeMs = currentMillis;
+    }
+    _pollWheel(_wheels[0], inputs.leftPowered, inputs.leftTicks, currentMillis);
+    _pollWheel(_wheels[1], inputs.rightPowered, inputs.rightTicks, currentMillis);
+
+    _inputs = inputs;
+    _pollMs = currentMillis;
+    return *this;
+}
+
+/**
+ * Health of one subsystem
+ */
+HealthState HealthMonitor::state(
+    HealthSubsystem subsystem,              // IN : subsystem to check
+    unsigned long currentMillis) const      // IN : current time in milliseconds
+                                            // RET: subsystem health
+{
+    switch(subsystem) {
+        case HEALTH_CAMERA: {
+            if(!_started || !_inputs.cameraEnabled || !_inputs.streaming) {
+                // frames are only taken while streaming
+                return HEALTH_OK;
+            }
+            const unsigned long frameAgeMs = ageMs(currentMillis, _frameMs);
+            if(frameAgeMs >= HEALTH_FRAME_FAILED_MS) return HEALTH_FAILED;
+            if(frameAgeMs >= HEALTH_FRAME_STALE_MS) return HEALTH_DEGRADED;
+            return HEALTH_OK;
+        }
+        case HEALTH_ENCODERS: {
+            if(!_started || !_inputs.encodersEnabled) {
+                return HEALTH_OK;
+            }
+            if((_wheels[0].silentMs >= HEALTH_ENCODER_SILENT_MS) || (_wheels[1].silentMs >= HEALTH_ENCODER_SILENT_MS)) {
+                return HEALTH_FAILED;
+            }
+            return HEALTH_OK;
+        }
+        case HEALTH_CONTROL_LOOP: {
+            if(!_started || (ageMs(currentMillis, _pollMs) >= HEALTH_LOOP_STALLED_MS)) {
+                return HEALTH_FAILED;
+            }
+            if(_overrun && (ageMs(currentMillis, _overrunMs) < HEALTH_WINDOW_MS)) {
+                return HEALTH_DEGRADED;
+            }
+            return HEALTH_OK;
+        }
+        case HEALTH_TELEMETRY: {
+            if(!_started) {
+                return HEALTH_OK;
+            }
+            if((_inputs.telemetryBacklog >= _inputs.telemetryCapacity)
+                && (ageMs(currentMillis, _backlogFreeMs) >= HEALTH_TELEMETRY_STUCK_MS))
+            {
+                return HEALTH_FAILED;
+            }
+            if(_dropped && (ageMs(currentMillis, _droppedMs) < HEALTH_WINDOW_MS)) {
+                return HEALTH_DEGRADED;
+            }
+            return HEALTH_OK;
+        }
+        default: {
+            return HEALTH_OK;
+        }
+    }
+}
+
+/**
+ * Worst health of all subsystems
+ */
+HealthState HealthMonitor::overall(unsigned long currentMillis) const // IN : current time in milliseconds
+                                                                      // RET: overall health
+{
+    HealthState worst = HEALTH_OK;
+    for(int subsystem = 0; subsystem < NUMBER_OF_HEALTH_SUBSYSTEMS; subsystem += 1) {
+        const HealthState health = state((HealthSubsystem)subsystem, currentMillis);
+        if(health > worst) {
+            worst = health;
+        }
+    }
+    return worst;
+}
+
+/**
+ * Write health as json, like
+ * {"status":"degraded","at":1234,
+ *  "camera":{"status":"ok","enabled":true,"streaming":true,"frames":100,"frameAgeMs":33},
+ *  "encoders":{"status":"ok","enabled":true,"leftSilentMs":0,"rightSilentMs":0},
+ *  "loop":{"status":"degraded","sinceMs":2,"overruns":3,"maxUs":41000},
+ *  "telemetry":{"status":"ok","backlog":0,"capacity":8,"dropped":0}}
+ */
+int HealthMonitor::formatHealth(
+    char *buffer,                           // OUT: json
+    int sizeOfBuffer,                       // IN : size of buffer in chars
+    unsigned long currentMillis) const      // IN : current time in milliseconds
+                                            // RET: offset of null terminator
+{
+    int offset = strCopy(buffer, sizeOfBuffer, "{");
+    offset = jsonStringAt(buffer, sizeOfBuffer, offset, "status", HealthStateStr[overall(currentMillis)]);
+    offset = strCopyAt(buffer, sizeOfBuffer, offset, ",");
+    offset = jsonULongAt(buffer, sizeOfBuffer, offset, "at", currentMillis);
+    offset = strCopyAt(buffer, sizeOfBuffer, offset, ",");
+
+    offset = jsonOpenObjectAt(buffer, sizeOfBuffer, offset, HealthSubsystemStr[HEALTH_CAMERA]);
+        offset = jsonStringAt(buffer, sizeOfBuffer, offset, "status", HealthStateStr[state(HEALTH_CAMERA, currentMillis)]);
+        offset = strCopyAt(buffer, sizeOfBuffer, offset, ",");
+        offset = jsonBoolAt(buffer, sizeOfBuffer, offset, "enabled", _inputs.cameraEnabled);
+        offset = strCopyAt(buffer, sizeOfBuffer, offset, ",");
+        offset = jsonBoolAt(buffer, sizeOfBuffer, offset, "streaming", _inputs.streaming);
+        offset = strCopyAt(buffer, sizeOfBuffer, offset, ",");
+        offset = jsonULongAt(buffer, sizeOfBuffer, offset, "frames", _inputs.framesCaptured);
+        offset = strCopyAt(buffer, sizeOfBuffer, offset, ",");
+        offset = jsonULongAt(buffer, sizeOfBuffer, offset, "frameAgeMs", ageMs(currentMillis, _frameMs));
+    offset = jsonCloseObjectAt(buffer, sizeOfBuffer, offset);
+    offset = strCopyAt(buffer, sizeOfBuffer, offset, ",");
+
+    offset = jsonOpenObjectAt(buffer, sizeOfBuffer, offset, HealthSubsystemStr[HEALTH_ENCODERS]);
+        offset = jsonStringAt(buffer, sizeOfBuffer, offset, "status", HealthStateStr[state(HEALTH_ENCODERS, currentMillis)]);
+        offset = strCopyAt(buffer, sizeOfBuffer, offset, ",");
+        offset = jsonBoolAt(buffer, sizeOfBuffer, offset, "enabled", _inputs.encodersEnabled);
+        offset = strCopyAt(buffer, sizeOfBuffer, offset, ",");
+        offset = jsonULongAt(buffer, sizeOfBuffer, offset, "leftSilentMs", _wheels[0].silentMs);
+        offset = strCopyAt(buffer, sizeOfBuffer, offset, ",");
+        offset = jsonULongAt(buffer, sizeOfBuffer, offset, "rightSilentMs", _wheels[1].silentMs);
+    offset = jsonCloseObjectAt(buffer, sizeOfBuffer, offset);
+    offset = strCopyAt(buffer, sizeOfBuffer, offset, ",");
+
+    offset = jsonOpenObjectAt(buffer, sizeOfBuffer, offset, HealthSubsystemStr[HEALTH_CONTROL_LOOP]);
+        offset = jsonStringAt(buffer, sizeOfBuffer, offset, "status", HealthStateStr[state(HEALTH_CONTROL_LOOP, currentMillis)]);
+        offset = strCopyAt(buffer, sizeOfBuffer, offset, ",");
+        offset = jsonULongAt(buffer, sizeOfBuffer, offset, "sinceMs", ageMs(currentMillis, _pollMs));
+        offset = strCopyAt(buffer, sizeOfBuffer, offset, ",");
+        offset = jsonULongAt(buffer, sizeOfBuffer, offset, "overruns", _inputs.loopOverruns);
+        offset = strCopyAt(buffer, sizeOfBuffer, offset, ",");
+        offset = jsonULongAt(buffer, sizeOfBuffer, offset, "maxUs", _inputs.maxLoopUs);
+    offset = jsonCloseObjectAt(buffer, sizeOfBuffer, offset);
+    offset = strCopyAt(buffer, sizeOfBuffer, offset, ",");
+
+    offset = jsonOpenObjectAt(buffer, sizeOfBuffer, offset, HealthSubsystemStr[HEALTH_TELEMETRY]);
+        offset = jsonStringAt(buffer, sizeOfBuffer, offset, "status", HealthStateStr[state(HEALTH_TELEMETRY, currentMillis)]);
+        offset = strCopyAt(buffer, sizeOfBuffer, offset, ",");
+        offset = jsonULongAt(buffer, sizeOfBuffer, offset, "backlog", _inputs.telemetryBacklog);
+        offset = strCopyAt(buffer, sizeOfBuffer, offset, ",");
+        offset = jsonULongAt(buffer, sizeOfBuffer, offset, "capacity", _inputs.telemetryCapacity);
+        offset = strCopyAt(buffer, sizeOfBuffer, offset, ",");
+        offset = jsonULongAt(buffer, sizeOfBuffer, offset, "dropped", _inputs.telemetryDropped);
+    offset = jsonCloseObjectAt(buffer, sizeOfBuffer, offset);
+
+    offset = strCopyAt(buffer, sizeOfBuffer, offset, "}");
+    return offset;
+}
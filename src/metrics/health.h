@@ -0,0 +1,115 @@
+#ifndef METRICS_HEALTH_H
+#define METRICS_HEALTH_H
+
+#include <stdint.h>
+
+typedef enum {
+    HEALTH_OK,
+    HEALTH_DEGRADED,    // working, but something needs a look
+    HEALTH_FAILED,      // not working
+    NUMBER_OF_HEALTH_STATES,    // SHOULD ALWAYS BE LAST
+} HealthState;
+
+extern const char *HealthStateStr[NUMBER_OF_HEALTH_STATES];
+
+typedef enum {
+    HEALTH_CAMERA,
+    HEALTH_ENCODERS,
+    HEALTH_CONTROL_LOOP,
+    HEALTH_TELEMETRY,
+    NUMBER_OF_HEALTH_SUBSYSTEMS,    // SHOULD ALWAYS BE LAST
+} HealthSubsystem;
+
+extern const char *HealthSubsystemStr[NUMBER_OF_HEALTH_SUBSYSTEMS];
+
+//
+// values read by the control loop each poll
+//
+typedef struct HealthInputs {
+    bool cameraEnabled;             // camera is compiled in
+    bool streaming;                 // a client is asking for frames
+    uint32_t framesCaptured;        // frames taken from the camera since boot
+    bool encodersEnabled;           // wheel encoders are compiled in
+    bool leftPowered;               // left motor pwm is above stall
+    bool rightPowered;              // right motor pwm is above stall
+    uint32_t leftTicks;             // left encoder ticks since boot
+    uint32_t rightTicks;            // right encoder ticks since boot
+    uint32_t loopOverruns;          // control loop overruns since boot
+    uint32_t maxLoopUs;             // longest control loop in the last second
+    unsigned int telemetryBacklog;  // telemetry messages waiting to be sent
+    unsigned int telemetryCapacity; // telemetry messages that can wait
+    uint32_t telemetryDropped;      // telemetry messages dropped since boot
+} HealthInputs;
+
+/**
+ * Health of the rover's subsystems.
+ *
+ * The control loop calls poll() with counters it
+ * already keeps; the monitor only remembers when
+ * they last changed, so polling every loop is cheap.
+ * state() and formatHealth() take the caller's time,
+ * so a stuck control loop shows up as failed even
+ * though it has stopped calling poll().  Ages are
+ * clamped at zero, so a time read just before the
+ * last poll does not wrap around to a huge age.
+ *
+ * The monitor is a plain value; to read it from
+ * another task, publish a copy after each poll.
+ */
+class HealthMonitor {
+    private:
+    typedef struct WheelHealth {
+        uint32_t ticks;             // encoder ticks at last poll
+        unsigned long edgeMs;       // when ticks last changed, or power came on
+        unsigned long silentMs;     // powered without an edge for this long
+    } WheelHealth;
+
+    bool _started = false;
+    HealthInputs _inputs;
+    unsigned long _pollMs = 0;          // when poll() last ran
+    unsigned long _frameMs = 0;         // when a frame was last captured, or streaming started
+    unsigned long _overrunMs = 0;       // when loop overruns last increased
+    bool _overrun = false;              // true once there has been an overrun
+    unsigned long _droppedMs = 0;       // when telemetry drops last increased
+    bool _dropped = false;              // true once telemetry has been dropped
+    unsigned long _backlogFreeMs = 0;   // when telemetry buffers were last not full
+    WheelHealth _wheels[2];
+
+    void _pollWheel(WheelHealth &wheel, bool powered, uint32_t ticks, unsigned long currentMillis);
+
+    public:
+
+    /**
+     * Record the current counters
+     */
+    HealthMonitor& poll(
+        unsigned long currentMillis,    // IN : current time in milliseconds
+        const HealthInputs &inputs);    // IN : current counters
+                                        // RET: this instance
+
+    /**
+     * Health of one subsystem
+     */
+    HealthState state(
+        HealthSubsystem subsystem,              // IN : subsystem to check
+        unsigned long currentMillis) const;     // IN : current time in milliseconds
+                                                // RET: subsystem health
+
+    /**
+     * Worst health of all subsystems
+     */
+    HealthState overall(unsigned long currentMillis) const; // IN : current time in milliseconds
+                                                            // RET: overall health
+
+    /**
+     * Write health as json, like
+     * {"status":"ok","at":1234,"camera":{"status":"ok",...},...}
+     */
+    int formatHealth(
+        char *buffer,                           // OUT: json
+        int sizeOfBuffer,                       // IN : size of buffer in chars
+        unsigned long currentMillis) const;     // IN : current time in milliseconds
+                                                // RET: offset of null terminator
+};
+
+#endif // METRICS_HEALTH_H
@@ -0,0 +1,260 @@
+#include <string.h>
+#include "runtime_metrics.h"
+#include "../string/strcopy.h"
+
+/**
+ * Call once per loop iteration
+ */
+LoopStats& LoopStats::tick(unsigned long nowUs) // IN : current time in microseconds
+                                                // RET: this instance
+{
+    _iterations += 1;
+    if(!_started) {
+        _started = true;
+        _lastUs = nowUs;
+        _windowStartUs = nowUs;
+        return *this;
+    }
+
+    const uint32_t loopUs = (uint32_t)(nowUs - _lastUs);
+    _lastUs = nowUs;
+    _windowCount += 1;
+    if(loopUs > _windowMaxUs) {
+        _windowMaxUs = loopUs;
+    }
+    if(loopUs > _overrunUs) {
+        _overruns += 1;
+    }
+
+    const unsigned long windowUs = nowUs - _windowStartUs;
+    if(windowUs >= 1000000UL) {
+        _rate = (float)_windowCount * 1000000.0f / (float)windowUs;
+        _maxUs = _windowMaxUs;
+        _windowStartUs = nowUs;
+        _windowCount = 0;
+        _windowMaxUs = 0;
+    }
+    return *this;
+}
+
+//
+// metric families in the order they are written
+//
+typedef enum {
+    METRIC_UPTIME,
+    METRIC_LOOP_RATE,
+    METRIC_LOOP_MAX,
+    METRIC_LOOP_OVERRUNS,
+    METRIC_HEAP_FREE,
+    METRIC_HEAP_MIN_FREE,
+    METRIC_HEAP_LARGEST_BLOCK,
+    METRIC_PSRAM_SIZE,
+    METRIC_PSRAM_FREE,
+    METRIC_FRAMES,
+    METRIC_TELEMETRY_DROPPED,
+    METRIC_COMMAND_QUEUE,
+    METRIC_WIFI_RSSI,
+    METRIC_WIFI_RECONNECTS,
+    METRIC_TASK_STACK,
+    METRIC_COMMAND_LATENCY,
+    NUMBER_OF_METRIC_FAMILIES,  // SHOULD ALWAYS BE LAST
+} MetricFamily;
+
+typedef struct MetricFamilyInfo {
+    const char *name;
+    const char *type;
+    const char *help;
+} MetricFamilyInfo;
+
+static const MetricFamilyInfo MetricFamilies[NUMBER_OF_METRIC_FAMILIES] = {
+    {"rover_uptime_ms", "counter", "Time since boot in milliseconds"},
+    {"rover_loop_rate_hz", "gauge", "Main loop iterations per second"},
+    {"rover_loop_max_us", "gauge", "Longest main loop iteration in the last second"},
+    {"rover_loop_overruns_total", "counter", "Main loop iterations long enough to miss a control poll"},
+    {"rover_heap_free_bytes", "gauge", "Free heap"},
+    {"rover_heap_min_free_bytes", "gauge", "Lowest free heap since boot"},
+    {"rover_heap_largest_free_block_bytes", "gauge", "Largest heap block that can be allocated"},
+    {"rover_psram_size_bytes", "gauge", "PSRAM size"},
+    {"rover_psram_free_bytes", "gauge", "Free PSRAM"},
+    {"rover_camera_frames_total", "counter", "Camera frames by result"},
+    {"rover_telemetry_dropped_total", "counter", "Telemetry messages dropped because the buffer was full"},
+    {"rover_command_queue_depth", "gauge", "Commands waiting by queue"},
+    {"rover_wifi_rssi_dbm", "gauge", "Wifi signal strength"},
+    {"rover_wifi_reconnects_total", "counter", "Wifi reconnections after an outage"},
+    {"rover_task_stack_free_bytes", "gauge", "Least free stack seen by task"},
+    {"rover_command_latency_us", "histogram", "Movement command latency by stage in microseconds"},
+};
+
+static const char *FrameResultStr[] = {"captured", "sent", "dropped"};
+static const char *CommandQueueStr[] = {"config", "schedule"};
+
+/**
+ * Write "name{label="value"} " ready for the sample value
+ */
+static int formatSampleName(
+    char *buffer,               // OUT: metrics text
+    int sizeOfBuffer,           // IN : size of buffer in chars
+    const char *name,           // IN : metric name
+    const char *label,          // IN : label name, or nullptr for no label
+    const char *labelValue)     // IN : label value
+                                // RET: offset of null terminator
+{
+    int offset = strCopy(buffer, sizeOfBuffer, name);
+    if(nullptr != label) {
+        offset = strCopyAt(buffer, sizeOfBuffer, offset, "{");
+        offset = strCopyAt(buffer, sizeOfBuffer, offset, label);
+        offset = strCopyAt(buffer, sizeOfBuffer, offset, "=\"");
+        offset = strCopyAt(buffer, sizeOfBuffer, offset, labelValue);
+        offset = strCopyAt(buffer, sizeOfBuffer, offset, "\"}");
+    }
+    return strCopyAt(buffer, sizeOfBuffer, offset, " ");
+}
+
+static int formatULongSample(char *buffer, int sizeOfBuffer, const char *name, const char *label, const char *labelValue, unsigned long value) {
+    int offset = formatSampleName(buffer, sizeOfBuffer, name, label, labelValue);
+    offset = strCopyULongAt(buffer, sizeOfBuffer, offset, value);
+    return strCopyAt(buffer, sizeOfBuffer, offset, "\n");
+}
+
+static int formatLongSample(char *buffer, int sizeOfBuffer, const char *name, long value) {
+    int offset = formatSampleName(buffer, sizeOfBuffer, name, nullptr, nullptr);
+    offset = strCopyLongAt(buffer, sizeOfBuffer, offset, value);
+    return strCopyAt(buffer, sizeOfBuffer, offset, "\n");
+}
+
+static int formatFloatSample(char *buffer, int sizeOfBuffer, const char *name, float value) {
+    int offset = formatSampleName(buffer, sizeOfBuffer, name, nullptr, nullptr);
+    offset = strCopyFloatAt(buffer, sizeOfBuffer, offset, value, 1);
+    return strCopyAt(buffer, sizeOfBuffer, offset, "\n");
+}
+
+MetricsWriter::MetricsWriter(
+    const RuntimeMetrics &metrics)      // IN : values to write
+    : _metrics(metrics)
+{
+    if(_metrics.taskCount > METRICS_MAX_TASKS) {
+        _metrics.taskCount = METRICS_MAX_TASKS;
+    }
+    _text[0] = '\0';
+}
+
+/**
+ * Number of sample lines in a family
+ */
+unsigned int MetricsWriter::_samples(unsigned int family) const {
+    switch(family) {
+        case METRIC_FRAMES: return sizeof(FrameResultStr) / sizeof(FrameResultStr[0]);
+        case METRIC_COMMAND_QUEUE: return sizeof(CommandQueueStr) / sizeof(CommandQueueStr[0]);
+        case METRIC_TASK_STACK: return _metrics.taskCount;
+        case METRIC_COMMAND_LATENCY: return _metrics.hasLatency ? NUMBER_OF_LATENCY_STAGES * LATENCY_METRIC_LINES : 0;
+        default: return 1;
+    }
+}
+
+/**
+ * Format one line of a family; line 0 is HELP,
+ * line 1 is TYPE, then one line per sample.
+ */
+int MetricsWriter::_formatLine(
+    char *buffer,           // OUT: one line of metrics text
+    int sizeOfBuffer,       // IN : size of buffer in chars
+    unsigned int family,    // IN : MetricFamily
+    unsigned int line) const    // IN : line within family
+                                // RET: offset of null terminator
+{
+    const MetricFamilyInfo &info = MetricFamilies[family];
+    if(0 == line) {
+        int offset = strCopy(buffer, sizeOfBuffer, "# HELP ");
+        offset = strCopyAt(buffer, sizeOfBuffer, offset, info.name);
+        offset = strCopyAt(buffer, sizeOfBuffer, offset, " ");
+        offset = strCopyAt(buffer, sizeOfBuffer, offset, info.help);
+        return strCopyAt(buffer, sizeOfBuffer, offset, "\n");
+    }
+    if(1 == line) {
+        int offset = strCopy(buffer, sizeOfBuffer, "# TYPE ");
+        offset = strCopyAt(buffer, sizeOfBuffer, offset, info.name);
+        offset = strCopyAt(buffer, sizeOfBuffer, offset, " ");
+        offset = strCopyAt(buffer, sizeOfBuffer, offset, info.type);
+        return strCopyAt(buffer, sizeOfBuffer, offset, "\n");
+    }
+
+    const unsigned int sample = line - 2;
+    switch(family) {
+        case METRIC_UPTIME: return formatULongSample(buffer, sizeOfBuffer, info.name, nullptr, nullptr, _metrics.uptimeMs);
+        case METRIC_LOOP_RATE: return formatFloatSample(buffer, sizeOfBuffer, info.name, _metrics.loopRate);
+        case METRIC_LOOP_MAX: return formatULongSample(buffer, sizeOfBuffer, info.name, nullptr, nullptr, _metrics.maxLoopUs);
+        case METRIC_LOOP_OVERRUNS: return formatULongSample(buffer, sizeOfBuffer, info.name, nullptr, nullptr, _metrics.loopOverruns);
+        case METRIC_HEAP_FREE: return formatULongSample(buffer, sizeOfBuffer, info.name, nullptr, nullptr, _metrics.freeHeap);
+        case METRIC_HEAP_MIN_FREE: return formatULongSample(buffer, sizeOfBuffer, info.name, nullptr, nullptr, _metrics.minFreeHeap);
+        case METRIC_HEAP_LARGEST_BLOCK: return formatULongSample(buffer, sizeOfBuffer, info.name, nullptr, nullptr, _metrics.largestFreeBlock);
+        case METRIC_PSRAM_SIZE: return formatULongSample(buffer, sizeOfBuffer, info.name, nullptr, nullptr, _metrics.psramSize);
+        case METRIC_PSRAM_FREE: return formatULongSample(buffer, sizeOfBuffer, info.name, nullptr, nullptr, _metrics.psramFree);
+        case METRIC_FRAMES: {
+            const uint32_t counts[] = {_metrics.frames.captured, _metrics.frames.sent, _metrics.frames.dropped};
+            return formatULongSample(buffer, sizeOfBuffer, info.name, "result", FrameResultStr[sample], counts[sample]);
+        }
+        case METRIC_TELEMETRY_DROPPED: return formatULongSample(buffer, sizeOfBuffer, info.name, nullptr, nullptr, _metrics.telemetryDropped);
+        case METRIC_COMMAND_QUEUE: {
+            const uint32_t depths[] = {_metrics.configQueueDepth, _metrics.scheduleQueueDepth};
+            return formatULongSample(buffer, sizeOfBuffer, info.name, "queue", CommandQueueStr[sample], depths[sample]);
+        }
+        case METRIC_WIFI_RSSI: return formatLongSample(buffer, sizeOfBuffer, info.name, _metrics.wifiRssi);
+        case METRIC_WIFI_RECONNECTS: return formatULongSample(buffer, sizeOfBuffer, info.name, nullptr, nullptr, _metrics.wifiReconnects);
+        case METRIC_TASK_STACK: {
+            const TaskStack &task = _metrics.tasks[sample];
+            return formatULongSample(buffer, sizeOfBuffer, info.name, "task", task.name, task.freeBytes);
+        }
+        case METRIC_COMMAND_LATENCY: {
+            const LatencyStage stage = (LatencyStage)(sample / LATENCY_METRIC_LINES);
+            return formatLatencyMetricLine(buffer, sizeOfBuffer, 0, _metrics.latency[stage], stage, sample % LATENCY_METRIC_LINES);
+        }
+        default: {
+            buffer[0] = '\0';
+            return 0;
+        }
+    }
+}
+
+/**
+ * Format the next line into the text buffer
+ */
+bool MetricsWriter::_nextLine() // RET: true if a line was formatted, false if done
+{
+    while(_family < NUMBER_OF_METRIC_FAMILIES) {
+        // families with no samples are left out entirely
+        const unsigned int samples = _samples(_family);
+        if((samples > 0) && (_line < 2 + samples)) {
+            _textLength = (unsigned int)_formatLine(_text, sizeof(_text), _family, _line);
+            _textOffset = 0;
+            _line += 1;
+            return true;
+        }
+        _family += 1;
+        _line = 0;
+    }
+    return false;
+}
+
+/**
+ * Copy the next part of the metrics text
+ */
+size_t MetricsWriter::read(
+    uint8_t *buffer,    // OUT: metrics text, not null terminated
+    size_t maxLength)   // IN : bytes available in buffer
+                        // RET: bytes written; 0 when all text has been read
+{
+    size_t written = 0;
+    while(written < maxLength) {
+        if((_textOffset >= _textLength) && !_nextLine()) {
+            break;
+        }
+        size_t length = _textLength - _textOffset;
+        if(length > maxLength - written) {
+            length = maxLength - written;
+        }
+        memcpy(buffer + written, _text + _textOffset, length);
+        _textOffset += length;
+        written += length;
+    }
+    return written;
+}
@@ -0,0 +1,121 @@
+#ifndef METRICS_RUNTIME_METRICS_H
+#define METRICS_RUNTIME_METRICS_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "../rover/command_latency.h"
+
+/**
+ * Count main loop iterations and keep the longest
+ * time between iterations, reported per one second
+ * window so a scrape sees recent behaviour.
+ */
+class LoopStats {
+    private:
+    uint32_t _overrunUs;                // loops longer than this are overruns
+    uint32_t _overruns = 0;             // overruns since start
+    bool _started = false;
+    unsigned long _lastUs = 0;          // time of last tick
+    unsigned long _windowStartUs = 0;   // start of current window
+    uint32_t _windowCount = 0;          // ticks in current window
+    uint32_t _windowMaxUs = 0;          // longest loop in current window
+    float _rate = 0;                    // loops per second in last full window
+    uint32_t _maxUs = 0;                // longest loop in last full window
+    uint32_t _iterations = 0;           // ticks since start
+
+    public:
+
+    LoopStats(uint32_t overrunUs)   // IN : loops longer than this are counted as overruns
+        : _overrunUs(overrunUs) {}
+
+    /**
+     * Call once per loop iteration
+     */
+    LoopStats& tick(unsigned long nowUs);   // IN : current time in microseconds
+                                            // RET: this instance
+
+    float rate() const { return _rate; }
+    uint32_t maxLoopUs() const { return _maxUs; }
+    uint32_t iterations() const { return _iterations; }
+    uint32_t overruns() const { return _overruns; }
+};
+
+//
+// frame counters kept by the camera stream socket
+//
+typedef struct FrameCounters {
+    uint32_t captured;  // frames taken from the camera
+    uint32_t sent;      // frames handed to the websocket
+    uint32_t dropped;   // frames captured but not sent
+} FrameCounters;
+
+typedef struct TaskStack {
+    const char *name;   // task name, like "loopTask"
+    uint32_t freeBytes; // least free stack seen; high-water mark
+} TaskStack;
+
+const unsigned int METRICS_MAX_TASKS = 4;
+
+//
+// values reported by /metrics, copied when the
+// request arrives so the response is consistent
+// however long it takes to send
+//
+typedef struct RuntimeMetrics {
+    uint32_t uptimeMs;
+    float loopRate;                 // loop iterations per second
+    uint32_t maxLoopUs;             // longest loop iteration
+    uint32_t loopOverruns;          // loops longer than LOOP_OVERRUN_US since boot
+    uint32_t freeHeap;
+    uint32_t minFreeHeap;           // lowest free heap since boot
+    uint32_t largestFreeBlock;      // largest allocation that can succeed
+    uint32_t psramSize;             // 0 if no psram
+    uint32_t psramFree;
+    FrameCounters frames;
+    uint32_t telemetryDropped;      // telemetry messages lost to a full buffer
+    uint32_t configQueueDepth;      // commands waiting in the config queue
+    uint32_t scheduleQueueDepth;    // commands waiting in the schedule queue
+    int32_t wifiRssi;               // dBm
+    uint32_t wifiReconnects;
+    TaskStack tasks[METRICS_MAX_TASKS];
+    unsigned int taskCount;
+    bool hasLatency;                // false to leave out the latency histograms
+    Log2Histogram latency[NUMBER_OF_LATENCY_STAGES];    // command latency by stage
+} RuntimeMetrics;
+
+/**
+ * Produce /metrics text in Prometheus format a line
+ * at a time, so it can be sent as a chunked response
+ * with no more buffer than the longest line.
+ */
+class MetricsWriter {
+    public:
+    static const unsigned int METRICS_LINE_BYTES = 128;
+
+    private:
+    RuntimeMetrics _metrics;
+    unsigned int _family = 0;           // metric family being written
+    unsigned int _line = 0;             // line within family; 0 is HELP, 1 is TYPE
+    char _text[METRICS_LINE_BYTES];     // formatted line not yet read
+    unsigned int _textLength = 0;
+    unsigned int _textOffset = 0;
+
+    unsigned int _samples(unsigned int family) const;
+    int _formatLine(char *buffer, int sizeOfBuffer, unsigned int family, unsigned int line) const;
+    bool _nextLine();
+
+    public:
+
+    MetricsWriter(
+        const RuntimeMetrics &metrics);     // IN : values to write
+
+    /**
+     * Copy the next part of the metrics text
+     */
+    size_t read(
+        uint8_t *buffer,    // OUT: metrics text, not null terminated
+        size_t maxLength);  // IN : bytes available in buffer
+                            // RET: bytes written; 0 when all text has been read
+};
+
+#endif // METRICS_RUNTIME_METRICS_H
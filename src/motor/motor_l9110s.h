@@ -1,6 +1,7 @@
 #ifndef MOTOR_MOTOR_L9110S_H
 #define MOTOR_MOTOR_L9110S_H
 
+#include <algorithm>
 #include "../gpio/pwm.h"
 
 /**
@@ -61,7 +62,7 @@ class MotorL9110s {
     MotorL9110s& setStallPwm(pwm_type pwm)  // IN : pwm below which motor will stall
                                             // RET: this motor
     {
-        this->_stall_pwm = max<pwm_type>(1, min<pwm_type>(pwm, maxPwm()));
+        this->_stall_pwm = std::max<pwm_type>(1, std::min<pwm_type>(pwm, maxPwm()));
         return *this;
     }
 
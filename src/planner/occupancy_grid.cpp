@@ -0,0 +1,122 @@
+#include <string.h>
+#include <math.h>
+#include "occupancy_grid.h"
+#include "../error.h"
+
+/**
+ * Resize the grid and clear all cells.
+ */
+int OccupancyGrid::reset(
+    grid_coord_type width,      // IN : columns in grid
+    grid_coord_type height,     // IN : rows in grid
+    distance_type cellSize,     // IN : size of a cell in world units (must be > 0)
+    distance_type originX,      // IN : world x of lower-left corner of grid
+    distance_type originY)      // IN : world y of lower-left corner of grid
+                                // RET: SUCCESS if grid fits in storage,
+                                //      FAILURE if not (grid is unchanged)
+{
+    if((cellSize <= 0) || (wordsFor(width, height) > _capacityWords)) {
+        return FAILURE;
+    }
+
+    _width = width;
+    _height = height;
+    _cellSize = cellSize;
+    _origin.x = originX;
+    _origin.y = originY;
+    memset(_bits, 0, wordsFor(width, height) * sizeof(grid_word_type));
+
+    return SUCCESS;
+}
+
+/**
+ * Load cell occupancy from a packed bit array;
+ * row-major, least significant bit first,
+ * one bit per cell.
+ */
+int OccupancyGrid::load(
+    const uint8_t *packed,      // IN : packed bits
+    unsigned int packedBytes)   // IN : number of bytes in packed;
+                                //      must be at least (cellCount() + 7) / 8
+                                // RET: SUCCESS or FAILURE if too few bytes
+{
+    const unsigned int words = wordsFor(_width, _height);
+    const unsigned int bytes = (cellCount() + 7) >> 3;
+    if((nullptr == packed) || (packedBytes < bytes)) {
+        return FAILURE;
+    }
+
+    //
+    // assemble words a byte at a time so this
+    // does not depend upon the host's byte order.
+    //
+    for(unsigned int w = 0; w < words; w += 1) {
+        grid_word_type word = 0;
+        for(unsigned int b = 0; b < sizeof(grid_word_type); b += 1) {
+            const unsigned int i = w * sizeof(grid_word_type) + b;
+            if(i < bytes) {
+                word |= (grid_word_type)packed[i] << (b * 8);
+            }
+        }
+        _bits[w] = word;
+    }
+
+    // clear any bits past the last cell
+    const unsigned int tail = cellCount() & (GRID_WORD_BITS - 1);
+    if((words > 0) && (0 != tail)) {
+        _bits[words - 1] &= ((grid_word_type)1 << tail) - 1;
+    }
+
+    return SUCCESS;
+}
+
+/**
+ * Mark a cell as occupied or free.
+ * Cells outside the grid are ignored.
+ */
+OccupancyGrid& OccupancyGrid::setOccupied(
+    int column,         // IN : column of cell
+    int row,            // IN : row of cell
+    bool isOccupied)    // IN : true to mark blocked, false to mark free
+                        // RET: this grid
+{
+    if(contains(column, row)) {
+        const grid_cell_type cell = (grid_cell_type)row * _width + column;
+        const grid_word_type mask = (grid_word_type)1 << (cell & (GRID_WORD_BITS - 1));
+        if(isOccupied) {
+            _bits[cell >> GRID_WORD_SHIFT] |= mask;
+        } else {
+            _bits[cell >> GRID_WORD_SHIFT] &= ~mask;
+        }
+    }
+    return *this;
+}
+
+/**
+ * Convert a world position to the cell that contains it
+ */
+bool OccupancyGrid::worldToCell(
+    distance_type x,    // IN : world horizontal position
+    distance_type y,    // IN : world vertical position
+    int &column,        // OUT: column of containing cell
+    int &row) const     // OUT: row of containing cell
+                        // RET: true if cell is in the grid
+{
+    column = (int)floorf((x - _origin.x) / _cellSize);
+    row = (int)floorf((y - _origin.y) / _cellSize);
+    return contains(column, row);
+}
+
+/**
+ * Get the world position of the center of a cell
+ */
+Point2D OccupancyGrid::cellToWorld(
+    int column,         // IN : column of cell
+    int row) const      // IN : row of cell
+                        // RET: world position of cell center
+{
+    return {
+        _origin.x + (column + (distance_type)0.5) * _cellSize,
+        _origin.y + (row + (distance_type)0.5) * _cellSize
+    };
+}
@@ -0,0 +1,145 @@
+#ifndef PLANNER_OCCUPANCY_GRID_H
+#define PLANNER_OCCUPANCY_GRID_H
+
+#include <stdint.h>
+#include "../rover/pose.h"
+
+typedef uint16_t grid_coord_type;   // column or row in the grid
+typedef uint32_t grid_cell_type;    // linear cell index; row * width + column
+typedef uint32_t grid_word_type;    // storage word holding 32 cells
+
+const unsigned int GRID_WORD_BITS = 32;
+const unsigned int GRID_WORD_SHIFT = 5;   // log2(GRID_WORD_BITS)
+
+/**
+ * A compact occupancy grid; one bit per cell,
+ * where a set bit means the cell is occupied (blocked).
+ *
+ * Cells are stored row-major; cell (0, 0) is the
+ * bottom-left cell and its lower-left corner is at
+ * the grid's origin in world coordinates.
+ *
+ * The grid does not allocate; it manages a word
+ * buffer provided by the caller, so the maximum
+ * size of the grid is fixed at compile time.
+ */
+class OccupancyGrid {
+    private:
+    grid_word_type *_bits;              // borrowed storage, 1 bit per cell
+    const unsigned int _capacityWords;  // number of words in _bits
+    grid_coord_type _width = 0;         // columns in grid
+    grid_coord_type _height = 0;        // rows in grid
+    distance_type _cellSize = 1;        // width and height of a cell in world units
+    Point2D _origin = {0, 0};           // world position of lower-left corner of cell (0, 0)
+
+    public:
+
+    /**
+     * Get number of storage words necessary to hold a grid
+     */
+    static unsigned int wordsFor(
+        unsigned int width,     // IN : columns in grid
+        unsigned int height)    // IN : rows in grid
+                                // RET: number of grid_word_type words for a width x height grid
+    {
+        return (width * height + GRID_WORD_BITS - 1) >> GRID_WORD_SHIFT;
+    }
+
+    /**
+     * Construct grid that manages the provided buffer.
+     * The grid starts out empty (zero width and height).
+     */
+    OccupancyGrid(
+        grid_word_type *borrowedBits,   // IN : storage - MUST exist for life of instance
+        unsigned int capacityWords)     // IN : number of words in storage
+        : _bits(borrowedBits), _capacityWords(capacityWords)
+    {
+        // no-op
+    }
+
+    grid_coord_type width() const { return _width; }
+    grid_coord_type height() const { return _height; }
+    grid_cell_type cellCount() const { return (grid_cell_type)_width * _height; }
+    distance_type cellSize() const { return _cellSize; }
+    Point2D origin() const { return _origin; }
+
+    /**
+     * Get the maximum number of cells the storage can hold
+     */
+    grid_cell_type capacity() const // RET: maximum cells
+    {
+        return _capacityWords * GRID_WORD_BITS;
+    }
+
+    /**
+     * Resize the grid and clear all cells.
+     */
+    int reset(
+        grid_coord_type width,      // IN : columns in grid
+        grid_coord_type height,     // IN : rows in grid
+        distance_type cellSize,     // IN : size of a cell in world units (must be > 0)
+        distance_type originX,      // IN : world x of lower-left corner of grid
+        distance_type originY);     // IN : world y of lower-left corner of grid
+                                    // RET: SUCCESS if grid fits in storage,
+                                    //      FAILURE if not (grid is unchanged)
+
+    /**
+     * Load cell occupancy from a packed bit array;
+     * row-major, least significant bit first,
+     * one bit per cell.
+     */
+    int load(
+        const uint8_t *packed,      // IN : packed bits
+        unsigned int packedBytes);  // IN : number of bytes in packed;
+                                    //      must be at least (cellCount() + 7) / 8
+                                    // RET: SUCCESS or FAILURE if too few bytes
+
+    /**
+     * Determine if a cell is within the grid
+     */
+    bool contains(int column, int row) const // RET: true if cell is in grid
+    {
+        return (column >= 0) && (row >= 0) && (column < _width) && (row < _height);
+    }
+
+    /**
+     * Determine if a cell is occupied.
+     * Cells outside the grid are considered occupied.
+     */
+    bool occupied(int column, int row) const // RET: true if blocked or out of bounds
+    {
+        if(!contains(column, row)) return true;
+        const grid_cell_type cell = (grid_cell_type)row * _width + column;
+        return 0 != (_bits[cell >> GRID_WORD_SHIFT] & ((grid_word_type)1 << (cell & (GRID_WORD_BITS - 1))));
+    }
+
+    /**
+     * Mark a cell as occupied or free.
+     * Cells outside the grid are ignored.
+     */
+    OccupancyGrid& setOccupied(
+        int column,         // IN : column of cell
+        int row,            // IN : row of cell
+        bool isOccupied);   // IN : true to mark blocked, false to mark free
+                            // RET: this grid
+
+    /**
+     * Convert a world position to the cell that contains it
+     */
+    bool worldToCell(
+        distance_type x,    // IN : world horizontal position
+        distance_type y,    // IN : world vertical position
+        int &column,        // OUT: column of containing cell
+        int &row) const;    // OUT: row of containing cell
+                            // RET: true if cell is in the grid
+
+    /**
+     * Get the world position of the center of a cell
+     */
+    Point2D cellToWorld(
+        int column,         // IN : column of cell
+        int row) const;     // IN : row of cell
+                            // RET: world position of cell center
+};
+
+#endif // PLANNER_OCCUPANCY_GRID_H
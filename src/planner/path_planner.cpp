@@ -0,0 +1,229 @@
+#include "path_planner.h"
+
+//
+// the 8 neighbor directions; orthogonal first then diagonal
+//
+static const int8_t DIRECTION_COLUMN[8] = { 1, 0, -1,  0,  1, -1, -1,  1 };
+static const int8_t DIRECTION_ROW[8]    = { 0, 1,  0, -1,  1,  1, -1, -1 };
+static const uint8_t DIRECTION_MASK = 0x0F;
+static const uint8_t NO_DIRECTION = 0x0F;   // cell has no parent
+static const uint8_t CLOSED_CELL = 0x80;    // cell has been expanded
+static const plan_cost_type UNVISITED_COST = 0xFFFFFFFF;
+
+/**
+ * Octile distance between two cells; an admissible
+ * heuristic on an 8-connected grid.
+ */
+static inline plan_cost_type octileDistance(int fromColumn, int fromRow, int toColumn, int toRow) {
+    const int dx = (fromColumn > toColumn) ? (fromColumn - toColumn) : (toColumn - fromColumn);
+    const int dy = (fromRow > toRow) ? (fromRow - toRow) : (toRow - fromRow);
+    return (dx > dy)
+        ? (PLAN_STRAIGHT_COST * dx + (PLAN_DIAGONAL_COST - PLAN_STRAIGHT_COST) * dy)
+        : (PLAN_STRAIGHT_COST * dy + (PLAN_DIAGONAL_COST - PLAN_STRAIGHT_COST) * dx);
+}
+
+/**
+ * Push an entry onto the open list
+ */
+bool PathPlanner::_push(
+    plan_cost_type f,       // IN : estimated total cost
+    grid_cell_type cell)    // IN : cell index
+                            // RET: true if pushed, false if heap is full
+{
+    if(_heapCount >= _heapCapacity) {
+        return false;
+    }
+
+    // sift up
+    unsigned int i = _heapCount++;
+    while(i > 0) {
+        const unsigned int parent = (i - 1) >> 1;
+        if(_heap[parent].f <= f) break;
+        _heap[i] = _heap[parent];
+        i = parent;
+    }
+    _heap[i].f = f;
+    _heap[i].cell = cell;
+    return true;
+}
+
+/**
+ * Remove the entry with the lowest cost from the open list.
+ * NOTE: caller must make sure heap is not empty.
+ */
+PlannerHeapEntry PathPlanner::_pop() // RET: entry with lowest f
+{
+    const PlannerHeapEntry top = _heap[0];
+    const PlannerHeapEntry last = _heap[--_heapCount];
+
+    // sift down
+    unsigned int i = 0;
+    for(;;) {
+        unsigned int child = (i << 1) + 1;
+        if(child >= _heapCount) break;
+        if((child + 1 < _heapCount) && (_heap[child + 1].f < _heap[child].f)) {
+            child += 1;
+        }
+        if(last.f <= _heap[child].f) break;
+        _heap[i] = _heap[child];
+        i = child;
+    }
+    if(_heapCount > 0) {
+        _heap[i] = last;
+    }
+
+    return top;
+}
+
+/**
+ * Plan a path between two world positions.
+ */
+PlanResult PathPlanner::plan(
+    const OccupancyGrid &grid,  // IN : map to plan on
+    Point2D start,              // IN : start position in world coordinates
+    Point2D goal,               // IN : goal position in world coordinates
+    Point2D *waypoints,         // OUT: on success, waypoints in world coordinates
+    unsigned int maxWaypoints)  // IN : capacity of waypoints
+                                // RET: status, waypoint count and cells expanded
+{
+    int startColumn, startRow, goalColumn, goalRow;
+    if(!grid.worldToCell(start.x, start.y, startColumn, startRow)
+        || !grid.worldToCell(goal.x, goal.y, goalColumn, goalRow))
+    {
+        return {PLAN_BAD_ENDPOINT, 0, 0};
+    }
+
+    PlanResult result = plan(grid, startColumn, startRow, goalColumn, goalRow, waypoints, maxWaypoints);
+
+    //
+    // the last waypoint is the center of the goal cell;
+    // replace it with the exact goal position.
+    //
+    if((PLAN_SUCCESS == result.status) && (result.waypoints > 0)) {
+        waypoints[result.waypoints - 1] = goal;
+    }
+    return result;
+}
+
+/**
+ * Plan a path between two cells.
+ */
+PlanResult PathPlanner::plan(
+    const OccupancyGrid &grid,  // IN : map to plan on
+    int startColumn,            // IN : start cell column
+    int startRow,               // IN : start cell row
+    int goalColumn,             // IN : goal cell column
+    int goalRow,                // IN : goal cell row
+    Point2D *waypoints,         // OUT: on success, waypoints in world coordinates
+    unsigned int maxWaypoints)  // IN : capacity of waypoints
+                                // RET: status, waypoint count and cells expanded
+{
+    const grid_cell_type cellCount = grid.cellCount();
+    if(cellCount > _cellCapacity) {
+        return {PLAN_NO_MEMORY, 0, 0};
+    }
+    if(grid.occupied(startColumn, startRow) || grid.occupied(goalColumn, goalRow)) {
+        return {PLAN_BAD_ENDPOINT, 0, 0};
+    }
+
+    const int width = grid.width();
+    const grid_cell_type startCell = (grid_cell_type)startRow * width + startColumn;
+    const grid_cell_type goalCell = (grid_cell_type)goalRow * width + goalColumn;
+
+    //
+    // 1. reset workspace
+    // 2. expand cells in order of lowest estimated total cost
+    //    until we expand the goal or run out of cells.
+    // 3. walk parents back from goal to output waypoints
+    //
+    for(grid_cell_type i = 0; i < cellCount; i += 1) {
+        _cost[i] = UNVISITED_COST;
+        _from[i] = NO_DIRECTION;
+    }
+    _heapCount = 0;
+
+    _cost[startCell] = 0;
+    _push(octileDistance(startColumn, startRow, goalColumn, goalRow), startCell);
+
+    unsigned int expanded = 0;
+    bool found = false;
+    while(_heapCount > 0) {
+        const PlannerHeapEntry entry = _pop();
+        const grid_cell_type cell = entry.cell;
+
+        //
+        // the open list may hold stale entries for a cell
+        // whose cost was later lowered; skip them.
+        //
+        if(_from[cell] & CLOSED_CELL) continue;
+        _from[cell] |= CLOSED_CELL;
+        expanded += 1;
+
+        if(cell == goalCell) {
+            found = true;
+            break;
+        }
+
+        const int column = (int)(cell % width);
+        const int row = (int)(cell / width);
+        const plan_cost_type cost = _cost[cell];
+        for(uint8_t d = 0; d < 8; d += 1) {
+            const int nextColumn = column + DIRECTION_COLUMN[d];
+            const int nextRow = row + DIRECTION_ROW[d];
+            if(grid.occupied(nextColumn, nextRow)) continue;
+
+            plan_cost_type stepCost = PLAN_STRAIGHT_COST;
+            if(d >= 4) {
+                // don't cut corners of occupied cells
+                if(grid.occupied(nextColumn, row) || grid.occupied(column, nextRow)) continue;
+                stepCost = PLAN_DIAGONAL_COST;
+            }
+
+            const grid_cell_type next = (grid_cell_type)nextRow * width + nextColumn;
+            if(_from[next] & CLOSED_CELL) continue;
+
+            const plan_cost_type nextCost = cost + stepCost;
+            if(nextCost < _cost[next]) {
+                _cost[next] = nextCost;
+                _from[next] = d;
+                if(!_push(nextCost + octileDistance(nextColumn, nextRow, goalColumn, goalRow), next)) {
+                    return {PLAN_NO_MEMORY, 0, expanded};
+                }
+            }
+        }
+    }
+
+    if(!found) {
+        return {PLAN_NO_PATH, 0, expanded};
+    }
+
+    //
+    // walk back from goal to start, outputting the goal
+    // and each cell where the path changes direction.
+    // Waypoints are written in reverse, then flipped.
+    //
+    unsigned int count = 0;
+    grid_cell_type cell = goalCell;
+    uint8_t nextDirection = NO_DIRECTION;
+    while(cell != startCell) {
+        const uint8_t direction = _from[cell] & DIRECTION_MASK;
+        if(direction != nextDirection) {
+            if(count >= maxWaypoints) {
+                return {PLAN_PATH_TOO_LONG, 0, expanded};
+            }
+            waypoints[count++] = grid.cellToWorld((int)(cell % width), (int)(cell / width));
+        }
+        nextDirection = direction;
+
+        const int column = (int)(cell % width) - DIRECTION_COLUMN[direction];
+        const int row = (int)(cell / width) - DIRECTION_ROW[direction];
+        cell = (grid_cell_type)row * width + column;
+    }
+    for(unsigned int i = 0, j = count; i + 1 < j; i += 1, j -= 1) {
+        const Point2D swap = waypoints[i];
+        waypoints[i] = waypoints[j - 1];
+        waypoints[j - 1] = swap;
+    }
+
+    return {PLAN_SUCCESS, count, expanded};
+}
@@ -0,0 +1,101 @@
+#ifndef PLANNER_PATH_PLANNER_H
+#define PLANNER_PATH_PLANNER_H
+
+#include "occupancy_grid.h"
+
+typedef uint32_t plan_cost_type;
+
+//
+// entry in the planner's open list
+//
+typedef struct PlannerHeapEntry {
+    plan_cost_type f;       // estimated total cost; cost so far + heuristic
+    grid_cell_type cell;    // cell index in the grid
+} PlannerHeapEntry;
+
+typedef enum {
+    PLAN_SUCCESS = 0,
+    PLAN_BAD_ENDPOINT,      // start or goal is outside grid or occupied
+    PLAN_NO_PATH,           // goal cannot be reached from start
+    PLAN_NO_MEMORY,         // grid is larger than the workspace or the open list overflowed
+    PLAN_PATH_TOO_LONG,     // path has more waypoints than the output buffer holds
+} PlanStatus;
+
+typedef struct PlanResult {
+    PlanStatus status;          // PLAN_SUCCESS or reason for failure
+    unsigned int waypoints;     // number of waypoints written to output
+    unsigned int expanded;      // number of cells expanded by the search
+} PlanResult;
+
+//
+// cost of moving to an adjacent cell
+//
+const plan_cost_type PLAN_STRAIGHT_COST = 10;
+const plan_cost_type PLAN_DIAGONAL_COST = 14;
+
+/**
+ * A* path planner over an 8-connected OccupancyGrid.
+ *
+ * The planner does no allocation; the caller provides
+ * the per-cell workspace and a fixed-size binary heap
+ * used as the open list.  Diagonal moves are not allowed
+ * to cut the corner of an occupied cell.
+ *
+ * The resulting path is returned as a list of waypoints
+ * in world coordinates (cell centers), excluding the start
+ * cell and including the goal cell.  Only the cells where
+ * the path changes direction are output, so a straight
+ * run of cells is a single waypoint.
+ */
+class PathPlanner {
+    private:
+    plan_cost_type *_cost;          // per cell cost from start
+    uint8_t *_from;                 // per cell direction to parent | closed flag
+    const unsigned int _cellCapacity;
+    PlannerHeapEntry *_heap;        // binary min-heap on f
+    const unsigned int _heapCapacity;
+    unsigned int _heapCount = 0;
+
+    bool _push(plan_cost_type f, grid_cell_type cell);
+    PlannerHeapEntry _pop();
+
+    public:
+
+    PathPlanner(
+        plan_cost_type *costBuffer,     // IN : per cell cost buffer - MUST exist for life of instance
+        uint8_t *fromBuffer,            // IN : per cell direction buffer - MUST exist for life of instance
+        unsigned int cellCapacity,      // IN : number of entries in costBuffer and fromBuffer
+        PlannerHeapEntry *heapBuffer,   // IN : open list storage - MUST exist for life of instance
+        unsigned int heapCapacity)      // IN : number of entries in heapBuffer
+        : _cost(costBuffer), _from(fromBuffer), _cellCapacity(cellCapacity),
+          _heap(heapBuffer), _heapCapacity(heapCapacity)
+    {
+        // no-op
+    }
+
+    /**
+     * Plan a path between two cells.
+     */
+    PlanResult plan(
+        const OccupancyGrid &grid,  // IN : map to plan on
+        int startColumn,            // IN : start cell column
+        int startRow,               // IN : start cell row
+        int goalColumn,             // IN : goal cell column
+        int goalRow,                // IN : goal cell row
+        Point2D *waypoints,         // OUT: on success, waypoints in world coordinates
+        unsigned int maxWaypoints); // IN : capacity of waypoints
+                                    // RET: status, waypoint count and cells expanded
+
+    /**
+     * Plan a path between two world positions.
+     */
+    PlanResult plan(
+        const OccupancyGrid &grid,  // IN : map to plan on
+        Point2D start,              // IN : start position in world coordinates
+        Point2D goal,               // IN : goal position in world coordinates
+        Point2D *waypoints,         // OUT: on success, waypoints in world coordinates
+        unsigned int maxWaypoints); // IN : capacity of waypoints
+                                    // RET: status, waypoint count and cells expanded
+};
+
+#endif // PLANNER_PATH_PLANNER_H
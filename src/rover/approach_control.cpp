@@ -0,0 +1,50 @@
+#include "approach_control.h"
+
+/**
+ * Calculate the velocity that drives the rover
+ * from its current pose towards a goal point.
+ */
+ApproachResult approachGoal(
+    const Pose2D &pose,             // IN : current position and heading of rover
+    const Point2D &goal,            // IN : goal position
+    const ApproachConfig &config)   // IN : controller tuning
+                                    // RET: distance, heading error and velocity
+{
+    const distance_type dx = goal.x - pose.x;
+    const distance_type dy = goal.y - pose.y;
+    const distance_type distance = SQRT(dx * dx + dy * dy);
+    const distance_type heading = limitAngle(ATAN2(dy, dx) - pose.angle);
+
+    if(distance <= config.arriveDistance) {
+        return {true, distance, heading, {0, 0}};
+    }
+
+    // turn rate proportional to heading error
+    const speed_type angular = bound<speed_type>(config.headingGain * heading, -config.maxAngular, config.maxAngular);
+
+    // decelerate linearly from max to min speed inside slowDistance
+    speed_type linear = config.maxSpeed;
+    if((distance < config.slowDistance) && (config.slowDistance > config.arriveDistance)) {
+        linear = map<speed_type>(distance, config.arriveDistance, config.slowDistance, config.minSpeed, config.maxSpeed);
+    }
+
+    // don't drive forward while the goal is off to the side or behind
+    const distance_type cosHeading = COS(heading);
+    linear = (cosHeading > 0) ? linear * cosHeading : 0;
+
+    //
+    // the circle we drive on has radius linear / angular;
+    // the circle tangent to our heading that passes through the
+    // goal has radius distance / (2 * sin(heading)).  If ours is 
+    // larger we would circle the goal, so slow down.
+    //
+    const distance_type sinHeading = ABS(SIN(heading));
+    if(sinHeading > 0) {
+        const speed_type orbitSpeed = ABS(angular) * distance / (2 * sinHeading);
+        if(linear > orbitSpeed) {
+            linear = orbitSpeed;
+        }
+    }
+
+    return {false, distance, heading, {linear, angular}};
+}
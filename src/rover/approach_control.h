@@ -0,0 +1,52 @@
+#ifndef APPROACH_CONTROL_H
+#define APPROACH_CONTROL_H
+
+#include "../config.h"
+#include "./pose.h"
+
+//
+// tuning for the approach controller
+//
+typedef struct ApproachConfig {
+    speed_type minSpeed;            // slowest useful forward speed (below this wheels stall)
+    speed_type maxSpeed;            // cruising forward speed far from goal
+    speed_type maxAngular;          // largest turn rate in radians per second
+    distance_type slowDistance;     // start slowing down within this distance of goal
+    distance_type arriveDistance;   // goal is achieved within this distance
+    float headingGain;              // turn rate per radian of heading error
+} ApproachConfig;
+
+typedef struct ApproachResult {
+    bool arrived;           // true if within arriveDistance of goal
+    distance_type distance; // distance to goal
+    distance_type heading;  // heading error to goal in radians, -PI to PI
+    Velocity2D velocity;    // if not arrived, linear and angular velocity to drive;
+                            // otherwise {0, 0}
+} ApproachResult;
+
+/**
+ * Calculate the velocity that drives the rover
+ * from its current pose towards a goal point.
+ *
+ * This is called on every pose update and recalculates
+ * from the current pose, so it corrects for drift
+ * without keeping any state, and it costs the same
+ * fixed amount of math each time.
+ *
+ * - turn rate is proportional to heading error, limited to maxAngular.
+ * - forward speed falls off linearly from maxSpeed at slowDistance
+ *   to minSpeed at arriveDistance, so the rover decelerates
+ *   into the goal rather than overshooting it.
+ * - forward speed is scaled by the cosine of the heading error,
+ *   so the rover turns in place when the goal is behind it.
+ * - forward speed is limited so the turning circle is
+ *   small enough to pass through the goal, so the
+ *   rover does not orbit a nearby goal.
+ */
+extern ApproachResult approachGoal(
+    const Pose2D &pose,             // IN : current position and heading of rover
+    const Point2D &goal,            // IN : goal position
+    const ApproachConfig &config);  // IN : controller tuning
+                                    // RET: distance, heading error and velocity
+
+#endif // APPROACH_CONTROL_H
@@ -0,0 +1,231 @@
+#include <string.h>
+#include "command_latency.h"
+#include "../string/strcopy.h"
+#include "../config.h"
+
+const char *LatencyStageStr[NUMBER_OF_LATENCY_STAGES] = {
+    "parse",
+    "queue",
+    "actuate",
+    "total",
+};
+
+/**
+ * Look up a stage by name
+ */
+LatencyStage latencyStageOf(
+    const char *name)   // IN : stage name, like "total"
+                        // RET: the stage or NUMBER_OF_LATENCY_STAGES if unknown
+{
+    if(nullptr != name) {
+        for(int stage = 0; stage < NUMBER_OF_LATENCY_STAGES; stage += 1) {
+            if(0 == strcmp(name, LatencyStageStr[stage])) {
+                return (LatencyStage)stage;
+            }
+        }
+    }
+    return NUMBER_OF_LATENCY_STAGES;
+}
+
+//
+// discard a pending measurement if no pwm write
+// follows the dequeue within this time; the command
+// did not change the motors (e.g. rover already stopped).
+//
+const unsigned long LATENCY_PENDING_LIMIT_US = 1000000UL;
+
+/**
+ * Deteremine if dependencies are attached
+ */
+bool CommandLatency::attached() // RET: true if attached, false if not
+{
+    return nullptr != _messageBus;
+}
+
+/**
+ * Attach dependencies
+ */
+CommandLatency& CommandLatency::attach(
+    MessageBus &messageBus) // IN : message bus to publish reports on
+                            // RET: this instance in attached state
+{
+    if(!attached()) {
+        _messageBus = &messageBus;
+    }
+    return *this;
+}
+
+/**
+ * Detach dependencies
+ */
+CommandLatency& CommandLatency::detach() // RET: this instance in detached state
+{
+    if(attached()) {
+        _messageBus = nullptr;
+    }
+    return *this;
+}
+
+/**
+ * Clear all histograms
+ */
+CommandLatency& CommandLatency::reset() // RET: this instance
+{
+    for(int i = 0; i < NUMBER_OF_LATENCY_STAGES; i += 1) {
+        _histograms[i].reset();
+    }
+    _pending = false;
+    _reportedCount = 0;
+    return *this;
+}
+
+/**
+ * The control loop took a movement command
+ */
+CommandLatency& CommandLatency::dequeued(
+    const CommandStamp &stamp,  // IN : stamps from receive and parse
+    unsigned long nowUs)        // IN : current time in microseconds
+                                // RET: this instance
+{
+    if(0 == stamp.receivedUs) {
+        // not from the websocket (e.g. a scheduled stop)
+        _pending = false;
+        return *this;
+    }
+
+    // unsigned subtraction is rollover safe
+    _histograms[LATENCY_PARSE].add(stamp.parsedUs - stamp.receivedUs);
+    _histograms[LATENCY_QUEUE].add(nowUs - stamp.parsedUs);
+
+    _stamp = stamp;
+    _dequeuedUs = nowUs;
+    _pending = true;
+    return *this;
+}
+
+/**
+ * A pwm value was written to a motor pin
+ */
+CommandLatency& CommandLatency::pwmWritten(
+    unsigned long nowUs)    // IN : current time in microseconds
+                            // RET: this instance
+{
+    if(_pending) {
+        _pending = false;
+        const unsigned long actuateUs = nowUs - _dequeuedUs;
+        if(actuateUs <= LATENCY_PENDING_LIMIT_US) {
+            _histograms[LATENCY_ACTUATE].add(actuateUs);
+            _histograms[LATENCY_TOTAL].add(nowUs - _stamp.receivedUs);
+        }
+    }
+    return *this;
+}
+
+/**
+ * Publish a report if there are new samples
+ * and the report interval has passed.
+ */
+CommandLatency& CommandLatency::poll(
+    unsigned long currentMillis)    // IN : current time in milliseconds
+                                    // RET: this instance
+{
+    if(attached() && (currentMillis - _lastReportMs >= LATENCY_REPORT_MS)) {
+        _lastReportMs = currentMillis;
+        const uint32_t count = _histograms[LATENCY_TOTAL].count();
+        if(count != _reportedCount) {
+            _reportedCount = count;
+
+            // one message per stage keeps each telemetry line small
+            for(int stage = 0; stage < NUMBER_OF_LATENCY_STAGES; stage += 1) {
+                _messageBus->publish(*this, COMMAND_LATENCY, ROVER_SPEC, LatencyStageStr[stage]);
+            }
+        }
+    }
+    return *this;
+}
+
+/**
+ * Write the Prometheus HELP and TYPE lines
+ * for the latency histograms.
+ */
+int formatLatencyMetricsHeader(
+    char *buffer,       // OUT: metrics text
+    int sizeOfBuffer,   // IN : size of buffer in chars
+    int offset)         // IN : offset in buffer to start writing
+                        // RET: offset of null terminator
+{
+    offset = strCopyAt(buffer, sizeOfBuffer, offset, "# HELP rover_command_latency_us Movement command latency by stage in microseconds\n");
+    offset = strCopyAt(buffer, sizeOfBuffer, offset, "# TYPE rover_command_latency_us histogram\n");
+    return offset;
+}
+
+/**
+ * Write one line of a stage's latency histogram
+ * in Prometheus text format; lines are the buckets,
+ * then sum, then count.
+ */
+int formatLatencyMetricLine(
+    char *buffer,                   // OUT: metrics text
+    int sizeOfBuffer,               // IN : size of buffer in chars
+    int offset,                     // IN : offset in buffer to start writing
+    const Log2Histogram &histogram, // IN : the stage's latency histogram
+    LatencyStage stage,             // IN : stage to write
+    unsigned int line)              // IN : 0 to LATENCY_METRIC_LINES - 1
+                                    // RET: offset of null terminator
+{
+    const char *name = LatencyStageStr[stage];
+
+    if(line < LOG2_HISTOGRAM_BUCKETS) {
+        // prometheus buckets are cumulative
+        unsigned long cumulative = 0;
+        for(unsigned int i = 0; i <= line; i += 1) {
+            cumulative += histogram.bucket(i);
+        }
+        offset = strCopyAt(buffer, sizeOfBuffer, offset, "rover_command_latency_us_bucket{stage=\"");
+        offset = strCopyAt(buffer, sizeOfBuffer, offset, name);
+        offset = strCopyAt(buffer, sizeOfBuffer, offset, "\",le=\"");
+        if(line + 1 < LOG2_HISTOGRAM_BUCKETS) {
+            offset = strCopyULongAt(buffer, sizeOfBuffer, offset, Log2Histogram::bucketBound(line));
+        } else {
+            // last bucket also holds everything larger
+            offset = strCopyAt(buffer, sizeOfBuffer, offset, "+Inf");
+        }
+        offset = strCopyAt(buffer, sizeOfBuffer, offset, "\"} ");
+        offset = strCopyULongAt(buffer, sizeOfBuffer, offset, cumulative);
+    } else if(line == LOG2_HISTOGRAM_BUCKETS) {
+        offset = strCopyAt(buffer, sizeOfBuffer, offset, "rover_command_latency_us_sum{stage=\"");
+        offset = strCopyAt(buffer, sizeOfBuffer, offset, name);
+        offset = strCopyAt(buffer, sizeOfBuffer, offset, "\"} ");
+        offset = strCopyULongAt(buffer, sizeOfBuffer, offset, (unsigned long)histogram.sum());
+    } else {
+        offset = strCopyAt(buffer, sizeOfBuffer, offset, "rover_command_latency_us_count{stage=\"");
+        offset = strCopyAt(buffer, sizeOfBuffer, offset, name);
+        offset = strCopyAt(buffer, sizeOfBuffer, offset, "\"} ");
+        offset = strCopyULongAt(buffer, sizeOfBuffer, offset, histogram.count());
+    }
+    offset = strCopyAt(buffer, sizeOfBuffer, offset, "\n");
+    return offset;
+}
+
+/**
+ * Write one stage's latency histogram in Prometheus text format, like
+ *
+ *   rover_command_latency_us_bucket{stage="total",le="1"} 0
+ *   ...
+ *   rover_command_latency_us_bucket{stage="total",le="+Inf"} 12
+ *   rover_command_latency_us_sum{stage="total"} 34567
+ *   rover_command_latency_us_count{stage="total"} 12
+ */
+int formatLatencyMetrics(
+    char *buffer,                   // OUT: metrics text
+    int sizeOfBuffer,               // IN : size of buffer in chars
+    int offset,                     // IN : offset in buffer to start writing
+    const CommandLatency &latency,  // IN : latency histograms
+    LatencyStage stage)             // IN : stage to write
+                                    // RET: offset of null terminator
+{
+    for(unsigned int line = 0; line < LATENCY_METRIC_LINES; line += 1) {
+        offset = formatLatencyMetricLine(buffer, sizeOfBuffer, offset, latency.histogram(stage), stage, line);
+    }
+    return offset;
+}
@@ -0,0 +1,156 @@
+#ifndef ROVER_COMMAND_LATENCY_H
+#define ROVER_COMMAND_LATENCY_H
+
+#include "../message_bus/message_bus.h"
+#include "../util/histogram.h"
+
+typedef enum {
+    LATENCY_PARSE,      // websocket receive to command parsed
+    LATENCY_QUEUE,      // parsed to dequeued by the control loop
+    LATENCY_ACTUATE,    // dequeued to pwm written to the motors
+    LATENCY_TOTAL,      // websocket receive to pwm written
+    NUMBER_OF_LATENCY_STAGES,   // SHOULD ALWAYS BE LAST
+} LatencyStage;
+
+extern const char *LatencyStageStr[NUMBER_OF_LATENCY_STAGES];
+
+/**
+ * Look up a stage by name
+ */
+extern LatencyStage latencyStageOf(
+    const char *name);  // IN : stage name, like "total"
+                        // RET: the stage or NUMBER_OF_LATENCY_STAGES if unknown
+
+//
+// timestamps that travel with a movement command, in microseconds
+//
+typedef struct CommandStamp {
+    CommandStamp(): receivedUs(0), parsedUs(0) {};
+    CommandStamp(unsigned long r, unsigned long p): receivedUs(r), parsedUs(p) {};
+
+    unsigned long receivedUs;   // when the websocket handler received it; 0 if unknown
+    unsigned long parsedUs;     // when submitCommand finished parsing it
+} CommandStamp;
+
+/**
+ * Measure how long movement commands take from
+ * websocket receive to the motors, by stage.
+ * Each stage is aggregated into a log2 histogram
+ * of microseconds.
+ *
+ * The control loop calls dequeued() when it takes
+ * a movement command and pwmWritten() from the pwm
+ * write hook; the first pwm write after a dequeue
+ * completes that command's measurement.
+ */
+class CommandLatency : public Publisher {
+    private:
+    MessageBus *_messageBus = nullptr;
+
+    Log2Histogram _histograms[NUMBER_OF_LATENCY_STAGES];
+    bool _pending = false;          // true if waiting for a pwm write
+    CommandStamp _stamp;            // stamps of pending command
+    unsigned long _dequeuedUs = 0;  // when pending command was dequeued
+    unsigned long _lastReportMs = 0;
+    uint32_t _reportedCount = 0;    // total count at last report
+
+    public:
+
+    CommandLatency(): Publisher(ROVER_SPEC) {}
+
+    ~CommandLatency() {
+        detach();
+    }
+
+    /**
+     * Deteremine if dependencies are attached
+     */
+    bool attached(); // RET: true if attached, false if not
+
+    /**
+     * Attach dependencies
+     */
+    CommandLatency& attach(
+        MessageBus &messageBus);    // IN : message bus to publish reports on
+                                    // RET: this instance in attached state
+
+    /**
+     * Detach dependencies
+     */
+    CommandLatency& detach(); // RET: this instance in detached state
+
+    /**
+     * Get the histogram for a stage
+     */
+    const Log2Histogram& histogram(LatencyStage stage) const { return _histograms[stage]; }
+
+    /**
+     * Clear all histograms
+     */
+    CommandLatency& reset(); // RET: this instance
+
+    /**
+     * The control loop took a movement command
+     */
+    CommandLatency& dequeued(
+        const CommandStamp &stamp,  // IN : stamps from receive and parse
+        unsigned long nowUs);       // IN : current time in microseconds
+                                    // RET: this instance
+
+    /**
+     * A pwm value was written to a motor pin
+     */
+    CommandLatency& pwmWritten(
+        unsigned long nowUs);   // IN : current time in microseconds
+                                // RET: this instance
+
+    /**
+     * Publish a report if there are new samples
+     * and the report interval has passed.
+     * A COMMAND_LATENCY message is published
+     * for each stage with the stage name as data.
+     */
+    CommandLatency& poll(
+        unsigned long currentMillis);   // IN : current time in milliseconds
+                                        // RET: this instance
+};
+
+/**
+ * Write the Prometheus HELP and TYPE lines
+ * for the latency histograms.
+ */
+extern int formatLatencyMetricsHeader(
+    char *buffer,       // OUT: metrics text
+    int sizeOfBuffer,   // IN : size of buffer in chars
+    int offset);        // IN : offset in buffer to start writing
+                        // RET: offset of null terminator
+
+// lines written per stage by formatLatencyMetricLine(); buckets, sum and count
+const unsigned int LATENCY_METRIC_LINES = LOG2_HISTOGRAM_BUCKETS + 2;
+
+/**
+ * Write one line of a stage's latency histogram
+ * in Prometheus text format; under 96 chars.
+ */
+extern int formatLatencyMetricLine(
+    char *buffer,                   // OUT: metrics text
+    int sizeOfBuffer,               // IN : size of buffer in chars
+    int offset,                     // IN : offset in buffer to start writing
+    const Log2Histogram &histogram, // IN : the stage's latency histogram
+    LatencyStage stage,             // IN : stage to write
+    unsigned int line);             // IN : 0 to LATENCY_METRIC_LINES - 1
+                                    // RET: offset of null terminator
+
+/**
+ * Write one stage's latency histogram in
+ * Prometheus text format; about 1500 chars.
+ */
+extern int formatLatencyMetrics(
+    char *buffer,                   // OUT: metrics text
+    int sizeOfBuffer,               // IN : size of buffer in chars
+    int offset,                     // IN : offset in buffer to start writing
+    const CommandLatency &latency,  // IN : latency histograms
+    LatencyStage stage);            // IN : stage to write
+                                    // RET: offset of null terminator
+
+#endif // ROVER_COMMAND_LATENCY_H
@@ -0,0 +1,141 @@
+#ifndef ROVER_COMMAND_SCHEDULER_H
+#define ROVER_COMMAND_SCHEDULER_H
+
+typedef enum {
+    SCHEDULE_NONE,      // nothing to do this tick
+    SCHEDULE_START,     // start the returned command
+    SCHEDULE_STOP,      // the running command's duration has ended
+} ScheduleEvent;
+
+/**
+ * Run commands at a given time on the control
+ * clock, optionally for a given duration.
+ * Commands are kept in start time order, so a sequence
+ * of timed commands runs back to back on the rover's
+ * clock regardless of when each one arrived.
+ *
+ * A command's end time is measured from its scheduled
+ * start, not from the tick it was noticed on, so timing
+ * error does not accumulate along a sequence.
+ *
+ * NOTE: this is not thread safe; call it only from the
+ *       control loop.
+ */
+template <class T, unsigned int N> class CommandScheduler {
+    private:
+    typedef struct Entry {
+        T value;
+        unsigned long atMs;         // start time on control clock
+        unsigned long durationMs;   // run time; 0 runs until replaced
+    } Entry;
+
+    Entry _entries[N];              // sorted by atMs
+    unsigned int _count = 0;
+    bool _running = false;          // true if a timed command is running
+    unsigned long _endMs = 0;       // if running, when it ends
+
+    //
+    // compare times on a clock that rolls over
+    //
+    static bool _reached(unsigned long currentMillis, unsigned long atMs) {
+        return (long)(currentMillis - atMs) >= 0;
+    }
+
+    public:
+
+    unsigned int capacity() const { return N; }
+    unsigned int count() const { return _count; }
+
+    /**
+     * Determine if a timed command is running
+     */
+    bool running() const { return _running; }
+
+    /**
+     * Determine if there is any scheduled or running command
+     */
+    bool busy() const { return _running || (_count > 0); }
+
+    /**
+     * Add a command to the schedule
+     */
+    bool schedule(
+        const T &value,             // IN : command to run
+        unsigned long atMs,         // IN : start time on control clock
+        unsigned long durationMs)   // IN : run time; 0 runs until replaced
+                                    // RET: true if scheduled, false if schedule is full
+    {
+        if(_count >= N) {
+            return false;
+        }
+
+        // insert after any entries at the same time so ties run in arrival order
+        unsigned int i = _count;
+        while((i > 0) && !_reached(atMs, _entries[i - 1].atMs)) {
+            _entries[i] = _entries[i - 1];
+            i -= 1;
+        }
+        _entries[i] = {value, atMs, durationMs};
+        _count += 1;
+        return true;
+    }
+
+    /**
+     * Remove all scheduled commands and forget
+     * the running one; the caller decides what
+     * to do with the wheels.
+     */
+    CommandScheduler& clear() // RET: this scheduler
+    {
+        _count = 0;
+        _running = false;
+        return *this;
+    }
+
+    /**
+     * Check the schedule against the clock
+     */
+    ScheduleEvent poll(
+        unsigned long currentMillis,    // IN : current time on control clock
+        T &value)                       // OUT: on SCHEDULE_START, the command to start
+                                        // RET: SCHEDULE_START if a command is due,
+                                        //      SCHEDULE_STOP if the running command ended,
+                                        //      otherwise SCHEDULE_NONE
+    {
+        //
+        // a due command replaces the running one; if several
+        // are due we have fallen behind, so skip to the newest.
+        //
+        if((_count > 0) && _reached(currentMillis, _entries[0].atMs)) {
+            unsigned int due = 1;
+            while((due < _count) && _reached(currentMillis, _entries[due].atMs)) {
+                due += 1;
+            }
+            const Entry entry = _entries[due - 1];
+            for(unsigned int i = due; i < _count; i += 1) {
+                _entries[i - due] = _entries[i];
+            }
+            _count -= due;
+
+            value = entry.value;
+            _running = (entry.durationMs > 0);
+            _endMs = entry.atMs + entry.durationMs;
+
+            // already over; it was due and ended between ticks
+            if(_running && _reached(currentMillis, _endMs)) {
+                _running = false;
+                return SCHEDULE_STOP;
+            }
+            return SCHEDULE_START;
+        }
+
+        if(_running && _reached(currentMillis, _endMs)) {
+            _running = false;
+            return SCHEDULE_STOP;
+        }
+
+        return SCHEDULE_NONE;
+    }
+};
+
+#endif // ROVER_COMMAND_SCHEDULER_H
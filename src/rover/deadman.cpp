@@ -0,0 +1,35 @@
+#include "deadman.h"
+
+/**
+ * Set the timeout
+ */
+DeadmanTimer& DeadmanTimer::setTimeout(
+    unsigned long timeoutMs)    // IN : timeout in milliseconds; 0 disables
+                                // RET: this timer
+{
+    _timeoutMs = timeoutMs;
+    return *this;
+}
+
+/**
+ * Reset the timer because the client is alive
+ */
+DeadmanTimer& DeadmanTimer::feed(
+    unsigned long currentMillis)    // IN : current time in milliseconds
+                                    // RET: this timer
+{
+    _lastFedMs = currentMillis;
+    return *this;
+}
+
+/**
+ * Determine if the timer has expired
+ */
+bool DeadmanTimer::expired(
+    unsigned long currentMillis) const  // IN : current time in milliseconds
+                                        // RET: true if enabled and not fed
+                                        //      within timeout, false otherwise
+{
+    // unsigned subtraction handles millis() rollover
+    return (_timeoutMs > 0) && ((currentMillis - _lastFedMs) >= _timeoutMs);
+}
@@ -0,0 +1,51 @@
+#ifndef ROVER_DEADMAN_H
+#define ROVER_DEADMAN_H
+
+/**
+ * Deadman timer for client commands.
+ * The client feeds the timer with each movement
+ * command or heartbeat; if the timer is not fed
+ * within the timeout, it expires.
+ *
+ * Time is passed in by the caller, so checking
+ * is constant time and does not touch the clock.
+ */
+class DeadmanTimer {
+    private:
+    unsigned long _timeoutMs;
+    unsigned long _lastFedMs = 0;
+
+    public:
+
+    DeadmanTimer(unsigned long timeoutMs) // IN : timeout in milliseconds; 0 disables
+        : _timeoutMs(timeoutMs)
+    {
+    }
+
+    unsigned long timeout() const { return _timeoutMs; }
+    unsigned long lastFed() const { return _lastFedMs; }
+
+    /**
+     * Set the timeout
+     */
+    DeadmanTimer& setTimeout(
+        unsigned long timeoutMs);   // IN : timeout in milliseconds; 0 disables
+                                    // RET: this timer
+
+    /**
+     * Reset the timer because the client is alive
+     */
+    DeadmanTimer& feed(
+        unsigned long currentMillis);   // IN : current time in milliseconds
+                                        // RET: this timer
+
+    /**
+     * Determine if the timer has expired
+     */
+    bool expired(
+        unsigned long currentMillis) const; // IN : current time in milliseconds
+                                            // RET: true if enabled and not fed
+                                            //      within timeout, false otherwise
+};
+
+#endif // ROVER_DEADMAN_H
@@ -1,4 +1,6 @@
+#include <assert.h>
 #include "./goto_goal.h"
+#include "../hal/clock.h"
 #include "../encoder/encoder.h"
 
 const char *GotoGoalStateStr[NUMBER_OF_GOTO_GOAL_STATES] = {
@@ -86,7 +88,7 @@ void GotoGoalBehavior::onMessage(
         case ROVER_POSE: {
             assert(&publisher == _rover);
             assert(specifier == ROVER_SPEC);
-            poll(millis());   // update behavior state
+            poll(halMillis());   // update behavior state
             break;
         }
         case WHEEL_HALT: {
@@ -100,6 +102,22 @@ void GotoGoalBehavior::onMessage(
     }
 }
 
+/**
+ * Propose the wheel command calculated
+ * on the most recent pose update
+ */
+bool GotoGoalBehavior::proposeCommand(
+    unsigned long currentMillis,    // IN : current time in milliseconds
+    WheelCommand &command)          // OUT: if running, the wheel command
+                                    // RET: true if running, false if not
+{
+    if(RUNNING == _state) {
+        command = _command;
+        return true;
+    }
+    return false;
+}
+
 /**
  * Start the behavior
  */
@@ -142,7 +160,7 @@ GotoGoalBehavior& GotoGoalBehavior::cancel() // RET: this behavior
 {
     stopListening();
     if(_state == RUNNING) {
-        gotoStop(millis());
+        gotoStop(halMillis());
         _state = NOT_RUNNING;
         _action = GOTO_NONE;
         _messageBus->publish(*this, GOTO_GOAL, BEHAVIOR_SPEC, GotoGoalStateStr[NOT_RUNNING]);
@@ -235,8 +253,7 @@ bool GotoGoalBehavior::gotoStop(
 {
     if(attached()) {
         if(RUNNING == _state) {
-            _rover->roverLeftWheel(false, true, 0);
-            _rover->roverRightWheel(false, true, 0);
+            _command = WheelCommand(false, 0, 0);
             return true;
         }
     }    
@@ -270,14 +287,12 @@ bool GotoGoalBehavior::gotoTurn(
                 //
                 // goal is on our left, turn left
                 //
-                _rover->roverLeftWheel(true, true, - desiredVelocity);
-                _rover->roverRightWheel(true, true, desiredVelocity);
+                _command = WheelCommand(true, - desiredVelocity, desiredVelocity);
             } else if(comparison < 0) {
                 //
                 // goal is on right, turn right
                 //
-                _rover->roverLeftWheel(true, true, desiredVelocity);
-                _rover->roverRightWheel(true, true, - desiredVelocity);
+                _command = WheelCommand(true, desiredVelocity, - desiredVelocity);
             } else {
                 //
                 // we are pointing toward the target, turn is complete
@@ -323,8 +338,7 @@ bool GotoGoalBehavior::gotoAngle(
             //
             // don't set velocities in the stall zone
             //
-            _rover->roverLeftWheel(true, leftVelocity > 0, ABS(leftVelocity));
-            _rover->roverRightWheel(true, rightVelocity > 0, ABS(rightVelocity));
+            _command = WheelCommand(true, leftVelocity, rightVelocity);
         }
     }    
     return false;
@@ -337,55 +351,36 @@ bool GotoGoalBehavior::gotoPoint(
 {
     if(attached()) {
         if(RUNNING == _state) {
-            const Pose2D pose = _rover->pose();
-
             //
             // 1. if we are near goal, we are done
-            // 2. otherwise turn towards the goal,
+            // 2. otherwise calculate velocities that steer towards
+            //    the goal and slow down as we approach it.
+            //
+            // NOTE: this is recalculated from the current pose on every
+            //       pose update, so it continually corrects its course.
             //
+            const speed_type minimumSpeed = _rover->minimumSpeed();
+            const speed_type speedSpan = _rover->maximumSpeed() - minimumSpeed;
 
             //
-            // calculate the minimum distance we can detect with encoders
-            // and use this as the radius of a circle around the goal
+            // use the minimum distance we can detect with encoders
+            // as the radius of a circle around the goal
             //
-            const distance_type minimumWheelDistance = ((WHEEL_CIRCUMFERENCE * (distance_type)POSE_MIN_ENCODER_COUNT) / PULSES_PER_REVOLUTION);
-            if(pointInCircle<distance_type>(pose.x, pose.y, _goal.x, _goal.y, minimumWheelDistance)) {
+            ApproachConfig config;
+            config.minSpeed = minimumSpeed;
+            config.maxSpeed = minimumSpeed + speedSpan * GOTO_CRUISE_FRACTION;
+            config.maxAngular = speedSpan / _rover->wheelBase();
+            config.slowDistance = GOTO_SLOW_DISTANCE;
+            config.arriveDistance = ((WHEEL_CIRCUMFERENCE * (distance_type)POSE_MIN_ENCODER_COUNT) / PULSES_PER_REVOLUTION);
+            config.headingGain = GOTO_HEADING_GAIN;
+
+            const ApproachResult approach = approachGoal(_rover->pose(), {_goal.x, _goal.y}, config);
+            if(approach.arrived) {
                 return true;
             }
 
-            // we should be pointing at the goal from where we are
-            const distance_type goalAngle = ATAN2(_goal.y - pose.y, _goal.x - pose.x);
-
-            // this is the difference between where we should point and where we are pointing
-            const distance_type errorAngle = limitAngle(goalAngle - pose.angle);
-
-            //
-            // if we are not within angle tolerance, then turn
-            //
-            const speed_type speedSpan = (_rover->maximumSpeed() - _rover->minimumSpeed()) * 0.25;
-            const speed_type desiredVelocity = _rover->minimumSpeed() + speedSpan;
-            const speed_type deltaVelocity = max<speed_type>(errorAngle / PI, 1) * speedSpan;
-            const int comparison = compareTo<speed_type>(errorAngle, 0, _angleTolerance);
-
-            if(comparison > 0) {
-                //
-                // goal is on our left, turn left
-                //
-                _rover->roverLeftWheel(true, true, desiredVelocity - deltaVelocity);
-                _rover->roverRightWheel(true, true, desiredVelocity + deltaVelocity);
-            } else if(comparison < 0) {
-                //
-                // goal is on right, turn right
-                //
-                _rover->roverLeftWheel(true, true, desiredVelocity + deltaVelocity);
-                _rover->roverRightWheel(true, true, desiredVelocity - deltaVelocity);
-            } else {
-                //
-                // we are pointing toward the target, go straight
-                //
-                _rover->roverLeftWheel(true, true, desiredVelocity);
-                _rover->roverRightWheel(true, true, desiredVelocity);
-            }
+            const WheelVelocities wheels = _rover->wheelVelocities(approach.velocity.linear, approach.velocity.angular);
+            _command = WheelCommand(true, wheels.left, wheels.right);
         }
     }    
     return false;
@@ -5,6 +5,8 @@
 #include "../rover/rover.h"
 #include "../message_bus/message_bus.h"
 #include "../rover/pose.h"
+#include "../rover/approach_control.h"
+#include "../behavior/behavior.h"
 
 
 typedef enum {
@@ -34,8 +36,13 @@ extern const char *GotoGoalStateStr[NUMBER_OF_GOTO_GOAL_STATES];
  * behaviors and avoids instabilities in the 
  * standard PID controller.  
  * See http://faculty.salina.k-state.edu/tim/robot_prog/MobileBot/Steering/pointFwd.html
+ *
+ * Wheel commands are calculated on each pose update
+ * and proposed to the BehaviorArbiter, which decides
+ * if they are sent to the wheels.  Path following 
+ * drives through this behavior, so it shares its priority.
  */
-class GotoGoalBehavior : public Publisher, public Subscriber {
+class GotoGoalBehavior : public Publisher, public Subscriber, public Behavior {
     private:
     // attached dependencies
     TwoWheelRover* _rover;
@@ -50,11 +57,12 @@ class GotoGoalBehavior : public Publisher, public Subscriber {
     distance_type _fractionForward;
     distance_type _goalTolerance = 0;
     distance_type _angleTolerance = 0;
+    WheelCommand _command;      // wheel command from most recent pose update
 
     public:
 
     GotoGoalBehavior()
-        :  Publisher(BEHAVIOR_SPEC), Subscriber()
+        :  Publisher(BEHAVIOR_SPEC), Subscriber(), Behavior(GOTO_PRIORITY)
     {
     }
 
@@ -108,6 +116,15 @@ class GotoGoalBehavior : public Publisher, public Subscriber {
         Specifier specifier,        // IN : specifier (like LEFT_WHEEL_SPEC)
         const char *data);          // IN : message data as a c-cstring
 
+    /**
+     * Propose the wheel command calculated
+     * on the most recent pose update
+     */
+    virtual bool proposeCommand(
+        unsigned long currentMillis,    // IN : current time in milliseconds
+        WheelCommand &command);         // OUT: if running, the wheel command
+                                        // RET: true if running, false if not
+
     /**
      * Start the behavior
      */
@@ -0,0 +1,69 @@
+#include "kinematics.h"
+
+/**
+ * Convert a body twist into wheel velocities
+ * for a differential drive rover.
+ */
+WheelVelocities twistToWheels(
+    speed_type linear,          // IN : forward velocity
+    speed_type angular,         // IN : counter-clockwise turn rate in radians per second
+    distance_type wheelBase)    // IN : distance between drive wheels
+                                // RET: left and right wheel velocities
+{
+    //
+    // each wheel travels on a circle around the
+    // instantaneous center of curvature that is
+    // half a wheelbase inside or outside of the
+    // circle traveled by the center of the rover.
+    //
+    const speed_type halfTurn = angular * wheelBase / 2;
+    return {linear - halfTurn, linear + halfTurn};
+}
+
+/**
+ * Convert wheel velocities back into a body twist
+ * for a differential drive rover.
+ */
+Velocity2D wheelsToTwist(
+    WheelVelocities wheels,     // IN : left and right wheel velocities
+    distance_type wheelBase)    // IN : distance between drive wheels
+                                // RET: linear and angular velocity
+{
+    return {(wheels.right + wheels.left) / 2, (wheels.right - wheels.left) / wheelBase};
+}
+
+/**
+ * Scale wheel velocities so they fall within the
+ * range the motors can actually drive, keeping the
+ * ratio between wheels, and so the curvature of the
+ * turn, the same.
+ */
+WheelVelocities limitWheels(
+    WheelVelocities wheels,     // IN : left and right wheel velocities
+    speed_type minSpeed,        // IN : calibrated speed below which a wheel stalls
+    speed_type maxSpeed)        // IN : calibrated maximum wheel speed
+                                // RET: scaled wheel velocities
+{
+    const speed_type leftSpeed = abs<speed_type>(wheels.left);
+    const speed_type rightSpeed = abs<speed_type>(wheels.right);
+    const speed_type fastest = (leftSpeed > rightSpeed) ? leftSpeed : rightSpeed;
+    const speed_type slowest = (leftSpeed > rightSpeed) ? rightSpeed : leftSpeed;
+
+    if((maxSpeed <= 0) || (0 == fastest)) {
+        return wheels;  // not calibrated or not moving
+    }
+
+    speed_type scale = 1;
+    if(fastest > maxSpeed) {
+        // slow down so faster wheel is at max
+        scale = maxSpeed / fastest;
+    } else if((slowest > 0) && (slowest < minSpeed) && (fastest * minSpeed / slowest <= maxSpeed)) {
+        // speed up so slower wheel is out of stall range
+        scale = minSpeed / slowest;
+    } else if(fastest < minSpeed) {
+        // speed up so at least the faster wheel is out of stall range
+        scale = minSpeed / fastest;
+    }
+
+    return {wheels.left * scale, wheels.right * scale};
+}
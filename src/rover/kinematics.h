@@ -0,0 +1,57 @@
+#ifndef KINEMATICS_H
+#define KINEMATICS_H
+
+#include "../config.h"
+#include "./pose.h"
+
+//
+// signed velocity of each drive wheel;
+// positive is forward, negative is reverse.
+//
+typedef struct WheelVelocities {
+    speed_type left;        // left wheel velocity in distance units per second
+    speed_type right;       // right wheel velocity in distance units per second
+} WheelVelocities;
+
+/**
+ * Convert a body twist into wheel velocities
+ * for a differential drive rover.
+ */
+extern WheelVelocities twistToWheels(
+    speed_type linear,          // IN : forward velocity
+    speed_type angular,         // IN : counter-clockwise turn rate in radians per second
+    distance_type wheelBase);   // IN : distance between drive wheels
+                                // RET: left and right wheel velocities
+
+/**
+ * Convert wheel velocities back into a body twist
+ * for a differential drive rover.
+ */
+extern Velocity2D wheelsToTwist(
+    WheelVelocities wheels,     // IN : left and right wheel velocities
+    distance_type wheelBase);   // IN : distance between drive wheels
+                                // RET: linear and angular velocity
+
+/**
+ * Scale wheel velocities so they fall within the
+ * range the motors can actually drive, keeping the
+ * ratio between wheels, and so the curvature of the
+ * turn, the same.
+ *
+ * - if the faster wheel exceeds maxSpeed, both wheels
+ *   are slowed so the faster wheel runs at maxSpeed.
+ * - if a moving wheel is below minSpeed (so it would stall)
+ *   both wheels are sped up so it runs at minSpeed, as
+ *   long as that does not push the faster wheel past maxSpeed.
+ *   If it would, the slower wheel is left in the stall range
+ *   and the speed controller handles it.
+ * - a maxSpeed of zero means the wheels are not calibrated
+ *   and velocities are returned unchanged.
+ */
+extern WheelVelocities limitWheels(
+    WheelVelocities wheels,     // IN : left and right wheel velocities
+    speed_type minSpeed,        // IN : calibrated speed below which a wheel stalls
+    speed_type maxSpeed);       // IN : calibrated maximum wheel speed
+                                // RET: scaled wheel velocities
+
+#endif // KINEMATICS_H
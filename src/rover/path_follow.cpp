@@ -0,0 +1,206 @@
+#include "./path_follow.h"
+
+const char *PathFollowStateStr[NUMBER_OF_PATH_FOLLOW_STATES] = {
+    "NOT_RUNNING",
+    "RUNNING",
+    "ACHIEVED",
+    "FAILED",
+};
+
+/**
+ * Deteremine if dependencies are attached
+ */
+bool PathFollowBehavior::attached() // RET: true if attached, false if not
+{
+    return (nullptr != _rover) && (nullptr != _messageBus);
+}
+
+/**
+ * Attach dependencies
+ */
+PathFollowBehavior& PathFollowBehavior::attach(
+    TwoWheelRover &rover,           // IN : rover to drive
+    GotoGoalBehavior &gotoGoal,     // IN : behavior used to drive to each waypoint
+    OccupancyGrid &grid,            // IN : map used for planning
+    PathPlanner &planner,           // IN : planner used to plan on the map
+    MessageBus &messageBus)         // IN : message bus to listen for goal updates
+                                    // RET: this behavior in attached state
+{
+    if(!attached()) {
+        _rover = &rover;
+        _gotoGoal = &gotoGoal;
+        _grid = &grid;
+        _planner = &planner;
+        _messageBus = &messageBus;
+        _messageBus->subscribe(*this, GOTO_GOAL);
+    }
+    return *this;
+}
+
+/**
+ * Detach dependencies
+ */
+PathFollowBehavior& PathFollowBehavior::detach() // RET: this behavior in detached state
+{
+    if(attached()) {
+        cancel();
+        _messageBus->unsubscribe(*this, GOTO_GOAL);
+        _rover = nullptr;
+        _gotoGoal = nullptr;
+        _grid = nullptr;
+        _planner = nullptr;
+        _messageBus = nullptr;
+    }
+    return *this;
+}
+
+/**
+ * Set state and publish it
+ */
+void PathFollowBehavior::_setState(PathFollowState state) {
+    _state = state;
+    _messageBus->publish(*this, PATH_FOLLOW, BEHAVIOR_SPEC, PathFollowStateStr[state]);
+}
+
+/**
+ * Start driving to the current waypoint
+ */
+void PathFollowBehavior::_gotoWaypoint() {
+    const Point2D waypoint = _waypoints[_waypointIndex];
+    _waypointAchieved = false;
+    _gotoGoal->gotoGoal(waypoint.x, waypoint.y, _pointForward, _tolerance);
+}
+
+/**
+ * Replace the map.  Any running path is cancelled
+ * because it was planned on the old map.
+ */
+int PathFollowBehavior::loadMap(
+    grid_coord_type width,      // IN : columns in map
+    grid_coord_type height,     // IN : rows in map
+    distance_type cellSize,     // IN : size of cell in world units
+    distance_type originX,      // IN : world x of lower-left corner of map
+    distance_type originY,      // IN : world y of lower-left corner of map
+    const uint8_t *packed,      // IN : packed occupancy bits, row-major, lsb first
+    unsigned int packedBytes)   // IN : number of bytes in packed
+                                // RET: SUCCESS or FAILURE if map does not fit
+{
+    if(!attached()) return FAILURE;
+
+    cancel();
+    if(SUCCESS != _grid->reset(width, height, cellSize, originX, originY)) {
+        return FAILURE;
+    }
+    return _grid->load(packed, packedBytes);
+}
+
+/**
+ * Plan a path from the rover's current position to the
+ * goal and start following it.
+ */
+PlanStatus PathFollowBehavior::followPath(
+    distance_type x,            // IN : goal's horizontal position in world coordinates
+    distance_type y,            // IN : goal's vertical position in world coordinates
+    distance_type pointForward, // IN : point forward as fraction of wheelbase
+    distance_type tolerance)    // IN : tolerance passed to goto goal
+                                // RET: PLAN_SUCCESS if path is being followed,
+                                //      otherwise reason planning failed.
+{
+    if(!attached()) return PLAN_BAD_ENDPOINT;
+
+    cancel();
+
+    const Pose2D pose = _rover->pose();
+    const PlanResult result = _planner->plan(*_grid, {pose.x, pose.y}, {x, y}, _waypoints, MAX_PATH_WAYPOINTS);
+    if(PLAN_SUCCESS != result.status) {
+        _waypointCount = 0;
+        _setState(PATH_FAILED);
+        _setState(PATH_NOT_RUNNING);
+        return result.status;
+    }
+
+    _waypointCount = result.waypoints;
+    _waypointIndex = 0;
+    _pointForward = pointForward;
+    _tolerance = tolerance;
+
+    if(0 == _waypointCount) {
+        // already in the goal cell
+        _setState(PATH_ACHIEVED);
+        _setState(PATH_NOT_RUNNING);
+    } else {
+        _setState(PATH_RUNNING);
+        _gotoWaypoint();
+    }
+
+    return PLAN_SUCCESS;
+}
+
+/**
+ * Cancel the behavior IF it is running
+ */
+PathFollowBehavior& PathFollowBehavior::cancel() // RET: this behavior
+{
+    if(PATH_RUNNING == _state) {
+        // set state first so the goto's NOT_RUNNING message is ignored
+        _state = PATH_NOT_RUNNING;
+        _gotoGoal->cancel();
+        _setState(PATH_NOT_RUNNING);
+    }
+    return *this;
+}
+
+/**
+ * Advance to the next waypoint when
+ * the current one has been achieved.
+ */
+PathFollowBehavior& PathFollowBehavior::poll(
+    unsigned long currentMillis) // IN : current time in milliseconds
+                                 // RET: this behavior
+{
+    //
+    // NOTE: we advance here rather than in onMessage() because
+    //       the goto behavior publishes ACHIEVED and then
+    //       publishes NOT_RUNNING; starting the next waypoint
+    //       between those messages would be overwritten.
+    //
+    if((PATH_RUNNING == _state) && _waypointAchieved && (NOT_RUNNING == _gotoGoal->state())) {
+        _waypointIndex += 1;
+        if(_waypointIndex < _waypointCount) {
+            _gotoWaypoint();
+        } else {
+            _setState(PATH_ACHIEVED);
+            _setState(PATH_NOT_RUNNING);
+        }
+    }
+    return *this;
+}
+
+/**
+ * Handle a subscribed message from a publisher
+ */
+void PathFollowBehavior::onMessage(
+    Publisher &publisher,       // IN : publisher of message
+    Message message,            // IN : message that was published
+    Specifier specifier,        // IN : specifier (like LEFT_WHEEL_SPEC)
+    const char *data)           // IN : message data as a c-cstring
+{
+    if((GOTO_GOAL == message) && (PATH_RUNNING == _state)) {
+        switch(_gotoGoal->state()) {
+            case ACHIEVED: {
+                _waypointAchieved = true;
+                break;
+            }
+            case NOT_RUNNING: {
+                if(!_waypointAchieved) {
+                    // goto was cancelled out from under us
+                    _setState(PATH_NOT_RUNNING);
+                }
+                break;
+            }
+            default: {
+                break;
+            }
+        }
+    }
+}
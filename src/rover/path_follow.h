@@ -0,0 +1,139 @@
+#ifndef PATH_FOLLOW_H
+#define PATH_FOLLOW_H
+
+#include "../config.h"
+#include "../rover/rover.h"
+#include "../rover/goto_goal.h"
+#include "../message_bus/message_bus.h"
+#include "../planner/occupancy_grid.h"
+#include "../planner/path_planner.h"
+
+const unsigned int MAX_PATH_WAYPOINTS = 32;   // maximum waypoints in a planned path
+
+typedef enum {
+    PATH_NOT_RUNNING,
+    PATH_RUNNING,
+    PATH_ACHIEVED,
+    PATH_FAILED,
+    NUMBER_OF_PATH_FOLLOW_STATES, // SHOULD ALWAYS BE LAST
+} PathFollowState;
+
+extern const char *PathFollowStateStr[NUMBER_OF_PATH_FOLLOW_STATES];
+
+/**
+ * Plan a path on the occupancy grid from the rover's
+ * current position to a goal, then follow it by
+ * driving to each waypoint in turn using
+ * the GotoGoalBehavior.
+ */
+class PathFollowBehavior : public Publisher, public Subscriber {
+    private:
+    // attached dependencies
+    TwoWheelRover *_rover = nullptr;
+    GotoGoalBehavior *_gotoGoal = nullptr;
+    OccupancyGrid *_grid = nullptr;
+    PathPlanner *_planner = nullptr;
+    MessageBus *_messageBus = nullptr;
+
+    Point2D _waypoints[MAX_PATH_WAYPOINTS];
+    unsigned int _waypointCount = 0;
+    unsigned int _waypointIndex = 0;    // waypoint we are driving to
+    bool _waypointAchieved = false;     // set when goto goal achieves current waypoint
+    distance_type _pointForward = 0;
+    distance_type _tolerance = 0;
+    PathFollowState _state = PATH_NOT_RUNNING;
+
+    /**
+     * Set state and publish it
+     */
+    void _setState(PathFollowState state);
+
+    /**
+     * Start driving to the current waypoint
+     */
+    void _gotoWaypoint();
+
+    public:
+
+    PathFollowBehavior()
+        :  Publisher(BEHAVIOR_SPEC), Subscriber()
+    {
+    }
+
+    ~PathFollowBehavior() {
+        detach();
+    }
+
+    PathFollowState state() { return _state; }
+    unsigned int waypointCount() { return _waypointCount; }
+    unsigned int waypointIndex() { return _waypointIndex; }
+
+    /**
+     * Deteremine if dependencies are attached
+     */
+    bool attached(); // RET: true if attached, false if not
+
+    /**
+     * Attach dependencies
+     */
+    PathFollowBehavior& attach(
+        TwoWheelRover &rover,           // IN : rover to drive
+        GotoGoalBehavior &gotoGoal,     // IN : behavior used to drive to each waypoint
+        OccupancyGrid &grid,            // IN : map used for planning
+        PathPlanner &planner,           // IN : planner used to plan on the map
+        MessageBus &messageBus);        // IN : message bus to listen for goal updates
+                                        // RET: this behavior in attached state
+
+    /**
+     * Detach dependencies
+     */
+    PathFollowBehavior& detach(); // RET: this behavior in detached state
+
+    /**
+     * Replace the map.  Any running path is cancelled
+     * because it was planned on the old map.
+     */
+    int loadMap(
+        grid_coord_type width,      // IN : columns in map
+        grid_coord_type height,     // IN : rows in map
+        distance_type cellSize,     // IN : size of cell in world units
+        distance_type originX,      // IN : world x of lower-left corner of map
+        distance_type originY,      // IN : world y of lower-left corner of map
+        const uint8_t *packed,      // IN : packed occupancy bits, row-major, lsb first
+        unsigned int packedBytes);  // IN : number of bytes in packed
+                                    // RET: SUCCESS or FAILURE if map does not fit
+
+    /**
+     * Plan a path from the rover's current position to the
+     * goal and start following it.
+     */
+    PlanStatus followPath(
+        distance_type x,            // IN : goal's horizontal position in world coordinates
+        distance_type y,            // IN : goal's vertical position in world coordinates
+        distance_type pointForward, // IN : point forward as fraction of wheelbase
+        distance_type tolerance);   // IN : tolerance passed to goto goal
+                                    // RET: PLAN_SUCCESS if path is being followed,
+                                    //      otherwise reason planning failed.
+
+    /**
+     * Cancel the behavior IF it is running
+     */
+    PathFollowBehavior& cancel(); // RET: this behavior
+
+    /**
+     * Advance to the next waypoint when
+     * the current one has been achieved.
+     */
+    PathFollowBehavior& poll(unsigned long currentMillis); // RET: this behavior
+
+    /**
+     * Handle a subscribed message from a publisher
+     */
+    void onMessage(
+        Publisher &publisher,       // IN : publisher of message
+        Message message,            // IN : message that was published
+        Specifier specifier,        // IN : specifier (like LEFT_WHEEL_SPEC)
+        const char *data);          // IN : message data as a c-cstring
+};
+
+#endif // PATH_FOLLOW_H
@@ -1,6 +1,7 @@
 #ifndef POSE_H
 #define POSE_H
 
+#include <math.h>
 #include "../util/math.h"
 
 //
@@ -1,5 +1,6 @@
-// #include <Arduino.h>
+#include <algorithm>
 #include "rover.h"
+#include "hal/clock.h"
 #include "rover_parse.h"
 #include "encoder/encoder.h"
 #include "string/strcopy.h"
@@ -102,13 +103,27 @@ TwoWheelRover& TwoWheelRover::setMotorStall(
     return *this;
 }
 
+/**
+ * Choose how both wheels estimate speed
+ * from encoder distance.
+ */
+TwoWheelRover& TwoWheelRover::setSpeedFilter(SpeedFilter filter) // IN : speed filter
+                                                                 // RET: this TwoWheelRover
+{
+    if(attached()) {
+        if(nullptr != _leftWheel) _leftWheel->setSpeedFilter(filter);
+        if(nullptr != _rightWheel) _rightWheel->setSpeedFilter(filter);
+    }
+    return *this;
+}
+
 /**
  * Get calibrated minimum forward speed for rover
  */
 speed_type TwoWheelRover::minimumSpeed() // RET: calibrated minimum speed
 {
     if(attached()) {
-        return max<distance_type>(_leftWheel->minimumSpeed(), _rightWheel->minimumSpeed());
+        return std::max<distance_type>(_leftWheel->minimumSpeed(), _rightWheel->minimumSpeed());
     }
     return 0;
 }
@@ -119,11 +134,42 @@ speed_type TwoWheelRover::minimumSpeed() // RET: calibrated minimum speed
 speed_type TwoWheelRover::maximumSpeed() // RET: calibrated maximum speed
 {
     if(attached()) {
-        return min<distance_type>(_leftWheel->maximumSpeed(), _rightWheel->maximumSpeed());
+        return std::min<distance_type>(_leftWheel->maximumSpeed(), _rightWheel->maximumSpeed());
     }
     return 0;
 }
 
+/**
+ * Drive wheels with the command chosen by the BehaviorArbiter
+ */
+void TwoWheelRover::driveWheels(
+    const WheelCommand &command)    // IN : signed speed or pwm for each wheel
+{
+    roverLeftWheel(command.useSpeedControl, command.left >= 0, abs<speed_type>(command.left));
+    roverRightWheel(command.useSpeedControl, command.right >= 0, abs<speed_type>(command.right));
+}
+
+/**
+ * Halt the wheels because no behavior is active
+ */
+void TwoWheelRover::stopWheels() {
+    roverHalt();
+}
+
+/**
+ * Calculate the wheel velocities that drive the rover
+ * at the given linear and angular velocity, limited
+ * to the calibrated speed range while keeping
+ * the curvature of the turn.
+ */
+WheelVelocities TwoWheelRover::wheelVelocities(
+    speed_type linear,      // IN : forward velocity
+    speed_type angular)     // IN : counter-clockwise turn rate in radians per second
+                            // RET: left and right wheel velocities
+{
+    return limitWheels(twistToWheels(linear, angular, _wheelBase), minimumSpeed(), maximumSpeed());
+}
+
 /**
  * Read left wheel encoder count.
  * This is a signed value the increases or decreases
@@ -262,10 +308,10 @@ TwoWheelRover& TwoWheelRover::_pollWheels(
                                    // RET: this rover
 {
     if(nullptr != _leftWheel) {
-        _leftWheel->poll(millis());
+        _leftWheel->poll(halMillis());
     }
     if(nullptr != _rightWheel) {
-        _rightWheel->poll(millis());
+        _rightWheel->poll(halMillis());
     }
 
     return *this;
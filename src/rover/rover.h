@@ -3,6 +3,8 @@
 
 #include "../wheel/drive_wheel.h"
 #include "./pose.h"
+#include "./kinematics.h"
+#include "../behavior/behavior.h"
 
 #include <stdint.h>
 
@@ -28,7 +30,7 @@ const WheelId ALL_WHEELS = LEFT_WHEEL | RIGHT_WHEEL;
 const WheelId NO_WHEELS = 0x00;
 
 
-class TwoWheelRover : public Publisher  {
+class TwoWheelRover : public Publisher, public WheelCommandSink  {
     private:
 
     // attached dependencies
@@ -149,6 +151,13 @@ class TwoWheelRover : public Publisher  {
                       //      (this is min-speed pwm)
                       // RET: this TwoWheelRovel
 
+    /**
+     * Choose how both wheels estimate speed
+     * from encoder distance.
+     */
+    TwoWheelRover& setSpeedFilter(SpeedFilter filter); // IN : speed filter
+                                                       // RET: this TwoWheelRover
+
     /**
      * Get calibrated minimum forward speed for rover
      */
@@ -159,6 +168,28 @@ class TwoWheelRover : public Publisher  {
      */
     speed_type maximumSpeed(); // RET: calibrated maximum speed
 
+    /**
+     * Drive wheels with the command chosen by the BehaviorArbiter
+     */
+    virtual void driveWheels(
+        const WheelCommand &command);   // IN : signed speed or pwm for each wheel
+
+    /**
+     * Halt the wheels because no behavior is active
+     */
+    virtual void stopWheels();
+
+    /**
+     * Calculate the wheel velocities that drive the rover
+     * at the given linear and angular velocity, limited
+     * to the calibrated speed range while keeping
+     * the curvature of the turn.
+     */
+    WheelVelocities wheelVelocities(
+        speed_type linear,      // IN : forward velocity
+        speed_type angular);    // IN : counter-clockwise turn rate in radians per second
+                                // RET: left and right wheel velocities
+
     /**
      * Read left wheel encoder count.
      * This is a signed value the increases or decreases
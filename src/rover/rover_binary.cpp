@@ -0,0 +1,124 @@
+#include <string.h>
+#include "rover_binary.h"
+
+/**
+ * Read a little-endian uint16 from a byte buffer
+ */
+static uint16_t readUint16(const uint8_t *bytes) {
+    return (uint16_t)bytes[0] | ((uint16_t)bytes[1] << 8);
+}
+
+/**
+ * Read a little-endian IEEE-754 float from a byte buffer
+ */
+static float readFloat32(const uint8_t *bytes) {
+    const uint32_t bits = (uint32_t)bytes[0]
+        | ((uint32_t)bytes[1] << 8)
+        | ((uint32_t)bytes[2] << 16)
+        | ((uint32_t)bytes[3] << 24);
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+/*
+** parse the opcode and id that start every binary frame
+*/
+ParseBinaryHeaderResult parseBinaryHeader(
+    const uint8_t *frame,       // IN : the binary frame
+    const unsigned int length)  // IN : number of bytes in frame
+                                // RET: scan result
+                                //      matched is true if completely matched, false otherwise
+                                //      if matched, index is the offset of the payload
+{
+    if((nullptr == frame) || (length < BINARY_HEADER_BYTES)) {
+        return {false, 0, 0, 0};
+    }
+    return {true, (int)BINARY_HEADER_BYTES, frame[0], readUint16(frame + 1)};
+}
+
+/*
+** parse a map payload
+*/
+ParseMapResult parseMapCommand(
+    const uint8_t *frame,       // IN : the binary frame
+    const unsigned int length,  // IN : number of bytes in frame
+    const int offset)           // IN : offset of map payload in frame
+                                // RET: scan result
+                                //      matched is true if completely matched, false otherwise
+                                //      if matched, index is the offset after the map,
+                                //      otherwise return the offset argument unchanged.
+{
+    static const unsigned int MAP_HEADER_BYTES = 2 + 2 + 4 + 4 + 4;
+
+    if((nullptr != frame) && (offset >= 0) && ((unsigned int)offset + MAP_HEADER_BYTES <= length)) {
+        const uint8_t *bytes = frame + offset;
+        MapCommand map;
+        map.width = readUint16(bytes);
+        map.height = readUint16(bytes + 2);
+        map.cellSize = readFloat32(bytes + 4);
+        map.originX = readFloat32(bytes + 8);
+        map.originY = readFloat32(bytes + 12);
+        map.packed = bytes + MAP_HEADER_BYTES;
+        map.packedBytes = length - offset - MAP_HEADER_BYTES;
+
+        // the packed bits must cover every cell
+        const unsigned int cells = (unsigned int)map.width * map.height;
+        if((map.cellSize > 0) && (map.packedBytes >= ((cells + 7) >> 3))) {
+            map.packedBytes = (cells + 7) >> 3;
+            return {true, (int)(offset + MAP_HEADER_BYTES + map.packedBytes), map};
+        }
+    }
+
+    // did not parse
+    return {false, offset, MapCommand()};
+}
+
+/*
+** parse a fence payload
+*/
+ParseFenceResult parseFenceCommand(
+    const uint8_t *frame,       // IN : the binary frame
+    const unsigned int length,  // IN : number of bytes in frame
+    const int offset)           // IN : offset of fence payload in frame
+                                // RET: scan result
+                                //      matched is true if completely matched, false otherwise
+                                //      if matched, index is the offset after the fence,
+                                //      otherwise return the offset argument unchanged.
+{
+    if((nullptr != frame) && (offset >= 0)) {
+        FenceCommand fence;
+        unsigned int index = (unsigned int)offset;
+
+        // mode, margin and vertex count
+        if(index + 1 + 4 + 1 > length) return {false, offset, FenceCommand()};
+        fence.mode = frame[index];
+        fence.margin = readFloat32(frame + index + 1);
+        fence.vertexCount = frame[index + 5];
+        index += 6;
+
+        if(fence.vertexCount > GEOFENCE_MAX_VERTICES) return {false, offset, FenceCommand()};
+        if(index + fence.vertexCount * 8 + 1 > length) return {false, offset, FenceCommand()};
+        for(unsigned int i = 0; i < fence.vertexCount; i += 1) {
+            fence.vertices[i].x = readFloat32(frame + index);
+            fence.vertices[i].y = readFloat32(frame + index + 4);
+            index += 8;
+        }
+
+        fence.keepOutCount = frame[index];
+        index += 1;
+        if(fence.keepOutCount > GEOFENCE_MAX_KEEPOUTS) return {false, offset, FenceCommand()};
+        if(index + fence.keepOutCount * 12 > length) return {false, offset, FenceCommand()};
+        for(unsigned int i = 0; i < fence.keepOutCount; i += 1) {
+            fence.keepOuts[i].center.x = readFloat32(frame + index);
+            fence.keepOuts[i].center.y = readFloat32(frame + index + 4);
+            fence.keepOuts[i].radius = readFloat32(frame + index + 8);
+            index += 12;
+        }
+
+        return {true, (int)index, fence};
+    }
+
+    // did not parse
+    return {false, offset, FenceCommand()};
+}
@@ -0,0 +1,84 @@
+#ifndef ROVER_BINARY_H
+#define ROVER_BINARY_H
+
+#include <stdint.h>
+#include "../config.h"
+#include "../behavior/geofence.h"
+
+//
+// Binary commands are sent as websocket binary frames
+// for payloads that are too large or awkward to send
+// as text commands, like a map.  All multi-byte
+// values are little-endian.
+//
+// frame: [opcode: uint8][id: uint16][payload...]
+//
+typedef enum {
+    BINARY_MAP = 'M',   // occupancy grid upload
+    BINARY_FENCE = 'F', // geofence upload
+    BINARY_SCRIPT = 'S',// command script upload
+} BinaryCommandType;
+
+const unsigned int BINARY_HEADER_BYTES = 3;   // opcode + id
+
+typedef struct ParseBinaryHeaderResult {
+    bool matched;       // true if fully matched, false if not
+    int index;          // if matched, index of first byte after header,
+                        // otherwise index of start of scan
+    uint8_t opcode;     // if matched, the command opcode
+    int id;             // if matched, unique id for this command instance
+} ParseBinaryHeaderResult;
+
+//
+// map payload: [width: uint16][height: uint16]
+//              [cellSize: float32][originX: float32][originY: float32]
+//              [packed occupancy bits: row-major, lsb first]
+//
+typedef struct MapCommand {
+    uint16_t width;             // columns in map
+    uint16_t height;            // rows in map
+    distance_type cellSize;     // size of a cell in world units
+    distance_type originX;      // world x of lower-left corner of map
+    distance_type originY;      // world y of lower-left corner of map
+    const uint8_t *packed;      // occupancy bits; points into the frame
+    unsigned int packedBytes;   // number of bytes in packed
+} MapCommand;
+
+typedef struct ParseMapResult {
+    bool matched;       // true if fully matched, false if not
+    int index;          // if matched, index of first byte after map,
+                        // otherwise index of start of scan
+    MapCommand value;   // if matched, the map command
+} ParseMapResult;
+
+//
+// fence payload: [mode: uint8][margin: float32]
+//                [vertexCount: uint8][vertices: vertexCount * (x: float32, y: float32)]
+//                [keepOutCount: uint8][keepOuts: keepOutCount * (x: float32, y: float32, radius: float32)]
+//
+typedef struct FenceCommand {
+    uint8_t mode;                   // GeofenceMode
+    distance_type margin;           // distance to keep from fences
+    uint8_t vertexCount;            // number of boundary vertices; 0 for no boundary
+    Point2D vertices[GEOFENCE_MAX_VERTICES];
+    uint8_t keepOutCount;           // number of keep-out circles
+    KeepOutCircle keepOuts[GEOFENCE_MAX_KEEPOUTS];
+} FenceCommand;
+
+typedef struct ParseFenceResult {
+    bool matched;       // true if fully matched, false if not
+    int index;          // if matched, index of first byte after fence,
+                        // otherwise index of start of scan
+    FenceCommand value; // if matched, the fence command
+} ParseFenceResult;
+
+//
+// script payload: [script text: utf-8, not null terminated]
+// see compileScript() in rover_script.h for the syntax
+//
+
+extern ParseBinaryHeaderResult parseBinaryHeader(const uint8_t *frame, const unsigned int length);
+extern ParseMapResult parseMapCommand(const uint8_t *frame, const unsigned int length, const int offset);
+extern ParseFenceResult parseFenceCommand(const uint8_t *frame, const unsigned int length, const int offset);
+
+#endif // ROVER_BINARY_H
@@ -1,5 +1,11 @@
+#include <string.h>
+#include <math.h>
 #include "./rover_command.h"
+#include "../hal/clock.h"
 #include "./rover_parse.h"
+#include "./rover_binary.h"
+#include "./rover_script.h"
+#include "../wifi/wifi_manager.h"
 
 // turtle commands
 typedef enum {
@@ -28,6 +34,16 @@ const char *CommandNames[] = {
     "pid",
     "stall",
     "resetPose",
+    "goto",
+    "path",
+    "twist",
+    "arc",
+    "deadman",
+    "runScript",
+    "stopScript",
+    "loadMap",
+    "loadFence",
+    "loadScript",
 };
 
 
@@ -42,13 +58,23 @@ bool RoverCommandProcessor::attached() {
  * Attach dependencies
  */
 RoverCommandProcessor& RoverCommandProcessor::attach(
-    TwoWheelRover &rover,               // IN : left drive wheel in attached state
-    GotoGoalBehavior &gotoGoalBehavior) // IN : right drive wheel in attached state
-                                        // RET: this behavior in attached state
+    TwoWheelRover &rover,                   // IN : left drive wheel in attached state
+    GotoGoalBehavior &gotoGoalBehavior,     // IN : right drive wheel in attached state
+    PathFollowBehavior &pathFollowBehavior, // IN : path follow behavior in attached state
+    GeofenceBehavior &geofenceBehavior,     // IN : geofence behavior in attached state
+    Settings &settings,                     // IN : settings that keep calibration across restarts
+    MessageBus &messageBus)                 // IN : message bus to publish deadman events
+                                            // RET: this behavior in attached state
 {
     if(!attached()) {
         _rover = &rover;
         _gotoGoalBehavior = &gotoGoalBehavior;
+        _pathFollowBehavior = &pathFollowBehavior;
+        _geofenceBehavior = &geofenceBehavior;
+        _settings = &settings;
+        _messageBus = &messageBus;
+        _latency.attach(messageBus);
+        subscribe(messageBus, WIFI_STATE);
     }
 
     return *this;
@@ -60,8 +86,19 @@ RoverCommandProcessor& RoverCommandProcessor::attach(
 RoverCommandProcessor& RoverCommandProcessor::detach() // RET: this behavior in detached state
 {
     if(attached()) {
+        if(nullptr != _messageBus) {
+            unsubscribe(*_messageBus, WIFI_STATE);
+        }
         _rover = nullptr;
         _gotoGoalBehavior = nullptr;
+        _pathFollowBehavior = nullptr;
+        _geofenceBehavior = nullptr;
+        _settings = nullptr;
+        _messageBus = nullptr;
+        _latency.detach();
+        _mapStaged.store(false, std::memory_order_release);
+        _fenceStaged.store(false, std::memory_order_release);
+        _scriptStaged.store(false, std::memory_order_release);
     }
 
     return *this;
@@ -69,11 +106,64 @@ RoverCommandProcessor& RoverCommandProcessor::detach() // RET: this behavior in
 
 
 
+/**
+ * Stop the rover and drop any movement
+ * not yet run, including movement scheduled with at(),
+ * the script and any goal.
+ */
+RoverCommandProcessor& RoverCommandProcessor::halt() // RET: this instance
+{
+    if(attached()) {
+        //
+        // the rover, behaviors, script and schedule are
+        // owned by the control loop, which may be on another
+        // task; count the halt so the loop stops them and
+        // drops scheduled movement from before it, and
+        // replace any movement not yet run with a stop.
+        //
+        _halts.fetch_add(1, std::memory_order_acq_rel);
+        setMovementCommand(TankCommand());
+    }
+    return *this;
+}
+
+/**
+ * Stop the rover, the script and any goal;
+ * run by the control loop when it sees a new halt
+ */
+void RoverCommandProcessor::_stopAll() {
+    _rover->roverHalt();
+    if(_script.running()) {
+        _script.stop();
+        _setScriptRunning(false, "STOPPED");
+    }
+    _scheduler.clear();
+    _teleopBehavior.cancel();
+    _pathFollowBehavior->cancel();
+    _gotoGoalBehavior->cancel();
+}
+
+/**
+ * Halt when wifi drops, since nobody can steer
+ */
+void RoverCommandProcessor::onMessage(
+    Publisher &publisher,       // IN : publisher of message
+    Message message,            // IN : message that was published
+    Specifier specifier,        // IN : specifier (like LEFT_WHEEL_SPEC)
+    const char *data)           // IN : message data as a c-cstring
+{
+    if((WIFI_STATE == message) && (nullptr != data)
+        && (0 == strcmp(data, WifiStateStr[WIFI_DISCONNECTED])))
+    {
+        halt();
+    }
+}
+
 /**
  * Add a command, as string parameters, to the command queue
  */
 int RoverCommandProcessor::submitTurtleCommand(
-    boolean useSpeedControl,    // IN : true if command is a speed command
+    bool useSpeedControl,       // IN : true if command is a speed command
                                 //      false if command is a pwm command
     const char *directionParam, // IN : direction as a string; "forward",
                                 //      "reverse", "left", "right", or "stop"
@@ -122,23 +212,23 @@ int RoverCommandProcessor::submitTurtleCommand(
         //
         if (0 == strcmp(directionParam, directionString[ROVER_STOP]))
         {
-            return enqueueRoverCommand({useSpeedControl, {true, 0}, {true, 0}}); 
+            return setMovementCommand({useSpeedControl, {true, 0}, {true, 0}}); 
         }
         else if (0 == strcmp(directionParam, directionString[ROVER_FORWARD]))
         {
-            return enqueueRoverCommand({useSpeedControl, {true, speed}, {true, speed}});
+            return setMovementCommand({useSpeedControl, {true, speed}, {true, speed}});
         }
         else if (0 == strcmp(directionParam, directionString[ROVER_RIGHT]))
         {
-            return enqueueRoverCommand({useSpeedControl, {true, speed}, {false, speed}});
+            return setMovementCommand({useSpeedControl, {true, speed}, {false, speed}});
         }
         else if (0 == strcmp(directionParam, directionString[ROVER_LEFT]))
         {
-            return enqueueRoverCommand({useSpeedControl, {false, speed}, {true, speed}});
+            return setMovementCommand({useSpeedControl, {false, speed}, {true, speed}});
         }
         else if (0 == strcmp(directionParam, directionString[ROVER_REVERSE]))
         {
-            return enqueueRoverCommand({useSpeedControl, {false, speed}, {false, speed}});
+            return setMovementCommand({useSpeedControl, {false, speed}, {false, speed}});
         }
     }
 
@@ -151,7 +241,9 @@ int RoverCommandProcessor::submitTurtleCommand(
 */
 SubmitCommandResult RoverCommandProcessor::submitCommand(
     const char *commandParam,   // IN : A wrapped tank command link cmd(tank(...))
-    const int offset)           // IN : offset of cmd() wrapper in command buffer
+    const int offset,           // IN : offset of cmd() wrapper in command buffer
+    unsigned long receivedUs)   // IN : micros() when command was received;
+                                //      0 to skip latency measurement
                                 // RET: struct with status, command id and command
                                 //      where status == SUCCESS or
                                 //      status == -1 on bad command (null or empty)
@@ -162,54 +254,69 @@ SubmitCommandResult RoverCommandProcessor::submitCommand(
     if((NULL != commandParam) && (offset >= 0)) {
         //
         // parse the command from the buffer
-        // like: tank(true, 128, false, 196)
+        // like: pwm(128, true, 196, false)
         //
         String command = String(commandParam);
         ParseCommandResult parsed = parseCommand(command, offset);
+        const CommandStamp stamp(receivedUs, (0 != receivedUs) ? halMicros() : 0);
         if(parsed.matched) {
             switch(parsed.command.type) {
                 case NOOP: {
+                    // heartbeat keeps the deadman from expiring
+                    _deadman.feed(halMillis());
                     return {SUCCESS, parsed.id, parsed.command};
                 }
                 case HALT: {
                     // execute halt immediately
-                    _rover->roverHalt();
-                    _gotoGoalBehavior->cancel();
+                    halt();
                     return {SUCCESS, parsed.id, parsed.command};
                 }
                 case TANK: {
-                    // queue up movement command
-                    TankCommand& tank = parsed.command.tank;
-                    if(SUCCESS == enqueueRoverCommand(tank)) {
+                    // newest movement command wins unless it is scheduled
+                    _deadman.feed(halMillis());
+                    if(SUCCESS == submitMovementCommand(parsed.command.tank, parsed.command.timing, stamp)) {
                         return {SUCCESS, parsed.id, parsed.command};
                     } else {
                         error = COMMAND_ENQUEUE_FAILURE;
                     }
                     break;
                 }
-                case PID: {
-                    // execute control command immediately
-                    PidCommand& pid = parsed.command.pid;
-                    _rover->setSpeedControl(pid.wheels, pid.minSpeed, pid.maxSpeed, pid.Kp, pid.Ki, pid.Kd);
-                    return {SUCCESS, parsed.id, parsed.command};
-                }
-                case STALL: {
-                    // execute control command immediately
-                    StallCommand stall = parsed.command.stall;
-                    _rover->setMotorStall(stall.leftStall, stall.rightStall);
-                    return {SUCCESS, parsed.id, parsed.command};
-                }
-                case RESET_POSE: {
-                    // execute reset pose immediately
-                    _rover->resetPose();
-                    return {SUCCESS, parsed.id, parsed.command};
+                case TWIST:
+                case ARC: {
+                    //
+                    // convert velocities to wheel speeds now, using
+                    // the current calibration, then queue up as a
+                    // speed controlled movement command.
+                    //
+                    TankCommand tank;
+                    if(SUCCESS != twistToTank(parsed.command.twist, tank)) {
+                        error = COMMAND_BAD_FAILURE;
+                        break;
+                    }
+                    _deadman.feed(halMillis());
+                    if(SUCCESS == submitMovementCommand(tank, parsed.command.timing, stamp)) {
+                        return {SUCCESS, parsed.id, parsed.command};
+                    } else {
+                        error = COMMAND_ENQUEUE_FAILURE;
+                    }
+                    break;
                 }
-                case GOTO: {
-                    if(_gotoGoalBehavior) {
-                        const GotoCommand go2 = parsed.command.go2;
-                        _gotoGoalBehavior->gotoGoal(go2.x, go2.y, go2.pointForward, go2.tolerance).poll(millis());
+                case PID:
+                case STALL:
+                case RESET_POSE:
+                case GOTO:
+                case DEADMAN:
+                case RUN_SCRIPT:
+                case STOP_SCRIPT:
+                case PATH: {
+                    // queue up configuration command to run in order;
+                    // a path is planned from the pose left by the commands before it
+                    if(SUCCESS == enqueueConfigCommand(parsed.command)) {
+                        return {SUCCESS, parsed.id, parsed.command};
+                    } else {
+                        error = COMMAND_ENQUEUE_FAILURE;
                     }
-                    return {SUCCESS, parsed.id, parsed.command};
+                    break;
                 }
                 default: {
                     error = COMMAND_PARSE_FAILURE;
@@ -224,49 +331,296 @@ SubmitCommandResult RoverCommandProcessor::submitCommand(
     return {error, 0, RoverCommand()};
 }
 
+/*
+** submit a binary command that was
+** sent in the websocket channel
+*/
+SubmitCommandResult RoverCommandProcessor::submitBinaryCommand(
+    const uint8_t *frame,       // IN : binary frame [opcode][id][payload]
+    const unsigned int length)  // IN : number of bytes in frame
+                                // RET: struct with status, command id and command
+                                //      where status == SUCCESS or
+                                //      status == -1 on bad command (null or too short)
+                                //      status == -2 on parse error
+                                //      status == -3 if command could not be applied
+{
+    const ParseBinaryHeaderResult header = parseBinaryHeader(frame, length);
+    if(!header.matched) {
+        return {COMMAND_BAD_FAILURE, 0, RoverCommand()};
+    }
+
+    switch(header.opcode) {
+        case BINARY_MAP: {
+            const ParseMapResult parsed = parseMapCommand(frame, length, header.index);
+            if(!parsed.matched) {
+                return {COMMAND_PARSE_FAILURE, header.id, RoverCommand()};
+            }
+
+            //
+            // the planner and path follower read the map in the
+            // control loop, so copy it to the staging slot and
+            // let the loop load it; one upload may wait at a time.
+            //
+            const MapCommand &map = parsed.value;
+            if((nullptr == _pathFollowBehavior)
+                || ((unsigned int)map.width * map.height > MAP_MAX_CELLS)
+                || (map.packedBytes > sizeof(_stagedMapBits))
+                || _mapStaged.load(std::memory_order_acquire))
+            {
+                return {COMMAND_ENQUEUE_FAILURE, header.id, RoverCommand()};
+            }
+            _stagedMap = map;
+            memcpy(_stagedMapBits, map.packed, map.packedBytes);
+            _stagedMap.packed = _stagedMapBits;
+            _mapStaged.store(true, std::memory_order_release);
+            if(SUCCESS != enqueueConfigCommand(RoverCommand(LOAD_MAP))) {
+                _mapStaged.store(false, std::memory_order_release);
+                return {COMMAND_ENQUEUE_FAILURE, header.id, RoverCommand()};
+            }
+            return {SUCCESS, header.id, RoverCommand()};
+        }
+        case BINARY_FENCE: {
+            const ParseFenceResult parsed = parseFenceCommand(frame, length, header.index);
+            if(!parsed.matched) {
+                return {COMMAND_PARSE_FAILURE, header.id, RoverCommand()};
+            }
+
+            // the arbiter checks the fence in the control loop, so stage it like a map
+            const FenceCommand &fence = parsed.value;
+            if((nullptr == _geofenceBehavior)
+                || (SUCCESS != GeofenceBehavior::validate((GeofenceMode)fence.mode, fence.margin,
+                    fence.vertices, fence.vertexCount, fence.keepOuts, fence.keepOutCount))
+                || _fenceStaged.load(std::memory_order_acquire))
+            {
+                return {COMMAND_ENQUEUE_FAILURE, header.id, RoverCommand()};
+            }
+            _stagedFence = fence;
+            _fenceStaged.store(true, std::memory_order_release);
+            if(SUCCESS != enqueueConfigCommand(RoverCommand(LOAD_FENCE))) {
+                _fenceStaged.store(false, std::memory_order_release);
+                return {COMMAND_ENQUEUE_FAILURE, header.id, RoverCommand()};
+            }
+            return {SUCCESS, header.id, RoverCommand()};
+        }
+        case BINARY_SCRIPT: {
+            //
+            // compile into the staging slot so a bad script
+            // leaves the loaded one alone.  The control loop
+            // runs the loaded script, so it copies the new one
+            // in when it drains the config queue, in order with
+            // any runScript() or stopScript() queued before it.
+            //
+            if((nullptr == _rover) || _scriptStaged.load(std::memory_order_acquire)) {
+                return {COMMAND_ENQUEUE_FAILURE, header.id, RoverCommand()};
+            }
+            ScriptWriter writer(_stagedScript, sizeof(_stagedScript));
+            const CompileScriptResult compiled = compileScript(
+                (const char *)(frame + header.index), length - header.index, *_rover, writer);
+            if(SUCCESS != compiled.status) {
+                return {COMMAND_PARSE_FAILURE, header.id, RoverCommand()};
+            }
+            _stagedScriptLength = writer.length();
+            _scriptStaged.store(true, std::memory_order_release);
+            if(SUCCESS != enqueueConfigCommand(RoverCommand(LOAD_SCRIPT))) {
+                _scriptStaged.store(false, std::memory_order_release);
+                return {COMMAND_ENQUEUE_FAILURE, header.id, RoverCommand()};
+            }
+            return {SUCCESS, header.id, RoverCommand()};
+        }
+        default: {
+            return {COMMAND_PARSE_FAILURE, header.id, RoverCommand()};
+        }
+    }
+}
+
 /**
- * Append a command to the command queue.
+ * Convert a linear and angular velocity to a speed
+ * controlled tank command, using the rover's current
+ * calibration to keep wheels within their speed range.
  */
-int RoverCommandProcessor::enqueueRoverCommand(
-    TankCommand command)    // IN : speed/direction for both wheels
-                            // RET: SUCCESS if command could be queued
-                            //      FAILURE if buffer is full.
+int RoverCommandProcessor::twistToTank(
+    const TwistCommand &twist,  // IN : linear and angular velocity
+    TankCommand &tank)          // OUT: on SUCCESS, speed/direction for both wheels
+                                //      otherwise unchanged.
+                                // RET: SUCCESS if converted
+                                //      COMMAND_BAD_FAILURE if rover is not attached
+                                //      or velocities are not finite
 {
-    //
-    // insert new command at head of circular buffer
-    // - if it would overlap tail, we can't fit it
-    //
-    uint8_t newCommandHead = (_commandHead + 1) % COMMAND_BUFFER_SIZE;
-    if (newCommandHead != _commandTail) {
-        _commandQueue[_commandHead] = command;
-        _commandHead = newCommandHead;
-        return SUCCESS;
+    if(!attached() || !isfinite(twist.linear) || !isfinite(twist.angular)) {
+        return COMMAND_BAD_FAILURE;
     }
-    return FAILURE;
+
+    const WheelVelocities wheels = _rover->wheelVelocities(twist.linear, twist.angular);
+    tank = TankCommand(true,
+        SpeedCommand(wheels.left >= 0, abs<speed_type>(wheels.left)),
+        SpeedCommand(wheels.right >= 0, abs<speed_type>(wheels.right)));
+    return SUCCESS;
+}
+
+/**
+ * Replace the pending movement command;
+ * an earlier one that has not run yet is dropped.
+ */
+int RoverCommandProcessor::setMovementCommand(
+    const TankCommand &command) // IN : speed/direction for both wheels
+                                // RET: SUCCESS; the newest command always fits
+{
+    _movementCommand.write(TimedTankCommand(command, CommandTiming()));
+    return SUCCESS;
+}
+
+/**
+ * Submit a movement command with optional timing.
+ * Commands with a start time are queued so every one
+ * runs; others replace the pending movement command.
+ */
+int RoverCommandProcessor::submitMovementCommand(
+    const TankCommand &command,     // IN : speed/direction for both wheels
+    const CommandTiming &timing,    // IN : optional start time and duration
+    const CommandStamp &stamp)      // IN : receive/parse times
+                                    // RET: SUCCESS if command was accepted
+                                    //      FAILURE if schedule queue is full.
+{
+    if(timing.scheduled) {
+        // scheduled commands wait on purpose, so they are not measured
+        const unsigned int halts = _halts.load(std::memory_order_acquire);
+        return _scheduleQueue.push(TimedTankCommand(command, timing, halts)) ? SUCCESS : FAILURE;
+    }
+    _movementCommand.write(TimedTankCommand(command, timing, stamp));
+    return SUCCESS;
 }
 
 /**
- * Get the next command from the command queue.
+ * Take the pending movement command
  */
-int RoverCommandProcessor::dequeueRoverCommand(
-    TankCommand *command)   // OUT: on SUCCESS, speed/direction for both wheels
+int RoverCommandProcessor::takeMovementCommand(
+    TimedTankCommand *command)  // OUT: on SUCCESS, speed/direction for both wheels
                             //      otherwise unchanged.
-                            // RET: SUCCESS if buffer had a command to return 
-                            //      FAILURE if buffer is empty.
+                            // RET: SUCCESS if a new movement command was waiting
+                            //      FAILURE if there is no new movement command.
 {
-    //
-    // Read command from tail and increment tail index
-    //
-    if (_commandHead != _commandTail) {
-        *command = _commandQueue[_commandTail];
-        _commandTail = (_commandTail + 1) % COMMAND_BUFFER_SIZE;
-        return SUCCESS;
+    return _movementCommand.take(*command) ? SUCCESS : FAILURE;
+}
+
+/**
+ * Append a configuration command to the config queue.
+ */
+int RoverCommandProcessor::enqueueConfigCommand(
+    const RoverCommand &command)    // IN : pid, stall, resetPose, goto, path, deadman,
+                                    //      runScript or stopScript command
+                                    // RET: SUCCESS if command could be queued
+                                    //      FAILURE if queue is full.
+{
+    return _configQueue.push(command) ? SUCCESS : FAILURE;
+}
+
+/**
+ * Execute a configuration command
+ */
+int RoverCommandProcessor::executeConfigCommand(
+    const RoverCommand &command,    // IN : pid, stall, resetPose, goto, path, deadman,
+                                    //      runScript or stopScript command
+    unsigned long currentMillis)    // IN : milliseconds since startup
+                                    // RET: SUCCESS if command executed
+                                    //      FAILURE if command could not execute
+                                    //      or a path could not be planned
+{
+    if (!attached())
+        return FAILURE;
+
+    switch(command.type) {
+        case PID: {
+            const PidCommand& pid = command.pid;
+            _rover->setSpeedControl(pid.wheels, pid.minSpeed, pid.maxSpeed, pid.Kp, pid.Ki, pid.Kd);
+            if(nullptr != _settings) {
+                _settings->setSpeedControl(pid.wheels, pid.minSpeed, pid.maxSpeed, pid.Kp, pid.Ki, pid.Kd, currentMillis);
+            }
+            return SUCCESS;
+        }
+        case STALL: {
+            const StallCommand& stall = command.stall;
+            _rover->setMotorStall(stall.leftStall, stall.rightStall);
+            if(nullptr != _settings) {
+                _settings->setStall(stall.leftStall, stall.rightStall, currentMillis);
+            }
+            return SUCCESS;
+        }
+        case RESET_POSE: {
+            _rover->resetPose();
+            return SUCCESS;
+        }
+        case GOTO: {
+            if(_gotoGoalBehavior) {
+                const GotoCommand& go2 = command.go2;
+                _gotoGoalBehavior->gotoGoal(go2.x, go2.y, go2.pointForward, go2.tolerance).poll(currentMillis);
+                return SUCCESS;
+            }
+            return FAILURE;
+        }
+        case PATH: {
+            // a plan failure is reported as path state FAILED
+            if(_pathFollowBehavior) {
+                const GotoCommand& path = command.go2;
+                if(PLAN_SUCCESS == _pathFollowBehavior->followPath(path.x, path.y, path.pointForward, path.tolerance)) {
+                    return SUCCESS;
+                }
+            }
+            return FAILURE;
+        }
+        case DEADMAN: {
+            _deadman.setTimeout(command.deadman.timeoutMs).feed(currentMillis);
+            if(nullptr != _settings) {
+                _settings->setDeadmanTimeout(command.deadman.timeoutMs, currentMillis);
+            }
+            return SUCCESS;
+        }
+        case RUN_SCRIPT: {
+            if(SUCCESS != _script.start()) {
+                return FAILURE;
+            }
+            _setScriptRunning(true, "RUNNING");
+            return SUCCESS;
+        }
+        case STOP_SCRIPT: {
+            if(_script.running()) {
+                _script.stop();
+                _setScriptRunning(false, "STOPPED");
+            }
+            return SUCCESS;
+        }
+        case LOAD_MAP: {
+            // replacing the map cancels any path planned on the old one
+            const MapCommand &map = _stagedMap;
+            const int status = _pathFollowBehavior->loadMap(map.width, map.height, map.cellSize, map.originX, map.originY, map.packed, map.packedBytes);
+            _mapStaged.store(false, std::memory_order_release);
+            return status;
+        }
+        case LOAD_FENCE: {
+            const FenceCommand &fence = _stagedFence;
+            const int status = _geofenceBehavior->configure((GeofenceMode)fence.mode, fence.margin,
+                fence.vertices, fence.vertexCount, fence.keepOuts, fence.keepOutCount);
+            _fenceStaged.store(false, std::memory_order_release);
+            return status;
+        }
+        case LOAD_SCRIPT: {
+            // a new script replaces a running one
+            if(_script.running()) {
+                _script.stop();
+                _setScriptRunning(false, "STOPPED");
+            }
+            const int status = _script.load(_stagedScript, _stagedScriptLength);
+            _scriptStaged.store(false, std::memory_order_release);
+            return status;
+        }
+        default: {
+            return FAILURE;
+        }
     }
-    return FAILURE;
 }
 
 /**
- * Execute the given rover command
+ * Execute the given rover command by handing it
+ * to the teleop behavior.
  */
 int RoverCommandProcessor::executeRoverCommand(
     TankCommand &command)   // IN : speed/direction for both wheels
@@ -276,12 +630,84 @@ int RoverCommandProcessor::executeRoverCommand(
     if (!attached())
         return FAILURE;
 
-    _rover->roverLeftWheel(command.useSpeedControl, command.left.forward, command.left.value);
-    _rover->roverRightWheel(command.useSpeedControl, command.right.forward, command.right.value);
+    _teleopBehavior.setCommand(WheelCommand(
+        command.useSpeedControl,
+        command.left.forward ? command.left.value : -command.left.value,
+        command.right.forward ? command.right.value : -command.right.value));
 
     return SUCCESS;
 }
 
+/**
+ * Execute a command produced by the script
+ */
+int RoverCommandProcessor::executeScriptCommand(
+    const ScriptCommand &command,   // IN : tank, goto or pid instruction
+    unsigned long currentMillis)    // IN : milliseconds since startup
+                                    // RET: SUCCESS if command executed
+                                    //      FAILURE if command could not execute
+{
+    switch(command.opcode) {
+        case SCRIPT_TANK: {
+            TankCommand tank(0 != (command.flags & SCRIPT_TANK_SPEED_CONTROL),
+                SpeedCommand(0 != (command.flags & SCRIPT_TANK_LEFT_FORWARD), command.values[0]),
+                SpeedCommand(0 != (command.flags & SCRIPT_TANK_RIGHT_FORWARD), command.values[1]));
+            return executeRoverCommand(tank);
+        }
+        case SCRIPT_GOTO: {
+            const GotoCommand go2(command.values[0], command.values[1], command.values[2], command.values[3]);
+            return executeConfigCommand(RoverCommand(GOTO, go2), currentMillis);
+        }
+        case SCRIPT_PID: {
+            const PidCommand pid((WheelId)command.flags,
+                command.values[0], command.values[1], command.values[2], command.values[3], command.values[4]);
+            return executeConfigCommand(RoverCommand(PID, pid), currentMillis);
+        }
+        default: {
+            return FAILURE;
+        }
+    }
+}
+
+/**
+ * Start or stop the script and publish its state
+ */
+void RoverCommandProcessor::_setScriptRunning(
+    bool running,       // IN : true if script started, false if it stopped
+    const char *state)  // IN : state to publish, like "DONE"
+{
+    if(!running) {
+        // leave the rover stopped, like a halt
+        TankCommand stop;
+        executeRoverCommand(stop);
+    }
+    if(nullptr != _messageBus) {
+        _messageBus->publish(*this, SCRIPT_STATE, ROVER_SPEC, state);
+    }
+}
+
+/**
+ * Run the script for one control loop tick
+ */
+void RoverCommandProcessor::_pollScript(
+    unsigned long currentMillis)    // IN : milliseconds since startup
+{
+    ScriptCommand command;
+    switch(_script.poll(currentMillis, command)) {
+        case SCRIPT_COMMAND: {
+            executeScriptCommand(command, currentMillis);
+            break;
+        }
+        case SCRIPT_DONE: {
+            _setScriptRunning(false, "DONE");
+            break;
+        }
+        default: {
+            break;
+        }
+    }
+}
+
 /**
  * Poll command queue
  */
@@ -289,11 +715,91 @@ RoverCommandProcessor& RoverCommandProcessor::pollRoverCommand(
     unsigned long currentMillis)   // IN : milliseconds since startup
                                    // RET: this rover
 {
+    //
+    // run all queued configuration commands in order,
+    // then the newest movement command if there is one.
+    //
+    RoverCommand config;
+    while(_configQueue.pop(config)) {
+        executeConfigCommand(config, currentMillis);
+    }
+
+    //
+    // a halt stops everything, including a goal or script
+    // just started from the config queue; the stop it left in
+    // the movement slot, or a newer command, is taken below.
+    //
+    const unsigned int halts = _halts.load(std::memory_order_acquire);
+    if(halts != _haltsSeen) {
+        _haltsSeen = halts;
+        _stopAll();
+    }
+
+    //
+    // newest movement command; an untimed command takes over
+    // from any schedule or script, like a driver grabbing the joystick.
+    //
+    TimedTankCommand movement;
+    if (SUCCESS == takeMovementCommand(&movement)) {
+        _latency.dequeued(movement.stamp, halMicros());
+        _scheduler.clear();
+        if(_script.running()) {
+            _script.stop();
+            if(nullptr != _messageBus) {
+                _messageBus->publish(*this, SCRIPT_STATE, ROVER_SPEC, "STOPPED");
+            }
+        }
+        if(movement.timing.durationMs > 0) {
+            _scheduler.schedule(movement.tank, currentMillis, movement.timing.durationMs);
+        } else {
+            executeRoverCommand(movement.tank);
+        }
+    }
+
+    //
+    // add scheduled commands then run whatever is due;
+    // those submitted before the latest halt are dropped
+    //
+    while((_scheduler.count() < _scheduler.capacity()) && _scheduleQueue.pop(movement)) {
+        if(movement.halts == halts) {
+            _scheduler.schedule(movement.tank, movement.timing.atMs, movement.timing.durationMs);
+        }
+    }
     TankCommand command;
-    if (SUCCESS == dequeueRoverCommand(&command)) {
-        executeRoverCommand(command);
+    switch(_scheduler.poll(currentMillis, command)) {
+        case SCHEDULE_START: {
+            executeRoverCommand(command);
+            break;
+        }
+        case SCHEDULE_STOP: {
+            TankCommand stop;
+            executeRoverCommand(stop);
+            break;
+        }
+        default: {
+            break;
+        }
     }
 
+    //
+    // the uploaded script runs without the client
+    //
+    _pollScript(currentMillis);
+
+    //
+    // if the client has gone quiet while we are driving
+    // its command, ramp down to a halt.  Timed commands
+    // and scripts stop on their own, so they don't need the client.
+    //
+    if(_teleopBehavior.active() && !_teleopBehavior.ramping() && !_scheduler.running() && !_script.running() && _deadman.expired(currentMillis)) {
+        _teleopBehavior.rampToHalt(currentMillis, DEADMAN_RAMP_MS);
+        if(nullptr != _messageBus) {
+            _messageBus->publish(*this, DEADMAN_HALT, ROVER_SPEC, nullptr);
+        }
+    }
+
+    _latency.poll(currentMillis);
+
     return *this;
 }
 
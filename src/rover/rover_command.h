@@ -3,6 +3,18 @@
 
 #include "./rover.h"
 #include "./goto_goal.h"
+#include "./path_follow.h"
+#include "../behavior/geofence_behavior.h"
+#include "../behavior/teleop.h"
+#include "./deadman.h"
+#include "./rover_binary.h"
+#include "../util/latest_value.h"
+#include "../util/spsc_queue.h"
+#include <atomic>
+#include "./command_scheduler.h"
+#include "./command_latency.h"
+#include "../script/script.h"
+#include "../settings/settings.h"
 
 //
 // discriminate between commands
@@ -15,6 +27,15 @@ typedef enum {
     STALL,
     RESET_POSE,
     GOTO,
+    PATH,
+    TWIST,
+    ARC,
+    DEADMAN,
+    RUN_SCRIPT,
+    STOP_SCRIPT,
+    LOAD_MAP,       // apply the staged map upload
+    LOAD_FENCE,     // apply the staged fence upload
+    LOAD_SCRIPT,    // apply the staged script upload
 } CommandType;
 
 extern const char *CommandNames[];
@@ -72,7 +93,8 @@ typedef struct TankCommand {
 } TankCommand;
 
 //
-// command to move rover to a given location
+// command to move rover to a given location;
+// used by both goto and path commands
 //
 typedef struct GotoCommand {
     GotoCommand(): x(0), y(), tolerance(0), pointForward(0) {};
@@ -86,6 +108,58 @@ typedef struct GotoCommand {
     distance_type pointForward;
 } GotoCommand;
 
+//
+// command to drive rover at a linear and angular velocity;
+// used by both twist and arc commands
+//
+typedef struct TwistCommand {
+    TwistCommand(): linear(0), angular(0) {};
+    TwistCommand(speed_type _linear, speed_type _angular): linear(_linear), angular(_angular) {};
+
+    speed_type linear;      // forward velocity in distance units per second
+    speed_type angular;     // counter-clockwise turn rate in radians per second
+} TwistCommand;
+
+//
+// command to set the deadman timeout
+//
+typedef struct DeadmanCommand {
+    DeadmanCommand(): timeoutMs(0) {};
+    DeadmanCommand(unsigned long t): timeoutMs(t) {};
+
+    unsigned long timeoutMs;    // halt if no movement command or heartbeat
+                                // within this many milliseconds; 0 disables
+} DeadmanCommand;
+
+//
+// optional timing for movement commands, on the rover's
+// control clock (milliseconds since startup);
+// like 'cmd(7, speed(128, true, 128, true), at(120500), for(500))'
+//
+typedef struct CommandTiming {
+    CommandTiming(): scheduled(false), atMs(0), durationMs(0) {};
+    CommandTiming(bool s, unsigned long a, unsigned long d): scheduled(s), atMs(a), durationMs(d) {};
+
+    bool scheduled;             // true if atMs is set, false to start on arrival
+    unsigned long atMs;         // if scheduled, when to start
+    unsigned long durationMs;   // run time, then stop; 0 runs until replaced
+} CommandTiming;
+
+//
+// movement command with its timing
+//
+typedef struct TimedTankCommand {
+    TimedTankCommand(): tank(TankCommand()), timing(CommandTiming()), stamp(CommandStamp()), halts(0) {};
+    TimedTankCommand(TankCommand t, CommandTiming c): tank(t), timing(c), stamp(CommandStamp()), halts(0) {};
+    TimedTankCommand(TankCommand t, CommandTiming c, CommandStamp s): tank(t), timing(c), stamp(s), halts(0) {};
+    TimedTankCommand(TankCommand t, CommandTiming c, unsigned int h): tank(t), timing(c), stamp(CommandStamp()), halts(h) {};
+
+    TankCommand tank;
+    CommandTiming timing;
+    CommandStamp stamp;     // receive/parse times for latency measurement
+    unsigned int halts;     // halt count when submitted; stale once the rover halts again
+} TimedTankCommand;
+
 typedef struct RoverCommand {
     RoverCommand(): type(NOOP), tank(TankCommand()) {};
     RoverCommand(CommandType t): type(t), tank(TankCommand()) {};
@@ -93,13 +167,18 @@ typedef struct RoverCommand {
     RoverCommand(CommandType t, PidCommand c): type(t), pid(c) {};
     RoverCommand(CommandType t, StallCommand c): type(t), stall(c) {};
     RoverCommand(CommandType t, GotoCommand c): type(t), go2(c) {};
+    RoverCommand(CommandType t, TwistCommand c): type(t), twist(c) {};
+    RoverCommand(CommandType t, DeadmanCommand c): type(t), deadman(c) {};
 
     CommandType type;    // if matched, the command number OR NOOP
+    CommandTiming timing;// for tank, twist and arc; optional start time and duration
     union  {
         TankCommand tank; 
         PidCommand pid;    
         StallCommand stall;
         GotoCommand go2;
+        TwistCommand twist;
+        DeadmanCommand deadman;
     };
 } RoverCommand;
 
@@ -117,18 +196,70 @@ typedef struct SubmitCommandResult {
 #define COMMAND_ENQUEUE_FAILURE (-3)
 
 
-class RoverCommandProcessor {
+class RoverCommandProcessor : public Publisher, public Subscriber {
     private:
-    static const unsigned int COMMAND_BUFFER_SIZE = 4;
-    TankCommand _commandQueue[COMMAND_BUFFER_SIZE];     // circular queue of commands
-    uint8_t _commandHead = 0; // read from head
-    uint8_t _commandTail = 0; // append to tail
+    //
+    // commands are submitted by the websocket handler and
+    // executed by the control loop, which may run on different
+    // tasks; both hand-offs are lock-free.
+    // - only the newest movement matters, so it is a single slot
+    // - configuration commands must all run in order, so they queue
+    // - movement scheduled with at() must all run, so it queues too
+    // - a halt only counts itself; the loop stops everything when it sees a new count
+    // - map, fence and script uploads are copied to a staging slot and applied by a config command
+    //
+    static const unsigned int CONFIG_QUEUE_SIZE = 8;
+    static const unsigned int SCHEDULE_SIZE = 8;
+    LatestValue<TimedTankCommand> _movementCommand;             // newest movement command
+    SpscQueue<RoverCommand, CONFIG_QUEUE_SIZE> _configQueue;    // pid, stall, resetPose, goto, path, deadman, scripts, uploads
+    SpscQueue<TimedTankCommand, SCHEDULE_SIZE> _scheduleQueue;  // movement with at()
+    CommandScheduler<TankCommand, SCHEDULE_SIZE> _scheduler;    // owned by control loop
+    std::atomic<unsigned int> _halts{0};    // incremented by halt(); scheduled movement from before a halt is dropped
+    unsigned int _haltsSeen = 0;            // halt count the control loop has acted on
+
+    std::atomic<bool> _mapStaged{false};    // true from upload until the loop applies it
+    MapCommand _stagedMap;
+    uint8_t _stagedMapBits[(MAP_MAX_CELLS + 7) / 8];
+    std::atomic<bool> _fenceStaged{false};  // true from upload until the loop applies it
+    FenceCommand _stagedFence;
+    std::atomic<bool> _scriptStaged{false}; // true from upload until the loop applies it
+    uint8_t _stagedScript[SCRIPT_MAX_BYTES];
+    unsigned int _stagedScriptLength = 0;
 
     TwoWheelRover* _rover = nullptr;
     GotoGoalBehavior* _gotoGoalBehavior = nullptr;
+    PathFollowBehavior* _pathFollowBehavior = nullptr;
+    GeofenceBehavior* _geofenceBehavior = nullptr;
+    Settings* _settings = nullptr;
+    MessageBus* _messageBus = nullptr;
+    TeleopBehavior _teleopBehavior;     // proposes the most recent movement command
+    DeadmanTimer _deadman;              // halts if client goes quiet while moving
+    CommandLatency _latency;            // receive to motor latency histograms
+    ScriptRunner _script;               // uploaded command script
+
+    /**
+     * Start or stop the script and publish its state
+     */
+    void _setScriptRunning(bool running, const char *state);
+
+    /**
+     * Run the script for one control loop tick
+     */
+    void _pollScript(unsigned long currentMillis);
+
+    /**
+     * Stop the rover, the script and any goal;
+     * run by the control loop when it sees a new halt
+     */
+    void _stopAll();
 
     public:
 
+    RoverCommandProcessor()
+        : Publisher(ROVER_SPEC), _deadman(DEADMAN_TIMEOUT_MS)
+    {
+    }
+
     /**
      * Determine if rover's dependencies are attached
      */
@@ -138,20 +269,54 @@ class RoverCommandProcessor {
      * Attach rover dependencies
      */
     RoverCommandProcessor& attach(
-        TwoWheelRover &rover,               // IN : rover attached state
-        GotoGoalBehavior &gotoGoalBehavior);// IN : behavior in attached state
-                                            // RET: this RoverCommandProcessor in attached state
+        TwoWheelRover &rover,                   // IN : rover attached state
+        GotoGoalBehavior &gotoGoalBehavior,     // IN : behavior in attached state
+        PathFollowBehavior &pathFollowBehavior, // IN : behavior in attached state
+        GeofenceBehavior &geofenceBehavior,     // IN : behavior in attached state
+        Settings &settings,                     // IN : settings that keep calibration across restarts
+        MessageBus &messageBus);                // IN : message bus to publish deadman events
+                                                // RET: this RoverCommandProcessor in attached state
 
     /**
      * Detach dependencies
      */
     RoverCommandProcessor& detach(); // RET: this behavior in detached state
 
+    /**
+     * Behavior that drives with client movement commands;
+     * add this to the BehaviorArbiter.
+     */
+    TeleopBehavior& teleopBehavior() { return _teleopBehavior; }
+
+    /**
+     * Deadman timer that halts the rover if the client
+     * stops sending movement commands or heartbeats.
+     */
+    DeadmanTimer& deadman() { return _deadman; }
+
+    /**
+     * Movement command latency from websocket receive
+     * to pwm write; call latency().pwmWritten() when
+     * motor pwm is written.
+     */
+    CommandLatency& latency() { return _latency; }
+
+    /**
+     * Uploaded command script
+     */
+    const ScriptRunner& script() const { return _script; }
+
+    /**
+     * Commands waiting for the control loop
+     */
+    unsigned int configQueueDepth() const { return _configQueue.count(); }
+    unsigned int scheduleQueueDepth() const { return _scheduleQueue.count(); }
+
     /**
      * Add a command, as string parameters, to the command queue
      */
     int submitTurtleCommand(
-        boolean useSpeedControl,    // IN : true if command is a speed command
+        bool useSpeedControl,       // IN : true if command is a speed command
                                     //      false if command is a pwm command
         const char *directionParam, // IN : direction as a string; "forward",
                                     //      "reverse", "left", "right", or "stop"
@@ -167,41 +332,133 @@ class RoverCommandProcessor {
     */
     SubmitCommandResult submitCommand(
         const char *commandParam,   // IN : A wrapped tank command link cmd(tank(...))
-        const int offset);          // IN : offset of cmd() wrapper in command buffer
+        const int offset,           // IN : offset of cmd() wrapper in command buffer
+        unsigned long receivedUs = 0); // IN : micros() when command was received;
+                                    //      0 to skip latency measurement
                                     // RET: struct with status, command id and command
                                     //      where status == SUCCESS or
                                     //      status == -1 on bad command (null or empty)
                                     //      status == -2 on parse error
-                                    //      status == -3 on enqueue error (queue is full)
+                                    //      status == -3 on enqueue error (config queue is full)
+                                    //      a path is planned when it runs, in order with
+                                    //      other config commands; a planning error is
+                                    //      reported in path telemetry as state FAILED
+
+    /*
+    ** submit a binary command that was
+    ** sent in the websocket channel
+    */
+    SubmitCommandResult submitBinaryCommand(
+        const uint8_t *frame,       // IN : binary frame [opcode][id][payload]
+        const unsigned int length); // IN : number of bytes in frame
+                                    // RET: struct with status, command id and command
+                                    //      where status == SUCCESS or
+                                    //      status == -1 on bad command (null or too short)
+                                    //      status == -2 on parse error
+                                    //      status == -3 if command could not be applied
+                                    //                   (or a script upload while a script runs)
+
 
+    /**
+     * Convert a linear and angular velocity to a speed
+     * controlled tank command, using the rover's current
+     * calibration to keep wheels within their speed range.
+     */
+    int twistToTank(
+        const TwistCommand &twist,  // IN : linear and angular velocity
+        TankCommand &tank);         // OUT: on SUCCESS, speed/direction for both wheels
+                                    //      otherwise unchanged.
+                                    // RET: SUCCESS if converted
+                                    //      COMMAND_BAD_FAILURE if rover is not attached
+                                    //      or velocities are not finite
 
     /**
-     * Append a command to the command queue.
+     * Replace the pending movement command;
+     * an earlier one that has not run yet is dropped.
      */
-    int enqueueRoverCommand(
-        TankCommand command);   // IN : speed/direction for both wheels
-                                // RET: SUCCESS if command could be queued
-                                //      FAILURE if buffer is full.
+    int setMovementCommand(
+        const TankCommand &command);    // IN : speed/direction for both wheels
+                                        // RET: SUCCESS; the newest command always fits
 
+    /**
+     * Submit a movement command with optional timing.
+     * Commands with a start time are queued so every one
+     * runs; others replace the pending movement command.
+     */
+    int submitMovementCommand(
+        const TankCommand &command,     // IN : speed/direction for both wheels
+        const CommandTiming &timing,    // IN : optional start time and duration
+        const CommandStamp &stamp = CommandStamp()); // IN : receive/parse times
+                                        // RET: SUCCESS if command was accepted
+                                        //      FAILURE if schedule queue is full.
 
     /**
-     * Get the next command from the command queue.
+     * Take the pending movement command
      */
-    int dequeueRoverCommand(
-        TankCommand *command);  // OUT: on SUCCESS, speed/direction for both wheels
+    int takeMovementCommand(
+        TimedTankCommand *command); // OUT: on SUCCESS, speed/direction for both wheels
                                 //      otherwise unchanged.
-                                // RET: SUCCESS if buffer had a command to return 
-                                //      FAILURE if buffer is empty.
+                                // RET: SUCCESS if a new movement command was waiting
+                                //      FAILURE if there is no new movement command.
+
+    /**
+     * Append a configuration command to the config queue.
+     */
+    int enqueueConfigCommand(
+        const RoverCommand &command);   // IN : pid, stall, resetPose, goto, path, deadman,
+                                        //      runScript, stopScript, loadMap, loadFence
+                                        //      or loadScript command
+                                        // RET: SUCCESS if command could be queued
+                                        //      FAILURE if queue is full.
 
+    /**
+     * Execute a configuration command
+     */
+    int executeConfigCommand(
+        const RoverCommand &command,    // IN : pid, stall, resetPose, goto, path, deadman,
+                                        //      runScript, stopScript, loadMap, loadFence
+                                        //      or loadScript command
+        unsigned long currentMillis);   // IN : milliseconds since startup
+                                        // RET: SUCCESS if command executed
+                                        //      FAILURE if command could not execute
+                                        //      or a path could not be planned
 
     /**
-     * Execute the given rover command
+     * Execute the given rover command by handing it
+     * to the teleop behavior.
      */
     int executeRoverCommand(
         TankCommand &command);  // IN : speed/direction for both wheels
                                 // RET: SUCCESS if command executed
                                 //      FAILURE if command could not execute
 
+    /**
+     * Execute a command produced by the script
+     */
+    int executeScriptCommand(
+        const ScriptCommand &command,   // IN : tank, goto or pid instruction
+        unsigned long currentMillis);   // IN : milliseconds since startup
+                                        // RET: SUCCESS if command executed
+                                        //      FAILURE if command could not execute
+
+    /**
+     * Stop the rover and drop any movement
+     * not yet run, including movement scheduled with at(),
+     * the script and any goal.  Safe to call from the
+     * websocket task; the stop replaces any pending movement
+     * right away and the control loop stops the rest on its next poll.
+     */
+    RoverCommandProcessor& halt(); // RET: this instance
+
+    /**
+     * Halt when wifi drops, since nobody can steer
+     */
+    virtual void onMessage(
+        Publisher &publisher,       // IN : publisher of message
+        Message message,            // IN : message that was published
+        Specifier specifier,        // IN : specifier (like LEFT_WHEEL_SPEC)
+        const char *data);          // IN : message data as a c-cstring
+
     /**
      * Poll command queue
      */
@@ -228,13 +228,14 @@ ParseTankResult parseHaltCommand(
 }
 
 /*
-** Parse Goto location command
-** in form "goto({x}, {y}, {tolerance})"
-** like "goto(48.0, 104.0, 0.001)"
+** Parse a location command
+** in form "{name}({x}, {y}, {tolerance}, {pointForward})"
+** like "goto(48.0, 104.0, 0.001, 0.75)"
 */
-ParseGotoResult parseGotoCommand(    
+ParseGotoResult parseLocationCommand(
     String command,     // IN : the string to scan
-    const int offset)   // IN : the index into the string to start scanning
+    const int offset,   // IN : the index into the string to start scanning
+    const String open)  // IN : command name and open paren, like "goto("
                         // RET: scan result 
                         //      matched is true if completely matched, false otherwise
                         //      if matched, offset is index of character after matched span, 
@@ -244,7 +245,7 @@ ParseGotoResult parseGotoCommand(
     // scan command open
     //
     ScanResult scan = scanChars(command, offset, ' '); // skip whitespace
-    scan = scanString(command, scan.index, String("goto("));
+    scan = scanString(command, scan.index, open);
     if(scan.matched) {
         // x value
         ParseDecimalResult x = parseFloat(command, scan.index);
@@ -281,6 +282,199 @@ ParseGotoResult parseGotoCommand(
     return {false, offset, GotoCommand()};
 }
 
+/*
+** Parse Goto location command
+** in form "goto({x}, {y}, {tolerance}, {pointForward})"
+** like "goto(48.0, 104.0, 0.001, 0.75)"
+*/
+ParseGotoResult parseGotoCommand(
+    String command,     // IN : the string to scan
+    const int offset)   // IN : the index into the string to start scanning
+                        // RET: scan result (see parseLocationCommand)
+{
+    return parseLocationCommand(command, offset, String("goto("));
+}
+
+/*
+** Parse path-follow command; plan a path on the map and follow it
+** in form "path({x}, {y}, {tolerance}, {pointForward})"
+** like "path(48.0, 104.0, 2.0, 0.75)"
+*/
+ParseGotoResult parsePathCommand(
+    String command,     // IN : the string to scan
+    const int offset)   // IN : the index into the string to start scanning
+                        // RET: scan result (see parseLocationCommand)
+{
+    return parseLocationCommand(command, offset, String("path("));
+}
+
+/*
+** Parse a pair of signed values
+** in form "{name}({first}, {second})"
+*/
+static ParseTwistResult parseVelocityPair(
+    String command,     // IN : the string to scan
+    const int offset,   // IN : the index into the string to start scanning
+    const String open,  // IN : command name and open paren, like "twist("
+    ParseDecimalResult &first,  // OUT: first value
+    ParseDecimalResult &second) // OUT: second value
+                        // RET: scan result; value is not set
+{
+    ScanResult scan = scanChars(command, offset, ' '); // skip whitespace
+    scan = scanString(command, scan.index, open);
+    if(scan.matched) {
+        scan = scanChars(command, scan.index, ' '); // skip whitespace
+        first = parseFloat(command, scan.index);
+        if(first.matched) {
+            scan = scanFieldSeparator(command, first.index, ',');  // skip field separator
+            if(scan.matched) {
+                second = parseFloat(command, scan.index);
+                if(second.matched) {
+                    scan = scanEndCommand(command, second.index, ')');
+                    if(scan.matched) {
+                        return {true, scan.index, TwistCommand()};
+                    }
+                }
+            }
+        }
+    }
+
+    // did not parse
+    return {false, offset, TwistCommand()};
+}
+
+/*
+** Parse velocity command
+** in form "twist({linear}, {angular})"
+** where linear is forward velocity (negative for reverse)
+** and angular is counter-clockwise turn rate in radians per second,
+** like "twist(30.0, -0.5)"
+*/
+ParseTwistResult parseTwistCommand(
+    String command,     // IN : the string to scan
+    const int offset)   // IN : the index into the string to start scanning
+                        // RET: scan result 
+                        //      matched is true if completely matched, false otherwise
+                        //      if matched, offset is index of character after matched span, 
+                        //      otherwise return the offset argument unchanged.
+{
+    ParseDecimalResult linear, angular;
+    ParseTwistResult result = parseVelocityPair(command, offset, String("twist("), linear, angular);
+    if(result.matched) {
+        result.value = TwistCommand(linear.value, angular.value);
+    }
+    return result;
+}
+
+/*
+** Parse turning arc command
+** in form "arc({linear}, {radius})"
+** where linear is forward velocity (negative for reverse)
+** and radius is distance to the center of the turn; 
+** positive turns left, negative turns right and zero
+** drives straight; like "arc(30.0, 50.0)"
+*/
+ParseTwistResult parseArcCommand(
+    String command,     // IN : the string to scan
+    const int offset)   // IN : the index into the string to start scanning
+                        // RET: scan result 
+                        //      matched is true if completely matched, false otherwise
+                        //      if matched, offset is index of character after matched span, 
+                        //      otherwise return the offset argument unchanged.
+{
+    ParseDecimalResult linear, radius;
+    ParseTwistResult result = parseVelocityPair(command, offset, String("arc("), linear, radius);
+    if(result.matched) {
+        // angular velocity is linear velocity over radius
+        result.value = TwistCommand(linear.value, (0 == radius.value) ? 0 : linear.value / radius.value);
+    }
+    return result;
+}
+
+/*
+** Parse optional timing suffixes that follow a movement command
+** in form ", at({ms})" and/or ", for({ms})", in either order
+** like ", at(120500), for(500)"
+*/
+ParseTimingResult parseCommandTiming(
+    String command,     // IN : the string to scan
+    const int offset)   // IN : the index into the string to start scanning
+                        // RET: scan result 
+                        //      matched is true if there are no suffixes or
+                        //      they are completely matched, false otherwise
+                        //      if matched, offset is index of character after matched span, 
+                        //      otherwise return the offset argument unchanged.
+{
+    CommandTiming timing;
+    bool hasDuration = false;
+    int index = offset;
+
+    for(;;) {
+        ScanResult scan = scanFieldSeparator(command, index, ',');
+        if(!scan.matched) break;   // no more suffixes
+
+        const ScanResult forOpen = scanString(command, scan.index, String("for("));
+        const ScanResult atOpen = scanString(command, scan.index, String("at("));
+        bool isDuration;
+        if(forOpen.matched && !hasDuration) {
+            isDuration = true;
+            scan = forOpen;
+        } else if(atOpen.matched && !timing.scheduled) {
+            isDuration = false;
+            scan = atOpen;
+        } else {
+            return {false, offset, CommandTiming()};
+        }
+
+        scan = scanChars(command, scan.index, ' '); // skip whitespace
+        ParseIntegerResult ms = parseUnsignedInt(command, scan.index);
+        if(!ms.matched) return {false, offset, CommandTiming()};
+        scan = scanEndCommand(command, ms.index, ')');
+        if(!scan.matched) return {false, offset, CommandTiming()};
+
+        if(isDuration) {
+            hasDuration = true;
+            timing.durationMs = (unsigned long)ms.value;
+        } else {
+            timing.scheduled = true;
+            timing.atMs = (unsigned long)ms.value;
+        }
+        index = scan.index;
+    }
+
+    return {true, index, timing};
+}
+
+/*
+** Parse a deadman command
+** in form "deadman({timeoutMs})"
+** like "deadman(1000)"
+*/
+ParseDeadmanResult parseDeadmanCommand(
+    String command,     // IN : the string to scan
+    const int offset)   // IN : the index into the string to start scanning
+                        // RET: scan result 
+                        //      matched is true if completely matched, false otherwise
+                        //      if matched, offset is index of character after matched span, 
+                        //      otherwise return the offset argument unchanged.
+{
+    ScanResult scan = scanChars(command, offset, ' '); // skip whitespace
+    scan = scanString(command, scan.index, String("deadman("));
+    if(scan.matched) {
+        scan = scanChars(command, scan.index, ' '); // skip whitespace
+        ParseIntegerResult timeout = parseUnsignedInt(command, scan.index);
+        if(timeout.matched) {
+            scan = scanEndCommand(command, timeout.index, ')');
+            if(scan.matched) {
+                return {true, scan.index, DeadmanCommand((unsigned long)timeout.value)};
+            }
+        }
+    }
+
+    // did not parse
+    return {false, offset, DeadmanCommand()};
+}
+
 ParseNoArgCommandResult parseNoArgCommand(
     String command,     // IN : the string to scan
     const int offset,   // IN : the index into the string to start scanning
@@ -348,14 +542,49 @@ ParseCommandResult parseCommand(
                 // 
                 ParseTankResult tank = parseTankCommand(command, scan.index);
                 if(tank.matched) {
-                    // Scan command close
-                    ScanResult scan = scanEndCommand(command, tank.index, ')'); // skip whitespace
-                    if(scan.matched) {
+                    // optional timing then command close
+                    ParseTimingResult timing = parseCommandTiming(command, tank.index);
+                    ScanResult scan = scanEndCommand(command, timing.index, ')'); // skip whitespace
+                    if(timing.matched && scan.matched) {
                         LOGFMT("command parsed: \"%s\"", cstr(command.substr(offset, scan.index - offset)));
-                        return {true, scan.index, id.value, RoverCommand(TANK, tank.value)};
+                        RoverCommand rover(TANK, tank.value);
+                        rover.timing = timing.value;
+                        return {true, scan.index, id.value, rover};
                     }
                 } 
 
+                //
+                // linear and angular velocity command
+                //
+                ParseTwistResult twist = parseTwistCommand(command, scan.index);
+                if(twist.matched) {
+                    // optional timing then command close
+                    ParseTimingResult timing = parseCommandTiming(command, twist.index);
+                    ScanResult scan = scanEndCommand(command, timing.index, ')'); // skip whitespace
+                    if(timing.matched && scan.matched) {
+                        LOGFMT("command parsed: \"%s\"", cstr(command.substr(offset, scan.index - offset)));
+                        RoverCommand rover(TWIST, twist.value);
+                        rover.timing = timing.value;
+                        return {true, scan.index, id.value, rover};
+                    }
+                }
+
+                //
+                // turning arc command
+                //
+                ParseTwistResult arc = parseArcCommand(command, scan.index);
+                if(arc.matched) {
+                    // optional timing then command close
+                    ParseTimingResult timing = parseCommandTiming(command, arc.index);
+                    ScanResult scan = scanEndCommand(command, timing.index, ')'); // skip whitespace
+                    if(timing.matched && scan.matched) {
+                        LOGFMT("command parsed: \"%s\"", cstr(command.substr(offset, scan.index - offset)));
+                        RoverCommand rover(ARC, arc.value);
+                        rover.timing = timing.value;
+                        return {true, scan.index, id.value, rover};
+                    }
+                }
+
                 //
                 // halt is a special version of tank command that stops motors
                 //
@@ -395,6 +624,19 @@ ParseCommandResult parseCommand(
                     }
                 }
 
+                //
+                // plan a path to (x, y) location and follow it
+                //
+                ParseGotoResult path = parsePathCommand(command, scan.index);
+                if(path.matched) {
+                    // Scan command close
+                    ScanResult scan = scanEndCommand(command, path.index, ')'); // skip whitespace
+                    if(scan.matched) {
+                        LOGFMT("command parsed: \"%s\"", cstr(command.substr(offset, scan.index - offset)));
+                        return {true, scan.index, id.value, RoverCommand(PATH, path.value)};
+                    }
+                }
+
                 //
                 // reset pose command - reset pose back to origin
                 //
@@ -406,6 +648,50 @@ ParseCommandResult parseCommand(
                         return {true, scan.index, id.value, RoverCommand(RESET_POSE)};
                     }
                 }
+
+                //
+                // deadman timeout command
+                //
+                ParseDeadmanResult deadman = parseDeadmanCommand(command, scan.index);
+                if(deadman.matched) {
+                    ScanResult scan = scanEndCommand(command, deadman.index, ')'); // skip whitespace
+                    if(scan.matched) {
+                        LOGFMT("command parsed: \"%s\"", cstr(command.substr(offset, scan.index - offset)));
+                        return {true, scan.index, id.value, RoverCommand(DEADMAN, deadman.value)};
+                    }
+                }
+
+                //
+                // noop command - heartbeat from client
+                //
+                ParseNoArgCommandResult noop = parseNoArgCommand(command, scan.index, NOOP);
+                if(noop.matched) {
+                    ScanResult scan = scanEndCommand(command, noop.index, ')'); // skip whitespace
+                    if(scan.matched) {
+                        LOGFMT("command parsed: \"%s\"", cstr(command.substr(offset, scan.index - offset)));
+                        return {true, scan.index, id.value, RoverCommand(NOOP)};
+                    }
+                }
+
+                //
+                // start or stop the uploaded script
+                //
+                ParseNoArgCommandResult runScript = parseNoArgCommand(command, scan.index, RUN_SCRIPT);
+                if(runScript.matched) {
+                    ScanResult scan = scanEndCommand(command, runScript.index, ')'); // skip whitespace
+                    if(scan.matched) {
+                        LOGFMT("command parsed: \"%s\"", cstr(command.substr(offset, scan.index - offset)));
+                        return {true, scan.index, id.value, RoverCommand(RUN_SCRIPT)};
+                    }
+                }
+                ParseNoArgCommandResult stopScript = parseNoArgCommand(command, scan.index, STOP_SCRIPT);
+                if(stopScript.matched) {
+                    ScanResult scan = scanEndCommand(command, stopScript.index, ')'); // skip whitespace
+                    if(scan.matched) {
+                        LOGFMT("command parsed: \"%s\"", cstr(command.substr(offset, scan.index - offset)));
+                        return {true, scan.index, id.value, RoverCommand(STOP_SCRIPT)};
+                    }
+                }
             }
         }
     }
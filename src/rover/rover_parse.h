@@ -43,6 +43,27 @@ typedef struct ParseGotoResult {
     GotoCommand value;   // if matched, the stall command, else {0,0}
 } ParseGotoResult;
 
+typedef struct ParseTwistResult {
+    bool matched;       // true if fully matched, false if not
+    int index;          // if matched, index of first char after matched span,
+                        // otherwise index of start of scan
+    TwistCommand value; // if matched, the twist command, else {0,0}
+} ParseTwistResult;
+
+typedef struct ParseDeadmanResult {
+    bool matched;       // true if fully matched, false if not
+    int index;          // if matched, index of first char after matched span,
+                        // otherwise index of start of scan
+    DeadmanCommand value; // if matched, the deadman command, else {0}
+} ParseDeadmanResult;
+
+typedef struct ParseTimingResult {
+    bool matched;       // true if fully matched, false if not
+    int index;          // if matched, index of first char after matched span,
+                        // otherwise index of start of scan
+    CommandTiming value;// if matched, the timing; no suffixes is untimed
+} ParseTimingResult;
+
 typedef struct ParseCommandResult {
     bool matched;       // true if fully matched, false if not
     int index;          // if matched, index of first char after matched span,
@@ -60,6 +81,10 @@ typedef struct ParseNoArgCommandResult {
 
 extern ParseWheelResult parseWheelCommand(String command, const int offset);
 extern ParseTankResult parseTankCommand(String command, const int offset);
+extern ParseTwistResult parseTwistCommand(String command, const int offset);
+extern ParseTwistResult parseArcCommand(String command, const int offset);
+extern ParseTimingResult parseCommandTiming(String command, const int offset);
+extern ParseDeadmanResult parseDeadmanCommand(String command, const int offset);
 extern ParseCommandResult parseCommand(String command, const int offset);
 
 #endif
\ No newline at end of file
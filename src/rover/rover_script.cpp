@@ -0,0 +1,218 @@
+#ifndef TESTING
+    #include <Arduino.h>
+#endif
+
+#include "rover_script.h"
+#include "rover_parse.h"
+#include "../string/strcopy.h"
+#include "../error.h"
+
+//
+// longest statement, not counting the
+// cmd() wrapper added to parse it.
+//
+static const int SCRIPT_STATEMENT_CHARS = 96;
+
+/**
+ * Determine if only whitespace remains
+ */
+static bool atEnd(String statement, int offset) {
+    ScanResult scan = scanChars(statement, offset, ' ');
+    return scan.index >= (int)len(statement);
+}
+
+/**
+ * Parse a script statement with one unsigned argument
+ * like "wait(250)"
+ */
+static ParseIntegerResult parseScriptArgument(
+    String statement,   // IN : statement to scan
+    const char *open)   // IN : statement name and open paren, like "wait("
+                        // RET: matched is true if whole statement matched
+{
+    ScanResult scan = scanChars(statement, 0, ' '); // skip whitespace
+    scan = scanString(statement, scan.index, String(open));
+    if(scan.matched) {
+        scan = scanChars(statement, scan.index, ' ');
+        ParseIntegerResult value = parseUnsignedInt(statement, scan.index);
+        if(value.matched) {
+            scan = scanChars(statement, value.index, ' ');
+            scan = scanChar(statement, scan.index, ')');
+            if(scan.matched && atEnd(statement, scan.index)) {
+                return {true, scan.index, value.value};
+            }
+        }
+    }
+    return {false, 0, 0};
+}
+
+/**
+ * Compile a tank command and its optional duration
+ */
+static int compileTank(
+    const TankCommand &tank,        // IN : tank command
+    const CommandTiming &timing,    // IN : optional duration
+    ScriptWriter &writer)           // OUT: bytecode
+                                    // RET: SUCCESS or FAILURE
+{
+    if(timing.scheduled) {
+        // at() is for the client's clock; scripts use wait()
+        return FAILURE;
+    }
+    writer.tank(tank.useSpeedControl,
+        tank.left.forward, tank.left.value,
+        tank.right.forward, tank.right.value);
+    if(timing.durationMs > 0) {
+        writer.wait(timing.durationMs);
+        writer.tank(tank.useSpeedControl, false, 0, false, 0);
+    }
+    return SUCCESS;
+}
+
+/**
+ * Compile one statement
+ */
+static int compileStatement(
+    const char *text,       // IN : statement text, null terminated
+    TwoWheelRover &rover,   // IN : rover used to convert twist and arc
+    ScriptWriter &writer,   // OUT: bytecode
+    int &depth)             // IN/OUT: repeat nesting
+                            // RET: SUCCESS or FAILURE
+{
+    const String statement = String(text);
+
+    //
+    // script statements
+    //
+    ParseIntegerResult arg = parseScriptArgument(statement, "wait(");
+    if(arg.matched) {
+        writer.wait((uint32_t)arg.value);
+        return SUCCESS;
+    }
+    arg = parseScriptArgument(statement, "repeat(");
+    if(arg.matched) {
+        if((arg.value > 0xFFFF) || (++depth > (int)SCRIPT_MAX_DEPTH)) {
+            return FAILURE;
+        }
+        writer.repeat((uint16_t)arg.value);
+        return SUCCESS;
+    }
+    ScanResult scan = scanChars(statement, 0, ' ');
+    scan = scanString(statement, scan.index, String("end("));
+    if(scan.matched) {
+        scan = scanChars(statement, scan.index, ' ');
+        scan = scanChar(statement, scan.index, ')');
+        if(!scan.matched || !atEnd(statement, scan.index) || (--depth < 0)) {
+            return FAILURE;
+        }
+        writer.next();
+        return SUCCESS;
+    }
+
+    //
+    // rover commands; wrap so the command parser can read them
+    //
+    char wrapped[SCRIPT_STATEMENT_CHARS + 16];
+    int offset = strCopy(wrapped, sizeof(wrapped), "cmd(0, ");
+    offset = strCopyAt(wrapped, sizeof(wrapped), offset, text);
+    offset = strCopyAt(wrapped, sizeof(wrapped), offset, ")");
+    const ParseCommandResult parsed = parseCommand(String(wrapped), 0);
+    if(!parsed.matched || !atEnd(String(wrapped), parsed.index)) {
+        return FAILURE;
+    }
+
+    const RoverCommand &command = parsed.command;
+    switch(command.type) {
+        case TANK: {
+            return compileTank(command.tank, command.timing, writer);
+        }
+        case TWIST:
+        case ARC: {
+            const WheelVelocities wheels = rover.wheelVelocities(command.twist.linear, command.twist.angular);
+            const TankCommand tank(true,
+                SpeedCommand(wheels.left >= 0, abs<speed_type>(wheels.left)),
+                SpeedCommand(wheels.right >= 0, abs<speed_type>(wheels.right)));
+            return compileTank(tank, command.timing, writer);
+        }
+        case HALT: {
+            writer.tank(false, false, 0, false, 0);
+            return SUCCESS;
+        }
+        case PID: {
+            const PidCommand &pid = command.pid;
+            writer.pid((uint8_t)pid.wheels, pid.minSpeed, pid.maxSpeed, pid.Kp, pid.Ki, pid.Kd);
+            return SUCCESS;
+        }
+        case GOTO: {
+            const GotoCommand &go2 = command.go2;
+            writer.go2(go2.x, go2.y, go2.tolerance, go2.pointForward);
+            return SUCCESS;
+        }
+        default: {
+            // other commands are not useful in scripts
+            return FAILURE;
+        }
+    }
+}
+
+/**
+ * Compile script text into bytecode.
+ */
+CompileScriptResult compileScript(
+    const char *text,           // IN : script text; need not be null terminated
+    unsigned int length,        // IN : chars in text
+    TwoWheelRover &rover,       // IN : rover used to convert twist and arc
+    ScriptWriter &writer)       // OUT: bytecode ending with SCRIPT_END
+                                // RET: status and failing statement
+{
+    if(nullptr == text) {
+        return {FAILURE, 1};
+    }
+
+    int statementNumber = 0;
+    int depth = 0;
+    unsigned int start = 0;
+    while(start < length) {
+        // find end of statement
+        unsigned int end = start;
+        while((end < length) && ('\n' != text[end]) && (';' != text[end]) && ('\0' != text[end])) {
+            end += 1;
+        }
+
+        // skip blank statements
+        unsigned int first = start;
+        while((first < end) && ((' ' == text[first]) || ('\t' == text[first]) || ('\r' == text[first]))) {
+            first += 1;
+        }
+        if(first < end) {
+            statementNumber += 1;
+            if(end - first > (unsigned int)SCRIPT_STATEMENT_CHARS) {
+                return {FAILURE, statementNumber};
+            }
+
+            char statement[SCRIPT_STATEMENT_CHARS + 1];
+            strCopySize(statement, sizeof(statement), text + first, end - first);
+            for(char *c = statement; '\0' != *c; c += 1) {
+                if(('\t' == *c) || ('\r' == *c)) *c = ' ';
+            }
+            if(SUCCESS != compileStatement(statement, rover, writer, depth)) {
+                return {FAILURE, statementNumber};
+            }
+            if(!writer.ok()) {
+                return {FAILURE, 0};
+            }
+        }
+
+        if((end < length) && ('\0' == text[end])) {
+            break;
+        }
+        start = end + 1;
+    }
+
+    if(0 != depth) {
+        // unclosed repeat
+        return {FAILURE, statementNumber};
+    }
+    writer.end();
+    return {writer.ok() ? SUCCESS : FAILURE, 0};
+}
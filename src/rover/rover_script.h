@@ -0,0 +1,37 @@
+#ifndef ROVER_SCRIPT_H
+#define ROVER_SCRIPT_H
+
+#include "./rover.h"
+#include "../script/script.h"
+
+typedef struct CompileScriptResult {
+    int status;         // SUCCESS or FAILURE
+    int statement;      // if FAILURE, 1-based number of the statement that failed;
+                        // 0 if the script was too large
+} CompileScriptResult;
+
+/**
+ * Compile script text into bytecode.
+ *
+ * A script is a list of statements separated by newlines
+ * or semicolons.  A statement is a command like those
+ * sent in cmd() wrappers, without the wrapper or id:
+ *   pwm, speed, twist, arc (with optional for(ms)), halt, pid, goto,
+ * or one of the script statements:
+ *   wait(ms)       pause before the next statement
+ *   repeat(n)      run the statements up to end() n times; 0 is forever
+ *   end()          close a repeat
+ * like "repeat(3); pwm(128, true, 128, true), for(500); wait(250); end()"
+ *
+ * Twist and arc velocities are converted to wheel speeds
+ * using the calibration at compile time.  The rover stops
+ * when the script ends or is stopped.
+ */
+extern CompileScriptResult compileScript(
+    const char *text,           // IN : script text; need not be null terminated
+    unsigned int length,        // IN : chars in text
+    TwoWheelRover &rover,       // IN : rover used to convert twist and arc
+    ScriptWriter &writer);      // OUT: bytecode ending with SCRIPT_END
+                                // RET: status and failing statement
+
+#endif // ROVER_SCRIPT_H
@@ -0,0 +1,359 @@
+#include <string.h>
+#include "script.h"
+#include "../error.h"
+
+//
+// bytes of operands that follow each opcode
+//
+static const uint8_t operandBytes[NUMBER_OF_SCRIPT_OPCODES] = {
+    0,              // SCRIPT_END
+    1 + 4 + 4,      // SCRIPT_TANK
+    4 * 4,          // SCRIPT_GOTO
+    1 + 5 * 4,      // SCRIPT_PID
+    4,              // SCRIPT_WAIT
+    2,              // SCRIPT_REPEAT
+    0,              // SCRIPT_NEXT
+};
+
+/**
+ * Read a little-endian uint16 from a byte buffer
+ */
+static uint16_t readUint16(const uint8_t *bytes) {
+    return (uint16_t)bytes[0] | ((uint16_t)bytes[1] << 8);
+}
+
+/**
+ * Read a little-endian uint32 from a byte buffer
+ */
+static uint32_t readUint32(const uint8_t *bytes) {
+    return (uint32_t)bytes[0]
+        | ((uint32_t)bytes[1] << 8)
+        | ((uint32_t)bytes[2] << 16)
+        | ((uint32_t)bytes[3] << 24);
+}
+
+/**
+ * Read a little-endian IEEE-754 float from a byte buffer
+ */
+static float readFloat32(const uint8_t *bytes) {
+    const uint32_t bits = readUint32(bytes);
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+/**
+ * Make room for bytes; on overflow, nothing more is written
+ */
+bool ScriptWriter::_reserve(unsigned int bytes) {
+    if(_overflow || (nullptr == _buffer) || (_length + bytes > _size)) {
+        _overflow = true;
+        return false;
+    }
+    return true;
+}
+
+void ScriptWriter::_writeUint8(uint8_t value) {
+    _buffer[_length++] = value;
+}
+
+void ScriptWriter::_writeUint16(uint16_t value) {
+    _writeUint8((uint8_t)value);
+    _writeUint8((uint8_t)(value >> 8));
+}
+
+void ScriptWriter::_writeUint32(uint32_t value) {
+    _writeUint16((uint16_t)value);
+    _writeUint16((uint16_t)(value >> 16));
+}
+
+void ScriptWriter::_writeFloat32(float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    _writeUint32(bits);
+}
+
+/**
+ * Append a tank command
+ */
+ScriptWriter& ScriptWriter::tank(
+    bool useSpeedControl,   // IN : true for speed, false for pwm
+    bool leftForward,       // IN : left wheel direction
+    float left,             // IN : left wheel speed or pwm
+    bool rightForward,      // IN : right wheel direction
+    float right)            // IN : right wheel speed or pwm
+                            // RET: this writer
+{
+    if(_reserve(1 + operandBytes[SCRIPT_TANK])) {
+        _writeUint8(SCRIPT_TANK);
+        _writeUint8((useSpeedControl ? SCRIPT_TANK_SPEED_CONTROL : 0)
+            | (leftForward ? SCRIPT_TANK_LEFT_FORWARD : 0)
+            | (rightForward ? SCRIPT_TANK_RIGHT_FORWARD : 0));
+        _writeFloat32(left);
+        _writeFloat32(right);
+    }
+    return *this;
+}
+
+/**
+ * Append a goto command
+ */
+ScriptWriter& ScriptWriter::go2(
+    float x,            // IN : goal x
+    float y,            // IN : goal y
+    float tolerance,    // IN : distance from goal that counts as arrived
+    float pointForward) // IN : lookahead distance
+                        // RET: this writer
+{
+    if(_reserve(1 + operandBytes[SCRIPT_GOTO])) {
+        _writeUint8(SCRIPT_GOTO);
+        _writeFloat32(x);
+        _writeFloat32(y);
+        _writeFloat32(tolerance);
+        _writeFloat32(pointForward);
+    }
+    return *this;
+}
+
+/**
+ * Append a speed control configuration command
+ */
+ScriptWriter& ScriptWriter::pid(
+    uint8_t wheels,     // IN : bits of wheels to configure
+    float minSpeed,     // IN : minimum measured speed
+    float maxSpeed,     // IN : maximum measured speed
+    float Kp,           // IN : proportional gain
+    float Ki,           // IN : integral gain
+    float Kd)           // IN : derivative gain
+                        // RET: this writer
+{
+    if(_reserve(1 + operandBytes[SCRIPT_PID])) {
+        _writeUint8(SCRIPT_PID);
+        _writeUint8(wheels);
+        _writeFloat32(minSpeed);
+        _writeFloat32(maxSpeed);
+        _writeFloat32(Kp);
+        _writeFloat32(Ki);
+        _writeFloat32(Kd);
+    }
+    return *this;
+}
+
+/**
+ * Append a wait
+ */
+ScriptWriter& ScriptWriter::wait(uint32_t ms) // IN : milliseconds to wait
+                                              // RET: this writer
+{
+    if(_reserve(1 + operandBytes[SCRIPT_WAIT])) {
+        _writeUint8(SCRIPT_WAIT);
+        _writeUint32(ms);
+    }
+    return *this;
+}
+
+/**
+ * Start a repeated block; close it with next()
+ */
+ScriptWriter& ScriptWriter::repeat(uint16_t count) // IN : times to run block; 0 is forever
+                                                   // RET: this writer
+{
+    if(_reserve(1 + operandBytes[SCRIPT_REPEAT])) {
+        _writeUint8(SCRIPT_REPEAT);
+        _writeUint16(count);
+    }
+    return *this;
+}
+
+/**
+ * Close a repeated block
+ */
+ScriptWriter& ScriptWriter::next() // RET: this writer
+{
+    if(_reserve(1)) {
+        _writeUint8(SCRIPT_NEXT);
+    }
+    return *this;
+}
+
+/**
+ * End the script
+ */
+ScriptWriter& ScriptWriter::end() // RET: this writer
+{
+    if(_reserve(1)) {
+        _writeUint8(SCRIPT_END);
+    }
+    return *this;
+}
+
+/**
+ * Check and copy a program.  Stops any running script.
+ */
+int ScriptRunner::load(
+    const uint8_t *bytecode,    // IN : program
+    unsigned int length)        // IN : bytes in program
+                                // RET: SUCCESS if program is valid and fits,
+                                //      FAILURE if not; prior program is cleared
+{
+    stop();
+    _length = 0;
+
+    if((nullptr == bytecode) || (0 == length) || (length > SCRIPT_MAX_BYTES)) {
+        return FAILURE;
+    }
+
+    //
+    // every instruction must be whole, repeats must
+    // nest no deeper than we have frames for, and
+    // the program must finish with SCRIPT_END.
+    // Then poll() can trust the program.
+    //
+    unsigned int pc = 0;
+    int depth = 0;
+    bool ended = false;
+    while(pc < length) {
+        const uint8_t opcode = bytecode[pc];
+        if(opcode >= NUMBER_OF_SCRIPT_OPCODES) {
+            return FAILURE;
+        }
+        if(pc + 1 + operandBytes[opcode] > length) {
+            return FAILURE;
+        }
+        if(SCRIPT_REPEAT == opcode) {
+            if(++depth > (int)SCRIPT_MAX_DEPTH) return FAILURE;
+        } else if(SCRIPT_NEXT == opcode) {
+            if(--depth < 0) return FAILURE;
+        }
+        pc += 1 + operandBytes[opcode];
+        if(SCRIPT_END == opcode) {
+            ended = true;
+            break;
+        }
+    }
+    if(!ended || (0 != depth) || (pc != length)) {
+        return FAILURE;
+    }
+
+    memcpy(_program, bytecode, length);
+    _length = (uint16_t)length;
+    return SUCCESS;
+}
+
+/**
+ * Start the loaded program from the beginning
+ */
+int ScriptRunner::start() // RET: SUCCESS if started, FAILURE if nothing loaded
+{
+    if(!loaded()) {
+        return FAILURE;
+    }
+    _running = true;
+    _pc = 0;
+    _depth = 0;
+    _waiting = false;
+    return SUCCESS;
+}
+
+/**
+ * Stop running
+ */
+ScriptRunner& ScriptRunner::stop() // RET: this runner
+{
+    _running = false;
+    _waiting = false;
+    _depth = 0;
+    return *this;
+}
+
+/**
+ * Run the script until it produces a command,
+ * waits, finishes or uses up its instruction budget.
+ */
+ScriptEvent ScriptRunner::poll(
+    unsigned long currentMillis,    // IN : current time in milliseconds
+    ScriptCommand &command)         // OUT: if SCRIPT_COMMAND, the command
+                                    // RET: SCRIPT_IDLE, SCRIPT_COMMAND or SCRIPT_DONE
+{
+    if(!_running) {
+        return SCRIPT_IDLE;
+    }
+
+    if(_waiting) {
+        if(currentMillis - _waitStartMs < _waitMs) {
+            return SCRIPT_IDLE;
+        }
+        _waiting = false;
+    }
+
+    //
+    // the budget keeps a tight loop, like a repeat
+    // with nothing to wait on, from stalling the
+    // control loop; it picks up again next poll.
+    //
+    for(unsigned int ops = 0; ops < SCRIPT_OPS_PER_POLL; ops += 1) {
+        const uint8_t *instruction = _program + _pc;
+        const uint8_t *operands = instruction + 1;
+        const ScriptOpcode opcode = (ScriptOpcode)instruction[0];
+        _pc += 1 + operandBytes[opcode];
+
+        switch(opcode) {
+            case SCRIPT_TANK: {
+                command = ScriptCommand();
+                command.opcode = opcode;
+                command.flags = operands[0];
+                command.values[0] = readFloat32(operands + 1);
+                command.values[1] = readFloat32(operands + 5);
+                return SCRIPT_COMMAND;
+            }
+            case SCRIPT_GOTO: {
+                command = ScriptCommand();
+                command.opcode = opcode;
+                for(int i = 0; i < 4; i += 1) {
+                    command.values[i] = readFloat32(operands + 4 * i);
+                }
+                return SCRIPT_COMMAND;
+            }
+            case SCRIPT_PID: {
+                command = ScriptCommand();
+                command.opcode = opcode;
+                command.flags = operands[0];
+                for(int i = 0; i < 5; i += 1) {
+                    command.values[i] = readFloat32(operands + 1 + 4 * i);
+                }
+                return SCRIPT_COMMAND;
+            }
+            case SCRIPT_WAIT: {
+                _waitMs = readUint32(operands);
+                _waitStartMs = currentMillis;
+                if(_waitMs > 0) {
+                    _waiting = true;
+                    return SCRIPT_IDLE;
+                }
+                break;
+            }
+            case SCRIPT_REPEAT: {
+                _frames[_depth].bodyPc = _pc;
+                _frames[_depth].remaining = readUint16(operands);
+                _depth += 1;
+                break;
+            }
+            case SCRIPT_NEXT: {
+                RepeatFrame &frame = _frames[_depth - 1];
+                if(0 == frame.remaining) {
+                    _pc = frame.bodyPc;     // forever
+                } else if(--frame.remaining > 0) {
+                    _pc = frame.bodyPc;
+                } else {
+                    _depth -= 1;
+                }
+                break;
+            }
+            default: {  // SCRIPT_END
+                stop();
+                return SCRIPT_DONE;
+            }
+        }
+    }
+    return SCRIPT_IDLE;
+}
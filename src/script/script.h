@@ -0,0 +1,162 @@
+#ifndef SCRIPT_SCRIPT_H
+#define SCRIPT_SCRIPT_H
+
+#include <stdint.h>
+#include "../config.h"
+
+//
+// Scripts are short sequences of rover commands
+// that are uploaded once and then run on the rover,
+// so the client does not have to pace them over wifi.
+// They are compiled to a compact bytecode; all
+// multi-byte operands are little-endian.
+//
+// instruction: [opcode: uint8][operands...]
+//
+typedef enum {
+    SCRIPT_END = 0,     // stop running; no operands
+    SCRIPT_TANK,        // [flags: uint8][left: float32][right: float32]
+    SCRIPT_GOTO,        // [x: float32][y: float32][tolerance: float32][pointForward: float32]
+    SCRIPT_PID,         // [wheels: uint8][minSpeed: float32][maxSpeed: float32][Kp: float32][Ki: float32][Kd: float32]
+    SCRIPT_WAIT,        // [milliseconds: uint32]
+    SCRIPT_REPEAT,      // [count: uint16]; 0 repeats until stopped
+    SCRIPT_NEXT,        // end of repeat body; no operands
+    NUMBER_OF_SCRIPT_OPCODES,   // SHOULD ALWAYS BE LAST
+} ScriptOpcode;
+
+// SCRIPT_TANK flags
+const uint8_t SCRIPT_TANK_SPEED_CONTROL = 0x01;  // values are speeds, else pwm values
+const uint8_t SCRIPT_TANK_LEFT_FORWARD = 0x02;
+const uint8_t SCRIPT_TANK_RIGHT_FORWARD = 0x04;
+
+//
+// a decoded command instruction; the control loop
+// turns it into a rover command and executes it.
+//
+typedef struct ScriptCommand {
+    ScriptCommand(): opcode(SCRIPT_END), flags(0), values{0, 0, 0, 0, 0} {};
+
+    ScriptOpcode opcode;    // SCRIPT_TANK, SCRIPT_GOTO or SCRIPT_PID
+    uint8_t flags;          // tank flags or pid wheels
+    float values[5];        // float operands in instruction order
+} ScriptCommand;
+
+/**
+ * Write bytecode into a caller's buffer.
+ * If the buffer fills, further writes are
+ * dropped and ok() returns false.
+ */
+class ScriptWriter {
+    private:
+    uint8_t *_buffer;
+    unsigned int _size;
+    unsigned int _length = 0;
+    bool _overflow = false;
+
+    bool _reserve(unsigned int bytes);
+    void _writeUint8(uint8_t value);
+    void _writeUint16(uint16_t value);
+    void _writeUint32(uint32_t value);
+    void _writeFloat32(float value);
+
+    public:
+
+    ScriptWriter(
+        uint8_t *buffer,    // IN : buffer to write bytecode into
+        unsigned int size)  // IN : bytes in buffer
+        : _buffer(buffer), _size(size)
+    {
+    }
+
+    const uint8_t *bytecode() const { return _buffer; }
+    unsigned int length() const { return _length; }
+    bool ok() const { return !_overflow; }
+
+    ScriptWriter& tank(bool useSpeedControl, bool leftForward, float left, bool rightForward, float right);
+    ScriptWriter& go2(float x, float y, float tolerance, float pointForward);
+    ScriptWriter& pid(uint8_t wheels, float minSpeed, float maxSpeed, float Kp, float Ki, float Kd);
+    ScriptWriter& wait(uint32_t ms);
+    ScriptWriter& repeat(uint16_t count);
+    ScriptWriter& next();
+    ScriptWriter& end();
+};
+
+typedef enum {
+    SCRIPT_IDLE,        // nothing to do this tick
+    SCRIPT_COMMAND,     // execute the returned command
+    SCRIPT_DONE,        // script finished this tick
+} ScriptEvent;
+
+/**
+ * Run a bytecode script a little at a time
+ * from the control loop.  The program is copied
+ * into a fixed buffer and checked when it is
+ * loaded, so running it needs no heap and no
+ * bounds checks, and each poll() executes at
+ * most SCRIPT_OPS_PER_POLL instructions.
+ */
+class ScriptRunner {
+    private:
+    typedef struct RepeatFrame {
+        uint16_t bodyPc;        // first instruction of repeat body
+        uint16_t remaining;     // times left to run body; 0 is forever
+    } RepeatFrame;
+
+    uint8_t _program[SCRIPT_MAX_BYTES];
+    uint16_t _length = 0;
+
+    bool _running = false;
+    uint16_t _pc = 0;                   // next instruction
+    RepeatFrame _frames[SCRIPT_MAX_DEPTH];
+    uint8_t _depth = 0;                 // number of active repeats
+    bool _waiting = false;
+    unsigned long _waitStartMs = 0;
+    unsigned long _waitMs = 0;
+
+    public:
+
+    /**
+     * Check and copy a program.  Stops any running script.
+     */
+    int load(
+        const uint8_t *bytecode,    // IN : program
+        unsigned int length);       // IN : bytes in program
+                                    // RET: SUCCESS if program is valid and fits,
+                                    //      FAILURE if not; prior program is cleared
+
+    /**
+     * Determine if a program is loaded
+     */
+    bool loaded() const { return _length > 0; }
+
+    /**
+     * Number of bytes in the loaded program
+     */
+    unsigned int length() const { return _length; }
+
+    /**
+     * Determine if the script is running
+     */
+    bool running() const { return _running; }
+
+    /**
+     * Start the loaded program from the beginning
+     */
+    int start(); // RET: SUCCESS if started, FAILURE if nothing loaded
+
+    /**
+     * Stop running
+     */
+    ScriptRunner& stop(); // RET: this runner
+
+    /**
+     * Run the script until it produces a command,
+     * waits, finishes or uses up its instruction budget.
+     */
+    ScriptEvent poll(
+        unsigned long currentMillis,    // IN : current time in milliseconds
+        ScriptCommand &command);        // OUT: if SCRIPT_COMMAND, the command
+                                        // RET: SCRIPT_IDLE, SCRIPT_COMMAND or SCRIPT_DONE
+};
+
+#endif // SCRIPT_SCRIPT_H
@@ -0,0 +1,64 @@
+#include <stdio.h>
+#include "settings_storage.h"
+#include "../string/strcopy.h"
+#include "../error.h"
+
+FileSettingsStorage::FileSettingsStorage(const char *directory) // IN : existing directory to hold settings files
+{
+    strCopy(_directory, sizeof(_directory), directory);
+}
+
+/**
+ * Get the file path for a key
+ */
+void FileSettingsStorage::_path(const char *key, char *path, unsigned int size) {
+    int offset = strCopy(path, size, _directory);
+    offset = strCopyAt(path, size, offset, "/");
+    offset = strCopyAt(path, size, offset, key);
+    strCopyAt(path, size, offset, ".bin");
+}
+
+/**
+ * Read a record
+ */
+int FileSettingsStorage::read(
+    const char *key,        // IN : record key
+    void *value,            // OUT: record bytes
+    unsigned int size)      // IN : expected record size in bytes
+                            // RET: SUCCESS if a record of exactly size bytes was read,
+                            //      FAILURE if missing or a different size
+{
+    char path[PATH_CHARS + 32];
+    _path(key, path, sizeof(path));
+
+    FILE *file = fopen(path, "rb");
+    if(nullptr == file) {
+        return FAILURE;
+    }
+
+    // read one extra byte to detect a record of a different size
+    char extra;
+    const bool ok = (fread(value, 1, size, file) == size) && (0 == fread(&extra, 1, 1, file));
+    fclose(file);
+    return ok ? SUCCESS : FAILURE;
+}
+
+/**
+ * Write a record
+ */
+int FileSettingsStorage::write(
+    const char *key,        // IN : record key
+    const void *value,      // IN : record bytes
+    unsigned int size)      // IN : record size in bytes
+                            // RET: SUCCESS or FAILURE
+{
+    char path[PATH_CHARS + 32];
+    _path(key, path, sizeof(path));
+
+    FILE *file = fopen(path, "wb");
+    if(nullptr == file) {
+        return FAILURE;
+    }
+    const bool ok = (fwrite(value, 1, size, file) == size);
+    return ((0 == fclose(file)) && ok) ? SUCCESS : FAILURE;
+}
@@ -0,0 +1,42 @@
+#ifndef TESTING
+
+#include "settings_storage.h"
+#include "../error.h"
+
+/**
+ * Read a record
+ */
+int PreferencesSettingsStorage::read(
+    const char *key,        // IN : record key
+    void *value,            // OUT: record bytes
+    unsigned int size)      // IN : expected record size in bytes
+                            // RET: SUCCESS if a record of exactly size bytes was read,
+                            //      FAILURE if missing or a different size
+{
+    if(!_preferences.begin(_namespace, true)) {
+        return FAILURE;
+    }
+    const bool ok = (_preferences.getBytesLength(key) == size)
+        && (_preferences.getBytes(key, value, size) == size);
+    _preferences.end();
+    return ok ? SUCCESS : FAILURE;
+}
+
+/**
+ * Write a record
+ */
+int PreferencesSettingsStorage::write(
+    const char *key,        // IN : record key
+    const void *value,      // IN : record bytes
+    unsigned int size)      // IN : record size in bytes
+                            // RET: SUCCESS or FAILURE
+{
+    if(!_preferences.begin(_namespace, false)) {
+        return FAILURE;
+    }
+    const bool ok = (_preferences.putBytes(key, value, size) == size);
+    _preferences.end();
+    return ok ? SUCCESS : FAILURE;
+}
+
+#endif // TESTING
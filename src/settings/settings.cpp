@@ -0,0 +1,274 @@
+#include <string.h>
+#include "settings.h"
+#include "../config.h"
+#include "../error.h"
+
+const char *SettingsGroupStr[NUMBER_OF_SETTINGS_GROUPS] = {
+    "leftPid",
+    "rightPid",
+    "stall",
+    "camera",
+    "command",
+};
+
+const char *CameraSettingStr[NUMBER_OF_CAMERA_SETTINGS] = {
+    "framesize",
+    "quality",
+    "brightness",
+    "contrast",
+    "saturation",
+    "special_effect",
+    "wb_mode",
+    "awb",
+    "aec",
+    "agc",
+    "ae_level",
+    "hmirror",
+    "vflip",
+};
+
+/**
+ * Find a kept camera property by name
+ */
+int findCameraSetting(const char *name) // IN : camera property name, like "framesize"
+                                        // RET: CameraSetting, or -1 if not kept
+{
+    if(nullptr != name) {
+        for(int i = 0; i < NUMBER_OF_CAMERA_SETTINGS; i += 1) {
+            if(0 == strcmp(name, CameraSettingStr[i])) {
+                return i;
+            }
+        }
+    }
+    return -1;
+}
+
+//
+// a stored record is [version: uint16][settings struct]
+//
+static const unsigned int SETTINGS_RECORD_BYTES = 64;
+static_assert(sizeof(uint16_t) + sizeof(CameraSettings) <= SETTINGS_RECORD_BYTES, "SETTINGS_RECORD_BYTES is too small");
+
+Settings::Settings() : _dirty(0), _revision(0) {
+    memset(&_values, 0, sizeof(_values));
+}
+
+/**
+ * Determine if storage is attached
+ */
+bool Settings::attached() // RET: true if attached, false if not
+{
+    return nullptr != _storage;
+}
+
+/**
+ * Attach storage
+ */
+Settings& Settings::attach(SettingsStorage &storage) // IN : storage for settings records
+                                                     // RET: this instance in attached state
+{
+    if(!attached()) {
+        _storage = &storage;
+    }
+    return *this;
+}
+
+/**
+ * Detach storage
+ */
+Settings& Settings::detach() // RET: this instance in detached state
+{
+    if(attached()) {
+        _storage = nullptr;
+    }
+    return *this;
+}
+
+/**
+ * Get the in-memory struct for a record
+ */
+void *Settings::_record(SettingsGroup group, unsigned int *size) {
+    switch(group) {
+        case SETTINGS_LEFT_PID:  *size = sizeof(_values.leftPid); return &_values.leftPid;
+        case SETTINGS_RIGHT_PID: *size = sizeof(_values.rightPid); return &_values.rightPid;
+        case SETTINGS_STALL:     *size = sizeof(_values.stall); return &_values.stall;
+        case SETTINGS_CAMERA:    *size = sizeof(_values.camera); return &_values.camera;
+        case SETTINGS_COMMAND:   *size = sizeof(_values.command); return &_values.command;
+        default:                 *size = 0; return nullptr;
+    }
+}
+
+/**
+ * Mark a record changed
+ */
+void Settings::_changed(SettingsGroup group, unsigned long currentMillis) {
+    _saved |= settingsBit(group);
+    _changedMs = currentMillis;
+    _dirty.fetch_or(settingsBit(group));
+    _revision.fetch_add(1);
+}
+
+/**
+ * Read all records from storage
+ */
+int Settings::load() // RET: SUCCESS if attached, FAILURE if not
+{
+    if(!attached()) {
+        return FAILURE;
+    }
+
+    _loaded = 0;
+    for(int group = 0; group < NUMBER_OF_SETTINGS_GROUPS; group += 1) {
+        unsigned int size;
+        void *value = _record((SettingsGroup)group, &size);
+
+        uint8_t record[SETTINGS_RECORD_BYTES];
+        if(SUCCESS == _storage->read(SettingsGroupStr[group], record, sizeof(uint16_t) + size)) {
+            uint16_t version;
+            memcpy(&version, record, sizeof(version));
+            if(SETTINGS_VERSION == version) {
+                memcpy(value, record + sizeof(version), size);
+                _loaded |= settingsBit((SettingsGroup)group);
+            }
+        }
+    }
+    _saved |= _loaded;
+    _revision.fetch_add(1);
+    return SUCCESS;
+}
+
+Settings& Settings::setSpeedControl(
+    unsigned int wheels,        // IN : WheelId bits; LEFT_WHEEL (0x01), RIGHT_WHEEL (0x02)
+    float minSpeed,             // IN : minimum measured speed
+    float maxSpeed,             // IN : maximum measured speed
+    float Kp,                   // IN : proportional gain
+    float Ki,                   // IN : integral gain
+    float Kd,                   // IN : derivative gain
+    unsigned long currentMillis)    // IN : current time in milliseconds
+                                    // RET: this instance
+{
+    const PidSettings pid = {minSpeed, maxSpeed, Kp, Ki, Kd};
+    if((wheels & 0x01) && ((0 != memcmp(&pid, &_values.leftPid, sizeof(pid))) || !(_saved & settingsBit(SETTINGS_LEFT_PID)))) {
+        _values.leftPid = pid;
+        _changed(SETTINGS_LEFT_PID, currentMillis);
+    }
+    if((wheels & 0x02) && ((0 != memcmp(&pid, &_values.rightPid, sizeof(pid))) || !(_saved & settingsBit(SETTINGS_RIGHT_PID)))) {
+        _values.rightPid = pid;
+        _changed(SETTINGS_RIGHT_PID, currentMillis);
+    }
+    return *this;
+}
+
+Settings& Settings::setStall(
+    float left,                 // IN : 0 to 1 fraction of max pwm
+    float right,                // IN : 0 to 1 fraction of max pwm
+    unsigned long currentMillis)    // IN : current time in milliseconds
+                                    // RET: this instance
+{
+    if((left != _values.stall.left) || (right != _values.stall.right) || !(_saved & settingsBit(SETTINGS_STALL))) {
+        _values.stall.left = left;
+        _values.stall.right = right;
+        _changed(SETTINGS_STALL, currentMillis);
+    }
+    return *this;
+}
+
+int Settings::setCamera(
+    const char *name,           // IN : camera property name, like "framesize"
+    int value,                  // IN : property value
+    unsigned long currentMillis)    // IN : current time in milliseconds
+                                    // RET: SUCCESS if property is one that is kept,
+                                    //      FAILURE if not
+{
+    const int i = findCameraSetting(name);
+    if(i < 0) {
+        return FAILURE;
+    }
+    const uint32_t bit = 1u << i;
+    if((value != _values.camera.values[i]) || !(_values.camera.set & bit)) {
+        _values.camera.values[i] = (int16_t)value;
+        _values.camera.set |= bit;
+        _changed(SETTINGS_CAMERA, currentMillis);
+    }
+    return SUCCESS;
+}
+
+int Settings::queueCamera(
+    const char *name,           // IN : camera property name, like "framesize"
+    int value,                  // IN : property value
+    unsigned long currentMillis)    // IN : current time in milliseconds
+                                    // RET: SUCCESS if property is one that is kept,
+                                    //      FAILURE if not or the queue is full
+{
+    const int i = findCameraSetting(name);
+    if(i < 0) {
+        return FAILURE;
+    }
+    const CameraSettingChange change = {(CameraSetting)i, (int16_t)value, currentMillis};
+    return _cameraQueue.push(change) ? SUCCESS : FAILURE;
+}
+
+Settings& Settings::setDeadmanTimeout(
+    unsigned long timeoutMs,    // IN : deadman timeout; 0 disables
+    unsigned long currentMillis)    // IN : current time in milliseconds
+                                    // RET: this instance
+{
+    if((timeoutMs != _values.command.deadmanTimeoutMs) || !(_saved & settingsBit(SETTINGS_COMMAND))) {
+        _values.command.deadmanTimeoutMs = (uint32_t)timeoutMs;
+        _changed(SETTINGS_COMMAND, currentMillis);
+    }
+    return *this;
+}
+
+/**
+ * Apply queued camera changes, then write
+ * dirty records once changes have settled
+ */
+int Settings::poll(unsigned long currentMillis) // IN : current time in milliseconds
+                                                // RET: number of records written
+{
+    CameraSettingChange change;
+    while(_cameraQueue.pop(change)) {
+        setCamera(CameraSettingStr[change.setting], change.value, change.changedMs);
+    }
+
+    if((0 == _dirty.load()) || (currentMillis - _changedMs < SETTINGS_DEBOUNCE_MS)) {
+        return 0;
+    }
+    const int written = flush();
+    if(0 != _dirty.load()) {
+        // a write failed; back off before trying again
+        _changedMs = currentMillis;
+    }
+    return written;
+}
+
+/**
+ * Write dirty records now
+ */
+int Settings::flush() // RET: number of records written
+{
+    if(!attached()) {
+        return 0;
+    }
+
+    int written = 0;
+    const unsigned int dirty = _dirty.exchange(0);
+    for(int group = 0; group < NUMBER_OF_SETTINGS_GROUPS; group += 1) {
+        if(dirty & settingsBit((SettingsGroup)group)) {
+            unsigned int size;
+            const void *value = _record((SettingsGroup)group, &size);
+
+            uint8_t record[SETTINGS_RECORD_BYTES];
+            memcpy(record, &SETTINGS_VERSION, sizeof(SETTINGS_VERSION));
+            memcpy(record + sizeof(SETTINGS_VERSION), value, size);
+            if(SUCCESS == _storage->write(SettingsGroupStr[group], record, sizeof(SETTINGS_VERSION) + size)) {
+                written += 1;
+            } else {
+                // try again next time
+                _dirty.fetch_or(settingsBit((SettingsGroup)group));
+            }
+        }
+    }
+    return written;
+}
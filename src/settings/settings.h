@@ -0,0 +1,238 @@
+#ifndef SETTINGS_SETTINGS_H
+#define SETTINGS_SETTINGS_H
+
+#include <stdint.h>
+#include <atomic>
+#include "settings_storage.h"
+#include "../util/spsc_queue.h"
+
+//
+// Bump when the layout of any settings record changes;
+// records with another version are ignored on load,
+// so the rover starts with its compiled-in defaults.
+//
+const uint16_t SETTINGS_VERSION = 1;
+
+//
+// settings are stored as independent records
+// so a change only rewrites its own record
+//
+typedef enum {
+    SETTINGS_LEFT_PID,      // left wheel speed control calibration
+    SETTINGS_RIGHT_PID,     // right wheel speed control calibration
+    SETTINGS_STALL,         // motor stall values
+    SETTINGS_CAMERA,        // camera profile
+    SETTINGS_COMMAND,       // command handling, like deadman timeout
+    NUMBER_OF_SETTINGS_GROUPS,  // SHOULD ALWAYS BE LAST
+} SettingsGroup;
+
+extern const char *SettingsGroupStr[NUMBER_OF_SETTINGS_GROUPS];   // also the storage keys
+
+inline unsigned int settingsBit(SettingsGroup group) { return 1u << group; }
+
+typedef struct PidSettings {
+    float minSpeed;     // minimum measured speed below which motor stalls
+    float maxSpeed;     // maximum measured speed
+    float Kp;           // proportional gain
+    float Ki;           // integral gain
+    float Kd;           // derivative gain
+} PidSettings;
+
+typedef struct StallSettings {
+    float left;         // 0 to 1 fraction of max pwm
+    float right;        // 0 to 1 fraction of max pwm
+} StallSettings;
+
+//
+// camera properties that are kept, by name
+// as used by setCameraProperty()
+//
+typedef enum {
+    CAMERA_FRAMESIZE,
+    CAMERA_QUALITY,
+    CAMERA_BRIGHTNESS,
+    CAMERA_CONTRAST,
+    CAMERA_SATURATION,
+    CAMERA_SPECIAL_EFFECT,
+    CAMERA_WB_MODE,
+    CAMERA_AWB,
+    CAMERA_AEC,
+    CAMERA_AGC,
+    CAMERA_AE_LEVEL,
+    CAMERA_HMIRROR,
+    CAMERA_VFLIP,
+    NUMBER_OF_CAMERA_SETTINGS,  // SHOULD ALWAYS BE LAST
+} CameraSetting;
+
+extern const char *CameraSettingStr[NUMBER_OF_CAMERA_SETTINGS];
+
+typedef struct CameraSettings {
+    uint32_t set;                               // bit per CameraSetting that has a value
+    int16_t values[NUMBER_OF_CAMERA_SETTINGS];
+} CameraSettings;
+
+/**
+ * Find a kept camera property by name
+ */
+int findCameraSetting(const char *name);    // IN : camera property name, like "framesize"
+                                            // RET: CameraSetting, or -1 if not kept
+
+//
+// camera change from another task,
+// waiting to be applied by Settings::poll()
+//
+typedef struct CameraSettingChange {
+    CameraSetting setting;
+    int16_t value;
+    unsigned long changedMs;    // when the change was made
+} CameraSettingChange;
+
+const unsigned int CAMERA_SETTING_QUEUE_LENGTH = 16;   // power of two; room for a change to every setting
+
+typedef struct CommandSettings {
+    uint32_t deadmanTimeoutMs;  // 0 disables deadman
+} CommandSettings;
+
+typedef struct RoverSettings {
+    PidSettings leftPid;
+    PidSettings rightPid;
+    StallSettings stall;
+    CameraSettings camera;
+    CommandSettings command;
+} RoverSettings;
+
+/**
+ * Rover settings that survive a restart.
+ *
+ * Setters record values in memory and mark their
+ * record dirty; poll() writes only dirty records,
+ * and only once changes have been quiet for
+ * SETTINGS_DEBOUNCE_MS, so a client sweeping a
+ * slider does not wear out the flash.  Setting
+ * a value it already has does nothing.
+ *
+ * Settings are read and written only on the loop
+ * task; queueCamera() is the one method that may be
+ * called from another task, like a web handler.
+ */
+class Settings {
+    private:
+    SettingsStorage *_storage = nullptr;
+    RoverSettings _values;
+    unsigned int _loaded = 0;               // bit per record read by load()
+    unsigned int _saved = 0;                // bit per record that has a value
+    std::atomic<unsigned int> _dirty;       // bit per record to write
+    unsigned long _changedMs = 0;           // when last change was made
+    std::atomic<uint32_t> _revision;        // incremented on every change
+    SpscQueue<CameraSettingChange, CAMERA_SETTING_QUEUE_LENGTH> _cameraQueue;  // produced by queueCamera(), consumed by poll()
+
+    void _changed(SettingsGroup group, unsigned long currentMillis);
+    void *_record(SettingsGroup group, unsigned int *size);
+
+    public:
+
+    Settings();
+
+    /**
+     * Determine if storage is attached
+     */
+    bool attached(); // RET: true if attached, false if not
+
+    /**
+     * Attach storage
+     */
+    Settings& attach(SettingsStorage &storage); // IN : storage for settings records
+                                                // RET: this instance in attached state
+
+    /**
+     * Detach storage
+     */
+    Settings& detach(); // RET: this instance in detached state
+
+    /**
+     * Read all records from storage
+     */
+    int load(); // RET: SUCCESS if attached, FAILURE if not
+
+    /**
+     * Records read by load(); apply only these,
+     * others keep the compiled-in defaults.
+     */
+    unsigned int loaded() const { return _loaded; }
+
+    /**
+     * Records that have a value, either
+     * loaded or set since startup.
+     */
+    unsigned int saved() const { return _saved; }
+
+    /**
+     * Current values
+     */
+    const RoverSettings& values() const { return _values; }
+
+    /**
+     * Records changed but not yet written
+     */
+    unsigned int dirty() const { return _dirty.load(); }
+
+    /**
+     * Count of changes since startup; use it
+     * to tell if cached copies are stale.
+     */
+    uint32_t revision() const { return _revision.load(); }
+
+    Settings& setSpeedControl(
+        unsigned int wheels,        // IN : WheelId bits; LEFT_WHEEL (0x01), RIGHT_WHEEL (0x02)
+        float minSpeed,             // IN : minimum measured speed
+        float maxSpeed,             // IN : maximum measured speed
+        float Kp,                   // IN : proportional gain
+        float Ki,                   // IN : integral gain
+        float Kd,                   // IN : derivative gain
+        unsigned long currentMillis);   // IN : current time in milliseconds
+                                        // RET: this instance
+
+    Settings& setStall(
+        float left,                 // IN : 0 to 1 fraction of max pwm
+        float right,                // IN : 0 to 1 fraction of max pwm
+        unsigned long currentMillis);   // IN : current time in milliseconds
+                                        // RET: this instance
+
+    int setCamera(
+        const char *name,           // IN : camera property name, like "framesize"
+        int value,                  // IN : property value
+        unsigned long currentMillis);   // IN : current time in milliseconds
+                                        // RET: SUCCESS if property is one that is kept,
+                                        //      FAILURE if not
+
+    /**
+     * Set a camera property from another task; the
+     * change is applied on the next poll().
+     * Call only from a single producer task.
+     */
+    int queueCamera(
+        const char *name,           // IN : camera property name, like "framesize"
+        int value,                  // IN : property value
+        unsigned long currentMillis);   // IN : current time in milliseconds
+                                        // RET: SUCCESS if property is one that is kept,
+                                        //      FAILURE if not or the queue is full
+
+    Settings& setDeadmanTimeout(
+        unsigned long timeoutMs,    // IN : deadman timeout; 0 disables
+        unsigned long currentMillis);   // IN : current time in milliseconds
+                                        // RET: this instance
+
+    /**
+     * Apply queued camera changes, then write
+     * dirty records once changes have settled
+     */
+    int poll(unsigned long currentMillis);  // IN : current time in milliseconds
+                                            // RET: number of records written
+
+    /**
+     * Write dirty records now
+     */
+    int flush(); // RET: number of records written
+};
+
+#endif // SETTINGS_SETTINGS_H
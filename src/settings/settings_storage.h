@@ -0,0 +1,76 @@
+#ifndef SETTINGS_SETTINGS_STORAGE_H
+#define SETTINGS_SETTINGS_STORAGE_H
+
+/**
+ * Key/value storage for settings records.
+ * Keys are short (NVS allows 15 chars)
+ * and values are small blobs.
+ */
+class SettingsStorage {
+    public:
+    virtual ~SettingsStorage() {}
+
+    /**
+     * Read a record
+     */
+    virtual int read(
+        const char *key,        // IN : record key
+        void *value,            // OUT: record bytes
+        unsigned int size) = 0; // IN : expected record size in bytes
+                                // RET: SUCCESS if a record of exactly size bytes was read,
+                                //      FAILURE if missing or a different size
+
+    /**
+     * Write a record
+     */
+    virtual int write(
+        const char *key,        // IN : record key
+        const void *value,      // IN : record bytes
+        unsigned int size) = 0; // IN : record size in bytes
+                                // RET: SUCCESS or FAILURE
+};
+
+/**
+ * Settings stored as one file per key in a directory;
+ * used on the host for tests and simulation.
+ */
+class FileSettingsStorage : public SettingsStorage {
+    private:
+    static const unsigned int PATH_CHARS = 128;
+    char _directory[PATH_CHARS];
+
+    void _path(const char *key, char *path, unsigned int size);
+
+    public:
+
+    FileSettingsStorage(const char *directory); // IN : existing directory to hold settings files
+
+    virtual int read(const char *key, void *value, unsigned int size);
+    virtual int write(const char *key, const void *value, unsigned int size);
+};
+
+#ifndef TESTING
+    #include <Preferences.h>
+
+    /**
+     * Settings stored in ESP32 non-volatile storage
+     * using the Preferences library.
+     */
+    class PreferencesSettingsStorage : public SettingsStorage {
+        private:
+        const char *_namespace;
+        Preferences _preferences;
+
+        public:
+
+        PreferencesSettingsStorage(const char *name) // IN : nvs namespace; at most 15 chars
+            : _namespace(name)
+        {
+        }
+
+        virtual int read(const char *key, void *value, unsigned int size);
+        virtual int write(const char *key, const void *value, unsigned int size);
+    };
+#endif
+
+#endif // SETTINGS_SETTINGS_STORAGE_H
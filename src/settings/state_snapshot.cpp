@@ -0,0 +1,145 @@
+#include <string.h>
+#include "state_snapshot.h"
+#include "../string/strcopy.h"
+#include "../string/json.h"
+#include "../config.h"
+
+/**
+ * copy pid calibration fields into json object
+ */
+static int jsonPidAt(char *buffer, int sizeOfBuffer, int offset, const char *name, const PidSettings &pid) {
+    offset = jsonOpenObjectAt(buffer, sizeOfBuffer, offset, name);
+        offset = jsonFloatAt(buffer, sizeOfBuffer, offset, "minSpeed", pid.minSpeed);
+        offset = strCopyAt(buffer, sizeOfBuffer, offset, ",");
+        offset = jsonFloatAt(buffer, sizeOfBuffer, offset, "maxSpeed", pid.maxSpeed);
+        offset = strCopyAt(buffer, sizeOfBuffer, offset, ",");
+        offset = jsonFloatAt(buffer, sizeOfBuffer, offset, "Kp", pid.Kp);
+        offset = strCopyAt(buffer, sizeOfBuffer, offset, ",");
+        offset = jsonFloatAt(buffer, sizeOfBuffer, offset, "Ki", pid.Ki);
+        offset = strCopyAt(buffer, sizeOfBuffer, offset, ",");
+        offset = jsonFloatAt(buffer, sizeOfBuffer, offset, "Kd", pid.Kd);
+    return jsonCloseObjectAt(buffer, sizeOfBuffer, offset);
+}
+
+/**
+ * Format the full rover state as wrapped json
+ */
+int formatStateSnapshot(
+    char *buffer,                   // OUT: formatted snapshot
+    int sizeOfBuffer,               // IN : size of buffer in bytes
+    const Settings &settings,       // IN : current settings
+    const SnapshotState &state)     // IN : current rover state
+                                    // RET: offset after formatted snapshot
+{
+    const unsigned int saved = settings.saved();
+    const RoverSettings &values = settings.values();
+
+    int offset = strCopy(buffer, sizeOfBuffer, "state({");
+        offset = jsonULongAt(buffer, sizeOfBuffer, offset, "revision", settings.revision());
+        offset = strCopyAt(buffer, sizeOfBuffer, offset, ",");
+
+        // mode
+        offset = jsonOpenObjectAt(buffer, sizeOfBuffer, offset, "speedControl");
+            offset = jsonBoolAt(buffer, sizeOfBuffer, offset, "left", state.leftSpeedControl);
+            offset = strCopyAt(buffer, sizeOfBuffer, offset, ",");
+            offset = jsonBoolAt(buffer, sizeOfBuffer, offset, "right", state.rightSpeedControl);
+        offset = jsonCloseObjectAt(buffer, sizeOfBuffer, offset);
+        offset = strCopyAt(buffer, sizeOfBuffer, offset, ",");
+        offset = jsonStringAt(buffer, sizeOfBuffer, offset, "goal", (nullptr != state.goalState) ? state.goalState : "");
+        offset = strCopyAt(buffer, sizeOfBuffer, offset, ",");
+        offset = jsonStringAt(buffer, sizeOfBuffer, offset, "script", (nullptr != state.scriptState) ? state.scriptState : "");
+        offset = strCopyAt(buffer, sizeOfBuffer, offset, ",");
+
+        // telemetry rates are fixed at compile time
+        offset = jsonOpenObjectAt(buffer, sizeOfBuffer, offset, "rates");
+            offset = jsonULongAt(buffer, sizeOfBuffer, offset, "control", CONTROL_POLL_MS);
+            offset = strCopyAt(buffer, sizeOfBuffer, offset, ",");
+            offset = jsonULongAt(buffer, sizeOfBuffer, offset, "pose", POSE_POLL_MS);
+            offset = strCopyAt(buffer, sizeOfBuffer, offset, ",");
+            offset = jsonULongAt(buffer, sizeOfBuffer, offset, "latency", LATENCY_REPORT_MS);
+        offset = jsonCloseObjectAt(buffer, sizeOfBuffer, offset);
+        offset = strCopyAt(buffer, sizeOfBuffer, offset, ",");
+
+        offset = jsonULongAt(buffer, sizeOfBuffer, offset, "deadman",
+            (saved & settingsBit(SETTINGS_COMMAND)) ? values.command.deadmanTimeoutMs : DEADMAN_TIMEOUT_MS);
+
+        // calibration
+        if(saved & settingsBit(SETTINGS_LEFT_PID)) {
+            offset = strCopyAt(buffer, sizeOfBuffer, offset, ",");
+            offset = jsonPidAt(buffer, sizeOfBuffer, offset, "leftPid", values.leftPid);
+        }
+        if(saved & settingsBit(SETTINGS_RIGHT_PID)) {
+            offset = strCopyAt(buffer, sizeOfBuffer, offset, ",");
+            offset = jsonPidAt(buffer, sizeOfBuffer, offset, "rightPid", values.rightPid);
+        }
+        if(saved & settingsBit(SETTINGS_STALL)) {
+            offset = strCopyAt(buffer, sizeOfBuffer, offset, ",");
+            offset = jsonOpenObjectAt(buffer, sizeOfBuffer, offset, "stall");
+                offset = jsonFloatAt(buffer, sizeOfBuffer, offset, "left", values.stall.left);
+                offset = strCopyAt(buffer, sizeOfBuffer, offset, ",");
+                offset = jsonFloatAt(buffer, sizeOfBuffer, offset, "right", values.stall.right);
+            offset = jsonCloseObjectAt(buffer, sizeOfBuffer, offset);
+        }
+
+        // camera profile
+        if(0 != values.camera.set) {
+            offset = strCopyAt(buffer, sizeOfBuffer, offset, ",");
+            offset = jsonOpenObjectAt(buffer, sizeOfBuffer, offset, "camera");
+                bool first = true;
+                for(int i = 0; i < NUMBER_OF_CAMERA_SETTINGS; i += 1) {
+                    if(values.camera.set & (1u << i)) {
+                        if(!first) offset = strCopyAt(buffer, sizeOfBuffer, offset, ",");
+                        offset = jsonIntAt(buffer, sizeOfBuffer, offset, CameraSettingStr[i], values.camera.values[i]);
+                        first = false;
+                    }
+                }
+            offset = jsonCloseObjectAt(buffer, sizeOfBuffer, offset);
+        }
+    offset = strCopyAt(buffer, sizeOfBuffer, offset, "})");
+
+    return offset;
+}
+
+static bool sameString(const char *a, const char *b) {
+    if((nullptr == a) || (nullptr == b)) return a == b;
+    return 0 == strcmp(a, b);
+}
+
+bool StateSnapshot::_sameState(const SnapshotState &state) const {
+    return (state.leftSpeedControl == _state.leftSpeedControl)
+        && (state.rightSpeedControl == _state.rightSpeedControl)
+        && sameString(state.goalState, _state.goalState)
+        && sameString(state.scriptState, _state.scriptState);
+}
+
+/**
+ * Get the snapshot, encoding it if stale
+ */
+const char *StateSnapshot::snapshot(
+    const Settings &settings,       // IN : current settings
+    const SnapshotState &state,     // IN : current rover state
+    int *length)                    // OUT: length of snapshot in chars
+                                    // RET: null terminated snapshot
+{
+    const uint32_t revision = settings.revision();
+    if(!_valid || (revision != _revision) || !_sameState(state)) {
+        _length = formatStateSnapshot(_buffer, sizeof(_buffer), settings, state);
+        _revision = revision;
+        _state = state;
+        _valid = true;
+        _encodes += 1;
+    }
+    if(nullptr != length) {
+        *length = _length;
+    }
+    return _buffer;
+}
+
+/**
+ * Force the next snapshot() to encode
+ */
+StateSnapshot& StateSnapshot::invalidate() // RET: this instance
+{
+    _valid = false;
+    return *this;
+}
@@ -0,0 +1,73 @@
+#ifndef SETTINGS_STATE_SNAPSHOT_H
+#define SETTINGS_STATE_SNAPSHOT_H
+
+#include <stdint.h>
+#include "settings.h"
+
+//
+// rover state that is not a setting,
+// but that a client needs to render
+//
+typedef struct SnapshotState {
+    bool leftSpeedControl;      // true if left wheel is under speed control
+    bool rightSpeedControl;     // true if right wheel is under speed control
+    const char *goalState;      // goto goal state, like "RUNNING"
+    const char *scriptState;    // script state, like "STOPPED"
+} SnapshotState;
+
+/**
+ * Format the full rover state as wrapped json,
+ * like 'state({"revision":3,"speedControl":{...},...})'.
+ * Calibration, stall and camera are only included
+ * if they have a value.
+ */
+extern int formatStateSnapshot(
+    char *buffer,                   // OUT: formatted snapshot
+    int sizeOfBuffer,               // IN : size of buffer in bytes
+    const Settings &settings,       // IN : current settings
+    const SnapshotState &state);    // IN : current rover state
+                                    // RET: offset after formatted snapshot
+
+/**
+ * Full state snapshot sent to a client when it connects,
+ * so it can render without querying each setting.
+ *
+ * The snapshot is encoded once and reused until
+ * a setting or the rover state changes.
+ */
+class StateSnapshot {
+    private:
+    static const unsigned int SNAPSHOT_BYTES = 1024;
+
+    char _buffer[SNAPSHOT_BYTES];
+    int _length = 0;
+    bool _valid = false;
+    uint32_t _revision = 0;         // settings revision when encoded
+    SnapshotState _state;           // rover state when encoded
+    unsigned int _encodes = 0;
+
+    bool _sameState(const SnapshotState &state) const;
+
+    public:
+
+    /**
+     * Get the snapshot, encoding it if stale
+     */
+    const char *snapshot(
+        const Settings &settings,       // IN : current settings
+        const SnapshotState &state,     // IN : current rover state
+        int *length);                   // OUT: length of snapshot in chars
+                                        // RET: null terminated snapshot
+
+    /**
+     * Force the next snapshot() to encode
+     */
+    StateSnapshot& invalidate(); // RET: this instance
+
+    /**
+     * Number of times the snapshot was encoded
+     */
+    unsigned int encodes() const { return _encodes; }
+};
+
+#endif // SETTINGS_STATE_SNAPSHOT_H
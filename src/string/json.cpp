@@ -0,0 +1,57 @@
+#include "json.h"
+#include "strcopy.h"
+
+int jsonNameAt(char *dest, int destSize, int destIndex, const char *name) {
+    int offset = strCopyAt(dest, destSize, destIndex, "\"");
+    offset = strCopyAt(dest, destSize, offset, name);
+    offset = strCopyAt(dest, destSize, offset, "\":");
+    return offset;
+}
+int jsonBoolAt(char *dest, int destSize, int destIndex, const char *name, bool value) {
+    int offset = jsonNameAt(dest, destSize, destIndex, name);
+    offset = strCopyBoolAt(dest, destSize, offset, value);
+    return offset;
+}
+
+int jsonIntAt(char *dest, int destSize, int destIndex, const char *name, int value) {
+    int offset = jsonNameAt(dest, destSize, destIndex, name);
+    offset = strCopyIntAt(dest, destSize, offset, value);
+    return offset;
+}
+
+int jsonULongAt(char *dest, int destSize, int destIndex, const char *name, unsigned long value) {
+    int offset = jsonNameAt(dest, destSize, destIndex, name);
+    offset = strCopyULongAt(dest, destSize, offset, value);
+    return offset;
+}
+
+int jsonFloatAt(char *dest, int destSize, int destIndex, const char *name, float value) {
+    int offset = jsonNameAt(dest, destSize, destIndex, name);
+    offset = strCopyFloatAt(dest, destSize, offset, value, 6);
+    return offset;
+}
+
+
+int strCopyQuotedAt(char *dest, int destSize, int destIndex, const char *quote, const char * value) {
+    int offset = strCopyAt(dest, destSize, destIndex, quote);
+    offset = strCopyAt(dest, destSize, offset, value);
+    offset = strCopyAt(dest, destSize, offset, quote);
+    return offset;
+}
+
+int jsonStringAt(char *dest, int destSize, int destIndex, const char *name, const char * value) {
+    int offset = jsonNameAt(dest, destSize, destIndex, name);
+    offset = strCopyQuotedAt(dest, destSize, offset, "\"", value);
+    return offset;
+}
+
+
+int jsonOpenObjectAt(char *dest, int destSize, int destIndex, const char *name) {
+    int offset = jsonNameAt(dest, destSize, destIndex, name);
+    offset = strCopyAt(dest, destSize, offset, "{");
+    return offset;
+}
+
+int jsonCloseObjectAt(char *dest, int destSize, int destIndex) {
+    return strCopyAt(dest, destSize, destIndex, "}");
+}
@@ -0,0 +1,20 @@
+#ifndef JSON_H
+#define JSON_H
+
+//
+// write json fields into a buffer at an offset;
+// each returns the offset after what it wrote,
+// like strCopyAt().  Fields are not separated,
+// so add the "," between them.
+//
+int jsonNameAt(char *dest, int destSize, int destIndex, const char *name);
+int jsonBoolAt(char *dest, int destSize, int destIndex, const char *name, bool value);
+int jsonIntAt(char *dest, int destSize, int destIndex, const char *name, int value);
+int jsonULongAt(char *dest, int destSize, int destIndex, const char *name, unsigned long value);
+int jsonFloatAt(char *dest, int destSize, int destIndex, const char *name, float value);
+int strCopyQuotedAt(char *dest, int destSize, int destIndex, const char *quote, const char * value);
+int jsonStringAt(char *dest, int destSize, int destIndex, const char *name, const char * value);
+int jsonOpenObjectAt(char *dest, int destSize, int destIndex, const char *name);
+int jsonCloseObjectAt(char *dest, int destSize, int destIndex);
+
+#endif // JSON_H
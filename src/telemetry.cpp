@@ -1,17 +1,27 @@
+#include <string.h>
 #include "telemetry.h"
+#include "hal/clock.h"
 #include "websockets/command_socket.h"
+#include "udp/udp_socket.h"
 #include "string/strcopy.h"
+#include "string/json.h"
 #include "util/circular_buffer.h"
 #include "wheel/drive_wheel.h"
 #include "rover/rover.h"
 #include "rover/pose.h"
 #include "rover/goto_goal.h"
+#include "rover/path_follow.h"
+#include "behavior/geofence_behavior.h"
+#include "rover/rover_command.h"
 
 // from main.cpp
 extern TwoWheelRover rover;
 extern DriveWheel leftWheel;
 extern DriveWheel rightWheel;
 extern GotoGoalBehavior gotoGoalBehavior;
+extern PathFollowBehavior pathFollowBehavior;
+extern GeofenceBehavior geofenceBehavior;
+extern RoverCommandProcessor roverCommandProcessor;
 
 /**
  * Determine if listening for and sending telemetry
@@ -32,6 +42,11 @@ void TelemetrySender::attach(MessageBus *messageBus) // IN : message bus on whic
         subscribe(*_messageBus, SPEED_CONTROL);
         subscribe(*_messageBus, ROVER_POSE);
         subscribe(*_messageBus, GOTO_GOAL);
+        subscribe(*_messageBus, PATH_FOLLOW);
+        subscribe(*_messageBus, GEOFENCE);
+        subscribe(*_messageBus, DEADMAN_HALT);
+        subscribe(*_messageBus, COMMAND_LATENCY);
+        subscribe(*_messageBus, SCRIPT_STATE);
     }
 }
 
@@ -46,65 +61,16 @@ void TelemetrySender::detach() {
         unsubscribe(*_messageBus, SPEED_CONTROL);
         unsubscribe(*_messageBus, ROVER_POSE);
         unsubscribe(*_messageBus, GOTO_GOAL);
+        unsubscribe(*_messageBus, PATH_FOLLOW);
+        unsubscribe(*_messageBus, GEOFENCE);
+        unsubscribe(*_messageBus, DEADMAN_HALT);
+        unsubscribe(*_messageBus, COMMAND_LATENCY);
+        unsubscribe(*_messageBus, SCRIPT_STATE);
 
         _messageBus = nullptr;
     }
 }
 
-int jsonNameAt(char *dest, int destSize, int destIndex, const char *name) {
-    int offset = strCopyAt(dest, destSize, destIndex, "\"");
-    offset = strCopyAt(dest, destSize, offset, name);
-    offset = strCopyAt(dest, destSize, offset, "\":");
-    return offset;
-}
-int jsonBoolAt(char *dest, int destSize, int destIndex, const char *name, bool value) {
-    int offset = jsonNameAt(dest, destSize, destIndex, name);
-    offset = strCopyBoolAt(dest, destSize, offset, value);
-    return offset;
-}
-
-int jsonIntAt(char *dest, int destSize, int destIndex, const char *name, int value) {
-    int offset = jsonNameAt(dest, destSize, destIndex, name);
-    offset = strCopyIntAt(dest, destSize, offset, value);
-    return offset;
-}
-
-int jsonULongAt(char *dest, int destSize, int destIndex, const char *name, unsigned long value) {
-    int offset = jsonNameAt(dest, destSize, destIndex, name);
-    offset = strCopyULongAt(dest, destSize, offset, value);
-    return offset;
-}
-
-int jsonFloatAt(char *dest, int destSize, int destIndex, const char *name, float value) {
-    int offset = jsonNameAt(dest, destSize, destIndex, name);
-    offset = strCopyFloatAt(dest, destSize, offset, value, 6);
-    return offset;
-}
-
-
-int strCopyQuotedAt(char *dest, int destSize, int destIndex, const char *quote, const char * value) {
-    int offset = strCopyAt(dest, destSize, destIndex, quote);
-    offset = strCopyAt(dest, destSize, offset, value);
-    offset = strCopyAt(dest, destSize, offset, quote);
-    return offset;
-}
-
-int jsonStringAt(char *dest, int destSize, int destIndex, const char *name, const char * value) {
-    int offset = jsonNameAt(dest, destSize, destIndex, name);
-    offset = strCopyQuotedAt(dest, destSize, offset, "\"", value);
-    return offset;
-}
-
-
-int jsonOpenObjectAt(char *dest, int destSize, int destIndex, const char *name) {
-    int offset = jsonNameAt(dest, destSize, destIndex, name);
-    offset = strCopyAt(dest, destSize, offset, "{");
-    return offset;
-}
-
-int jsonCloseObjectAt(char *dest, int destSize, int destIndex) {
-    return strCopyAt(dest, destSize, destIndex, "}");
-}
 
 int formatLog(char *buffer, int sizeOfBuffer, const char *src, const char *data) {
     // pwm value was set: pwm value to client as wrapped json: like 'set({left:{forward:true,pwm:255}})'
@@ -220,6 +186,86 @@ int formatGotoGoal(char *buffer, const int sizeOfBuffer, const Pose2D& pose, con
     return offset;
 }
 
+int formatPathFollow(char *buffer, const int sizeOfBuffer, const PathFollowState state, const unsigned int waypoint, const unsigned int waypoints, const unsigned int poseMs) {
+    // path state changed: send values to client: like 'path({path: {state: "RUNNING", waypoint: 1, waypoints: 4, at:1234567890}})'
+    int offset = strCopy(buffer, sizeOfBuffer, "path({");
+        offset = jsonOpenObjectAt(buffer, sizeOfBuffer, offset, "path");
+            offset = jsonStringAt(buffer, sizeOfBuffer, offset, "state", PathFollowStateStr[state]);
+            offset = strCopyAt(buffer, sizeOfBuffer, offset, ",");
+            offset = jsonIntAt(buffer, sizeOfBuffer, offset, "waypoint", waypoint);
+            offset = strCopyAt(buffer, sizeOfBuffer, offset, ",");
+            offset = jsonIntAt(buffer, sizeOfBuffer, offset, "waypoints", waypoints);
+            offset = strCopyAt(buffer, sizeOfBuffer, offset, ",");
+            offset = jsonULongAt(buffer, sizeOfBuffer, offset, "at", poseMs);
+        offset = jsonCloseObjectAt(buffer, sizeOfBuffer, offset);
+    offset = strCopyAt(buffer, sizeOfBuffer, offset, "})");
+    return offset;
+}
+
+int formatGeofence(char *buffer, const int sizeOfBuffer, const GeofenceState state, const Pose2D pose, const unsigned int poseMs) {
+    // geofence state changed: send values to client: like 'fence({fence: {state: "HALTING", x: 10.1, y: 4.3, at:1234567890}})'
+    int offset = strCopy(buffer, sizeOfBuffer, "fence({");
+        offset = jsonOpenObjectAt(buffer, sizeOfBuffer, offset, "fence");
+            offset = jsonStringAt(buffer, sizeOfBuffer, offset, "state", GeofenceStateStr[state]);
+            offset = strCopyAt(buffer, sizeOfBuffer, offset, ",");
+            offset = jsonFloatAt(buffer, sizeOfBuffer, offset, "x", pose.x);
+            offset = strCopyAt(buffer, sizeOfBuffer, offset, ",");
+            offset = jsonFloatAt(buffer, sizeOfBuffer, offset, "y", pose.y);
+            offset = strCopyAt(buffer, sizeOfBuffer, offset, ",");
+            offset = jsonULongAt(buffer, sizeOfBuffer, offset, "at", poseMs);
+        offset = jsonCloseObjectAt(buffer, sizeOfBuffer, offset);
+    offset = strCopyAt(buffer, sizeOfBuffer, offset, "})");
+    return offset;
+}
+
+int formatDeadman(char *buffer, const int sizeOfBuffer, const unsigned long timeoutMs, const unsigned long lastFedMs, const unsigned long atMs) {
+    // deadman expired: send values to client: like 'deadman({deadman: {timeout: 1000, fed: 1234560000, at:1234567890}})'
+    int offset = strCopy(buffer, sizeOfBuffer, "deadman({");
+        offset = jsonOpenObjectAt(buffer, sizeOfBuffer, offset, "deadman");
+            offset = jsonULongAt(buffer, sizeOfBuffer, offset, "timeout", timeoutMs);
+            offset = strCopyAt(buffer, sizeOfBuffer, offset, ",");
+            offset = jsonULongAt(buffer, sizeOfBuffer, offset, "fed", lastFedMs);
+            offset = strCopyAt(buffer, sizeOfBuffer, offset, ",");
+            offset = jsonULongAt(buffer, sizeOfBuffer, offset, "at", atMs);
+        offset = jsonCloseObjectAt(buffer, sizeOfBuffer, offset);
+    offset = strCopyAt(buffer, sizeOfBuffer, offset, "})");
+    return offset;
+}
+
+int formatLatency(char *buffer, const int sizeOfBuffer, const char *stage, const Log2Histogram &histogram) {
+    // command latency for one stage in microseconds: like 'latency({latency: {stage: "total", n: 12, p50: 2048, p90: 4096, p99: 8192, max: 6120}})'
+    int offset = strCopy(buffer, sizeOfBuffer, "latency({");
+        offset = jsonOpenObjectAt(buffer, sizeOfBuffer, offset, "latency");
+            offset = jsonStringAt(buffer, sizeOfBuffer, offset, "stage", stage);
+            offset = strCopyAt(buffer, sizeOfBuffer, offset, ",");
+            offset = jsonULongAt(buffer, sizeOfBuffer, offset, "n", histogram.count());
+            offset = strCopyAt(buffer, sizeOfBuffer, offset, ",");
+            offset = jsonULongAt(buffer, sizeOfBuffer, offset, "p50", histogram.percentile(50));
+            offset = strCopyAt(buffer, sizeOfBuffer, offset, ",");
+            offset = jsonULongAt(buffer, sizeOfBuffer, offset, "p90", histogram.percentile(90));
+            offset = strCopyAt(buffer, sizeOfBuffer, offset, ",");
+            offset = jsonULongAt(buffer, sizeOfBuffer, offset, "p99", histogram.percentile(99));
+            offset = strCopyAt(buffer, sizeOfBuffer, offset, ",");
+            offset = jsonULongAt(buffer, sizeOfBuffer, offset, "max", histogram.max());
+        offset = jsonCloseObjectAt(buffer, sizeOfBuffer, offset);
+    offset = strCopyAt(buffer, sizeOfBuffer, offset, "})");
+    return offset;
+}
+
+int formatScript(char *buffer, const int sizeOfBuffer, const char *state, const unsigned int bytes, const unsigned long atMs) {
+    // script state: like 'script({script: {state: "DONE", bytes: 112, at: 1234567890}})'
+    int offset = strCopy(buffer, sizeOfBuffer, "script({");
+        offset = jsonOpenObjectAt(buffer, sizeOfBuffer, offset, "script");
+            offset = jsonStringAt(buffer, sizeOfBuffer, offset, "state", state);
+            offset = strCopyAt(buffer, sizeOfBuffer, offset, ",");
+            offset = jsonULongAt(buffer, sizeOfBuffer, offset, "bytes", bytes);
+            offset = strCopyAt(buffer, sizeOfBuffer, offset, ",");
+            offset = jsonULongAt(buffer, sizeOfBuffer, offset, "at", atMs);
+        offset = jsonCloseObjectAt(buffer, sizeOfBuffer, offset);
+    offset = strCopyAt(buffer, sizeOfBuffer, offset, "})");
+    return offset;
+}
+
 /**
  * Convert messages into telemetry strings
  * and write them into an output buffer
@@ -307,6 +353,58 @@ void TelemetrySender::onMessage(
             }
             return;
         }
+        case PATH_FOLLOW: {
+            // path state changed: like 'path({path: {state: "RUNNING", waypoint: 1, waypoints: 4, at:1234567890}})'
+            char *buffer = _getBuffer();
+            if(nullptr != buffer) {
+                formatPathFollow(buffer, TELEMETRY_BUFFER_BYTES,
+                    pathFollowBehavior.state(),
+                    pathFollowBehavior.waypointIndex(),
+                    pathFollowBehavior.waypointCount(),
+                    rover.lastPoseMs());
+            }
+            return;
+        }
+        case DEADMAN_HALT: {
+            // deadman expired: like 'deadman({deadman: {timeout: 1000, fed: 1234560000, at:1234567890}})'
+            char *buffer = _getBuffer();
+            if(nullptr != buffer) {
+                const DeadmanTimer &deadman = roverCommandProcessor.deadman();
+                formatDeadman(buffer, TELEMETRY_BUFFER_BYTES, deadman.timeout(), deadman.lastFed(), halMillis());
+            }
+            return;
+        }
+        case COMMAND_LATENCY: {
+            // latency report for the stage named in data: like 'latency({latency: {stage: "total", n: 12, p50: 2048, ...}})'
+            const LatencyStage stage = latencyStageOf(data);
+            if(stage < NUMBER_OF_LATENCY_STAGES) {
+                char *buffer = _getBuffer();
+                if(nullptr != buffer) {
+                    formatLatency(buffer, TELEMETRY_BUFFER_BYTES, LatencyStageStr[stage],
+                        roverCommandProcessor.latency().histogram(stage));
+                }
+            }
+            return;
+        }
+        case SCRIPT_STATE: {
+            // script started, stopped or finished: like 'script({script: {state: "DONE", bytes: 112, at: 1234567890}})'
+            char *buffer = _getBuffer();
+            if(nullptr != buffer) {
+                formatScript(buffer, TELEMETRY_BUFFER_BYTES, data, roverCommandProcessor.script().length(), halMillis());
+            }
+            return;
+        }
+        case GEOFENCE: {
+            // geofence triggered or cleared: like 'fence({fence: {state: "HALTING", x: 10.1, y: 4.3, at:1234567890}})'
+            char *buffer = _getBuffer();
+            if(nullptr != buffer) {
+                formatGeofence(buffer, TELEMETRY_BUFFER_BYTES,
+                    geofenceBehavior.state(),
+                    rover.pose(),
+                    rover.lastPoseMs());
+            }
+            return;
+        }
         default:
             // unknown message
             break;
@@ -327,6 +425,7 @@ char* TelemetrySender::_getBuffer() {
         return buffer;
     }
 
+    _dropped += 1;
     return nullptr;
 }
 
@@ -345,6 +444,9 @@ void TelemetrySender::poll()
         // if telemetry is not an empty string, then send it.
         if(_telemetryBuffer[index][0]) {
             wsSendCommandText(_telemetryBuffer[index], strlen(_telemetryBuffer[index]));
+            #ifdef USE_UDP_COMMANDS
+                udpSendTelemetry(_telemetryBuffer[index], strlen(_telemetryBuffer[index]));
+            #endif
         }
 
         // remove it from the queue
@@ -17,6 +17,7 @@ class TelemetrySender : Subscriber {
     char _telemetryBuffer[TELEMETRY_BUFFER_COUNT][TELEMETRY_BUFFER_BYTES];
     int _telemetryCount = 0;        // number of telemetry buffers to send
     int _telemetryWriteIndex = 0;   // index of buffer to write to
+    unsigned long _dropped = 0;     // messages lost because all buffers were full
 
     MessageBus *_messageBus = nullptr;
     bool _sending = false;
@@ -28,7 +29,18 @@ class TelemetrySender : Subscriber {
 
     public:
 
+    /**
+     * Count of telemetry messages dropped
+     * because the buffers were full
+     */
+    unsigned long dropped() const { return _dropped; }
 
+    /**
+     * Telemetry messages waiting to be sent,
+     * and how many can wait
+     */
+    unsigned int backlog() const { return _telemetryCount; }
+    static unsigned int capacity() { return TELEMETRY_BUFFER_COUNT; }
 
     /**
      * Determine if listening for and sending telemetry
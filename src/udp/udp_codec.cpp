@@ -0,0 +1,194 @@
+#include <string.h>
+#include <math.h>
+#include "udp_codec.h"
+#include "../config.h"
+
+static void writeUint32(uint8_t *bytes, uint32_t value) {
+    bytes[0] = (uint8_t)value;
+    bytes[1] = (uint8_t)(value >> 8);
+    bytes[2] = (uint8_t)(value >> 16);
+    bytes[3] = (uint8_t)(value >> 24);
+}
+
+static uint32_t readUint32(const uint8_t *bytes) {
+    return (uint32_t)bytes[0]
+        | ((uint32_t)bytes[1] << 8)
+        | ((uint32_t)bytes[2] << 16)
+        | ((uint32_t)bytes[3] << 24);
+}
+
+static void writeFloat32(uint8_t *bytes, float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    writeUint32(bytes, bits);
+}
+
+static float readFloat32(const uint8_t *bytes) {
+    const uint32_t bits = readUint32(bytes);
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+static unsigned int writeHeader(uint8_t *packet, UdpPacketType type, uint32_t sequence) {
+    packet[0] = UDP_MAGIC;
+    packet[1] = (uint8_t)type;
+    writeUint32(packet + 2, sequence);
+    return UDP_HEADER_BYTES;
+}
+
+/**
+ * Decode a received packet
+ */
+UdpPacket decodeUdpPacket(
+    const uint8_t *packet,  // IN : received bytes
+    unsigned int length)    // IN : number of bytes
+                            // RET: matched is false if too short, unknown or wrong size
+{
+    UdpPacket decoded = {false, UDP_HALT, 0, 0, {0, 0}, nullptr, 0};
+    if((nullptr == packet) || (length < UDP_HEADER_BYTES) || (UDP_MAGIC != packet[0])) {
+        return decoded;
+    }
+
+    decoded.type = (UdpPacketType)packet[1];
+    decoded.sequence = readUint32(packet + 2);
+    const uint8_t *payload = packet + UDP_HEADER_BYTES;
+    const unsigned int payloadLength = length - UDP_HEADER_BYTES;
+    switch(decoded.type) {
+        case UDP_TANK: {
+            if(1 + 4 + 4 == payloadLength) {
+                decoded.flags = payload[0];
+                decoded.values[0] = readFloat32(payload + 1);
+                decoded.values[1] = readFloat32(payload + 5);
+                decoded.matched = true;
+            }
+            break;
+        }
+        case UDP_TWIST: {
+            if(4 + 4 == payloadLength) {
+                decoded.values[0] = readFloat32(payload);
+                decoded.values[1] = readFloat32(payload + 4);
+                decoded.matched = true;
+            }
+            break;
+        }
+        case UDP_HALT: {
+            decoded.matched = (0 == payloadLength);
+            break;
+        }
+        case UDP_TELEMETRY: {
+            decoded.payload = payload;
+            decoded.payloadLength = payloadLength;
+            decoded.matched = true;
+            break;
+        }
+        default: {
+            break;
+        }
+    }
+    return decoded;
+}
+
+/**
+ * Check the values of a decoded command packet
+ */
+bool validateUdpCommand(
+    UdpPacket &packet,      // IN : decoded packet
+                            // OUT: speed controlled tank values capped at maxSpeed
+    float maxSpeed)         // IN : calibrated maximum wheel speed; 0 if not calibrated
+                            // RET: true if a tank, twist or halt packet with usable values
+{
+    if(!packet.matched) {
+        return false;
+    }
+    switch(packet.type) {
+        case UDP_TANK: {
+            const bool useSpeedControl = (0 != (packet.flags & UDP_TANK_SPEED_CONTROL));
+            for(int i = 0; i < 2; i += 1) {
+                const float value = packet.values[i];
+                if(!isfinite(value) || (value < 0) || (!useSpeedControl && (value > UDP_TANK_MAX_PWM))) {
+                    return false;
+                }
+                if(useSpeedControl && (maxSpeed > 0) && (value > maxSpeed)) {
+                    packet.values[i] = maxSpeed;
+                }
+            }
+            return true;
+        }
+        case UDP_TWIST: {
+            return isfinite(packet.values[0]) && isfinite(packet.values[1]);
+        }
+        case UDP_HALT: {
+            return true;
+        }
+        default: {
+            // telemetry only goes to the client
+            return false;
+        }
+    }
+}
+
+unsigned int encodeUdpTank(uint8_t *packet, unsigned int size, uint32_t sequence, uint8_t flags, float left, float right) {
+    if((nullptr == packet) || (size < UDP_HEADER_BYTES + 9)) return 0;
+    const unsigned int offset = writeHeader(packet, UDP_TANK, sequence);
+    packet[offset] = flags;
+    writeFloat32(packet + offset + 1, left);
+    writeFloat32(packet + offset + 5, right);
+    return offset + 9;
+}
+
+unsigned int encodeUdpTwist(uint8_t *packet, unsigned int size, uint32_t sequence, float linear, float angular) {
+    if((nullptr == packet) || (size < UDP_HEADER_BYTES + 8)) return 0;
+    const unsigned int offset = writeHeader(packet, UDP_TWIST, sequence);
+    writeFloat32(packet + offset, linear);
+    writeFloat32(packet + offset + 4, angular);
+    return offset + 8;
+}
+
+unsigned int encodeUdpHalt(uint8_t *packet, unsigned int size, uint32_t sequence) {
+    if((nullptr == packet) || (size < UDP_HEADER_BYTES)) return 0;
+    return writeHeader(packet, UDP_HALT, sequence);
+}
+
+unsigned int encodeUdpTelemetry(uint8_t *packet, unsigned int size, uint32_t sequence, const char *text, unsigned int length) {
+    if((nullptr == packet) || (nullptr == text) || (size < UDP_HEADER_BYTES + length)) return 0;
+    const unsigned int offset = writeHeader(packet, UDP_TELEMETRY, sequence);
+    memcpy(packet + offset, text, length);
+    return offset + length;
+}
+
+/**
+ * Determine if a packet should be used
+ */
+bool UdpSequencer::accept(
+    uint32_t sequence,          // IN : packet sequence number
+    unsigned long currentMillis)    // IN : current time in milliseconds
+                                    // RET: true if newest so far, false if stale
+{
+    // difference is signed so the sequence can wrap
+    const int32_t ahead = (int32_t)(sequence - _last);
+    const bool restarted = _started && (currentMillis - _lastMs >= UDP_SEQUENCE_RESET_MS);
+    if(_started && !restarted && (ahead <= 0)) {
+        _stale += 1;
+        return false;
+    }
+
+    if(_started && !restarted && (ahead > 1)) {
+        _missed += (unsigned long)(ahead - 1);
+    }
+    _started = true;
+    _last = sequence;
+    _lastMs = currentMillis;
+    _accepted += 1;
+    return true;
+}
+
+UdpSequencer& UdpSequencer::reset() {
+    _started = false;
+    _last = 0;
+    _lastMs = 0;
+    _accepted = 0;
+    _stale = 0;
+    _missed = 0;
+    return *this;
+}
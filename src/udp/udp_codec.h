@@ -0,0 +1,112 @@
+#ifndef UDP_UDP_CODEC_H
+#define UDP_UDP_CODEC_H
+
+#include <stdint.h>
+
+//
+// Packets on the udp control port.  Each packet
+// stands alone; a lost one is never resent, since
+// the next movement command replaces it anyway.
+// All multi-byte values are little-endian.
+//
+// packet: [magic: 'U'][type: uint8][sequence: uint32][payload...]
+//
+//   UDP_TANK       [flags: uint8][left: float32][right: float32]
+//   UDP_TWIST      [linear: float32][angular: float32]
+//   UDP_HALT       no payload
+//   UDP_TELEMETRY  [telemetry text, like tel({...}), not null terminated]
+//
+// Sequence numbers increase by one per packet from each
+// sender; a receiver drops packets that are not newer
+// than the last one it accepted.
+//
+const uint8_t UDP_MAGIC = 'U';
+const unsigned int UDP_HEADER_BYTES = 6;
+
+typedef enum {
+    UDP_TANK = 'T',
+    UDP_TWIST = 'W',
+    UDP_HALT = 'H',
+    UDP_TELEMETRY = 't',
+} UdpPacketType;
+
+// tank flags
+const uint8_t UDP_TANK_SPEED_CONTROL = 0x01;    // values are speeds, otherwise pwm
+const uint8_t UDP_TANK_LEFT_FORWARD = 0x02;
+const uint8_t UDP_TANK_RIGHT_FORWARD = 0x04;
+
+const float UDP_TANK_MAX_PWM = 255;             // largest pwm tank value; same as MAX_SPEED_COMMAND
+
+typedef struct UdpPacket {
+    bool matched;               // true if a whole, known packet
+    UdpPacketType type;
+    uint32_t sequence;
+    uint8_t flags;              // UDP_TANK flags
+    float values[2];            // tank left, right or twist linear, angular
+    const uint8_t *payload;     // UDP_TELEMETRY text; points into packet
+    unsigned int payloadLength;
+} UdpPacket;
+
+/**
+ * Decode a received packet
+ */
+extern UdpPacket decodeUdpPacket(
+    const uint8_t *packet,  // IN : received bytes
+    unsigned int length);   // IN : number of bytes
+                            // RET: matched is false if too short, unknown or wrong size
+
+/**
+ * Check the values of a decoded command packet before
+ * it is accepted, so a junk packet neither advances the
+ * sequence nor reaches speed control.  Values must be
+ * finite; tank values must be >= 0 and pwm values at
+ * most UDP_TANK_MAX_PWM.  Speed controlled tank values
+ * are capped at the calibrated maximum speed.
+ */
+extern bool validateUdpCommand(
+    UdpPacket &packet,      // IN : decoded packet
+                            // OUT: speed controlled tank values capped at maxSpeed
+    float maxSpeed);        // IN : calibrated maximum wheel speed; 0 if not calibrated
+                            // RET: true if a tank, twist or halt packet with usable values
+
+extern unsigned int encodeUdpTank(uint8_t *packet, unsigned int size, uint32_t sequence, uint8_t flags, float left, float right);
+extern unsigned int encodeUdpTwist(uint8_t *packet, unsigned int size, uint32_t sequence, float linear, float angular);
+extern unsigned int encodeUdpHalt(uint8_t *packet, unsigned int size, uint32_t sequence);
+extern unsigned int encodeUdpTelemetry(uint8_t *packet, unsigned int size, uint32_t sequence, const char *text, unsigned int length);
+                            // RET: bytes in packet, 0 if it does not fit
+
+/**
+ * Accept only packets newer than the last one accepted,
+ * so a late packet never undoes a newer command.
+ *
+ * A sender that restarts begins again at a low sequence;
+ * after UDP_SEQUENCE_RESET_MS without an accepted packet,
+ * the next packet is accepted whatever its sequence.
+ */
+class UdpSequencer {
+    private:
+    bool _started = false;
+    uint32_t _last = 0;             // last accepted sequence
+    unsigned long _lastMs = 0;      // when last packet was accepted
+    unsigned long _accepted = 0;
+    unsigned long _stale = 0;       // late or duplicate packets dropped
+    unsigned long _missed = 0;      // sequence numbers skipped; lost or still late
+
+    public:
+
+    /**
+     * Determine if a packet should be used
+     */
+    bool accept(
+        uint32_t sequence,          // IN : packet sequence number
+        unsigned long currentMillis);   // IN : current time in milliseconds
+                                        // RET: true if newest so far, false if stale
+
+    UdpSequencer& reset();
+
+    unsigned long accepted() const { return _accepted; }
+    unsigned long stale() const { return _stale; }
+    unsigned long missed() const { return _missed; }
+};
+
+#endif // UDP_UDP_CODEC_H
@@ -0,0 +1,116 @@
+#ifdef USE_UDP_COMMANDS
+
+#include <WiFi.h>
+#include <WiFiUdp.h>
+#include "udp_socket.h"
+#include "udp_codec.h"
+
+#include "../config.h"
+#include "../error.h"
+#include "../rover/rover_command.h"
+
+#define LOG_LEVEL ERROR_LEVEL
+#include "../log.h"
+
+extern TwoWheelRover rover; // declared in main.cpp
+extern RoverCommandProcessor roverCommandProcessor; // declared in main.cpp
+
+static const unsigned int UDP_PACKET_BYTES = 160;   // largest telemetry plus header
+static const int UDP_PACKETS_PER_POLL = 8;          // bound time spent draining a burst
+
+WiFiUDP udpCommand;
+UdpSequencer udpCommandSequencer;   // drops late command packets
+uint32_t udpTelemetrySequence = 0;  // sequence of next telemetry packet
+
+bool hasUdpPeer = false;            // true once a command has been received
+IPAddress udpPeerAddress;           // where to send telemetry
+uint16_t udpPeerPort = 0;
+
+void udpCommandInit() {
+    udpCommand.begin(UDP_COMMAND_PORT);
+}
+
+/**
+ * Execute one accepted packet;
+ * its values were checked by validateUdpCommand()
+ */
+static void udpExecute(const UdpPacket &packet, unsigned long receivedUs) {
+    switch(packet.type) {
+        case UDP_TANK: {
+            const TankCommand tank(0 != (packet.flags & UDP_TANK_SPEED_CONTROL),
+                SpeedCommand(0 != (packet.flags & UDP_TANK_LEFT_FORWARD), packet.values[0]),
+                SpeedCommand(0 != (packet.flags & UDP_TANK_RIGHT_FORWARD), packet.values[1]));
+            roverCommandProcessor.deadman().feed(millis());
+            roverCommandProcessor.submitMovementCommand(tank, CommandTiming(), CommandStamp(receivedUs, micros()));
+            return;
+        }
+        case UDP_TWIST: {
+            TankCommand tank;
+            if(SUCCESS != roverCommandProcessor.twistToTank(TwistCommand(packet.values[0], packet.values[1]), tank)) {
+                return;
+            }
+            roverCommandProcessor.deadman().feed(millis());
+            roverCommandProcessor.submitMovementCommand(tank, CommandTiming(), CommandStamp(receivedUs, micros()));
+            return;
+        }
+        case UDP_HALT: {
+            roverCommandProcessor.halt();
+            return;
+        }
+        default: {
+            // telemetry only goes to the client
+            return;
+        }
+    }
+}
+
+/**
+ * Receive and execute waiting command packets
+ */
+void udpCommandPoll() {
+    uint8_t buffer[UDP_PACKET_BYTES];
+    for(int i = 0; (i < UDP_PACKETS_PER_POLL) && (udpCommand.parsePacket() > 0); i += 1) {
+        // receive time for command latency
+        const unsigned long receivedUs = micros();
+
+        const int length = udpCommand.read(buffer, sizeof(buffer));
+        if(length <= 0) {
+            continue;
+        }
+        //
+        // check values before the sequence, so a junk packet
+        // does not advance it or take over as the peer
+        //
+        UdpPacket packet = decodeUdpPacket(buffer, (unsigned int)length);
+        if(!validateUdpCommand(packet, rover.maximumSpeed()) || !udpCommandSequencer.accept(packet.sequence, millis())) {
+            LOG_INFO("udpCommandPoll: dropped bad or stale packet");
+            continue;
+        }
+
+        // telemetry goes back to whoever is driving
+        udpPeerAddress = udpCommand.remoteIP();
+        udpPeerPort = udpCommand.remotePort();
+        hasUdpPeer = true;
+
+        udpExecute(packet, receivedUs);
+    }
+}
+
+/**
+ * send a telemetry message to the client driving over udp
+ */
+void udpSendTelemetry(const char *msg, unsigned int length) {
+    if(!hasUdpPeer) {
+        return;
+    }
+    uint8_t buffer[UDP_PACKET_BYTES];
+    const unsigned int packetLength = encodeUdpTelemetry(buffer, sizeof(buffer), udpTelemetrySequence, msg, length);
+    if(packetLength > 0) {
+        udpTelemetrySequence += 1;
+        udpCommand.beginPacket(udpPeerAddress, udpPeerPort);
+        udpCommand.write(buffer, packetLength);
+        udpCommand.endPacket();
+    }
+}
+
+#endif // USE_UDP_COMMANDS
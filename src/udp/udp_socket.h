@@ -0,0 +1,14 @@
+#ifndef UDP_UDP_SOCKET_H
+#define UDP_UDP_SOCKET_H
+
+//
+// optional udp control port; see udp_codec.h for packets.
+// Movement commands go to the same latest-value slot as
+// websocket movement commands, so a lost packet costs
+// one command period rather than stalling the ones after it.
+//
+extern void udpCommandInit();
+extern void udpCommandPoll();
+extern void udpSendTelemetry(const char *msg, unsigned int length);
+
+#endif // UDP_UDP_SOCKET_H
@@ -8,6 +8,10 @@
  * Values can be continually pushed onto the head of the list,
  * and values will be dropped from tail of list to make room
  * if necessary.
+ *
+ * Capacity is chosen at runtime; when it is known
+ * at compile time prefer Ring in ring.h, which
+ * masks rather than divides and does not allocate.
  */
 template <class T> class CircularBuffer {
     private:
@@ -29,11 +33,13 @@ template <class T> class CircularBuffer {
         T& defaultValue)        // IN : the default value if the list is empty
         : _buffer(borrowedBuffer), _ownedBuffer(nullptr), _defaultValue(defaultValue), _capacity(capacity)
     {
-        // no-op
         assert (nullptr != borrowedBuffer);
         assert (capacity > 0);
 
-        memset(_buffer, 0, sizeof(T) * capacity);
+        // values already exist in the borrowed buffer; assign rather than memset
+        for(unsigned int i = 0; i < _capacity; i += 1) {
+            _buffer[i] = _defaultValue;
+        }
     }
 
     /**
@@ -42,13 +48,14 @@ template <class T> class CircularBuffer {
     CircularBuffer(
         unsigned int capacity, // IN : non-zero number of total elements in the buffer
         T& defaultValue)        // IN : the default value if the list is empty
-        : _capacity(capacity), _defaultValue(defaultValue)
+        : _defaultValue(defaultValue), _capacity(capacity)
     {
-        // no-op
         assert (capacity > 0);
 
         _buffer = _ownedBuffer = new T[_capacity];
-        memset(_buffer, 0, sizeof(T) * capacity);
+        for(unsigned int i = 0; i < _capacity; i += 1) {
+            _buffer[i] = _defaultValue;
+        }
     }
 
     /**
@@ -56,7 +63,7 @@ template <class T> class CircularBuffer {
      */
     ~CircularBuffer() {
         if(nullptr != _ownedBuffer) {
-            delete _ownedBuffer;
+            delete[] _ownedBuffer;
         }
     }
 
@@ -169,7 +176,7 @@ template <class T> class CircularBuffer {
                     // RET: value at index
                     //      or the default value if index is out of range
     {
-        if((i >= 0) && (i < _count)) {
+        if((i >= 0) && ((unsigned int)i < _count)) {
             return _buffer[(_tail + i) % _capacity];
         }
 
@@ -186,8 +193,8 @@ template <class T> class CircularBuffer {
         int i,         // IN : index from 0 to count-1 (tail is zero)
         T& theValue)   // IN : value to set
     {
-        if((i >= 0) && (i < _count)) {
-            return _buffer[(_tail + i) % _capacity] = theValue;
+        if((i >= 0) && ((unsigned int)i < _count)) {
+            _buffer[(_tail + i) % _capacity] = theValue;
         }
     }
 
@@ -205,24 +212,12 @@ template <class T> class CircularBuffer {
      */
     void truncateTo(unsigned int size)    // IN : the desired size (maximum)
     {
-        if(size <= _count) {
+        if(size < _count) {
+            _tail = (_tail + _count - size) % _capacity;
             _count = size;
-            _tail = (_tail + size) % _capacity;
         }
     }
 
 };
 
-
-
-
-/**
- * Manage a circular buffer of values.
- * Values can be continually pushed onto the head of the list,
- * and values will be dropped from tail of list to make room
- * if necessary.
- */
-
-
-
-#endif // CIRCULAR_BUFFER_H
\ No newline at end of file
+#endif // CIRCULAR_BUFFER_H
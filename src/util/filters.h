@@ -0,0 +1,255 @@
+#ifndef UTIL_FILTERS_H
+#define UTIL_FILTERS_H
+
+#include <math.h>
+
+//
+// Filters for noisy control signals, like wheel speed.
+// Each takes one sample at a time with add(), returns the
+// current output and keeps only what it needs; none allocate.
+//
+// Windowed filters need a full window before their output
+// is settled; until then they use the samples they have.
+//
+
+/**
+ * Exponential moving average.
+ * Alpha near 1 follows the input closely;
+ * near 0 smooths more but lags more.
+ */
+template <class T> class ExponentialAverage {
+    private:
+    T _alpha;
+    T _value = 0;
+    bool _started = false;
+
+    public:
+
+    ExponentialAverage(T alpha) // IN : weight of newest sample, 0 to 1
+        : _alpha(alpha) {}
+
+    /**
+     * Add a sample
+     */
+    T add(T sample) // IN : new sample
+                    // RET: filtered value
+    {
+        // first sample seeds the average so it does not ramp up from zero
+        _value = _started ? (_value + _alpha * (sample - _value)) : sample;
+        _started = true;
+        return _value;
+    }
+
+    T value() const { return _value; }
+
+    ExponentialAverage& reset() { _value = 0; _started = false; return *this; }
+};
+
+/**
+ * Mean and variance of the last N samples,
+ * kept as running sums so each sample is O(1).
+ * Sums are recomputed each time the window wraps
+ * so rounding error does not build up.
+ */
+template <class T, unsigned int N> class WindowStats {
+    static_assert(N > 0, "WindowStats needs a window of at least one sample");
+
+    private:
+    T _samples[N];
+    unsigned int _next = 0;     // slot for next sample
+    unsigned int _count = 0;
+    double _sum = 0;
+    double _sumOfSquares = 0;
+
+    public:
+
+    /**
+     * Add a sample, dropping the oldest if the window is full
+     */
+    WindowStats& add(T sample) // IN : new sample
+                               // RET: this instance
+    {
+        if(_count == N) {
+            const double oldest = _samples[_next];
+            _sum -= oldest;
+            _sumOfSquares -= oldest * oldest;
+        } else {
+            _count += 1;
+        }
+        _samples[_next] = sample;
+        _sum += sample;
+        _sumOfSquares += (double)sample * sample;
+
+        if(++_next == N) {
+            _next = 0;
+            _sum = 0;
+            _sumOfSquares = 0;
+            for(unsigned int i = 0; i < N; i += 1) {
+                _sum += _samples[i];
+                _sumOfSquares += (double)_samples[i] * _samples[i];
+            }
+        }
+        return *this;
+    }
+
+    unsigned int count() const { return _count; }
+    static constexpr unsigned int window() { return N; }
+
+    T mean() const { return (_count > 0) ? (T)(_sum / _count) : 0; }
+
+    /**
+     * Population variance of the window
+     */
+    T variance() const {
+        if(_count < 2) return 0;
+        const double mean = _sum / _count;
+        const double variance = _sumOfSquares / _count - mean * mean;
+        return (variance > 0) ? (T)variance : 0;    // rounding can make it slightly negative
+    }
+
+    T standardDeviation() const { return (T)sqrt((double)variance()); }
+
+    WindowStats& reset() { _next = 0; _count = 0; _sum = 0; _sumOfSquares = 0; return *this; }
+};
+
+/**
+ * Median of the last N samples; rejects spikes
+ * shorter than half the window outright.
+ * Keeps the window sorted, so a sample costs O(N);
+ * meant for small windows like 3 or 5.
+ */
+template <class T, unsigned int N> class MedianFilter {
+    static_assert((N > 0) && (1 == (N & 1)), "MedianFilter window must be odd");
+
+    private:
+    T _samples[N];      // in arrival order
+    T _sorted[N];
+    unsigned int _next = 0;
+    unsigned int _count = 0;
+
+    public:
+
+    /**
+     * Add a sample
+     */
+    T add(T sample) // IN : new sample
+                    // RET: median of window
+    {
+        unsigned int position;
+        if(_count == N) {
+            // remove oldest from sorted window
+            const T oldest = _samples[_next];
+            for(position = 0; (position + 1 < _count) && (_sorted[position] != oldest); position += 1) {}
+            for(; position + 1 < _count; position += 1) {
+                _sorted[position] = _sorted[position + 1];
+            }
+            _count -= 1;
+        }
+        _samples[_next] = sample;
+        if(++_next == N) _next = 0;
+
+        // insert new sample in order
+        for(position = _count; (position > 0) && (_sorted[position - 1] > sample); position -= 1) {
+            _sorted[position] = _sorted[position - 1];
+        }
+        _sorted[position] = sample;
+        _count += 1;
+
+        return value();
+    }
+
+    T value() const {
+        if(0 == _count) return 0;
+        return (_count & 1) ? _sorted[_count / 2] : (T)((_sorted[_count / 2 - 1] + _sorted[_count / 2]) / 2);
+    }
+
+    MedianFilter& reset() { _next = 0; _count = 0; return *this; }
+};
+
+/**
+ * Savitzky-Golay first derivative over a window of N
+ * evenly spaced samples, N odd.  This is the slope of
+ * the least-squares line (or quadratic; the slope at
+ * the centre is the same) through the window:
+ *
+ *   derivative = sum(i * x[i]) / sum(i * i) / spacing,  i = -m..m
+ *
+ * The weighted sum slides in O(1).  The result is the
+ * slope at the middle of the window, so it lags the
+ * newest sample by m samples; in exchange it is far
+ * less noisy than a difference of two samples.
+ */
+template <class T, unsigned int N> class SavitzkyGolayDerivative {
+    static_assert((N >= 3) && (1 == (N & 1)), "SavitzkyGolayDerivative window must be odd and at least 3");
+
+    private:
+    static constexpr int M = (int)N / 2;
+    T _samples[N];              // in arrival order
+    unsigned int _next = 0;
+    unsigned int _count = 0;
+    double _sum = 0;            // sum of x[i]
+    double _weightedSum = 0;    // sum of i * x[i] with newest at i = m
+
+    void _recompute() {
+        _sum = 0;
+        _weightedSum = 0;
+        for(unsigned int k = 0; k < N; k += 1) {
+            // k = 0 is oldest, at i = -m
+            const double sample = _samples[(_next + k) % N];
+            _sum += sample;
+            _weightedSum += ((int)k - M) * sample;
+        }
+    }
+
+    public:
+
+    /**
+     * Sum of i * i for i = -m..m
+     */
+    static constexpr double normalizer() { return (double)M * (M + 1) * (2 * M + 1) / 3; }
+
+    /**
+     * Add a sample
+     */
+    SavitzkyGolayDerivative& add(T sample) // IN : new sample
+                                           // RET: this instance
+    {
+        if(_count < N) {
+            _samples[_next] = sample;
+            _count += 1;
+            if(++_next == N) _next = 0;
+            if(_count == N) _recompute();
+            return *this;
+        }
+
+        // every sample moves one place older; the oldest drops off
+        const T oldest = _samples[_next];
+        _weightedSum = _weightedSum - _sum + (M + 1) * (double)oldest + M * (double)sample;
+        _sum += (double)sample - oldest;
+        _samples[_next] = sample;
+        if(++_next == N) {
+            _next = 0;
+            _recompute();
+        }
+        return *this;
+    }
+
+    /**
+     * Determine if the window is full
+     */
+    bool ready() const { return _count == N; }
+
+    /**
+     * Derivative at the middle of the window
+     */
+    T derivative(T spacing) const   // IN : time between samples
+                                    // RET: slope per unit time; 0 until window is full
+    {
+        if(!ready() || (0 == spacing)) return 0;
+        return (T)(_weightedSum / normalizer() / spacing);
+    }
+
+    SavitzkyGolayDerivative& reset() { _next = 0; _count = 0; _sum = 0; _weightedSum = 0; return *this; }
+};
+
+#endif // UTIL_FILTERS_H
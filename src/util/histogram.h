@@ -0,0 +1,104 @@
+#ifndef UTIL_HISTOGRAM_H
+#define UTIL_HISTOGRAM_H
+
+#include <stdint.h>
+
+const unsigned int LOG2_HISTOGRAM_BUCKETS = 21;  // upper bounds 1, 2, 4 ... 2^20
+
+/**
+ * Histogram with power-of-two bucket boundaries.
+ * Bucket i counts values <= 2^i (and greater than the
+ * previous bucket's bound); the last bucket also counts
+ * everything larger.  Adding a value is constant time
+ * and the whole histogram is a fixed ~100 bytes, so it
+ * can sit in the control loop.
+ */
+class Log2Histogram {
+    private:
+    uint32_t _buckets[LOG2_HISTOGRAM_BUCKETS];
+    uint32_t _count;
+    uint64_t _sum;
+    uint32_t _max;
+
+    public:
+
+    Log2Histogram() { reset(); }
+
+    /**
+     * Index of the bucket that holds a value
+     */
+    static unsigned int bucketOf(uint32_t value) // IN : value
+                                                 // RET: bucket index
+    {
+        if(value <= 1) return 0;
+        const unsigned int bucket = 32 - __builtin_clz(value - 1);
+        return (bucket < LOG2_HISTOGRAM_BUCKETS) ? bucket : (LOG2_HISTOGRAM_BUCKETS - 1);
+    }
+
+    /**
+     * Upper bound of a bucket
+     */
+    static uint32_t bucketBound(unsigned int bucket) // IN : bucket index
+                                                     // RET: largest value counted by bucket
+    {
+        return ((uint32_t)1) << bucket;
+    }
+
+    /**
+     * Clear all counts
+     */
+    Log2Histogram& reset() // RET: this histogram
+    {
+        for(unsigned int i = 0; i < LOG2_HISTOGRAM_BUCKETS; i += 1) {
+            _buckets[i] = 0;
+        }
+        _count = 0;
+        _sum = 0;
+        _max = 0;
+        return *this;
+    }
+
+    /**
+     * Count a value
+     */
+    Log2Histogram& add(uint32_t value) // IN : value to count
+                                       // RET: this histogram
+    {
+        _buckets[bucketOf(value)] += 1;
+        _count += 1;
+        _sum += value;
+        if(value > _max) _max = value;
+        return *this;
+    }
+
+    uint32_t count() const { return _count; }
+    uint64_t sum() const { return _sum; }
+    uint32_t max() const { return _max; }
+    uint32_t bucket(unsigned int i) const { return (i < LOG2_HISTOGRAM_BUCKETS) ? _buckets[i] : 0; }
+
+    /**
+     * Estimate a percentile as the upper bound of
+     * the bucket that holds it, limited to the max.
+     */
+    uint32_t percentile(
+        unsigned int percent) const // IN : 0 to 100
+                                    // RET: value that percent of values are <=,
+                                    //      or 0 if histogram is empty
+    {
+        if(0 == _count) return 0;
+
+        // rank of the value we want, rounding up
+        const uint64_t rank = ((uint64_t)_count * percent + 99) / 100;
+        uint64_t seen = 0;
+        for(unsigned int i = 0; i < LOG2_HISTOGRAM_BUCKETS; i += 1) {
+            seen += _buckets[i];
+            if((seen >= rank) && (seen > 0)) {
+                const uint32_t bound = bucketBound(i);
+                return (bound < _max) ? bound : _max;
+            }
+        }
+        return _max;
+    }
+};
+
+#endif // UTIL_HISTOGRAM_H
@@ -0,0 +1,69 @@
+#ifndef UTIL_LATEST_VALUE_H
+#define UTIL_LATEST_VALUE_H
+
+#include <atomic>
+
+/**
+ * Lock-free single-producer, single-consumer slot
+ * that holds only the most recently written value.
+ * Writing never fails and never blocks; a new value
+ * simply replaces one that has not been taken yet.
+ *
+ * This is a triple buffer: the writer fills its
+ * back buffer then swaps it with the middle buffer,
+ * the reader swaps the middle buffer with its front
+ * buffer when there is something new.  The swap is
+ * a single atomic exchange, so the writer and reader
+ * may run on different tasks or cores.
+ */
+template <class T> class LatestValue {
+    private:
+    static const unsigned int INDEX_MASK = 0x03;
+    static const unsigned int FRESH = 0x04;     // middle buffer holds an untaken value
+
+    T _buffers[3];
+    unsigned int _back = 0;                     // owned by writer
+    std::atomic<unsigned int> _middle{1};       // shared; index | FRESH
+    unsigned int _front = 2;                    // owned by reader
+
+    public:
+
+    /**
+     * Write a value, replacing any value not yet taken.
+     * Call only from the single producer.
+     */
+    void write(
+        const T &value) // IN : value to publish
+    {
+        _buffers[_back] = value;
+        _back = _middle.exchange(_back | FRESH, std::memory_order_acq_rel) & INDEX_MASK;
+    }
+
+    /**
+     * Take the most recent value if one was written
+     * since the last take.
+     * Call only from the single consumer.
+     */
+    bool take(
+        T &value)   // OUT: if a new value was written, the newest value;
+                    //      otherwise unchanged
+                    // RET: true if a new value was taken, false if not
+    {
+        if(0 == (_middle.load(std::memory_order_relaxed) & FRESH)) {
+            return false;
+        }
+        _front = _middle.exchange(_front, std::memory_order_acq_rel) & INDEX_MASK;
+        value = _buffers[_front];
+        return true;
+    }
+
+    /**
+     * Determine if there is a value that has not been taken
+     */
+    bool fresh() const // RET: true if a value is waiting to be taken
+    {
+        return 0 != (_middle.load(std::memory_order_acquire) & FRESH);
+    }
+};
+
+#endif // UTIL_LATEST_VALUE_H
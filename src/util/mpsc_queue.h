@@ -0,0 +1,105 @@
+#ifndef UTIL_MPSC_QUEUE_H
+#define UTIL_MPSC_QUEUE_H
+
+#include <atomic>
+
+/**
+ * Lock-free multiple-producer, single-consumer FIFO
+ * with a fixed capacity.  A push onto a full queue
+ * fails rather than waiting or dropping a value.
+ *
+ * Each slot carries a sequence number that says whose
+ * turn it is; a producer claims a slot by advancing the
+ * shared head with a compare-and-swap, fills it, then
+ * publishes it by bumping its sequence.  Producers never
+ * wait on each other or on the consumer.  A producer that
+ * is preempted between claiming and publishing a slot only
+ * holds up the consumer, which sees an empty queue until
+ * that slot is published.
+ */
+template <class T, unsigned int N> class MpscQueue {
+    static_assert((N > 0) && (0 == (N & (N - 1))), "MpscQueue capacity must be a power of two");
+
+    private:
+    typedef struct Slot {
+        std::atomic<unsigned int> sequence; // == index when free to write, index + 1 when ready to read
+        T value;
+    } Slot;
+
+    Slot _slots[N];
+    std::atomic<unsigned int> _head{0};     // next slot to claim; shared by producers
+    unsigned int _tail = 0;                 // next slot to read; owned by consumer
+
+    public:
+
+    MpscQueue() {
+        for(unsigned int i = 0; i < N; i += 1) {
+            _slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    // slots hold atomics; share the queue instead
+    MpscQueue(const MpscQueue &) = delete;
+    MpscQueue& operator=(const MpscQueue &) = delete;
+
+    static constexpr unsigned int capacity() { return N; }
+
+    /**
+     * Number of values claimed but not yet popped;
+     * a snapshot if called while producers are active.
+     */
+    unsigned int count() const // RET: values waiting to be popped
+    {
+        return _head.load(std::memory_order_acquire) - _tail;
+    }
+
+    bool empty() const { return 0 == count(); }
+
+    /**
+     * Append a value to the queue.
+     * May be called from any number of producers.
+     */
+    bool push(
+        const T &value) // IN : value to append
+                        // RET: true if appended, false if queue is full
+    {
+        unsigned int head = _head.load(std::memory_order_relaxed);
+        for(;;) {
+            Slot &slot = _slots[head & (N - 1)];
+            const int turn = (int)(slot.sequence.load(std::memory_order_acquire) - head);
+            if(0 == turn) {
+                // slot is free; claim it unless another producer got there first
+                if(_head.compare_exchange_weak(head, head + 1, std::memory_order_relaxed)) {
+                    slot.value = value;
+                    slot.sequence.store(head + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if(turn < 0) {
+                return false;   // slot still holds a value from the last lap; full
+            } else {
+                head = _head.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * Remove the oldest published value from the queue.
+     * Call only from the single consumer.
+     */
+    bool pop(
+        T &value)   // OUT: if not empty, the oldest value;
+                    //      otherwise unchanged
+                    // RET: true if a value was popped, false if queue is empty
+    {
+        Slot &slot = _slots[_tail & (N - 1)];
+        if(slot.sequence.load(std::memory_order_acquire) != _tail + 1) {
+            return false;
+        }
+        value = slot.value;
+        slot.sequence.store(_tail + N, std::memory_order_release);
+        _tail += 1;
+        return true;
+    }
+};
+
+#endif // UTIL_MPSC_QUEUE_H
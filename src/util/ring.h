@@ -0,0 +1,180 @@
+#ifndef UTIL_RING_H
+#define UTIL_RING_H
+
+#include <new>
+
+/**
+ * Fixed capacity ring of values.
+ * Values are pushed onto the head, and the value at
+ * the tail is dropped to make room when the ring is full.
+ *
+ * Capacity is a compile-time power of two, so indexing
+ * is a mask rather than a divide, and the storage lives
+ * inside the instance with no allocation.  Slots are
+ * raw storage; a value is constructed when it is pushed
+ * and destroyed when it is dropped, so T need not be
+ * a plain struct or have a default constructor.
+ *
+ * Not safe to share between tasks; for that use SpscQueue.
+ */
+template <class T, unsigned int N> class Ring {
+    static_assert((N > 0) && (0 == (N & (N - 1))), "Ring capacity must be a power of two");
+
+    private:
+    static const unsigned int MASK = N - 1;
+
+    alignas(T) unsigned char _storage[N * sizeof(T)];
+    T _defaultValue;
+    unsigned int _tail = 0;     // free running index of least recent value
+    unsigned int _count = 0;
+
+    T *_slot(unsigned int index) { return reinterpret_cast<T *>(_storage) + (index & MASK); }
+    const T *_slot(unsigned int index) const { return reinterpret_cast<const T *>(_storage) + (index & MASK); }
+
+    public:
+
+    Ring() : _defaultValue() {}
+
+    Ring(const T &defaultValue) // IN : value returned by head(), tail() and get() if out of range
+        : _defaultValue(defaultValue) {}
+
+    ~Ring() {
+        clear();
+    }
+
+    // values live inside the instance; copy them out instead
+    Ring(const Ring &) = delete;
+    Ring& operator=(const Ring &) = delete;
+
+    static constexpr unsigned int capacity() { return N; }
+
+    unsigned int count() const { return _count; }
+    unsigned int available() const { return N - _count; }
+    bool empty() const { return 0 == _count; }
+    bool full() const { return N == _count; }
+
+    /**
+     * The value returned if the ring is empty
+     * or an index is out of range
+     */
+    const T& defaultValue() const { return _defaultValue; }
+
+    /**
+     * Non-destructive get of the most recently pushed value
+     */
+    const T& head() const   // RET: head value, or default value if empty
+    {
+        return (_count > 0) ? *_slot(_tail + _count - 1) : _defaultValue;
+    }
+
+    /**
+     * Non-destructive get of the least recently pushed value
+     */
+    const T& tail() const   // RET: tail value, or default value if empty
+    {
+        return (_count > 0) ? *_slot(_tail) : _defaultValue;
+    }
+
+    /**
+     * Get value at given index where
+     * tail is index 0 and head is index count-1
+     */
+    const T& get(unsigned int i) const  // IN : index from 0 to count-1 (tail is zero)
+                                        // RET: value at index, or default value if out of range
+    {
+        return (i < _count) ? *_slot(_tail + i) : _defaultValue;
+    }
+
+    /**
+     * Replace value at given index where
+     * tail is index 0 and head is index count-1
+     */
+    bool set(
+        unsigned int i,     // IN : index from 0 to count-1 (tail is zero)
+        const T &value)     // IN : value to set
+                            // RET: true if set, false if index out of range
+    {
+        if(i < _count) {
+            *_slot(_tail + i) = value;
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * Push a value onto the head.
+     * If the ring is full, the value
+     * at the tail is dropped to make room.
+     */
+    Ring& push(const T &value)  // IN : value to add at head
+                                // RET: this ring
+    {
+        if(N == _count) {
+            _slot(_tail)->~T();
+            _tail += 1;
+            _count -= 1;
+        }
+        new (_slot(_tail + _count)) T(value);
+        _count += 1;
+        return *this;
+    }
+
+    /**
+     * Remove the most recently pushed value
+     */
+    bool pop(T &value)  // OUT: if not empty, the head value; otherwise unchanged
+                        // RET: true if a value was removed, false if empty
+    {
+        if(0 == _count) {
+            return false;
+        }
+        T *slot = _slot(_tail + _count - 1);
+        value = *slot;
+        slot->~T();
+        _count -= 1;
+        return true;
+    }
+
+    /**
+     * Remove the least recently pushed value
+     */
+    bool dequeue(T &value)  // OUT: if not empty, the tail value; otherwise unchanged
+                            // RET: true if a value was removed, false if empty
+    {
+        if(0 == _count) {
+            return false;
+        }
+        T *slot = _slot(_tail);
+        value = *slot;
+        slot->~T();
+        _tail += 1;
+        _count -= 1;
+        return true;
+    }
+
+    /**
+     * Drop values from the tail until at
+     * most size values remain; so truncateTo(1)
+     * keeps only the head.
+     */
+    Ring& truncateTo(unsigned int size) // IN : the most values to keep
+                                        // RET: this ring
+    {
+        while(_count > size) {
+            _slot(_tail)->~T();
+            _tail += 1;
+            _count -= 1;
+        }
+        return *this;
+    }
+
+    /**
+     * Drop all values
+     */
+    Ring& clear() // RET: this ring
+    {
+        return truncateTo(0);
+    }
+};
+
+#endif // UTIL_RING_H
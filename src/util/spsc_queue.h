@@ -0,0 +1,76 @@
+#ifndef UTIL_SPSC_QUEUE_H
+#define UTIL_SPSC_QUEUE_H
+
+#include <atomic>
+
+/**
+ * Lock-free single-producer, single-consumer FIFO
+ * with a fixed capacity.  Values are delivered in
+ * the order they were pushed; a push onto a full
+ * queue fails rather than dropping a value.
+ *
+ * Head and tail are free running counters; only the
+ * producer writes the head and only the consumer
+ * writes the tail, so the producer and consumer
+ * may run on different tasks or cores.
+ */
+template <class T, unsigned int N> class SpscQueue {
+    static_assert((N > 0) && (0 == (N & (N - 1))), "SpscQueue capacity must be a power of two");
+
+    private:
+    T _buffer[N];
+    std::atomic<unsigned int> _head{0};  // next slot to write; owned by producer
+    std::atomic<unsigned int> _tail{0};  // next slot to read; owned by consumer
+
+    public:
+
+    static constexpr unsigned int capacity() { return N; }
+
+    /**
+     * Number of values in the queue; this is a
+     * snapshot if called while the other side is active.
+     */
+    unsigned int count() const // RET: values waiting to be popped
+    {
+        return _head.load(std::memory_order_acquire) - _tail.load(std::memory_order_acquire);
+    }
+
+    bool empty() const { return 0 == count(); }
+
+    /**
+     * Append a value to the queue.
+     * Call only from the single producer.
+     */
+    bool push(
+        const T &value) // IN : value to append
+                        // RET: true if appended, false if queue is full
+    {
+        const unsigned int head = _head.load(std::memory_order_relaxed);
+        if(head - _tail.load(std::memory_order_acquire) >= N) {
+            return false;
+        }
+        _buffer[head & (N - 1)] = value;
+        _head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Remove the oldest value from the queue.
+     * Call only from the single consumer.
+     */
+    bool pop(
+        T &value)   // OUT: if not empty, the oldest value;
+                    //      otherwise unchanged
+                    // RET: true if a value was popped, false if queue is empty
+    {
+        const unsigned int tail = _tail.load(std::memory_order_relaxed);
+        if(_head.load(std::memory_order_acquire) == tail) {
+            return false;
+        }
+        value = _buffer[tail & (N - 1)];
+        _tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+};
+
+#endif // UTIL_SPSC_QUEUE_H
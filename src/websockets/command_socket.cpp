@@ -1,16 +1,114 @@
 // #include <Arduino.h>
+#include <string.h>
 #include <WebSocketsServer.h>
 #include "command_socket.h"
+#include "../hal/clock.h"
 
 #include "../string/strcopy.h"
 #include "../rover/rover.h"
 #include "../rover/rover_command.h"
+#include "../rover/rover_binary.h"
+#include "../rover/goto_goal.h"
+#include "../wheel/drive_wheel.h"
+#include "../settings/state_snapshot.h"
 
 #define LOG_LEVEL ERROR_LEVEL
 #include "../log.h"
 
 extern TwoWheelRover rover; // declared in main.cpp
 extern RoverCommandProcessor roverCommandProcessor; // declared in main.cpp
+extern DriveWheel leftWheel;                        // declared in main.cpp
+extern DriveWheel rightWheel;                       // declared in main.cpp
+extern GotoGoalBehavior gotoGoalBehavior;           // declared in main.cpp
+extern Settings settings;                           // declared in main.cpp
+
+StateSnapshot stateSnapshot;    // cached full state sent to newly connected client
+
+/**
+ * Format a nack with the failure status
+ */
+static unsigned int formatNack(char *reply, unsigned int replySize, int status) {
+    int offset = strCopy(reply, replySize, "nack(");
+    offset = strCopyIntAt(reply, replySize, offset, status);
+    offset = strCopyAt(reply, replySize, offset, ")");
+    return (unsigned int)offset;
+}
+
+/**
+ * Submit a received text command and format the reply
+ */
+unsigned int commandTextReceived(
+    const unsigned char *payload,   // IN : command text, not null terminated
+    unsigned int length,            // IN : chars in payload
+    unsigned long receivedUs,       // IN : micros() when received
+    char *reply,                    // OUT: reply; the command to ack it, or nack(status)
+    unsigned int replySize)         // IN : size of reply buffer
+                                    // RET: chars in reply
+{
+    // submit the command for execution
+    char buffer[128];
+    strCopySize(buffer, sizeof(buffer), (const char *)payload, (int)length);
+    LOG_INFO("commandTextReceived: %s", buffer);
+    const SubmitCommandResult result = roverCommandProcessor.submitCommand(buffer, 0, receivedUs);
+    if(SUCCESS == result.status) {
+        //
+        // ack the command by sending it back
+        //
+        return (unsigned int)strCopySize(reply, replySize, (const char *)payload, (int)length);
+    }
+
+    //
+    // nack the command with status
+    //
+    return formatNack(reply, replySize, result.status);
+}
+
+/**
+ * Submit a received binary command and format the reply
+ */
+unsigned int commandBinaryReceived(
+    unsigned char *payload,         // IN : binary command
+    unsigned int length,            // IN : bytes in payload
+    unsigned char *reply,           // OUT: reply; the command header to ack it, or nack(status) text
+    unsigned int replySize,         // IN : size of reply buffer
+    bool *binaryReply)              // OUT: true if reply is binary ack, false if text nack
+                                    // RET: bytes in reply
+{
+    // submit the binary command for execution
+    const SubmitCommandResult result = roverCommandProcessor.submitBinaryCommand(payload, length);
+    if((SUCCESS == result.status) && (replySize >= BINARY_HEADER_BYTES)) {
+        //
+        // ack the command by sending back its opcode and id
+        //
+        memcpy(reply, payload, BINARY_HEADER_BYTES);
+        *binaryReply = true;
+        return BINARY_HEADER_BYTES;
+    }
+
+    //
+    // nack the command with status
+    //
+    *binaryReply = false;
+    return formatNack((char *)reply, replySize, result.status);
+}
+
+/**
+ * Full rover state for a newly connected client,
+ * so it can render without querying each setting
+ */
+const char *commandStateSnapshot(int *length) // OUT: chars in snapshot
+                                              // RET: null terminated snapshot
+{
+    const SnapshotState state = {
+        0 != leftWheel.useSpeedControl(),
+        0 != rightWheel.useSpeedControl(),
+        GotoGoalStateStr[gotoGoalBehavior.state()],
+        roverCommandProcessor.script().running() ? "RUNNING" : "STOPPED",
+    };
+    return stateSnapshot.snapshot(settings, state, length);
+}
+
+#ifndef USE_MULTIPLEX_SOCKET
 
 void wsCommandEvent(unsigned char clientNum, WStype_t type, unsigned char * payload, unsigned int length);
 void logWsEvent(const char *event, const int id);
@@ -69,39 +167,36 @@ void wsCommandEvent(unsigned char clientNum, WStype_t type, unsigned char * payl
         } 
         case WStype_PONG: {
             logWsEvent("wsCommandEvent.WStype_PONG", clientNum);
+            if(commandClientId != clientNum) {
+                // the client is new; bring it up to date
+                int snapshotLength;
+                const char *snapshot = commandStateSnapshot(&snapshotLength);
+                wsCommand.sendTXT(clientNum, snapshot, snapshotLength);
+            }
             commandClientId = clientNum;
             isCommandSocketOn = true;
             return;
         }
         case WStype_BIN: {
             logWsEvent("wsCommandEvent.WStype_BIN", clientNum);
+
+            unsigned char reply[32];
+            bool binaryReply;
+            const unsigned int replyLength = commandBinaryReceived(payload, length, reply, sizeof(reply), &binaryReply);
+            if(binaryReply) {
+                wsCommand.sendBIN(clientNum, reply, replyLength);
+            } else {
+                wsCommand.sendTXT(clientNum, (const char *)reply, replyLength);
+            }
             return;
         }
         case WStype_TEXT: {
-            // log the command
-            char buffer[128];
-            #ifdef LOG_LEVEL
-                #if (LOG_LEVEL >= INFO_LEVEL)
-                    const int offset = strCopy(buffer, sizeof(buffer), "wsCommandEvent.WStype_TEXT: ");
-                    strCopySizeAt(buffer, sizeof(buffer), offset, (const char *)payload, length);
-                    logWsEvent(buffer, clientNum);
-                #endif
-            #endif
-
-            // submit the command for execution
-            strCopySize(buffer, sizeof(buffer), (const char *)payload, (int)length);
-            const SubmitCommandResult result = roverCommandProcessor.submitCommand(buffer, 0);
-            if(SUCCESS == result.status) {
-                //
-                // ack the command by sending it back
-                //
-                wsCommand.sendTXT(clientNum, (const char *)payload, length);
-            } else {
-                //
-                // nack the command with status
-                //
-                wsCommand.sendTXT(clientNum, String("nack(") + String(result.status) + String(")"));
-            }
+            // receive time for command latency
+            const unsigned long receivedUs = halMicros();
+
+            char reply[128];
+            const unsigned int replyLength = commandTextReceived(payload, length, receivedUs, reply, sizeof(reply));
+            wsCommand.sendTXT(clientNum, reply, replyLength);
             return;
         }
         default: {
@@ -116,13 +211,7 @@ void logWsEvent(
     const char *event,  // IN : name of event as null terminated string
     const int id)       // IN : client id to copy
 {
-    #ifdef LOG_LEVEL
-        #if (LOG_LEVEL >= INFO_LEVEL)
-            char msg[128];
-            int offset = strCopy(msg, sizeof(msg), event);
-            offset = strCopyAt(msg, sizeof(msg), offset, ", clientId: ");
-            strCopyIntAt(msg, sizeof(msg), offset, id);
-            LOG_INFO(msg);
-        #endif
-    #endif
+    LOG_INFO("%s, clientId: %d", event, id);
 }
+
+#endif // USE_MULTIPLEX_SOCKET
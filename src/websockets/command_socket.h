@@ -6,4 +6,38 @@ extern void wsCommandPoll();
 extern void wsSendCommandText(const char *msg, unsigned int length);
 extern void wsCommandLogger(const char *msg, int value);
 
+//
+// command handling shared by the command socket
+// and the multiplexed socket
+//
+
+/**
+ * Submit a received text command and format the reply
+ */
+extern unsigned int commandTextReceived(
+    const unsigned char *payload,   // IN : command text, not null terminated
+    unsigned int length,            // IN : chars in payload
+    unsigned long receivedUs,       // IN : micros() when received
+    char *reply,                    // OUT: reply; the command to ack it, or nack(status)
+    unsigned int replySize);        // IN : size of reply buffer
+                                    // RET: chars in reply
+
+/**
+ * Submit a received binary command and format the reply
+ */
+extern unsigned int commandBinaryReceived(
+    unsigned char *payload,         // IN : binary command
+    unsigned int length,            // IN : bytes in payload
+    unsigned char *reply,           // OUT: reply; the command header to ack it, or nack(status) text
+    unsigned int replySize,         // IN : size of reply buffer
+    bool *binaryReply);             // OUT: true if reply is binary ack, false if text nack
+                                    // RET: bytes in reply
+
+/**
+ * Full rover state for a newly connected client,
+ * so it can render without querying each setting
+ */
+extern const char *commandStateSnapshot(int *length);   // OUT: chars in snapshot
+                                                        // RET: null terminated snapshot
+
 #endif // COMMAND_SOCKET_H
@@ -0,0 +1,85 @@
+#include <string.h>
+#include "mux.h"
+
+/**
+ * Split a received frame into channel and payload
+ */
+MuxDecodeResult muxDecode(
+    const uint8_t *frame,   // IN : received frame
+    unsigned int length)    // IN : bytes in frame
+                            // RET: channel and payload
+{
+    if((nullptr == frame) || (length < MUX_HEADER_BYTES)
+        || (frame[0] < MUX_COMMAND) || (frame[0] >= MUX_CHANNEL_LIMIT))
+    {
+        return {false, MUX_CHANNEL_LIMIT, nullptr, 0};
+    }
+    return {true, (MuxChannel)frame[0], frame + MUX_HEADER_BYTES, length - MUX_HEADER_BYTES};
+}
+
+/**
+ * Write the header for a video chunk
+ */
+unsigned int muxVideoHeader(
+    uint8_t *header,        // OUT: MUX_VIDEO_HEADER_BYTES of header
+    unsigned int offset,    // IN : offset of chunk in jpeg
+    unsigned int length,    // IN : bytes in chunk
+    unsigned int total)     // IN : bytes in jpeg
+                            // RET: MUX_VIDEO_HEADER_BYTES
+{
+    uint8_t flags = 0;
+    if(0 == offset) flags |= MUX_VIDEO_FIRST;
+    if(offset + length >= total) flags |= MUX_VIDEO_LAST;
+    header[0] = MUX_VIDEO;
+    header[1] = flags;
+    return MUX_VIDEO_HEADER_BYTES;
+}
+
+/**
+ * Queue a frame
+ */
+bool MuxOutbox::push(
+    MuxChannel channel,         // IN : MUX_COMMAND, MUX_BINARY_COMMAND or MUX_TELEMETRY
+    const uint8_t *payload,     // IN : payload bytes
+    unsigned int length)        // IN : bytes in payload; at most MUX_PAYLOAD_BYTES
+                                // RET: true if queued, false if full, too long or not queueable
+{
+    if((channel < MUX_COMMAND) || (channel >= MUX_VIDEO) || (length > MUX_PAYLOAD_BYTES)) {
+        _dropped += 1;
+        return false;
+    }
+
+    MuxFrame frame;
+    frame.bytes[0] = (uint8_t)channel;
+    memcpy(frame.bytes + MUX_HEADER_BYTES, payload, length);
+    frame.length = (uint16_t)(MUX_HEADER_BYTES + length);
+    if(!_queues[channel - MUX_COMMAND].push(frame)) {
+        _dropped += 1;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Take the next frame to send
+ */
+bool MuxOutbox::pop(
+    MuxFrame &frame)    // OUT: highest priority frame, with channel
+                        // RET: true if there was a frame
+{
+    for(unsigned int i = 0; i < QUEUES; i += 1) {
+        if(_queues[i].pop(frame)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool MuxOutbox::empty() const {
+    for(unsigned int i = 0; i < QUEUES; i += 1) {
+        if(!_queues[i].empty()) {
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,103 @@
+#ifndef WEBSOCKETS_MUX_H
+#define WEBSOCKETS_MUX_H
+
+#include <stdint.h>
+#include "../util/spsc_queue.h"
+
+//
+// Channels of the single multiplexed websocket.
+// Every frame is binary and starts with its channel;
+// channels are sent in this order of priority, so
+// command acks go out ahead of telemetry and telemetry
+// goes out ahead of the rest of a video frame.
+//
+//   [MUX_COMMAND][command text]         like cmd(...); ack echoes it, nack is nack(n)
+//   [MUX_BINARY_COMMAND][binary command] ack is the command's header
+//   [MUX_TELEMETRY][telemetry text]     like tel({...})
+//   [MUX_VIDEO][flags][jpeg bytes]      one chunk of a jpeg; flags mark the first and last
+//
+typedef enum {
+    MUX_COMMAND = 1,
+    MUX_BINARY_COMMAND,
+    MUX_TELEMETRY,
+    MUX_VIDEO,
+    MUX_CHANNEL_LIMIT,  // SHOULD ALWAYS BE LAST
+} MuxChannel;
+
+const uint8_t MUX_VIDEO_FIRST = 0x01;   // chunk starts a jpeg
+const uint8_t MUX_VIDEO_LAST = 0x02;    // chunk ends a jpeg
+
+const unsigned int MUX_HEADER_BYTES = 1;        // channel
+const unsigned int MUX_VIDEO_HEADER_BYTES = 2;  // channel and flags
+const unsigned int MUX_PAYLOAD_BYTES = 128;     // largest queued command or telemetry payload
+const unsigned int MUX_OUTBOX_FRAMES = 8;       // queued frames per channel
+
+typedef struct MuxFrame {
+    uint16_t length;        // bytes used, including channel
+    uint8_t bytes[MUX_HEADER_BYTES + MUX_PAYLOAD_BYTES];
+} MuxFrame;
+
+typedef struct MuxDecodeResult {
+    bool matched;               // true if frame has a known channel
+    MuxChannel channel;
+    const uint8_t *payload;     // payload after channel
+    unsigned int length;        // bytes in payload
+} MuxDecodeResult;
+
+/**
+ * Split a received frame into channel and payload
+ */
+extern MuxDecodeResult muxDecode(
+    const uint8_t *frame,   // IN : received frame
+    unsigned int length);   // IN : bytes in frame
+                            // RET: channel and payload
+
+/**
+ * Write the header for a video chunk
+ */
+extern unsigned int muxVideoHeader(
+    uint8_t *header,        // OUT: MUX_VIDEO_HEADER_BYTES of header
+    unsigned int offset,    // IN : offset of chunk in jpeg
+    unsigned int length,    // IN : bytes in chunk
+    unsigned int total);    // IN : bytes in jpeg
+                            // RET: MUX_VIDEO_HEADER_BYTES
+
+/**
+ * Frames waiting to go out on the multiplexed socket,
+ * one queue per channel.  pop() always returns the oldest
+ * frame of the highest priority channel, so a burst of
+ * telemetry can not hold back a command ack.
+ */
+class MuxOutbox {
+    private:
+    static const unsigned int QUEUES = MUX_VIDEO - MUX_COMMAND;   // video is chunked, not queued
+    SpscQueue<MuxFrame, MUX_OUTBOX_FRAMES> _queues[QUEUES];
+    unsigned int _dropped = 0;
+
+    public:
+
+    /**
+     * Queue a frame
+     */
+    bool push(
+        MuxChannel channel,         // IN : MUX_COMMAND, MUX_BINARY_COMMAND or MUX_TELEMETRY
+        const uint8_t *payload,     // IN : payload bytes
+        unsigned int length);       // IN : bytes in payload; at most MUX_PAYLOAD_BYTES
+                                    // RET: true if queued, false if full, too long or not queueable
+
+    /**
+     * Take the next frame to send
+     */
+    bool pop(
+        MuxFrame &frame);   // OUT: highest priority frame, with channel
+                            // RET: true if there was a frame
+
+    bool empty() const;
+
+    /**
+     * Frames that could not be queued
+     */
+    unsigned int dropped() const { return _dropped; }
+};
+
+#endif // WEBSOCKETS_MUX_H
@@ -0,0 +1,231 @@
+#ifdef USE_MULTIPLEX_SOCKET
+
+// #include <Arduino.h>
+#include <WebSocketsServer.h>
+#include "command_socket.h"
+#include "stream_socket.h"
+#include "mux.h"
+
+#include "../config.h"
+#include "../string/strcopy.h"
+#include "../camera/camera_wrap.h"
+#include "../error.h"
+#include "../hal/clock.h"
+
+#define LOG_LEVEL ERROR_LEVEL
+#include "../log.h"
+
+//
+// One websocket carries commands, telemetry and video
+// as channel tagged binary frames; see mux.h.  It replaces
+// the stream socket and the command socket, so there is
+// one server, one set of buffers and one connection per client.
+//
+// Command replies and telemetry queue in the outbox and are
+// sent before each chunk of video, so a large jpeg can not
+// hold back a command ack for longer than one chunk.
+//
+void wsMuxEvent(unsigned char clientNum, WStype_t type, unsigned char * payload, size_t length);
+void wsMuxFlush();
+void wsMuxReply(unsigned char clientNum, MuxChannel channel, const uint8_t *reply, unsigned int length);
+
+WebSocketsServer wsMux = WebSocketsServer(MUX_SOCKET_PORT);
+MuxOutbox muxOutbox;
+
+int muxClientId = -1;           // websocket client id
+bool isMuxSocketOn = false;     // true once client answered the ping
+
+uint8_t muxVideoChunk[MUX_VIDEO_HEADER_BYTES + MUX_VIDEO_CHUNK_BYTES];
+
+void logWsMuxEvent(
+    const char *event,  // IN : name of event as null terminated string
+    const int id)       // IN : client id to copy
+{
+    LOG_INFO("%s, clientId: %d", event, id);
+}
+
+void wsCommandInit() {
+    wsMux.begin();
+    wsMux.onEvent(wsMuxEvent);
+}
+
+void wsCommandPoll() {
+    wsMux.loop();
+    wsMuxFlush();
+}
+
+// the multiplexed socket is started and polled as the command socket
+void wsStreamInit() {}
+void wsStreamPoll() {}
+
+bool wsStreamActive() {
+    return isMuxSocketOn && (muxClientId >= 0);
+}
+
+/**
+ * Send queued command replies and telemetry,
+ * highest priority first
+ */
+void wsMuxFlush() {
+    MuxFrame frame;
+    while(muxOutbox.pop(frame)) {
+        if(isMuxSocketOn && (muxClientId >= 0)) {
+            wsMux.sendBIN(muxClientId, frame.bytes, frame.length);
+        }
+    }
+}
+
+/**
+ * Reply to a command.  The client's replies queue ahead
+ * of telemetry and video; a client that has not answered
+ * the ping yet gets its reply right away, as the command
+ * socket would, since queued frames only go to the client.
+ */
+void wsMuxReply(unsigned char clientNum, MuxChannel channel, const uint8_t *reply, unsigned int length) {
+    if(clientNum == muxClientId) {
+        muxOutbox.push(channel, reply, length);
+    } else if(length <= MUX_PAYLOAD_BYTES) {
+        MuxFrame frame;
+        frame.bytes[0] = (uint8_t)channel;
+        memcpy(frame.bytes + MUX_HEADER_BYTES, reply, length);
+        wsMux.sendBIN(clientNum, frame.bytes, MUX_HEADER_BYTES + length);
+    }
+}
+
+/**
+ * queue a telemetry message for the client
+ */
+void wsSendCommandText(const char *msg, unsigned int length) {
+    if(isMuxSocketOn && (muxClientId >= 0)) {
+        muxOutbox.push(MUX_TELEMETRY, (const uint8_t *)msg, length);
+    }
+}
+
+void wsCommandLogger(const char *msg, int value) {
+    char buffer[128];
+
+    int offset = strCopy(buffer, sizeof(buffer), "log(");
+    offset = strCopyAt(buffer, sizeof(buffer), offset, msg);
+    offset = strCopyAt(buffer, sizeof(buffer), offset, " = ");
+    offset = strCopyIntAt(buffer, sizeof(buffer), offset, value);
+    offset = strCopyAt(buffer, sizeof(buffer), offset, ")");
+
+    wsSendCommandText(buffer, offset);
+}
+
+/**
+ * send the jpeg in chunks, letting commands
+ * and their acks through between chunks
+ */
+FrameCounters streamFrames = {0, 0, 0};
+
+int wsMuxSendImage(uint8_t *imageBuffer, size_t bufferSize) {
+    streamFrames.captured += 1;
+    for(unsigned int offset = 0; offset < bufferSize; offset += MUX_VIDEO_CHUNK_BYTES) {
+        // receive commands and send replies ahead of the rest of the frame
+        wsMux.loop();
+        wsMuxFlush();
+        if(!(isMuxSocketOn && (muxClientId >= 0))) {
+            streamFrames.dropped += 1;
+            return FAILURE;
+        }
+
+        const unsigned int length = (bufferSize - offset < MUX_VIDEO_CHUNK_BYTES) ? (bufferSize - offset) : MUX_VIDEO_CHUNK_BYTES;
+        const unsigned int headerLength = muxVideoHeader(muxVideoChunk, offset, length, bufferSize);
+        memcpy(muxVideoChunk + headerLength, imageBuffer + offset, length);
+        if(!wsMux.sendBIN(muxClientId, muxVideoChunk, headerLength + length)) {
+            streamFrames.dropped += 1;
+            return FAILURE;
+        }
+    }
+    streamFrames.sent += 1;
+    return SUCCESS;
+}
+
+//
+// get a camera image and send it down websocket
+//
+void wsStreamCameraImage() {
+    if (isMuxSocketOn && (muxClientId >= 0)) {
+        esp_err_t result = processImage(wsMuxSendImage);
+        if (SUCCESS != result) {
+            LOG_ERROR("Failure grabbing and sending image.");
+        }
+    }
+}
+
+/**
+ * Handle a websocket event on the multiplexed socket
+ */
+void wsMuxEvent(unsigned char clientNum, WStype_t type, unsigned char * payload, size_t length) {
+    switch(type) {
+        case WStype_CONNECTED: {
+            logWsMuxEvent("wsMuxEvent.WS_EVT_CONNECT", clientNum);
+            wsMux.sendPing(clientNum, (uint8_t *)"ping", sizeof("ping"));
+            return;
+        }
+        case WStype_DISCONNECTED: {
+            logWsMuxEvent("wsMuxEvent.WS_EVT_DISCONNECT", clientNum);
+            if (muxClientId == clientNum) {
+                muxClientId = -1;
+                isMuxSocketOn = false;
+            }
+            return;
+        }
+        case WStype_PONG: {
+            logWsMuxEvent("wsMuxEvent.WStype_PONG", clientNum);
+            if(muxClientId != clientNum) {
+                // the client is new; bring it up to date before anything else
+                muxClientId = clientNum;
+                isMuxSocketOn = true;
+                int snapshotLength;
+                const char *snapshot = commandStateSnapshot(&snapshotLength);
+                if(MUX_HEADER_BYTES + snapshotLength <= sizeof(muxVideoChunk)) {
+                    // too big for the outbox; borrow the video chunk buffer
+                    muxVideoChunk[0] = MUX_TELEMETRY;
+                    memcpy(muxVideoChunk + MUX_HEADER_BYTES, snapshot, snapshotLength);
+                    wsMux.sendBIN(clientNum, muxVideoChunk, MUX_HEADER_BYTES + snapshotLength);
+                }
+            }
+            return;
+        }
+        case WStype_BIN: {
+            // receive time for command latency
+            const unsigned long receivedUs = halMicros();
+
+            const MuxDecodeResult decoded = muxDecode(payload, length);
+            if(!decoded.matched) {
+                logWsMuxEvent("wsMuxEvent.UNKNOWN CHANNEL: ", clientNum);
+                return;
+            }
+            switch(decoded.channel) {
+                case MUX_COMMAND: {
+                    char reply[MUX_PAYLOAD_BYTES];
+                    const unsigned int replyLength = commandTextReceived(decoded.payload, decoded.length, receivedUs, reply, sizeof(reply));
+                    wsMuxReply(clientNum, MUX_COMMAND, (const uint8_t *)reply, replyLength);
+                    break;
+                }
+                case MUX_BINARY_COMMAND: {
+                    unsigned char reply[32];
+                    bool binaryReply;
+                    const unsigned int replyLength = commandBinaryReceived(
+                        (unsigned char *)decoded.payload, decoded.length, reply, sizeof(reply), &binaryReply);
+                    wsMuxReply(clientNum, binaryReply ? MUX_BINARY_COMMAND : MUX_COMMAND, reply, replyLength);
+                    break;
+                }
+                default: {
+                    // telemetry and video only go to the client
+                    logWsMuxEvent("wsMuxEvent.UNEXPECTED CHANNEL: ", clientNum);
+                    break;
+                }
+            }
+            return;
+        }
+        default: {
+            logWsMuxEvent("wsMuxEvent.UNHANDLED EVENT: ", clientNum);
+            return;
+        }
+    }
+}
+
+#endif // USE_MULTIPLEX_SOCKET
@@ -1,6 +1,7 @@
 // #include <Arduino.h>
 #include <WebSocketsServer.h>
 #include "command_socket.h"
+#include "stream_socket.h"
 
 #include "../string/strcopy.h"
 #include "../camera/camera_wrap.h"
@@ -9,6 +10,8 @@
 #define LOG_LEVEL ERROR_LEVEL
 #include "../log.h"
 
+#ifndef USE_MULTIPLEX_SOCKET
+
 void wsStreamEvent(unsigned char clientNum, WStype_t type, uint8_t * payload, size_t length);
 
 WebSocketsServer wsStream = WebSocketsServer(81);
@@ -26,13 +29,22 @@ void wsStreamPoll() {
     wsStream.loop();
 }
 
+bool wsStreamActive() {
+    return isCameraStreamOn && (cameraClientId >= 0);
+}
+
 //
 // send the given image buffer down the websocket
 //
-int wsStreamSendImage(unsigned char *imageBuffer, unsigned int bufferSize) {
+FrameCounters streamFrames = {0, 0, 0};
+
+int wsStreamSendImage(uint8_t *imageBuffer, size_t bufferSize) {
+    streamFrames.captured += 1;
     if (wsStream.sendBIN(cameraClientId, imageBuffer, bufferSize)) {
+        streamFrames.sent += 1;
         return SUCCESS;
     }
+    streamFrames.dropped += 1;
     return FAILURE;
 }
 
@@ -55,15 +67,7 @@ void logWsStreamEvent(
     const char *event,  // IN : name of event as null terminated string
     const int id)       // IN : client id to copy
 {
-    #ifdef LOG_LEVEL
-        #if (LOG_LEVEL >= INFO_LEVEL)
-            char msg[128];
-            int offset = strCopy(msg, sizeof(msg), event);
-            offset = strCopyAt(msg, sizeof(msg), offset, ", clientId: ");
-            strCopyIntAt(msg, sizeof(msg), offset, id);
-            LOG_INFO(msg);
-        #endif
-    #endif
+    LOG_INFO("%s, clientId: %d", event, id);
 }
 
 void wsStreamEvent(unsigned char clientNum, WStype_t type, uint8_t * payload, size_t length) {
@@ -106,3 +110,4 @@ void wsStreamEvent(unsigned char clientNum, WStype_t type, uint8_t * payload, si
     }
 }
 
+#endif // USE_MULTIPLEX_SOCKET
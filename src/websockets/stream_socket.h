@@ -1,8 +1,13 @@
 #ifndef STREAM_SOCKET_H
 #define STREAM_SOCKET_H
 
+#include "../metrics/runtime_metrics.h"
+
 extern void wsStreamInit();
 extern void wsStreamCameraImage();
 extern void wsStreamPoll();
+extern bool wsStreamActive();   // true if a client is streaming
+
+extern FrameCounters streamFrames;  // frames captured, sent and dropped by the stream
 
 #endif // STREAM_SOCKET_H
@@ -1,10 +1,9 @@
-// #include <Arduino.h>
 #include "drive_wheel.h"
+#include "../hal/clock.h"
 #include "../util/math.h"
 #include "../string/strcopy.h"
 #include "../rover/pose.h"
 
-history_type _historyDefault = {0, 0}; // default value for empty history 
 
 /**
  * Get the motor stall value.
@@ -154,7 +153,7 @@ encoder_count_type DriveWheel::encoderTicks() // RET: wheel encoder count
 DriveWheel& DriveWheel::halt() // RET: this drive wheel
 {
     // disengage speed control
-    this->_history.truncateTo(0);
+    this->_history.reset();
     this->_lastSpeed = 0;
     this->_useSpeedControl = false;
 
@@ -192,7 +191,7 @@ DriveWheel& DriveWheel::_setPwm(
             if(directionChanged || (0 == _motor->pwm())) {
                 if(_history.count() > 0) {
                     // keep most recent entry, throw away the rest
-                    _history.truncateTo(1);
+                    _history.restart();
                 }
             }
 
@@ -297,7 +296,7 @@ DriveWheel& DriveWheel::poll(
                                     // RET: this drive wheel
 {
     _pollEncoder();
-    _pollSpeed(millis());
+    _pollSpeed(halMillis());
     return *this;
 }
 
@@ -337,13 +336,8 @@ DriveWheel& DriveWheel::_pollSpeed(
             if((encoderTicks - _lastEncoderTicks) >=  CONTROL_MIN_ENCODER_COUNT) {
                 encoder_count_type encoderCount = this->encoderCount();
                 const distance_type currentDistance = _circumference * (distance_type)encoderCount / _pulsesPerRevolution;
-                speed_type currentSpeed = 0; // assume coldstart (no prior reading/history)
-
-                if(_history.count() > 0) {
-                    const distance_type deltaDistance = currentDistance - _history.tail().distance;
-                    const speed_type deltaSeconds = (currentMillis - _history.tail().millis) / 1000.0;
-                    currentSpeed = deltaDistance / deltaSeconds;
-                }
+                // zero on coldstart (no prior reading/history)
+                const speed_type currentSpeed = _history.add(currentMillis, currentDistance);
 
                 if(_useSpeedControl) {
                     if(0 != _targetSpeed) {
@@ -382,10 +376,6 @@ DriveWheel& DriveWheel::_pollSpeed(
                 _lastSpeed = currentSpeed;  // last speed used by speed control
                 _lastEncoderTicks = encoderTicks;   // last encoder count use by speed control
 
-                // if history is full, drop last entry to make room for new entry
-                history_type historyEntry = {currentMillis, currentDistance};
-                _history.push(historyEntry);
-
                 // publish speed control message
                 if(nullptr != _messageBus) {
                     publish(*_messageBus, SPEED_CONTROL, specifier());
@@ -4,19 +4,11 @@
 #include "../motor/motor_l9110s.h"
 #include "../encoder/encoder.h"
 #include "../message_bus/message_bus.h"
-#include "../util/circular_buffer.h"
+#include "speed_estimator.h"
 #include "../rover/pose.h"
 
 #include "../config.h"
 
-typedef float speed_type;
-
-typedef struct history_type {
-    unsigned long millis;
-    float distance;
-} history_type;
-
-extern history_type _historyDefault; // default value for empty history 
 
 class DriveWheel : public Publisher {
     private:
@@ -47,12 +39,11 @@ class DriveWheel : public Publisher {
 
     //
     // we keep history of distance measurements at given time
-    // using circular buffers.  This allows us to calculate
-    // a smoothed speed often.  
-    // - to use the singular instantaneous speed, use _historyLength = 1
+    // so we can calculate a smoothed speed often.
+    // - to use the singular instantaneous speed, use CONTROL_HISTORY_LENGTH = 1
+    // - to trade noise for lag, choose a SPEED_FILTER
     //
-    history_type _historyBuffer[CONTROL_HISTORY_LENGTH];  // number of samples for control smoothing
-    CircularBuffer<history_type> _history;
+    SpeedEstimator _history;
 
     /**
      * Poll the wheel encoder
@@ -82,8 +73,8 @@ class DriveWheel : public Publisher {
         float circumference)        // IN : circumference of wheel.
                                     //      Note: use 1.0 to deal in pulsesPerRevolution of encoder
         :   Publisher(specifier), 
-            _circumference(circumference), 
-            _history(_historyBuffer, sizeof(_historyBuffer) / sizeof(history_type), _historyDefault)
+            _circumference(circumference),
+            _history(SPEED_FILTER)
     {
 
     }
@@ -248,8 +239,7 @@ class DriveWheel : public Publisher {
      */
     float distance()    // RET: last measured total distance
     {
-        // entry at head of circular buffer is most recent
-        return _history.head().distance;
+        return _history.lastDistance();
     }
 
     /**
@@ -257,8 +247,26 @@ class DriveWheel : public Publisher {
      */
     unsigned long lastMs()   // RET: time of last measurement in ms
     {
-        // entry at head of circular buffer is most recent
-        return _history.head().millis;
+        return _history.lastMs();
+    }
+
+    /**
+     * Filter used to estimate speed
+     */
+    SpeedFilter speedFilter() // RET: current speed filter
+    {
+        return _history.filter();
+    }
+
+    /**
+     * Choose how speed is estimated from encoder
+     * distance; the new filter starts fresh.
+     */
+    DriveWheel& setSpeedFilter(SpeedFilter filter) // IN : speed filter
+                                                   // RET: this drive wheel
+    {
+        _history.setFilter(filter);
+        return *this;
     }
 
     /**
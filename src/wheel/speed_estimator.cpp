@@ -0,0 +1,112 @@
+#include "speed_estimator.h"
+
+const char *SpeedFilterStr[NUMBER_OF_SPEED_FILTERS] = {
+    "difference",
+    "average",
+    "mean",
+    "median",
+    "savitzkyGolay",
+};
+
+void SpeedEstimator::_resetFilters() {
+    _average.reset();
+    _mean.reset();
+    _median.reset();
+    _slope.reset();
+    _spacing.reset();
+}
+
+/**
+ * Change the filter; starts it fresh
+ */
+SpeedEstimator& SpeedEstimator::setFilter(SpeedFilter filter) // IN : filter to apply to raw speed
+                                                              // RET: this instance
+{
+    if(filter < NUMBER_OF_SPEED_FILTERS) {
+        _filter = filter;
+        _resetFilters();
+    }
+    return *this;
+}
+
+/**
+ * Add a distance sample
+ */
+speed_type SpeedEstimator::add(
+    unsigned long currentMillis,    // IN : time of sample
+    distance_type distance)         // IN : distance travelled at that time
+                                    // RET: estimated speed; 0 for the first sample
+{
+    speed_type raw = 0; // assume coldstart (no prior reading/history)
+    const bool hasHistory = (_history.count() > 0) && (currentMillis != _history.tail().millis);
+    if(hasHistory) {
+        const distance_type deltaDistance = distance - _history.tail().distance;
+        const speed_type deltaSeconds = (currentMillis - _history.tail().millis) / 1000.0;
+        raw = deltaDistance / deltaSeconds;
+    }
+    const unsigned long previousMs = _history.head().millis;
+    const bool hadSample = _history.count() > 0;
+    _history.push({currentMillis, distance});
+
+    if(SPEED_SAVITZKY_GOLAY == _filter) {
+        // samples are not evenly spaced; keep their spacing to average
+        _slope.add(distance);
+        if(hadSample) {
+            _spacing.add((currentMillis - previousMs) / 1000.0);
+        }
+    }
+
+    if(!hasHistory) {
+        _speed = raw;
+        return _speed;
+    }
+
+    switch(_filter) {
+        case SPEED_AVERAGE: {
+            _speed = _average.add(raw);
+            break;
+        }
+        case SPEED_MEAN: {
+            _speed = _mean.add(raw).mean();
+            break;
+        }
+        case SPEED_MEDIAN: {
+            _speed = _median.add(raw);
+            break;
+        }
+        case SPEED_SAVITZKY_GOLAY: {
+            // use the raw estimate until the window fills
+            _speed = _slope.ready() ? _slope.derivative(_spacing.mean()) : raw;
+            break;
+        }
+        default: {
+            _speed = raw;
+            break;
+        }
+    }
+    return _speed;
+}
+
+/**
+ * Keep only the newest sample
+ */
+SpeedEstimator& SpeedEstimator::restart() // RET: this instance
+{
+    _history.truncateTo(1);
+    _resetFilters();
+    if(_history.count() > 0) {
+        _slope.add(_history.head().distance);
+    }
+    return *this;
+}
+
+/**
+ * Forget all samples
+ */
+SpeedEstimator& SpeedEstimator::reset() // RET: this instance
+{
+    _history.clear();
+    _resetFilters();
+    _speed = 0;
+    return *this;
+}
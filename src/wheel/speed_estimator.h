@@ -0,0 +1,83 @@
+#ifndef WHEEL_SPEED_ESTIMATOR_H
+#define WHEEL_SPEED_ESTIMATOR_H
+
+#include "../config.h"
+#include "../util/ring.h"
+#include "../util/filters.h"
+
+typedef struct history_type {
+    unsigned long millis;
+    float distance;
+} history_type;
+
+extern const char *SpeedFilterStr[NUMBER_OF_SPEED_FILTERS];
+
+/**
+ * Estimate wheel speed from distance samples.
+ *
+ * The raw estimate is the distance change across the
+ * last CONTROL_HISTORY_LENGTH samples divided by the
+ * time between them; the selected SpeedFilter then
+ * trades its noise for lag.  Each sample is O(1),
+ * except SPEED_MEDIAN which is O(SPEED_FILTER_WINDOW).
+ */
+class SpeedEstimator {
+    private:
+    SpeedFilter _filter;
+    Ring<history_type, CONTROL_HISTORY_LENGTH> _history;    // empty is {0, 0}
+    ExponentialAverage<speed_type> _average;
+    WindowStats<speed_type, SPEED_FILTER_WINDOW> _mean;
+    MedianFilter<speed_type, SPEED_FILTER_WINDOW> _median;
+    SavitzkyGolayDerivative<distance_type, SPEED_FILTER_WINDOW> _slope;
+    WindowStats<speed_type, SPEED_FILTER_WINDOW - 1> _spacing;  // seconds between samples in the slope window
+    speed_type _speed = 0;
+
+    void _resetFilters();
+
+    public:
+
+    SpeedEstimator(SpeedFilter filter)  // IN : filter to apply to raw speed
+        : _filter(filter), _average(SPEED_AVERAGE_ALPHA) {}
+
+    SpeedFilter filter() const { return _filter; }
+
+    /**
+     * Change the filter; starts it fresh
+     */
+    SpeedEstimator& setFilter(SpeedFilter filter); // IN : filter to apply to raw speed
+                                                   // RET: this instance
+
+    /**
+     * Add a distance sample
+     */
+    speed_type add(
+        unsigned long currentMillis,    // IN : time of sample
+        distance_type distance);        // IN : distance travelled at that time
+                                        // RET: estimated speed; 0 for the first sample
+
+    /**
+     * Most recent speed estimate
+     */
+    speed_type speed() const { return _speed; }
+
+    /**
+     * Time and distance of the most recent sample
+     */
+    unsigned long lastMs() const { return _history.head().millis; }
+    distance_type lastDistance() const { return _history.head().distance; }
+
+    unsigned int count() const { return _history.count(); }
+
+    /**
+     * Keep only the newest sample, like when the wheel
+     * changes direction, so speed control is more responsive
+     */
+    SpeedEstimator& restart(); // RET: this instance
+
+    /**
+     * Forget all samples
+     */
+    SpeedEstimator& reset(); // RET: this instance
+};
+
+#endif // WHEEL_SPEED_ESTIMATOR_H
@@ -0,0 +1,73 @@
+#ifndef TESTING
+
+#include <string.h>
+#include <WiFi.h>
+#include "wifi_radio.h"
+
+/**
+ * Put radio in station mode and take over reconnection
+ */
+void Esp32WifiRadio::init(
+    const WifiStaticIp *staticIp)   // IN : static address or nullptr to use dhcp
+{
+    WiFi.mode(WIFI_STA);
+    WiFi.persistent(false);         // don't write credentials to flash on every join
+    WiFi.setAutoReconnect(false);   // WifiManager reconnects with backoff
+    if(nullptr != staticIp) {
+        WiFi.config(
+            IPAddress(staticIp->ip[0], staticIp->ip[1], staticIp->ip[2], staticIp->ip[3]),
+            IPAddress(staticIp->gateway[0], staticIp->gateway[1], staticIp->gateway[2], staticIp->gateway[3]),
+            IPAddress(staticIp->subnet[0], staticIp->subnet[1], staticIp->subnet[2], staticIp->subnet[3]),
+            IPAddress(staticIp->dns[0], staticIp->dns[1], staticIp->dns[2], staticIp->dns[3]));
+    }
+}
+
+/**
+ * Start joining an access point; does not wait
+ */
+void Esp32WifiRadio::begin(
+    const char *ssid,           // IN : network name
+    const char *password,       // IN : network password
+    int32_t channel,            // IN : channel to join on, 0 to scan all channels
+    const uint8_t *bssid)       // IN : access point to join, nullptr for any
+{
+    WiFi.begin(ssid, password, channel, bssid, true);
+}
+
+/**
+ * Drop connection or abandon join
+ */
+void Esp32WifiRadio::disconnect() {
+    WiFi.disconnect(false);
+}
+
+/**
+ * Determine if joined and has an address
+ */
+bool Esp32WifiRadio::connected() {
+    return WL_CONNECTED == WiFi.status();
+}
+
+/**
+ * Channel of the joined access point
+ */
+int32_t Esp32WifiRadio::channel() {
+    return WiFi.channel();
+}
+
+/**
+ * Address of the joined access point
+ */
+bool Esp32WifiRadio::bssid(
+    uint8_t *bssid)     // OUT: WIFI_BSSID_BYTES of bssid
+                        // RET: true if connected and bssid was copied
+{
+    const uint8_t *joined = WiFi.BSSID();
+    if(!connected() || (nullptr == joined)) {
+        return false;
+    }
+    memcpy(bssid, joined, WIFI_BSSID_BYTES);
+    return true;
+}
+
+#endif // TESTING
@@ -0,0 +1,157 @@
+#include "wifi_manager.h"
+#include "../config.h"
+#include "../error.h"
+
+const char *WifiStateStr[NUMBER_OF_WIFI_STATES] = {
+    "DISCONNECTED",
+    "CONNECTING",
+    "CONNECTED",
+};
+
+/**
+ * Deteremine if dependencies are attached
+ */
+bool WifiManager::attached() // RET: true if attached, false if not
+{
+    return nullptr != _radio;
+}
+
+/**
+ * Attach dependencies
+ */
+WifiManager& WifiManager::attach(
+    WifiRadio &radio,           // IN : station radio
+    MessageBus &messageBus)     // IN : message bus to publish state on
+                                // RET: this instance in attached state
+{
+    if(!attached()) {
+        _radio = &radio;
+        _messageBus = &messageBus;
+    }
+    return *this;
+}
+
+/**
+ * Detach dependencies
+ */
+WifiManager& WifiManager::detach() // RET: this instance in detached state
+{
+    if(attached()) {
+        _radio = nullptr;
+        _messageBus = nullptr;
+        _started = false;
+    }
+    return *this;
+}
+
+/**
+ * Start joining; poll() does the rest
+ */
+int WifiManager::begin(
+    const char *ssid,           // IN : network name; must outlive this instance
+    const char *password,       // IN : network password; must outlive this instance
+    const WifiStaticIp *staticIp,   // IN : static address, or nullptr for dhcp
+    unsigned long currentMillis)    // IN : current time in milliseconds
+                                    // RET: SUCCESS if attached, FAILURE if not
+{
+    if(!attached()) {
+        return FAILURE;
+    }
+
+    _ssid = ssid;
+    _password = password;
+    _radio->init(staticIp);
+    _started = true;
+    _backoffMs = WIFI_BACKOFF_MIN_MS;
+    _join(currentMillis);
+    return SUCCESS;
+}
+
+/**
+ * Change state and publish it
+ */
+void WifiManager::_setState(WifiState state, unsigned long currentMillis) {
+    if(state != _state) {
+        _state = state;
+        _stateMs = currentMillis;
+        if(nullptr != _messageBus) {
+            publish(*_messageBus, WIFI_STATE, ROVER_SPEC, WifiStateStr[state]);
+        }
+    }
+}
+
+/**
+ * Start a join, using the cached access point if there is one
+ */
+void WifiManager::_join(unsigned long currentMillis) {
+    _fastRejoin = _haveAccessPoint;
+    _radio->begin(_ssid, _password,
+        _fastRejoin ? _channel : 0,
+        _fastRejoin ? _bssid : nullptr);
+    _stateMs = currentMillis;   // restart join timeout even if state does not change
+    _setState(WIFI_CONNECTING, currentMillis);
+}
+
+/**
+ * Advance the connection state machine
+ */
+WifiManager& WifiManager::poll(unsigned long currentMillis) // IN : current time in milliseconds
+                                                            // RET: this instance
+{
+    if(!(attached() && _started)) {
+        return *this;
+    }
+
+    switch(_state) {
+        case WIFI_DISCONNECTED: {
+            if((long)(currentMillis - _retryAtMs) >= 0) {
+                _join(currentMillis);
+            }
+            break;
+        }
+        case WIFI_CONNECTING: {
+            if(_radio->connected()) {
+                // remember access point for a fast rejoin
+                _haveAccessPoint = _radio->bssid(_bssid);
+                _channel = _radio->channel();
+                _backoffMs = WIFI_BACKOFF_MIN_MS;
+                if(_lost) {
+                    _lost = false;
+                    _outageMs = currentMillis - _lostMs;
+                    _reconnects += 1;
+                }
+                _setState(WIFI_CONNECTED, currentMillis);
+            } else {
+                const unsigned long timeoutMs = _fastRejoin ? WIFI_REJOIN_TIMEOUT_MS : WIFI_JOIN_TIMEOUT_MS;
+                if(currentMillis - _stateMs >= timeoutMs) {
+                    _radio->disconnect();
+                    if(_fastRejoin) {
+                        // access point may have moved; scan right away
+                        _haveAccessPoint = false;
+                        _retryAtMs = currentMillis;
+                    } else {
+                        _retryAtMs = currentMillis + _backoffMs;
+                        _backoffMs = bound<unsigned long>(_backoffMs * 2, WIFI_BACKOFF_MIN_MS, WIFI_BACKOFF_MAX_MS);
+                    }
+                    _setState(WIFI_DISCONNECTED, currentMillis);
+                }
+            }
+            break;
+        }
+        case WIFI_CONNECTED: {
+            if(!_radio->connected()) {
+                // rejoin right away
+                _radio->disconnect();
+                _lost = true;
+                _lostMs = currentMillis;
+                _retryAtMs = currentMillis;
+                _setState(WIFI_DISCONNECTED, currentMillis);
+            }
+            break;
+        }
+        default: {
+            break;
+        }
+    }
+    return *this;
+}
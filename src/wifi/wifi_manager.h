@@ -0,0 +1,114 @@
+#ifndef WIFI_WIFI_MANAGER_H
+#define WIFI_WIFI_MANAGER_H
+
+#include "wifi_radio.h"
+#include "../message_bus/message_bus.h"
+
+typedef enum {
+    WIFI_DISCONNECTED,      // not joined; waiting to retry
+    WIFI_CONNECTING,        // join in progress
+    WIFI_CONNECTED,         // joined with an address
+    NUMBER_OF_WIFI_STATES,  // SHOULD ALWAYS BE LAST
+} WifiState;
+
+extern const char *WifiStateStr[NUMBER_OF_WIFI_STATES];
+
+/**
+ * Keep the rover joined to its access point.
+ *
+ * A failed join is retried with exponential backoff,
+ * from WIFI_BACKOFF_MIN_MS up to WIFI_BACKOFF_MAX_MS.
+ * Once joined, the access point's bssid and channel
+ * are kept so a rejoin after a dropped connection
+ * skips the channel scan; if that fast rejoin fails
+ * the next attempt scans all channels.
+ *
+ * Each state change is published as WIFI_STATE
+ * with the state name as data, like "DISCONNECTED",
+ * so the rover can halt while nobody can steer it.
+ */
+class WifiManager : public Publisher {
+    private:
+    WifiRadio *_radio = nullptr;
+    MessageBus *_messageBus = nullptr;
+
+    const char *_ssid = nullptr;
+    const char *_password = nullptr;
+    bool _started = false;
+
+    WifiState _state = WIFI_DISCONNECTED;
+    unsigned long _stateMs = 0;         // when current state was entered
+    unsigned long _retryAtMs = 0;       // when to try joining again
+    unsigned long _backoffMs = 0;       // wait after next failed join
+
+    bool _fastRejoin = false;           // true if current join uses the cached access point
+    bool _haveAccessPoint = false;      // true if bssid and channel are cached
+    uint8_t _bssid[WIFI_BSSID_BYTES];
+    int32_t _channel = 0;
+
+    bool _lost = false;                 // true if connection dropped and not yet back
+    unsigned long _lostMs = 0;          // when connection dropped
+    unsigned long _outageMs = 0;        // duration of last outage
+    unsigned int _reconnects = 0;       // number of times connection came back
+
+    void _setState(WifiState state, unsigned long currentMillis);
+    void _join(unsigned long currentMillis);
+
+    public:
+
+    WifiManager(): Publisher(ROVER_SPEC) {}
+
+    /**
+     * Deteremine if dependencies are attached
+     */
+    bool attached(); // RET: true if attached, false if not
+
+    /**
+     * Attach dependencies
+     */
+    WifiManager& attach(
+        WifiRadio &radio,           // IN : station radio
+        MessageBus &messageBus);    // IN : message bus to publish state on
+                                    // RET: this instance in attached state
+
+    /**
+     * Detach dependencies
+     */
+    WifiManager& detach(); // RET: this instance in detached state
+
+    /**
+     * Start joining; poll() does the rest
+     */
+    int begin(
+        const char *ssid,           // IN : network name; must outlive this instance
+        const char *password,       // IN : network password; must outlive this instance
+        const WifiStaticIp *staticIp,   // IN : static address, or nullptr for dhcp
+        unsigned long currentMillis);   // IN : current time in milliseconds
+                                        // RET: SUCCESS if attached, FAILURE if not
+
+    /**
+     * Advance the connection state machine
+     */
+    WifiManager& poll(unsigned long currentMillis); // IN : current time in milliseconds
+                                                    // RET: this instance
+
+    WifiState state() const { return _state; }
+    bool connected() const { return WIFI_CONNECTED == _state; }
+
+    /**
+     * Number of times a dropped connection came back
+     */
+    unsigned int reconnects() const { return _reconnects; }
+
+    /**
+     * Milliseconds from the last drop until rejoined
+     */
+    unsigned long lastOutageMs() const { return _outageMs; }
+
+    /**
+     * Wait after the next failed join
+     */
+    unsigned long backoffMs() const { return _backoffMs; }
+};
+
+#endif // WIFI_WIFI_MANAGER_H
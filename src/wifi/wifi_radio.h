@@ -0,0 +1,79 @@
+#ifndef WIFI_WIFI_RADIO_H
+#define WIFI_WIFI_RADIO_H
+
+#include <stdint.h>
+
+const unsigned int WIFI_BSSID_BYTES = 6;
+
+//
+// static station address; skips dhcp when joining
+//
+typedef struct WifiStaticIp {
+    uint8_t ip[4];
+    uint8_t gateway[4];
+    uint8_t subnet[4];
+    uint8_t dns[4];
+} WifiStaticIp;
+
+/**
+ * Wifi station radio, so the connection
+ * manager can be run against a fake one.
+ */
+class WifiRadio {
+    public:
+    virtual ~WifiRadio() {}
+
+    /**
+     * Put radio in station mode and take over reconnection
+     */
+    virtual void init(
+        const WifiStaticIp *staticIp) = 0;  // IN : static address or nullptr to use dhcp
+
+    /**
+     * Start joining an access point; does not wait
+     */
+    virtual void begin(
+        const char *ssid,           // IN : network name
+        const char *password,       // IN : network password
+        int32_t channel,            // IN : channel to join on, 0 to scan all channels
+        const uint8_t *bssid) = 0;  // IN : access point to join, nullptr for any
+
+    /**
+     * Drop connection or abandon join
+     */
+    virtual void disconnect() = 0;
+
+    /**
+     * Determine if joined and has an address
+     */
+    virtual bool connected() = 0;   // RET: true if connected
+
+    /**
+     * Channel of the joined access point
+     */
+    virtual int32_t channel() = 0;
+
+    /**
+     * Address of the joined access point
+     */
+    virtual bool bssid(
+        uint8_t *bssid) = 0;    // OUT: WIFI_BSSID_BYTES of bssid
+                                // RET: true if connected and bssid was copied
+};
+
+#ifndef TESTING
+    /**
+     * ESP32 station radio using the Arduino WiFi library
+     */
+    class Esp32WifiRadio : public WifiRadio {
+        public:
+        virtual void init(const WifiStaticIp *staticIp);
+        virtual void begin(const char *ssid, const char *password, int32_t channel, const uint8_t *bssid);
+        virtual void disconnect();
+        virtual bool connected();
+        virtual int32_t channel();
+        virtual bool bssid(uint8_t *bssid);
+    };
+#endif
+
+#endif // WIFI_WIFI_RADIO_H
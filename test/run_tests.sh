@@ -1,18 +1,96 @@
 
 # test string parsing code
-gcc -DTESTING -std=c++11 -Wc++11-extensions -lstdc++ test.cpp src/parse/parse_strings.test.cpp ../src/parse/*.cpp; ./a.out; rm a.out
+g++ -DTESTING -std=c++11 test.cpp src/parse/parse_strings.test.cpp ../src/parse/*.cpp; ./a.out; rm a.out
 
 # test higher order parsing functions
-gcc -DTESTING -std=c++11 -Wc++11-extensions -lstdc++ test.cpp src/parse/parse_highorder.test.cpp ../src/parse/*.cpp; ./a.out; rm a.out
+g++ -DTESTING -std=c++11 test.cpp src/parse/parse_highorder.test.cpp ../src/parse/*.cpp; ./a.out; rm a.out
 
 # test number parsing functions
-gcc -DTESTING -std=c++11 -Wc++11-extensions -lstdc++ test.cpp src/parse/parse_numbers.test.cpp ../src/parse/*.cpp; ./a.out; rm a.out
+g++ -DTESTING -std=c++11 test.cpp src/parse/parse_numbers.test.cpp ../src/parse/*.cpp; ./a.out; rm a.out
 
 # test rover command parsing functions
-gcc -DTESTING -std=c++11 -Wc++11-extensions -lstdc++ test.cpp src/rover/rover_parse.test.cpp ../src/rover/rover_parse.cpp ../src/parse/*.cpp; ./a.out; rm a.out
+g++ -DTESTING -std=c++11 test.cpp src/rover/rover_parse.test.cpp ../src/rover/rover_parse.cpp ../src/parse/*.cpp; ./a.out; rm a.out
 
 # test message bus
-gcc -DTESTING -std=c++11 -Wc++11-extensions -lstdc++ test.cpp src/message_bus/message_bus.test.cpp ../src/message_bus/message_bus.cpp; ./a.out; rm a.out
+g++ -DTESTING -std=c++11 test.cpp src/message_bus/message_bus.test.cpp ../src/message_bus/message_bus.cpp; ./a.out; rm a.out
 
-# test constant step speed controller
-gcc -DTESTING -std=c++11 -Wc++11-extensions -lstdc++ test.cpp src/pid/step_control.test.cpp ../src/pid/step_control.cpp; ./a.out; rm a.out
+# test occupancy grid and A* path planner; also prints planning benchmarks
+g++ -DTESTING -std=c++11 -O2 test.cpp src/planner/path_planner.test.cpp ../src/planner/*.cpp; ./a.out; rm a.out
+
+# test differential drive kinematics
+g++ -DTESTING -std=c++11 test.cpp src/rover/kinematics.test.cpp ../src/rover/kinematics.cpp; ./a.out; rm a.out
+
+# test goto goal approach controller; also prints simulated time-to-goal
+g++ -DTESTING -std=c++11 test.cpp src/rover/approach_control.test.cpp ../src/rover/approach_control.cpp ../src/rover/kinematics.cpp ../src/rover/pose.cpp; ./a.out; rm a.out
+
+# test behavior arbitration
+g++ -DTESTING -std=c++11 test.cpp src/behavior/arbiter.test.cpp ../src/behavior/arbiter.cpp ../src/behavior/teleop.cpp; ./a.out; rm a.out
+
+# test geofence geometry and fence upload parsing
+g++ -DTESTING -std=c++11 test.cpp src/behavior/geofence.test.cpp ../src/behavior/geofence.cpp ../src/rover/rover_binary.cpp ../src/rover/pose.cpp; ./a.out; rm a.out
+
+# test geofence halt holds against a driver aimed at the fence
+g++ -DTESTING -DUSE_WHEEL_ENCODERS=1 -DUSE_ENCODER_INTERRUPTS=1 -std=c++11 -I../src test.cpp src/behavior/geofence_behavior.test.cpp ../src/behavior/*.cpp ../src/rover/rover.cpp ../src/rover/pose.cpp ../src/rover/kinematics.cpp ../src/message_bus/*.cpp ../src/wheel/*.cpp ../src/motor/*.cpp ../src/encoder/*.cpp ../src/gpio/pwm.cpp ../src/hal/linux_hal.cpp; ./a.out; rm a.out
+
+# test command deadman timer and ramp to halt
+g++ -DTESTING -std=c++11 test.cpp src/rover/deadman.test.cpp ../src/rover/deadman.cpp ../src/behavior/teleop.cpp; ./a.out; rm a.out
+
+# test lock-free latest value slot, single-producer/single-consumer and multiple-producer queues across threads
+g++ -DTESTING -std=c++11 -pthread test.cpp src/util/lockfree.test.cpp; ./a.out; rm a.out
+
+# test timed and scheduled command execution
+g++ -DTESTING -std=c++11 test.cpp src/rover/command_scheduler.test.cpp; ./a.out; rm a.out
+
+# test rover command processor; halt, command ordering and twist conversion
+g++ -DTESTING -std=c++11 -I../src test.cpp src/rover/rover_command.test.cpp ../src/rover/*.cpp ../src/behavior/*.cpp ../src/planner/*.cpp ../src/script/*.cpp ../src/settings/settings.cpp ../src/settings/state_snapshot.cpp ../src/message_bus/*.cpp ../src/parse/*.cpp ../src/string/*.cpp ../src/wheel/*.cpp ../src/motor/*.cpp ../src/encoder/*.cpp ../src/gpio/pwm.cpp ../src/hal/linux_hal.cpp ../src/wifi/wifi_manager.cpp; ./a.out; rm a.out
+
+# test command latency histograms and metrics formatting
+g++ -DTESTING -std=c++11 test.cpp src/rover/command_latency.test.cpp ../src/rover/command_latency.cpp ../src/message_bus/message_bus.cpp ../src/message_bus/messages.cpp ../src/string/strcopy.cpp; ./a.out; rm a.out
+
+# test script bytecode writer and interpreter
+g++ -DTESTING -std=c++11 test.cpp src/script/script.test.cpp ../src/script/script.cpp; ./a.out; rm a.out
+
+# test persistent settings records and debounced writes
+g++ -DTESTING -std=c++11 test.cpp src/settings/settings.test.cpp ../src/settings/settings.cpp ../src/settings/file_storage.cpp ../src/string/strcopy.cpp; ./a.out; rm a.out
+
+# test full state snapshot sent on connect
+g++ -DTESTING -std=c++11 test.cpp src/settings/state_snapshot.test.cpp ../src/settings/state_snapshot.cpp ../src/settings/settings.cpp ../src/string/json.cpp ../src/string/strcopy.cpp; ./a.out; rm a.out
+
+# test wifi reconnection state machine
+g++ -DTESTING -std=c++11 test.cpp src/wifi/wifi_manager.test.cpp ../src/wifi/wifi_manager.cpp ../src/message_bus/message_bus.cpp ../src/message_bus/messages.cpp; ./a.out; rm a.out
+
+# test conditional get entity tag matching
+g++ -DTESTING -std=c++11 test.cpp src/http/etag.test.cpp ../src/http/etag.cpp; ./a.out; rm a.out
+
+# test multiplexed websocket framing and send priority
+g++ -DTESTING -std=c++11 test.cpp src/websockets/mux.test.cpp ../src/websockets/mux.cpp; ./a.out; rm a.out
+
+# test udp control packets and sequencing
+g++ -DTESTING -std=c++11 test.cpp src/udp/udp_codec.test.cpp ../src/udp/udp_codec.cpp; ./a.out; rm a.out
+
+# test udp commands over loopback with packet loss and reordering
+g++ -DTESTING -std=c++11 test.cpp src/udp/udp_loopback.test.cpp ../src/udp/udp_codec.cpp; ./a.out; rm a.out
+
+# test /metrics text and main loop stats
+g++ -DTESTING -std=c++11 test.cpp src/metrics/runtime_metrics.test.cpp ../src/metrics/runtime_metrics.cpp ../src/rover/command_latency.cpp ../src/message_bus/message_bus.cpp ../src/message_bus/messages.cpp ../src/string/strcopy.cpp; ./a.out; rm a.out
+
+# test subsystem health checks
+g++ -DTESTING -std=c++11 test.cpp src/metrics/health.test.cpp ../src/metrics/health.cpp ../src/string/strcopy.cpp ../src/string/json.cpp; ./a.out; rm a.out
+
+# test ring and circular buffer, and benchmark them
+g++ -DTESTING -std=c++11 -O2 test.cpp src/util/ring.test.cpp; ./a.out; rm a.out
+
+# test control signal filters; noise against lag
+g++ -DTESTING -std=c++11 test.cpp src/util/filters.test.cpp; ./a.out; rm a.out
+
+# test wheel speed estimate with each filter
+g++ -DTESTING -std=c++11 test.cpp src/wheel/speed_estimator.test.cpp ../src/wheel/speed_estimator.cpp; ./a.out; rm a.out
+
+# test linux hal backend with the motor and encoder drivers on it
+g++ -DTESTING -DUSE_ENCODER_INTERRUPTS=1 -std=c++11 test.cpp src/hal/linux_hal.test.cpp ../src/hal/linux_hal.cpp ../src/gpio/pwm.cpp ../src/motor/motor_l9110s.cpp ../src/encoder/encoder.cpp ../src/encoder/encoderInterrupts.cpp; ./a.out; rm a.out
+
+# test structured logging; levels, binary records and formatting
+g++ -DTESTING -std=c++11 test.cpp src/log/binary_log.test.cpp ../src/log/binary_log.cpp ../src/hal/linux_hal.cpp; ./a.out; rm a.out
+
+# drive the simulated rover to a set of goals; see sim/README.md
+(cd ../sim && ./build.sh && ./run_scenarios.sh)
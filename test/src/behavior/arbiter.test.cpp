@@ -0,0 +1,152 @@
+#include "../../test.h"
+#include "../../../src/error.h"
+#include "../../../src/behavior/arbiter.h"
+#include "../../../src/behavior/teleop.h"
+
+using namespace std;
+
+/**
+ * records what the arbiter sends to the wheels
+ */
+class TestSink : public WheelCommandSink {
+    public:
+    int driveCount = 0;
+    int stopCount = 0;
+    WheelCommand last;
+
+    virtual void driveWheels(const WheelCommand &command) {
+        driveCount += 1;
+        last = command;
+    }
+    virtual void stopWheels() {
+        stopCount += 1;
+        last = WheelCommand();
+    }
+};
+
+/**
+ * behavior that proposes a fixed command when active
+ */
+class TestBehavior : public Behavior {
+    public:
+    bool active = false;
+    int asked = 0;
+    WheelCommand command;
+
+    TestBehavior(behavior_priority_type priority, speed_type speed)
+        : Behavior(priority), command(true, speed, speed) {}
+
+    virtual bool proposeCommand(unsigned long currentMillis, WheelCommand &proposed) {
+        asked += 1;
+        if(active) proposed = command;
+        return active;
+    }
+};
+
+void TestArbitration() {
+    TestSink sink;
+    BehaviorArbiter arbiter;
+    TestBehavior low(GOTO_PRIORITY, 10);
+    TestBehavior high(GEOFENCE_PRIORITY, 40);
+    TeleopBehavior teleop;
+
+    arbiter.attach(sink);
+    // add out of priority order; arbiter must sort them
+    arbiter.addBehavior(low);
+    arbiter.addBehavior(high);
+    arbiter.addBehavior(teleop);
+
+    // nothing active; nothing sent
+    arbiter.poll(0);
+    if((0 != sink.driveCount) || (0 != sink.stopCount) || (nullptr != arbiter.activeBehavior())) {
+        testError("BehaviorArbiter with no active behavior should not drive; drive %d, stop %d", sink.driveCount, sink.stopCount);
+    }
+
+    // low priority drives
+    low.active = true;
+    arbiter.poll(1);
+    if((&low != arbiter.activeBehavior()) || (10 != sink.last.left) || (1 != sink.driveCount)) {
+        testError("BehaviorArbiter should drive with low priority behavior; left %f, drive %d", sink.last.left, sink.driveCount);
+    }
+
+    // unchanged command is not resent
+    arbiter.poll(2);
+    if(1 != sink.driveCount) {
+        testError("BehaviorArbiter should not resend unchanged command; drive %d", sink.driveCount);
+    }
+
+    // teleop subsumes goto
+    teleop.setCommand(WheelCommand(false, 200, -200));
+    arbiter.poll(3);
+    if((&teleop != arbiter.activeBehavior()) || (200 != sink.last.left) || (-200 != sink.last.right) || sink.last.useSpeedControl) {
+        testError("BehaviorArbiter should drive with teleop; left %f, right %f", sink.last.left, sink.last.right);
+    }
+
+    // geofence subsumes everything, and lower behaviors are not asked
+    high.active = true;
+    const int lowAsked = low.asked;
+    arbiter.poll(4);
+    if((&high != arbiter.activeBehavior()) || (40 != sink.last.left)) {
+        testError("BehaviorArbiter should drive with highest priority; left %f", sink.last.left);
+    }
+    if(lowAsked != low.asked) {
+        testError("BehaviorArbiter should not ask behaviors below the winner; asked %d times", low.asked - lowAsked);
+    }
+
+    // teleop stop gives control back to goto
+    high.active = false;
+    teleop.setCommand(WheelCommand(false, 0, 0));
+    arbiter.poll(5);
+    if((&low != arbiter.activeBehavior()) || (10 != sink.last.left)) {
+        testError("BehaviorArbiter should return to low priority after teleop stops; left %f", sink.last.left);
+    }
+
+    // last active behavior finishes; wheels are stopped exactly once
+    low.active = false;
+    arbiter.poll(6);
+    arbiter.poll(7);
+    if((1 != sink.stopCount) || (nullptr != arbiter.activeBehavior())) {
+        testError("BehaviorArbiter should stop wheels once when no behavior is active; stop %d", sink.stopCount);
+    }
+}
+
+void TestAddRemove() {
+    BehaviorArbiter arbiter;
+    TestBehavior behaviors[BehaviorArbiter::MAX_BEHAVIORS + 1] = {
+        {1, 1}, {2, 2}, {3, 3}, {4, 4}, {5, 5}, {6, 6}, {7, 7}, {8, 8}, {9, 9}
+    };
+    for(unsigned int i = 0; i < BehaviorArbiter::MAX_BEHAVIORS; i += 1) {
+        if(SUCCESS != arbiter.addBehavior(behaviors[i])) {
+            testError("BehaviorArbiter.addBehavior() failed for behavior %d", i);
+        }
+    }
+    if(FAILURE != arbiter.addBehavior(behaviors[BehaviorArbiter::MAX_BEHAVIORS])) {
+        testError("BehaviorArbiter.addBehavior() should fail when full %s", "");
+    }
+    if(SUCCESS != arbiter.removeBehavior(behaviors[3])) {
+        testError("BehaviorArbiter.removeBehavior() failed %s", "");
+    }
+    if(FAILURE != arbiter.removeBehavior(behaviors[3])) {
+        testError("BehaviorArbiter.removeBehavior() should fail for missing behavior %s", "");
+    }
+
+    // order is kept after remove; highest active wins
+    TestSink sink;
+    arbiter.attach(sink);
+    behaviors[2].active = true;
+    behaviors[5].active = true;
+    arbiter.poll(0);
+    if(&behaviors[5] != arbiter.activeBehavior()) {
+        testError("BehaviorArbiter should pick highest priority after remove; left %f", sink.last.left);
+    }
+}
+
+int main() {
+    // from test folder run: 
+    // gcc -DTESTING -std=c++11 -lstdc++ test.cpp src/behavior/arbiter.test.cpp ../src/behavior/*.cpp; ./a.out; rm a.out
+
+    TestArbitration();
+    TestAddRemove();
+
+    return testResults("behavior_arbiter");
+}
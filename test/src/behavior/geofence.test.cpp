@@ -0,0 +1,218 @@
+#include <string.h>
+#include "../../test.h"
+#include "../../../src/error.h"
+#include "../../../src/behavior/geofence.h"
+#include "../../../src/rover/rover_binary.h"
+
+using namespace std;
+
+const speed_type DECELERATION = 60;
+const distance_type MARGIN = 10;
+
+// 200 x 100 rectangle, counter-clockwise
+const Point2D BOX[] = {{0, 0}, {200, 0}, {200, 100}, {0, 100}};
+
+bool near(distance_type a, distance_type b) {
+    return (a - b < 0.001f) && (b - a < 0.001f);
+}
+
+int testBoundary() {
+    Geofence fence;
+
+    if(fence.enabled()) {
+        testError("Empty fence should not be enabled%s", "");
+    }
+
+    // either winding is accepted
+    const Point2D clockwise[] = {{0, 0}, {0, 100}, {200, 100}, {200, 0}};
+    if(SUCCESS != fence.setBoundary(clockwise, 4)) {
+        testError("Clockwise rectangle should be accepted%s", "");
+    }
+    const GeofenceCheck inside = fence.check({100, 50, 0}, {0, 0, 0}, DECELERATION, MARGIN);
+    if(inside.violated || !near(inside.clearance, 50)) {
+        testError("Center of clockwise rectangle should be 50 from fence, got %f", inside.clearance);
+    }
+
+    if(SUCCESS != fence.setBoundary(BOX, 4)) {
+        testError("Counter-clockwise rectangle should be accepted%s", "");
+    }
+
+    // non-convex polygon is rejected and leaves boundary unchanged
+    const Point2D arrow[] = {{0, 0}, {100, 50}, {200, 0}, {100, 100}};
+    if(FAILURE != fence.setBoundary(arrow, 4)) {
+        testError("Non-convex polygon should be rejected%s", "");
+    }
+    if(4 != fence.edgeCount()) {
+        testError("Rejected polygon should not change boundary%s", "");
+    }
+
+    // too few, degenerate
+    if(FAILURE != fence.setBoundary(BOX, 2)) {
+        testError("Two vertices should be rejected%s", "");
+    }
+    const Point2D line[] = {{0, 0}, {10, 0}, {20, 0}};
+    if(FAILURE != fence.setBoundary(line, 3)) {
+        testError("Collinear vertices should be rejected%s", "");
+    }
+
+    // near the right edge, inward is -x; outside is negative clearance
+    GeofenceCheck result = fence.check({195, 50, 0}, {0, 0, 0}, DECELERATION, MARGIN);
+    if(!result.violated || !near(result.clearance, 5) || !near(result.inward.x, -1)) {
+        testError("Point 5 from right edge should violate margin with inward -x, got clearance %f", result.clearance);
+    }
+    result = fence.check({210, 50, 0}, {0, 0, 0}, DECELERATION, MARGIN);
+    if(!result.violated || !near(result.clearance, -10)) {
+        testError("Point outside fence should have negative clearance, got %f", result.clearance);
+    }
+
+    return testResults("testBoundary");
+}
+
+int testStoppingProjection() {
+    Geofence fence;
+    fence.setBoundary(BOX, 4);
+
+    //
+    // 40 from the right edge; at 70 cm/s with 60 cm/s^2 braking
+    // the stopping distance is about 41, which crosses the edge.
+    //
+    GeofenceCheck result = fence.check({160, 50, 0}, {70, 0, 0}, DECELERATION, MARGIN);
+    if(!result.violated || !result.approaching) {
+        testError("Fast approach should violate before reaching margin%s", "");
+    }
+    if(!near(result.clearance, 40)) {
+        testError("Clearance should be from current position, got %f", result.clearance);
+    }
+
+    // same position, slow enough to stop in time
+    result = fence.check({160, 50, 0}, {20, 0, 0}, DECELERATION, MARGIN);
+    if(result.violated) {
+        testError("Slow approach should not violate%s", "");
+    }
+
+    // backing away from the fence is never approaching
+    result = fence.check({195, 50, 0}, {-20, 0, 0}, DECELERATION, MARGIN);
+    if(!result.violated || result.approaching) {
+        testError("Moving away from fence should not be approaching%s", "");
+    }
+
+    // driving parallel to the fence is not approaching
+    result = fence.check({195, 50, 0}, {0, 20, 0}, DECELERATION, MARGIN);
+    if(result.approaching) {
+        testError("Moving along fence should not be approaching%s", "");
+    }
+
+    return testResults("testStoppingProjection");
+}
+
+int testKeepOut() {
+    Geofence fence;
+
+    for(unsigned int i = 0; i < GEOFENCE_MAX_KEEPOUTS; i += 1) {
+        if(SUCCESS != fence.addKeepOut({100.0f * i, 0}, 20)) {
+            testError("Keep-out %d should be added", i);
+        }
+    }
+    if(FAILURE != fence.addKeepOut({0, 0}, 20)) {
+        testError("Keep-out beyond capacity should be rejected%s", "");
+    }
+    if(!fence.enabled()) {
+        testError("Fence with only keep-outs should be enabled%s", "");
+    }
+
+    // approaching the first circle from the left
+    GeofenceCheck result = fence.check({-35, 0, 0}, {30, 0, 0}, DECELERATION, MARGIN);
+    if(!near(result.clearance, 15) || !near(result.inward.x, -1)) {
+        testError("Clearance to keep-out should be 15 with inward -x, got %f", result.clearance);
+    }
+    if(!result.violated || !result.approaching) {
+        testError("Approaching keep-out should violate%s", "");
+    }
+
+    // far away in open space
+    result = fence.check({50, 200, 0}, {30, 0, 0}, DECELERATION, MARGIN);
+    if(result.violated) {
+        testError("Open space should not violate%s", "");
+    }
+
+    fence.clear();
+    if(fence.enabled()) {
+        testError("Cleared fence should not be enabled%s", "");
+    }
+
+    return testResults("testKeepOut");
+}
+
+static int putFloat(uint8_t *bytes, int offset, float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    bytes[offset] = bits & 0xFF;
+    bytes[offset + 1] = (bits >> 8) & 0xFF;
+    bytes[offset + 2] = (bits >> 16) & 0xFF;
+    bytes[offset + 3] = (bits >> 24) & 0xFF;
+    return offset + 4;
+}
+
+int testParseFence() {
+    uint8_t frame[128];
+    int offset = 0;
+    frame[offset++] = BINARY_FENCE;
+    frame[offset++] = 7;
+    frame[offset++] = 0;
+    frame[offset++] = 1;                    // turn back
+    offset = putFloat(frame, offset, 12.5);
+    frame[offset++] = 4;
+    for(int i = 0; i < 4; i += 1) {
+        offset = putFloat(frame, offset, BOX[i].x);
+        offset = putFloat(frame, offset, BOX[i].y);
+    }
+    frame[offset++] = 1;
+    offset = putFloat(frame, offset, 50);
+    offset = putFloat(frame, offset, 60);
+    offset = putFloat(frame, offset, 15);
+
+    const ParseBinaryHeaderResult header = parseBinaryHeader(frame, offset);
+    if(!header.matched || (BINARY_FENCE != header.opcode) || (7 != header.id)) {
+        testError("Fence header should parse%s", "");
+    }
+
+    const ParseFenceResult parsed = parseFenceCommand(frame, offset, header.index);
+    if(!parsed.matched || (offset != parsed.index)) {
+        testError("Fence payload should parse to end of frame, got index %d", parsed.index);
+    } else {
+        const FenceCommand &fence = parsed.value;
+        if((1 != fence.mode) || !near(fence.margin, 12.5) || (4 != fence.vertexCount) || (1 != fence.keepOutCount)) {
+            testError("Fence header values are wrong%s", "");
+        }
+        if(!near(fence.vertices[2].x, 200) || !near(fence.vertices[2].y, 100)) {
+            testError("Fence vertex is wrong%s", "");
+        }
+        if(!near(fence.keepOuts[0].center.y, 60) || !near(fence.keepOuts[0].radius, 15)) {
+            testError("Fence keep-out is wrong%s", "");
+        }
+    }
+
+    // truncated frames do not parse
+    for(int length = header.index; length < offset; length += 1) {
+        if(parseFenceCommand(frame, length, header.index).matched) {
+            testError("Truncated fence of length %d should not parse", length);
+        }
+    }
+
+    // too many vertices
+    frame[header.index + 5] = GEOFENCE_MAX_VERTICES + 1;
+    if(parseFenceCommand(frame, sizeof(frame), header.index).matched) {
+        testError("Fence with too many vertices should not parse%s", "");
+    }
+
+    return testResults("testParseFence");
+}
+
+int main() {
+    testBoundary();
+    testStoppingProjection();
+    testKeepOut();
+    testParseFence();
+
+    return 0;
+}
@@ -0,0 +1,149 @@
+#include <math.h>
+#include "../../test.h"
+#include "../../../src/config.h"
+#include "../../../src/error.h"
+#include "../../../src/hal/linux_hal.h"
+#include "../../../src/gpio/pwm.h"
+#include "../../../src/motor/motor_l9110s.h"
+#include "../../../src/encoder/encoder.h"
+#include "../../../src/wheel/drive_wheel.h"
+#include "../../../src/rover/rover.h"
+#include "../../../src/behavior/arbiter.h"
+#include "../../../src/behavior/teleop.h"
+#include "../../../src/behavior/geofence_behavior.h"
+
+using namespace std;
+
+//
+// the drive train, put together as in main.cpp
+//
+MessageBus messageBus;
+
+PwmChannel leftForwardPwm(A1_A_PIN, LEFT_FORWARD_CHANNEL, MotorL9110s::pwmBits());
+PwmChannel leftReversePwm(A1_B_PIN, LEFT_REVERSE_CHANNEL, MotorL9110s::pwmBits());
+MotorL9110s leftMotor;
+Encoder leftWheelEncoder(LEFT_ENCODER_PIN, 0);
+DriveWheel leftWheel(LEFT_WHEEL_SPEC, WHEEL_CIRCUMFERENCE);
+
+PwmChannel rightForwardPwm(B1_B_PIN, RIGHT_FORWARD_CHANNEL, MotorL9110s::pwmBits());
+PwmChannel rightReversePwm(B1_A_PIN, RIGHT_REVERSE_CHANNEL, MotorL9110s::pwmBits());
+MotorL9110s rightMotor;
+Encoder rightWheelEncoder(RIGHT_ENCODER_PIN, 1);
+DriveWheel rightWheel(RIGHT_WHEEL_SPEC, WHEEL_CIRCUMFERENCE);
+
+TwoWheelRover rover(WHEELBASE);
+
+/**
+ * Wheel that turns at a speed proportional to the
+ * duty on its motor pins, with a first order lag,
+ * and toggles its encoder pin as slots go by
+ */
+class TestWheelPlant {
+    private:
+    gpio_type _forwardPin;
+    gpio_type _reversePin;
+    gpio_type _encoderPin;
+    float _speed = 0;       // cm/sec
+    float _travel = 0;      // cm, either direction
+    long _edges = 0;
+
+    public:
+    TestWheelPlant(gpio_type forwardPin, gpio_type reversePin, gpio_type encoderPin)
+        : _forwardPin(forwardPin), _reversePin(reversePin), _encoderPin(encoderPin) {}
+
+    void step(float seconds) {
+        const float duty = halGetDuty(_forwardPin) - halGetDuty(_reversePin);
+        const float target = (fabsf(duty) < 0.28f) ? 0 : 60 * duty;
+        _speed += (target - _speed) * (seconds * 1000 / 80);
+        _travel += fabsf(_speed) * seconds;
+        while(_edges < (long)(_travel / (WHEEL_CIRCUMFERENCE / PULSES_PER_REVOLUTION))) {
+            _edges += 1;
+            halSetPin(_encoderPin, (GPIO_HIGH == halGetPin(_encoderPin)) ? GPIO_LOW : GPIO_HIGH);
+        }
+    }
+};
+
+TestWheelPlant leftPlant(A1_A_PIN, A1_B_PIN, LEFT_ENCODER_PIN);
+TestWheelPlant rightPlant(B1_B_PIN, B1_A_PIN, RIGHT_ENCODER_PIN);
+
+/**
+ * Run the control loop each ms through a span of
+ * time and return the furthest x the rover reached
+ */
+distance_type runLoop(BehaviorArbiter &arbiter, unsigned long fromMs, unsigned long toMs) {
+    distance_type maxX = rover.pose().x;
+    for(unsigned long ms = fromMs; ms <= toMs; ms += 1) {
+        halSetMicros((unsigned long long)ms * 1000);
+        leftPlant.step(0.001f);
+        rightPlant.step(0.001f);
+        rover.poll(ms);
+        arbiter.poll(ms);
+        if(rover.pose().x > maxX) {
+            maxX = rover.pose().x;
+        }
+    }
+    return maxX;
+}
+
+int testHaltHoldsAgainstDriver() {
+    rover.attach(
+        leftWheel.attach(leftMotor.attach(leftForwardPwm, leftReversePwm), &leftWheelEncoder, PULSES_PER_REVOLUTION, &messageBus),
+        rightWheel.attach(rightMotor.attach(rightForwardPwm, rightReversePwm), &rightWheelEncoder, PULSES_PER_REVOLUTION, &messageBus),
+        &messageBus);
+
+    TeleopBehavior teleop;
+    GeofenceBehavior geofence;
+    BehaviorArbiter arbiter;
+    geofence.attach(rover, messageBus);
+    arbiter.attach(rover);
+    arbiter.addBehavior(geofence);
+    arbiter.addBehavior(teleop);
+
+    // fence 60 cm ahead of the rover
+    const Point2D square[] = {{-60, -60}, {60, -60}, {60, 60}, {-60, 60}};
+    if(SUCCESS != geofence.configure(GEOFENCE_HALT, GEOFENCE_MARGIN, square, 4, nullptr, 0)) {
+        testError("Square fence should be accepted%s", "");
+    }
+
+    //
+    // driver holds full pwm towards the fence; the rover
+    // halts and stays halted rather than creeping across
+    //
+    teleop.setCommand(WheelCommand(false, 255, 255));
+    const distance_type maxX = runLoop(arbiter, 1, 20000);
+    if(maxX >= 60) {
+        testError("Rover should never cross the fence, reached x = %f", maxX);
+    }
+    if(GEOFENCE_HALTING != geofence.state()) {
+        testError("Geofence should still be halting, is %s", GeofenceStateStr[geofence.state()]);
+    }
+    const distance_type haltedX = rover.pose().x;
+
+    // turning in place does not release the halt
+    teleop.setCommand(WheelCommand(false, -255, 255));
+    runLoop(arbiter, 20001, 21000);
+    if((GEOFENCE_HALTING != geofence.state()) || (fabsf(rover.pose().angle) > 0.001f)) {
+        testError("Turn in place should not release the halt, angle %f", rover.pose().angle);
+    }
+
+    // backing away releases it
+    teleop.setCommand(WheelCommand(false, -255, -255));
+    runLoop(arbiter, 21001, 21500);
+    if((GEOFENCE_CLEAR != geofence.state()) || (rover.pose().x > haltedX - 10)) {
+        testError("Backing away should release the halt, x went from %f to %f", haltedX, rover.pose().x);
+    }
+
+    arbiter.detach();
+    geofence.detach();
+    rover.roverHalt();
+    return testResults("testHaltHoldsAgainstDriver");
+}
+
+int main() {
+    halReset();
+    halSetMicros(0);
+
+    testHaltHoldsAgainstDriver();
+
+    return 0;
+}
@@ -0,0 +1,156 @@
+#include <math.h>
+#include "../../test.h"
+#include "../../../src/hal/linux_hal.h"
+#include "../../../src/gpio/pwm.h"
+#include "../../../src/motor/motor_l9110s.h"
+#include "../../../src/encoder/encoder.h"
+#include "../../../src/error.h"
+
+using namespace std;
+
+const gpio_type ENCODER_PIN = 14;
+const gpio_type FORWARD_PIN = 15;
+const gpio_type REVERSE_PIN = 13;
+
+int isrCalls = 0;
+void FASTCODE countIsr(ISR_PARAMS) {
+    isrCalls += 1;
+}
+
+int testClock() {
+    halReset();
+
+    // real clock moves on its own
+    const unsigned long start = halMicros();
+    while(halMicros() == start) {}
+    if(halMicros() < start) {
+        testError("Real clock should not go backward, %lu < %lu", halMicros(), start);
+    }
+
+    // simulated clock only moves when set
+    halSetMicros(2500000);
+    if((2500 != halMillis()) || (2500000 != halMicros())) {
+        testError("Simulated clock should be 2500 ms, not %lu", halMillis());
+    }
+    if(2500 != halMillis()) {
+        testError("Simulated clock should not move on its own, %lu", halMillis());
+    }
+
+    halReset();
+    if(halMillis() >= 2500) {
+        testError("Reset should go back to the real clock, %lu", halMillis());
+    }
+
+    return testResults("testClock");
+}
+
+int testInterrupts() {
+    halReset();
+    isrCalls = 0;
+
+    halPinMode(ENCODER_PIN, HAL_INPUT_PULLUP);
+    if(GPIO_HIGH != halDigitalRead(ENCODER_PIN)) {
+        testError("Pullup input should read high%s", "");
+    }
+
+    halAttachIsr(ENCODER_PIN, countIsr, RISING_EDGE);
+    halSetPin(ENCODER_PIN, GPIO_LOW);
+    halSetPin(ENCODER_PIN, GPIO_HIGH);
+    halSetPin(ENCODER_PIN, GPIO_HIGH);  // not an edge
+    if(1 != isrCalls) {
+        testError("Rising edge handler should run once, not %d", isrCalls);
+    }
+
+    halAttachIsr(ENCODER_PIN, countIsr, CHANGING_EDGE);
+    halSetPin(ENCODER_PIN, GPIO_LOW);
+    halSetPin(ENCODER_PIN, GPIO_HIGH);
+    if(3 != isrCalls) {
+        testError("Changing edge handler should run on both edges, %d calls", isrCalls);
+    }
+
+    halDetachIsr(ENCODER_PIN);
+    halSetPin(ENCODER_PIN, GPIO_LOW);
+    if(3 != isrCalls) {
+        testError("Detached handler should not run, %d calls", isrCalls);
+    }
+
+    if(SUCCESS == halAttachIsr(HAL_GPIO_COUNT, countIsr, RISING_EDGE)) {
+        testError("Attaching to pin %d should fail", HAL_GPIO_COUNT);
+    }
+
+    return testResults("testInterrupts");
+}
+
+int testMotorPwm() {
+    halReset();
+
+    PwmChannel forwardPwm(FORWARD_PIN, 2, MotorL9110s::pwmBits());
+    PwmChannel reversePwm(REVERSE_PIN, 3, MotorL9110s::pwmBits());
+    MotorL9110s motor;
+    motor.attach(forwardPwm, reversePwm);
+
+    motor.setPower(true, MotorL9110s::maxPwm());
+    if((1.0f != halGetDuty(FORWARD_PIN)) || (0.0f != halGetDuty(REVERSE_PIN))) {
+        testError("Full forward power should be duty 1 on the forward pin, not %f", halGetDuty(FORWARD_PIN));
+    }
+
+    motor.setPower(false, (MotorL9110s::maxPwm() + 1) / 2);
+    if((0.0f != halGetDuty(FORWARD_PIN)) || (fabsf(0.5f - halGetDuty(REVERSE_PIN)) > 0.01f)) {
+        testError("Half reverse power should be duty 0.5 on the reverse pin, not %f", halGetDuty(REVERSE_PIN));
+    }
+
+    motor.detach();
+    if(0.0f != halGetDuty(REVERSE_PIN)) {
+        testError("Detached motor should stop, not duty %f", halGetDuty(REVERSE_PIN));
+    }
+
+    return testResults("testMotorPwm");
+}
+
+int testEncoder() {
+    halReset();
+    halSetMicros(0);
+
+    //
+    // the encoder counts both edges from its interrupt,
+    // in the direction the motor is driven
+    //
+    Encoder encoder(ENCODER_PIN, 0);
+    encoder.attach();
+    encoder.setDirection(encode_forward);
+    for(int i = 0; i < 10; i += 1) {
+        halSetPin(ENCODER_PIN, (GPIO_HIGH == halGetPin(ENCODER_PIN)) ? GPIO_LOW : GPIO_HIGH);
+    }
+    if((10 != encoder.count()) || (10 != encoder.ticks())) {
+        testError("Encoder should count 10 forward edges, not %ld", encoder.count());
+    }
+
+    // after settling, reverse edges count down
+    halSetMicros((CONTROL_SETTLE_MS + 1) * 1000ULL);
+    encoder.setDirection(encode_reverse);
+    halSetMicros((2 * CONTROL_SETTLE_MS + 2) * 1000ULL);
+    for(int i = 0; i < 4; i += 1) {
+        halSetPin(ENCODER_PIN, (GPIO_HIGH == halGetPin(ENCODER_PIN)) ? GPIO_LOW : GPIO_HIGH);
+    }
+    if((6 != encoder.count()) || (14 != encoder.ticks())) {
+        testError("Encoder should count back to 6 after 4 reverse edges, not %ld", encoder.count());
+    }
+
+    encoder.detach();
+    halSetPin(ENCODER_PIN, GPIO_LOW);
+    halSetPin(ENCODER_PIN, GPIO_HIGH);
+    if(14 != encoder.ticks()) {
+        testError("Detached encoder should not count, %ld ticks", encoder.ticks());
+    }
+
+    return testResults("testEncoder");
+}
+
+int main() {
+    testClock();
+    testInterrupts();
+    testMotorPwm();
+    testEncoder();
+
+    return 0;
+}
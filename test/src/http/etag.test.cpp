@@ -0,0 +1,48 @@
+#include "../../test.h"
+#include "../../../src/http/etag.h"
+
+using namespace std;
+
+int testEtagMatches() {
+    const char *etag = "\"a18dec5f4b73983b\"";
+
+    const char *matching[] = {
+        "\"a18dec5f4b73983b\"",
+        "W/\"a18dec5f4b73983b\"",
+        "\"0000\", \"a18dec5f4b73983b\"",
+        "\"0000\",W/\"a18dec5f4b73983b\" ",
+        "*",
+    };
+    for(unsigned int i = 0; i < sizeof(matching) / sizeof(matching[0]); i += 1) {
+        if(!etagMatches(matching[i], etag)) {
+            testError("'%s' should match", matching[i]);
+        }
+    }
+
+    const char *different[] = {
+        "",
+        "\"a18dec5f4b73983\"",      // prefix
+        "\"a18dec5f4b73983bc\"",    // longer
+        "a18dec5f4b73983b",         // not quoted
+        "\"0000\", \"1111\"",
+        "W/",
+        ",,",
+    };
+    for(unsigned int i = 0; i < sizeof(different) / sizeof(different[0]); i += 1) {
+        if(etagMatches(different[i], etag)) {
+            testError("'%s' should not match", different[i]);
+        }
+    }
+
+    if(etagMatches(nullptr, etag) || etagMatches("*", nullptr)) {
+        testError("Missing header or tag should not match%s", "");
+    }
+
+    return testResults("testEtagMatches");
+}
+
+int main() {
+    testEtagMatches();
+
+    return 0;
+}
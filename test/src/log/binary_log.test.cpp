@@ -0,0 +1,158 @@
+#include <string.h>
+#include "../../test.h"
+#include "../../../src/hal/linux_hal.h"
+
+#define LOG_LEVEL WARN_LEVEL
+#include "../../../src/log.h"
+
+using namespace std;
+
+int evaluated = 0;
+int sideEffect() {
+    evaluated += 1;
+    return evaluated;
+}
+
+void drainAll() {
+    logDrain(nullptr, LOG_RING_RECORDS);
+}
+
+int testLevels() {
+    drainAll();
+    evaluated = 0;
+
+    // below LOG_LEVEL; compiled out, arguments not evaluated
+    LOG_DEBUG("debug %d", sideEffect());
+    LOG_INFO("info %d", sideEffect());
+    if(0 != evaluated) {
+        testError("Disabled levels should not evaluate arguments, evaluated %d", evaluated);
+    }
+    if(!logRing.empty()) {
+        testError("Disabled levels should not write records, ring has %u", logRing.count());
+    }
+
+    // at or above LOG_LEVEL; written
+    LOG_WARNING("warning %d", sideEffect());
+    LOG_ERROR("error %d", sideEffect());
+    if(2 != evaluated) {
+        testError("Enabled levels should evaluate arguments once each, evaluated %d", evaluated);
+    }
+
+    LogRecord record;
+    if(!logRing.pop(record) || (WARN_LEVEL != record.site->level) || (0 != strcmp("warning %d", record.site->format))) {
+        testError("First record should be the warning%s", "");
+    }
+    if(!logRing.pop(record) || (ERROR_LEVEL != record.site->level)) {
+        testError("Second record should be the error%s", "");
+    }
+
+    return testResults("testLevels");
+}
+
+int testFormat() {
+    drainAll();
+    halSetMicros(12345678);
+
+    const char *name = "left";
+    long long big = -5000000000LL;
+    LOG_WARNING("%s wheel %d ticks, %u ms, %.2f cm/s, %x, %lld, 100%%", name, -42, 7u, 12.5f, 255, big);
+    LOG_ERROR("no arguments");
+    LOG_ERROR("mismatched %s %d", 3, 2.5);
+
+    LogRecord record;
+    char text[LOG_TEXT_BYTES];
+    logRing.pop(record);
+    logFormat(record, text, sizeof(text));
+    const char *expected = "12.345678 WARNING: left wheel -42 ticks, 7 ms, 12.50 cm/s, ff, -5000000000, 100%";
+    if(0 != strcmp(expected, text)) {
+        testError("Expected '%s', got '%s'", expected, text);
+    }
+
+    logRing.pop(record);
+    logFormat(record, text, sizeof(text));
+    if(0 != strcmp("12.345678 ERROR: no arguments", text)) {
+        testError("Expected no arguments, got '%s'", text);
+    }
+
+    // arguments are converted to what the format asks for
+    logRing.pop(record);
+    logFormat(record, text, sizeof(text));
+    if(0 != strcmp("12.345678 ERROR: mismatched 3 2", text)) {
+        testError("Expected converted arguments, got '%s'", text);
+    }
+
+    // formatting stops at the end of the buffer
+    char small[16];
+    const int length = logFormat(record, small, sizeof(small));
+    if((15 != length) || (15 != (int)strlen(small))) {
+        testError("Formatting should truncate to 15 chars, got %d", length);
+    }
+
+    halReset();
+    return testResults("testFormat");
+}
+
+int testTruncation() {
+    drainAll();
+    halSetMicros(0);
+
+    // string is cut to fit and later arguments are dropped
+    const char *longText = "a string longer than the argument bytes of a record";
+    LOG_ERROR("%d %s %d", 1, longText, 2);
+
+    LogRecord record;
+    char text[LOG_TEXT_BYTES];
+    logRing.pop(record);
+    logFormat(record, text, sizeof(text));
+    const string expected = "0.000000 ERROR: 1 " + string(longText).substr(0, LOG_ARG_BYTES - 7) + " <?>";
+    if(expected != text) {
+        testError("Expected '%s', got '%s'", expected.c_str(), text);
+    }
+
+    // too few arguments
+    LOG_ERROR("%d and %d", 1);
+    logRing.pop(record);
+    logFormat(record, text, sizeof(text));
+    if(0 != strcmp("0.000000 ERROR: 1 and <?>", text)) {
+        testError("Missing argument should show <?>, got '%s'", text);
+    }
+
+    halReset();
+    return testResults("testTruncation");
+}
+
+int testDropped() {
+    drainAll();
+    const unsigned long droppedBefore = logDropped();
+
+    for(unsigned int i = 0; i < LOG_RING_RECORDS + 3; i += 1) {
+        LOG_ERROR("record %u", i);
+    }
+    if(3 != logDropped() - droppedBefore) {
+        testError("Full ring should drop 3 records, dropped %lu", logDropped() - droppedBefore);
+    }
+
+    // oldest are kept, in order
+    LogRecord record;
+    char text[LOG_TEXT_BYTES];
+    logRing.pop(record);
+    logFormat(record, text, sizeof(text));
+    if(nullptr == strstr(text, "record 0")) {
+        testError("Oldest record should be kept, got '%s'", text);
+    }
+    const unsigned int drained = logDrain(nullptr, LOG_RING_RECORDS);
+    if(LOG_RING_RECORDS - 1 != drained) {
+        testError("Should drain %u records, drained %u", LOG_RING_RECORDS - 1, drained);
+    }
+
+    return testResults("testDropped");
+}
+
+int main() {
+    testLevels();
+    testFormat();
+    testTruncation();
+    testDropped();
+
+    return 0;
+}
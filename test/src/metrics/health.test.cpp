@@ -0,0 +1,218 @@
+#include <string.h>
+#include "../../test.h"
+#include "../../../src/metrics/health.h"
+#include "../../../src/config.h"
+
+using namespace std;
+
+HealthInputs healthyInputs() {
+    HealthInputs inputs;
+    memset(&inputs, 0, sizeof(inputs));
+    inputs.cameraEnabled = true;
+    inputs.encodersEnabled = true;
+    inputs.telemetryCapacity = 8;
+    return inputs;
+}
+
+int testHealthCamera() {
+    HealthMonitor health;
+    HealthInputs inputs = healthyInputs();
+    health.poll(0, inputs);
+
+    // not streaming, so no frames are expected
+    health.poll(60000, inputs);
+    if(HEALTH_OK != health.state(HEALTH_CAMERA, 60000)) {
+        testError("Camera should be ok when not streaming%s", "");
+    }
+
+    // stream starts; first frame gets the stale time to arrive
+    inputs.streaming = true;
+    health.poll(60001, inputs);
+    if(HEALTH_OK != health.state(HEALTH_CAMERA, 60001 + HEALTH_FRAME_STALE_MS - 1)) {
+        testError("New stream should be ok before its first frame is stale%s", "");
+    }
+    if(HEALTH_DEGRADED != health.state(HEALTH_CAMERA, 60001 + HEALTH_FRAME_STALE_MS)) {
+        testError("Stream without frames should be degraded%s", "");
+    }
+    if(HEALTH_FAILED != health.state(HEALTH_CAMERA, 60001 + HEALTH_FRAME_FAILED_MS)) {
+        testError("Stream without frames for long should be failed%s", "");
+    }
+
+    inputs.framesCaptured = 1;
+    health.poll(65000, inputs);
+    if(HEALTH_OK != health.state(HEALTH_CAMERA, 65100)) {
+        testError("Camera should be ok after a frame%s", "");
+    }
+
+    // camera compiled out is never unhealthy
+    inputs.cameraEnabled = false;
+    health.poll(65100, inputs);
+    if(HEALTH_OK != health.state(HEALTH_CAMERA, 65100 + HEALTH_FRAME_FAILED_MS)) {
+        testError("Disabled camera should be ok%s", "");
+    }
+
+    return testResults("testHealthCamera");
+}
+
+int testHealthEncoders() {
+    HealthMonitor health;
+    HealthInputs inputs = healthyInputs();
+    unsigned long nowMs = 1000;
+    health.poll(nowMs, inputs);
+
+    // stopped wheels are not expected to turn
+    nowMs += 5000;
+    health.poll(nowMs, inputs);
+    if(HEALTH_OK != health.state(HEALTH_ENCODERS, nowMs)) {
+        testError("Unpowered wheels should be ok without edges%s", "");
+    }
+
+    // powered and turning
+    inputs.leftPowered = true;
+    inputs.rightPowered = true;
+    for(int i = 0; i < 100; i += 1) {
+        nowMs += 20;
+        inputs.leftTicks += 1;
+        inputs.rightTicks += 1;
+        health.poll(nowMs, inputs);
+    }
+    if(HEALTH_OK != health.state(HEALTH_ENCODERS, nowMs)) {
+        testError("Turning wheels should be ok%s", "");
+    }
+
+    // right encoder stops while powered
+    for(int i = 0; i < 30; i += 1) {
+        nowMs += 20;
+        inputs.leftTicks += 1;
+        health.poll(nowMs, inputs);
+    }
+    if(HEALTH_FAILED != health.state(HEALTH_ENCODERS, nowMs)) {
+        testError("Powered wheel without edges should be failed%s", "");
+    }
+
+    // power off clears it
+    inputs.rightPowered = false;
+    nowMs += 20;
+    health.poll(nowMs, inputs);
+    if(HEALTH_OK != health.state(HEALTH_ENCODERS, nowMs)) {
+        testError("Wheel that is no longer powered should be ok%s", "");
+    }
+
+    return testResults("testHealthEncoders");
+}
+
+int testHealthLoopAndTelemetry() {
+    HealthMonitor health;
+    HealthInputs inputs = healthyInputs();
+    if(HEALTH_FAILED != health.state(HEALTH_CONTROL_LOOP, 0)) {
+        testError("Loop should be failed before it first runs%s", "");
+    }
+    health.poll(1000, inputs);
+    if(HEALTH_OK != health.overall(1000)) {
+        testError("Rover should be ok, not %s", HealthStateStr[health.overall(1000)]);
+    }
+
+    // overrun degrades for a while
+    inputs.loopOverruns = 1;
+    health.poll(2000, inputs);
+    health.poll(2000 + HEALTH_WINDOW_MS - 1, inputs);
+    if(HEALTH_DEGRADED != health.state(HEALTH_CONTROL_LOOP, 2000 + HEALTH_WINDOW_MS - 1)) {
+        testError("Recent overrun should degrade loop%s", "");
+    }
+    health.poll(2000 + HEALTH_WINDOW_MS, inputs);
+    if(HEALTH_OK != health.state(HEALTH_CONTROL_LOOP, 2000 + HEALTH_WINDOW_MS)) {
+        testError("Old overrun should not degrade loop%s", "");
+    }
+
+    // loop stops calling poll
+    const unsigned long lastPollMs = 2000 + HEALTH_WINDOW_MS;
+    if(HEALTH_FAILED != health.state(HEALTH_CONTROL_LOOP, lastPollMs + HEALTH_LOOP_STALLED_MS)) {
+        testError("Stalled loop should be failed%s", "");
+    }
+    if(HEALTH_FAILED != health.overall(lastPollMs + HEALTH_LOOP_STALLED_MS)) {
+        testError("Failed subsystem should fail rover%s", "");
+    }
+
+    // telemetry drops degrade, full buffers for long fail
+    unsigned long nowMs = lastPollMs + 1;
+    inputs.telemetryDropped = 3;
+    health.poll(nowMs, inputs);
+    if(HEALTH_DEGRADED != health.state(HEALTH_TELEMETRY, nowMs)) {
+        testError("Dropped telemetry should degrade telemetry%s", "");
+    }
+    inputs.telemetryBacklog = 8;
+    health.poll(nowMs, inputs);
+    health.poll(nowMs + HEALTH_TELEMETRY_STUCK_MS, inputs);
+    if(HEALTH_FAILED != health.state(HEALTH_TELEMETRY, nowMs + HEALTH_TELEMETRY_STUCK_MS)) {
+        testError("Telemetry full for long should be failed%s", "");
+    }
+    inputs.telemetryBacklog = 7;
+    health.poll(nowMs + HEALTH_TELEMETRY_STUCK_MS + 1, inputs);
+    if(HEALTH_DEGRADED != health.state(HEALTH_TELEMETRY, nowMs + HEALTH_TELEMETRY_STUCK_MS + 1)) {
+        testError("Draining telemetry should only be degraded%s", "");
+    }
+
+    return testResults("testHealthLoopAndTelemetry");
+}
+
+int testHealthClockBehindPoll() {
+    //
+    // the web server reads its clock, then the control
+    // loop polls a moment later; ages must not wrap
+    //
+    HealthMonitor health;
+    HealthInputs inputs = healthyInputs();
+    inputs.streaming = true;
+    health.poll(1000, inputs);
+    if(HEALTH_OK != health.overall(999)) {
+        testError("Poll just after the clock was read should be ok, not %s", HealthStateStr[health.overall(999)]);
+    }
+
+    char buffer[512];
+    health.formatHealth(buffer, sizeof(buffer), 999);
+    if((nullptr == strstr(buffer, "\"frameAgeMs\":0}")) || (nullptr == strstr(buffer, "\"sinceMs\":0,"))) {
+        testError("Ages should be clamped at zero in %s", buffer);
+    }
+
+    return testResults("testHealthClockBehindPoll");
+}
+
+int testHealthJson() {
+    HealthMonitor health;
+    HealthInputs inputs = healthyInputs();
+    inputs.streaming = true;
+    inputs.framesCaptured = 42;
+    inputs.loopOverruns = 2;
+    inputs.maxLoopUs = 41000;
+    health.poll(1000, inputs);
+    inputs.loopOverruns = 3;
+    health.poll(1010, inputs);
+
+    char buffer[512];
+    const int length = health.formatHealth(buffer, sizeof(buffer), 1012);
+    const char *expected =
+        "{\"status\":\"degraded\",\"at\":1012,"
+        "\"camera\":{\"status\":\"ok\",\"enabled\":true,\"streaming\":true,\"frames\":42,\"frameAgeMs\":12},"
+        "\"encoders\":{\"status\":\"ok\",\"enabled\":true,\"leftSilentMs\":0,\"rightSilentMs\":0},"
+        "\"loop\":{\"status\":\"degraded\",\"sinceMs\":2,\"overruns\":3,\"maxUs\":41000},"
+        "\"telemetry\":{\"status\":\"ok\",\"backlog\":0,\"capacity\":8,\"dropped\":0}}";
+    if(0 != strcmp(expected, buffer)) {
+        testError("Health json should be %s", expected);
+        testError("               not %s", buffer);
+    }
+    if(length + 64 >= (int)sizeof(buffer)) {
+        testError("Health json is too close to buffer size: %d", length);
+    }
+
+    return testResults("testHealthJson");
+}
+
+int main() {
+    testHealthCamera();
+    testHealthEncoders();
+    testHealthLoopAndTelemetry();
+    testHealthClockBehindPoll();
+    testHealthJson();
+
+    return 0;
+}
@@ -0,0 +1,200 @@
+#include <string.h>
+#include <string>
+#include "../../test.h"
+#include "../../../src/metrics/runtime_metrics.h"
+
+using namespace std;
+
+RuntimeMetrics sampleMetrics() {
+    RuntimeMetrics metrics = RuntimeMetrics();  // zeroed
+    metrics.uptimeMs = 123456;
+    metrics.loopRate = 950.5f;
+    metrics.maxLoopUs = 4200;
+    metrics.loopOverruns = 7;
+    metrics.freeHeap = 180000;
+    metrics.minFreeHeap = 150000;
+    metrics.largestFreeBlock = 110000;
+    metrics.psramSize = 4194304;
+    metrics.psramFree = 4000000;
+    metrics.frames = {100, 97, 3};
+    metrics.telemetryDropped = 5;
+    metrics.configQueueDepth = 1;
+    metrics.scheduleQueueDepth = 2;
+    metrics.wifiRssi = -61;
+    metrics.wifiReconnects = 4;
+    metrics.tasks[0] = {"loopTask", 5120};
+    metrics.tasks[1] = {"async_tcp", 2048};
+    metrics.taskCount = 2;
+    return metrics;
+}
+
+//
+// copy latency histograms into the metrics,
+// as collectRuntimeMetrics() does
+//
+RuntimeMetrics withLatency(RuntimeMetrics metrics, const CommandLatency &latency) {
+    metrics.hasLatency = true;
+    for(unsigned int stage = 0; stage < NUMBER_OF_LATENCY_STAGES; stage += 1) {
+        metrics.latency[stage] = latency.histogram((LatencyStage)stage);
+    }
+    return metrics;
+}
+
+//
+// read the whole text using chunks of the given size
+//
+string readAll(MetricsWriter &writer, size_t chunkSize, int *chunks) {
+    string text;
+    uint8_t chunk[256];
+    size_t length;
+    *chunks = 0;
+    while((length = writer.read(chunk, chunkSize)) > 0) {
+        text.append((const char *)chunk, length);
+        *chunks += 1;
+        if(*chunks > 100000) break;
+    }
+    return text;
+}
+
+int testMetricsText() {
+    CommandLatency latency;
+    latency.dequeued(CommandStamp(1000, 1050), 6000);
+    latency.pwmWritten(6200);
+
+    MetricsWriter writer(withLatency(sampleMetrics(), latency));
+
+    // commands measured while the text is sent are not in it
+    latency.dequeued(CommandStamp(7000, 7050), 8000);
+    latency.pwmWritten(8200);
+
+    int chunks;
+    const string text = readAll(writer, 256, &chunks);
+
+    const char *expected[] = {
+        "# HELP rover_uptime_ms Time since boot in milliseconds\n# TYPE rover_uptime_ms counter\nrover_uptime_ms 123456\n",
+        "rover_loop_rate_hz 950.5\n",
+        "rover_loop_max_us 4200\n",
+        "rover_loop_overruns_total 7\n",
+        "rover_heap_free_bytes 180000\n",
+        "rover_heap_min_free_bytes 150000\n",
+        "rover_heap_largest_free_block_bytes 110000\n",
+        "rover_psram_size_bytes 4194304\n",
+        "rover_psram_free_bytes 4000000\n",
+        "# TYPE rover_camera_frames_total counter\n",
+        "rover_camera_frames_total{result=\"captured\"} 100\n",
+        "rover_camera_frames_total{result=\"sent\"} 97\n",
+        "rover_camera_frames_total{result=\"dropped\"} 3\n",
+        "rover_telemetry_dropped_total 5\n",
+        "rover_command_queue_depth{queue=\"config\"} 1\n",
+        "rover_command_queue_depth{queue=\"schedule\"} 2\n",
+        "rover_wifi_rssi_dbm -61\n",
+        "rover_wifi_reconnects_total 4\n",
+        "rover_task_stack_free_bytes{task=\"loopTask\"} 5120\n",
+        "rover_task_stack_free_bytes{task=\"async_tcp\"} 2048\n",
+        "# TYPE rover_command_latency_us histogram\n",
+        "rover_command_latency_us_bucket{stage=\"total\",le=\"8192\"} 1\n",
+        "rover_command_latency_us_count{stage=\"total\"} 1\n",
+        "rover_command_latency_us_count{stage=\"queue\"} 1\n",
+    };
+    for(unsigned int i = 0; i < sizeof(expected) / sizeof(expected[0]); i += 1) {
+        if(string::npos == text.find(expected[i])) {
+            testError("Metrics should contain '%s'", expected[i]);
+        }
+    }
+    if((text.empty()) || ('\n' != text[text.size() - 1])) {
+        testError("Metrics should end with a newline%s", "");
+    }
+    if(0 != writer.read((uint8_t *)"", 0)) {
+        testError("Finished writer should read nothing%s", "");
+    }
+
+    return testResults("testMetricsText");
+}
+
+int testMetricsChunks() {
+    //
+    // same text whatever the chunk size, even
+    // when chunks split lines
+    //
+    CommandLatency latency;
+    MetricsWriter whole(withLatency(sampleMetrics(), latency));
+    int chunks;
+    const string expected = readAll(whole, 256, &chunks);
+
+    const size_t sizes[] = {1, 7, 64, 127, 128, 129};
+    for(unsigned int i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i += 1) {
+        MetricsWriter writer(withLatency(sampleMetrics(), latency));
+        const string text = readAll(writer, sizes[i], &chunks);
+        if(text != expected) {
+            testError("Text read in %d byte chunks should match", (int)sizes[i]);
+        }
+        if(chunks != (int)((expected.size() + sizes[i] - 1) / sizes[i])) {
+            testError("Every chunk but the last should be full for %d byte chunks", (int)sizes[i]);
+        }
+    }
+
+    // latency and tasks are optional
+    RuntimeMetrics metrics = sampleMetrics();
+    metrics.taskCount = 0;
+    MetricsWriter bare(metrics);
+    const string text = readAll(bare, 256, &chunks);
+    if((string::npos != text.find("rover_command_latency_us")) || (string::npos != text.find("rover_task_stack_free_bytes"))) {
+        testError("Families without samples should be left out%s", "");
+    }
+    if(string::npos == text.find("rover_wifi_reconnects_total 4\n")) {
+        testError("Other families should still be written%s", "");
+    }
+
+    return testResults("testMetricsChunks");
+}
+
+int testLoopStats() {
+    LoopStats stats(10000);
+
+    // 980 loops of 1ms and one slow loop of 20ms fill one second
+    unsigned long nowUs = 5000;
+    stats.tick(nowUs);
+    for(int i = 0; i < 980; i += 1) {
+        nowUs += (500 == i) ? 20000 : 1000;
+        stats.tick(nowUs);
+    }
+    if((0 != stats.rate()) || (0 != stats.maxLoopUs())) {
+        testError("Stats should not report before a full second%s", "");
+    }
+    nowUs += 1000;
+    stats.tick(nowUs);
+    if((stats.rate() < 980.5f) || (stats.rate() > 981.5f)) {
+        testError("Loop rate should be 981/s, not %f", stats.rate());
+    }
+    if(20000 != stats.maxLoopUs()) {
+        testError("Max loop should be 20000us, not %u", stats.maxLoopUs());
+    }
+    if(982 != stats.iterations()) {
+        testError("Iterations should be 982, not %u", stats.iterations());
+    }
+    if(1 != stats.overruns()) {
+        testError("Only the slow loop should be an overrun, not %u", stats.overruns());
+    }
+
+    // next window forgets the slow loop
+    for(int i = 0; i < 500; i += 1) {
+        nowUs += 2000;
+        stats.tick(nowUs);
+    }
+    if(2000 != stats.maxLoopUs()) {
+        testError("Max loop should be 2000us in next window, not %u", stats.maxLoopUs());
+    }
+    if((stats.rate() < 499.5f) || (stats.rate() > 500.5f)) {
+        testError("Loop rate should be 500/s, not %f", stats.rate());
+    }
+
+    return testResults("testLoopStats");
+}
+
+int main() {
+    testMetricsText();
+    testMetricsChunks();
+    testLoopStats();
+
+    return 0;
+}
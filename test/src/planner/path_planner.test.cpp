@@ -0,0 +1,239 @@
+#include <string.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "../../test.h"
+#include "../../../src/error.h"
+#include "../../../src/planner/occupancy_grid.h"
+#include "../../../src/planner/path_planner.h"
+
+using namespace std;
+
+const unsigned int MAX_COLUMNS = 256;
+const unsigned int MAX_ROWS = 256;
+const unsigned int MAX_CELLS = MAX_COLUMNS * MAX_ROWS;
+const unsigned int MAX_WAYPOINTS = 512;
+
+grid_word_type testBits[MAX_CELLS / GRID_WORD_BITS];
+plan_cost_type testCost[MAX_CELLS];
+uint8_t testFrom[MAX_CELLS];
+PlannerHeapEntry testHeap[MAX_CELLS];
+Point2D testWaypoints[MAX_WAYPOINTS];
+
+OccupancyGrid testGrid(testBits, sizeof(testBits) / sizeof(testBits[0]));
+PathPlanner testPlanner(testCost, testFrom, MAX_CELLS, testHeap, MAX_CELLS);
+
+int sgn(int value) { return (value > 0) - (value < 0); }
+
+/**
+ * Walk each straight segment of the path and
+ * verify no cell on it is occupied and that
+ * it ends on the goal.
+ */
+bool validPath(const OccupancyGrid &grid, int column, int row, int goalColumn, int goalRow, const Point2D *waypoints, unsigned int count) {
+    for(unsigned int i = 0; i < count; i += 1) {
+        int nextColumn, nextRow;
+        if(!grid.worldToCell(waypoints[i].x, waypoints[i].y, nextColumn, nextRow)) return false;
+
+        const int dx = sgn(nextColumn - column);
+        const int dy = sgn(nextRow - row);
+        if((0 != dx) && (0 != dy) && (abs(nextColumn - column) != abs(nextRow - row))) {
+            return false;   // segment is neither straight nor diagonal
+        }
+        while((column != nextColumn) || (row != nextRow)) {
+            column += dx;
+            row += dy;
+            if(grid.occupied(column, row)) return false;
+        }
+    }
+    return (column == goalColumn) && (row == goalRow);
+}
+
+void TestOccupancyGrid() {
+    if(SUCCESS != testGrid.reset(10, 3, 2.0, -10, 0)) {
+        testError("OccupancyGrid.reset() failed for %s", "10x3");
+    }
+    if(FAILURE != testGrid.reset(MAX_COLUMNS + 1, MAX_ROWS, 1, 0, 0)) {
+        testError("OccupancyGrid.reset() should fail for grid larger than storage %s", "");
+    }
+
+    // 10 x 3 = 30 cells; set cell 0, 9 (end of row 0) and 29 (last cell)
+    const uint8_t packed[4] = {0x01, 0x02, 0x00, 0x20};
+    testGrid.reset(10, 3, 2.0, -10, 0);
+    if(SUCCESS != testGrid.load(packed, sizeof(packed))) {
+        testError("OccupancyGrid.load() failed %s", "");
+    }
+    for(int row = 0; row < 3; row += 1) {
+        for(int column = 0; column < 10; column += 1) {
+            const int cell = row * 10 + column;
+            const bool expected = (0 == cell) || (9 == cell) || (29 == cell);
+            if(expected != testGrid.occupied(column, row)) {
+                testError("OccupancyGrid.occupied(%d, %d) should be %d", column, row, expected);
+            }
+        }
+    }
+    if(FAILURE != testGrid.load(packed, 3)) {
+        testError("OccupancyGrid.load() should fail with too few bytes %s", "");
+    }
+
+    // outside of grid is considered occupied
+    if(!testGrid.occupied(-1, 0) || !testGrid.occupied(10, 0) || !testGrid.occupied(0, 3)) {
+        testError("OccupancyGrid.occupied() should be true outside grid %s", "");
+    }
+
+    // world <-> cell
+    int column, row;
+    if(!testGrid.worldToCell(-9.5, 5.5, column, row) || (0 != column) || (2 != row)) {
+        testError("OccupancyGrid.worldToCell(-9.5, 5.5) should be (0, 2), got (%d, %d)", column, row);
+    }
+    if(testGrid.worldToCell(-10.5, 0, column, row)) {
+        testError("OccupancyGrid.worldToCell(-10.5, 0) should be outside grid, got (%d, %d)", column, row);
+    }
+    const Point2D center = testGrid.cellToWorld(3, 1);
+    if((center.x != -3.0f) || (center.y != 3.0f)) {
+        testError("OccupancyGrid.cellToWorld(3, 1) should be (-3, 3), got (%f, %f)", center.x, center.y);
+    }
+}
+
+void TestPlanStraight() {
+    testGrid.reset(20, 20, 1, 0, 0);
+
+    // straight line is a single waypoint
+    PlanResult result = testPlanner.plan(testGrid, 2, 5, 15, 5, testWaypoints, MAX_WAYPOINTS);
+    if((PLAN_SUCCESS != result.status) || (1 != result.waypoints)) {
+        testError("PathPlanner.plan() straight line should be 1 waypoint, got status %d, waypoints %d", result.status, result.waypoints);
+    }
+
+    // pure diagonal is a single waypoint
+    result = testPlanner.plan(testGrid, 0, 0, 7, 7, testWaypoints, MAX_WAYPOINTS);
+    if((PLAN_SUCCESS != result.status) || (1 != result.waypoints)) {
+        testError("PathPlanner.plan() diagonal should be 1 waypoint, got status %d, waypoints %d", result.status, result.waypoints);
+    }
+
+    // start == goal has no waypoints
+    result = testPlanner.plan(testGrid, 4, 4, 4, 4, testWaypoints, MAX_WAYPOINTS);
+    if((PLAN_SUCCESS != result.status) || (0 != result.waypoints)) {
+        testError("PathPlanner.plan() start == goal should be 0 waypoints, got status %d, waypoints %d", result.status, result.waypoints);
+    }
+
+    // world overload ends exactly on goal
+    result = testPlanner.plan(testGrid, Point2D{2.5, 2.5}, Point2D{12.25, 2.75}, testWaypoints, MAX_WAYPOINTS);
+    if((PLAN_SUCCESS != result.status) || (testWaypoints[result.waypoints - 1].x != 12.25f) || (testWaypoints[result.waypoints - 1].y != 2.75f)) {
+        testError("PathPlanner.plan() world path should end on goal, got status %d", result.status);
+    }
+}
+
+void TestPlanAroundWall() {
+    //
+    // vertical wall at column 10 with a gap at row 17
+    //
+    testGrid.reset(20, 20, 1, 0, 0);
+    for(int row = 0; row < 20; row += 1) {
+        if(17 != row) testGrid.setOccupied(10, row, true);
+    }
+
+    PlanResult result = testPlanner.plan(testGrid, 2, 2, 18, 2, testWaypoints, MAX_WAYPOINTS);
+    if(PLAN_SUCCESS != result.status) {
+        testError("PathPlanner.plan() around wall failed with status %d", result.status);
+    } else if(!validPath(testGrid, 2, 2, 18, 2, testWaypoints, result.waypoints)) {
+        testError("PathPlanner.plan() around wall produced an invalid path with %d waypoints", result.waypoints);
+    }
+
+    // path too long for output
+    result = testPlanner.plan(testGrid, 2, 2, 18, 2, testWaypoints, 1);
+    if(PLAN_PATH_TOO_LONG != result.status) {
+        testError("PathPlanner.plan() should be PLAN_PATH_TOO_LONG, got %d", result.status);
+    }
+
+    // close the gap; no path
+    testGrid.setOccupied(10, 17, true);
+    result = testPlanner.plan(testGrid, 2, 2, 18, 2, testWaypoints, MAX_WAYPOINTS);
+    if(PLAN_NO_PATH != result.status) {
+        testError("PathPlanner.plan() through closed wall should be PLAN_NO_PATH, got %d", result.status);
+    }
+
+    // occupied or outside endpoints
+    result = testPlanner.plan(testGrid, 10, 5, 18, 2, testWaypoints, MAX_WAYPOINTS);
+    if(PLAN_BAD_ENDPOINT != result.status) {
+        testError("PathPlanner.plan() from occupied cell should be PLAN_BAD_ENDPOINT, got %d", result.status);
+    }
+    result = testPlanner.plan(testGrid, Point2D{2, 2}, Point2D{25, 2}, testWaypoints, MAX_WAYPOINTS);
+    if(PLAN_BAD_ENDPOINT != result.status) {
+        testError("PathPlanner.plan() to outside grid should be PLAN_BAD_ENDPOINT, got %d", result.status);
+    }
+}
+
+void TestNoCornerCutting() {
+    //
+    // two blocks touching diagonally; the diagonal
+    // between them must not be taken.
+    //
+    testGrid.reset(3, 3, 1, 0, 0);
+    testGrid.setOccupied(1, 0, true);
+    testGrid.setOccupied(0, 1, true);
+    PlanResult result = testPlanner.plan(testGrid, 0, 0, 2, 2, testWaypoints, MAX_WAYPOINTS);
+    if(PLAN_NO_PATH != result.status) {
+        testError("PathPlanner.plan() should not cut corners, got status %d", result.status);
+    }
+}
+
+void TestNoMemory() {
+    // workspace too small for grid
+    PathPlanner smallPlanner(testCost, testFrom, 16, testHeap, 16);
+    testGrid.reset(5, 5, 1, 0, 0);
+    PlanResult result = smallPlanner.plan(testGrid, 0, 0, 4, 4, testWaypoints, MAX_WAYPOINTS);
+    if(PLAN_NO_MEMORY != result.status) {
+        testError("PathPlanner.plan() with small workspace should be PLAN_NO_MEMORY, got %d", result.status);
+    }
+}
+
+/**
+ * Time planning across a grid with random obstacles
+ */
+void BenchmarkPlan(int size, int runs) {
+    srand(size);
+    testGrid.reset(size, size, 1, 0, 0);
+    for(int row = 0; row < size; row += 1) {
+        for(int column = 0; column < size; column += 1) {
+            if(0 == rand() % 5) testGrid.setOccupied(column, row, true);
+        }
+    }
+    // keep the corners open so the endpoints are not boxed in
+    for(int i = 0; i < 2; i += 1) {
+        for(int j = 0; j < 2; j += 1) {
+            testGrid.setOccupied(i, j, false);
+            testGrid.setOccupied(size - 1 - i, size - 1 - j, false);
+        }
+    }
+
+    PlanResult result = {PLAN_NO_PATH, 0, 0};
+    const clock_t start = clock();
+    for(int i = 0; i < runs; i += 1) {
+        result = testPlanner.plan(testGrid, 0, 0, size - 1, size - 1, testWaypoints, MAX_WAYPOINTS);
+    }
+    const double ms = 1000.0 * (clock() - start) / CLOCKS_PER_SEC / runs;
+
+    if(PLAN_SUCCESS != result.status) {
+        testError("PathPlanner.plan() %dx%d failed with status %d", size, size, result.status);
+    } else if(!validPath(testGrid, 0, 0, size - 1, size - 1, testWaypoints, result.waypoints)) {
+        testError("PathPlanner.plan() %dx%d produced an invalid path", size, size);
+    }
+    printf("path_planner benchmark %dx%d: status %d, %u waypoints, %u cells expanded, %.3f ms/plan\n",
+        size, size, result.status, result.waypoints, result.expanded, ms);
+}
+
+int main() {
+    // from test folder run: 
+    // gcc -DTESTING -std=c++11 -O2 -lstdc++ test.cpp src/planner/path_planner.test.cpp ../src/planner/*.cpp; ./a.out; rm a.out
+
+    TestOccupancyGrid();
+    TestPlanStraight();
+    TestPlanAroundWall();
+    TestNoCornerCutting();
+    TestNoMemory();
+
+    BenchmarkPlan(128, 20);
+    BenchmarkPlan(256, 5);
+
+    return testResults("path_planner");
+}
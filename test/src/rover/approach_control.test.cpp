@@ -0,0 +1,117 @@
+#include <math.h>
+
+#include "../../test.h"
+#include "../../../src/rover/approach_control.h"
+#include "../../../src/rover/kinematics.h"
+
+using namespace std;
+
+const distance_type TEST_WHEELBASE = 13.5;
+const speed_type TEST_MIN_SPEED = 10;
+const speed_type TEST_MAX_SPEED = 60;
+const float TEST_DT = 0.02;                 // seconds per control tick; same as POSE_POLL_MS
+const float TEST_TIMEOUT = 60;              // seconds allowed to reach goal
+
+ApproachConfig testConfig() {
+    ApproachConfig config;
+    config.minSpeed = TEST_MIN_SPEED;
+    config.maxSpeed = TEST_MIN_SPEED + (TEST_MAX_SPEED - TEST_MIN_SPEED) * 0.5;
+    config.maxAngular = (TEST_MAX_SPEED - TEST_MIN_SPEED) / TEST_WHEELBASE;
+    config.slowDistance = 30;
+    config.arriveDistance = 5;
+    config.headingGain = 2;
+    return config;
+}
+
+void TestApproachGoal() {
+    const ApproachConfig config = testConfig();
+
+    // at goal
+    ApproachResult result = approachGoal({10, 10, 0}, {12, 11}, config);
+    if(!result.arrived || (0 != result.velocity.linear) || (0 != result.velocity.angular)) {
+        testError("approachGoal() within arrive distance should be arrived and stopped %s", "");
+    }
+
+    // straight ahead and far; full speed, no turn
+    result = approachGoal({0, 0, 0}, {100, 0}, config);
+    if(result.arrived || (fabsf(result.velocity.linear - config.maxSpeed) > 0.001f) || (0 != result.velocity.angular)) {
+        testError("approachGoal() far ahead should be (%f, 0), got (%f, %f)", config.maxSpeed, result.velocity.linear, result.velocity.angular);
+    }
+
+    // straight ahead and close; slower
+    result = approachGoal({0, 0, 0}, {15, 0}, config);
+    if((result.velocity.linear >= config.maxSpeed) || (result.velocity.linear < config.minSpeed)) {
+        testError("approachGoal() close ahead should slow down, got %f", result.velocity.linear);
+    }
+
+    // behind; turn in place toward goal
+    result = approachGoal({0, 0, 0}, {-100, 1}, config);
+    if((0 != result.velocity.linear) || (result.velocity.angular <= 0)) {
+        testError("approachGoal() behind should turn in place counter-clockwise, got (%f, %f)", result.velocity.linear, result.velocity.angular);
+    }
+
+    // to the right; turn clockwise, turn rate is limited
+    result = approachGoal({0, 0, 0}, {0, -100}, config);
+    if((result.velocity.angular >= 0) || (result.velocity.angular < -config.maxAngular)) {
+        testError("approachGoal() to right should turn clockwise within limit, got %f", result.velocity.angular);
+    }
+}
+
+/**
+ * Drive a simulated rover from the origin to each goal in
+ * a grid and report time to goal and final position error.
+ */
+void TestApproachSimulation() {
+    const ApproachConfig config = testConfig();
+
+    float worstTime = 0;
+    float worstError = 0;
+    float totalTime = 0;
+    int goals = 0;
+    for(int gx = -100; gx <= 100; gx += 50) {
+        for(int gy = -100; gy <= 100; gy += 50) {
+            if((0 == gx) && (0 == gy)) continue;
+
+            const Point2D goal = {(distance_type)gx, (distance_type)gy};
+            Pose2D pose = {0, 0, 0};
+            float time = 0;
+            ApproachResult result = approachGoal(pose, goal, config);
+            while(!result.arrived && (time < TEST_TIMEOUT)) {
+                //
+                // same path as the rover; velocity -> limited wheel speeds,
+                // then integrate the wheel speeds back into a pose.
+                //
+                const WheelVelocities wheels = limitWheels(
+                    twistToWheels(result.velocity.linear, result.velocity.angular, TEST_WHEELBASE),
+                    TEST_MIN_SPEED, TEST_MAX_SPEED);
+                const Velocity2D velocity = wheelsToTwist(wheels, TEST_WHEELBASE);
+                pose.x += velocity.linear * cosf(pose.angle) * TEST_DT;
+                pose.y += velocity.linear * sinf(pose.angle) * TEST_DT;
+                pose.angle = limitAngle(pose.angle + velocity.angular * TEST_DT);
+                time += TEST_DT;
+
+                result = approachGoal(pose, goal, config);
+            }
+
+            if(!result.arrived) {
+                testError("approachGoal() did not reach (%d, %d) in %f seconds; distance %f", gx, gy, TEST_TIMEOUT, result.distance);
+            }
+            if(time > worstTime) worstTime = time;
+            if(result.distance > worstError) worstError = result.distance;
+            totalTime += time;
+            goals += 1;
+        }
+    }
+    printf("approach_control simulation: %d goals, mean time %.2f s, worst time %.2f s, worst final error %.2f\n",
+        goals, totalTime / goals, worstTime, worstError);
+}
+
+int main() {
+    // from test folder run: 
+    // gcc -DTESTING -std=c++11 -lstdc++ test.cpp src/rover/approach_control.test.cpp ../src/rover/approach_control.cpp ../src/rover/kinematics.cpp ../src/rover/pose.cpp; ./a.out; rm a.out
+
+    TestApproachGoal();
+    TestApproachSimulation();
+
+    return testResults("approach_control");
+}
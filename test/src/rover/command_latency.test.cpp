@@ -0,0 +1,195 @@
+#include <string.h>
+
+#include "../../test.h"
+#include "../../../src/util/histogram.h"
+#include "../../../src/rover/command_latency.h"
+#include "../../../src/config.h"
+
+using namespace std;
+
+//
+// count latency reports by stage
+//
+class LatencyReports : public Subscriber {
+    public:
+    int counts[NUMBER_OF_LATENCY_STAGES] = {0};
+
+    virtual void onMessage(
+        Publisher &publisher,       // IN : publisher of message
+        Message message,            // IN : message that was published
+        Specifier specifier,        // IN : specifier (like LEFT_WHEEL_SPEC)
+        const char *data)           // IN : message data as a c-cstring
+    {
+        const LatencyStage stage = latencyStageOf(data);
+        if((COMMAND_LATENCY == message) && (stage < NUMBER_OF_LATENCY_STAGES)) {
+            counts[stage] += 1;
+        }
+    }
+};
+
+int testHistogramBuckets() {
+    // bucket i holds values up to 2^i
+    const uint32_t values[] =  {0, 1, 2, 3, 4, 5, 1024, 1025, 0xFFFFFFFF};
+    const unsigned int expected[] = {0, 0, 1, 2, 2, 3, 10, 11, LOG2_HISTOGRAM_BUCKETS - 1};
+    for(unsigned int i = 0; i < sizeof(values) / sizeof(values[0]); i += 1) {
+        const unsigned int bucket = Log2Histogram::bucketOf(values[i]);
+        if(expected[i] != bucket) {
+            testError("Value %u should be in bucket %u, not %u", values[i], expected[i], bucket);
+        }
+    }
+
+    Log2Histogram histogram;
+    if((0 != histogram.percentile(50)) || (0 != histogram.count())) {
+        testError("Empty histogram should report zero%s", "");
+    }
+
+    // 90 fast values and 10 slow ones
+    for(int i = 0; i < 90; i += 1) histogram.add(100);   // bucket 7 (<= 128)
+    for(int i = 0; i < 10; i += 1) histogram.add(3000);  // bucket 12 (<= 4096)
+    if(100 != histogram.count()) {
+        testError("Count should be 100, not %u", histogram.count());
+    }
+    if(39000 != histogram.sum()) {
+        testError("Sum should be 39000, not %llu", (unsigned long long)histogram.sum());
+    }
+    if(3000 != histogram.max()) {
+        testError("Max should be 3000, not %u", histogram.max());
+    }
+    if(128 != histogram.percentile(50)) {
+        testError("p50 should be bucket bound 128, not %u", histogram.percentile(50));
+    }
+    if(128 != histogram.percentile(90)) {
+        testError("p90 should be bucket bound 128, not %u", histogram.percentile(90));
+    }
+    if(3000 != histogram.percentile(99)) {
+        testError("p99 should be limited to max 3000, not %u", histogram.percentile(99));
+    }
+
+    histogram.reset();
+    if((0 != histogram.count()) || (0 != histogram.bucket(7))) {
+        testError("Reset should clear histogram%s", "");
+    }
+
+    return testResults("testHistogramBuckets");
+}
+
+// global so subscriptions start out empty
+MessageBus messageBus;
+
+int testLatencyStages() {
+    LatencyReports reports;
+    reports.subscribe(messageBus, COMMAND_LATENCY);
+
+    CommandLatency latency;
+    latency.attach(messageBus);
+
+    //
+    // received at 1000us, parsed at 1050us,
+    // dequeued at 6000us, written at 6200us
+    //
+    latency.dequeued(CommandStamp(1000, 1050), 6000);
+    latency.pwmWritten(6200);
+    if((1 != latency.histogram(LATENCY_PARSE).count()) || (50 != latency.histogram(LATENCY_PARSE).max())) {
+        testError("Parse stage should be 50us%s", "");
+    }
+    if(4950 != latency.histogram(LATENCY_QUEUE).max()) {
+        testError("Queue stage should be 4950us, not %u", latency.histogram(LATENCY_QUEUE).max());
+    }
+    if(200 != latency.histogram(LATENCY_ACTUATE).max()) {
+        testError("Actuate stage should be 200us, not %u", latency.histogram(LATENCY_ACTUATE).max());
+    }
+    if(5200 != latency.histogram(LATENCY_TOTAL).max()) {
+        testError("Total should be 5200us, not %u", latency.histogram(LATENCY_TOTAL).max());
+    }
+
+    // only the first write after a dequeue counts
+    latency.pwmWritten(7000);
+    if(1 != latency.histogram(LATENCY_TOTAL).count()) {
+        testError("Later pwm writes should not be measured%s", "");
+    }
+
+    // commands without a receive stamp are not measured
+    latency.dequeued(CommandStamp(), 8000);
+    latency.pwmWritten(8100);
+    if(1 != latency.histogram(LATENCY_TOTAL).count()) {
+        testError("Unstamped commands should not be measured%s", "");
+    }
+
+    // a write long after the dequeue is not this command's
+    latency.dequeued(CommandStamp(9000, 9010), 9020);
+    latency.pwmWritten(9020 + 2000000);
+    if(1 != latency.histogram(LATENCY_TOTAL).count()) {
+        testError("Stale pending measurement should be discarded%s", "");
+    }
+
+    // microsecond rollover
+    const unsigned long nearRollover = (unsigned long)-1 - 99;
+    latency.dequeued(CommandStamp(nearRollover, nearRollover + 50), 100);
+    latency.pwmWritten(300);
+    if((2 != latency.histogram(LATENCY_TOTAL).count())
+        || (1 != latency.histogram(LATENCY_TOTAL).bucket(Log2Histogram::bucketOf(400))))
+    {
+        testError("Total across rollover should be 400us%s", "");
+    }
+
+    //
+    // reports are published once per interval, per stage,
+    // and only when there are new samples.
+    //
+    latency.poll(LATENCY_REPORT_MS);
+    for(int stage = 0; stage < NUMBER_OF_LATENCY_STAGES; stage += 1) {
+        if(1 != reports.counts[stage]) {
+            testError("Stage %s should be reported once", LatencyStageStr[stage]);
+        }
+    }
+    latency.poll(LATENCY_REPORT_MS + 1);
+    latency.poll(2 * LATENCY_REPORT_MS);
+    if(1 != reports.counts[LATENCY_TOTAL]) {
+        testError("Latency should not be reported without new samples%s", "");
+    }
+
+    return testResults("testLatencyStages");
+}
+
+int testLatencyMetrics() {
+    CommandLatency latency;
+    latency.dequeued(CommandStamp(1000, 1050), 6000);
+    latency.pwmWritten(6200);
+
+    char buffer[1664];
+    int offset = formatLatencyMetricsHeader(buffer, sizeof(buffer), 0);
+    if(nullptr == strstr(buffer, "# TYPE rover_command_latency_us histogram\n")) {
+        testError("Metrics header should declare histogram type: %s", buffer);
+    }
+
+    // largest possible counts still fit the buffer used by /metrics
+    offset = formatLatencyMetrics(buffer, sizeof(buffer), 0, latency, LATENCY_TOTAL);
+    if(offset + (int)(LOG2_HISTOGRAM_BUCKETS + 2) * 9 >= (int)sizeof(buffer)) {
+        testError("Metrics for one stage are too close to buffer size: %d", offset);
+    }
+    if(nullptr == strstr(buffer, "rover_command_latency_us_bucket{stage=\"total\",le=\"4096\"} 0\n")) {
+        testError("5200us should not be in 4096 bucket: %s", buffer);
+    }
+    if(nullptr == strstr(buffer, "rover_command_latency_us_bucket{stage=\"total\",le=\"8192\"} 1\n")) {
+        testError("5200us should be in 8192 bucket: %s", buffer);
+    }
+    if(nullptr == strstr(buffer, "rover_command_latency_us_bucket{stage=\"total\",le=\"+Inf\"} 1\n")) {
+        testError("+Inf bucket should count everything: %s", buffer);
+    }
+    if(nullptr == strstr(buffer, "rover_command_latency_us_sum{stage=\"total\"} 5200\n")) {
+        testError("Sum should be 5200: %s", buffer);
+    }
+    if(nullptr == strstr(buffer, "rover_command_latency_us_count{stage=\"total\"} 1\n")) {
+        testError("Count should be 1: %s", buffer);
+    }
+
+    return testResults("testLatencyMetrics");
+}
+
+int main() {
+    testHistogramBuckets();
+    testLatencyStages();
+    testLatencyMetrics();
+
+    return 0;
+}
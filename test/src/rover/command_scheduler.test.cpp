@@ -0,0 +1,147 @@
+#include <stdlib.h>
+#include "../../test.h"
+#include "../../../src/rover/command_scheduler.h"
+
+using namespace std;
+
+const unsigned long MAX_TICK_MS = 10;   // slowest control loop tick we simulate
+
+//
+// mocked control clock that advances by a jittery tick
+//
+unsigned long mockMillis = 0;
+unsigned long tick() {
+    mockMillis += 1 + (rand() % MAX_TICK_MS);
+    return mockMillis;
+}
+
+int testScheduleOrder() {
+    CommandScheduler<int, 4> scheduler;
+    int value = 0;
+
+    // added out of order, run in time order; ties in arrival order
+    scheduler.schedule(3, 300, 0);
+    scheduler.schedule(1, 100, 0);
+    scheduler.schedule(2, 200, 0);
+    scheduler.schedule(4, 200, 0);
+    if(scheduler.schedule(5, 500, 0)) {
+        testError("Full schedule should reject command%s", "");
+    }
+
+    if(SCHEDULE_NONE != scheduler.poll(99, value)) {
+        testError("Nothing should be due before first start%s", "");
+    }
+    if((SCHEDULE_START != scheduler.poll(100, value)) || (1 != value)) {
+        testError("First command should start at 100, got %d", value);
+    }
+    if((SCHEDULE_START != scheduler.poll(200, value)) || (4 != value) || (1 != scheduler.count())) {
+        testError("Of two commands due at 200 the later arrival should win, got %d", value);
+    }
+
+    // falling behind skips to the newest due command
+    scheduler.clear();
+    scheduler.schedule(1, 100, 0);
+    scheduler.schedule(2, 110, 0);
+    scheduler.schedule(3, 400, 0);
+    if((SCHEDULE_START != scheduler.poll(150, value)) || (2 != value) || (1 != scheduler.count())) {
+        testError("Late poll should start newest due command, got %d", value);
+    }
+
+    // clock rollover
+    scheduler.clear();
+    scheduler.schedule(7, (unsigned long)-5, 10);
+    if((SCHEDULE_START != scheduler.poll((unsigned long)-5, value)) || (7 != value)) {
+        testError("Command should start before rollover%s", "");
+    }
+    if(SCHEDULE_NONE != scheduler.poll(2, value)) {
+        testError("Command should still be running across rollover%s", "");
+    }
+    if(SCHEDULE_STOP != scheduler.poll(5, value)) {
+        testError("Command should stop after rollover%s", "");
+    }
+
+    return testResults("testScheduleOrder");
+}
+
+int testTimedSequence() {
+    //
+    // a maneuver sent ahead of time as timed commands;
+    // each runs back to back on the control clock.
+    //
+    static const int STEPS = 5;
+    const unsigned long durations[STEPS] = {500, 250, 1000, 40, 300};
+    const unsigned long start = 10000;
+
+    for(int trial = 0; trial < 100; trial += 1) {
+        CommandScheduler<int, 8> scheduler;
+        unsigned long at = start;
+        for(int i = 0; i < STEPS; i += 1) {
+            scheduler.schedule(i, at, durations[i]);
+            at += durations[i];
+        }
+
+        unsigned long startedAt[STEPS] = {0};
+        unsigned long stoppedAt = 0;
+        int running = -1;
+        mockMillis = start - 50 + (rand() % MAX_TICK_MS);
+        while(mockMillis < at + 100) {
+            const unsigned long now = tick();
+            int value;
+            switch(scheduler.poll(now, value)) {
+                case SCHEDULE_START: {
+                    startedAt[value] = now;
+                    running = value;
+                    break;
+                }
+                case SCHEDULE_STOP: {
+                    stoppedAt = now;
+                    running = -1;
+                    break;
+                }
+                default: break;
+            }
+        }
+
+        if(running >= 0) {
+            testError("Sequence should have stopped, trial %d", trial);
+            continue;
+        }
+        for(int i = 0; i < STEPS; i += 1) {
+            const unsigned long endedAt = (i + 1 < STEPS) ? startedAt[i + 1] : stoppedAt;
+            const long executed = (long)(endedAt - startedAt[i]);
+            const long error = executed - (long)durations[i];
+            if((error > (long)MAX_TICK_MS) || (error < -(long)MAX_TICK_MS)) {
+                testError("Step %d ran %ldms, expected %lums within one tick", i, executed, durations[i]);
+            }
+        }
+    }
+
+    return testResults("testTimedSequence");
+}
+
+int testDurationReplaced() {
+    CommandScheduler<int, 4> scheduler;
+    int value;
+
+    // command runs for 500ms, but a new one arrives at 300
+    scheduler.schedule(1, 1000, 500);
+    scheduler.poll(1000, value);
+    scheduler.schedule(2, 1300, 0);
+    if((SCHEDULE_START != scheduler.poll(1300, value)) || (2 != value)) {
+        testError("New command should replace running command%s", "");
+    }
+    if(scheduler.running() || (SCHEDULE_NONE != scheduler.poll(1600, value))) {
+        testError("Replaced command's stop should not fire%s", "");
+    }
+
+    return testResults("testDurationReplaced");
+}
+
+int main() {
+    srand(42);
+    testScheduleOrder();
+    testTimedSequence();
+    testDurationReplaced();
+
+    return 0;
+}
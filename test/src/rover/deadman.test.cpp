@@ -0,0 +1,159 @@
+#include "../../test.h"
+#include "../../../src/rover/deadman.h"
+#include "../../../src/behavior/teleop.h"
+
+using namespace std;
+
+//
+// mocked clock; tests advance it explicitly
+//
+unsigned long mockMillis = 0;
+
+int testDeadmanTimer() {
+    DeadmanTimer deadman(1000);
+    mockMillis = 5000;
+    deadman.feed(mockMillis);
+
+    mockMillis += 999;
+    if(deadman.expired(mockMillis)) {
+        testError("Deadman should not expire before timeout%s", "");
+    }
+    mockMillis += 1;
+    if(!deadman.expired(mockMillis)) {
+        testError("Deadman should expire at timeout%s", "");
+    }
+
+    // feeding resets the timer
+    deadman.feed(mockMillis);
+    mockMillis += 500;
+    if(deadman.expired(mockMillis)) {
+        testError("Fed deadman should not expire%s", "");
+    }
+
+    // zero timeout disables
+    deadman.setTimeout(0);
+    mockMillis += 100000;
+    if(deadman.expired(mockMillis)) {
+        testError("Disabled deadman should never expire%s", "");
+    }
+
+    // millis() rollover
+    deadman.setTimeout(1000).feed((unsigned long)-1 - 0xFF);
+    if(deadman.expired(0x00000100UL)) {
+        testError("Deadman should handle clock rollover%s", "");
+    }
+    if(!deadman.expired(0x00000300UL)) {
+        testError("Deadman should expire across clock rollover%s", "");
+    }
+
+    return testResults("testDeadmanTimer");
+}
+
+/**
+ * Same check the command processor runs each poll
+ */
+static bool pollDeadman(DeadmanTimer &deadman, TeleopBehavior &teleop, unsigned long currentMillis, unsigned long rampMs) {
+    if(teleop.active() && !teleop.ramping() && deadman.expired(currentMillis)) {
+        teleop.rampToHalt(currentMillis, rampMs);
+        return true;
+    }
+    return false;
+}
+
+int testFrozenClient() {
+    const unsigned long TIMEOUT_MS = 1000;
+    const unsigned long RAMP_MS = 300;
+    DeadmanTimer deadman(TIMEOUT_MS);
+    TeleopBehavior teleop;
+    WheelCommand command;
+
+    // client sends a tank command then freezes
+    mockMillis = 10000;
+    deadman.feed(mockMillis);
+    teleop.setCommand(WheelCommand(false, 200, 200));
+
+    int events = 0;
+    unsigned long haltedAt = 0;
+    for(int tick = 0; tick < 200; tick += 1) {
+        mockMillis += 10;
+        if(pollDeadman(deadman, teleop, mockMillis, RAMP_MS)) {
+            events += 1;
+        }
+        if(!teleop.proposeCommand(mockMillis, command)) {
+            if(0 == haltedAt) haltedAt = mockMillis;
+        } else if(teleop.ramping() && (command.left > 200)) {
+            testError("Ramp should never increase speed, got %f", command.left);
+        }
+    }
+
+    if(1 != events) {
+        testError("Deadman should publish exactly one event, got %d", events);
+    }
+    if((haltedAt < 10000 + TIMEOUT_MS + RAMP_MS) || (haltedAt > 10000 + TIMEOUT_MS + RAMP_MS + 10)) {
+        testError("Rover should halt after timeout plus ramp, halted at %lu", haltedAt - 10000);
+    }
+    if(teleop.active()) {
+        testError("Teleop should be inactive after ramp%s", "");
+    }
+
+    return testResults("testFrozenClient");
+}
+
+int testHeartbeat() {
+    DeadmanTimer deadman(1000);
+    TeleopBehavior teleop;
+    WheelCommand command;
+
+    //
+    // client holds a steady command and sends a heartbeat
+    // every 250ms; the rover should keep driving.
+    //
+    mockMillis = 20000;
+    deadman.feed(mockMillis);
+    teleop.setCommand(WheelCommand(true, 30, 30));
+    for(int tick = 0; tick < 500; tick += 1) {
+        mockMillis += 10;
+        if(0 == (tick % 25)) deadman.feed(mockMillis);
+        if(pollDeadman(deadman, teleop, mockMillis, 300)) {
+            testError("Deadman should not expire with heartbeat at tick %d", tick);
+            break;
+        }
+        if(!teleop.proposeCommand(mockMillis, command) || (WheelCommand(true, 30, 30) != command)) {
+            testError("Teleop should keep proposing driver's command at tick %d", tick);
+            break;
+        }
+    }
+
+    //
+    // a new command during the ramp stops the ramp
+    //
+    mockMillis += 2000;
+    pollDeadman(deadman, teleop, mockMillis, 300);
+    if(!teleop.ramping()) {
+        testError("Teleop should be ramping after timeout%s", "");
+    }
+    deadman.feed(mockMillis);
+    teleop.setCommand(WheelCommand(true, 40, 40));
+    if(teleop.ramping() || !teleop.proposeCommand(mockMillis + 1000, command) || (40 != command.left)) {
+        testError("New command should cancel the ramp%s", "");
+    }
+
+    //
+    // a stopped rover is never ramped
+    //
+    teleop.setCommand(WheelCommand(true, 0, 0));
+    mockMillis += 5000;
+    if(pollDeadman(deadman, teleop, mockMillis, 300)) {
+        testError("Deadman should not trigger when not moving%s", "");
+    }
+
+    return testResults("testHeartbeat");
+}
+
+int main() {
+    testDeadmanTimer();
+    testFrozenClient();
+    testHeartbeat();
+
+    return 0;
+}
@@ -0,0 +1,102 @@
+#include <math.h>
+
+#include "../../test.h"
+#include "../../../src/rover/kinematics.h"
+
+using namespace std;
+
+const distance_type TEST_WHEELBASE = 13.5;
+
+bool nearlyEqual(float a, float b) {
+    return fabsf(a - b) < 0.0001f;
+}
+
+/**
+ * curvature of a turn is angular / linear velocity,
+ * which for wheels is (right - left) / (wheelBase * (right + left) / 2)
+ */
+float curvature(WheelVelocities wheels) {
+    const Velocity2D twist = wheelsToTwist(wheels, TEST_WHEELBASE);
+    return twist.angular / twist.linear;
+}
+
+void TestTwistToWheels() {
+    // straight
+    WheelVelocities wheels = twistToWheels(20, 0, TEST_WHEELBASE);
+    if(!nearlyEqual(20, wheels.left) || !nearlyEqual(20, wheels.right)) {
+        testError("twistToWheels(20, 0) should be (20, 20), got (%f, %f)", wheels.left, wheels.right);
+    }
+
+    // spin in place counter-clockwise; right wheel forward
+    wheels = twistToWheels(0, 2, TEST_WHEELBASE);
+    if(!nearlyEqual(-13.5, wheels.left) || !nearlyEqual(13.5, wheels.right)) {
+        testError("twistToWheels(0, 2) should be (-13.5, 13.5), got (%f, %f)", wheels.left, wheels.right);
+    }
+
+    // round trip
+    const Velocity2D twist = wheelsToTwist(twistToWheels(12.5, -0.75, TEST_WHEELBASE), TEST_WHEELBASE);
+    if(!nearlyEqual(12.5, twist.linear) || !nearlyEqual(-0.75, twist.angular)) {
+        testError("wheelsToTwist(twistToWheels(12.5, -0.75)) should be (12.5, -0.75), got (%f, %f)", twist.linear, twist.angular);
+    }
+}
+
+void TestLimitWheels() {
+    // uncalibrated is unchanged
+    WheelVelocities wheels = limitWheels({5, 200}, 0, 0);
+    if(!nearlyEqual(5, wheels.left) || !nearlyEqual(200, wheels.right)) {
+        testError("limitWheels() uncalibrated should be unchanged, got (%f, %f)", wheels.left, wheels.right);
+    }
+
+    // within range is unchanged
+    wheels = limitWheels({20, 30}, 10, 50);
+    if(!nearlyEqual(20, wheels.left) || !nearlyEqual(30, wheels.right)) {
+        testError("limitWheels({20, 30}) should be unchanged, got (%f, %f)", wheels.left, wheels.right);
+    }
+
+    // faster wheel over max is slowed, curvature kept
+    const WheelVelocities fast = twistToWheels(60, 1, TEST_WHEELBASE);
+    wheels = limitWheels(fast, 10, 50);
+    if(!nearlyEqual(50, wheels.right) || !nearlyEqual(curvature(fast), curvature(wheels))) {
+        testError("limitWheels() over max should have right == 50 and same curvature, got (%f, %f)", wheels.left, wheels.right);
+    }
+
+    // reverse over max is slowed
+    wheels = limitWheels({-100, -80}, 10, 50);
+    if(!nearlyEqual(-50, wheels.left) || !nearlyEqual(-40, wheels.right)) {
+        testError("limitWheels({-100, -80}) should be (-50, -40), got (%f, %f)", wheels.left, wheels.right);
+    }
+
+    // slower wheel in stall range is sped up when possible
+    wheels = limitWheels({5, 15}, 10, 50);
+    if(!nearlyEqual(10, wheels.left) || !nearlyEqual(30, wheels.right)) {
+        testError("limitWheels({5, 15}) should be (10, 30), got (%f, %f)", wheels.left, wheels.right);
+    }
+
+    // slower wheel can't be sped up without exceeding max; keep as is
+    wheels = limitWheels({2, 40}, 10, 50);
+    if(!nearlyEqual(2, wheels.left) || !nearlyEqual(40, wheels.right)) {
+        testError("limitWheels({2, 40}) should be unchanged, got (%f, %f)", wheels.left, wheels.right);
+    }
+
+    // spin in place below min speed
+    wheels = limitWheels({-4, 4}, 10, 50);
+    if(!nearlyEqual(-10, wheels.left) || !nearlyEqual(10, wheels.right)) {
+        testError("limitWheels({-4, 4}) should be (-10, 10), got (%f, %f)", wheels.left, wheels.right);
+    }
+
+    // stopped stays stopped
+    wheels = limitWheels({0, 0}, 10, 50);
+    if((0 != wheels.left) || (0 != wheels.right)) {
+        testError("limitWheels({0, 0}) should be (0, 0), got (%f, %f)", wheels.left, wheels.right);
+    }
+}
+
+int main() {
+    // from test folder run: 
+    // gcc -DTESTING -std=c++11 -lstdc++ test.cpp src/rover/kinematics.test.cpp ../src/rover/kinematics.cpp; ./a.out; rm a.out
+
+    TestTwistToWheels();
+    TestLimitWheels();
+
+    return testResults("kinematics");
+}
@@ -0,0 +1,404 @@
+#include <math.h>
+#include <string.h>
+#include "../../test.h"
+#include "../../../src/config.h"
+#include "../../../src/hal/linux_hal.h"
+#include "../../../src/rover/rover_command.h"
+#include "../../../src/error.h"
+
+using namespace std;
+
+//
+// the parts of the rover that commands reach,
+// put together as in main.cpp but with no wheels attached
+//
+MessageBus messageBus;
+Settings settings;
+TwoWheelRover rover(WHEELBASE);
+GotoGoalBehavior gotoGoalBehavior;
+PathFollowBehavior pathFollowBehavior;
+GeofenceBehavior geofenceBehavior;
+
+grid_word_type mapBits[(MAP_MAX_CELLS + GRID_WORD_BITS - 1) / GRID_WORD_BITS];
+OccupancyGrid occupancyGrid(mapBits, sizeof(mapBits) / sizeof(mapBits[0]));
+plan_cost_type planCost[MAP_MAX_CELLS];
+uint8_t planFrom[MAP_MAX_CELLS];
+PlannerHeapEntry planHeap[PLAN_HEAP_ENTRIES];
+PathPlanner pathPlanner(planCost, planFrom, MAP_MAX_CELLS, planHeap, PLAN_HEAP_ENTRIES);
+
+void attachRover(RoverCommandProcessor &processor) {
+    gotoGoalBehavior.attach(rover, messageBus);
+    pathFollowBehavior.attach(rover, gotoGoalBehavior, occupancyGrid, pathPlanner, messageBus);
+    geofenceBehavior.attach(rover, messageBus);
+    processor.attach(rover, gotoGoalBehavior, pathFollowBehavior, geofenceBehavior, settings, messageBus);
+}
+
+void detachRover(RoverCommandProcessor &processor) {
+    processor.detach();
+    gotoGoalBehavior.cancel();
+    pathFollowBehavior.cancel();
+}
+
+/**
+ * Poll the processor each ms through a span of time
+ * and count the ms in which teleop would move the rover
+ */
+unsigned int pollMoving(RoverCommandProcessor &processor, unsigned long fromMs, unsigned long toMs) {
+    unsigned int moving = 0;
+    for(unsigned long ms = fromMs; ms <= toMs; ms += 1) {
+        processor.pollRoverCommand(ms);
+        WheelCommand command;
+        if(processor.teleopBehavior().proposeCommand(ms, command) && !command.isStopped()) {
+            moving += 1;
+        }
+    }
+    return moving;
+}
+
+int testHaltDropsScheduled() {
+    RoverCommandProcessor processor;
+    attachRover(processor);
+
+    // scheduled movement still in the queue when the halt arrives
+    processor.submitCommand("cmd(1, pwm(128, true, 128, true), at(50), for(100))", 0);
+    processor.submitCommand("cmd(2, pwm(200, true, 200, true), at(200), for(100))", 0);
+    if(2 != processor.scheduleQueueDepth()) {
+        testError("Both scheduled commands should be queued, queue has %u", processor.scheduleQueueDepth());
+    }
+    const SubmitCommandResult halted = processor.submitCommand("cmd(3, halt())", 0);
+    if(SUCCESS != halted.status) {
+        testError("Halt should be accepted, status %d", halted.status);
+    }
+
+    const unsigned int moving = pollMoving(processor, 0, 400);
+    if(0 != moving) {
+        testError("No scheduled command should run after a halt, moved for %u ms", moving);
+    }
+
+    // scheduled after the halt; runs
+    processor.submitCommand("cmd(4, pwm(128, true, 128, true), at(500), for(100))", 0);
+    const unsigned int movingAfter = pollMoving(processor, 401, 700);
+    if(100 != movingAfter) {
+        testError("Command scheduled after the halt should run for 100 ms, ran %u", movingAfter);
+    }
+
+    detachRover(processor);
+    return testResults("testHaltDropsScheduled");
+}
+
+int testHaltDropsDrainedSchedule() {
+    RoverCommandProcessor processor;
+    attachRover(processor);
+
+    // scheduled movement already moved into the scheduler
+    processor.submitCommand("cmd(1, pwm(128, true, 128, true), at(50), for(100))", 0);
+    pollMoving(processor, 0, 10);
+    processor.halt();
+
+    const unsigned int moving = pollMoving(processor, 11, 400);
+    if(0 != moving) {
+        testError("Scheduled command should not run after a halt, moved for %u ms", moving);
+    }
+
+    detachRover(processor);
+    return testResults("testHaltDropsDrainedSchedule");
+}
+
+int testTimingSyntax() {
+    RoverCommandProcessor processor;
+    attachRover(processor);
+
+    // the example in the CommandTiming comment
+    const SubmitCommandResult result = processor.submitCommand("cmd(7, speed(128, true, 128, true), at(120500), for(500))", 0);
+    if((SUCCESS != result.status) || (7 != result.id) || (1 != processor.scheduleQueueDepth())) {
+        testError("Timed speed command should be scheduled, status %d", result.status);
+    }
+
+    detachRover(processor);
+    return testResults("testTimingSyntax");
+}
+
+int testTwistNotAttached() {
+    RoverCommandProcessor processor;
+
+    const SubmitCommandResult result = processor.submitCommand("cmd(1, twist(20, 0.5))", 0);
+    if(COMMAND_BAD_FAILURE != result.status) {
+        testError("Twist with no rover attached should fail with %d, got %d", COMMAND_BAD_FAILURE, result.status);
+    }
+    TankCommand tank;
+    if(COMMAND_BAD_FAILURE != processor.twistToTank(TwistCommand(20, 0), tank)) {
+        testError("Twist conversion with no rover attached should fail%s", "");
+    }
+
+    return testResults("testTwistNotAttached");
+}
+
+int testTwistToTank() {
+    RoverCommandProcessor processor;
+    attachRover(processor);
+
+    // rover has no calibrated wheels, so velocities are not limited
+    TankCommand tank;
+    if((SUCCESS != processor.twistToTank(TwistCommand(-20, 0), tank))
+        || !tank.useSpeedControl
+        || tank.left.forward || tank.right.forward
+        || (fabsf(tank.left.value - 20) > 0.001f) || (fabsf(tank.right.value - 20) > 0.001f))
+    {
+        testError("Reverse twist should drive both wheels backward at 20, got %f, %f", tank.left.value, tank.right.value);
+    }
+
+    // counter-clockwise turn in place; left wheel backward
+    if((SUCCESS != processor.twistToTank(TwistCommand(0, 1), tank))
+        || tank.left.forward || !tank.right.forward
+        || (tank.left.value <= 0) || (fabsf(tank.left.value - tank.right.value) > 0.001f))
+    {
+        testError("Turn in place should drive wheels in opposite directions, got %f, %f", tank.left.value, tank.right.value);
+    }
+
+    // velocities that are not finite would reach speed control as NaN
+    if((COMMAND_BAD_FAILURE != processor.twistToTank(TwistCommand(NAN, 0), tank))
+        || (COMMAND_BAD_FAILURE != processor.twistToTank(TwistCommand(0, INFINITY), tank)))
+    {
+        testError("Twist that is not finite should fail with %d", COMMAND_BAD_FAILURE);
+    }
+
+    const SubmitCommandResult result = processor.submitCommand("cmd(2, twist(20, 0.5))", 0);
+    if(SUCCESS != result.status) {
+        testError("Twist with rover attached should be accepted, got %d", result.status);
+    }
+
+    detachRover(processor);
+    return testResults("testTwistToTank");
+}
+
+//
+// count path follow states as published
+//
+class PathStates : public Subscriber {
+    public:
+    int failed = 0;
+    int running = 0;
+
+    virtual void onMessage(Publisher &publisher, Message message, Specifier specifier, const char *data) {
+        if(PATH_FAILED == pathFollowBehavior.state()) failed += 1;
+        if(PATH_RUNNING == pathFollowBehavior.state()) running += 1;
+    }
+};
+
+int testPathIsQueued() {
+    RoverCommandProcessor processor;
+    attachRover(processor);
+    PathStates states;
+    states.subscribe(messageBus, PATH_FOLLOW);
+
+    // 10 x 10 cell map centered on the rover
+    occupancyGrid.reset(10, 10, 10, -50, -50);
+
+    // planned when it runs, after the commands ahead of it
+    processor.submitCommand("cmd(1, resetPose())", 0);
+    const SubmitCommandResult result = processor.submitCommand("cmd(2, path(30.0, 30.0, 2.0, 0.75))", 0);
+    if((SUCCESS != result.status) || (2 != processor.configQueueDepth())) {
+        testError("Path should be queued behind resetPose, status %d", result.status);
+    }
+    if((PATH_NOT_RUNNING != pathFollowBehavior.state()) || (0 != states.running)) {
+        testError("Path should not be planned when submitted%s", "");
+    }
+    processor.pollRoverCommand(0);
+    if((0 != processor.configQueueDepth()) || (PATH_RUNNING != pathFollowBehavior.state())) {
+        testError("Path should be planned when the loop runs it%s", "");
+    }
+
+    // goal is off the map; the failure is published when it runs
+    const SubmitCommandResult offMap = processor.submitCommand("cmd(3, path(500.0, 500.0, 2.0, 0.75))", 0);
+    if((SUCCESS != offMap.status) || (0 != states.failed)) {
+        testError("Path off the map should be queued, status %d", offMap.status);
+    }
+    processor.pollRoverCommand(1);
+    if(1 != states.failed) {
+        testError("Path off the map should publish FAILED once, published %d", states.failed);
+    }
+
+    states.unsubscribe(messageBus, PATH_FOLLOW);
+    occupancyGrid.reset(0, 0, 1, 0, 0);
+    detachRover(processor);
+    return testResults("testPathIsQueued");
+}
+
+int testHaltOnLoop() {
+    RoverCommandProcessor processor;
+    attachRover(processor);
+
+    processor.submitCommand("cmd(1, goto(100.0, 0.0, 0.001, 0.75))", 0);
+    processor.pollRoverCommand(0);
+    if(RUNNING != gotoGoalBehavior.state()) {
+        testError("Goto should be running, is %s", GotoGoalStateStr[gotoGoalBehavior.state()]);
+    }
+
+    // the submitter only counts the halt; the loop cancels the goal
+    processor.submitCommand("cmd(2, halt())", 0);
+    if(RUNNING != gotoGoalBehavior.state()) {
+        testError("Halt should not touch the goal before the loop polls%s", "");
+    }
+    processor.pollRoverCommand(1);
+    if(RUNNING == gotoGoalBehavior.state()) {
+        testError("Halt should cancel the goal when the loop polls%s", "");
+    }
+
+    // a goal after the halt runs
+    processor.submitCommand("cmd(3, goto(100.0, 0.0, 0.001, 0.75))", 0);
+    processor.pollRoverCommand(2);
+    if(RUNNING != gotoGoalBehavior.state()) {
+        testError("Goto after the halt should run, is %s", GotoGoalStateStr[gotoGoalBehavior.state()]);
+    }
+
+    detachRover(processor);
+    return testResults("testHaltOnLoop");
+}
+
+static int putFloat(uint8_t *bytes, int offset, float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    bytes[offset] = bits & 0xFF;
+    bytes[offset + 1] = (bits >> 8) & 0xFF;
+    bytes[offset + 2] = (bits >> 16) & 0xFF;
+    bytes[offset + 3] = (bits >> 24) & 0xFF;
+    return offset + 4;
+}
+
+int testUploadsOnLoop() {
+    RoverCommandProcessor processor;
+    attachRover(processor);
+    occupancyGrid.reset(0, 0, 1, 0, 0);
+
+    // 8 x 8 map of 10 cm cells, all free
+    uint8_t map[64];
+    int length = 0;
+    map[length++] = BINARY_MAP;
+    map[length++] = 1;
+    map[length++] = 0;
+    map[length++] = 8; map[length++] = 0;
+    map[length++] = 8; map[length++] = 0;
+    length = putFloat(map, length, 10);
+    length = putFloat(map, length, -40);
+    length = putFloat(map, length, -40);
+    memset(map + length, 0, 8);
+    length += 8;
+
+    SubmitCommandResult result = processor.submitBinaryCommand(map, length);
+    if((SUCCESS != result.status) || (0 != occupancyGrid.width())) {
+        testError("Map should be staged, not loaded, status %d", result.status);
+    }
+    result = processor.submitBinaryCommand(map, length);
+    if(COMMAND_ENQUEUE_FAILURE != result.status) {
+        testError("Second map should wait for the first to load, status %d", result.status);
+    }
+    processor.pollRoverCommand(0);
+    if(8 != occupancyGrid.width()) {
+        testError("Map should load when the loop polls, width %u", occupancyGrid.width());
+    }
+
+    // square fence; a bent one is refused on arrival
+    uint8_t fence[64];
+    length = 0;
+    fence[length++] = BINARY_FENCE;
+    fence[length++] = 2;
+    fence[length++] = 0;
+    fence[length++] = GEOFENCE_HALT;
+    length = putFloat(fence, length, 10);
+    fence[length++] = 4;
+    const Point2D square[] = {{-40, -40}, {40, -40}, {40, 40}, {-40, 40}};
+    for(int i = 0; i < 4; i += 1) {
+        length = putFloat(fence, length, square[i].x);
+        length = putFloat(fence, length, square[i].y);
+    }
+    fence[length++] = 0;
+
+    result = processor.submitBinaryCommand(fence, length);
+    if((SUCCESS != result.status) || geofenceBehavior.fence().enabled()) {
+        testError("Fence should be staged, not configured, status %d", result.status);
+    }
+    processor.pollRoverCommand(1);
+    if(!geofenceBehavior.fence().enabled()) {
+        testError("Fence should be configured when the loop polls%s", "");
+    }
+
+    putFloat(fence, 17, 0);     // pull in the second vertex; no longer convex
+    putFloat(fence, 21, 20);
+    result = processor.submitBinaryCommand(fence, length);
+    if((COMMAND_ENQUEUE_FAILURE != result.status) || (0 != processor.configQueueDepth())) {
+        testError("Bent fence should be refused when it arrives, status %d", result.status);
+    }
+
+    geofenceBehavior.configure(GEOFENCE_HALT, 0, nullptr, 0, nullptr, 0);
+    occupancyGrid.reset(0, 0, 1, 0, 0);
+    detachRover(processor);
+    return testResults("testUploadsOnLoop");
+}
+
+/**
+ * Upload script text as a binary frame
+ */
+SubmitCommandResult uploadScript(RoverCommandProcessor &processor, int id, const char *text) {
+    uint8_t frame[128];
+    frame[0] = BINARY_SCRIPT;
+    frame[1] = (uint8_t)id;
+    frame[2] = 0;
+    memcpy(frame + 3, text, strlen(text));
+    return processor.submitBinaryCommand(frame, 3 + strlen(text));
+}
+
+int testScriptUploadOnLoop() {
+    RoverCommandProcessor processor;
+    attachRover(processor);
+
+    // compiled on upload, copied in by the loop
+    SubmitCommandResult result = uploadScript(processor, 1, "wait(1000)");
+    if((SUCCESS != result.status) || processor.script().loaded()) {
+        testError("Script should be staged, not loaded, status %d", result.status);
+    }
+    if(COMMAND_ENQUEUE_FAILURE != uploadScript(processor, 2, "wait(1)").status) {
+        testError("Upload should be refused while one is staged%s", "");
+    }
+    processor.pollRoverCommand(0);
+    const unsigned int firstLength = processor.script().length();
+    if(!processor.script().loaded()) {
+        testError("Script should load when the loop polls%s", "");
+    }
+    if((COMMAND_PARSE_FAILURE != uploadScript(processor, 2, "bogus(1)").status) || (firstLength != processor.script().length())) {
+        testError("Bad script should be refused on upload%s", "");
+    }
+
+    //
+    // an upload behind a runScript() replaces the script
+    // after it starts, rather than under it
+    //
+    processor.submitCommand("cmd(3, runScript())", 0);
+    result = uploadScript(processor, 4, "wait(10); wait(10)");
+    if((SUCCESS != result.status) || processor.script().running() || (firstLength != processor.script().length())) {
+        testError("Script should not change before the loop polls, status %d", result.status);
+    }
+    processor.pollRoverCommand(1);
+    if(processor.script().running() || (firstLength == processor.script().length())) {
+        testError("New script should replace the running one, length %u", processor.script().length());
+    }
+
+    detachRover(processor);
+    return testResults("testScriptUploadOnLoop");
+}
+
+int main() {
+    halReset();
+    halSetMicros(0);
+
+    testHaltDropsScheduled();
+    testHaltDropsDrainedSchedule();
+    testTimingSyntax();
+    testTwistNotAttached();
+    testTwistToTank();
+    testPathIsQueued();
+    testHaltOnLoop();
+    testUploadsOnLoop();
+    testScriptUploadOnLoop();
+
+    return 0;
+}
@@ -0,0 +1,245 @@
+#include "../../test.h"
+#include "../../../src/script/script.h"
+#include "../../../src/error.h"
+
+using namespace std;
+
+//
+// run a script until it finishes, counting
+// commands and the ticks it took
+//
+typedef struct ScriptRun {
+    int commands;
+    int tanks;
+    int ticks;
+    unsigned long doneMs;
+    ScriptCommand last;
+} ScriptRun;
+
+ScriptRun runScript(ScriptRunner &runner, unsigned long startMs, unsigned long tickMs, int maxTicks) {
+    ScriptRun run = {0, 0, 0, 0, ScriptCommand()};
+    unsigned long now = startMs;
+    for(run.ticks = 1; run.ticks <= maxTicks; run.ticks += 1) {
+        ScriptCommand command;
+        const ScriptEvent event = runner.poll(now, command);
+        if(SCRIPT_COMMAND == event) {
+            run.commands += 1;
+            if(SCRIPT_TANK == command.opcode) run.tanks += 1;
+            run.last = command;
+        } else if(SCRIPT_DONE == event) {
+            run.doneMs = now;
+            break;
+        }
+        now += tickMs;
+    }
+    return run;
+}
+
+int testScriptCommands() {
+    uint8_t bytecode[SCRIPT_MAX_BYTES];
+    ScriptWriter writer(bytecode, sizeof(bytecode));
+    writer.pid(3, 10, 60, 0.5f, 0.1f, 0.01f)
+        .tank(true, true, 30, false, 20)
+        .go2(100, -50, 5, 10)
+        .end();
+    if(!writer.ok()) {
+        testError("Writer should fit script%s", "");
+    }
+
+    ScriptRunner runner;
+    if(SUCCESS == runner.start()) {
+        testError("Runner should not start without a program%s", "");
+    }
+    if(SUCCESS != runner.load(writer.bytecode(), writer.length())) {
+        testError("Runner should load valid program%s", "");
+    }
+    runner.start();
+
+    ScriptCommand command;
+    if((SCRIPT_COMMAND != runner.poll(0, command)) || (SCRIPT_PID != command.opcode)
+        || (3 != command.flags) || (60 != command.values[1]) || (0.01f != command.values[4]))
+    {
+        testError("First command should be pid%s", "");
+    }
+    if((SCRIPT_COMMAND != runner.poll(1, command)) || (SCRIPT_TANK != command.opcode)
+        || ((SCRIPT_TANK_SPEED_CONTROL | SCRIPT_TANK_LEFT_FORWARD) != command.flags)
+        || (30 != command.values[0]) || (20 != command.values[1]))
+    {
+        testError("Second command should be tank with left forward, right reverse%s", "");
+    }
+    if((SCRIPT_COMMAND != runner.poll(2, command)) || (SCRIPT_GOTO != command.opcode)
+        || (100 != command.values[0]) || (-50 != command.values[1]) || (5 != command.values[2]) || (10 != command.values[3]))
+    {
+        testError("Third command should be goto%s", "");
+    }
+    if((SCRIPT_DONE != runner.poll(3, command)) || runner.running()) {
+        testError("Script should be done after last command%s", "");
+    }
+    if(SCRIPT_IDLE != runner.poll(4, command)) {
+        testError("Finished script should be idle%s", "");
+    }
+
+    return testResults("testScriptCommands");
+}
+
+int testScriptWaitAndRepeat() {
+    //
+    // a calibration sweep: 3 times, drive 500ms then stop 250ms
+    //
+    uint8_t bytecode[SCRIPT_MAX_BYTES];
+    ScriptWriter writer(bytecode, sizeof(bytecode));
+    writer.repeat(3)
+            .tank(false, true, 128, true, 128)
+            .wait(500)
+            .tank(false, false, 0, false, 0)
+            .wait(250)
+        .next()
+        .end();
+
+    ScriptRunner runner;
+    runner.load(writer.bytecode(), writer.length());
+    runner.start();
+    const ScriptRun run = runScript(runner, 1000, 10, 1000);
+    if(6 != run.tanks) {
+        testError("Sweep should send 6 tank commands, not %d", run.tanks);
+    }
+    if(run.doneMs < 1000 + 3 * 750) {
+        testError("Sweep should take at least 2250ms, not %lu", run.doneMs - 1000);
+    }
+    if(run.doneMs > 1000 + 3 * 750 + 3 * 2 * 10) {
+        testError("Sweep should end within a tick of each wait, not %lu", run.doneMs - 1000);
+    }
+
+    //
+    // nested repeats
+    //
+    ScriptWriter nested(bytecode, sizeof(bytecode));
+    nested.repeat(2)
+            .repeat(3)
+                .tank(false, true, 100, true, 100)
+            .next()
+            .tank(false, false, 0, false, 0)
+        .next()
+        .end();
+    runner.load(nested.bytecode(), nested.length());
+    runner.start();
+    const ScriptRun nestedRun = runScript(runner, 0, 10, 100);
+    if(8 != nestedRun.tanks) {
+        testError("Nested repeat should send 8 tank commands, not %d", nestedRun.tanks);
+    }
+
+    //
+    // restart runs it again from the top
+    //
+    runner.start();
+    const ScriptRun again = runScript(runner, 0, 10, 100);
+    if(8 != again.tanks) {
+        testError("Restarted script should send 8 tank commands, not %d", again.tanks);
+    }
+
+    return testResults("testScriptWaitAndRepeat");
+}
+
+int testScriptBudget() {
+    //
+    // a loop with nothing to wait on must not
+    // hang the control loop; each poll is bounded
+    //
+    uint8_t bytecode[SCRIPT_MAX_BYTES];
+    ScriptWriter writer(bytecode, sizeof(bytecode));
+    writer.repeat(0).wait(0).next().end();
+
+    ScriptRunner runner;
+    if(SUCCESS != runner.load(writer.bytecode(), writer.length())) {
+        testError("Forever loop should load%s", "");
+    }
+    runner.start();
+    ScriptCommand command;
+    for(int i = 0; i < 100; i += 1) {
+        if(SCRIPT_IDLE != runner.poll(i, command)) {
+            testError("Empty forever loop should stay idle%s", "");
+            break;
+        }
+    }
+    if(!runner.running()) {
+        testError("Forever loop should keep running%s", "");
+    }
+    runner.stop();
+    if(runner.running() || (SCRIPT_IDLE != runner.poll(200, command))) {
+        testError("Stopped script should not run%s", "");
+    }
+
+    return testResults("testScriptBudget");
+}
+
+int testScriptValidation() {
+    ScriptRunner runner;
+    uint8_t bytecode[SCRIPT_MAX_BYTES];
+
+    // missing end
+    ScriptWriter noEnd(bytecode, sizeof(bytecode));
+    noEnd.tank(false, true, 1, true, 1);
+    if(SUCCESS == runner.load(noEnd.bytecode(), noEnd.length())) {
+        testError("Program without end should not load%s", "");
+    }
+
+    // truncated instruction
+    ScriptWriter truncated(bytecode, sizeof(bytecode));
+    truncated.wait(100).end();
+    if(SUCCESS == runner.load(truncated.bytecode(), 3)) {
+        testError("Truncated program should not load%s", "");
+    }
+
+    // unbalanced repeat
+    ScriptWriter unbalanced(bytecode, sizeof(bytecode));
+    unbalanced.repeat(2).wait(1).end();
+    if(SUCCESS == runner.load(unbalanced.bytecode(), unbalanced.length())) {
+        testError("Unclosed repeat should not load%s", "");
+    }
+    ScriptWriter extraNext(bytecode, sizeof(bytecode));
+    extraNext.wait(1).next().end();
+    if(SUCCESS == runner.load(extraNext.bytecode(), extraNext.length())) {
+        testError("Unmatched next should not load%s", "");
+    }
+
+    // too deep
+    ScriptWriter deep(bytecode, sizeof(bytecode));
+    for(unsigned int i = 0; i <= SCRIPT_MAX_DEPTH; i += 1) deep.repeat(2);
+    for(unsigned int i = 0; i <= SCRIPT_MAX_DEPTH; i += 1) deep.next();
+    deep.end();
+    if(SUCCESS == runner.load(deep.bytecode(), deep.length())) {
+        testError("Repeats nested too deep should not load%s", "");
+    }
+
+    // bad opcode and trailing bytes
+    const uint8_t badOpcode[] = {NUMBER_OF_SCRIPT_OPCODES, SCRIPT_END};
+    if(SUCCESS == runner.load(badOpcode, sizeof(badOpcode))) {
+        testError("Unknown opcode should not load%s", "");
+    }
+    const uint8_t trailing[] = {SCRIPT_END, SCRIPT_NEXT};
+    if(SUCCESS == runner.load(trailing, sizeof(trailing))) {
+        testError("Bytes after end should not load%s", "");
+    }
+    if(runner.loaded()) {
+        testError("Failed load should clear program%s", "");
+    }
+
+    // writer overflow
+    uint8_t small[8];
+    ScriptWriter overflow(small, sizeof(small));
+    overflow.wait(1).tank(false, true, 1, true, 1).end();
+    if(overflow.ok() || (5 != overflow.length())) {
+        testError("Writer should stop at a whole instruction when full, length %u", overflow.length());
+    }
+
+    return testResults("testScriptValidation");
+}
+
+int main() {
+    testScriptCommands();
+    testScriptWaitAndRepeat();
+    testScriptBudget();
+    testScriptValidation();
+
+    return 0;
+}
@@ -0,0 +1,235 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "../../test.h"
+#include "../../../src/settings/settings.h"
+#include "../../../src/config.h"
+#include "../../../src/error.h"
+
+using namespace std;
+
+//
+// file storage that counts writes by key
+//
+class CountingStorage : public FileSettingsStorage {
+    public:
+    int writes = 0;
+    int writesByGroup[NUMBER_OF_SETTINGS_GROUPS] = {0};
+    bool failWrites = false;
+
+    CountingStorage(const char *directory): FileSettingsStorage(directory) {}
+
+    virtual int write(const char *key, const void *value, unsigned int size) {
+        if(failWrites) return FAILURE;
+        writes += 1;
+        for(int i = 0; i < NUMBER_OF_SETTINGS_GROUPS; i += 1) {
+            if(0 == strcmp(key, SettingsGroupStr[i])) writesByGroup[i] += 1;
+        }
+        return FileSettingsStorage::write(key, value, size);
+    }
+};
+
+char directory[] = "/tmp/settings_test_XXXXXX";
+
+int testSettingsRoundTrip() {
+    CountingStorage storage(directory);
+
+    Settings settings;
+    settings.attach(storage).load();
+    if(0 != settings.loaded()) {
+        testError("Empty storage should load nothing, not 0x%x", settings.loaded());
+    }
+
+    settings.setSpeedControl(0x03, 10, 60, 0.5f, 0.1f, 0.01f, 1000);
+    settings.setStall(0.3f, 0.35f, 1000);
+    settings.setDeadmanTimeout(750, 1000);
+    if(SUCCESS != settings.setCamera("framesize", 8, 1000)) {
+        testError("framesize should be a kept camera setting%s", "");
+    }
+    if(SUCCESS == settings.setCamera("face_detect", 1, 1000)) {
+        testError("face_detect should not be a kept camera setting%s", "");
+    }
+    if(5 != settings.flush()) {
+        testError("All five records should be written%s", "");
+    }
+
+    //
+    // a new instance, like after a restart, reads it all back
+    //
+    Settings restarted;
+    restarted.attach(storage).load();
+    const unsigned int all = (1u << NUMBER_OF_SETTINGS_GROUPS) - 1;
+    if(all != restarted.loaded()) {
+        testError("All records should load, not 0x%x", restarted.loaded());
+    }
+    const RoverSettings &values = restarted.values();
+    if((60 != values.leftPid.maxSpeed) || (0.01f != values.rightPid.Kd)) {
+        testError("Speed control should load for both wheels%s", "");
+    }
+    if((0.3f != values.stall.left) || (0.35f != values.stall.right)) {
+        testError("Stall should load%s", "");
+    }
+    if(750 != values.command.deadmanTimeoutMs) {
+        testError("Deadman timeout should load as 750, not %u", values.command.deadmanTimeoutMs);
+    }
+    if(!(values.camera.set & (1u << CAMERA_FRAMESIZE)) || (8 != values.camera.values[CAMERA_FRAMESIZE])
+        || (values.camera.set & (1u << CAMERA_QUALITY)))
+    {
+        testError("Only the camera framesize should load%s", "");
+    }
+    if(0 != restarted.dirty()) {
+        testError("Loaded settings should not be dirty%s", "");
+    }
+
+    return testResults("testSettingsRoundTrip");
+}
+
+int testSettingsDirtyAndDebounce() {
+    CountingStorage storage(directory);
+    Settings settings;
+    settings.attach(storage).load();
+
+    //
+    // only changed records are written, and only after
+    // changes have been quiet for the debounce time
+    //
+    const uint32_t revision = settings.revision();
+    settings.setStall(0.3f, 0.35f, 5000);    // same as saved
+    if((0 != settings.dirty()) || (revision != settings.revision())) {
+        testError("Setting an unchanged value should not dirty settings%s", "");
+    }
+
+    unsigned long now = 10000;
+    for(int i = 0; i < 20; i += 1) {
+        // slider sweep
+        settings.setStall(0.01f * i, 0.35f, now);
+        if(0 != settings.poll(now)) {
+            testError("Settings should not be written while changing at %lu", now);
+        }
+        now += 100;
+    }
+    if(settings.revision() != revision + 20) {
+        testError("Each change should bump revision%s", "");
+    }
+    if(settingsBit(SETTINGS_STALL) != settings.dirty()) {
+        testError("Only stall should be dirty, not 0x%x", settings.dirty());
+    }
+    if(0 != settings.poll(now - 100 + SETTINGS_DEBOUNCE_MS - 1)) {
+        testError("Settings should not be written before debounce%s", "");
+    }
+    if(1 != settings.poll(now - 100 + SETTINGS_DEBOUNCE_MS)) {
+        testError("Stall should be written once after debounce%s", "");
+    }
+    if((1 != storage.writes) || (1 != storage.writesByGroup[SETTINGS_STALL])) {
+        testError("Only the stall record should be written, writes = %d", storage.writes);
+    }
+    if(0 != settings.poll(now + 10 * SETTINGS_DEBOUNCE_MS)) {
+        testError("Clean settings should not be written again%s", "");
+    }
+
+    //
+    // failed writes stay dirty and back off
+    //
+    settings.setDeadmanTimeout(0, now);
+    storage.failWrites = true;
+    now += SETTINGS_DEBOUNCE_MS;
+    if((0 != settings.poll(now)) || (settingsBit(SETTINGS_COMMAND) != settings.dirty())) {
+        testError("Failed write should leave record dirty%s", "");
+    }
+    storage.failWrites = false;
+    if(0 != settings.poll(now + 1)) {
+        testError("Failed write should back off%s", "");
+    }
+    if(1 != settings.poll(now + SETTINGS_DEBOUNCE_MS)) {
+        testError("Record should be written after backing off%s", "");
+    }
+
+    return testResults("testSettingsDirtyAndDebounce");
+}
+
+int testSettingsVersion() {
+    CountingStorage storage(directory);
+
+    // a record from another layout version is ignored
+    uint8_t record[2 + sizeof(CommandSettings)] = {0};
+    record[0] = (uint8_t)(SETTINGS_VERSION + 1);
+    storage.write(SettingsGroupStr[SETTINGS_COMMAND], record, sizeof(record));
+
+    // a record of the wrong size is ignored
+    uint8_t shortRecord[3] = {SETTINGS_VERSION, 0, 0};
+    storage.write(SettingsGroupStr[SETTINGS_STALL], shortRecord, sizeof(shortRecord));
+
+    Settings settings;
+    settings.attach(storage).load();
+    if(settings.loaded() & (settingsBit(SETTINGS_COMMAND) | settingsBit(SETTINGS_STALL))) {
+        testError("Mismatched records should not load, loaded 0x%x", settings.loaded());
+    }
+    if(!(settings.loaded() & settingsBit(SETTINGS_LEFT_PID))) {
+        testError("Other records should still load%s", "");
+    }
+
+    return testResults("testSettingsVersion");
+}
+
+int testSettingsQueuedCamera() {
+    CountingStorage storage(directory);
+    Settings settings;
+    settings.attach(storage).load();
+
+    //
+    // a change queued from a web handler is not
+    // seen until the loop polls settings
+    //
+    const uint32_t revision = settings.revision();
+    if(SUCCESS != settings.queueCamera("quality", 12, 20000)) {
+        testError("quality should be queued%s", "");
+    }
+    if(SUCCESS == settings.queueCamera("face_detect", 1, 20000)) {
+        testError("face_detect should not be queued%s", "");
+    }
+    if((revision != settings.revision()) || (0 != settings.dirty())) {
+        testError("Queued change should not touch settings before poll%s", "");
+    }
+
+    if(0 != settings.poll(20000)) {
+        testError("Queued change should be debounced%s", "");
+    }
+    const CameraSettings &camera = settings.values().camera;
+    if(!(camera.set & (1u << CAMERA_QUALITY)) || (12 != camera.values[CAMERA_QUALITY])) {
+        testError("Queued quality should be applied by poll, not %d", camera.values[CAMERA_QUALITY]);
+    }
+    if(1 != settings.poll(20000 + SETTINGS_DEBOUNCE_MS)) {
+        testError("Camera should be written once after debounce%s", "");
+    }
+
+    // a full queue refuses more changes rather than losing them
+    for(unsigned int i = 0; i < CAMERA_SETTING_QUEUE_LENGTH; i += 1) {
+        settings.queueCamera("brightness", (int)i, 30000);
+    }
+    if(SUCCESS == settings.queueCamera("brightness", 99, 30000)) {
+        testError("Full queue should refuse a change%s", "");
+    }
+    settings.poll(30000);
+    if((int)CAMERA_SETTING_QUEUE_LENGTH - 1 != settings.values().camera.values[CAMERA_BRIGHTNESS]) {
+        testError("Queued changes should apply in order, brightness is %d", settings.values().camera.values[CAMERA_BRIGHTNESS]);
+    }
+
+    return testResults("testSettingsQueuedCamera");
+}
+
+int main() {
+    if(nullptr == mkdtemp(directory)) {
+        testError("Could not create %s", directory);
+        return 1;
+    }
+
+    testSettingsRoundTrip();
+    testSettingsDirtyAndDebounce();
+    testSettingsVersion();
+    testSettingsQueuedCamera();
+
+    // clean up
+    const std::string command = std::string("rm -rf ") + directory;
+    system(command.c_str());
+    return 0;
+}
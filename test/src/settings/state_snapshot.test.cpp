@@ -0,0 +1,114 @@
+#include <string.h>
+
+#include "../../test.h"
+#include "../../../src/settings/state_snapshot.h"
+#include "../../../src/error.h"
+
+using namespace std;
+
+int testSnapshotContent() {
+    Settings settings;
+    const SnapshotState state = {true, false, "NOT_RUNNING", "STOPPED"};
+
+    char buffer[1024];
+    formatStateSnapshot(buffer, sizeof(buffer), settings, state);
+    const char *expected = "state({\"revision\":0,"
+        "\"speedControl\":{\"left\":true,\"right\":false},"
+        "\"goal\":\"NOT_RUNNING\",\"script\":\"STOPPED\","
+        "\"rates\":{\"control\":20,\"pose\":20,\"latency\":5000},"
+        "\"deadman\":1000})";
+    if(0 != strcmp(expected, buffer)) {
+        testError("Snapshot without settings should be %s", expected);
+        testError("                          but was %s", buffer);
+    }
+
+    //
+    // settings that have a value are included
+    //
+    settings.setStall(0.25f, 0.5f, 0);
+    settings.setDeadmanTimeout(500, 0);
+    settings.setCamera("vflip", 1, 0);
+    formatStateSnapshot(buffer, sizeof(buffer), settings, state);
+    if(nullptr == strstr(buffer, "\"stall\":{\"left\":0.250000,\"right\":0.500000}")) {
+        testError("Snapshot should include stall, not %s", buffer);
+    }
+    if(nullptr == strstr(buffer, "\"deadman\":500")) {
+        testError("Snapshot should include saved deadman timeout, not %s", buffer);
+    }
+    if(nullptr == strstr(buffer, "\"camera\":{\"vflip\":1}")) {
+        testError("Snapshot should include camera profile, not %s", buffer);
+    }
+    if(nullptr != strstr(buffer, "Pid")) {
+        testError("Snapshot should not include unset calibration, not %s", buffer);
+    }
+
+    //
+    // everything set must fit the snapshot buffer
+    //
+    settings.setSpeedControl(0x03, 10.123456f, 60.123456f, 0.123456f, 0.123456f, 0.123456f, 0);
+    for(int i = 0; i < NUMBER_OF_CAMERA_SETTINGS; i += 1) {
+        settings.setCamera(CameraSettingStr[i], -32000, 0);
+    }
+    const SnapshotState longState = {true, true, "ACHIEVED", "RUNNING"};
+    StateSnapshot snapshot;
+    int length;
+    const char *text = snapshot.snapshot(settings, longState, &length);
+    if((length != (int)strlen(text)) || (0 != strcmp("})", text + length - 2))) {
+        testError("Full snapshot should fit buffer, not %s", text);
+    }
+
+    return testResults("testSnapshotContent");
+}
+
+int testSnapshotCache() {
+    Settings settings;
+    SnapshotState state = {false, false, "NOT_RUNNING", "STOPPED"};
+    StateSnapshot snapshot;
+
+    int length;
+    snapshot.snapshot(settings, state, &length);
+    snapshot.snapshot(settings, state, &length);
+    if(1 != snapshot.encodes()) {
+        testError("Unchanged snapshot should be encoded once, not %u", snapshot.encodes());
+    }
+
+    // a setting change re-encodes
+    settings.setStall(0.25f, 0.5f, 0);
+    snapshot.snapshot(settings, state, &length);
+    if(2 != snapshot.encodes()) {
+        testError("Setting change should re-encode snapshot%s", "");
+    }
+
+    // setting the same value does not
+    settings.setStall(0.25f, 0.5f, 0);
+    snapshot.snapshot(settings, state, &length);
+    if(2 != snapshot.encodes()) {
+        testError("Unchanged setting should not re-encode snapshot%s", "");
+    }
+
+    // rover state change re-encodes
+    state.goalState = "RUNNING";
+    const char *text = snapshot.snapshot(settings, state, &length);
+    if((3 != snapshot.encodes()) || (nullptr == strstr(text, "\"goal\":\"RUNNING\""))) {
+        testError("Goal state change should re-encode snapshot%s", "");
+    }
+    state.leftSpeedControl = true;
+    snapshot.snapshot(settings, state, &length);
+    if(4 != snapshot.encodes()) {
+        testError("Speed control change should re-encode snapshot%s", "");
+    }
+
+    snapshot.invalidate().snapshot(settings, state, &length);
+    if(5 != snapshot.encodes()) {
+        testError("Invalidated snapshot should re-encode%s", "");
+    }
+
+    return testResults("testSnapshotCache");
+}
+
+int main() {
+    testSnapshotContent();
+    testSnapshotCache();
+
+    return 0;
+}
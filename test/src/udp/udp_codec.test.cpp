@@ -0,0 +1,219 @@
+#include <string.h>
+#include <math.h>
+#include "../../test.h"
+#include "../../../src/udp/udp_codec.h"
+#include "../../../src/config.h"
+
+using namespace std;
+
+int testUdpEncodeDecode() {
+    uint8_t packet[64];
+
+    unsigned int length = encodeUdpTank(packet, sizeof(packet), 7, UDP_TANK_SPEED_CONTROL | UDP_TANK_LEFT_FORWARD, 12.5f, 3.25f);
+    if(UDP_HEADER_BYTES + 9 != length) {
+        testError("Tank packet should be 15 bytes, not %u", length);
+    }
+    UdpPacket decoded = decodeUdpPacket(packet, length);
+    if(!decoded.matched || (UDP_TANK != decoded.type) || (7 != decoded.sequence)
+        || ((UDP_TANK_SPEED_CONTROL | UDP_TANK_LEFT_FORWARD) != decoded.flags)
+        || (12.5f != decoded.values[0]) || (3.25f != decoded.values[1]))
+    {
+        testError("Tank packet should round trip%s", "");
+    }
+
+    length = encodeUdpTwist(packet, sizeof(packet), 0xFFFFFFFFu, 0.2f, -1.5f);
+    decoded = decodeUdpPacket(packet, length);
+    if(!decoded.matched || (UDP_TWIST != decoded.type) || (0xFFFFFFFFu != decoded.sequence)
+        || (0.2f != decoded.values[0]) || (-1.5f != decoded.values[1]))
+    {
+        testError("Twist packet should round trip%s", "");
+    }
+
+    length = encodeUdpHalt(packet, sizeof(packet), 42);
+    decoded = decodeUdpPacket(packet, length);
+    if(!decoded.matched || (UDP_HALT != decoded.type) || (42 != decoded.sequence) || (UDP_HEADER_BYTES != length)) {
+        testError("Halt packet should round trip%s", "");
+    }
+
+    const char *text = "tel({\"left\":{}})";
+    length = encodeUdpTelemetry(packet, sizeof(packet), 3, text, strlen(text));
+    decoded = decodeUdpPacket(packet, length);
+    if(!decoded.matched || (UDP_TELEMETRY != decoded.type) || (strlen(text) != decoded.payloadLength)
+        || (0 != memcmp(text, decoded.payload, decoded.payloadLength)))
+    {
+        testError("Telemetry packet should round trip%s", "");
+    }
+
+    return testResults("testUdpEncodeDecode");
+}
+
+int testUdpBadPackets() {
+    uint8_t packet[64];
+
+    if(0 != encodeUdpTank(packet, UDP_HEADER_BYTES + 8, 1, 0, 1, 1)) {
+        testError("Tank should not encode into a buffer that is too small%s", "");
+    }
+    if(0 != encodeUdpTelemetry(packet, 10, 1, "0123456789", 10)) {
+        testError("Telemetry should not encode into a buffer that is too small%s", "");
+    }
+
+    unsigned int length = encodeUdpTank(packet, sizeof(packet), 1, 0, 1, 1);
+    if(decodeUdpPacket(packet, length - 1).matched) {
+        testError("Truncated tank should not decode%s", "");
+    }
+    if(decodeUdpPacket(packet, length + 1).matched) {
+        testError("Tank with trailing bytes should not decode%s", "");
+    }
+    if(decodeUdpPacket(packet, 3).matched) {
+        testError("Packet shorter than header should not decode%s", "");
+    }
+    if(decodeUdpPacket(nullptr, 0).matched) {
+        testError("Null packet should not decode%s", "");
+    }
+
+    packet[0] = 'X';
+    if(decodeUdpPacket(packet, length).matched) {
+        testError("Packet with wrong magic should not decode%s", "");
+    }
+    packet[0] = UDP_MAGIC;
+    packet[1] = 'Z';
+    if(decodeUdpPacket(packet, length).matched) {
+        testError("Packet with unknown type should not decode%s", "");
+    }
+
+    return testResults("testUdpBadPackets");
+}
+
+/**
+ * Encode and decode a tank packet, then validate it
+ */
+bool validTank(uint8_t flags, float left, float right, float maxSpeed, UdpPacket &decoded) {
+    uint8_t packet[64];
+    const unsigned int length = encodeUdpTank(packet, sizeof(packet), 1, flags, left, right);
+    decoded = decodeUdpPacket(packet, length);
+    return validateUdpCommand(decoded, maxSpeed);
+}
+
+bool validTwist(float linear, float angular) {
+    uint8_t packet[64];
+    const unsigned int length = encodeUdpTwist(packet, sizeof(packet), 1, linear, angular);
+    UdpPacket decoded = decodeUdpPacket(packet, length);
+    return validateUdpCommand(decoded, 0);
+}
+
+int testUdpValidate() {
+    UdpPacket decoded;
+
+    // not a number and infinity are rejected
+    if(validTank(UDP_TANK_SPEED_CONTROL, NAN, 10, 50, decoded)
+        || validTank(UDP_TANK_SPEED_CONTROL, 10, INFINITY, 50, decoded)
+        || validTank(0, NAN, 10, 50, decoded)
+        || validTank(0, 10, -INFINITY, 50, decoded))
+    {
+        testError("Tank with a value that is not finite should be rejected%s", "");
+    }
+    if(validTwist(NAN, 0) || validTwist(0, NAN) || validTwist(INFINITY, 0) || validTwist(0, -INFINITY)) {
+        testError("Twist with a value that is not finite should be rejected%s", "");
+    }
+
+    // negative values and pwm out of range are rejected
+    if(validTank(0, -1, 10, 50, decoded) || validTank(0, 10, 256, 50, decoded)) {
+        testError("Tank with a value out of range should be rejected%s", "");
+    }
+    if(!validTank(0, 255, 0, 50, decoded) || (255 != decoded.values[0])) {
+        testError("Tank with full pwm should be accepted%s", "");
+    }
+
+    // speed is capped at the calibrated maximum
+    if(!validTank(UDP_TANK_SPEED_CONTROL, 1000, 20, 50, decoded)
+        || (50 != decoded.values[0]) || (20 != decoded.values[1]))
+    {
+        testError("Tank speed should be capped at 50, got %f, %f", decoded.values[0], decoded.values[1]);
+    }
+
+    // no calibration; speed is not capped
+    if(!validTank(UDP_TANK_SPEED_CONTROL, 1000, 20, 0, decoded) || (1000 != decoded.values[0])) {
+        testError("Tank speed should not be capped before calibration, got %f", decoded.values[0]);
+    }
+
+    if(!validTwist(-0.2f, 1.5f)) {
+        testError("Finite twist should be accepted%s", "");
+    }
+
+    // halt carries no values; telemetry is not a command
+    uint8_t packet[64];
+    unsigned int length = encodeUdpHalt(packet, sizeof(packet), 1);
+    decoded = decodeUdpPacket(packet, length);
+    if(!validateUdpCommand(decoded, 50)) {
+        testError("Halt should be accepted%s", "");
+    }
+    length = encodeUdpTelemetry(packet, sizeof(packet), 1, "tel()", 5);
+    decoded = decodeUdpPacket(packet, length);
+    if(validateUdpCommand(decoded, 50)) {
+        testError("Telemetry should not be accepted as a command%s", "");
+    }
+    decoded = decodeUdpPacket(packet, 3);
+    if(validateUdpCommand(decoded, 50)) {
+        testError("Unmatched packet should be rejected%s", "");
+    }
+
+    return testResults("testUdpValidate");
+}
+
+int testUdpSequencer() {
+    UdpSequencer sequencer;
+
+    if(!sequencer.accept(100, 0)) {
+        testError("First packet should be accepted%s", "");
+    }
+    if(sequencer.accept(100, 1)) {
+        testError("Duplicate packet should be dropped%s", "");
+    }
+    if(sequencer.accept(99, 2)) {
+        testError("Late packet should be dropped%s", "");
+    }
+    if(!sequencer.accept(103, 3)) {
+        testError("Newer packet should be accepted%s", "");
+    }
+    if(sequencer.accept(102, 4)) {
+        testError("Packet older than newest should be dropped%s", "");
+    }
+    if((2 != sequencer.accepted()) || (3 != sequencer.stale()) || (2 != sequencer.missed())) {
+        testError("Counts should be 2 accepted, 3 stale, 2 missed, not %lu, %lu, %lu",
+            sequencer.accepted(), sequencer.stale(), sequencer.missed());
+    }
+
+    // sequence wraps
+    sequencer.reset();
+    sequencer.accept(0xFFFFFFFEu, 0);
+    if(!sequencer.accept(0xFFFFFFFFu, 1) || !sequencer.accept(0, 2) || !sequencer.accept(1, 3)) {
+        testError("Sequence should be accepted across wrap%s", "");
+    }
+    if(sequencer.accept(0xFFFFFFFFu, 4)) {
+        testError("Packet from before wrap should be dropped%s", "");
+    }
+
+    // sender restarts after going quiet
+    sequencer.reset();
+    sequencer.accept(5000, 1000);
+    if(sequencer.accept(1, 1000 + UDP_SEQUENCE_RESET_MS - 1)) {
+        testError("Low sequence should be dropped while sender is active%s", "");
+    }
+    if(!sequencer.accept(2, 1000 + UDP_SEQUENCE_RESET_MS + 1)) {
+        testError("Low sequence should be accepted after sender was quiet%s", "");
+    }
+    if(!sequencer.accept(3, 1000 + UDP_SEQUENCE_RESET_MS + 2) || sequencer.accept(2, 1000 + UDP_SEQUENCE_RESET_MS + 3)) {
+        testError("Sequencing should continue from restarted sender%s", "");
+    }
+
+    return testResults("testUdpSequencer");
+}
+
+int main() {
+    testUdpEncodeDecode();
+    testUdpBadPackets();
+    testUdpValidate();
+    testUdpSequencer();
+
+    return 0;
+}
@@ -0,0 +1,187 @@
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <vector>
+#include <unistd.h>
+#include <fcntl.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include "../../test.h"
+#include "../../../src/udp/udp_codec.h"
+
+using namespace std;
+
+//
+// Send tank commands over a real udp socket on the
+// loopback interface, dropping and reordering some
+// on the way out, and check the receiver only ever
+// moves forward.  Reports how long it took for the
+// newest command to be applied.
+//
+static const int COMMANDS = 2000;
+static const int LOSS_PERCENT = 20;
+static const int REORDER_PERCENT = 10;
+
+static unsigned long nowUs() {
+    return (unsigned long)chrono::duration_cast<chrono::microseconds>(
+        chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// deterministic so failures repeat
+static uint32_t lcg(uint32_t &state) {
+    state = state * 1664525u + 1013904223u;
+    return state >> 16;
+}
+
+static int openSocket(sockaddr_in &address) {
+    const int fd = socket(AF_INET, SOCK_DGRAM, 0);
+    if(fd < 0) {
+        return fd;
+    }
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = 0;
+    socklen_t size = sizeof(address);
+    if((0 != bind(fd, (sockaddr *)&address, sizeof(address)))
+        || (0 != getsockname(fd, (sockaddr *)&address, &size)))
+    {
+        close(fd);
+        return -1;
+    }
+    fcntl(fd, F_SETFL, O_NONBLOCK);
+    return fd;
+}
+
+typedef struct Receiver {
+    int fd;
+    UdpSequencer sequencer;
+    long applied;                       // sequence last applied, -1 if none
+    bool backwards;                     // true if an older command was ever applied after a newer one
+    vector<unsigned long> appliedUs;    // when each sequence, or a newer one, was first applied
+} Receiver;
+
+static void receive(Receiver &receiver) {
+    uint8_t packet[64];
+    ssize_t length;
+    while((length = recv(receiver.fd, packet, sizeof(packet), 0)) > 0) {
+        const UdpPacket decoded = decodeUdpPacket(packet, (unsigned int)length);
+        if(!decoded.matched || (UDP_TANK != decoded.type)) {
+            continue;
+        }
+        if(!receiver.sequencer.accept(decoded.sequence, nowUs() / 1000)) {
+            continue;
+        }
+        const long sequence = (long)decoded.values[0];
+        if(sequence <= receiver.applied) {
+            receiver.backwards = true;
+        }
+        const unsigned long appliedUs = nowUs();
+        for(long i = receiver.applied + 1; i <= sequence; i += 1) {
+            receiver.appliedUs[i] = appliedUs;
+        }
+        receiver.applied = sequence;
+    }
+}
+
+int testUdpLoopback() {
+    sockaddr_in senderAddress, receiverAddress;
+    const int sender = openSocket(senderAddress);
+    Receiver receiver;
+    receiver.fd = openSocket(receiverAddress);
+    if((sender < 0) || (receiver.fd < 0)) {
+        testError("Could not open loopback sockets%s", "");
+        if(sender >= 0) close(sender);
+        if(receiver.fd >= 0) close(receiver.fd);
+        return testResults("testUdpLoopback");
+    }
+    receiver.applied = -1;
+    receiver.backwards = false;
+    receiver.appliedUs.assign(COMMANDS, 0);
+
+    vector<unsigned long> issuedUs(COMMANDS, 0);
+    uint32_t random = 12345;
+    uint8_t held[64];
+    unsigned int heldLength = 0;
+    int lost = 0;
+    int reordered = 0;
+    for(int i = 0; i < COMMANDS; i += 1) {
+        uint8_t packet[64];
+        const unsigned int length = encodeUdpTank(packet, sizeof(packet), (uint32_t)i,
+            UDP_TANK_SPEED_CONTROL | UDP_TANK_LEFT_FORWARD | UDP_TANK_RIGHT_FORWARD, (float)i, (float)i);
+        issuedUs[i] = nowUs();
+
+        const uint32_t roll = lcg(random) % 100;
+        if(roll < (uint32_t)LOSS_PERCENT) {
+            lost += 1;
+        } else if((roll < (uint32_t)(LOSS_PERCENT + REORDER_PERCENT)) && (0 == heldLength)) {
+            // deliver after the next packet
+            memcpy(held, packet, length);
+            heldLength = length;
+            reordered += 1;
+        } else {
+            sendto(sender, packet, length, 0, (sockaddr *)&receiverAddress, sizeof(receiverAddress));
+            if(heldLength > 0) {
+                sendto(sender, held, heldLength, 0, (sockaddr *)&receiverAddress, sizeof(receiverAddress));
+                heldLength = 0;
+            }
+        }
+
+        receive(receiver);
+        usleep(100);
+    }
+
+    // last command must get through, like a client that keeps sending
+    uint8_t packet[64];
+    const unsigned int length = encodeUdpTank(packet, sizeof(packet), (uint32_t)COMMANDS, 0, (float)(COMMANDS - 1), (float)(COMMANDS - 1));
+    sendto(sender, packet, length, 0, (sockaddr *)&receiverAddress, sizeof(receiverAddress));
+    const unsigned long deadlineUs = nowUs() + 1000000;
+    while((receiver.applied < COMMANDS - 1) && (nowUs() < deadlineUs)) {
+        receive(receiver);
+        usleep(100);
+    }
+    close(sender);
+    close(receiver.fd);
+
+    if(receiver.backwards) {
+        testError("Receiver should never apply an older command after a newer one%s", "");
+    }
+    if(COMMANDS - 1 != receiver.applied) {
+        testError("Receiver should end on the last command, not %ld", receiver.applied);
+    }
+    if(0 == receiver.sequencer.stale()) {
+        testError("Reordered packets should have been dropped as stale%s", "");
+    }
+
+    //
+    // latency from issuing a command until it, or a newer
+    // one, is applied; covers packets that were lost
+    //
+    vector<unsigned long> latencyUs;
+    for(int i = 0; i < COMMANDS; i += 1) {
+        if(receiver.appliedUs[i] >= issuedUs[i]) {
+            latencyUs.push_back(receiver.appliedUs[i] - issuedUs[i]);
+        }
+    }
+    if(latencyUs.size() != (size_t)COMMANDS) {
+        testError("Every command should be superseded, only %d were", (int)latencyUs.size());
+    }
+    if(!latencyUs.empty()) {
+        sort(latencyUs.begin(), latencyUs.end());
+        printf("udp loopback: %d commands, %d lost, %d reordered, %lu stale; latency p50 %luus, p99 %luus, max %luus\n",
+            COMMANDS, lost, reordered, receiver.sequencer.stale(),
+            latencyUs[latencyUs.size() / 2],
+            latencyUs[latencyUs.size() * 99 / 100],
+            latencyUs.back());
+    }
+
+    return testResults("testUdpLoopback");
+}
+
+int main() {
+    testUdpLoopback();
+
+    return 0;
+}
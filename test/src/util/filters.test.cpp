@@ -0,0 +1,238 @@
+#include <math.h>
+#include "../../test.h"
+#include "../../../src/util/filters.h"
+
+using namespace std;
+
+int testExponentialAverage() {
+    ExponentialAverage<float> average(0.5f);
+    if(10 != average.add(10)) {
+        testError("First sample should seed average%s", "");
+    }
+    if(15 != average.add(20)) {
+        testError("Average should move half way, not %f", average.value());
+    }
+    average.reset();
+    if(4 != average.add(4)) {
+        testError("Reset average should seed again%s", "");
+    }
+
+    return testResults("testExponentialAverage");
+}
+
+int testWindowStats() {
+    WindowStats<float, 4> stats;
+    stats.add(2).add(4).add(4).add(4);
+    if((3.5f != stats.mean()) || (0.75f != stats.variance())) {
+        testError("Window 2,4,4,4 should have mean 3.5 and variance 0.75, not %f", stats.variance());
+    }
+
+    // slides; window is now 4,4,4,8 then 4,4,8,10
+    stats.add(8);
+    if(5 != stats.mean()) {
+        testError("Window should drop oldest, mean 5 not %f", stats.mean());
+    }
+    stats.add(10);
+    if((6.5f != stats.mean()) || (fabs(stats.standardDeviation() - sqrt(6.75)) > 1e-5)) {
+        testError("Window 4,4,8,10 should have mean 6.5, not %f", stats.mean());
+    }
+
+    // running sums stay accurate over a long run with a large offset
+    WindowStats<float, 5> drift;
+    for(int i = 0; i < 100000; i += 1) {
+        drift.add(10000.0f + (i % 5));
+    }
+    if((fabs(drift.mean() - 10002.0f) > 1e-3) || (fabs(drift.variance() - 2.0f) > 1e-2)) {
+        testError("Long run should keep mean 10002 and variance 2, not %f", drift.variance());
+    }
+
+    return testResults("testWindowStats");
+}
+
+int testMedianFilter() {
+    MedianFilter<float, 5> median;
+    median.add(1);
+    if(1 != median.value()) {
+        testError("Median of one sample should be that sample%s", "");
+    }
+    median.add(3);
+    if(2 != median.value()) {
+        testError("Median of 1,3 should be 2, not %f", median.value());
+    }
+    median.add(2);
+    median.add(100);
+    median.add(2);
+    if(2 != median.value()) {
+        testError("Median of 1,3,2,100,2 should be 2, not %f", median.value());
+    }
+
+    // spikes shorter than half the window are rejected
+    MedianFilter<float, 5> steady;
+    const float input[] = {5, 5, 5, 5, 90, 5, 5, -80, 5, 5, 90, 90, 5, 5};
+    for(unsigned int i = 0; i < sizeof(input) / sizeof(input[0]); i += 1) {
+        if(5 != steady.add(input[i])) {
+            testError("Spike at sample %u should be rejected", i);
+        }
+    }
+
+    return testResults("testMedianFilter");
+}
+
+int testSavitzkyGolay() {
+    //
+    // slope of a quadratic at the centre of
+    // the window is exact, as is a line
+    //
+    SavitzkyGolayDerivative<double, 7> slope;
+    const double spacing = 0.02;
+    for(int i = 0; i < 7; i += 1) {
+        if(slope.ready()) testError("Window should not be ready after %d samples", i);
+        const double t = i * spacing;
+        slope.add(3 * t * t + 2 * t + 1);
+    }
+    // centre is sample 3
+    double expected = 6 * (3 * spacing) + 2;
+    if(fabs(slope.derivative(spacing) - expected) > 1e-9) {
+        testError("Slope of quadratic should be %f", expected);
+    }
+
+    // keep sliding; running sums stay exact
+    for(int i = 7; i < 1000; i += 1) {
+        const double t = i * spacing;
+        slope.add(3 * t * t + 2 * t + 1);
+    }
+    expected = 6 * (996 * spacing) + 2;
+    if(fabs(slope.derivative(spacing) - expected) > 1e-6) {
+        testError("Slope after sliding should be %f, not %f", expected, slope.derivative(spacing));
+    }
+
+    return testResults("testSavitzkyGolay");
+}
+
+//
+// deterministic noise so failures repeat
+//
+static uint32_t noiseState = 1;
+static double noise() {
+    // sum of uniforms is close enough to gaussian; unit variance
+    double sum = 0;
+    for(int i = 0; i < 12; i += 1) {
+        noiseState = noiseState * 1664525u + 1013904223u;
+        sum += (noiseState >> 8) / 16777216.0;
+    }
+    return sum - 6;
+}
+
+typedef struct FilterScore {
+    double rmsError;    // once settled
+    int lag;            // samples after step to reach 90%
+} FilterScore;
+
+//
+// step from 0 to 10 with unit noise; score a filter
+//
+template <class F> FilterScore scoreFilter(F filter) {
+    static const int STEP_AT = 100;
+    static const int SAMPLES = 400;
+    noiseState = 1;
+    FilterScore score = {0, -1};
+    double sumOfSquares = 0;
+    int settled = 0;
+    for(int i = 0; i < SAMPLES; i += 1) {
+        const double truth = (i < STEP_AT) ? 0 : 10;
+        const double output = filter(truth + noise());
+        if((i >= STEP_AT) && (score.lag < 0) && (output >= 9)) {
+            score.lag = i - STEP_AT;
+        }
+        if(i >= STEP_AT + 50) {
+            sumOfSquares += (output - truth) * (output - truth);
+            settled += 1;
+        }
+    }
+    score.rmsError = sqrt(sumOfSquares / settled);
+    return score;
+}
+
+int testNoiseAgainstLag() {
+    ExponentialAverage<double> average(0.25);
+    WindowStats<double, 8> mean;
+    MedianFilter<double, 7> median;
+
+    const FilterScore raw = scoreFilter([](double x) { return x; });
+    const FilterScore averageScore = scoreFilter([&average](double x) { return average.add(x); });
+    const FilterScore meanScore = scoreFilter([&mean](double x) { return mean.add(x).mean(); });
+    const FilterScore medianScore = scoreFilter([&median](double x) { return median.add(x); });
+
+    printf("filter noise against lag, unit noise on a step of 10:\n");
+    printf("  raw      rms %.3f lag %d\n", raw.rmsError, raw.lag);
+    printf("  average  rms %.3f lag %d\n", averageScore.rmsError, averageScore.lag);
+    printf("  mean     rms %.3f lag %d\n", meanScore.rmsError, meanScore.lag);
+    printf("  median   rms %.3f lag %d\n", medianScore.rmsError, medianScore.lag);
+
+    if((raw.rmsError < 0.8) || (raw.rmsError > 1.2)) {
+        testError("Raw rms error should be about 1, not %f", raw.rmsError);
+    }
+    // variance of a mean of 8 is 1/8; of an ema with alpha 0.25 is 1/7
+    if(meanScore.rmsError > 0.45) {
+        testError("Mean of 8 should cut noise to about 0.35, not %f", meanScore.rmsError);
+    }
+    if(averageScore.rmsError > 0.5) {
+        testError("Average should cut noise to about 0.38, not %f", averageScore.rmsError);
+    }
+    if(medianScore.rmsError > 0.6) {
+        testError("Median of 7 should cut noise to about 0.45, not %f", medianScore.rmsError);
+    }
+    // the price is lag, but bounded by the window
+    if((meanScore.lag < 0) || (meanScore.lag > 8) || (medianScore.lag < 0) || (medianScore.lag > 7) || (averageScore.lag < 0) || (averageScore.lag > 12)) {
+        testError("Filters should follow the step within their window%s", "");
+    }
+
+    return testResults("testNoiseAgainstLag");
+}
+
+int testDerivativeNoise() {
+    //
+    // slope of a noisy ramp; compare two-sample
+    // difference with savitzky-golay over 7 samples
+    //
+    SavitzkyGolayDerivative<double, 7> slope;
+    const double spacing = 0.02;
+    const double rate = 30;     // units per second
+    noiseState = 7;
+    double previous = 0;
+    double differenceSquares = 0;
+    double slopeSquares = 0;
+    int n = 0;
+    for(int i = 0; i < 500; i += 1) {
+        const double sample = rate * i * spacing + 0.1 * noise();
+        slope.add(sample);
+        if(i >= 10) {
+            const double difference = (sample - previous) / spacing;
+            differenceSquares += (difference - rate) * (difference - rate);
+            slopeSquares += (slope.derivative(spacing) - rate) * (slope.derivative(spacing) - rate);
+            n += 1;
+        }
+        previous = sample;
+    }
+    const double differenceRms = sqrt(differenceSquares / n);
+    const double slopeRms = sqrt(slopeSquares / n);
+    printf("derivative rms error on noisy ramp: difference %.3f, savitzky-golay %.3f\n", differenceRms, slopeRms);
+
+    // noise gain is sqrt(2) for the difference, sqrt(1/28) for 7 point savitzky-golay
+    if(slopeRms * 5 > differenceRms) {
+        testError("Savitzky-Golay should be far less noisy than a difference, %f against %f", slopeRms, differenceRms);
+    }
+
+    return testResults("testDerivativeNoise");
+}
+
+int main() {
+    testExponentialAverage();
+    testWindowStats();
+    testMedianFilter();
+    testSavitzkyGolay();
+    testNoiseAgainstLag();
+    testDerivativeNoise();
+
+    return 0;
+}
@@ -0,0 +1,270 @@
+#include <thread>
+#include "../../test.h"
+#include "../../../src/util/latest_value.h"
+#include "../../../src/util/spsc_queue.h"
+#include "../../../src/util/mpsc_queue.h"
+
+using namespace std;
+
+//
+// a value whose fields are written separately,
+// so a torn read would show mismatched fields.
+//
+typedef struct Pair {
+    unsigned int a;
+    unsigned int b;
+} Pair;
+
+int testLatestValue() {
+    LatestValue<Pair> slot;
+    Pair value = {0, 0};
+
+    if(slot.take(value)) {
+        testError("Empty slot should have nothing to take%s", "");
+    }
+
+    slot.write({1, 1});
+    slot.write({2, 2});
+    slot.write({3, 3});
+    if(!slot.fresh()) {
+        testError("Slot should be fresh after write%s", "");
+    }
+    if(!slot.take(value) || (3 != value.a)) {
+        testError("Slot should hold newest value 3, got %u", value.a);
+    }
+    if(slot.take(value)) {
+        testError("Value should only be taken once%s", "");
+    }
+
+    return testResults("testLatestValue");
+}
+
+int testLatestValueThreaded() {
+    static const unsigned int WRITES = 200000;
+    LatestValue<Pair> slot;
+
+    thread writer([&slot]() {
+        for(unsigned int i = 1; i <= WRITES; i += 1) {
+            slot.write({i, ~i});
+            if(0 == (i & 0x3F)) this_thread::yield();   // interleave on a single core host
+        }
+    });
+
+    //
+    // reader must never see a torn value and
+    // must never see values go backwards.
+    //
+    unsigned int last = 0;
+    unsigned int takes = 0;
+    unsigned int torn = 0;
+    unsigned int backwards = 0;
+    while(last < WRITES) {
+        Pair value;
+        if(slot.take(value)) {
+            takes += 1;
+            if(value.b != ~value.a) torn += 1;
+            if(value.a <= last) backwards += 1;
+            last = value.a;
+        } else {
+            this_thread::yield();   // let writer run on a single core host
+        }
+    }
+    writer.join();
+
+    if(torn > 0) {
+        testError("Reader saw %u torn values", torn);
+    }
+    if(backwards > 0) {
+        testError("Reader saw %u stale values", backwards);
+    }
+    printf("LatestValue: %u writes, %u takes\n", WRITES, takes);
+
+    return testResults("testLatestValueThreaded");
+}
+
+int testSpscQueue() {
+    SpscQueue<int, 4> queue;
+    int value = 0;
+
+    if(queue.pop(value) || !queue.empty()) {
+        testError("New queue should be empty%s", "");
+    }
+    for(int i = 0; i < 4; i += 1) {
+        if(!queue.push(i)) {
+            testError("Push %d should fit", i);
+        }
+    }
+    if(queue.push(4)) {
+        testError("Push onto full queue should fail%s", "");
+    }
+    if(4 != queue.count()) {
+        testError("Full queue should have 4 values, got %u", queue.count());
+    }
+    for(int i = 0; i < 4; i += 1) {
+        if(!queue.pop(value) || (i != value)) {
+            testError("Pop should return %d in order", i);
+        }
+    }
+    if(queue.pop(value)) {
+        testError("Drained queue should be empty%s", "");
+    }
+
+    // wrap around many times
+    for(int i = 0; i < 100; i += 1) {
+        queue.push(i);
+        queue.push(i + 1000);
+        queue.pop(value);
+        if(i != value) {
+            testError("Wrapped pop should return %d", i);
+            break;
+        }
+        queue.pop(value);
+    }
+
+    return testResults("testSpscQueue");
+}
+
+int testSpscQueueThreaded() {
+    static const unsigned int VALUES = 200000;
+    SpscQueue<Pair, 8> queue;
+
+    thread producer([&queue]() {
+        for(unsigned int i = 1; i <= VALUES; ) {
+            if(queue.push({i, ~i})) {
+                i += 1;
+            } else {
+                this_thread::yield();
+            }
+        }
+    });
+
+    //
+    // consumer must see every value, in order, untorn.
+    //
+    unsigned int expected = 1;
+    unsigned int errors = 0;
+    while(expected <= VALUES) {
+        Pair value;
+        if(queue.pop(value)) {
+            if((value.a != expected) || (value.b != ~value.a)) {
+                errors += 1;
+            }
+            expected = value.a + 1;
+        } else {
+            this_thread::yield();
+        }
+    }
+    producer.join();
+
+    if(errors > 0) {
+        testError("Consumer saw %u out of order or torn values", errors);
+    }
+
+    return testResults("testSpscQueueThreaded");
+}
+
+int testMpscQueue() {
+    MpscQueue<int, 4> queue;
+    int value = 0;
+
+    if(queue.pop(value) || !queue.empty()) {
+        testError("New queue should be empty%s", "");
+    }
+    for(int i = 0; i < 4; i += 1) {
+        if(!queue.push(i)) {
+            testError("Push %d should fit", i);
+        }
+    }
+    if(queue.push(4)) {
+        testError("Push onto full queue should fail%s", "");
+    }
+    for(int i = 0; i < 4; i += 1) {
+        if(!queue.pop(value) || (i != value)) {
+            testError("Pop should return %d in order", i);
+        }
+    }
+    if(queue.pop(value)) {
+        testError("Drained queue should be empty%s", "");
+    }
+
+    // wrap around many times
+    for(int i = 0; i < 100; i += 1) {
+        queue.push(i);
+        queue.push(i + 1000);
+        queue.pop(value);
+        if(i != value) {
+            testError("Wrapped pop should return %d", i);
+            break;
+        }
+        queue.pop(value);
+    }
+
+    return testResults("testMpscQueue");
+}
+
+int testMpscQueueThreaded() {
+    static const unsigned int PRODUCERS = 4;
+    static const unsigned int VALUES = 50000;   // per producer
+    MpscQueue<Pair, 8> queue;
+
+    //
+    // each producer sends its own sequence;
+    // a = producer, b = sequence number
+    //
+    thread producers[PRODUCERS];
+    for(unsigned int p = 0; p < PRODUCERS; p += 1) {
+        producers[p] = thread([&queue, p]() {
+            for(unsigned int i = 1; i <= VALUES; ) {
+                if(queue.push({p, i})) {
+                    i += 1;
+                } else {
+                    this_thread::yield();
+                }
+            }
+        });
+    }
+
+    //
+    // consumer must see every value once, and
+    // each producer's values in the order pushed.
+    //
+    unsigned int expected[PRODUCERS] = {1, 1, 1, 1};
+    unsigned int received = 0;
+    unsigned int errors = 0;
+    while(received < PRODUCERS * VALUES) {
+        Pair value;
+        if(queue.pop(value)) {
+            if((value.a >= PRODUCERS) || (value.b != expected[value.a])) {
+                errors += 1;
+            } else {
+                expected[value.a] += 1;
+            }
+            received += 1;
+        } else {
+            this_thread::yield();
+        }
+    }
+    for(unsigned int p = 0; p < PRODUCERS; p += 1) {
+        producers[p].join();
+    }
+
+    if(errors > 0) {
+        testError("Consumer saw %u lost, repeated or out of order values", errors);
+    }
+    if(!queue.empty()) {
+        testError("Queue should be empty once all values are received, has %u", queue.count());
+    }
+
+    return testResults("testMpscQueueThreaded");
+}
+
+int main() {
+    testLatestValue();
+    testLatestValueThreaded();
+    testSpscQueue();
+    testSpscQueueThreaded();
+    testMpscQueue();
+    testMpscQueueThreaded();
+
+    return 0;
+}
@@ -0,0 +1,184 @@
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <string>
+#include "../../test.h"
+#include "../../../src/util/ring.h"
+#include "../../../src/util/circular_buffer.h"
+
+using namespace std;
+
+//
+// value that counts live instances and
+// has no default constructor
+//
+static int liveValues = 0;
+class Tracked {
+    public:
+    int value;
+    string label;
+    Tracked(int v) : value(v), label(to_string(v)) { liveValues += 1; }
+    Tracked(const Tracked &other) : value(other.value), label(other.label) { liveValues += 1; }
+    Tracked& operator=(const Tracked &other) { value = other.value; label = other.label; return *this; }
+    ~Tracked() { liveValues -= 1; }
+};
+
+int testRing() {
+    Ring<int, 4> ring(-1);
+    static_assert(4 == Ring<int, 4>::capacity(), "capacity should be constexpr");
+
+    if(!ring.empty() || (-1 != ring.head()) || (-1 != ring.tail()) || (-1 != ring.get(0))) {
+        testError("Empty ring should return default value%s", "");
+    }
+
+    ring.push(1).push(2).push(3);
+    if((3 != ring.count()) || (1 != ring.available()) || (3 != ring.head()) || (1 != ring.tail()) || (2 != ring.get(1))) {
+        testError("Ring should hold 1, 2, 3%s", "");
+    }
+
+    // wraps and drops tail
+    ring.push(4).push(5).push(6);
+    if(!ring.full() || (6 != ring.head()) || (3 != ring.tail()) || (-1 != ring.get(4))) {
+        testError("Full ring should drop oldest; tail %d, head %d", ring.tail(), ring.head());
+    }
+    for(unsigned int i = 0; i < 4; i += 1) {
+        if((int)(3 + i) != ring.get(i)) {
+            testError("Ring get(%u) should be in push order", i);
+        }
+    }
+
+    if(!ring.set(1, 40) || (40 != ring.get(1)) || ring.set(4, 99)) {
+        testError("Ring set should change value in range only%s", "");
+    }
+
+    int value = 0;
+    if(!ring.pop(value) || (6 != value) || !ring.dequeue(value) || (3 != value) || (2 != ring.count())) {
+        testError("Ring pop should take head and dequeue should take tail%s", "");
+    }
+
+    // truncate keeps the most recent values
+    ring.push(7).push(8);
+    ring.truncateTo(1);
+    if((1 != ring.count()) || (8 != ring.head()) || (8 != ring.tail())) {
+        testError("truncateTo(1) should keep only head, not %d", ring.tail());
+    }
+    ring.truncateTo(0);
+    if(!ring.empty() || ring.pop(value) || ring.dequeue(value)) {
+        testError("truncateTo(0) should empty ring%s", "");
+    }
+
+    return testResults("testRing");
+}
+
+int testRingLifetime() {
+    {
+        Ring<Tracked, 2> ring(Tracked(0));
+        const int base = liveValues;    // the default value
+        ring.push(Tracked(1));
+        ring.push(Tracked(2));
+        ring.push(Tracked(3));
+        if(base + 2 != liveValues) {
+            testError("Full ring of 2 should hold 2 live values, not %d", liveValues - base);
+        }
+        if(("3" != ring.head().label) || ("2" != ring.tail().label)) {
+            testError("Non-POD values should be copied intact%s", "");
+        }
+        Tracked popped(0);
+        ring.pop(popped);
+        if((base + 1 + 1 != liveValues) || (3 != popped.value)) {
+            testError("Pop should destroy slot value%s", "");
+        }
+        ring.clear();
+        if(base + 1 != liveValues) {
+            testError("Clear should destroy all values%s", "");
+        }
+        ring.push(Tracked(4));
+    }
+    if(0 != liveValues) {
+        testError("Destructor should destroy remaining values, %d live", liveValues);
+    }
+
+    return testResults("testRingLifetime");
+}
+
+int testCircularBuffer() {
+    int defaultValue = -1;
+    int storage[4];
+    CircularBuffer<int> buffer(storage, 4, defaultValue);
+    for(int i = 1; i <= 6; i += 1) {
+        buffer.push(i);
+    }
+    if((6 != buffer.head()) || (3 != buffer.tail())) {
+        testError("CircularBuffer should hold 3 to 6%s", "");
+    }
+    int value = 50;
+    buffer.set(1, value);
+    if(50 != buffer.get(1)) {
+        testError("CircularBuffer set should change value%s", "");
+    }
+    buffer.truncateTo(1);
+    if((1 != buffer.count()) || (6 != buffer.head()) || (6 != buffer.tail())) {
+        testError("CircularBuffer truncateTo(1) should keep only head, not %d", buffer.tail());
+    }
+
+    // owned buffer of non-POD values
+    {
+        string none("none");
+        CircularBuffer<string> strings(3, none);
+        string hello("hello");
+        strings.push(hello);
+        if(("hello" != strings.head()) || ("none" != strings.get(1))) {
+            testError("CircularBuffer should hold strings%s", "");
+        }
+    }
+
+    return testResults("testCircularBuffer");
+}
+
+//
+// push and read back through the history the
+// way DriveWheel does, comparing the runtime
+// capacity buffer with the compile-time ring
+//
+int benchmarkRing() {
+    static const int ITERATIONS = 20000000;
+
+    // capacity is only known at runtime, as it is for DriveWheel
+    volatile unsigned int capacity = 4;
+    float defaultValue = 0;
+    float storage[4];
+    CircularBuffer<float> buffer(storage, capacity, defaultValue);
+    Ring<float, 4> ring(0);
+
+    volatile float sink = 0;
+    clock_t start = clock();
+    for(int i = 0; i < ITERATIONS; i += 1) {
+        float value = (float)i;
+        buffer.push(value);
+        sink = sink + buffer.head() - buffer.tail() + buffer.get(i & 3);
+    }
+    const double bufferNs = 1e9 * (clock() - start) / CLOCKS_PER_SEC / ITERATIONS;
+
+    start = clock();
+    for(int i = 0; i < ITERATIONS; i += 1) {
+        ring.push((float)i);
+        sink = sink + ring.head() - ring.tail() + ring.get(i & 3);
+    }
+    const double ringNs = 1e9 * (clock() - start) / CLOCKS_PER_SEC / ITERATIONS;
+
+    printf("ring benchmark: push + head/tail/get, CircularBuffer %.2f ns/op, Ring %.2f ns/op (%.1fx)\n",
+        bufferNs, ringNs, (ringNs > 0) ? bufferNs / ringNs : 0.0);
+    return 0;
+}
+
+int main() {
+    // from test folder run:
+    // gcc -DTESTING -std=c++11 -O2 -lstdc++ test.cpp src/util/ring.test.cpp; ./a.out; rm a.out
+
+    testRing();
+    testRingLifetime();
+    testCircularBuffer();
+    benchmarkRing();
+
+    return 0;
+}
@@ -0,0 +1,117 @@
+#include <string.h>
+
+#include "../../test.h"
+#include "../../../src/websockets/mux.h"
+
+using namespace std;
+
+int testMuxDecode() {
+    const uint8_t command[] = {MUX_COMMAND, 'c', 'm', 'd'};
+    MuxDecodeResult decoded = muxDecode(command, sizeof(command));
+    if(!decoded.matched || (MUX_COMMAND != decoded.channel)
+        || (3 != decoded.length) || (0 != memcmp("cmd", decoded.payload, 3)))
+    {
+        testError("Command frame should decode%s", "");
+    }
+
+    const uint8_t empty[] = {MUX_BINARY_COMMAND};
+    decoded = muxDecode(empty, sizeof(empty));
+    if(!decoded.matched || (0 != decoded.length)) {
+        testError("Frame with empty payload should decode%s", "");
+    }
+
+    const uint8_t unknown[] = {0, 'x'};
+    const uint8_t beyond[] = {MUX_CHANNEL_LIMIT, 'x'};
+    if(muxDecode(unknown, sizeof(unknown)).matched
+        || muxDecode(beyond, sizeof(beyond)).matched
+        || muxDecode(command, 0).matched
+        || muxDecode(nullptr, 4).matched)
+    {
+        testError("Bad frames should not decode%s", "");
+    }
+
+    return testResults("testMuxDecode");
+}
+
+int testMuxVideoHeader() {
+    uint8_t header[MUX_VIDEO_HEADER_BYTES];
+
+    muxVideoHeader(header, 0, 100, 100);
+    if((MUX_VIDEO != header[0]) || ((MUX_VIDEO_FIRST | MUX_VIDEO_LAST) != header[1])) {
+        testError("Single chunk should be first and last%s", "");
+    }
+    muxVideoHeader(header, 0, 4096, 10000);
+    if(MUX_VIDEO_FIRST != header[1]) {
+        testError("First chunk should only be first%s", "");
+    }
+    muxVideoHeader(header, 4096, 4096, 10000);
+    if(0 != header[1]) {
+        testError("Middle chunk should have no flags%s", "");
+    }
+    muxVideoHeader(header, 8192, 1808, 10000);
+    if(MUX_VIDEO_LAST != header[1]) {
+        testError("Last chunk should only be last%s", "");
+    }
+
+    return testResults("testMuxVideoHeader");
+}
+
+int testMuxOutboxPriority() {
+    MuxOutbox outbox;
+    if(!outbox.empty()) {
+        testError("New outbox should be empty%s", "");
+    }
+
+    //
+    // telemetry queued first still goes out after command acks
+    //
+    outbox.push(MUX_TELEMETRY, (const uint8_t *)"tel1", 4);
+    outbox.push(MUX_TELEMETRY, (const uint8_t *)"tel2", 4);
+    outbox.push(MUX_BINARY_COMMAND, (const uint8_t *)"\x01\x00\x07", 3);
+    outbox.push(MUX_COMMAND, (const uint8_t *)"ack1", 4);
+    outbox.push(MUX_COMMAND, (const uint8_t *)"ack2", 4);
+
+    const char *expected[] = {"\x01" "ack1", "\x01" "ack2", "\x02\x01\x00\x07", "\x03" "tel1", "\x03" "tel2"};
+    const unsigned int lengths[] = {5, 5, 4, 5, 5};
+    MuxFrame frame;
+    for(int i = 0; i < 5; i += 1) {
+        if(!outbox.pop(frame) || (lengths[i] != frame.length) || (0 != memcmp(expected[i], frame.bytes, frame.length))) {
+            testError("Frame %d is out of priority order", i);
+        }
+    }
+    if(outbox.pop(frame) || !outbox.empty()) {
+        testError("Outbox should be empty after popping all frames%s", "");
+    }
+
+    //
+    // full channel, oversize payload and video are refused
+    //
+    uint8_t payload[MUX_PAYLOAD_BYTES + 1] = {0};
+    for(unsigned int i = 0; i < MUX_OUTBOX_FRAMES; i += 1) {
+        if(!outbox.push(MUX_TELEMETRY, payload, MUX_PAYLOAD_BYTES)) {
+            testError("Telemetry %u should fit", i);
+        }
+    }
+    if(outbox.push(MUX_TELEMETRY, payload, 1)) {
+        testError("Full channel should refuse frame%s", "");
+    }
+    if(!outbox.push(MUX_COMMAND, payload, 1)) {
+        testError("Full telemetry should not block commands%s", "");
+    }
+    if(outbox.push(MUX_COMMAND, payload, sizeof(payload)) || outbox.push(MUX_VIDEO, payload, 1)) {
+        testError("Oversize and video frames should be refused%s", "");
+    }
+    if(3 != outbox.dropped()) {
+        testError("Three frames should be dropped, not %u", outbox.dropped());
+    }
+
+    return testResults("testMuxOutboxPriority");
+}
+
+int main() {
+    testMuxDecode();
+    testMuxVideoHeader();
+    testMuxOutboxPriority();
+
+    return 0;
+}
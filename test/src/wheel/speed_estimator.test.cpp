@@ -0,0 +1,123 @@
+#include <math.h>
+#include "../../test.h"
+#include "../../../src/wheel/speed_estimator.h"
+
+using namespace std;
+
+int testSpeedDifference() {
+    SpeedEstimator estimator(SPEED_DIFFERENCE);
+
+    if(0 != estimator.add(1000, 10)) {
+        testError("First sample should have no speed%s", "");
+    }
+    // difference across the history, head against tail
+    speed_type speed = estimator.add(1100, 13);
+    if(fabs(speed - 30) > 1e-4) {
+        testError("Speed should be 30, not %f", speed);
+    }
+    speed = estimator.add(1200, 15);
+    if(fabs(speed - 25) > 1e-4) {
+        testError("Speed across history should be 25, not %f", speed);
+    }
+    if((1200 != estimator.lastMs()) || (15 != estimator.lastDistance()) || (25 != estimator.speed())) {
+        testError("Estimator should keep last sample%s", "");
+    }
+
+    // a sample at the same time as the tail has no speed
+    estimator.restart();
+    if((1 != estimator.count()) || (0 != estimator.add(1200, 16))) {
+        testError("Restart should keep only the head%s", "");
+    }
+
+    estimator.reset();
+    if((0 != estimator.count()) || (0 != estimator.speed()) || (0 != estimator.lastMs())) {
+        testError("Reset should forget all samples%s", "");
+    }
+
+    estimator.setFilter(NUMBER_OF_SPEED_FILTERS);
+    if(SPEED_DIFFERENCE != estimator.filter()) {
+        testError("Invalid filter should be ignored%s", "");
+    }
+    estimator.setFilter(SPEED_MEDIAN);
+    if(SPEED_MEDIAN != estimator.filter()) {
+        testError("Filter should change to %s", SpeedFilterStr[SPEED_MEDIAN]);
+    }
+
+    return testResults("testSpeedDifference");
+}
+
+//
+// deterministic jitter and glitches so failures repeat
+//
+static uint32_t randomState = 1;
+static unsigned int randomBelow(unsigned int n) {
+    randomState = randomState * 1664525u + 1013904223u;
+    return (randomState >> 8) % n;
+}
+
+typedef struct SpeedScore {
+    double rmsError;    // once settled
+    int lagMs;          // after step until within 10%
+} SpeedScore;
+
+//
+// simulate an encoder with coarse ticks, jittered
+// polling and the odd missed tick, stepping from
+// 0 to 30 cm/s; score the selected filter
+//
+SpeedScore scoreEstimator(SpeedFilter filter) {
+    static const unsigned long STEP_MS = 1000;
+    static const double TICK_CM = 0.55;     // about one encoder pulse on a 7cm wheel
+    static const double SPEED = 30;
+
+    randomState = 1;
+    SpeedEstimator estimator(filter);
+    SpeedScore score = {0, -1};
+    double sumOfSquares = 0;
+    int settled = 0;
+    unsigned long ms = 0;
+    while(ms < 4000) {
+        ms += CONTROL_POLL_MS - 5 + randomBelow(11);
+        const double truth = (ms < STEP_MS) ? 0 : SPEED * (ms - STEP_MS) / 1000.0;
+        double ticks = floor(truth / TICK_CM);
+        if(0 == randomBelow(25)) ticks -= 1;    // glitch; an edge seen late
+        const speed_type speed = estimator.add(ms, ticks * TICK_CM);
+
+        if((ms >= STEP_MS) && (score.lagMs < 0) && (fabs(speed - SPEED) < SPEED / 10)) {
+            score.lagMs = ms - STEP_MS;
+        }
+        if(ms >= STEP_MS + 1000) {
+            sumOfSquares += (speed - SPEED) * (speed - SPEED);
+            settled += 1;
+        }
+    }
+    score.rmsError = sqrt(sumOfSquares / settled);
+    return score;
+}
+
+int testSpeedFilters() {
+    SpeedScore scores[NUMBER_OF_SPEED_FILTERS];
+    printf("wheel speed noise against lag, 30 cm/s step, %u ms polling:\n", CONTROL_POLL_MS);
+    for(int i = 0; i < NUMBER_OF_SPEED_FILTERS; i += 1) {
+        scores[i] = scoreEstimator((SpeedFilter)i);
+        printf("  %-14s rms %6.3f cm/s lag %4d ms\n", SpeedFilterStr[i], scores[i].rmsError, scores[i].lagMs);
+    }
+
+    for(int i = 0; i < NUMBER_OF_SPEED_FILTERS; i += 1) {
+        if((scores[i].lagMs < 0) || (scores[i].lagMs > 500)) {
+            testError("%s should follow the step within 500ms", SpeedFilterStr[i]);
+        }
+        if((SPEED_DIFFERENCE != i) && (scores[i].rmsError >= scores[SPEED_DIFFERENCE].rmsError)) {
+            testError("%s should be less noisy than difference", SpeedFilterStr[i]);
+        }
+    }
+
+    return testResults("testSpeedFilters");
+}
+
+int main() {
+    testSpeedDifference();
+    testSpeedFilters();
+
+    return 0;
+}
@@ -0,0 +1,185 @@
+#include <string.h>
+
+#include "../../test.h"
+#include "../../../src/wifi/wifi_manager.h"
+#include "../../../src/config.h"
+#include "../../../src/error.h"
+
+using namespace std;
+
+//
+// radio that joins when the test says so
+//
+class FakeRadio : public WifiRadio {
+    public:
+    bool apUp = true;           // access point is reachable
+    int32_t apChannel = 6;      // channel access point is on
+    unsigned long joinMs = 100; // time a join takes
+
+    bool joining = false;
+    bool isConnected = false;
+    unsigned long beganMs = 0;
+    int begins = 0;
+    int fastBegins = 0;         // begins with a cached bssid and channel
+    const WifiStaticIp *staticIp = nullptr;
+    unsigned long now = 0;
+
+    virtual void init(const WifiStaticIp *ip) { staticIp = ip; }
+    virtual void begin(const char *ssid, const char *password, int32_t channel, const uint8_t *bssid) {
+        begins += 1;
+        if((0 != channel) && (nullptr != bssid)) fastBegins += 1;
+        // a join on the wrong channel never completes
+        joining = (0 == channel) || (channel == apChannel);
+        beganMs = now;
+    }
+    virtual void disconnect() { joining = false; isConnected = false; }
+    virtual bool connected() {
+        if(joining && apUp && (now - beganMs >= joinMs)) {
+            joining = false;
+            isConnected = true;
+        }
+        return isConnected && apUp;
+    }
+    virtual int32_t channel() { return apChannel; }
+    virtual bool bssid(uint8_t *bssid) {
+        if(!isConnected) return false;
+        memset(bssid, 0xAB, WIFI_BSSID_BYTES);
+        return true;
+    }
+};
+
+//
+// record published wifi states
+//
+class StateListener : public Subscriber {
+    public:
+    int disconnects = 0;
+    int connects = 0;
+
+    virtual void onMessage(Publisher &publisher, Message message, Specifier specifier, const char *data) {
+        if(WIFI_STATE != message) return;
+        if(0 == strcmp(data, WifiStateStr[WIFI_DISCONNECTED])) disconnects += 1;
+        if(0 == strcmp(data, WifiStateStr[WIFI_CONNECTED])) connects += 1;
+    }
+};
+
+MessageBus messageBus;
+
+unsigned long runUntil(WifiManager &manager, FakeRadio &radio, WifiState state, unsigned long limitMs) {
+    while(radio.now < limitMs) {
+        manager.poll(radio.now);
+        if(state == manager.state()) break;
+        radio.now += 10;
+    }
+    return radio.now;
+}
+
+int testWifiJoinAndRejoin() {
+    FakeRadio radio;
+    WifiManager manager;
+    StateListener listener;
+    listener.subscribe(messageBus, WIFI_STATE);
+
+    const WifiStaticIp ip = {{192, 168, 1, 50}, {192, 168, 1, 1}, {255, 255, 255, 0}, {192, 168, 1, 1}};
+    if(SUCCESS == manager.begin("ssid", "password", &ip, 0)) {
+        testError("Detached manager should not begin%s", "");
+    }
+    manager.attach(radio, messageBus).begin("ssid", "password", &ip, 0);
+    if(&ip != radio.staticIp) {
+        testError("Static ip should be passed to radio%s", "");
+    }
+    if((WIFI_CONNECTING != manager.state()) || (1 != radio.begins) || (0 != radio.fastBegins)) {
+        testError("First join should scan all channels%s", "");
+    }
+    runUntil(manager, radio, WIFI_CONNECTED, 1000);
+    if(!manager.connected() || (1 != listener.connects)) {
+        testError("Manager should connect%s", "");
+    }
+
+    //
+    // access point reboots; rover hears about it and
+    // the rejoin goes straight to the cached channel
+    //
+    radio.apUp = false;
+    radio.now += 10;
+    manager.poll(radio.now);
+    if(1 != listener.disconnects) {
+        testError("Dropped connection should publish DISCONNECTED%s", "");
+    }
+    const unsigned long lostMs = radio.now;
+    radio.now += 500;
+    radio.apUp = true;
+    runUntil(manager, radio, WIFI_CONNECTED, radio.now + 5000);
+    if(!manager.connected() || (1 != radio.fastBegins)) {
+        testError("Rejoin should use cached bssid and channel, fast begins = %d", radio.fastBegins);
+    }
+    if((1 != manager.reconnects()) || (manager.lastOutageMs() != radio.now - lostMs)) {
+        testError("Outage should be measured, not %lu", manager.lastOutageMs());
+    }
+
+    //
+    // access point moves channel; fast rejoin times
+    // out and the next join scans all channels
+    //
+    radio.apUp = false;
+    radio.now += 10;
+    manager.poll(radio.now);
+    radio.apUp = true;
+    radio.apChannel = 11;
+    const int begins = radio.begins;
+    runUntil(manager, radio, WIFI_CONNECTED, radio.now + WIFI_REJOIN_TIMEOUT_MS + 1000);
+    if(!manager.connected() || (begins + 2 != radio.begins)) {
+        testError("Failed fast rejoin should fall back to a scan, begins = %d", radio.begins - begins);
+    }
+
+    listener.unsubscribe(messageBus, WIFI_STATE);
+    return testResults("testWifiJoinAndRejoin");
+}
+
+int testWifiBackoff() {
+    FakeRadio radio;
+    WifiManager manager;
+    radio.apUp = false;
+    manager.attach(radio, messageBus).begin("ssid", "password", nullptr, 0);
+
+    //
+    // each failed join waits twice as long, up to the max
+    //
+    unsigned long expectedBackoff = WIFI_BACKOFF_MIN_MS;
+    unsigned long lastBeganMs = 0;  // begin() started first join
+    int failures = 1;
+    while(radio.now < 600000) {
+        const int begins = radio.begins;
+        manager.poll(radio.now);
+        if(radio.begins != begins) {
+            const unsigned long waitedMs = radio.now - lastBeganMs - WIFI_JOIN_TIMEOUT_MS;
+            if(waitedMs != expectedBackoff) {
+                testError("Retry %d should wait %lu, not %lu", failures, expectedBackoff, waitedMs);
+                break;
+            }
+            expectedBackoff = bound<unsigned long>(expectedBackoff * 2, WIFI_BACKOFF_MIN_MS, WIFI_BACKOFF_MAX_MS);
+            lastBeganMs = radio.now;
+            failures += 1;
+        }
+        radio.now += 10;
+    }
+    if(WIFI_BACKOFF_MAX_MS != manager.backoffMs()) {
+        testError("Backoff should stop at max, not %lu", manager.backoffMs());
+    }
+
+    // once joined, backoff starts over
+    radio.apUp = true;
+    runUntil(manager, radio, WIFI_CONNECTED, radio.now + WIFI_BACKOFF_MAX_MS + WIFI_JOIN_TIMEOUT_MS);
+    if(!manager.connected() || (WIFI_BACKOFF_MIN_MS != manager.backoffMs())) {
+        testError("Connecting should reset backoff%s", "");
+    }
+
+    return testResults("testWifiBackoff");
+}
+
+int main() {
+    testWifiJoinAndRejoin();
+    testWifiBackoff();
+
+    return 0;
+}
@@ -19,16 +19,30 @@
 #
 PREFIX="${1//\./_}"
 
+#
+# gzip file once so the etag matches the served bytes
+#
+GZIP_FILE="$(mktemp)"
+gzip -c "client/$1" > "${GZIP_FILE}"
+
+#
+# etag is the start of the sha-256 of the compressed content,
+# so it changes whenever the asset does
+#
+ETAG="$(shasum -a 256 "${GZIP_FILE}" | cut -c1-16)"
+
 #
 # output declaration
 #
 echo "#define ${PREFIX}_len sizeof(${PREFIX}_gz)" > "src/${PREFIX}.h"
+echo "#define ${PREFIX}_etag \"\\\"${ETAG}\\\"\"" >> "src/${PREFIX}.h"
 echo "const uint8_t ${PREFIX}_gz[] = {" >> "src/${PREFIX}.h"
 
 #
-# gzip file and convert file to c-language array of hex literals
+# convert compressed file to c-language array of hex literals
 #
-gzip -c "client/$1" | hexdump -v -e '16/1 "_x%02X" "\n"' | sed 's/_/\\/g; s/\\x  //g; s/.*/    "&"/' >> "src/${PREFIX}.h"
+hexdump -v -e '16/1 "_x%02X" "\n"' "${GZIP_FILE}" | sed 's/_/\\/g; s/\\x  //g; s/.*/    "&"/' >> "src/${PREFIX}.h"
+rm "${GZIP_FILE}"
 
 #
 # close declaration
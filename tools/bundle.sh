@@ -8,6 +8,21 @@ tools/bundle_assets.sh
 # convert html, js and css into a binary array in a c-header
 # so they can be compiled into the application and
 # served from memory.
-tools/asset_to_c_header.sh index.html index_html.h
 tools/asset_to_c_header.sh bundle.js bundle_js.h
 tools/asset_to_c_header.sh bundle.css bundle_css.h
+
+#
+# version the bundle urls in the page with the bundles' etags,
+# so the browser can cache them forever; a new bundle gets a
+# new url.  The page is converted after this so its header
+# carries the versioned urls.
+#
+BUNDLE_JS_ETAG="$(sed -n 's/^#define bundle_js_etag "\\"\([0-9a-f]*\)\\""$/\1/p' src/bundle_js.h)"
+BUNDLE_CSS_ETAG="$(sed -n 's/^#define bundle_css_etag "\\"\([0-9a-f]*\)\\""$/\1/p' src/bundle_css.h)"
+sed -E \
+    -e "s/bundle\.js(\?v=[0-9a-f]*)?\"/bundle.js?v=${BUNDLE_JS_ETAG}\"/" \
+    -e "s/bundle\.css(\?v=[0-9a-f]*)?\"/bundle.css?v=${BUNDLE_CSS_ETAG}\"/" \
+    client/index.html > client/index.html.tmp
+mv client/index.html.tmp client/index.html
+
+tools/asset_to_c_header.sh index.html index_html.h